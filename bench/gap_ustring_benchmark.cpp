@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <unistringxx/gap_ustring.hpp>
+#include <unistringxx/rope.hpp>
+#include <unistringxx/ustring.hpp>
+
+// Replays a typing trace (typing and backspacing at a cursor that occasionally jumps) on a large text with ustring,
+// gap_ustring and rope:
+//  > gap_ustring_benchmark [text size] [edit count]
+
+namespace
+{
+    struct edit
+    {
+        // A backspace when ch is the null char.
+        std::size_t index;
+        unistringxx::uchar_t ch;
+    };
+
+    std::vector<edit> make_trace(std::size_t text_size, std::size_t count, std::mt19937& random)
+    {
+        std::vector<edit> result;
+        result.reserve(count);
+        std::size_t size = text_size;
+        std::size_t cursor = size / 2;
+        for (std::size_t ctr = 0; ctr < count; ctr++) {
+            // Move the cursor about once per 200 keystrokes, usually nearby.
+            if ((random() % 200) == 0) {
+                if ((random() % 4) == 0)
+                    cursor = random() % (size + 1);
+                else
+                    cursor = std::min(size, cursor + (random() % 2000)) - std::min(cursor, random() % 2000);
+            }
+            if ((cursor > 0) && ((random() % 8) == 0)) {
+                cursor--;
+                size--;
+                result.push_back(edit{cursor, unistringxx::uchar_t::null_char()});
+            }
+            else {
+                result.push_back(edit{cursor, unistringxx::uchar_t{static_cast<int>('a' + (random() % 26))}});
+                cursor++;
+                size++;
+            }
+        }
+        return (result);
+    }
+
+    unistringxx::ustring make_text(std::size_t size)
+    {
+        unistringxx::ustring result;
+        result.reserve(size);
+        for (std::size_t ctr = 0; ctr < size; ctr++)
+            result.push_back(unistringxx::uchar_t{static_cast<int>((ctr % 64) ? ('a' + (ctr % 26)) : '\n')});
+        return (result);
+    }
+
+    void type(unistringxx::ustring& text, std::size_t index, unistringxx::uchar_t ch)
+    {
+        text.insert(index, 1, ch);
+        return;
+    }
+
+    void type(unistringxx::gap_ustring& text, std::size_t index, unistringxx::uchar_t ch)
+    {
+        text.insert(index, 1, ch);
+        return;
+    }
+
+    void type(unistringxx::rope& text, std::size_t index, unistringxx::uchar_t ch)
+    {
+        text.insert(index, unistringxx::ustring_view{&ch, 1});
+        return;
+    }
+
+    template<typename textT>
+    double replay(textT& text, const std::vector<edit>& trace)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (const edit& item : trace) {
+            if (item.ch == unistringxx::uchar_t::null_char())
+                text.erase(item.index, 1);
+            else
+                type(text, item.index, item.ch);
+        }
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        return (std::chrono::duration<double, std::milli>(end - start).count());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t text_size = (argc > 1) ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 4000000;
+    const std::size_t count = (argc > 2) ? static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10)) : 100000;
+    std::mt19937 random{20240101};
+    const unistringxx::ustring initial = make_text(text_size);
+    const std::vector<edit> trace = make_trace(text_size, count, random);
+    std::printf("Replaying %zu keystrokes on a text of %zu code points.\n", count, text_size);
+
+    unistringxx::ustring text{initial};
+    const double ustring_time = replay(text, trace);
+
+    unistringxx::gap_ustring gap_text{initial};
+    const double gap_time = replay(gap_text, trace);
+
+    unistringxx::rope rope_text{initial};
+    const double rope_time = replay(rope_text, trace);
+
+    // Searching a gap_ustring goes through view(), which closes the gap once.
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const unistringxx::ustring_view view = gap_text.view();
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    const double view_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    if ((view != unistringxx::ustring_view{text}) || !(rope_text == text)) {
+        std::fprintf(stderr, "The results differ.\n");
+        return (EXIT_FAILURE);
+    }
+    std::printf(
+        "ustring %9.1f ms | gap_ustring %9.1f ms (%.1fx) | rope %9.1f ms (%.1fx) | gap_ustring::view() %6.2f ms\n",
+        ustring_time, gap_time, ustring_time / gap_time, rope_time, ustring_time / rope_time, view_time
+    );
+    return (EXIT_SUCCESS);
+}
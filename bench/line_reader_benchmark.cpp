@@ -0,0 +1,94 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <unistringxx/line_reader.hpp>
+#include <unistringxx/ustring.hpp>
+#include <unistringxx/ustring_io.hpp>
+
+// Reads the lines of a generated UTF-8 file (mostly ASCII, with some multi-octet text) with std::getline followed by
+// ustring::from_u8string, unistringxx::getline, and line_reader (octets only, then decoded):
+//  > line_reader_benchmark [file size in MiB] [path]
+
+namespace
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    double elapsed(clock_type::time_point start)
+    { return (std::chrono::duration<double>(clock_type::now() - start).count()); }
+
+    void print(const char* name, double seconds, std::uint64_t size, std::size_t checksum)
+    {
+        std::printf(
+            "%-32s %8.1f ms %8.2f GB/s (checksum %zu)\n", name, seconds * 1000.0,
+            static_cast<double>(size) / seconds / 1e9, checksum
+        );
+        return;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t mebibytes = (argc > 1) ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 256;
+    const std::string path = (argc > 2) ? argv[2] : "line_reader_benchmark.txt";
+
+    std::uint64_t size = 0;
+    {
+        std::ofstream file{path, std::ios::binary};
+        const std::string lines[] = {
+            "2024-01-01T00:00:00Z INFO request handled in 12 ms, path=/index.html status=200 bytes=5120\n",
+            u8"2024-01-01T00:00:01Z WARN utilisateur « élodie » a dépassé son quota — réessayer plus tard\r\n",
+            u8"2024-01-01T00:00:02Z INFO 用户登录成功，会话已建立\n",
+        };
+        for (std::size_t ctr = 0; size < (static_cast<std::uint64_t>(mebibytes) << 20); ctr++) {
+            const std::string& line = lines[(ctr % 10) < 8 ? 0 : (1 + (ctr % 2))];
+            file.write(line.data(), static_cast<std::streamsize>(line.size()));
+            size += line.size();
+        }
+    }
+
+    {
+        std::size_t checksum = 0;
+        const clock_type::time_point start = clock_type::now();
+        std::ifstream file{path, std::ios::binary};
+        std::string line;
+        while (std::getline(file, line))
+            checksum += unistringxx::ustring::from_u8string(line).size();
+        print("std::getline + from_u8string", elapsed(start), size, checksum);
+    }
+    {
+        std::size_t checksum = 0;
+        const clock_type::time_point start = clock_type::now();
+        std::ifstream file{path, std::ios::binary};
+        unistringxx::ustring line;
+        while (unistringxx::getline(file, line))
+            checksum += line.size();
+        print("unistringxx::getline", elapsed(start), size, checksum);
+    }
+    {
+        std::size_t checksum = 0;
+        const clock_type::time_point start = clock_type::now();
+        unistringxx::line_reader reader{path.c_str()};
+        const char* data = nullptr;
+        std::size_t line_size = 0;
+        while (reader.read_line(data, line_size))
+            checksum += line_size;
+        print("line_reader (octets)", elapsed(start), size, checksum);
+    }
+    {
+        std::size_t checksum = 0;
+        const clock_type::time_point start = clock_type::now();
+        unistringxx::line_reader reader{path.c_str()};
+        unistringxx::ustring line;
+        while (reader.read_line(line))
+            checksum += line.size();
+        print("line_reader (ustring)", elapsed(start), size, checksum);
+    }
+
+    std::remove(path.c_str());
+    return (EXIT_SUCCESS);
+}
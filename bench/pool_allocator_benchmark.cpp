@@ -0,0 +1,43 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+#include <unistringxx/pool_allocator.hpp>
+#include <unistringxx/ustring.hpp>
+
+// Creates and destroys short-lived strings (the pattern of request handlers) with ustring and pool_ustring:
+//  > pool_allocator_benchmark [iteration count]
+
+namespace
+{
+    template<typename stringT>
+    double churn(std::size_t count, std::size_t& checksum)
+    {
+        const unistringxx::ustring source = unistringxx::ustring::from_u8string("request header value");
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (std::size_t ctr = 0; ctr < count; ctr++) {
+            stringT text{source.data(), source.size() - (ctr % 8)};
+            stringT other{text};
+            other.append(text.data(), 4);
+            checksum += other.size();
+        }
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        return (std::chrono::duration<double, std::milli>(end - start).count());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t count = (argc > 1) ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 10000000;
+    std::size_t checksum = 0;
+    const double ustring_time = churn<unistringxx::ustring>(count, checksum);
+    unistringxx::buffer_pool::reset_thread_statistics();
+    const double pool_time = churn<unistringxx::pool_ustring>(count, checksum);
+    const unistringxx::buffer_pool::statistics statistics = unistringxx::buffer_pool::thread_statistics();
+    std::printf(
+        "%zu iterations: ustring %9.1f ms | pool_ustring %9.1f ms (%.2fx), %zu hits, %zu misses (checksum %zu)\n",
+        count, ustring_time, pool_time, ustring_time / pool_time, statistics.hits, statistics.misses, checksum
+    );
+    return (EXIT_SUCCESS);
+}
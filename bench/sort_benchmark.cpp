@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <unistringxx/sort.hpp>
+#include <unistringxx/ustring.hpp>
+
+// Compares string_sort with std::sort on a few key distributions:
+//  > sort_benchmark [count]
+
+namespace
+{
+    typedef std::vector<unistringxx::ustring> text_list;
+
+    // Random lowercase ASCII words.
+    text_list make_words(std::size_t count, std::mt19937& random)
+    {
+        text_list result;
+        result.reserve(count);
+        for (std::size_t ctr = 0; ctr < count; ctr++) {
+            unistringxx::ustring text;
+            const std::size_t size = 4 + (random() % 12);
+            for (std::size_t itr = 0; itr < size; itr++)
+                text.push_back(unistringxx::uchar_t{static_cast<int>('a' + (random() % 26))});
+            result.push_back(text);
+        }
+        return (result);
+    }
+
+    // Export-style keys: a few long shared prefixes followed by a numeric suffix.
+    text_list make_keys(std::size_t count, std::mt19937& random)
+    {
+        using namespace unistringxx::operators;
+
+        const unistringxx::ustring prefixes[] = {
+            U"export/2024/customers/region-europe/"_us, U"export/2024/customers/region-asia/"_us,
+            U"export/2024/orders/archived/"_us, U"エクスポート/顧客/"_us
+        };
+        text_list result;
+        result.reserve(count);
+        for (std::size_t ctr = 0; ctr < count; ctr++) {
+            unistringxx::ustring text{prefixes[random() % 4]};
+            text.append_number(random() % 10000000);
+            result.push_back(text);
+        }
+        return (result);
+    }
+
+    // Random code points from all planes.
+    text_list make_mixed(std::size_t count, std::mt19937& random)
+    {
+        text_list result;
+        result.reserve(count);
+        for (std::size_t ctr = 0; ctr < count; ctr++) {
+            unistringxx::ustring text;
+            const std::size_t size = 1 + (random() % 16);
+            for (std::size_t itr = 0; itr < size; itr++) {
+                int code_point = static_cast<int>(random() % 0x110000);
+                if ((code_point >= 0xD800) && (code_point <= 0xDFFF))
+                    code_point = 0xFFFD;
+                text.push_back(unistringxx::uchar_t{code_point});
+            }
+            result.push_back(text);
+        }
+        return (result);
+    }
+
+    double measure(const text_list& input, const std::function<void (text_list&)>& sort_function)
+    {
+        text_list texts{input};
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        sort_function(texts);
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        if (!std::is_sorted(texts.begin(), texts.end())) {
+            std::fprintf(stderr, "Result is not sorted.\n");
+            std::exit(EXIT_FAILURE);
+        }
+        return (std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    void run(const char* name, const text_list& input)
+    {
+        const double std_sort = measure(input, [](text_list& texts) { std::sort(texts.begin(), texts.end()); });
+        const double std_stable_sort = measure(
+            input, [](text_list& texts) { std::stable_sort(texts.begin(), texts.end()); }
+        );
+        const double string_sort = measure(
+            input, [](text_list& texts) { unistringxx::string_sort(texts.begin(), texts.end()); }
+        );
+        const double stable_string_sort = measure(
+            input, [](text_list& texts) { unistringxx::stable_string_sort(texts.begin(), texts.end()); }
+        );
+        const double parallel_string_sort = measure(
+            input, [](text_list& texts) { unistringxx::string_sort(texts.begin(), texts.end(), 0); }
+        );
+        std::printf(
+            "%-8s std::sort %9.1f ms | std::stable_sort %9.1f ms | string_sort %9.1f ms (%.2fx) | "
+            "stable_string_sort %9.1f ms (%.2fx) | parallel string_sort %9.1f ms (%.2fx)\n",
+            name, std_sort, std_stable_sort, string_sort, std_sort / string_sort, stable_string_sort,
+            std_stable_sort / stable_string_sort, parallel_string_sort, std_sort / parallel_string_sort
+        );
+        return;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t count = (argc > 1) ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+    std::mt19937 random{20240101};
+    std::printf("Sorting %zu texts.\n", count);
+    run("words", make_words(count, random));
+    run("keys", make_keys(count, random));
+    run("mixed", make_mixed(count, random));
+    return (EXIT_SUCCESS);
+}
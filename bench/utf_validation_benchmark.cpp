@@ -0,0 +1,116 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <unistringxx/ustring.hpp>
+#include <unistringxx/utf_validation.hpp>
+
+// Validates and counts the code points of a generated UTF-8 text (ASCII, then mixed with multi-octet text) and of its
+// UTF-16 encoding, and compares sizing a buffer with from_u8string(...).size() against count_code_points_utf8:
+//  > utf_validation_benchmark [text size in MiB] [repetitions]
+
+namespace
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    double elapsed(clock_type::time_point start)
+    { return (std::chrono::duration<double>(clock_type::now() - start).count()); }
+
+    void print(const char* name, double seconds, std::uint64_t size, std::size_t checksum)
+    {
+        std::printf(
+            "%-36s %8.1f ms %8.2f GB/s (checksum %zu)\n", name, seconds * 1000.0,
+            static_cast<double>(size) / seconds / 1e9, checksum
+        );
+        return;
+    }
+
+    std::string make_text(std::size_t size, bool is_ascii)
+    {
+        const std::string words[] = {
+            "request handled in 12 ms, path=/index.html status=200 ",
+            u8"utilisateur « élodie » a dépassé son quota — ",
+            u8"用户登录成功，会话已建立 ",
+            u8"Съешь же ещё этих мягких французских булок 😀 ",
+        };
+        std::string result;
+        for (std::size_t ctr = 0; result.size() < size; ctr++)
+            result += words[is_ascii ? 0 : (ctr % 4)];
+        return (result);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t mebibytes = (argc > 1) ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 64;
+    const std::size_t repetitions = (argc > 2) ? static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10)) : 10;
+
+    for (bool is_ascii : {true, false}) {
+        std::printf("%s text\n", is_ascii ? "ASCII" : "Mixed");
+        const std::string text = make_text(mebibytes << 20, is_ascii);
+        // Read through a volatile pointer, so that the calls are not taken out of the loops.
+        const char* volatile data = text.data();
+        const std::uint64_t total_size = static_cast<std::uint64_t>(text.size()) * repetitions;
+        {
+            std::size_t checksum = 0;
+            const clock_type::time_point start = clock_type::now();
+            for (std::size_t ctr = 0; ctr < repetitions; ctr++)
+                checksum += unistringxx::validate_utf8(data, text.size());
+            print("validate_utf8", elapsed(start), total_size, checksum);
+        }
+        {
+            std::size_t checksum = 0;
+            const clock_type::time_point start = clock_type::now();
+            for (std::size_t ctr = 0; ctr < repetitions; ctr++)
+                checksum += unistringxx::count_code_points_utf8(data, text.size());
+            print("count_code_points_utf8", elapsed(start), total_size, checksum);
+        }
+        unistringxx::ustring str;
+        {
+            std::size_t checksum = 0;
+            const clock_type::time_point start = clock_type::now();
+            for (std::size_t ctr = 0; ctr < repetitions; ctr++) {
+                str = unistringxx::ustring::from_u8string(text);
+                checksum += str.size();
+            }
+            print("from_u8string(...).size()", elapsed(start), total_size, checksum);
+        }
+        {
+            std::size_t checksum = 0;
+            const clock_type::time_point start = clock_type::now();
+            const unistringxx::uchar_t* volatile code_points = str.data();
+            for (std::size_t ctr = 0; ctr < repetitions; ctr++)
+                checksum += unistringxx::utf8_length_of(code_points, str.size());
+            print("utf8_length_of (per output octet)", elapsed(start), total_size, checksum);
+        }
+        {
+            std::size_t checksum = 0;
+            const clock_type::time_point start = clock_type::now();
+            for (std::size_t ctr = 0; ctr < repetitions; ctr++)
+                checksum += str.to_u8string().size();
+            print("to_u8string (per output octet)", elapsed(start), total_size, checksum);
+        }
+
+        const std::u16string utf16 = str.to_u16string();
+        const char16_t* volatile units = utf16.data();
+        const std::uint64_t utf16_size = static_cast<std::uint64_t>(utf16.size()) * sizeof (char16_t) * repetitions;
+        {
+            std::size_t checksum = 0;
+            const clock_type::time_point start = clock_type::now();
+            for (std::size_t ctr = 0; ctr < repetitions; ctr++)
+                checksum += unistringxx::validate_utf16(units, utf16.size());
+            print("validate_utf16", elapsed(start), utf16_size, checksum);
+        }
+        {
+            std::size_t checksum = 0;
+            const clock_type::time_point start = clock_type::now();
+            for (std::size_t ctr = 0; ctr < repetitions; ctr++)
+                checksum += unistringxx::count_code_points_utf16(units, utf16.size());
+            print("count_code_points_utf16", elapsed(start), utf16_size, checksum);
+        }
+    }
+    return (EXIT_SUCCESS);
+}
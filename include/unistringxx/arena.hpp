@@ -0,0 +1,243 @@
+#if !defined(UNISTRINGXX_ARENA_HPP)
+#define UNISTRINGXX_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+#include "utils.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        const std::size_t _s_arena_default_block_size = 4096;
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// A monotonic memory arena: allocations are carved sequentially out of large blocks, and the memory is only given
+    /// back when the arena is released or destroyed (deallocating the most recent allocation rewinds it, everything
+    /// else is a no-op). The arena can start with a caller supplied buffer (e.g. on the stack), in which case small
+    /// workloads never allocate from the heap. An arena is not thread-safe.
+    ///
+    /// This is meant for request-scoped processing: create an arena for the request, build arena_ustring (or other
+    /// containers using arena_allocator) objects from it, and drop everything at once at the end of the request.
+    ///
+    class arena
+    {
+    public:
+        ///
+        /// @param block_size The size of the first heap block. The next blocks are at least twice as large as the
+        ///     previous one.
+        ///
+        explicit arena(std::size_t block_size = _s_arena_default_block_size) noexcept :
+            arena{nullptr, 0, block_size}
+        { return; }
+
+        ///
+        /// @param buffer, size A buffer to allocate from before using the heap. It must outlive the arena.
+        /// @param block_size The size of the first heap block.
+        ///
+        arena(void* buffer, std::size_t size, std::size_t block_size = _s_arena_default_block_size) noexcept :
+            _buffer{static_cast<char*>(buffer)}, _buffer_size{size}, _blocks{nullptr},
+            _current{static_cast<char*>(buffer)}, _end{static_cast<char*>(buffer) + size},
+            _block_size{std::max<std::size_t>(block_size, 1)}, _block_count{0}
+        { return; }
+
+        arena(const arena&) = delete;
+        arena& operator=(const arena&) = delete;
+
+        ~arena(void)
+        {
+            this->release();
+            return;
+        }
+
+        ///
+        /// Allocates size bytes aligned to alignment (which must be a power of 2).
+        ///
+        void* allocate(std::size_t size, std::size_t alignment = alignof (std::max_align_t))
+        {
+            char* result = align_up(_current, alignment);
+            // The aligned pointer may be past the end of the block (e.g. an over-aligned request on a small buffer),
+            // so it has to be checked before measuring the room that is left.
+            if ((result == nullptr) || (result > _end) || (size > static_cast<std::size_t>(_end - result))) {
+                if (size > (std::numeric_limits<std::size_t>::max() - alignment)) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                    UNISTRINGXX_THROW(std::length_error, "The arena block would have exceeded the addressable size.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                    std::abort();
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+                }
+                this->add_block(size + alignment);
+                result = align_up(_current, alignment);
+            }
+            _current = result + size;
+            return (result);
+        }
+
+        ///
+        /// Gives back an allocation. Only the most recent allocation is reclaimed (e.g. a temporary that is built and
+        /// destroyed right away); other memory is reclaimed by release().
+        ///
+        void deallocate(void* pointer, std::size_t size) noexcept
+        {
+            if ((static_cast<char*>(pointer) + size) == _current)
+                _current = static_cast<char*>(pointer);
+            return;
+        }
+
+        ///
+        /// Frees all the heap blocks and rewinds to the start of the initial buffer. All the memory allocated from the
+        /// arena becomes invalid.
+        ///
+        void release(void) noexcept
+        {
+            while (_blocks != nullptr) {
+                block_header* next = _blocks->next;
+                ::operator delete(static_cast<void*>(_blocks));
+                _blocks = next;
+            }
+            _current = _buffer;
+            _end = _buffer + _buffer_size;
+            _block_count = 0;
+            return;
+        }
+
+        ///
+        /// Gets the number of blocks allocated from the heap (0 as long as the initial buffer is enough).
+        ///
+        std::size_t block_count(void) const noexcept
+        { return (_block_count); }
+
+    private:
+        struct block_header
+        {
+            block_header* next;
+            std::size_t size;
+        };
+
+        char* _buffer;
+        std::size_t _buffer_size;
+        block_header* _blocks;
+        char* _current;
+        char* _end;
+        std::size_t _block_size;
+        std::size_t _block_count;
+
+        static char* align_up(char* pointer, std::size_t alignment) noexcept
+        {
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(pointer);
+            const std::uintptr_t mask = static_cast<std::uintptr_t>(alignment - 1);
+            return (pointer + (((address + mask) & ~mask) - address));
+        }
+
+        void add_block(std::size_t minimum_size)
+        {
+            // Grows geometrically, so that the number of blocks is logarithmic in the total size.
+            std::size_t size = (_blocks == nullptr) ? _block_size : (_blocks->size * 2);
+            size = std::max(size, minimum_size);
+            if (size > (std::numeric_limits<std::size_t>::max() - sizeof (block_header))) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::length_error, "The arena block would have exceeded the addressable size.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                std::abort();
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            block_header* block = static_cast<block_header*>(::operator new(sizeof (block_header) + size));
+            block->next = _blocks;
+            block->size = size;
+            _blocks = block;
+            _block_count++;
+            _current = reinterpret_cast<char*>(block + 1);
+            _end = _current + size;
+            return;
+        }
+    }; // class arena
+
+    ///
+    /// An allocator that allocates from an arena. Containers keep the arena they were created with: the allocator is
+    /// not propagated on assignment or swap (like std::pmr::polymorphic_allocator), so assigning a text that lives in
+    /// an arena to a text that lives elsewhere copies it, and a longer-lived object never ends up pointing into a
+    /// shorter-lived arena. Copies of a container use the same arena.
+    ///
+    template<typename valueT>
+    class arena_allocator
+    {
+    public:
+        typedef valueT value_type;
+        typedef valueT* pointer;
+        typedef const valueT* const_pointer;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        typedef std::false_type propagate_on_container_copy_assignment;
+        typedef std::false_type propagate_on_container_move_assignment;
+        typedef std::false_type propagate_on_container_swap;
+        typedef std::false_type is_always_equal;
+
+        template<typename otherT>
+        struct rebind
+        {
+            typedef arena_allocator<otherT> other;
+        };
+
+        arena_allocator(arena& memory) noexcept :
+            _arena{&memory}
+        { return; }
+
+        template<typename otherT>
+        arena_allocator(const arena_allocator<otherT>& other) noexcept :
+            _arena{other.get_arena()}
+        { return; }
+
+        valueT* allocate(size_type count)
+        {
+            if (count > (std::numeric_limits<size_type>::max() / sizeof (valueT))) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::length_error, "The 'count' argument would have exceeded the addressable size.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                std::abort();
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            return (static_cast<valueT*>(_arena->allocate(count * sizeof (valueT), alignof (valueT))));
+        }
+
+        void deallocate(valueT* pointer, size_type count) noexcept
+        {
+            _arena->deallocate(pointer, count * sizeof (valueT));
+            return;
+        }
+
+        arena_allocator select_on_container_copy_construction(void) const noexcept
+        { return (*this); }
+
+        arena* get_arena(void) const noexcept
+        { return (_arena); }
+
+        template<typename otherT>
+        friend bool operator==(const arena_allocator& left, const arena_allocator<otherT>& right) noexcept
+        { return (left.get_arena() == right.get_arena()); }
+
+        template<typename otherT>
+        friend bool operator!=(const arena_allocator& left, const arena_allocator<otherT>& right) noexcept
+        { return (left.get_arena() != right.get_arena()); }
+
+    private:
+        arena* _arena;
+    }; // class arena_allocator
+
+    typedef generic_ustring<arena_allocator<uchar_t_traits::char_type>> arena_ustring;
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_ARENA_HPP)
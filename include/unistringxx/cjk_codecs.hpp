@@ -0,0 +1,545 @@
+#if !defined(UNISTRINGXX_CJK_CODECS_HPP)
+#define UNISTRINGXX_CJK_CODECS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cjk_tables.hpp"
+#include "codec.hpp"
+#include "common.hpp"
+#include "single_byte_codecs.hpp"
+#include "uchar.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // The multibyte codecs follow the decoders and encoders of the WHATWG Encoding Standard. Their indexes map
+        // pointers (computed from the octets of a sequence) to code points, and are stored compressed in segments by
+        // tools/gen_cjk_tables.pl.
+        struct cjk_index
+        {
+            const std::uint16_t* segment_starts;
+            const std::uint32_t* segment_values;
+            const std::uint16_t* literals;
+            const std::uint16_t* row_segments;
+            std::size_t segment_count;
+            std::size_t rows;
+            std::size_t row_size;
+        };
+
+#define UNISTRINGXX_CJK_INDEX(name) \
+    { \
+        _s_##name##_segment_starts, _s_##name##_segment_values, _s_##name##_literals, _s_##name##_row_segments, \
+        sizeof (_s_##name##_segment_starts) / sizeof (_s_##name##_segment_starts[0]), _s_##name##_rows, \
+        _s_##name##_row_size \
+    }
+
+        const cjk_index _s_jis0208_index = UNISTRINGXX_CJK_INDEX(jis0208);
+        const cjk_index _s_jis0212_index = UNISTRINGXX_CJK_INDEX(jis0212);
+        const cjk_index _s_gb18030_index = UNISTRINGXX_CJK_INDEX(gb18030);
+        const cjk_index _s_big5_index = UNISTRINGXX_CJK_INDEX(big5);
+
+#undef UNISTRINGXX_CJK_INDEX
+
+        const std::size_t _s_gb18030_range_count = sizeof (_s_gb18030_ranges_pointers) / sizeof (std::uint32_t);
+
+        // The size of the state of the multibyte decoders: up to 3 octets of an incomplete sequence (the first one
+        // being 0 if there is none), or the lead octet and a flag for EUC-JP.
+        const std::size_t _s_cjk_state_size = 3;
+
+        // Gets the code point of a pointer, or 0 if it is not mapped.
+        inline std::uint32_t get_index_code_point(const cjk_index& index, std::size_t pointer) noexcept
+        {
+            const std::size_t row = pointer / index.row_size;
+            if (row >= index.rows)
+                return (0);
+            // The segment of the pointer is the last one that starts at or before it, within the segments of the row.
+            const std::uint16_t* first = index.segment_starts + index.row_segments[row];
+            const std::uint16_t* last = index.segment_starts + (
+                ((row + 1) < index.rows) ? (index.row_segments[row + 1] + std::size_t{1}) : index.segment_count
+            );
+            const std::uint16_t* segment = std::upper_bound(first, last, pointer) - 1;
+            const std::size_t offset = pointer - *segment;
+            const std::uint32_t value = index.segment_values[segment - index.segment_starts];
+            if ((value & 0x80000000) == 0)
+                return ((value == 0) ? 0 : static_cast<std::uint32_t>(value + offset));
+            const std::uint32_t low_bits = index.literals[(value & 0xFFFFFF) + offset];
+            return ((low_bits == 0) ? 0 : ((((value >> 24) & 0x7F) << 16) | low_bits));
+        }
+
+        // Gets the (code point, pointer) pairs of an index, sorted. Only the decoding direction is stored, so the
+        // encoders build this on first use.
+        inline std::vector<std::uint64_t> get_index_pointers(const cjk_index& index)
+        {
+            std::vector<std::uint64_t> result;
+            for (std::size_t pointer = 0; pointer < (index.rows * index.row_size); pointer++) {
+                const std::uint64_t code_point = get_index_code_point(index, pointer);
+                if (code_point != 0)
+                    result.push_back((code_point << 32) | pointer);
+            }
+            std::sort(result.begin(), result.end());
+            return (result);
+        }
+
+        inline const std::vector<std::uint64_t>& get_jis0208_pointers(void)
+        {
+            static const std::vector<std::uint64_t> pointers = get_index_pointers(_s_jis0208_index);
+            return (pointers);
+        }
+
+        inline const std::vector<std::uint64_t>& get_gb18030_pointers(void)
+        {
+            static const std::vector<std::uint64_t> pointers = get_index_pointers(_s_gb18030_index);
+            return (pointers);
+        }
+
+        inline const std::vector<std::uint64_t>& get_big5_pointers(void)
+        {
+            static const std::vector<std::uint64_t> pointers = get_index_pointers(_s_big5_index);
+            return (pointers);
+        }
+
+        // Finds the first pointer of a code point outside [excluded_first, excluded_last) (or the last one if
+        // is_last is set). Returns false if there is none.
+        inline bool find_index_pointer(
+            const std::vector<std::uint64_t>& pointers, std::uint32_t code_point, std::size_t& pointer,
+            std::size_t excluded_first = 0, std::size_t excluded_last = 0, bool is_last = false
+        )
+        {
+            const std::uint64_t key = std::uint64_t{code_point} << 32;
+            std::vector<std::uint64_t>::const_iterator first = std::lower_bound(pointers.begin(), pointers.end(), key);
+            std::vector<std::uint64_t>::const_iterator last = std::lower_bound(
+                first, pointers.end(), key + (std::uint64_t{1} << 32)
+            );
+            bool is_found = false;
+            for (; first != last; ++first) {
+                const std::size_t candidate = static_cast<std::size_t>(*first & 0xFFFFFFFF);
+                if ((candidate >= excluded_first) && (candidate < excluded_last))
+                    continue;
+                pointer = candidate;
+                is_found = true;
+                if (!is_last)
+                    break;
+            }
+            return (is_found);
+        }
+
+        inline std::uint32_t get_gb18030_ranges_code_point(std::uint32_t pointer) noexcept
+        {
+            if (((pointer > 39419) && (pointer < 189000)) || (pointer > 1237575))
+                return (0);
+            if (pointer == 7457)
+                return (0xE7C7);
+            if (pointer >= 189000)
+                return (0x10000 + pointer - 189000);
+            const std::uint32_t* range = std::upper_bound(
+                _s_gb18030_ranges_pointers, _s_gb18030_ranges_pointers + _s_gb18030_range_count, pointer
+            ) - 1;
+            return (_s_gb18030_ranges_code_points[range - _s_gb18030_ranges_pointers] + pointer - *range);
+        }
+
+        inline std::uint32_t get_gb18030_ranges_pointer(std::uint32_t code_point) noexcept
+        {
+            if (code_point == 0xE7C7)
+                return (7457);
+            if (code_point >= 0x10000)
+                return (189000 + code_point - 0x10000);
+            const std::uint16_t* range = std::upper_bound(
+                _s_gb18030_ranges_code_points, _s_gb18030_ranges_code_points + _s_gb18030_range_count, code_point
+            ) - 1;
+            return (_s_gb18030_ranges_pointers[range - _s_gb18030_ranges_code_points] + code_point - *range);
+        }
+
+        inline bool is_octet_in(std::uint8_t octet, std::uint8_t first, std::uint8_t last) noexcept
+        { return ((octet >= first) && (octet <= last)); }
+
+        // The decoders below decode [first, last) into out[count...] (at most one code point per octet, including
+        // the octets kept in the state from the previous chunk). An octet that ends an invalid sequence is decoded
+        // again if it is ASCII. They return the first octet that is not decoded (last, or the error if is_decoded is
+        // set to false).
+
+        inline const std::uint8_t* decode_shift_jis(
+            std::uint8_t* state, codec_error_policy policy, const std::uint8_t* first, const std::uint8_t* last,
+            uchar_t* out, std::size_t& count, bool& is_decoded
+        )
+        {
+            while (first != last) {
+                const std::uint8_t octet = *first;
+                if (state[0] != 0) {
+                    const std::uint8_t lead = state[0];
+                    state[0] = 0;
+                    std::uint32_t code_point = 0;
+                    if (is_octet_in(octet, 0x40, 0x7E) || is_octet_in(octet, 0x80, 0xFC)) {
+                        const std::size_t pointer = (
+                            ((lead - ((lead < 0xA0) ? 0x81 : 0xC1)) * std::size_t{188}) + octet -
+                            ((octet < 0x7F) ? 0x40 : 0x41)
+                        );
+                        // The user-defined area is mapped to the private use area.
+                        code_point = ((pointer >= 8836) && (pointer <= 10715)) ?
+                            static_cast<std::uint32_t>(0xE000 - 8836 + pointer) :
+                            get_index_code_point(_s_jis0208_index, pointer);
+                    }
+                    if (code_point != 0) {
+                        out[count++] = uchar_t{static_cast<uchar_t::int_type>(code_point)};
+                    }
+                    else if (!put_decode_error(policy, out, count)) {
+                        is_decoded = false;
+                        break;
+                    }
+                    else if (octet < 0x80) {
+                        continue;
+                    }
+                }
+                else if (((last - first) >= 16) && is_ascii_block(first)) {
+                    widen_ascii_block(first, out + count);
+                    first += 16;
+                    count += 16;
+                    continue;
+                }
+                else if (octet <= 0x80) {
+                    out[count++] = uchar_t{static_cast<uchar_t::int_type>(octet)};
+                }
+                else if (is_octet_in(octet, 0xA1, 0xDF)) {
+                    out[count++] = uchar_t{static_cast<uchar_t::int_type>(0xFF61 - 0xA1 + octet)};
+                }
+                else if (is_octet_in(octet, 0x81, 0x9F) || is_octet_in(octet, 0xE0, 0xFC)) {
+                    state[0] = octet;
+                }
+                else if (!put_decode_error(policy, out, count)) {
+                    is_decoded = false;
+                    break;
+                }
+                ++first;
+            }
+            return (first);
+        }
+
+        // state[0] is the lead octet, and state[1] is set for the JIS X 0212 sequences (that start with 0x8F).
+        inline const std::uint8_t* decode_euc_jp(
+            std::uint8_t* state, codec_error_policy policy, const std::uint8_t* first, const std::uint8_t* last,
+            uchar_t* out, std::size_t& count, bool& is_decoded
+        )
+        {
+            while (first != last) {
+                const std::uint8_t octet = *first;
+                if ((state[0] == 0x8E) && is_octet_in(octet, 0xA1, 0xDF)) {
+                    state[0] = 0;
+                    out[count++] = uchar_t{static_cast<uchar_t::int_type>(0xFF61 - 0xA1 + octet)};
+                }
+                else if ((state[0] == 0x8F) && is_octet_in(octet, 0xA1, 0xFE)) {
+                    state[0] = octet;
+                    state[1] = 1;
+                }
+                else if (state[0] != 0) {
+                    const std::uint8_t lead = state[0];
+                    const bool is_jis0212 = (state[1] != 0);
+                    state[0] = 0;
+                    state[1] = 0;
+                    std::uint32_t code_point = 0;
+                    if (is_octet_in(lead, 0xA1, 0xFE) && is_octet_in(octet, 0xA1, 0xFE)) {
+                        const std::size_t pointer = ((lead - 0xA1) * std::size_t{94}) + octet - 0xA1;
+                        code_point = get_index_code_point(is_jis0212 ? _s_jis0212_index : _s_jis0208_index, pointer);
+                    }
+                    if (code_point != 0) {
+                        out[count++] = uchar_t{static_cast<uchar_t::int_type>(code_point)};
+                    }
+                    else if (!put_decode_error(policy, out, count)) {
+                        is_decoded = false;
+                        break;
+                    }
+                    else if (octet < 0x80) {
+                        continue;
+                    }
+                }
+                else if (((last - first) >= 16) && is_ascii_block(first)) {
+                    widen_ascii_block(first, out + count);
+                    first += 16;
+                    count += 16;
+                    continue;
+                }
+                else if (octet < 0x80) {
+                    out[count++] = uchar_t{static_cast<uchar_t::int_type>(octet)};
+                }
+                else if ((octet == 0x8E) || (octet == 0x8F) || is_octet_in(octet, 0xA1, 0xFE)) {
+                    state[0] = octet;
+                }
+                else if (!put_decode_error(policy, out, count)) {
+                    is_decoded = false;
+                    break;
+                }
+                ++first;
+            }
+            return (first);
+        }
+
+        // Decodes GBK and GB18030 (the GBK decoder is the GB18030 decoder). state holds the octets of a sequence.
+        inline const std::uint8_t* decode_gb18030(
+            std::uint8_t* state, codec_error_policy policy, const std::uint8_t* first, const std::uint8_t* last,
+            uchar_t* out, std::size_t& count, bool& is_decoded
+        )
+        {
+            while (first != last) {
+                const std::uint8_t octet = *first;
+                if ((state[2] != 0) && is_octet_in(octet, 0x30, 0x39)) {
+                    const std::uint32_t pointer = (
+                        ((((state[0] - 0x81) * 10 + (state[1] - 0x30)) * 126 + (state[2] - 0x81)) * 10) + octet - 0x30
+                    );
+                    const std::uint32_t code_point = get_gb18030_ranges_code_point(pointer);
+                    state[0] = 0;
+                    state[1] = 0;
+                    state[2] = 0;
+                    if (code_point != 0) {
+                        out[count++] = uchar_t{static_cast<uchar_t::int_type>(code_point)};
+                    }
+                    else if (!put_decode_error(policy, out, count)) {
+                        is_decoded = false;
+                        break;
+                    }
+                }
+                else if ((state[1] != 0) && ((state[2] != 0) || !is_octet_in(octet, 0x81, 0xFE))) {
+                    // An invalid four-octet sequence: its second octet (a digit) is decoded again, and so are its
+                    // third octet (as a lead octet) and the current octet.
+                    if (!put_decode_error(policy, out, count)) {
+                        is_decoded = false;
+                        break;
+                    }
+                    out[count++] = uchar_t{static_cast<uchar_t::int_type>(state[1])};
+                    state[0] = state[2];
+                    state[1] = 0;
+                    state[2] = 0;
+                    continue;
+                }
+                else if (state[1] != 0) {
+                    state[2] = octet;
+                }
+                else if ((state[0] != 0) && is_octet_in(octet, 0x30, 0x39)) {
+                    state[1] = octet;
+                }
+                else if (state[0] != 0) {
+                    const std::uint8_t lead = state[0];
+                    state[0] = 0;
+                    std::uint32_t code_point = 0;
+                    if (is_octet_in(octet, 0x40, 0x7E) || is_octet_in(octet, 0x80, 0xFE)) {
+                        const std::size_t pointer = (
+                            ((lead - 0x81) * std::size_t{190}) + octet - ((octet < 0x7F) ? 0x40 : 0x41)
+                        );
+                        code_point = get_index_code_point(_s_gb18030_index, pointer);
+                    }
+                    if (code_point != 0) {
+                        out[count++] = uchar_t{static_cast<uchar_t::int_type>(code_point)};
+                    }
+                    else if (!put_decode_error(policy, out, count)) {
+                        is_decoded = false;
+                        break;
+                    }
+                    else if (octet < 0x80) {
+                        continue;
+                    }
+                }
+                else if (((last - first) >= 16) && is_ascii_block(first)) {
+                    widen_ascii_block(first, out + count);
+                    first += 16;
+                    count += 16;
+                    continue;
+                }
+                else if (octet < 0x80) {
+                    out[count++] = uchar_t{static_cast<uchar_t::int_type>(octet)};
+                }
+                else if (octet == 0x80) {
+                    out[count++] = uchar_t{0x20AC};
+                }
+                else if (octet != 0xFF) {
+                    state[0] = octet;
+                }
+                else if (!put_decode_error(policy, out, count)) {
+                    is_decoded = false;
+                    break;
+                }
+                ++first;
+            }
+            return (first);
+        }
+
+        inline const std::uint8_t* decode_big5(
+            std::uint8_t* state, codec_error_policy policy, const std::uint8_t* first, const std::uint8_t* last,
+            uchar_t* out, std::size_t& count, bool& is_decoded
+        )
+        {
+            while (first != last) {
+                const std::uint8_t octet = *first;
+                if (state[0] != 0) {
+                    const std::uint8_t lead = state[0];
+                    state[0] = 0;
+                    std::uint32_t code_point = 0;
+                    if (is_octet_in(octet, 0x40, 0x7E) || is_octet_in(octet, 0xA1, 0xFE)) {
+                        const std::size_t pointer = (
+                            ((lead - 0x81) * std::size_t{157}) + octet - ((octet < 0x7F) ? 0x40 : 0x62)
+                        );
+                        // These pointers map to a letter and a combining mark.
+                        if ((pointer == 1133) || (pointer == 1135) || (pointer == 1164) || (pointer == 1166)) {
+                            out[count++] = uchar_t{(pointer < 1164) ? 0x00CA : 0x00EA};
+                            out[count++] = uchar_t{((pointer == 1133) || (pointer == 1164)) ? 0x0304 : 0x030C};
+                            ++first;
+                            continue;
+                        }
+                        code_point = get_index_code_point(_s_big5_index, pointer);
+                    }
+                    if (code_point != 0) {
+                        out[count++] = uchar_t{static_cast<uchar_t::int_type>(code_point)};
+                    }
+                    else if (!put_decode_error(policy, out, count)) {
+                        is_decoded = false;
+                        break;
+                    }
+                    else if (octet < 0x80) {
+                        continue;
+                    }
+                }
+                else if (((last - first) >= 16) && is_ascii_block(first)) {
+                    widen_ascii_block(first, out + count);
+                    first += 16;
+                    count += 16;
+                    continue;
+                }
+                else if (octet < 0x80) {
+                    out[count++] = uchar_t{static_cast<uchar_t::int_type>(octet)};
+                }
+                else if (is_octet_in(octet, 0x81, 0xFE)) {
+                    state[0] = octet;
+                }
+                else if (!put_decode_error(policy, out, count)) {
+                    is_decoded = false;
+                    break;
+                }
+                ++first;
+            }
+            return (first);
+        }
+
+        // The encoders below write the octets of a valid code point to out (at most 4). They return the number of
+        // octets, or 0 if the encoding does not have the code point.
+
+        // Maps the code points that the Japanese encoders handle outside of the index. Returns 0 if there is none.
+        inline std::uint32_t get_japanese_special_octet(std::uint32_t code_point) noexcept
+        {
+            if (code_point == 0x00A5)
+                return (0x5C);
+            if (code_point == 0x203E)
+                return (0x7E);
+            return (0);
+        }
+
+        inline std::size_t encode_shift_jis(std::uint32_t code_point, std::uint8_t* out)
+        {
+            if (code_point <= 0x80) {
+                out[0] = static_cast<std::uint8_t>(code_point);
+                return (1);
+            }
+            if (get_japanese_special_octet(code_point) != 0) {
+                out[0] = static_cast<std::uint8_t>(get_japanese_special_octet(code_point));
+                return (1);
+            }
+            if ((code_point >= 0xFF61) && (code_point <= 0xFF9F)) {
+                out[0] = static_cast<std::uint8_t>(code_point - 0xFF61 + 0xA1);
+                return (1);
+            }
+            std::size_t pointer = 0;
+            code_point = (code_point == 0x2212) ? 0xFF0D : code_point;
+            // The NEC selected IBM extensions (pointers 8272 to 8835) are only encoded as the IBM extensions.
+            if (!find_index_pointer(get_jis0208_pointers(), code_point, pointer, 8272, 8836))
+                return (0);
+            const std::size_t lead = pointer / 188;
+            const std::size_t trail = pointer % 188;
+            out[0] = static_cast<std::uint8_t>(lead + ((lead < 0x1F) ? 0x81 : 0xC1));
+            out[1] = static_cast<std::uint8_t>(trail + ((trail < 0x3F) ? 0x40 : 0x41));
+            return (2);
+        }
+
+        inline std::size_t encode_euc_jp(std::uint32_t code_point, std::uint8_t* out)
+        {
+            if (code_point < 0x80) {
+                out[0] = static_cast<std::uint8_t>(code_point);
+                return (1);
+            }
+            if (get_japanese_special_octet(code_point) != 0) {
+                out[0] = static_cast<std::uint8_t>(get_japanese_special_octet(code_point));
+                return (1);
+            }
+            if ((code_point >= 0xFF61) && (code_point <= 0xFF9F)) {
+                out[0] = 0x8E;
+                out[1] = static_cast<std::uint8_t>(code_point - 0xFF61 + 0xA1);
+                return (2);
+            }
+            std::size_t pointer = 0;
+            code_point = (code_point == 0x2212) ? 0xFF0D : code_point;
+            if (!find_index_pointer(get_jis0208_pointers(), code_point, pointer))
+                return (0);
+            // The pointers past the 94 rows of JIS X 0208 only exist in Shift_JIS.
+            if (pointer >= (94 * 94))
+                return (0);
+            out[0] = static_cast<std::uint8_t>((pointer / 94) + 0xA1);
+            out[1] = static_cast<std::uint8_t>((pointer % 94) + 0xA1);
+            return (2);
+        }
+
+        inline std::size_t encode_gb18030(std::uint32_t code_point, std::uint8_t* out, bool is_gbk)
+        {
+            if (code_point < 0x80) {
+                out[0] = static_cast<std::uint8_t>(code_point);
+                return (1);
+            }
+            if (code_point == 0xE5E5)
+                return (0);
+            if (is_gbk && (code_point == 0x20AC)) {
+                out[0] = 0x80;
+                return (1);
+            }
+            std::size_t pointer = 0;
+            if (find_index_pointer(get_gb18030_pointers(), code_point, pointer)) {
+                const std::size_t trail = pointer % 190;
+                out[0] = static_cast<std::uint8_t>((pointer / 190) + 0x81);
+                out[1] = static_cast<std::uint8_t>(trail + ((trail < 0x3F) ? 0x40 : 0x41));
+                return (2);
+            }
+            if (is_gbk)
+                return (0);
+            std::uint32_t ranges_pointer = get_gb18030_ranges_pointer(code_point);
+            out[3] = static_cast<std::uint8_t>((ranges_pointer % 10) + 0x30);
+            ranges_pointer /= 10;
+            out[2] = static_cast<std::uint8_t>((ranges_pointer % 126) + 0x81);
+            ranges_pointer /= 126;
+            out[1] = static_cast<std::uint8_t>((ranges_pointer % 10) + 0x30);
+            out[0] = static_cast<std::uint8_t>((ranges_pointer / 10) + 0x81);
+            return (4);
+        }
+
+        inline std::size_t encode_big5(std::uint32_t code_point, std::uint8_t* out)
+        {
+            if (code_point < 0x80) {
+                out[0] = static_cast<std::uint8_t>(code_point);
+                return (1);
+            }
+            // The pointers of the Hong Kong extensions before the Big5 rows are not encoded, and these code points
+            // that are listed twice take their last pointer.
+            const bool is_last = (
+                (code_point == 0x2550) || (code_point == 0x255E) || (code_point == 0x2561) || (code_point == 0x256A) ||
+                (code_point == 0x5341) || (code_point == 0x5345)
+            );
+            std::size_t pointer = 0;
+            if (!find_index_pointer(get_big5_pointers(), code_point, pointer, 0, (0xA1 - 0x81) * 157, is_last))
+                return (0);
+            const std::size_t trail = pointer % 157;
+            out[0] = static_cast<std::uint8_t>((pointer / 157) + 0x81);
+            out[1] = static_cast<std::uint8_t>(trail + ((trail < 0x3F) ? 0x40 : 0x62));
+            return (2);
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_CJK_CODECS_HPP)
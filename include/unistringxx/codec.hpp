@@ -0,0 +1,163 @@
+#if !defined(UNISTRINGXX_CODEC_HPP)
+#define UNISTRINGXX_CODEC_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+
+namespace unistringxx
+{
+    ///
+    /// What the codecs do with invalid input (octets that do not decode, or code points that cannot be encoded):
+    ///  * strict: throw std::range_error, after the output of the input before the error (without exceptions, decoders
+    ///    store uchar::invalid_value like from_u8string, and encoders skip the code point).
+    ///  * replace: decoders store U+FFFD, and encoders write the replacement of the encoding (U+FFFD, or "?" when the
+    ///    encoding cannot represent it).
+    ///  * skip: drop the invalid input.
+    ///
+    enum class codec_error_policy
+    {
+        strict,
+        replace,
+        skip
+    };
+
+    ///
+    /// The byte order of a UTF-16 or UTF-32 stream. A decoder with an unknown byte order takes it from the byte order
+    /// mark, or uses big endian when there is none (as per RFC 2781).
+    ///
+    enum class byte_order
+    {
+        unknown,
+        big_endian,
+        little_endian
+    };
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        const std::uint32_t _s_replacement_character = 0xFFFD;
+        const std::uint32_t _s_byte_order_mark = 0xFEFF;
+        // What encoders write with the replace policy when the encoding cannot represent U+FFFD.
+        const std::uint8_t _s_encode_replacement_octet = '?';
+
+        // Stores the result of a decoding error at out[count] (if any). Returns false if the decoding must stop, the
+        // decoder then calls throw_decode_error() once its output is consistent.
+        inline bool put_decode_error(codec_error_policy policy, uchar_t* out, std::size_t& count) noexcept
+        {
+            if (policy == codec_error_policy::replace) {
+                out[count++] = uchar_t{static_cast<uchar_t::int_type>(_s_replacement_character)};
+            }
+            else if (policy == codec_error_policy::strict) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                return (false);
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                out[count++] = uchar_t{uchar_t::invalid_value};
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            return (true);
+        }
+
+        inline void throw_decode_error(void)
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            UNISTRINGXX_THROW(std::range_error, "Invalid octets detected while decoding.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            return;
+        }
+
+        // Checks whether a code point that cannot be encoded stops the encoding, the encoder then calls
+        // throw_encode_error() once its output is consistent.
+        inline bool is_encode_error_fatal(codec_error_policy policy) noexcept
+        { return ((UNISTRINGXX_WITH_EXCEPTIONS) && (policy == codec_error_policy::strict)); }
+
+        inline void throw_encode_error(void)
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            UNISTRINGXX_THROW(std::range_error, "A code point that cannot be encoded was detected while encoding.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            return;
+        }
+
+        // The decoders reserve room for the largest output of the input (at most one code point per octet or code
+        // unit), decode in place, and trim the string afterwards, so there is a single allocation per call.
+        template<typename allocatorT>
+        inline uchar_t* begin_decode(generic_ustring<allocatorT>& str, std::size_t maximum_count)
+        {
+            const std::size_t size = str.size();
+            str.resize(size + maximum_count);
+            return ((maximum_count > 0) ? (&str[0] + size) : nullptr);
+        }
+
+        template<typename allocatorT>
+        inline void end_decode(generic_ustring<allocatorT>& str, std::size_t maximum_count, std::size_t count)
+        {
+            str.resize(str.size() - maximum_count + count);
+            return;
+        }
+
+        // Reads and writes code units in a given byte order. Assembling the value with shifts does not depend on the
+        // byte order of the platform, and compiles to a plain (or byte swapped) load or store.
+        inline std::uint16_t read_unit16(const std::uint8_t* data, bool is_big_endian) noexcept
+        {
+            return (static_cast<std::uint16_t>(
+                is_big_endian ? ((data[0] << 8) | data[1]) : (data[0] | (data[1] << 8))
+            ));
+        }
+
+        inline std::uint32_t read_unit32(const std::uint8_t* data, bool is_big_endian) noexcept
+        {
+            const std::uint32_t b0 = data[0];
+            const std::uint32_t b1 = data[1];
+            const std::uint32_t b2 = data[2];
+            const std::uint32_t b3 = data[3];
+            return (
+                is_big_endian ? ((b0 << 24) | (b1 << 16) | (b2 << 8) | b3) : (b0 | (b1 << 8) | (b2 << 16) | (b3 << 24))
+            );
+        }
+
+        inline void write_unit16(std::uint8_t* out, std::uint32_t value, bool is_big_endian) noexcept
+        {
+            out[is_big_endian ? 0 : 1] = static_cast<std::uint8_t>(value >> 8);
+            out[is_big_endian ? 1 : 0] = static_cast<std::uint8_t>(value);
+            return;
+        }
+
+        inline void write_unit32(std::uint8_t* out, std::uint32_t value, bool is_big_endian) noexcept
+        {
+            for (std::size_t ctr = 0; ctr < 4; ctr++)
+                out[is_big_endian ? (3 - ctr) : ctr] = static_cast<std::uint8_t>(value >> (ctr * 8));
+            return;
+        }
+
+#if (UNISTRINGXX_HAS_SSE2)
+        // Loads 8 16-bit or 4 32-bit code units in native order. Whether the octets must be swapped is known at compile
+        // time for each byte order, and swapping uses shifts and shuffles only (no SSSE3).
+        inline __m128i load_units16(const std::uint8_t* data, bool is_big_endian) noexcept
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            if (is_big_endian == (UNISTRINGXX_IS_BIG_ENDIAN != 0))
+                return (block);
+            return (_mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8)));
+        }
+
+        inline __m128i load_units32(const std::uint8_t* data, bool is_big_endian) noexcept
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            if (is_big_endian == (UNISTRINGXX_IS_BIG_ENDIAN != 0))
+                return (block);
+            const __m128i swapped16 = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+            return (_mm_shufflehi_epi16(_mm_shufflelo_epi16(swapped16, 0xB1), 0xB1));
+        }
+#endif // (UNISTRINGXX_HAS_SSE2)
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_CODEC_HPP)
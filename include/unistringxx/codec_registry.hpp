@@ -0,0 +1,397 @@
+#if !defined(UNISTRINGXX_CODEC_REGISTRY_HPP)
+#define UNISTRINGXX_CODEC_REGISTRY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "cjk_codecs.hpp"
+#include "codec.hpp"
+#include "common.hpp"
+#include "single_byte_codecs.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        enum class codec_family
+        {
+            single_byte,
+            shift_jis,
+            euc_jp,
+            gbk,
+            gb18030,
+            big5
+        };
+
+        struct codec_descriptor
+        {
+            const char* name;
+            // The names the codec is found by, space separated, in lower case and without punctuation.
+            const char* labels;
+            codec_family family;
+            // The tables of the single-byte codecs.
+            single_byte_charset charset;
+        };
+
+#define UNISTRINGXX_SINGLE_BYTE_CHARSET(charset) \
+    codec_family::single_byte, { \
+        _s_##charset##_decode, _s_##charset##_encode_code_points, _s_##charset##_encode_octets, \
+        sizeof (_s_##charset##_encode_octets) / sizeof (_s_##charset##_encode_octets[0]) \
+    }
+#define UNISTRINGXX_MULTIBYTE_CODEC(family) \
+    codec_family::family, {nullptr, nullptr, nullptr, 0}
+
+        const codec_descriptor _s_codecs[] = {
+            {
+                "US-ASCII", "usascii ascii ansix341968 iso646us cp367 ibm367",
+                codec_family::single_byte, {_s_us_ascii_decode, nullptr, nullptr, 0}
+            },
+            {"ISO-8859-1", "iso88591 latin1 l1 cp819 ibm819", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_1)},
+            {"ISO-8859-2", "iso88592 latin2 l2", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_2)},
+            {"ISO-8859-3", "iso88593 latin3 l3", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_3)},
+            {"ISO-8859-4", "iso88594 latin4 l4", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_4)},
+            {"ISO-8859-5", "iso88595 cyrillic", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_5)},
+            {"ISO-8859-6", "iso88596 arabic", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_6)},
+            {"ISO-8859-7", "iso88597 greek", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_7)},
+            {"ISO-8859-8", "iso88598 hebrew", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_8)},
+            {"ISO-8859-9", "iso88599 latin5 l5", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_9)},
+            {"ISO-8859-10", "iso885910 latin6 l6", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_10)},
+            {"ISO-8859-11", "iso885911", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_11)},
+            {"ISO-8859-13", "iso885913 latin7 l7", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_13)},
+            {"ISO-8859-14", "iso885914 latin8 l8", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_14)},
+            {"ISO-8859-15", "iso885915 latin9 l9", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_15)},
+            {"ISO-8859-16", "iso885916 latin10 l10", UNISTRINGXX_SINGLE_BYTE_CHARSET(iso_8859_16)},
+            {"windows-1250", "windows1250 cp1250", UNISTRINGXX_SINGLE_BYTE_CHARSET(windows_1250)},
+            {"windows-1251", "windows1251 cp1251", UNISTRINGXX_SINGLE_BYTE_CHARSET(windows_1251)},
+            {"windows-1252", "windows1252 cp1252", UNISTRINGXX_SINGLE_BYTE_CHARSET(windows_1252)},
+            {"windows-1253", "windows1253 cp1253", UNISTRINGXX_SINGLE_BYTE_CHARSET(windows_1253)},
+            {"windows-1254", "windows1254 cp1254", UNISTRINGXX_SINGLE_BYTE_CHARSET(windows_1254)},
+            {"windows-1255", "windows1255 cp1255", UNISTRINGXX_SINGLE_BYTE_CHARSET(windows_1255)},
+            {"windows-1256", "windows1256 cp1256", UNISTRINGXX_SINGLE_BYTE_CHARSET(windows_1256)},
+            {"windows-1257", "windows1257 cp1257", UNISTRINGXX_SINGLE_BYTE_CHARSET(windows_1257)},
+            {"windows-1258", "windows1258 cp1258", UNISTRINGXX_SINGLE_BYTE_CHARSET(windows_1258)},
+            {"Shift_JIS", "shiftjis sjis mskanji windows31j cp932 csshiftjis", UNISTRINGXX_MULTIBYTE_CODEC(shift_jis)},
+            {"EUC-JP", "eucjp cseucpkdfmtjapanese", UNISTRINGXX_MULTIBYTE_CODEC(euc_jp)},
+            {"GBK", "gbk cp936 windows936 gb2312 csgb2312 euccn chinese", UNISTRINGXX_MULTIBYTE_CODEC(gbk)},
+            {"GB18030", "gb18030", UNISTRINGXX_MULTIBYTE_CODEC(gb18030)},
+            {"Big5", "big5 big5hkscs cnbig5 csbig5 cp950", UNISTRINGXX_MULTIBYTE_CODEC(big5)}
+        };
+
+#undef UNISTRINGXX_MULTIBYTE_CODEC
+#undef UNISTRINGXX_SINGLE_BYTE_CHARSET
+
+        const std::size_t _s_codec_count = sizeof (_s_codecs) / sizeof (_s_codecs[0]);
+
+        // Checks whether a name matches a label, ignoring the case and anything but letters and digits (so "Latin-1",
+        // "LATIN1" and "latin_1" all match "latin1").
+        inline bool matches_codec_label(const char* name, const char* label, std::size_t label_size) noexcept
+        {
+            std::size_t matched = 0;
+            for (; *name != '\0'; ++name) {
+                char ch = *name;
+                if ((ch >= 'A') && (ch <= 'Z'))
+                    ch = static_cast<char>(ch - 'A' + 'a');
+                else if (((ch < 'a') || (ch > 'z')) && ((ch < '0') || (ch > '9')))
+                    continue;
+                if ((matched == label_size) || (label[matched] != ch))
+                    return (false);
+                matched++;
+            }
+            return (matched == label_size);
+        }
+
+        inline std::size_t find_codec_index(const char* name) noexcept
+        {
+            for (std::size_t index = 0; index < _s_codec_count; index++) {
+                const char* label = _s_codecs[index].labels;
+                while (*label != '\0') {
+                    std::size_t label_size = 0;
+                    while ((label[label_size] != '\0') && (label[label_size] != ' '))
+                        label_size++;
+                    if (matches_codec_label(name, label, label_size))
+                        return (index);
+                    label += label_size;
+                    label += (*label == ' ') ? 1 : 0;
+                }
+            }
+            return (_s_codec_count);
+        }
+
+        inline const codec_descriptor& get_codec_descriptor(std::size_t index)
+        {
+            if (index >= _s_codec_count) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::invalid_argument, "The codec is not valid.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                std::abort();
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            return (_s_codecs[index]);
+        }
+
+        // Decodes [first, last) into out[count...], with state being the state of a multibyte decoder (see
+        // _s_cjk_state_size).
+        inline void decode_with_codec(
+            const codec_descriptor& descriptor, std::uint8_t* state, codec_error_policy policy,
+            const std::uint8_t* first, const std::uint8_t* last, uchar_t* out, std::size_t& count, bool& is_decoded
+        )
+        {
+            switch (descriptor.family) {
+            case codec_family::single_byte:
+                decode_single_byte(descriptor.charset, policy, first, last, out, count, is_decoded);
+                break;
+            case codec_family::shift_jis:
+                decode_shift_jis(state, policy, first, last, out, count, is_decoded);
+                break;
+            case codec_family::euc_jp:
+                decode_euc_jp(state, policy, first, last, out, count, is_decoded);
+                break;
+            case codec_family::gbk:
+            case codec_family::gb18030:
+                decode_gb18030(state, policy, first, last, out, count, is_decoded);
+                break;
+            case codec_family::big5:
+                decode_big5(state, policy, first, last, out, count, is_decoded);
+                break;
+            }
+            return;
+        }
+
+        // Writes the octets of a code point to out (at most 4). Returns the number of octets, or 0 if the codec does
+        // not have the code point.
+        inline std::size_t encode_with_codec(const codec_descriptor& descriptor, uchar_t ch, std::uint8_t* out)
+        {
+            if (!ch.is_valid())
+                return (0);
+            const std::uint32_t code_point = static_cast<std::uint32_t>(ch.code_point());
+            switch (descriptor.family) {
+            case codec_family::single_byte:
+                return (encode_single_byte(descriptor.charset, code_point, out));
+            case codec_family::shift_jis:
+                return (encode_shift_jis(code_point, out));
+            case codec_family::euc_jp:
+                return (encode_euc_jp(code_point, out));
+            case codec_family::gbk:
+                return (encode_gb18030(code_point, out, true));
+            case codec_family::gb18030:
+                return (encode_gb18030(code_point, out, false));
+            case codec_family::big5:
+                return (encode_big5(code_point, out));
+            }
+            return (0);
+        }
+
+        inline void encode_with_codec(
+            const codec_descriptor& descriptor, codec_error_policy policy, ustring_view str,
+            std::vector<std::uint8_t>& out
+        )
+        {
+            const std::size_t maximum_size = (descriptor.family == codec_family::single_byte) ? 1 : 4;
+            const std::size_t start = out.size();
+            out.resize(start + (str.size() * maximum_size));
+            std::uint8_t* data = out.data() + start;
+            std::size_t size = 0;
+            bool is_encoded = true;
+            for (uchar_t ch : str) {
+                // Every codec of the registry encodes ASCII as is, so it skips the lookups.
+                const std::uint32_t code_point = static_cast<std::uint32_t>(ch.code_point());
+                if (code_point < 0x80) {
+                    data[size++] = static_cast<std::uint8_t>(code_point);
+                    continue;
+                }
+                std::size_t octet_count = encode_with_codec(descriptor, ch, data + size);
+                if (octet_count == 0) {
+                    if (is_encode_error_fatal(policy)) {
+                        is_encoded = false;
+                        break;
+                    }
+                    if (policy != codec_error_policy::replace)
+                        continue;
+                    octet_count = encode_with_codec(
+                        descriptor, uchar_t{static_cast<uchar_t::int_type>(_s_replacement_character)}, data + size
+                    );
+                    if (octet_count == 0) {
+                        data[size] = _s_encode_replacement_octet;
+                        octet_count = 1;
+                    }
+                }
+                size += octet_count;
+            }
+            out.resize(start + size);
+            if (!is_encoded)
+                throw_encode_error();
+            return;
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// A text codec of the registry, found by name with find_codec(). The registry has:
+    ///  * the single-byte character sets US-ASCII, ISO-8859-1 to ISO-8859-16 (except ISO-8859-12, which does not
+    ///    exist) and windows-1250 to windows-1258.
+    ///  * the multibyte encodings Shift_JIS (with the Windows-31J extensions), EUC-JP, GBK, GB18030 and Big5 (with
+    ///    the HKSCS extensions), which follow the WHATWG Encoding Standard.
+    /// A default constructed text_codec is not valid: decoding or encoding with it throws std::invalid_argument.
+    ///
+    class text_codec
+    {
+    public:
+        text_codec(void) noexcept :
+            _index{_s_codec_count}
+        { return; }
+
+        bool is_valid(void) const noexcept
+        { return (_index < _s_codec_count); }
+
+        ///
+        /// Gets the preferred name of the codec (nullptr if it is not valid).
+        ///
+        const char* name(void) const noexcept
+        { return (this->is_valid() ? _s_codecs[_index].name : nullptr); }
+
+        ///
+        /// Decodes the whole of [data, data + size). Use text_decoder to decode a stream in chunks.
+        ///
+        ustring decode(
+            const void* data, std::size_t size, codec_error_policy policy = codec_error_policy::strict
+        ) const;
+
+        ///
+        /// Appends str encoded with this codec to out. Code points the codec cannot represent follow the error policy
+        /// (replace writes U+FFFD if the codec has it, and "?" otherwise).
+        ///
+        void encode(
+            ustring_view str, std::vector<std::uint8_t>& out, codec_error_policy policy = codec_error_policy::strict
+        ) const
+        {
+            encode_with_codec(get_codec_descriptor(_index), policy, str, out);
+            return;
+        }
+
+        ///
+        /// Checks whether the codec can represent a code point.
+        ///
+        bool can_encode(uchar_t ch) const
+        {
+            std::uint8_t octets[4];
+            return (this->is_valid() && (encode_with_codec(_s_codecs[_index], ch, octets) != 0));
+        }
+
+        friend bool operator==(const text_codec& left, const text_codec& right) noexcept
+        { return (left._index == right._index); }
+
+        friend bool operator!=(const text_codec& left, const text_codec& right) noexcept
+        { return (left._index != right._index); }
+
+    private:
+        std::size_t _index;
+
+        explicit text_codec(std::size_t index) noexcept :
+            _index{index}
+        { return; }
+
+        friend text_codec find_codec(const char* name) noexcept;
+        friend class text_decoder;
+    }; // class text_codec
+
+    ///
+    /// Finds a codec by name or alias (e.g. "ISO-8859-1", "latin1" or "cp1252"), ignoring the case and anything but
+    /// letters and digits. Returns a codec that is not valid if the name is unknown.
+    ///
+    inline text_codec find_codec(const char* name) noexcept
+    { return (text_codec{find_codec_index(name)}); }
+
+    ///
+    /// A streaming decoder of a text codec: the input can be given in chunks of any size, a multibyte sequence split
+    /// between two chunks being kept until the next one.
+    ///
+    class text_decoder
+    {
+    public:
+        explicit text_decoder(text_codec codec, codec_error_policy policy = codec_error_policy::strict) :
+            _codec{codec}, _policy{policy}, _state{}
+        {
+            get_codec_descriptor(codec._index);
+            return;
+        }
+
+        text_codec codec(void) const noexcept
+        { return (_codec); }
+
+        codec_error_policy error_policy(void) const noexcept
+        { return (_policy); }
+
+        ///
+        /// Decodes the next chunk of the stream, appending the code points to str. With the strict policy, the text
+        /// before an error is appended before std::range_error is thrown.
+        ///
+        template<typename allocatorT>
+        void decode(const void* data, std::size_t size, generic_ustring<allocatorT>& str)
+        {
+            const std::uint8_t* first = static_cast<const std::uint8_t*>(data);
+            // Each octet gives at most one code point, including the octets kept in the state.
+            const std::size_t maximum_count = size + _s_cjk_state_size;
+            uchar_t* out = begin_decode(str, maximum_count);
+            std::size_t count = 0;
+            bool is_decoded = true;
+            decode_with_codec(_s_codecs[_codec._index], _state, _policy, first, first + size, out, count, is_decoded);
+            end_decode(str, maximum_count, count);
+            if (!is_decoded) {
+                this->reset();
+                throw_decode_error();
+            }
+            return;
+        }
+
+        ///
+        /// Ends the stream: an incomplete multibyte sequence at the end is an error. The decoder is then ready for a
+        /// new stream.
+        ///
+        template<typename allocatorT>
+        void finish(generic_ustring<allocatorT>& str)
+        {
+            const bool is_truncated = (_state[0] != 0);
+            this->reset();
+            if (!is_truncated)
+                return;
+            uchar_t* out = begin_decode(str, 1);
+            std::size_t count = 0;
+            const bool is_decoded = put_decode_error(_policy, out, count);
+            end_decode(str, 1, count);
+            if (!is_decoded)
+                throw_decode_error();
+            return;
+        }
+
+        void reset(void) noexcept
+        {
+            std::fill(_state, _state + _s_cjk_state_size, std::uint8_t{0});
+            return;
+        }
+
+    private:
+        text_codec _codec;
+        codec_error_policy _policy;
+        std::uint8_t _state[_s_cjk_state_size];
+    }; // class text_decoder
+
+    inline ustring text_codec::decode(const void* data, std::size_t size, codec_error_policy policy) const
+    {
+        ustring result;
+        text_decoder decoder{*this, policy};
+        decoder.decode(data, size, result);
+        decoder.finish(result);
+        return (result);
+    }
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_CODEC_REGISTRY_HPP)
@@ -0,0 +1,565 @@
+#if !defined(UNISTRINGXX_COLLATION_HPP)
+#define UNISTRINGXX_COLLATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common.hpp"
+#include "ducet_tables.hpp"
+#include "uchar.hpp"
+#include "uproperties.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    ///
+    /// The number of levels a collator compares (UTS #10). Each level only breaks ties left by the previous levels:
+    ///  - primary: base letters ("a" == "A" == "á"),
+    ///  - secondary: accents ("a" == "A" < "á"),
+    ///  - tertiary: case and variants ("a" < "A" < "á"),
+    ///  - quaternary: with variable_weighting::shifted, distinguishes the ignored punctuation and spaces,
+    ///  - identical: code points, as a last resort so that only identical texts compare equal.
+    ///
+    enum class collation_strength : std::uint8_t
+    {
+        primary = 1,
+        secondary,
+        tertiary,
+        quaternary,
+        identical
+    };
+
+    ///
+    /// How variable collation elements (spaces, punctuation and most symbols) are weighted (UTS #10 section 4).
+    ///  - non_ignorable: They are compared like letters ("de luge" < "de Luge" < "deluge").
+    ///  - shifted: They are ignored on the first three levels and compared on the quaternary level ("de luge" ==
+    ///    "deluge" unless the strength is at least quaternary).
+    ///
+    enum class variable_weighting : std::uint8_t
+    {
+        non_ignorable = 0,
+        shifted
+    };
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // Collation elements are packed as in the generated tables (see tools/gen_ducet.pl).
+        inline std::uint32_t make_collation_element(
+            std::uint32_t primary, std::uint32_t secondary, std::uint32_t tertiary
+        )
+        { return ((primary << 15) | (secondary << 6) | (tertiary << 1)); }
+
+        inline std::uint32_t primary_weight(std::uint32_t element)
+        { return (element >> 15); }
+
+        inline std::uint32_t secondary_weight(std::uint32_t element)
+        { return ((element >> 6) & 0x1FF); }
+
+        inline std::uint32_t tertiary_weight(std::uint32_t element)
+        { return ((element >> 1) & 0x1F); }
+
+        inline bool is_variable_element(std::uint32_t element)
+        { return ((element & 1) != 0); }
+
+        const std::uint32_t _s_hangul_syllable_base = 0xAC00;
+        const std::uint32_t _s_hangul_leading_base = 0x1100;
+        const std::uint32_t _s_hangul_vowel_base = 0x1161;
+        const std::uint32_t _s_hangul_trailing_base = 0x11A7;
+        const std::uint32_t _s_hangul_vowel_count = 21;
+        const std::uint32_t _s_hangul_trailing_count = 28;
+        const std::uint32_t _s_hangul_syllable_count = 11172;
+
+        // Longest element array of a single table entry (5 bit count) or implicit weight pair.
+        const std::size_t _s_max_code_point_elements = 32;
+
+        // Writes the implicit weights (UTS #10 section 10.1) of a code point that is not in the DUCET. Returns the
+        // number of elements written.
+        inline std::size_t get_implicit_elements(std::uint32_t cp, std::uint32_t* elements)
+        {
+            std::uint32_t first_weight = 0;
+            std::uint32_t second_weight = 0;
+
+            const std::size_t implicit_count = std::extent<decltype(_s_ducet_implicit_ranges)>::value / 3;
+            std::size_t ctr = 0;
+            for (; ctr < implicit_count; ctr++) {
+                if ((cp >= _s_ducet_implicit_ranges[ctr * 3]) && (cp <= _s_ducet_implicit_ranges[(ctr * 3) + 1]))
+                    break;
+            }
+
+            if (ctr < implicit_count) {
+                // Siniform ideographic scripts (Tangut, Nushu, Khitan) have their own bases.
+                first_weight = _s_ducet_implicit_ranges[(ctr * 3) + 2];
+                second_weight = (cp - _s_ducet_implicit_ranges[ctr * 3]) | 0x8000;
+            }
+            else {
+                std::uint32_t base = 0xFBC0;
+                if (lookup_property(_s_unified_ideograph_ranges, cp)) {
+                    const bool is_core_han = ((cp >= 0x4E00) && (cp <= 0x9FFF)) || ((cp >= 0xF900) && (cp <= 0xFAFF));
+                    base = is_core_han ? 0xFB40 : 0xFB80;
+                }
+                first_weight = base + (cp >> 15);
+                second_weight = (cp & 0x7FFF) | 0x8000;
+            }
+
+            elements[0] = make_collation_element(first_weight, 0x20, 0x02);
+            elements[1] = make_collation_element(second_weight, 0, 0);
+            return (2);
+        }
+
+        inline std::size_t get_table_elements(std::uint32_t info, std::uint32_t offset, std::uint32_t* elements)
+        {
+            const std::uint32_t* first = _s_ducet_elements + (info & 0xFFFF);
+            const std::size_t count = (info >> 16) & 0x1F;
+            // Runs only contain code points mapped to a single element whose primary increases with the code point.
+            elements[0] = *first + (offset << 15);
+            std::copy(first + 1, first + count, elements + 1);
+            return (count);
+        }
+
+        // Finds the run that contains a code point. Returns the number of runs if there is none.
+        inline std::size_t find_collation_run(std::uint32_t cp)
+        {
+            const std::uint32_t* run_starts_end = std::end(_s_ducet_run_starts);
+            const std::uint32_t* itr = std::upper_bound(std::begin(_s_ducet_run_starts), run_starts_end, cp);
+            if (itr == std::begin(_s_ducet_run_starts))
+                return (std::extent<decltype(_s_ducet_run_starts)>::value);
+
+            const std::size_t index = static_cast<std::size_t>(itr - std::begin(_s_ducet_run_starts)) - 1;
+            const std::uint32_t run_length = ((_s_ducet_run_info[index] >> 21) & 0xFF) + 1;
+            if ((cp - _s_ducet_run_starts[index]) >= run_length)
+                return (std::extent<decltype(_s_ducet_run_starts)>::value);
+            return (index);
+        }
+
+        // Finds the longest contraction that starts at text[index] and returns the number of code points it consumes (0
+        // if there is none). Only contiguous contractions are matched.
+        inline std::size_t match_contraction(ustring_view text, std::size_t index, std::uint32_t& info)
+        {
+            const std::uint32_t first = static_cast<std::uint32_t>(text[index].code_point());
+            const std::uint32_t second = ((index + 1) < text.size()) ?
+                static_cast<std::uint32_t>(text[index + 1].code_point()) : 0;
+            const std::uint32_t third = ((index + 2) < text.size()) ?
+                static_cast<std::uint32_t>(text[index + 2].code_point()) : 0;
+            if (second == 0)
+                return (0);
+
+            std::pair<const std::uint32_t*, const std::uint32_t*> range = std::equal_range(
+                std::begin(_s_ducet_contraction_first), std::end(_s_ducet_contraction_first), first
+            );
+            std::size_t result = 0;
+            for (const std::uint32_t* itr = range.first; itr != range.second; ++itr) {
+                const std::size_t ctr = static_cast<std::size_t>(itr - std::begin(_s_ducet_contraction_first));
+                if (_s_ducet_contraction_second[ctr] != second)
+                    continue;
+                const std::uint32_t contraction_third = _s_ducet_contraction_third[ctr];
+                if ((contraction_third == 0) && (result < 2)) {
+                    result = 2;
+                    info = _s_ducet_contraction_info[ctr];
+                }
+                else if ((contraction_third != 0) && (contraction_third == third)) {
+                    result = 3;
+                    info = _s_ducet_contraction_info[ctr];
+                }
+            }
+            return (result);
+        }
+
+        inline std::size_t get_code_point_elements(std::uint32_t cp, std::uint32_t* elements)
+        {
+            const std::size_t run_index = find_collation_run(cp);
+            if (run_index == std::extent<decltype(_s_ducet_run_starts)>::value)
+                return (get_implicit_elements(cp, elements));
+            return (get_table_elements(_s_ducet_run_info[run_index], cp - _s_ducet_run_starts[run_index], elements));
+        }
+
+        // Maps a text to its collation element array (UTS #10 section 7), one element at a time and without
+        // allocating. Only the elements of the current code point (or contraction) are buffered.
+        class collation_element_iterator
+        {
+        public:
+            explicit collation_element_iterator(ustring_view text) noexcept :
+                _text{text}, _index{0}, _jamo_first{0}, _jamo_last{0}, _position{0}, _size{0}
+            { return; }
+
+            // Gets the next element. Returns false at the end of the text.
+            bool next(std::uint32_t& element)
+            {
+                if ((_position == _size) && !this->fill())
+                    return (false);
+                element = _elements[_position++];
+                return (true);
+            }
+
+        private:
+            ustring_view _text;
+            std::size_t _index;
+            std::uint32_t _jamo[2];
+            std::size_t _jamo_first;
+            std::size_t _jamo_last;
+            std::uint32_t _elements[_s_max_code_point_elements];
+            std::size_t _position;
+            std::size_t _size;
+
+            bool fill(void)
+            {
+                _position = 0;
+                if (_jamo_first != _jamo_last) {
+                    _size = get_code_point_elements(_jamo[_jamo_first++], _elements);
+                    return (true);
+                }
+                if (_index >= _text.size())
+                    return (false);
+
+                const std::uint32_t cp = property_code_point(_text[_index]);
+
+                // Hangul syllables are weighted as their conjoining jamo.
+                if ((cp >= _s_hangul_syllable_base) && (cp < (_s_hangul_syllable_base + _s_hangul_syllable_count))) {
+                    const std::uint32_t syllable_index = cp - _s_hangul_syllable_base;
+                    const std::uint32_t trailing_index = syllable_index % _s_hangul_trailing_count;
+                    const std::uint32_t vowel_count = _s_hangul_vowel_count * _s_hangul_trailing_count;
+                    _size = get_code_point_elements(_s_hangul_leading_base + (syllable_index / vowel_count), _elements);
+                    _jamo[0] = _s_hangul_vowel_base + ((syllable_index % vowel_count) / _s_hangul_trailing_count);
+                    _jamo[1] = _s_hangul_trailing_base + trailing_index;
+                    _jamo_first = 0;
+                    _jamo_last = (trailing_index != 0) ? 2 : 1;
+                    _index++;
+                    return (true);
+                }
+
+                const std::size_t run_index = find_collation_run(cp);
+                if (run_index == std::extent<decltype(_s_ducet_run_starts)>::value) {
+                    _size = get_implicit_elements(cp, _elements);
+                    _index++;
+                    return (true);
+                }
+
+                const std::uint32_t run_info = _s_ducet_run_info[run_index];
+                if ((run_info & (static_cast<std::uint32_t>(1) << 29)) != 0) {
+                    std::uint32_t contraction_info = 0;
+                    const std::size_t match_size = match_contraction(_text, _index, contraction_info);
+                    if (match_size != 0) {
+                        _size = get_table_elements(contraction_info, 0, _elements);
+                        _index += match_size;
+                        return (true);
+                    }
+                }
+                _size = get_table_elements(run_info, cp - _s_ducet_run_starts[run_index], _elements);
+                _index++;
+                return (true);
+            }
+        }; // class collation_element_iterator
+
+        inline void get_collation_elements(ustring_view text, std::vector<std::uint32_t>& elements)
+        {
+            elements.clear();
+            elements.reserve(text.size() * 2);
+
+            collation_element_iterator itr{text};
+            std::uint32_t element = 0;
+            while (itr.next(element))
+                elements.push_back(element);
+            return;
+        }
+
+        // Produces the non-zero weights of one level of a text, in the order they appear in its sort key (i.e. after
+        // the variable weighting is applied). The sequences of two texts compare in the same order as that level of
+        // their sort keys.
+        class collation_weight_iterator
+        {
+        public:
+            collation_weight_iterator(
+                ustring_view text, collation_strength level, variable_weighting weighting
+            ) noexcept :
+                _elements{text}, _level{level}, _weighting{weighting}, _after_variable{false}
+            { return; }
+
+            // Gets the next weight. Returns 0 at the end of the text.
+            std::uint32_t next(void)
+            {
+                std::uint32_t element = 0;
+                while (_elements.next(element)) {
+                    std::uint32_t quaternary = 0;
+                    if (_weighting == variable_weighting::shifted) {
+                        if (is_variable_element(element)) {
+                            quaternary = primary_weight(element);
+                            element = 0;
+                            _after_variable = true;
+                        }
+                        else if (primary_weight(element) == 0) {
+                            if (_after_variable)
+                                element = 0;
+                            else if (element != 0)
+                                quaternary = 0xFFFF;
+                        }
+                        else {
+                            quaternary = 0xFFFF;
+                            _after_variable = false;
+                        }
+                    }
+
+                    std::uint32_t weight = 0;
+                    switch (_level) {
+                    case collation_strength::primary:
+                        weight = primary_weight(element);
+                        break;
+                    case collation_strength::secondary:
+                        weight = secondary_weight(element);
+                        break;
+                    case collation_strength::tertiary:
+                        weight = tertiary_weight(element);
+                        break;
+                    default:
+                        weight = quaternary;
+                        break;
+                    }
+                    if (weight != 0)
+                        return (weight);
+                }
+                return (0);
+            }
+
+        private:
+            collation_element_iterator _elements;
+            collation_strength _level;
+            variable_weighting _weighting;
+            bool _after_variable;
+        }; // class collation_weight_iterator
+
+        // Sort key level separator. No weight is encoded with a leading zero byte, so a shorter level always sorts
+        // first.
+        const char _s_collation_level_separator = '\0';
+
+        inline void append_collation_weight16(std::string& key, std::uint32_t weight)
+        {
+            key.push_back(static_cast<char>((weight >> 8) & 0xFF));
+            key.push_back(static_cast<char>(weight & 0xFF));
+            return;
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Compares texts according to the Unicode Collation Algorithm (UTS #10) with the Default Unicode Collation
+    /// Element Table (i.e. the root locale order). Comparisons can be made through binary sort keys: byte strings that
+    /// compare (with memcmp or std::string::compare) in the same order as the texts they were made from. When the same
+    /// texts are compared repeatedly (e.g. sorting, indexing), computing each key once is much cheaper than collating
+    /// on every comparison.
+    /// @remarks The texts are expected to be normalized (NFC or NFD); no normalization is performed, and contractions
+    ///     are only matched on contiguous code points. The DUCET version is given in ducet_tables.hpp.
+    ///
+    class collator
+    {
+    public:
+        ///
+        /// Constructs a collator.
+        /// @param strength The number of levels to compare.
+        /// @param weighting How spaces, punctuation and symbols are weighted.
+        ///
+        explicit collator(
+            collation_strength strength = collation_strength::tertiary,
+            variable_weighting weighting = variable_weighting::non_ignorable
+        ) noexcept :
+            _strength{strength}, _weighting{weighting}
+        { return; }
+
+        collation_strength strength(void) const noexcept
+        { return (_strength); }
+
+        variable_weighting weighting(void) const noexcept
+        { return (_weighting); }
+
+        ///
+        /// Computes the binary sort key of a text.
+        ///
+        std::string sort_key(ustring_view text) const
+        {
+            std::string result;
+            this->sort_key(text, result);
+            return (result);
+        }
+
+        ///
+        /// Computes the binary sort key of a text into an existing buffer (e.g. to reuse its capacity).
+        /// @param text The text to compute the key of.
+        /// @param key Receives the key. Its previous content is replaced.
+        ///
+        void sort_key(ustring_view text, std::string& key) const
+        {
+            std::vector<std::uint32_t> elements;
+            get_collation_elements(text, elements);
+            this->make_sort_key(text, elements, key);
+            return;
+        }
+
+        ///
+        /// Compares two texts. The collation elements are compared level by level as they are produced, without
+        /// computing sort keys, so most comparisons stop at the first primary difference and nothing is allocated.
+        /// @returns A negative value if left sorts before right, 0 if they are equal at the collator's strength, and a
+        ///     positive value otherwise.
+        ///
+        int compare(ustring_view left, ustring_view right) const
+        {
+            if (left == right)
+                return (0);
+
+            const collation_strength last_level = std::min(_strength, collation_strength::tertiary);
+            for (int level = static_cast<int>(collation_strength::primary);
+                level <= static_cast<int>(last_level); level++) {
+                const int result = this->compare_level(left, right, static_cast<collation_strength>(level));
+                if (result != 0)
+                    return (result);
+            }
+            if ((_strength >= collation_strength::quaternary) && (_weighting == variable_weighting::shifted)) {
+                const int result = this->compare_level(left, right, collation_strength::quaternary);
+                if (result != 0)
+                    return (result);
+            }
+            if (_strength == collation_strength::identical) {
+                const std::size_t count = std::min(left.size(), right.size());
+                for (std::size_t ctr = 0; ctr < count; ctr++) {
+                    const std::uint32_t left_cp = static_cast<std::uint32_t>(left[ctr].code_point());
+                    const std::uint32_t right_cp = static_cast<std::uint32_t>(right[ctr].code_point());
+                    if (left_cp != right_cp)
+                        return ((left_cp < right_cp) ? -1 : 1);
+                }
+                return ((left.size() < right.size()) ? -1 : ((left.size() > right.size()) ? 1 : 0));
+            }
+            return (0);
+        }
+
+        ///
+        /// Checks whether left sorts before right, so that the collator can be used as a comparator (e.g. with
+        /// std::sort or std::map). collation_sort is faster for sorting large sequences.
+        ///
+        bool operator()(ustring_view left, ustring_view right) const
+        { return (this->compare(left, right) < 0); }
+
+    private:
+        collation_strength _strength;
+        variable_weighting _weighting;
+
+        // Compares one level of two texts. A text whose weights are a prefix of the other's sorts first, as in the sort
+        // keys.
+        int compare_level(ustring_view left, ustring_view right, collation_strength level) const
+        {
+            collation_weight_iterator left_weights{left, level, _weighting};
+            collation_weight_iterator right_weights{right, level, _weighting};
+            while (true) {
+                const std::uint32_t left_weight = left_weights.next();
+                const std::uint32_t right_weight = right_weights.next();
+                if (left_weight != right_weight)
+                    return ((left_weight < right_weight) ? -1 : 1);
+                if (left_weight == 0)
+                    return (0);
+            }
+        }
+
+        void make_sort_key(ustring_view text, std::vector<std::uint32_t>& elements, std::string& key) const
+        {
+            key.clear();
+            key.reserve(elements.size() * 4);
+
+            // With shifted weighting, variable elements (and ignorables that follow them) only have a quaternary
+            // weight. The quaternary weight of every other non-ignorable element is 0xFFFF.
+            std::vector<std::uint32_t> quaternaries;
+            if (_weighting == variable_weighting::shifted) {
+                const bool has_quaternary = (_strength >= collation_strength::quaternary);
+                bool after_variable = false;
+                for (std::uint32_t& element : elements) {
+                    std::uint32_t quaternary = 0;
+                    if (is_variable_element(element)) {
+                        quaternary = primary_weight(element);
+                        element = 0;
+                        after_variable = true;
+                    }
+                    else if (primary_weight(element) == 0) {
+                        if (after_variable)
+                            element = 0;
+                        else if (element != 0)
+                            quaternary = 0xFFFF;
+                    }
+                    else {
+                        quaternary = 0xFFFF;
+                        after_variable = false;
+                    }
+                    if (has_quaternary && (quaternary != 0))
+                        quaternaries.push_back(quaternary);
+                }
+            }
+
+            for (std::uint32_t element : elements) {
+                if (primary_weight(element) != 0)
+                    append_collation_weight16(key, primary_weight(element));
+            }
+            if (_strength >= collation_strength::secondary) {
+                key.push_back(_s_collation_level_separator);
+                for (std::uint32_t element : elements) {
+                    // Secondary weights are in [0x20, 0x11C], so they are stored in one (non-zero) byte.
+                    if (secondary_weight(element) != 0)
+                        key.push_back(static_cast<char>(secondary_weight(element) - 0x1F));
+                }
+            }
+            if (_strength >= collation_strength::tertiary) {
+                key.push_back(_s_collation_level_separator);
+                for (std::uint32_t element : elements) {
+                    if (tertiary_weight(element) != 0)
+                        key.push_back(static_cast<char>(tertiary_weight(element)));
+                }
+            }
+            if ((_strength >= collation_strength::quaternary) && (_weighting == variable_weighting::shifted)) {
+                key.push_back(_s_collation_level_separator);
+                for (std::uint32_t quaternary : quaternaries)
+                    append_collation_weight16(key, quaternary);
+            }
+            if (_strength == collation_strength::identical) {
+                key.push_back(_s_collation_level_separator);
+                for (uchar_t ch : text) {
+                    const std::uint32_t cp = static_cast<std::uint32_t>(ch.code_point());
+                    key.push_back(static_cast<char>((cp >> 16) & 0xFF));
+                    key.push_back(static_cast<char>((cp >> 8) & 0xFF));
+                    key.push_back(static_cast<char>(cp & 0xFF));
+                }
+            }
+            return;
+        }
+    }; // class collator
+
+    ///
+    /// Sorts a sequence of texts in collation order. The sort key of each element is computed only once, so this is
+    /// much faster than std::sort with the collator as the comparator. The sort is stable.
+    /// @param first, last The range to sort. Its elements must be convertible to ustring_view (e.g. ustring).
+    /// @param coll The collator that defines the order.
+    ///
+    template<typename randomIterT>
+    void collation_sort(randomIterT first, randomIterT last, const collator& coll)
+    {
+        typedef typename std::iterator_traits<randomIterT>::value_type value_type;
+        typedef std::pair<std::string, std::size_t> keyed_index;
+
+        const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+        std::vector<keyed_index> keys(count);
+        for (std::size_t ctr = 0; ctr < count; ctr++) {
+            coll.sort_key(ustring_view{first[ctr]}, keys[ctr].first);
+            keys[ctr].second = ctr;
+        }
+        // The index breaks ties, which makes the sort stable.
+        std::sort(keys.begin(), keys.end());
+
+        std::vector<value_type> sorted;
+        sorted.reserve(count);
+        for (const keyed_index& key : keys)
+            sorted.push_back(std::move(first[key.second]));
+        std::move(sorted.begin(), sorted.end(), first);
+        return;
+    }
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_COLLATION_HPP)
@@ -56,6 +56,31 @@
     #define UNISTRINGXX_INLINE
 #endif
 
+// SIMD kernels are used when the target supports them, unless UNISTRINGXX_DISABLE_SIMD is defined.
+#if !defined(UNISTRINGXX_DISABLE_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    #define UNISTRINGXX_HAS_SSE2 1
+#else
+    #define UNISTRINGXX_HAS_SSE2 0
+#endif
+
+// The byte order of the target, resolved at compile time. Compilers that do not define __BYTE_ORDER__ (MSVC) only
+// target little endian platforms.
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    #define UNISTRINGXX_IS_BIG_ENDIAN 1
+#else
+    #define UNISTRINGXX_IS_BIG_ENDIAN 0
+#endif
+
+// std::pmr (C++17) is used for the pmr aliases when the standard library provides it.
+#define UNISTRINGXX_HAS_PMR 0
+#if (__cplusplus >= 201703L) && defined(__has_include)
+    #if __has_include(<memory_resource>)
+        #undef UNISTRINGXX_HAS_PMR
+        #define UNISTRINGXX_HAS_PMR 1
+    #endif
+#endif
+
 #if !defined(UNISTRINGXX_TEST)
     #define UNISTRINGXX_TEST 0
 #else
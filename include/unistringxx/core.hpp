@@ -78,18 +78,8 @@ namespace unistringxx
             );
         }
 
-        const endian_mode PLATFORM_ENDIAN = get_endian_mode();
-
-        // table lookup for index matching. only used when transforming a 32-bit data to 24-bit data.
-        const std::size_t _s_32bit_idx_lookup[4][3] =
-        {
-            { 0, 0, 0 }, // unknown endian
-            { 0, 1, 2 }, // little endian
-            { 3, 2, 1 }, // big endian
-            { 2, 3, 0 } // pdp endian
-        };
-
-        const std::size_t* _s_32bit_idx = _s_32bit_idx_lookup[PLATFORM_ENDIAN];
+        // Note: Known at compile time, get_endian_mode() checks at run time.
+        const endian_mode PLATFORM_ENDIAN = (UNISTRINGXX_IS_BIG_ENDIAN) ? big_endian : little_endian;
     } // namespace // ImplementationDetail
     /// @endinternal
 
@@ -128,14 +118,10 @@ namespace unistringxx
         ///
         uint24(std::int_least32_t value)
         {
-            auto valueItr = reinterpret_cast<std::uint8_t*>(&value);
-
-            // not endian agnostic (code is OK with little endian, but not others)
-            // std::copy(valueItr, (valueItr + 3), std::begin(data));
-
-            data[0] = *(valueItr + _s_32bit_idx[0]);
-            data[1] = *(valueItr + _s_32bit_idx[1]);
-            data[2] = *(valueItr + _s_32bit_idx[2]);
+            // Shifts do not depend on the byte order of the platform (so there is nothing to look up at run time).
+            data[0] = static_cast<std::uint8_t>(value);
+            data[1] = static_cast<std::uint8_t>(value >> 0x08);
+            data[2] = static_cast<std::uint8_t>(value >> 0x10);
 
             return;
         }
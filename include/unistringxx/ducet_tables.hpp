@@ -0,0 +1,4203 @@
+// This file is generated by tools/gen_ducet.pl from the Default Unicode Collation Element Table version 13.0.0 and
+// the Unicode Character Database version 14.0.0. Do not edit.
+// The versions differ: code points assigned after DUCET 13.0.0 get implicit weights (UTS #10 section 10.1) rather
+// than their DUCET 14.0.0 weights. Regenerate from allkeys.txt 14.0.0 to remove the mismatch.
+#if !defined(UNISTRINGXX_DUCET_TABLES_HPP)
+#define UNISTRINGXX_DUCET_TABLES_HPP
+
+#include <cstdint>
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // Collation element pool.
+        const std::uint32_t _s_ducet_elements[] = {
+            0x00000000, 0x01008805, 0x01048805, 0x01338805, 0x018E8805, 0x01D60805, 0x0FB20804, 0x01D68805, 0x01D48805, 0x018B0805,
+            0x01940805, 0x01D08805, 0x03330805, 0x01118805, 0x01068805, 0x013F0805, 0x01D30805, 0x0FCC0804, 0x01200805, 0x011D0805,
+            0x03350805, 0x01368805, 0x01D00805, 0x0FD10810, 0x0FDE0810, 0x0FEB0810, 0x0FF58810, 0x10038810, 0x10210810, 0x10288810,
+            0x103A8810, 0x10480810, 0x10558810, 0x10620810, 0x106B0810, 0x10848810, 0x108C0810, 0x109E0810, 0x10B58810, 0x10C00810,
+            0x10C98810, 0x10E90810, 0x10FB8810, 0x110B8810, 0x11238810, 0x112C8810, 0x11320810, 0x11380810, 0x11430810, 0x01950805,
+            0x01D38805, 0x01958805, 0x025B8805, 0x01058805, 0x025A0805, 0x0FD10804, 0x0FDE0804, 0x0FEB0804, 0x0FF58804, 0x10038804,
+            0x10210804, 0x10288804, 0x103A8804, 0x10480804, 0x10558804, 0x10620804, 0x106B0804, 0x10848804, 0x108C0804, 0x109E0804,
+            0x10B58804, 0x10C00804, 0x10C98804, 0x10E90804, 0x10FB8804, 0x110B8804, 0x11238804, 0x112C8804, 0x11320804, 0x11380804,
+            0x11430804, 0x01960805, 0x03370805, 0x01968805, 0x03380805, 0x01030805, 0x01048837, 0x01340805, 0x0FB18804, 0x0FB28804,
+            0x0FB10804, 0x0FB30804, 0x03378805, 0x01CD0805, 0x025D8805, 0x02E90805, 0x0FD10828, 0x01930805, 0x03368805, 0x02EA0805,
+            0x025C0805, 0x02950805, 0x03338805, 0x0FCD0828, 0x025A8805, 0x11980808, 0x01CE0805, 0x01498805, 0x025F0805, 0x0FCC8828,
+            0x109E0828, 0x01938805, 0x0FCC883C, 0x033B083D, 0x0FCE083C, 0x0FCC883C, 0x033B083D, 0x0FCD083C, 0x0FCD883C, 0x033B083D,
+            0x0FCE083C, 0x01370805, 0x0FD10810, 0x00000944, 0x0FD10810, 0x00000904, 0x0FD10810, 0x000009C4, 0x0FD10810, 0x00000B44,
+            0x0FD10810, 0x00000AC4, 0x0FD10810, 0x00000A44, 0x0FD10814, 0x00004608, 0x10038814, 0x0FEB0810, 0x00000C04, 0x10038810,
+            0x00000944, 0x10038810, 0x00000904, 0x10038810, 0x000009C4, 0x10038810, 0x00000AC4, 0x10480810, 0x00000944, 0x10480810,
+            0x00000904, 0x10480810, 0x000009C4, 0x10480810, 0x00000AC4, 0x0FF58814, 0x00004608, 0x108C0810, 0x00000B44, 0x109E0810,
+            0x00000944, 0x109E0810, 0x00000904, 0x109E0810, 0x000009C4, 0x109E0810, 0x00000B44, 0x109E0810, 0x00000AC4, 0x03348805,
+            0x109E0810, 0x00000BC4, 0x110B8810, 0x00000944, 0x110B8810, 0x00000904, 0x110B8810, 0x000009C4, 0x110B8810, 0x00000AC4,
+            0x11380810, 0x00000904, 0x115A8810, 0x10E90808, 0x00004608, 0x10E90808, 0x0FD10804, 0x00000944, 0x0FD10804, 0x00000904,
+            0x0FD10804, 0x000009C4, 0x0FD10804, 0x00000B44, 0x0FD10804, 0x00000AC4, 0x0FD10804, 0x00000A44, 0x0FD10808, 0x00004608,
+            0x10038808, 0x0FEB0804, 0x00000C04, 0x10038804, 0x00000944, 0x10038804, 0x00000904, 0x10038804, 0x000009C4, 0x10038804,
+            0x00000AC4, 0x10480804, 0x00000944, 0x10480804, 0x00000904, 0x10480804, 0x000009C4, 0x10480804, 0x00000AC4, 0x0FF58808,
+            0x00004608, 0x108C0804, 0x00000B44, 0x109E0804, 0x00000944, 0x109E0804, 0x00000904, 0x109E0804, 0x000009C4, 0x109E0804,
+            0x00000B44, 0x109E0804, 0x00000AC4, 0x03340805, 0x109E0804, 0x00000BC4, 0x110B8804, 0x00000944, 0x110B8804, 0x00000904,
+            0x110B8804, 0x000009C4, 0x110B8804, 0x00000AC4, 0x11380804, 0x00000904, 0x115A8804, 0x11380804, 0x00000AC4, 0x0FD10810,
+            0x00000C84, 0x0FD10804, 0x00000C84, 0x0FD10810, 0x00000984, 0x0FD10804, 0x00000984, 0x0FD10810, 0x00000C44, 0x0FD10804,
+            0x00000C44, 0x0FEB0810, 0x00000904, 0x0FEB0804, 0x00000904, 0x0FEB0810, 0x000009C4, 0x0FEB0804, 0x000009C4, 0x0FEB0810,
+            0x00000B84, 0x0FEB0804, 0x00000B84, 0x0FEB0810, 0x00000A04, 0x0FEB0804, 0x00000A04, 0x0FF58810, 0x00000A04, 0x0FF58804,
+            0x00000A04, 0x0FF58810, 0x00000E44, 0x0FF58804, 0x00000E44, 0x10038810, 0x00000C84, 0x10038804, 0x00000C84, 0x10038810,
+            0x00000984, 0x10038804, 0x00000984, 0x10038810, 0x00000B84, 0x10038804, 0x00000B84, 0x10038810, 0x00000C44, 0x10038804,
+            0x00000C44, 0x10038810, 0x00000A04, 0x10038804, 0x00000A04, 0x10288810, 0x000009C4, 0x10288804, 0x000009C4, 0x10288810,
+            0x00000984, 0x10288804, 0x00000984, 0x10288810, 0x00000B84, 0x10288804, 0x00000B84, 0x10288810, 0x00000C04, 0x10288804,
+            0x00000C04, 0x103A8810, 0x000009C4, 0x103A8804, 0x000009C4, 0x103A8810, 0x00000E44, 0x103A8804, 0x00000E44, 0x10480810,
+            0x00000B44, 0x10480804, 0x00000B44, 0x10480810, 0x00000C84, 0x10480804, 0x00000C84, 0x10480810, 0x00000984, 0x10480804,
+            0x00000984, 0x10480810, 0x00000C44, 0x10480804, 0x00000C44, 0x10480810, 0x00000B84, 0x104A0804, 0x10480814, 0x10558814,
+            0x10480808, 0x10558808, 0x10558810, 0x000009C4, 0x10558804, 0x000009C4, 0x10620810, 0x00000C04, 0x10620804, 0x00000C04,
+            0x10C78804, 0x106B0810, 0x00000904, 0x106B0804, 0x00000904, 0x106B0810, 0x00000C04, 0x106B0804, 0x00000C04, 0x106B0810,
+            0x00000A04, 0x106B0804, 0x00000A04, 0x106B0810, 0x00004604, 0x106B0804, 0x00004604, 0x106B0810, 0x00000E44, 0x106B0804,
+            0x00000E44, 0x108C0810, 0x00000904, 0x108C0804, 0x00000904, 0x108C0810, 0x00000C04, 0x108C0804, 0x00000C04, 0x108C0810,
+            0x00000A04, 0x108C0804, 0x00000A04, 0x11718808, 0x108C0808, 0x109B8810, 0x109B8804, 0x109E0810, 0x00000C84, 0x109E0804,
+            0x00000C84, 0x109E0810, 0x00000984, 0x109E0804, 0x00000984, 0x109E0810, 0x00000B04, 0x109E0804, 0x00000B04, 0x109E0814,
+            0x00004608, 0x10038814, 0x109E0808, 0x00004608, 0x10038808, 0x10C98810, 0x00000904, 0x10C98804, 0x00000904, 0x10C98810,
+            0x00000C04, 0x10C98804, 0x00000C04, 0x10C98810, 0x00000A04, 0x10C98804, 0x00000A04, 0x10E90810, 0x00000904, 0x10E90804,
+            0x00000904, 0x10E90810, 0x000009C4, 0x10E90804, 0x000009C4, 0x10E90810, 0x00000C04, 0x10E90804, 0x00000C04, 0x10E90810,
+            0x00000A04, 0x10E90804, 0x00000A04, 0x10FB8810, 0x00000C04, 0x10FB8804, 0x00000C04, 0x10FB8810, 0x00000A04, 0x10FB8804,
+            0x00000A04, 0x10FE0810, 0x10FE0804, 0x110B8810, 0x00000B44, 0x110B8804, 0x00000B44, 0x110B8810, 0x00000C84, 0x110B8804,
+            0x00000C84, 0x110B8810, 0x00000984, 0x110B8804, 0x00000984, 0x110B8810, 0x00000A44, 0x110B8804, 0x00000A44, 0x110B8810,
+            0x00000B04, 0x110B8804, 0x00000B04, 0x110B8810, 0x00000C44, 0x110B8804, 0x00000C44, 0x112C8810, 0x000009C4, 0x112C8804,
+            0x000009C4, 0x11380810, 0x000009C4, 0x11380804, 0x000009C4, 0x11380810, 0x00000AC4, 0x11430810, 0x00000904, 0x11430804,
+            0x00000904, 0x11430810, 0x00000B84, 0x11430804, 0x00000B84, 0x11430810, 0x00000A04, 0x11430804, 0x00000A04, 0x10E90808,
+            0x00004648, 0x0FE20804, 0x0FE68810, 0x0FE88810, 0x0FE88804, 0x116B0810, 0x116B0804, 0x10A78810, 0x0FF08810, 0x0FF08804,
+            0x0FFA0810, 0x0FFC0810, 0x0FFE8810, 0x0FFE8804, 0x11430808, 0x112C8808, 0x100A8810, 0x100D0810, 0x100F8810, 0x10258810,
+            0x10258804, 0x10318810, 0x10368810, 0x103E8804, 0x10530810, 0x104F8810, 0x10650810, 0x10650804, 0x10708804, 0x10808804,
+            0x111C0810, 0x10918810, 0x10938804, 0x10AE0810, 0x109E0810, 0x00000FC4, 0x109E0804, 0x00000FC4, 0x10388810, 0x10388804,
+            0x10BA0810, 0x10BA0804, 0x10CC0810, 0x11670810, 0x11670804, 0x10F20810, 0x10F50804, 0x11010804, 0x11030810, 0x11030804,
+            0x11050810, 0x110B8810, 0x00000FC4, 0x110B8804, 0x00000FC4, 0x11210810, 0x11270810, 0x113E0810, 0x113E0804, 0x11458810,
+            0x11458804, 0x11518810, 0x11540810, 0x11540804, 0x11568804, 0x11638804, 0x11690810, 0x11690804, 0x10FB8808, 0x10E90808,
+            0x115D8804, 0x117F0804, 0x11810804, 0x11830804, 0x11850804, 0x0FF58814, 0x11430814, 0x00000A08, 0x0FF58814, 0x11430808,
+            0x00000A08, 0x0FF58808, 0x11430808, 0x00000A08, 0x106B0814, 0x10558814, 0x106B0814, 0x10558808, 0x106B0808, 0x10558808,
+            0x108C0814, 0x10558814, 0x108C0814, 0x10558808, 0x108C0808, 0x10558808, 0x0FD10810, 0x00000A04, 0x0FD10804, 0x00000A04,
+            0x10480810, 0x00000A04, 0x10480804, 0x00000A04, 0x109E0810, 0x00000A04, 0x109E0804, 0x00000A04, 0x110B8810, 0x00000A04,
+            0x110B8804, 0x00000A04, 0x110B8810, 0x00000AC4, 0x00000C84, 0x110B8804, 0x00000AC4, 0x00000C84, 0x110B8810, 0x00000AC4,
+            0x00000904, 0x110B8804, 0x00000AC4, 0x00000904, 0x110B8810, 0x00000AC4, 0x00000A04, 0x110B8804, 0x00000AC4, 0x00000A04,
+            0x110B8810, 0x00000AC4, 0x00000944, 0x110B8804, 0x00000AC4, 0x00000944, 0x100A8804, 0x0FD10810, 0x00000AC4, 0x00000C84,
+            0x0FD10804, 0x00000AC4, 0x00000C84, 0x0FD10810, 0x00000B84, 0x00000C84, 0x0FD10804, 0x00000B84, 0x00000C84, 0x0FD10814,
+            0x00004608, 0x10038814, 0x00000C84, 0x0FD10808, 0x00004608, 0x10038808, 0x00000C84, 0x102F0810, 0x102F0804, 0x10288810,
+            0x00000A04, 0x10288804, 0x00000A04, 0x10620810, 0x00000A04, 0x10620804, 0x00000A04, 0x109E0810, 0x00000C44, 0x109E0804,
+            0x00000C44, 0x109E0810, 0x00000C44, 0x00000C84, 0x109E0804, 0x00000C44, 0x00000C84, 0x11518810, 0x00000A04, 0x11518804,
+            0x00000A04, 0x10558804, 0x00000A04, 0x0FF58814, 0x11430814, 0x0FF58814, 0x11430808, 0x0FF58808, 0x11430808, 0x10288810,
+            0x00000904, 0x10288804, 0x00000904, 0x103E8810, 0x115D8810, 0x108C0810, 0x00000944, 0x108C0804, 0x00000944, 0x0FD10810,
+            0x00000A44, 0x00000904, 0x0FD10804, 0x00000A44, 0x00000904, 0x0FD10814, 0x00004608, 0x10038814, 0x00000904, 0x0FD10808,
+            0x00004608, 0x10038808, 0x00000904, 0x109E0810, 0x00000BC4, 0x00000904, 0x109E0804, 0x00000BC4, 0x00000904, 0x0FD10810,
+            0x00000F04, 0x0FD10804, 0x00000F04, 0x0FD10810, 0x00000F84, 0x0FD10804, 0x00000F84, 0x10038810, 0x00000F04, 0x10038804,
+            0x00000F04, 0x10038810, 0x00000F84, 0x10038804, 0x00000F84, 0x10480810, 0x00000F04, 0x10480804, 0x00000F04, 0x10480810,
+            0x00000F84, 0x10480804, 0x00000F84, 0x109E0810, 0x00000F04, 0x109E0804, 0x00000F04, 0x109E0810, 0x00000F84, 0x109E0804,
+            0x00000F84, 0x10C98810, 0x00000F04, 0x10C98804, 0x00000F04, 0x10C98810, 0x00000F84, 0x10C98804, 0x00000F84, 0x110B8810,
+            0x00000F04, 0x110B8804, 0x00000F04, 0x110B8810, 0x00000F84, 0x110B8804, 0x00000F84, 0x10E90810, 0x00001144, 0x10E90804,
+            0x00001144, 0x10FB8810, 0x00001144, 0x10FB8804, 0x00001144, 0x11410810, 0x11410804, 0x103A8810, 0x00000A04, 0x103A8804,
+            0x00000A04, 0x10938810, 0x10008804, 0x10B30810, 0x10B30804, 0x11488810, 0x11488804, 0x0FD10810, 0x00000B84, 0x0FD10804,
+            0x00000B84, 0x10038810, 0x00000C04, 0x10038804, 0x00000C04, 0x109E0810, 0x00000AC4, 0x00000C84, 0x109E0804, 0x00000AC4,
+            0x00000C84, 0x109E0810, 0x00000B44, 0x00000C84, 0x109E0804, 0x00000B44, 0x00000C84, 0x109E0810, 0x00000B84, 0x109E0804,
+            0x00000B84, 0x109E0810, 0x00000B84, 0x00000C84, 0x109E0804, 0x00000B84, 0x00000C84, 0x11380810, 0x00000C84, 0x11380804,
+            0x00000C84, 0x107B8804, 0x10988804, 0x11070804, 0x10578804, 0x0FF58808, 0x0FDE0808, 0x10C00808, 0x10B58808, 0x0FD38810,
+            0x0FED8810, 0x0FED8804, 0x10708810, 0x11000810, 0x10EF0804, 0x114E8804, 0x116F0810, 0x116F0804, 0x0FE20810, 0x11110810,
+            0x112A8810, 0x10070810, 0x10070804, 0x105A0810, 0x105A0804, 0x10C58810, 0x10C58804, 0x10CF8810, 0x10CF8804, 0x113C0810,
+            0x113C0804, 0x0FD68804, 0x0FD88804, 0x0FDB8804, 0x0FE68804, 0x10A78804, 0x0FF28804, 0x0FFA0804, 0x0FFC0804, 0x10120804,
+            0x100D0804, 0x10140804, 0x100F8804, 0x10160804, 0x10190804, 0x101B0804, 0x105E0804, 0x10318804, 0x102A8804, 0x102D0804,
+            0x10368804, 0x101F0804, 0x11160804, 0x10410804, 0x10450804, 0x104F8804, 0x10530804, 0x104C0804, 0x10730804, 0x10760804,
+            0x10790804, 0x107E0804, 0x111C0804, 0x111F0804, 0x10880804, 0x10918804, 0x10968804, 0x108E0804, 0x10AE0804, 0x10A18804,
+            0x10B08804, 0x10BD8804, 0x10D20804, 0x10D48804, 0x10D70804, 0x10D98804, 0x10DB8804, 0x10DE0804, 0x10E08804, 0x10CC0804,
+            0x10E50804, 0x10ED0804, 0x10F20804, 0x10600804, 0x10F70804, 0x10F98804, 0x11098804, 0x11050804, 0x11110804, 0x11210804,
+            0x11270804, 0x112A8804, 0x11300804, 0x10828804, 0x113A0804, 0x114A8804, 0x114C8804, 0x11518804, 0x11588804, 0x116D0804,
+            0x11748804, 0x117D0804, 0x11870804, 0x11890804, 0x0FE00804, 0x101D0804, 0x10338804, 0x103C8804, 0x105C0804, 0x10690804,
+            0x106D0804, 0x10C38804, 0x11790804, 0x117B0804, 0x0FF58808, 0x11518808, 0x0FF58808, 0x114C8808, 0x10FB8808, 0x10F20808,
+            0x10FB8808, 0x0FF28808, 0x10210808, 0x109B8808, 0x106B0808, 0x10E90808, 0x106B0808, 0x11430808, 0x118B0804, 0x118D0804,
+            0x11180804, 0x111A0804, 0x103A8828, 0x10410828, 0x10558828, 0x10C98828, 0x10D20828, 0x10D70828, 0x10E50828, 0x112C8828,
+            0x11380828, 0x02628805, 0x02638805, 0x10470804, 0x11718804, 0x10478804, 0x11728804, 0x11768804, 0x11710804, 0x11770804,
+            0x02640805, 0x0FA30804, 0x026B0805, 0x026E0805, 0x025C8805, 0x025E0805, 0x025F8805, 0x025B0805, 0x025E8805, 0x026F0805,
+            0x10368828, 0x106B0828, 0x10E90828, 0x11320828, 0x11748828, 0x02700805, 0x11720804, 0x02748805, 0x00000944, 0x00000904,
+            0x000009C4, 0x00000B44, 0x00000C84, 0x00000E84, 0x00000984, 0x00000B84, 0x00000AC4, 0x00000EC4, 0x00000A44, 0x00000B04,
+            0x00000A04, 0x00000CC4, 0x00000F04, 0x00000F44, 0x00000F84, 0x00000884, 0x000008C4, 0x00000D04, 0x00000FC4, 0x00001004,
+            0x00001044, 0x00001084, 0x000010C4, 0x00001104, 0x00001144, 0x00000C04, 0x00000C44, 0x00001184, 0x000011C4, 0x00001204,
+            0x00001244, 0x00000844, 0x00001284, 0x00000E44, 0x00000D44, 0x00000BC4, 0x000012C4, 0x00000A84, 0x00000AC4, 0x00000904,
+            0x00001304, 0x00001344, 0x00001384, 0x000013C4, 0x0FD10808, 0x10038808, 0x10480808, 0x109E0808, 0x110B8808, 0x0FEB0808,
+            0x0FF58808, 0x103A8808, 0x10848808, 0x10C98808, 0x10FB8808, 0x11238808, 0x11320808, 0x11940810, 0x11940804, 0x11A48810,
+            0x11A48804, 0x11928810, 0x11928804, 0x11958808, 0x119F0804, 0x119E8804, 0x119F8804, 0x11960810, 0x025D8805, 0x00000904,
+            0x118F0810, 0x00000904, 0x11918810, 0x00000904, 0x11948810, 0x00000904, 0x11958810, 0x00000904, 0x11998810, 0x00000904,
+            0x11A08810, 0x00000904, 0x11A30810, 0x00000904, 0x11958804, 0x00000AC4, 0x00000904, 0x118F0810, 0x11910810, 0x11938810,
+            0x11948810, 0x11968810, 0x11980810, 0x119C8810, 0x119E0810, 0x11A00810, 0x11A30810, 0x11958810, 0x00000AC4, 0x11A08810,
+            0x00000AC4, 0x118F0804, 0x00000904, 0x11918804, 0x00000904, 0x11948804, 0x00000904, 0x11958804, 0x00000904, 0x11A08804,
+            0x00000AC4, 0x00000904, 0x118F0804, 0x11910804, 0x11938804, 0x11948804, 0x11968804, 0x11980804, 0x119C8804, 0x119E0832,
+            0x119E0804, 0x11A00804, 0x11A30804, 0x11958804, 0x00000AC4, 0x11A08804, 0x00000AC4, 0x11998804, 0x00000904, 0x11A08804,
+            0x00000904, 0x11A30804, 0x00000904, 0x11968814, 0x118F0808, 0x11958808, 0x118F8808, 0x11950808, 0x11A08814, 0x11A08814,
+            0x00000904, 0x11A08814, 0x00000AC4, 0x11A10808, 0x119A0808, 0x11968808, 0x118F0808, 0x11958808, 0x119C0810, 0x119C0804,
+            0x11930810, 0x11930804, 0x11920810, 0x11920804, 0x119B8810, 0x119B8804, 0x11A40810, 0x11A40804, 0x11B50810, 0x11B50804,
+            0x11B78810, 0x11B78804, 0x11B80810, 0x11B80804, 0x11B98810, 0x11B98804, 0x11BD0810, 0x11BD0804, 0x11BE8810, 0x11BE8804,
+            0x11C08810, 0x11C08804, 0x11968808, 0x119C8808, 0x119E0808, 0x11960804, 0x11950814, 0x11918808, 0x03308805, 0x11A50810,
+            0x11A50804, 0x119E0814, 0x119B0810, 0x119B0804, 0x119D8804, 0x119F0810, 0x119E8810, 0x119F8810, 0x11DF8810, 0x00000944,
+            0x11DF8810, 0x00000AC4, 0x11DA8810, 0x11CD8810, 0x00000904, 0x11E18810, 0x11EC8810, 0x11F68810, 0x11F68810, 0x00000AC4,
+            0x11FB0810, 0x12108810, 0x12238810, 0x123F0810, 0x11FD8810, 0x00000904, 0x11F28810, 0x00000944, 0x12410810, 0x00000984,
+            0x12720810, 0x11C38810, 0x11C98810, 0x11CB8810, 0x11CD8810, 0x11D78810, 0x11DF8810, 0x11E38810, 0x11E88810, 0x11F28810,
+            0x11F90810, 0x11FD8810, 0x120A8810, 0x12140810, 0x12188810, 0x12260810, 0x122A0810, 0x12308810, 0x12350810, 0x12398810,
+            0x12410810, 0x12498810, 0x124B8810, 0x125F0810, 0x12648810, 0x12740810, 0x12768810, 0x127A0810, 0x127C8810, 0x127E8810,
+            0x12850810, 0x12870810, 0x128A0810, 0x11C38804, 0x11C98804, 0x11CB8804, 0x11CD8804, 0x11D78804, 0x11DF8804, 0x11E38804,
+            0x11E88804, 0x11F28804, 0x11F90804, 0x11FD8804, 0x120A8804, 0x12140804, 0x12188804, 0x12260804, 0x122A0804, 0x12308804,
+            0x12350804, 0x12398804, 0x12410804, 0x12498804, 0x124B8804, 0x125F0804, 0x12648804, 0x12740804, 0x12768804, 0x127A0804,
+            0x127C8804, 0x127E8804, 0x12850804, 0x12870804, 0x128A0804, 0x11DF8804, 0x00000944, 0x11DF8804, 0x00000AC4, 0x11DA8804,
+            0x11CD8804, 0x00000904, 0x11E18804, 0x11EC8804, 0x11F68804, 0x11F68804, 0x00000AC4, 0x11FB0804, 0x12108804, 0x12238804,
+            0x123F0804, 0x11FD8804, 0x00000904, 0x11F28804, 0x00000944, 0x12410804, 0x00000984, 0x12720804, 0x12568810, 0x12568804,
+            0x12828810, 0x12828804, 0x128C8810, 0x128C8804, 0x128E8810, 0x128E8804, 0x12938810, 0x12938804, 0x12910810, 0x12910804,
+            0x12960810, 0x12960804, 0x12980810, 0x12980804, 0x129A0810, 0x129A0804, 0x129C0810, 0x129C0804, 0x129E0810, 0x129E0804,
+            0x129E0810, 0x00000F04, 0x129E0804, 0x00000F04, 0x12478810, 0x12478804, 0x125D0810, 0x125D0804, 0x125B0810, 0x125B0804,
+            0x12588810, 0x12588804, 0x122E8810, 0x122E8804, 0x02958805, 0x00001404, 0x11F48810, 0x11F48804, 0x12808810, 0x12808804,
+            0x12328810, 0x12328804, 0x11CD8814, 0x00004648, 0x11CD8808, 0x00004648, 0x11CF8810, 0x11CF8804, 0x11D38810, 0x11D38804,
+            0x11E68810, 0x11E68804, 0x11DD8810, 0x11DD8804, 0x11FF8810, 0x11FF8804, 0x12078810, 0x12078804, 0x12058810, 0x12058804,
+            0x12038810, 0x12038804, 0x121D0810, 0x121D0804, 0x12218810, 0x12218804, 0x122C8810, 0x122C8804, 0x12A08810, 0x12A08804,
+            0x12378810, 0x12378804, 0x123C8810, 0x123C8804, 0x12430810, 0x12430804, 0x12450810, 0x12450804, 0x12518810, 0x12518804,
+            0x12620810, 0x12620804, 0x12678810, 0x12678804, 0x126B8810, 0x126B8804, 0x12538810, 0x12538804, 0x126E0810, 0x126E0804,
+            0x12700810, 0x12700804, 0x12A30810, 0x11E38810, 0x00000984, 0x11E38804, 0x00000984, 0x12018810, 0x12018804, 0x120D0810,
+            0x120D0804, 0x121F0810, 0x121F0804, 0x121B0810, 0x121B0804, 0x12698810, 0x12698804, 0x12160810, 0x12160804, 0x12A30804,
+            0x11C38810, 0x00000984, 0x11C38804, 0x00000984, 0x11C38810, 0x00000AC4, 0x11C38804, 0x00000AC4, 0x11C78810, 0x11C78804,
+            0x11DF8810, 0x00000984, 0x11DF8804, 0x00000984, 0x11C58810, 0x11C58804, 0x11C58810, 0x00000AC4, 0x11C58804, 0x00000AC4,
+            0x11E38810, 0x00000AC4, 0x11E38804, 0x00000AC4, 0x11E88810, 0x00000AC4, 0x11E88804, 0x00000AC4, 0x11EF0810, 0x11EF0804,
+            0x11F28810, 0x00000C84, 0x11F28804, 0x00000C84, 0x11F28810, 0x00000AC4, 0x11F28804, 0x00000AC4, 0x12260810, 0x00000AC4,
+            0x12260804, 0x00000AC4, 0x12280810, 0x12280804, 0x12280810, 0x00000AC4, 0x12280804, 0x00000AC4, 0x12850810, 0x00000AC4,
+            0x12850804, 0x00000AC4, 0x12410810, 0x00000C84, 0x12410804, 0x00000C84, 0x12410810, 0x00000AC4, 0x12410804, 0x00000AC4,
+            0x12410810, 0x00000B04, 0x12410804, 0x00000B04, 0x12648810, 0x00000AC4, 0x12648804, 0x00000AC4, 0x11D58810, 0x11D58804,
+            0x127C8810, 0x00000AC4, 0x127C8804, 0x00000AC4, 0x11D18810, 0x11D18804, 0x124D8810, 0x124D8804, 0x124F8810, 0x124F8804,
+            0x11D98810, 0x11D98804, 0x11DD0810, 0x11DD0804, 0x11EB0810, 0x11EB0804, 0x11F18810, 0x11F18804, 0x12130810, 0x12130804,
+            0x12258810, 0x12258804, 0x12370810, 0x12370804, 0x123C0810, 0x123C0804, 0x11EB8810, 0x11EB8804, 0x120F8810, 0x120F8804,
+            0x12138810, 0x12138804, 0x12348810, 0x12348804, 0x128C0810, 0x128C0804, 0x120A0810, 0x120A0804, 0x12A28810, 0x12A28804,
+            0x12098810, 0x12098804, 0x12100810, 0x12100804, 0x12210810, 0x12210804, 0x122C0810, 0x122C0804, 0x12558810, 0x12558804,
+            0x121A8810, 0x121A8804, 0x11E58810, 0x11E58804, 0x12668810, 0x12668804, 0x120F0810, 0x120F0804, 0x12FA8810, 0x12FB8810,
+            0x13060810, 0x130E8804, 0x01F20805, 0x01348805, 0x01150805, 0x01380805, 0x01F30805, 0x12FB0804, 0x12FA8804, 0x12FB8804,
+            0x13060804, 0x12FD0808, 0x130C0808, 0x13058804, 0x01208805, 0x01070805, 0x02960805, 0x0FB38804, 0x00001484, 0x000014C4,
+            0x00001504, 0x00001544, 0x00001584, 0x000015C4, 0x00001604, 0x00001644, 0x00001684, 0x000016C4, 0x00001704, 0x000017C4,
+            0x01F38805, 0x00001804, 0x01F40805, 0x00001784, 0x00001744, 0x01F48805, 0x01F50805, 0x130F0804, 0x13140832, 0x13140804,
+            0x13150832, 0x13150804, 0x13158832, 0x13158804, 0x13170832, 0x13170804, 0x13178832, 0x13178804, 0x13138808, 0x13110808,
+            0x13118808, 0x13110808, 0x13118808, 0x13118808, 0x13118808, 0x13138808, 0x13138808, 0x13138808, 0x01F58805, 0x033E8805,
+            0x033F8805, 0x02970805, 0x01D80805, 0x01D90805, 0x0FB40804, 0x01158805, 0x02988805, 0x011D8805, 0x01210805, 0x01388805,
+            0x13A00804, 0x13320804, 0x13348804, 0x13370804, 0x13390804, 0x133A0804, 0x13420804, 0x13478804, 0x134C8804, 0x13520804,
+            0x13598804, 0x13630804, 0x13688804, 0x136B8804, 0x136D8804, 0x13838804, 0x139E8804, 0x13720804, 0x13780804, 0x137B0804,
+            0x13860804, 0x138A0804, 0x138C0804, 0x13910804, 0x13940804, 0x139B0804, 0x139B8804, 0x00001B44, 0x00001C04, 0x00001CC4,
+            0x00001D84, 0x00001E84, 0x00001F44, 0x00002004, 0x00002044, 0x00002084, 0x000020C4, 0x00002104, 0x00002184, 0x000021C4,
+            0x00002204, 0x00002284, 0x000022C4, 0x00002304, 0x00002344, 0x00002384, 0x000023C4, 0x00002144, 0x01D70805, 0x01168805,
+            0x01D20805, 0x13398804, 0x13778804, 0x00002604, 0x13340804, 0x13338804, 0x13358804, 0x13320808, 0x13390808, 0x13320808,
+            0x13940808, 0x13320808, 0x13960808, 0x13320808, 0x139B8808, 0x13320808, 0x13438804, 0x133A8804, 0x13448804, 0x133B0804,
+            0x13458804, 0x133B8804, 0x134D8804, 0x13480804, 0x134E8804, 0x13490804, 0x134A0804, 0x13530804, 0x13568804, 0x135A8804,
+            0x13640804, 0x13698804, 0x136A8804, 0x136C8804, 0x136E8804, 0x13728804, 0x13740804, 0x13758804, 0x13788804, 0x13798804,
+            0x137B8804, 0x137E0804, 0x137F8804, 0x13808804, 0x13868804, 0x138F0804, 0x138C8804, 0x138D8804, 0x13918804, 0x13498804,
+            0x13938804, 0x000020C4, 0x13920804, 0x13920804, 0x000020C4, 0x13928804, 0x13948804, 0x139C0804, 0x13990804, 0x139D8804,
+            0x13A28804, 0x13A28804, 0x000020C4, 0x01400805, 0x13938804, 0x02998805, 0x13940808, 0x139B8808, 0x029A0805, 0x13580804,
+            0x135F0804, 0x13658804, 0x136B0804, 0x136F8804, 0x13320808, 0x00004648, 0x138A0808, 0x00004648, 0x13930804, 0x01668805,
+            0x01408805, 0x01218805, 0x01390805, 0x01F68805, 0x13A40804, 0x00002644, 0x13A48804, 0x13A50808, 0x00004648, 0x13A60804,
+            0x13A58804, 0x13A68804, 0x13A88804, 0x13A90808, 0x00004648, 0x13A98804, 0x13AB8804, 0x13AD0832, 0x13AD8804, 0x13AE0808,
+            0x00004648, 0x13AF0804, 0x13A48808, 0x00004688, 0x13A50808, 0x00004688, 0x13A60808, 0x00004688, 0x00002684, 0x000026C4,
+            0x00002704, 0x00002744, 0x00002784, 0x000027C4, 0x00002804, 0x00002844, 0x00002884, 0x000028C4, 0x00002904, 0x00002944,
+            0x00002984, 0x000029C4, 0x00002A04, 0x00002A44, 0x13A80804, 0x13AB0804, 0x13AE8804, 0x133C0804, 0x133F8804, 0x134F0804,
+            0x13588804, 0x135F8804, 0x13660804, 0x13700804, 0x13768804, 0x13830804, 0x13848804, 0x138A8804, 0x138F8804, 0x13888804,
+            0x13600804, 0x13668804, 0x13500804, 0x13670804, 0x13610804, 0x13510804, 0x13360804, 0x13A08804, 0x13998804, 0x13A30804,
+            0x13518804, 0x13678804, 0x137D8804, 0x13C38804, 0x13C50804, 0x13C70804, 0x13CA0804, 0x13CB0804, 0x13CD0804, 0x13CF0804,
+            0x13D08804, 0x13D30804, 0x13CD8804, 0x13C40804, 0x13CC8804, 0x13C68804, 0x13D18804, 0x13CE0804, 0x13C90804, 0x13D00804,
+            0x13CA8804, 0x13D70804, 0x13D68804, 0x13DC8804, 0x13E28808, 0x00004608, 0x13E30808, 0x00004608, 0x13E40808, 0x00004608,
+            0x00002A84, 0x00002AC4, 0x00002B04, 0x00002B44, 0x00002B84, 0x00002BC4, 0x00002C04, 0x00002C44, 0x00002C84, 0x13EB8804,
+            0x02A30805, 0x01670805, 0x01178805, 0x01350805, 0x0FB48804, 0x13250804, 0x00001A84, 0x00001AC4, 0x13310804, 0x00001884,
+            0x000018C4, 0x00001904, 0x00001944, 0x00001984, 0x000019C4, 0x00001A04, 0x00001A44, 0x00001B04, 0x01248805, 0x13B70804,
+            0x01F88805, 0x13B18804, 0x133F0804, 0x13408804, 0x134A8804, 0x136D0804, 0x13750804, 0x137A8804, 0x13890804, 0x138B8804,
+            0x13378804, 0x13618804, 0x139A8804, 0x13388804, 0x13390808, 0x13560804, 0x136A0804, 0x13800804, 0x13988804, 0x13620804,
+            0x13718804, 0x137F0804, 0x13410804, 0x13460804, 0x13628804, 0x13A20804, 0x13738804, 0x13790804, 0x138D0804, 0x13400804,
+            0x13468804, 0x134B0804, 0x13858804, 0x136F0804, 0x137A0804, 0x134B8804, 0x13898804, 0x00002404, 0x00001DC4, 0x00001EC4,
+            0x00001F84, 0x00001BC4, 0x00001C84, 0x00001D44, 0x00001B84, 0x00001C44, 0x00001D04, 0x00001E04, 0x00001E44, 0x00001FC4,
+            0x00002444, 0x00002484, 0x00002584, 0x000025C4, 0x00002504, 0x00002544, 0x000024C4, 0x00001F04, 0x00002244, 0x000030C4,
+            0x00003104, 0x00003144, 0x14ED0804, 0x14F10804, 0x14F40804, 0x14F50804, 0x14F78804, 0x14FB8804, 0x14FF0804, 0x15018804,
+            0x15028804, 0x15058804, 0x00003084, 0x15060804, 0x15080804, 0x150A0804, 0x150A0804, 0x00003084, 0x150A8804, 0x150B0804,
+            0x00003084, 0x150B8804, 0x15120804, 0x00003084, 0x150E0804, 0x15118804, 0x15148804, 0x15188804, 0x15198804, 0x151B0804,
+            0x151C0804, 0x151A8804, 0x15130804, 0x14EB8804, 0x15190804, 0x15138804, 0x14F98804, 0x00003084, 0x14FA0804, 0x00003084,
+            0x14FA8804, 0x00003084, 0x14FD8804, 0x00003084, 0x15018804, 0x00003084, 0x15028804, 0x00003084, 0x15068804, 0x00003084,
+            0x15090804, 0x00003084, 0x14F38804, 0x14F48804, 0x15178804, 0x014B0805, 0x02000805, 0x0FA40804, 0x14EC8804, 0x14EE8804,
+            0x15010804, 0x14FE0804, 0x15098804, 0x14FB0804, 0x14FE8804, 0x150E8804, 0x15020804, 0x15078804, 0x151E8804, 0x151F0804,
+            0x15230804, 0x15240804, 0x15250804, 0x15300804, 0x15340804, 0x15350804, 0x15370804, 0x153C0804, 0x153C8804, 0x153D0804,
+            0x152D8808, 0x153E0808, 0x153E8804, 0x152C0804, 0x00003084, 0x152C8804, 0x00003084, 0x15328804, 0x00003084, 0x15228804,
+            0x15238804, 0x153B0804, 0x15338804, 0x15348804, 0x0FB58804, 0x0EAB0805, 0x02A38805, 0x0FB68804, 0x153F0804, 0x02028805,
+            0x00003184, 0x15420804, 0x15448804, 0x15408804, 0x15458804, 0x15430804, 0x15418804, 0x15438804, 0x15478804, 0x15518804,
+            0x15550804, 0x15558804, 0x15558804, 0x00003084, 0x15560804, 0x15460804, 0x00003084, 0x15460804, 0x15570804, 0x15598804,
+            0x155A8804, 0x15470804, 0x15480804, 0x00003084, 0x15488804, 0x00003084, 0x154B0804, 0x00003084, 0x15568804, 0x15520804,
+            0x00003084, 0x000031C4, 0x00003204, 0x15440804, 0x15400804, 0x153F8804, 0x15548804, 0x02030805, 0x155C8804, 0x15608804,
+            0x15618804, 0x15620804, 0x15638804, 0x15690804, 0x156F0804, 0x15728804, 0x15758804, 0x15730804, 0x15760804, 0x157B0804,
+            0x157B8804, 0x157D0804, 0x155C0804, 0x15600804, 0x15610804, 0x157A0804, 0x02038805, 0x0FB70804, 0x15688804, 0x157E8804,
+            0x15828804, 0x15838804, 0x15848804, 0x158F8804, 0x15930804, 0x15938804, 0x15948804, 0x15958804, 0x15978804, 0x159C8804,
+            0x159D0804, 0x159D8804, 0x159F0804, 0x158B8804, 0x00003084, 0x158C0804, 0x00003084, 0x15928804, 0x15820804, 0x15830804,
+            0x159B8804, 0x02A40805, 0x15950804, 0x0EAE0805, 0x15A68804, 0x15A08804, 0x15A38804, 0x15A50804, 0x15A58804, 0x15A70804,
+            0x15A78804, 0x15B00804, 0x15A88804, 0x15A98804, 0x15AA8804, 0x15AF8804, 0x15AB0804, 0x15AB8804, 0x15AF0804, 0x15AD0804,
+            0x15AE8804, 0x15AE0804, 0x15AD8804, 0x15B08804, 0x15B28804, 0x15B50804, 0x15B58804, 0x15B60804, 0x15B68804, 0x15A00804,
+            0x15B88804, 0x0EB40805, 0x02A48805, 0x0FB80804, 0x02A78805, 0x15B90804, 0x15BD0804, 0x15BE0804, 0x15BF8804, 0x15C48804,
+            0x15C60804, 0x15CC0804, 0x15D30804, 0x15D08804, 0x15D48804, 0x15D98804, 0x15DA0804, 0x15DB0804, 0x15DD0804, 0x15C40804,
+            0x15C58804, 0x15D40804, 0x15BC8804, 0x15BD8804, 0x15D88804, 0x02040805, 0x0FCC8804, 0x02B48805, 0x15F98804, 0x02048805,
+            0x15DE0804, 0x15E20804, 0x15E30804, 0x15E48804, 0x15F00804, 0x15F70804, 0x15F48804, 0x15F80804, 0x15FA0804, 0x15FA8804,
+            0x15FB0804, 0x15FE8804, 0x15FF0804, 0x16000804, 0x16008804, 0x16020804, 0x15F78804, 0x15E18804, 0x15E28804, 0x15FD8804,
+            0x15F88804, 0x161F0804, 0x16030804, 0x16058804, 0x16078804, 0x16088804, 0x160A0804, 0x161D8804, 0x16198804, 0x161C8804,
+            0x161A0804, 0x161E0804, 0x16278808, 0x161E8804, 0x161F8804, 0x16240804, 0x16248804, 0x16250804, 0x16258804, 0x16278804,
+            0x16190808, 0x16278808, 0x02B50805, 0x16180808, 0x16278808, 0x16188808, 0x16278808, 0x161D0808, 0x16278808, 0x16270804,
+            0x0EC00805, 0x16050804, 0x16070804, 0x16080804, 0x16230804, 0x0EC38805, 0x02B58805, 0x16128808, 0x16278808, 0x16150808,
+            0x16278808, 0x16198808, 0x16278808, 0x161C8808, 0x16278808, 0x160B8808, 0x16278808, 0x16280804, 0x16310804, 0x163D0804,
+            0x16418804, 0x16420804, 0x164E0804, 0x16458804, 0x16488804, 0x16490804, 0x164B0804, 0x164B8804, 0x164C8804, 0x164D0804,
+            0x164A0804, 0x16498804, 0x164A8804, 0x02050805, 0x190B8804, 0x0FBA8804, 0x19288804, 0x19290804, 0x19298804, 0x192A0804,
+            0x192A8804, 0x192B0804, 0x0FA48804, 0x00003504, 0x00003544, 0x00003584, 0x000035C4, 0x00003604, 0x00003644, 0x00003684,
+            0x000034C4, 0x02058805, 0x02060805, 0x192C0804, 0x192D0804, 0x192D8804, 0x19300804, 0x19308804, 0x19320804, 0x19310804,
+            0x19328804, 0x193D0804, 0x193D8804, 0x192F8804, 0x193F0804, 0x19488804, 0x19490804, 0x19498804, 0x194A0804, 0x194A8804,
+            0x0FA50804, 0x000036C4, 0x00003704, 0x00003744, 0x00003784, 0x000037C4, 0x00003804, 0x193F0808, 0x19378808, 0x193F0808,
+            0x193B8808, 0x192B8804, 0x19318804, 0x198F8808, 0x199B0808, 0x00003108, 0x02B98805, 0x02080805, 0x020C8805, 0x020C8837,
+            0x020D0805, 0x02BB0805, 0x012F8805, 0x02BB8805, 0x02BD0805, 0x0FCC8808, 0x0FCC0808, 0x02C00805, 0x02C08805, 0x02C10805,
+            0x000038C4, 0x01970805, 0x196C8804, 0x196E0804, 0x196F0804, 0x196F0804, 0x198F0804, 0x19700804, 0x19710804, 0x19720804,
+            0x19730804, 0x19740804, 0x19750804, 0x19760804, 0x19770804, 0x19770804, 0x198F0804, 0x19780804, 0x19790804, 0x197A0804,
+            0x197B0804, 0x197B0804, 0x198F0804, 0x197C0804, 0x197D0804, 0x197E0804, 0x197F0804, 0x197F0804, 0x198F0804, 0x19800804,
+            0x19810804, 0x19820804, 0x19830804, 0x19830804, 0x198F0804, 0x19840804, 0x19850804, 0x19860804, 0x19870804, 0x19880804,
+            0x19890804, 0x198A8804, 0x198B8804, 0x198C8804, 0x198D8804, 0x198E8804, 0x198F8804, 0x196C8804, 0x198D0804, 0x19890808,
+            0x00004648, 0x196D8804, 0x198A0804, 0x19948804, 0x19950804, 0x19970804, 0x19960804, 0x199C0804, 0x02100805, 0x19908804,
+            0x19918804, 0x19938804, 0x19928804, 0x19910804, 0x19920804, 0x19930804, 0x196D0804, 0x196E8804, 0x196F8804, 0x196F8804,
+            0x198F0804, 0x19708804, 0x19718804, 0x19728804, 0x19738804, 0x19748804, 0x19758804, 0x19768804, 0x19778804, 0x19778804,
+            0x198F0804, 0x19788804, 0x19798804, 0x197A8804, 0x197B8804, 0x197B8804, 0x198F0804, 0x197C8804, 0x197D8804, 0x197E8804,
+            0x197F8804, 0x197F8804, 0x198F0804, 0x19808804, 0x19818804, 0x19828804, 0x19838804, 0x19838804, 0x198F0804, 0x19848804,
+            0x19858804, 0x19868804, 0x19878804, 0x19888804, 0x19898804, 0x198B0804, 0x198C0804, 0x198D0804, 0x198E0804, 0x198F0804,
+            0x19900804, 0x196D0804, 0x198D0804, 0x19848808, 0x00004648, 0x19888808, 0x00004648, 0x19898808, 0x00004648, 0x02C18805,
+            0x02C58805, 0x02C88805, 0x020B8805, 0x02108805, 0x02C98805, 0x02120805, 0x1AB60804, 0x1AB70804, 0x1AB80804, 0x1ABA0804,
+            0x1ABB8804, 0x1ABC8804, 0x1ABE0804, 0x1AC00804, 0x1AC28804, 0x1AC60804, 0x1AC80804, 0x1AC98804, 0x1ACA8804, 0x1ACC0804,
+            0x1ACD8804, 0x1ACF8804, 0x1AD20804, 0x1AD38804, 0x1AD58804, 0x1AD90804, 0x1ADA8804, 0x1ADC0804, 0x1ADD0804, 0x1ADE0804,
+            0x1AE00804, 0x1AE10804, 0x1AE48804, 0x1AE58804, 0x1AE88804, 0x1AEC0804, 0x1AEE0804, 0x1AEE8804, 0x1AF10804, 0x1AF30808,
+            0x1AF30804, 0x1AF50804, 0x1AF60804, 0x1AF70804, 0x1AF88804, 0x1AFB0804, 0x1AFD0804, 0x1AF68804, 0x1AFE0804, 0x1AFC0804,
+            0x000039C4, 0x1B010804, 0x1ADD8804, 0x1ADF8804, 0x1AE18804, 0x1AE70804, 0x1AE48808, 0x1B010808, 0x1AE48808, 0x01508805,
+            0x021D8805, 0x1AE30804, 0x1AEF0804, 0x1AF90804, 0x1ABC0804, 0x1AC30804, 0x1AE98804, 0x1AD50804, 0x1ADC8804, 0x1AE08804,
+            0x1AC50804, 0x1AFE8804, 0x1B020804, 0x1AE40804, 0x1AEB8804, 0x1AFF0804, 0x1B030804, 0x1ACE0804, 0x1AEA8804, 0x1AF58804,
+            0x1AF40804, 0x1AF78804, 0x1AB68804, 0x1AB78804, 0x1AB88804, 0x1ABD0804, 0x1AC18804, 0x1AC68804, 0x1AD10804, 0x1AD40804,
+            0x1AD68804, 0x1AD98804, 0x1AE28804, 0x1AE60804, 0x1AE20804, 0x1AF38804, 0x1AFB8804, 0x1AFC8804, 0x1B008804, 0x1B058804,
+            0x1B068804, 0x1B080804, 0x1B060804, 0x1B070804, 0x1AD80804, 0x1B090804, 0x1B098804, 0x1AF48804, 0x1AFD8804, 0x02CC8805,
+            0x12D00810, 0x12D10810, 0x12D20810, 0x12D30810, 0x12D40810, 0x12D50810, 0x12D60810, 0x12D80810, 0x12D90810, 0x12DA0810,
+            0x12DB0810, 0x12DC0810, 0x12DD0810, 0x12DF0810, 0x12E00810, 0x12E10810, 0x12E20810, 0x12E30810, 0x12E40810, 0x12E60810,
+            0x12E70810, 0x12E80810, 0x12E90810, 0x12EA0810, 0x12EB0810, 0x12EC0810, 0x12ED0810, 0x12EE0810, 0x12EF0810, 0x12F00810,
+            0x12F10810, 0x12F30810, 0x12F40810, 0x12D70810, 0x12DE0810, 0x12E50810, 0x12F20810, 0x12F50810, 0x12F68810, 0x12F90810,
+            0x12CF8804, 0x12D08804, 0x12D18804, 0x12D28804, 0x12D38804, 0x12D48804, 0x12D58804, 0x12D78804, 0x12D88804, 0x12D98804,
+            0x12DA8804, 0x12DB8804, 0x12DC8804, 0x12DE8804, 0x12DF8804, 0x12E08804, 0x12E18804, 0x12E28804, 0x12E38804, 0x12E58804,
+            0x12E68804, 0x12E78804, 0x12E88804, 0x12E98804, 0x12EA8804, 0x12EB8804, 0x12EC8804, 0x12ED8804, 0x12EE8804, 0x12EF8804,
+            0x12F08804, 0x12F28804, 0x12F38804, 0x12D68804, 0x12DD8804, 0x12E48804, 0x12F18804, 0x12F48804, 0x12F58804, 0x12F70804,
+            0x01678805, 0x12DC8828, 0x12F88804, 0x12F98804, 0x20BA8804, 0x20F88804, 0x21288804, 0x14090804, 0x14118804, 0x141C0804,
+            0x14248804, 0x142C0804, 0x14308804, 0x14350804, 0x14370804, 0x143A8804, 0x143B0804, 0x143D0804, 0x14438804, 0x144C0804,
+            0x14508804, 0x14550804, 0x14570804, 0x145B8804, 0x14600804, 0x14648804, 0x14690804, 0x146B0804, 0x146E8804, 0x146F0804,
+            0x14710804, 0x14788804, 0x14800804, 0x148F8804, 0x14940804, 0x14988804, 0x149D0804, 0x149F0804, 0x14A50804, 0x14A98804,
+            0x14B18804, 0x14B60804, 0x14BD8804, 0x14C78804, 0x14CE0804, 0x00002D44, 0x00002D04, 0x00002CC4, 0x01680805, 0x012C0805,
+            0x01418805, 0x012C8805, 0x01398805, 0x01688805, 0x0EC80805, 0x14198804, 0x14410804, 0x14C58804, 0x14CB8804, 0x027D0805,
+            0x1C6F0810, 0x1C970804, 0x01078805, 0x1CAC0804, 0x1D2C0804, 0x1D828804, 0x1D698804, 0x1D6A8804, 0x1D730804, 0x1D7A0804,
+            0x1D830804, 0x02CB8805, 0x01430805, 0x1D6A0804, 0x1D728804, 0x1D770804, 0x1DE60804, 0x01048809, 0x1E0D8804, 0x01990805,
+            0x1E1A8804, 0x1E1A8808, 0x00004608, 0x1E1B0804, 0x1E2D0804, 0x1E1B0808, 0x00004608, 0x1E1B0808, 0x00004648, 0x1E1B8804,
+            0x1E1B8808, 0x00004608, 0x1E1C0804, 0x1E1C0808, 0x00004608, 0x1E2B0804, 0x1E2C0804, 0x1E1C0808, 0x00004648, 0x1E1C0808,
+            0x00004688, 0x1E1C0808, 0x000046C8, 0x1E1D0804, 0x1E1E8808, 0x00004608, 0x1E1E8808, 0x00004648, 0x1E1E8808, 0x00004688,
+            0x1E1E8808, 0x000046C8, 0x1E1F8804, 0x1E2E8804, 0x1E200804, 0x1E208808, 0x00004608, 0x1E208808, 0x00004648, 0x1E208808,
+            0x00004688, 0x1E210804, 0x1E210808, 0x00004608, 0x1E210808, 0x00004648, 0x1E218804, 0x1E218808, 0x00004608, 0x1E228804,
+            0x1E228808, 0x00004608, 0x1E230804, 0x1E230808, 0x00004608, 0x1E238804, 0x1E250808, 0x00004608, 0x1E250808, 0x00004688,
+            0x1E250808, 0x000046C8, 0x1E250808, 0x00004708, 0x1E260804, 0x1E260808, 0x00004608, 0x1E260808, 0x00004648, 0x1E268804,
+            0x1E268808, 0x00004608, 0x1E268808, 0x00004648, 0x1E240808, 0x00004608, 0x1E270804, 0x1E280804, 0x1E280808, 0x00004608,
+            0x1E280808, 0x00004648, 0x1E288804, 0x1E288808, 0x00004608, 0x1E290804, 0x1E290808, 0x00004608, 0x1E298804, 0x1E2D8804,
+            0x1E2F8804, 0x1E2E0804, 0x1E2F0804, 0x1E308804, 0x1E310808, 0x00004608, 0x1E310808, 0x00004648, 0x1E200808, 0x00004608,
+            0x1E250808, 0x00004648, 0x01318805, 0x1E230808, 0x1E288808, 0x1E280808, 0x00004608, 0x1E280808, 0x00004608, 0x1E1B8808,
+            0x1E1B8808, 0x1E1F0804, 0x1E258804, 0x1E2A8804, 0x1E1C8804, 0x1E220804, 0x1E278804, 0x1E2B8804, 0x1E2C8804, 0x1A430804,
+            0x1A498804, 0x1A4D0804, 0x014F0805, 0x1A578804, 0x1A618804, 0x1A680804, 0x1A698804, 0x1B3A8804, 0x1B4C8804, 0x1B550804,
+            0x00003A04, 0x00003A44, 0x00003A84, 0x1B5D0804, 0x01518805, 0x01300805, 0x0FA58804, 0x021F8805, 0x0FBB0804, 0x1B4C0804,
+            0x01F90805, 0x013F8805, 0x01180805, 0x01420805, 0x012E8805, 0x01088805, 0x01188805, 0x01428805, 0x1C1F0804, 0x1C200804,
+            0x1C218804, 0x1C248804, 0x1C258804, 0x1C270804, 0x1C280804, 0x1C298804, 0x1C2D0804, 0x1C2E0804, 0x1C2F8804, 0x1C308804,
+            0x1C330804, 0x1C340804, 0x1C388804, 0x1C3A0804, 0x1C3B8804, 0x1C3E8804, 0x1C408804, 0x1C420804, 0x1C430804, 0x1C440804,
+            0x1C458804, 0x1C480804, 0x1C4A0804, 0x1C4C0804, 0x1C4D8804, 0x1C1E8804, 0x1C208804, 0x1C220804, 0x1C250804, 0x1C260804,
+            0x1C278804, 0x1C288804, 0x1C2B0804, 0x1C2D8804, 0x1C2E8804, 0x1C300804, 0x1C310804, 0x1C338804, 0x1C390804, 0x1C3A8804,
+            0x1C3C0804, 0x1C3F0804, 0x1C490804, 0x1C410804, 0x1C438804, 0x1C460804, 0x1C4B0804, 0x1C4C8804, 0x1C4F8804, 0x1C3D8804,
+            0x1C210804, 0x1C228804, 0x1C240804, 0x1C290804, 0x1C268804, 0x1C2B8804, 0x1C468804, 0x1C318804, 0x1C328804, 0x1C2F0804,
+            0x1C358804, 0x1C398804, 0x1C3B0804, 0x1C3F8804, 0x1C448804, 0x1C4B8804, 0x1C4D0804, 0x1C498804, 0x1C4A8804, 0x1C508804,
+            0x1C3C8804, 0x1C418804, 0x1C230804, 0x1C470804, 0x1C428804, 0x1C450804, 0x1C400804, 0x1C3D0804, 0x1C1B0804, 0x1C1F8804,
+            0x1C238804, 0x1C478804, 0x1C2C0804, 0x1C3E0804, 0x1C510804, 0x1C520804, 0x1C538804, 0x1C558804, 0x1C568804, 0x1C580804,
+            0x1C590804, 0x1C5A0804, 0x1C548804, 0x1C598804, 0x1C320804, 0x1C2C8804, 0x1C360804, 0x1C518804, 0x1C530804, 0x1C550804,
+            0x1C560804, 0x1C370804, 0x1C588804, 0x1C378804, 0x1C5B0804, 0x1C578804, 0x1C5C8804, 0x1C5C0804, 0x1DEA8804, 0x1A2A0804,
+            0x1A2E0808, 0x1A3D0808, 0x1A2F8808, 0x1A3D8808, 0x1A388804, 0x1A3E8804, 0x00003CC4, 0x00003D04, 0x00003D44, 0x02CC0805,
+            0x01358805, 0x013A0805, 0x1B5D8804, 0x1B6C8804, 0x1B6F0804, 0x1B850804, 0x1B878804, 0x1B880804, 0x1B888804, 0x1B890804,
+            0x1B8A0804, 0x1B8A8804, 0x1B7D0808, 0x1B880808, 0x1B7D0808, 0x1B880808, 0x1B8D8808, 0x02CF8805, 0x1A6A8804, 0x01690805,
+            0x1B920804, 0x1BAC8804, 0x1BA88804, 0x1BA50808, 0x1BB80808, 0x1BA50808, 0x1BA98804, 0x1B950808, 0x1B9F8808, 0x1BAB0804,
+            0x1BB80804, 0x1BAF8804, 0x1BB08804, 0x1BB10808, 0x1BB18804, 0x1BA90804, 0x1BB00804, 0x1BB78804, 0x1BB48804, 0x1BB60804,
+            0x1BB58804, 0x00003AC4, 0x00003B04, 0x00003B44, 0x00003B84, 0x00003BC4, 0x00003C04, 0x00003C44, 0x00003C84, 0x02210805,
+            0x0FA60804, 0x01528805, 0x02248805, 0x00000D84, 0x112C8808, 0x11300808, 0x00003244, 0x1BDB0804, 0x1BDB8804, 0x1BDC0804,
+            0x1BDC8804, 0x1BDD0804, 0x1BDD8804, 0x1BDE0804, 0x1BDE8804, 0x1BDF0804, 0x1BDF8804, 0x1BE10804, 0x1BE18804, 0x1BE38804,
+            0x1BEB8804, 0x1BEE8804, 0x1BF30804, 0x1BF58804, 0x1BF60804, 0x1BF88804, 0x1BF90804, 0x1BF98804, 0x1BFA0804, 0x1BFA8804,
+            0x1BFB0804, 0x1BFB8804, 0x1BFC8804, 0x1BFD0804, 0x1BE28804, 0x1BEB0804, 0x1BEE0804, 0x1BF28804, 0x1BF48804, 0x016A0805,
+            0x01438805, 0x01308805, 0x01548805, 0x01080805, 0x02DF8805, 0x02E48805, 0x000032C4, 0x189D0804, 0x18A18804, 0x18A90804,
+            0x18AA0804, 0x18AB0804, 0x18AC8804, 0x18AE0804, 0x18AF0804, 0x18B08804, 0x18AA8804, 0x18AB8804, 0x18AD0804, 0x18B10804,
+            0x18A98804, 0x18AE8804, 0x18A10804, 0x18B00804, 0x189D0808, 0x18AC0804, 0x18AD8804, 0x18A88804, 0x18A08832, 0x18A90832,
+            0x1A840804, 0x1A840808, 0x1A848804, 0x1A848808, 0x1A850804, 0x1A850808, 0x1A858804, 0x1A858808, 0x1A860804, 0x1A860808,
+            0x1A868804, 0x1A868808, 0x1A870804, 0x1A870808, 0x1A878804, 0x1A888808, 0x1A890804, 0x1A890808, 0x1A898804, 0x1A898808,
+            0x1A8A0804, 0x1A8A0808, 0x1A8A8804, 0x1A8A8808, 0x1A8B0804, 0x1A8B8808, 0x1A8C0804, 0x1A8F0804, 0x1A8F0808, 0x1A8F8804,
+            0x1A900808, 0x1A908804, 0x1A908808, 0x1A910804, 0x1A910808, 0x1A918804, 0x022B0805, 0x19F30804, 0x19F98804, 0x1A028804,
+            0x1A038804, 0x1A020804, 0x1A030804, 0x1A080804, 0x1A078804, 0x014D0805, 0x021C0805, 0x19F80804, 0x1C5D0804, 0x01658805,
+            0x11CB8808, 0x11D78808, 0x12260808, 0x12350808, 0x12398808, 0x127A0808, 0x12828808, 0x12470808, 0x12CF8810, 0x12D08810,
+            0x12D18810, 0x12D28810, 0x12D38810, 0x12D48810, 0x12D58810, 0x12D78810, 0x12D88810, 0x12D98810, 0x12DA8810, 0x12DB8810,
+            0x12DC8810, 0x12DE8810, 0x12DF8810, 0x12E08810, 0x12E18810, 0x12E28810, 0x12E38810, 0x12E58810, 0x12E68810, 0x12E78810,
+            0x12E88810, 0x12E98810, 0x12EA8810, 0x12EB8810, 0x12EC8810, 0x12ED8810, 0x12EE8810, 0x12EF8810, 0x12F08810, 0x12F28810,
+            0x12F38810, 0x12D68810, 0x12DD8810, 0x12E48810, 0x12F18810, 0x12F48810, 0x12F58810, 0x12F70810, 0x12F88810, 0x12F98810,
+            0x02258805, 0x150F0804, 0x150F0808, 0x150F8804, 0x0FD30804, 0x0FD50804, 0x0FE48804, 0x0FED0804, 0x0FF78804, 0x10058804,
+            0x10188804, 0x104F0804, 0x10598804, 0x10640804, 0x106F8804, 0x10868804, 0x10908804, 0x10A00804, 0x10A98804, 0x10A08804,
+            0x10AA0804, 0x10A68804, 0x10A38804, 0x10B50804, 0x10AC8804, 0x10B78804, 0x10CF0804, 0x10D40804, 0x10FD8804, 0x110D8804,
+            0x110E8804, 0x111E8804, 0x11258804, 0x112E8804, 0x11450804, 0x11538804, 0x11778804, 0x11908804, 0x11978804, 0x119A8804,
+            0x119D0804, 0x11A28804, 0x120C8804, 0x0FD1083A, 0x0FD10828, 0x00004628, 0x10038828, 0x0FDE083A, 0x0FE40804, 0x0FF5883A,
+            0x1003883A, 0x100A883A, 0x1028883A, 0x103A883A, 0x1048083A, 0x1055883A, 0x1062083A, 0x106B083A, 0x1084883A, 0x108C083A,
+            0x10900804, 0x109E083A, 0x10B3083A, 0x10B5883A, 0x10C9883A, 0x10FB883A, 0x110B883A, 0x112C883A, 0x0FD68828, 0x0FD88828,
+            0x0FD58828, 0x0FDE0828, 0x0FF58828, 0x10038828, 0x100D0828, 0x100F8828, 0x10188828, 0x10288828, 0x104F0828, 0x10620828,
+            0x10848828, 0x109B8828, 0x10A78828, 0x10AC8828, 0x10B58828, 0x10FB8828, 0x110B8828, 0x110E8828, 0x111C0828, 0x11238828,
+            0x11780828, 0x118F8828, 0x11910828, 0x11A10828, 0x1048082A, 0x10C9882A, 0x110B882A, 0x1123882A, 0x118F882A, 0x119C882A,
+            0x11A1082A, 0x110F8804, 0x0FE50804, 0x0FF90804, 0x10248804, 0x10870804, 0x10910804, 0x10B90804, 0x10D18804, 0x10E00804,
+            0x10EC0804, 0x11008804, 0x11478804, 0x10358804, 0x12188828, 0x10288808, 0x00004648, 0x10FB8808, 0x00004608, 0x103A8808,
+            0x10518804, 0x10550804, 0x10B80804, 0x11140804, 0x11230804, 0x0FE60804, 0x0FF98804, 0x10250804, 0x10310804, 0x10648804,
+            0x10788804, 0x10878804, 0x10960804, 0x10B98804, 0x10D68804, 0x10EC8804, 0x10F48804, 0x11268804, 0x11340804, 0x11480804,
+            0x0FD40804, 0x0FDB0804, 0x0FFE0804, 0x10090804, 0x10118804, 0x10180804, 0x100F0804, 0x10520804, 0x10AB0804, 0x10F90804,
+            0x11148804, 0x11560804, 0x0FDB8828, 0x0FEB0828, 0x0FF28828, 0x0FF58828, 0x00004628, 0x10160828, 0x10210828, 0x105E0828,
+            0x102A8828, 0x11160828, 0x104F8828, 0x10530828, 0x104C0828, 0x10518828, 0x105C0828, 0x10790828, 0x10788828, 0x106D0828,
+            0x10880828, 0x111F0828, 0x10918828, 0x10968828, 0x108E0828, 0x10AE0828, 0x10BD8828, 0x10ED0828, 0x10F20828, 0x11010828,
+            0x11110828, 0x11210828, 0x110D8828, 0x11270828, 0x112A8828, 0x11430828, 0x114A8828, 0x114C8828, 0x11518828, 0x11950828,
+            0x11628808, 0x0FD10808, 0x00004608, 0x0FD10808, 0x109E0808, 0x0FD10808, 0x11238808, 0x0FEB0808, 0x00000C08, 0x0FF58808,
+            0x00004648, 0x10288808, 0x102D0808, 0x10620808, 0x106B0808, 0x106D0808, 0x10868808, 0x108C0808, 0x108E0808, 0x10CC0808,
+            0x10CE8808, 0x10E90808, 0x11430808, 0x0FD88808, 0x0FDE0808, 0x0FEA8808, 0x100D0808, 0x10210808, 0x10750808, 0x109E0808,
+            0x00000D08, 0x10B58808, 0x10F20808, 0x110B8808, 0x00000D08, 0x0FD10808, 0x00000AC8, 0x109E0808, 0x00000AC8, 0x110B8808,
+            0x00000AC8, 0x0FD10810, 0x00001104, 0x0FD10804, 0x00001104, 0x0FDE0810, 0x00000B84, 0x0FDE0804, 0x00000B84, 0x0FDE0810,
+            0x00001084, 0x0FDE0804, 0x00001084, 0x0FDE0810, 0x00001244, 0x0FDE0804, 0x00001244, 0x0FEB0810, 0x00000C04, 0x00000904,
+            0x0FEB0804, 0x00000C04, 0x00000904, 0x0FF58810, 0x00000B84, 0x0FF58804, 0x00000B84, 0x0FF58810, 0x00001084, 0x0FF58804,
+            0x00001084, 0x0FF58810, 0x00001244, 0x0FF58804, 0x00001244, 0x0FF58810, 0x00000C04, 0x0FF58804, 0x00000C04, 0x0FF58810,
+            0x00001184, 0x0FF58804, 0x00001184, 0x10038810, 0x00000C84, 0x00000944, 0x10038804, 0x00000C84, 0x00000944, 0x10038810,
+            0x00000C84, 0x00000904, 0x10038804, 0x00000C84, 0x00000904, 0x10038810, 0x00001184, 0x10038804, 0x00001184, 0x10038810,
+            0x00001204, 0x10038804, 0x00001204, 0x10038810, 0x00000C04, 0x00000984, 0x10038804, 0x00000C04, 0x00000984, 0x10210810,
+            0x00000B84, 0x10210804, 0x00000B84, 0x10288810, 0x00000C84, 0x10288804, 0x00000C84, 0x103A8810, 0x00000B84, 0x103A8804,
+            0x00000B84, 0x103A8810, 0x00001084, 0x103A8804, 0x00001084, 0x103A8810, 0x00000AC4, 0x103A8804, 0x00000AC4, 0x103A8810,
+            0x00000C04, 0x103A8804, 0x00000C04, 0x103A8810, 0x000011C4, 0x103A8804, 0x000011C4, 0x10480810, 0x00001204, 0x10480804,
+            0x00001204, 0x10480810, 0x00000AC4, 0x00000904, 0x10480804, 0x00000AC4, 0x00000904, 0x10620810, 0x00000904, 0x10620804,
+            0x00000904, 0x10620810, 0x00001084, 0x10620804, 0x00001084, 0x10620810, 0x00001244, 0x10620804, 0x00001244, 0x106B0810,
+            0x00001084, 0x106B0804, 0x00001084, 0x106B0810, 0x00001084, 0x00000C84, 0x106B0804, 0x00001084, 0x00000C84, 0x106B0810,
+            0x00001244, 0x106B0804, 0x00001244, 0x106B0810, 0x00001184, 0x106B0804, 0x00001184, 0x10848810, 0x00000904, 0x10848804,
+            0x00000904, 0x10848810, 0x00000B84, 0x10848804, 0x00000B84, 0x10848810, 0x00001084, 0x10848804, 0x00001084, 0x108C0810,
+            0x00000B84, 0x108C0804, 0x00000B84, 0x108C0810, 0x00001084, 0x108C0804, 0x00001084, 0x108C0810, 0x00001244, 0x108C0804,
+            0x00001244, 0x108C0810, 0x00001184, 0x108C0804, 0x00001184, 0x109E0810, 0x00000B44, 0x00000904, 0x109E0804, 0x00000B44,
+            0x00000904, 0x109E0810, 0x00000B44, 0x00000AC4, 0x109E0804, 0x00000B44, 0x00000AC4, 0x109E0810, 0x00000C84, 0x00000944,
+            0x109E0804, 0x00000C84, 0x00000944, 0x109E0810, 0x00000C84, 0x00000904, 0x109E0804, 0x00000C84, 0x00000904, 0x10B58810,
+            0x00000904, 0x10B58804, 0x00000904, 0x10B58810, 0x00000B84, 0x10B58804, 0x00000B84, 0x10C98810, 0x00000B84, 0x10C98804,
+            0x00000B84, 0x10C98810, 0x00001084, 0x10C98804, 0x00001084, 0x10C98810, 0x00001084, 0x00000C84, 0x10C98804, 0x00001084,
+            0x00000C84, 0x10C98810, 0x00001244, 0x10C98804, 0x00001244, 0x10E90810, 0x00000B84, 0x10E90804, 0x00000B84, 0x10E90810,
+            0x00001084, 0x10E90804, 0x00001084, 0x10E90810, 0x00000904, 0x00000B84, 0x10E90804, 0x00000904, 0x00000B84, 0x10E90810,
+            0x00000A04, 0x00000B84, 0x10E90804, 0x00000A04, 0x00000B84, 0x10E90810, 0x00001084, 0x00000B84, 0x10E90804, 0x00001084,
+            0x00000B84, 0x10FB8810, 0x00000B84, 0x10FB8804, 0x00000B84, 0x10FB8810, 0x00001084, 0x10FB8804, 0x00001084, 0x10FB8810,
+            0x00001244, 0x10FB8804, 0x00001244, 0x10FB8810, 0x00001184, 0x10FB8804, 0x00001184, 0x110B8810, 0x000010C4, 0x110B8804,
+            0x000010C4, 0x110B8810, 0x00001204, 0x110B8804, 0x00001204, 0x110B8810, 0x00001184, 0x110B8804, 0x00001184, 0x110B8810,
+            0x00000B44, 0x00000904, 0x110B8804, 0x00000B44, 0x00000904, 0x110B8810, 0x00000C84, 0x00000AC4, 0x110B8804, 0x00000C84,
+            0x00000AC4, 0x11238810, 0x00000B44, 0x11238804, 0x00000B44, 0x11238810, 0x00001084, 0x11238804, 0x00001084, 0x112C8810,
+            0x00000944, 0x112C8804, 0x00000944, 0x112C8810, 0x00000904, 0x112C8804, 0x00000904, 0x112C8810, 0x00000AC4, 0x112C8804,
+            0x00000AC4, 0x112C8810, 0x00000B84, 0x112C8804, 0x00000B84, 0x112C8810, 0x00001084, 0x112C8804, 0x00001084, 0x11320810,
+            0x00000B84, 0x11320804, 0x00000B84, 0x11320810, 0x00000AC4, 0x11320804, 0x00000AC4, 0x11380810, 0x00000B84, 0x11380804,
+            0x00000B84, 0x11430810, 0x000009C4, 0x11430804, 0x000009C4, 0x11430810, 0x00001084, 0x11430804, 0x00001084, 0x11430810,
+            0x00001244, 0x11430804, 0x00001244, 0x103A8804, 0x00001244, 0x10FB8804, 0x00000AC4, 0x112C8804, 0x00000A44, 0x11380804,
+            0x00000A44, 0x0FD10808, 0x11728808, 0x10E90808, 0x00004648, 0x00000B84, 0x10F10804, 0x10E90814, 0x00004608, 0x10E90814,
+            0x10030804, 0x0FD10810, 0x00001084, 0x0FD10804, 0x00001084, 0x0FD10810, 0x00000EC4, 0x0FD10804, 0x00000EC4, 0x0FD10810,
+            0x000009C4, 0x00000904, 0x0FD10804, 0x000009C4, 0x00000904, 0x0FD10810, 0x000009C4, 0x00000944, 0x0FD10804, 0x000009C4,
+            0x00000944, 0x0FD10810, 0x000009C4, 0x00000EC4, 0x0FD10804, 0x000009C4, 0x00000EC4, 0x0FD10810, 0x000009C4, 0x00000B44,
+            0x0FD10804, 0x000009C4, 0x00000B44, 0x0FD10810, 0x00001084, 0x000009C4, 0x0FD10804, 0x00001084, 0x000009C4, 0x0FD10810,
+            0x00000984, 0x00000904, 0x0FD10804, 0x00000984, 0x00000904, 0x0FD10810, 0x00000984, 0x00000944, 0x0FD10804, 0x00000984,
+            0x00000944, 0x0FD10810, 0x00000984, 0x00000EC4, 0x0FD10804, 0x00000984, 0x00000EC4, 0x0FD10810, 0x00000984, 0x00000B44,
+            0x0FD10804, 0x00000984, 0x00000B44, 0x0FD10810, 0x00001084, 0x00000984, 0x0FD10804, 0x00001084, 0x00000984, 0x10038810,
+            0x00001084, 0x10038804, 0x00001084, 0x10038810, 0x00000EC4, 0x10038804, 0x00000EC4, 0x10038810, 0x00000B44, 0x10038804,
+            0x00000B44, 0x10038810, 0x000009C4, 0x00000904, 0x10038804, 0x000009C4, 0x00000904, 0x10038810, 0x000009C4, 0x00000944,
+            0x10038804, 0x000009C4, 0x00000944, 0x10038810, 0x000009C4, 0x00000EC4, 0x10038804, 0x000009C4, 0x00000EC4, 0x10038810,
+            0x000009C4, 0x00000B44, 0x10038804, 0x000009C4, 0x00000B44, 0x10038810, 0x00001084, 0x000009C4, 0x10038804, 0x00001084,
+            0x000009C4, 0x10480810, 0x00000EC4, 0x10480804, 0x00000EC4, 0x10480810, 0x00001084, 0x10480804, 0x00001084, 0x109E0810,
+            0x00001084, 0x109E0804, 0x00001084, 0x109E0810, 0x00000EC4, 0x109E0804, 0x00000EC4, 0x109E0810, 0x000009C4, 0x00000904,
+            0x109E0804, 0x000009C4, 0x00000904, 0x109E0810, 0x000009C4, 0x00000944, 0x109E0804, 0x000009C4, 0x00000944, 0x109E0810,
+            0x000009C4, 0x00000EC4, 0x109E0804, 0x000009C4, 0x00000EC4, 0x109E0810, 0x000009C4, 0x00000B44, 0x109E0804, 0x000009C4,
+            0x00000B44, 0x109E0810, 0x00001084, 0x000009C4, 0x109E0804, 0x00001084, 0x000009C4, 0x109E0810, 0x00000FC4, 0x00000904,
+            0x109E0804, 0x00000FC4, 0x00000904, 0x109E0810, 0x00000FC4, 0x00000944, 0x109E0804, 0x00000FC4, 0x00000944, 0x109E0810,
+            0x00000FC4, 0x00000EC4, 0x109E0804, 0x00000FC4, 0x00000EC4, 0x109E0810, 0x00000FC4, 0x00000B44, 0x109E0804, 0x00000FC4,
+            0x00000B44, 0x109E0810, 0x00000FC4, 0x00001084, 0x109E0804, 0x00000FC4, 0x00001084, 0x110B8810, 0x00001084, 0x110B8804,
+            0x00001084, 0x110B8810, 0x00000EC4, 0x110B8804, 0x00000EC4, 0x110B8810, 0x00000FC4, 0x00000904, 0x110B8804, 0x00000FC4,
+            0x00000904, 0x110B8810, 0x00000FC4, 0x00000944, 0x110B8804, 0x00000FC4, 0x00000944, 0x110B8810, 0x00000FC4, 0x00000EC4,
+            0x110B8804, 0x00000FC4, 0x00000EC4, 0x110B8810, 0x00000FC4, 0x00000B44, 0x110B8804, 0x00000FC4, 0x00000B44, 0x110B8810,
+            0x00000FC4, 0x00001084, 0x110B8804, 0x00000FC4, 0x00001084, 0x11380810, 0x00000944, 0x11380804, 0x00000944, 0x11380810,
+            0x00001084, 0x11380804, 0x00001084, 0x11380810, 0x00000EC4, 0x11380804, 0x00000EC4, 0x11380810, 0x00000B44, 0x11380804,
+            0x00000B44, 0x106B0814, 0x106B0814, 0x106B0808, 0x106B0808, 0x112A0810, 0x112A0804, 0x11400810, 0x11400804, 0x118F0804,
+            0x00000884, 0x118F0804, 0x000008C4, 0x118F0804, 0x00000884, 0x00000944, 0x118F0804, 0x000008C4, 0x00000944, 0x118F0804,
+            0x00000884, 0x00000904, 0x118F0804, 0x000008C4, 0x00000904, 0x118F0804, 0x00000884, 0x00000A84, 0x118F0804, 0x000008C4,
+            0x00000A84, 0x118F0810, 0x00000884, 0x118F0810, 0x000008C4, 0x118F0810, 0x00000884, 0x00000944, 0x118F0810, 0x000008C4,
+            0x00000944, 0x118F0810, 0x00000884, 0x00000904, 0x118F0810, 0x000008C4, 0x00000904, 0x118F0810, 0x00000884, 0x00000A84,
+            0x118F0810, 0x000008C4, 0x00000A84, 0x11918804, 0x00000884, 0x11918804, 0x000008C4, 0x11918804, 0x00000884, 0x00000944,
+            0x11918804, 0x000008C4, 0x00000944, 0x11918804, 0x00000884, 0x00000904, 0x11918804, 0x000008C4, 0x00000904, 0x11918810,
+            0x00000884, 0x11918810, 0x000008C4, 0x11918810, 0x00000884, 0x00000944, 0x11918810, 0x000008C4, 0x00000944, 0x11918810,
+            0x00000884, 0x00000904, 0x11918810, 0x000008C4, 0x00000904, 0x11948804, 0x00000884, 0x11948804, 0x000008C4, 0x11948804,
+            0x00000884, 0x00000944, 0x11948804, 0x000008C4, 0x00000944, 0x11948804, 0x00000884, 0x00000904, 0x11948804, 0x000008C4,
+            0x00000904, 0x11948804, 0x00000884, 0x00000A84, 0x11948804, 0x000008C4, 0x00000A84, 0x11948810, 0x00000884, 0x11948810,
+            0x000008C4, 0x11948810, 0x00000884, 0x00000944, 0x11948810, 0x000008C4, 0x00000944, 0x11948810, 0x00000884, 0x00000904,
+            0x11948810, 0x000008C4, 0x00000904, 0x11948810, 0x00000884, 0x00000A84, 0x11948810, 0x000008C4, 0x00000A84, 0x11958804,
+            0x00000884, 0x11958804, 0x000008C4, 0x11958804, 0x00000884, 0x00000944, 0x11958804, 0x000008C4, 0x00000944, 0x11958804,
+            0x00000884, 0x00000904, 0x11958804, 0x000008C4, 0x00000904, 0x11958804, 0x00000884, 0x00000A84, 0x11958804, 0x000008C4,
+            0x00000A84, 0x11958810, 0x00000884, 0x11958810, 0x000008C4, 0x11958810, 0x00000884, 0x00000944, 0x11958810, 0x000008C4,
+            0x00000944, 0x11958810, 0x00000884, 0x00000904, 0x11958810, 0x000008C4, 0x00000904, 0x11958810, 0x00000884, 0x00000A84,
+            0x11958810, 0x000008C4, 0x00000A84, 0x11998804, 0x00000884, 0x11998804, 0x000008C4, 0x11998804, 0x00000884, 0x00000944,
+            0x11998804, 0x000008C4, 0x00000944, 0x11998804, 0x00000884, 0x00000904, 0x11998804, 0x000008C4, 0x00000904, 0x11998810,
+            0x00000884, 0x11998810, 0x000008C4, 0x11998810, 0x00000884, 0x00000944, 0x11998810, 0x000008C4, 0x00000944, 0x11998810,
+            0x00000884, 0x00000904, 0x11998810, 0x000008C4, 0x00000904, 0x11A08804, 0x00000884, 0x11A08804, 0x000008C4, 0x11A08804,
+            0x00000884, 0x00000944, 0x11A08804, 0x000008C4, 0x00000944, 0x11A08804, 0x00000884, 0x00000904, 0x11A08804, 0x000008C4,
+            0x00000904, 0x11A08804, 0x00000884, 0x00000A84, 0x11A08804, 0x000008C4, 0x00000A84, 0x11A08810, 0x000008C4, 0x11A08810,
+            0x000008C4, 0x00000944, 0x11A08810, 0x000008C4, 0x00000904, 0x11A08810, 0x000008C4, 0x00000A84, 0x11A30804, 0x00000884,
+            0x11A30804, 0x000008C4, 0x11A30804, 0x00000884, 0x00000944, 0x11A30804, 0x000008C4, 0x00000944, 0x11A30804, 0x00000884,
+            0x00000904, 0x11A30804, 0x000008C4, 0x00000904, 0x11A30804, 0x00000884, 0x00000A84, 0x11A30804, 0x000008C4, 0x00000A84,
+            0x11A30810, 0x00000884, 0x11A30810, 0x000008C4, 0x11A30810, 0x00000884, 0x00000944, 0x11A30810, 0x000008C4, 0x00000944,
+            0x11A30810, 0x00000884, 0x00000904, 0x11A30810, 0x000008C4, 0x00000904, 0x11A30810, 0x00000884, 0x00000A84, 0x11A30810,
+            0x000008C4, 0x00000A84, 0x118F0804, 0x00000944, 0x11918804, 0x00000944, 0x11948804, 0x00000944, 0x11958804, 0x00000944,
+            0x11998804, 0x00000944, 0x11A08804, 0x00000944, 0x11A30804, 0x00000944, 0x118F0804, 0x00000884, 0x00001304, 0x118F0804,
+            0x000008C4, 0x00001304, 0x118F0804, 0x00000884, 0x00000944, 0x00001304, 0x118F0804, 0x000008C4, 0x00000944, 0x00001304,
+            0x118F0804, 0x00000884, 0x00000904, 0x00001304, 0x118F0804, 0x000008C4, 0x00000904, 0x00001304, 0x118F0804, 0x00000884,
+            0x00000A84, 0x00001304, 0x118F0804, 0x000008C4, 0x00000A84, 0x00001304, 0x118F0810, 0x00000884, 0x00001304, 0x118F0810,
+            0x000008C4, 0x00001304, 0x118F0810, 0x00000884, 0x00000944, 0x00001304, 0x118F0810, 0x000008C4, 0x00000944, 0x00001304,
+            0x118F0810, 0x00000884, 0x00000904, 0x00001304, 0x118F0810, 0x000008C4, 0x00000904, 0x00001304, 0x118F0810, 0x00000884,
+            0x00000A84, 0x00001304, 0x118F0810, 0x000008C4, 0x00000A84, 0x00001304, 0x11948804, 0x00000884, 0x00001304, 0x11948804,
+            0x000008C4, 0x00001304, 0x11948804, 0x00000884, 0x00000944, 0x00001304, 0x11948804, 0x000008C4, 0x00000944, 0x00001304,
+            0x11948804, 0x00000884, 0x00000904, 0x00001304, 0x11948804, 0x000008C4, 0x00000904, 0x00001304, 0x11948804, 0x00000884,
+            0x00000A84, 0x00001304, 0x11948804, 0x000008C4, 0x00000A84, 0x00001304, 0x11948810, 0x00000884, 0x00001304, 0x11948810,
+            0x000008C4, 0x00001304, 0x11948810, 0x00000884, 0x00000944, 0x00001304, 0x11948810, 0x000008C4, 0x00000944, 0x00001304,
+            0x11948810, 0x00000884, 0x00000904, 0x00001304, 0x11948810, 0x000008C4, 0x00000904, 0x00001304, 0x11948810, 0x00000884,
+            0x00000A84, 0x00001304, 0x11948810, 0x000008C4, 0x00000A84, 0x00001304, 0x11A30804, 0x00000884, 0x00001304, 0x11A30804,
+            0x000008C4, 0x00001304, 0x11A30804, 0x00000884, 0x00000944, 0x00001304, 0x11A30804, 0x000008C4, 0x00000944, 0x00001304,
+            0x11A30804, 0x00000884, 0x00000904, 0x00001304, 0x11A30804, 0x000008C4, 0x00000904, 0x00001304, 0x11A30804, 0x00000884,
+            0x00000A84, 0x00001304, 0x11A30804, 0x000008C4, 0x00000A84, 0x00001304, 0x11A30810, 0x00000884, 0x00001304, 0x11A30810,
+            0x000008C4, 0x00001304, 0x11A30810, 0x00000884, 0x00000944, 0x00001304, 0x11A30810, 0x000008C4, 0x00000944, 0x00001304,
+            0x11A30810, 0x00000884, 0x00000904, 0x00001304, 0x11A30810, 0x000008C4, 0x00000904, 0x00001304, 0x11A30810, 0x00000884,
+            0x00000A84, 0x00001304, 0x11A30810, 0x000008C4, 0x00000A84, 0x00001304, 0x118F0804, 0x00000984, 0x118F0804, 0x00000C84,
+            0x118F0804, 0x00000944, 0x00001304, 0x118F0804, 0x00001304, 0x118F0804, 0x00000904, 0x00001304, 0x118F0804, 0x00000A84,
+            0x118F0804, 0x00000A84, 0x00001304, 0x118F0810, 0x00000984, 0x118F0810, 0x00000C84, 0x118F0810, 0x00000944, 0x118F0810,
+            0x00001304, 0x02600805, 0x11958804, 0x02610805, 0x025D8805, 0x00000A84, 0x11948804, 0x00000944, 0x00001304, 0x11948804,
+            0x00001304, 0x11948804, 0x00000904, 0x00001304, 0x11948804, 0x00000A84, 0x11948804, 0x00000A84, 0x00001304, 0x11918810,
+            0x00000944, 0x11948810, 0x00000944, 0x11948810, 0x00001304, 0x02600805, 0x00000944, 0x02600805, 0x00000904, 0x02600805,
+            0x00000A84, 0x11958804, 0x00000984, 0x11958804, 0x00000C84, 0x11958804, 0x00000AC4, 0x00000944, 0x11958804, 0x00000A84,
+            0x11958804, 0x00000AC4, 0x00000A84, 0x11958810, 0x00000984, 0x11958810, 0x00000C84, 0x11958810, 0x00000944, 0x02608805,
+            0x00000944, 0x02608805, 0x00000904, 0x02608805, 0x00000A84, 0x11A08804, 0x00000984, 0x11A08804, 0x00000C84, 0x11A08804,
+            0x00000AC4, 0x00000944, 0x119C8804, 0x00000884, 0x119C8804, 0x000008C4, 0x11A08804, 0x00000A84, 0x11A08804, 0x00000AC4,
+            0x00000A84, 0x11A08810, 0x00000984, 0x11A08810, 0x00000C84, 0x11A08810, 0x00000944, 0x119C8810, 0x000008C4, 0x025D8805,
+            0x00000944, 0x11A30804, 0x00000944, 0x00001304, 0x11A30804, 0x00001304, 0x11A30804, 0x00000904, 0x00001304, 0x11A30804,
+            0x00000A84, 0x11A30804, 0x00000A84, 0x00001304, 0x11998810, 0x00000944, 0x11A30810, 0x00000944, 0x11A30810, 0x00001304,
+            0x02608805, 0x01098805, 0x01098837, 0x010A0805, 0x01CA0805, 0x01060805, 0x018B8805, 0x018F0805, 0x01D98805, 0x01DC8805,
+            0x013F0809, 0x013F0809, 0x013F0809, 0x013F0809, 0x013F0809, 0x013F0809, 0x01DD8805, 0x01038805, 0x01D78805, 0x01D88805,
+            0x01DF8805, 0x01DF8809, 0x01DF8809, 0x01DF8809, 0x01DF8809, 0x01DF8809, 0x01E00805, 0x01E00809, 0x01E00809, 0x01E00809,
+            0x01E00809, 0x01E00809, 0x01E18805, 0x018D8805, 0x01E20805, 0x01338809, 0x01338809, 0x013E0805, 0x01050805, 0x01E28805,
+            0x01E38805, 0x01E48805, 0x01DE0805, 0x033B0805, 0x019A0805, 0x01368809, 0x01368809, 0x01368809, 0x01338809, 0x01338809,
+            0x01368809, 0x01D50805, 0x01CE8805, 0x01DE8805, 0x01D10805, 0x011E0805, 0x01E40805, 0x01D18805, 0x03390805, 0x010D0805,
+            0x01E30805, 0x017C8805, 0x01DF8809, 0x01DF8809, 0x01DF8809, 0x01DF8809, 0x017D8805, 0x0FCC0828, 0x10480828, 0x0FCE0828,
+            0x03330829, 0x03388829, 0x03358829, 0x01940829, 0x108C0828, 0x0FCC082A, 0x0333082B, 0x0338882B, 0x0335882B, 0x0194082B,
+            0x0FD1082A, 0x1003882A, 0x109E082A, 0x1132082A, 0x100D082A, 0x103A882A, 0x1062082A, 0x106B082A, 0x1084882A, 0x108C082A,
+            0x10B5882A, 0x10E9082A, 0x10FB882A, 0x0FBC0804, 0x10C98814, 0x10E90808, 0x0FC00804, 0x0FC90804, 0x00004244, 0x00004284,
+            0x000042C4, 0x00004304, 0x00004344, 0x00004384, 0x000043C4, 0x00004404, 0x00004444, 0x00004484, 0x000044C4, 0x00004504,
+            0x00004544, 0x00004584, 0x0FD10808, 0x01D30809, 0x0FEB0808, 0x0FD10808, 0x01D30809, 0x10E90808, 0x0FEB0816, 0x02950809,
+            0x0FEB0814, 0x02EB0805, 0x0FEB0808, 0x01D30809, 0x109E0808, 0x0FEB0808, 0x01D30809, 0x110B8808, 0x100F8814, 0x02EB8805,
+            0x02950809, 0x10210814, 0x1028880A, 0x103A8816, 0x103A880A, 0x10480816, 0x106B0816, 0x106B080A, 0x02EC0805, 0x108C0816,
+            0x108C0814, 0x109E0808, 0x02EC8805, 0x10B58816, 0x10C00816, 0x10C98816, 0x02ED8805, 0x10E90828, 0x10848828, 0x10FB8814,
+            0x10038814, 0x106B0814, 0x10FB8828, 0x10848828, 0x02EE8805, 0x11430816, 0x02EF0805, 0x02EF8805, 0x02F00805, 0x0FDE0816,
+            0x02F08805, 0x1003880A, 0x10038816, 0x10210816, 0x10278810, 0x10848816, 0x109E080A, 0x130F0808, 0x1048080A, 0x02F10805,
+            0x10210814, 0x0FD10814, 0x11320814, 0x119A080A, 0x1190080A, 0x11900816, 0x119A0816, 0x0332880B, 0x02F18805, 0x0FF58816,
+            0x0FF5880A, 0x1055880A, 0x02F38805, 0x03808805, 0x02F40805, 0x0FD10814, 0x01D30809, 0x10E90814, 0x10278804, 0x02F48805,
+            0x0FCC883C, 0x033B083D, 0x0FCF883C, 0x0FCC883C, 0x033B083D, 0x0FD0883C, 0x0FCC883C, 0x033B083D, 0x0FCC883C, 0x0FCC083C,
+            0x0FCC883C, 0x033B083D, 0x0FCD883C, 0x0FCD083C, 0x033B083D, 0x0FCD883C, 0x0FCC883C, 0x033B083D, 0x0FCE883C, 0x0FCD083C,
+            0x033B083D, 0x0FCE883C, 0x0FCD883C, 0x033B083D, 0x0FCE883C, 0x0FCE083C, 0x033B083D, 0x0FCE883C, 0x0FCC883C, 0x033B083D,
+            0x0FCF083C, 0x0FCE883C, 0x033B083D, 0x0FCF083C, 0x0FCC883C, 0x033B083D, 0x0FD0083C, 0x0FCD883C, 0x033B083D, 0x0FD0083C,
+            0x0FCE883C, 0x033B083D, 0x0FD0083C, 0x0FCF883C, 0x033B083D, 0x0FD0083C, 0x0FCC883C, 0x033B083D, 0x10480814, 0x10480814,
+            0x10480814, 0x10480814, 0x10480814, 0x10480814, 0x10480814, 0x11238814, 0x11238814, 0x11238814, 0x10480814, 0x11238814,
+            0x10480814, 0x10480814, 0x11238814, 0x10480814, 0x10480814, 0x10480814, 0x10480814, 0x11320814, 0x11320814, 0x11320814,
+            0x10480814, 0x11320814, 0x10480814, 0x10480814, 0x106B0814, 0x0FEB0814, 0x0FF58814, 0x10848814, 0x10480808, 0x10480808,
+            0x10480808, 0x10480808, 0x10480808, 0x10480808, 0x11238808, 0x11238808, 0x10480808, 0x11238808, 0x10480808, 0x10480808,
+            0x11238808, 0x10480808, 0x10480808, 0x10480808, 0x10480808, 0x11320808, 0x11320808, 0x10480808, 0x11320808, 0x10480808,
+            0x10480808, 0x0ECD8805, 0x0FF48810, 0x0FF48804, 0x0FCF0804, 0x0ECF0805, 0x0FCC083C, 0x033B083D, 0x0FCD883C, 0x02F50805,
+            0x02F60805, 0x02F70805, 0x02F68805, 0x02F78805, 0x02F60805, 0x00000BC4, 0x02F68805, 0x00000BC4, 0x02FB0805, 0x02F80805,
+            0x00000BC4, 0x03040805, 0x03130805, 0x00000BC4, 0x03150805, 0x00000BC4, 0x03140805, 0x00000BC4, 0x03130805, 0x032C8805,
+            0x00000BC4, 0x032D0805, 0x032E8805, 0x00000BC4, 0x032F0805, 0x032F8805, 0x00000BC4, 0x03300805, 0x03310805, 0x03388805,
+            0x03398805, 0x033B8805, 0x033F0805, 0x03400805, 0x03430805, 0x00000BC4, 0x03438805, 0x03438805, 0x00000BC4, 0x03440805,
+            0x03460809, 0x03460809, 0x03460809, 0x03460809, 0x03460809, 0x03468805, 0x03468809, 0x03468809, 0x03468809, 0x03468809,
+            0x03468809, 0x03470805, 0x034C8805, 0x00000BC4, 0x034F0805, 0x034F8805, 0x00000BC4, 0x03500805, 0x03500805, 0x00000BC4,
+            0x03510805, 0x03510805, 0x00000BC4, 0x03518805, 0x03358805, 0x00000BC4, 0x035C8805, 0x035C8805, 0x00000BC4, 0x035D0805,
+            0x03530805, 0x00000BC4, 0x03350805, 0x00000BC4, 0x03360805, 0x00000BC4, 0x035D8805, 0x00000BC4, 0x035E0805, 0x00000BC4,
+            0x03620805, 0x03620805, 0x00000BC4, 0x03628805, 0x00000BC4, 0x03630805, 0x03630805, 0x00000BC4, 0x03638805, 0x00000BC4,
+            0x03640805, 0x03640805, 0x00000BC4, 0x03648805, 0x00000BC4, 0x03670805, 0x03670805, 0x00000BC4, 0x03678805, 0x00000BC4,
+            0x03680805, 0x03680805, 0x00000BC4, 0x03688805, 0x00000BC4, 0x03690805, 0x03750805, 0x00000BC4, 0x03780805, 0x00000BC4,
+            0x03788805, 0x00000BC4, 0x03798805, 0x00000BC4, 0x037A0805, 0x03810805, 0x03650805, 0x00000BC4, 0x03658805, 0x00000BC4,
+            0x036C8805, 0x00000BC4, 0x036D0805, 0x00000BC4, 0x03928805, 0x037B0805, 0x00000BC4, 0x037B8805, 0x00000BC4, 0x037C0805,
+            0x00000BC4, 0x037C8805, 0x00000BC4, 0x03958805, 0x019B0805, 0x03A28805, 0x01C00805, 0x03B10805, 0x042F0805, 0x0FCC880C,
+            0x0FCC880C, 0x0FCC080C, 0x0FCC880C, 0x0FCC880C, 0x0FCC880C, 0x0FCD080C, 0x0FCC880C, 0x0FCD880C, 0x0FCC880C, 0x0FCE080C,
+            0x0FCC880C, 0x0FCE880C, 0x0FCC880C, 0x0FCF080C, 0x0FCC880C, 0x0FCF880C, 0x0FCC880C, 0x0FD0080C, 0x0FCC880C, 0x0FD0880C,
+            0x0FCD080C, 0x0FCC080C, 0x01940809, 0x0FCC8808, 0x01948809, 0x01940809, 0x0FCD0808, 0x01948809, 0x01940809, 0x0FCD8808,
+            0x01948809, 0x01940809, 0x0FCE0808, 0x01948809, 0x01940809, 0x0FCE8808, 0x01948809, 0x01940809, 0x0FCF0808, 0x01948809,
+            0x01940809, 0x0FCF8808, 0x01948809, 0x01940809, 0x0FD00808, 0x01948809, 0x01940809, 0x0FD08808, 0x01948809, 0x01940809,
+            0x0FCC8808, 0x0FCC0808, 0x01948809, 0x01940809, 0x0FCC8808, 0x0FCC8808, 0x01948809, 0x01940809, 0x0FCC8808, 0x0FCD0808,
+            0x01948809, 0x01940809, 0x0FCC8808, 0x0FCD8808, 0x01948809, 0x01940809, 0x0FCC8808, 0x0FCE0808, 0x01948809, 0x01940809,
+            0x0FCC8808, 0x0FCE8808, 0x01948809, 0x01940809, 0x0FCC8808, 0x0FCF0808, 0x01948809, 0x01940809, 0x0FCC8808, 0x0FCF8808,
+            0x01948809, 0x01940809, 0x0FCC8808, 0x0FD00808, 0x01948809, 0x01940809, 0x0FCC8808, 0x0FD08808, 0x01948809, 0x01940809,
+            0x0FCD0808, 0x0FCC0808, 0x01948809, 0x0FCC8808, 0x013F0809, 0x0FCD0808, 0x013F0809, 0x0FCD8808, 0x013F0809, 0x0FCE0808,
+            0x013F0809, 0x0FCE8808, 0x013F0809, 0x0FCF0808, 0x013F0809, 0x0FCF8808, 0x013F0809, 0x0FD00808, 0x013F0809, 0x0FD08808,
+            0x013F0809, 0x0FCC8808, 0x0FCC0808, 0x013F0809, 0x0FCC8808, 0x0FCC8808, 0x013F0809, 0x0FCC8808, 0x0FCD0808, 0x013F0809,
+            0x0FCC8808, 0x0FCD8808, 0x013F0809, 0x0FCC8808, 0x0FCE0808, 0x013F0809, 0x0FCC8808, 0x0FCE8808, 0x013F0809, 0x0FCC8808,
+            0x0FCF0808, 0x013F0809, 0x0FCC8808, 0x0FCF8808, 0x013F0809, 0x0FCC8808, 0x0FD00808, 0x013F0809, 0x0FCC8808, 0x0FD08808,
+            0x013F0809, 0x0FCD0808, 0x0FCC0808, 0x013F0809, 0x01940809, 0x0FD10808, 0x01948809, 0x01940809, 0x0FDE0808, 0x01948809,
+            0x01940809, 0x0FEB0808, 0x01948809, 0x01940809, 0x0FF58808, 0x01948809, 0x01940809, 0x10038808, 0x01948809, 0x01940809,
+            0x10210808, 0x01948809, 0x01940809, 0x10288808, 0x01948809, 0x01940809, 0x103A8808, 0x01948809, 0x01940809, 0x10480808,
+            0x01948809, 0x01940809, 0x10558808, 0x01948809, 0x01940809, 0x10620808, 0x01948809, 0x01940809, 0x106B0808, 0x01948809,
+            0x01940809, 0x10848808, 0x01948809, 0x01940809, 0x108C0808, 0x01948809, 0x01940809, 0x109E0808, 0x01948809, 0x01940809,
+            0x10B58808, 0x01948809, 0x01940809, 0x10C00808, 0x01948809, 0x01940809, 0x10C98808, 0x01948809, 0x01940809, 0x10E90808,
+            0x01948809, 0x01940809, 0x10FB8808, 0x01948809, 0x01940809, 0x110B8808, 0x01948809, 0x01940809, 0x11238808, 0x01948809,
+            0x01940809, 0x112C8808, 0x01948809, 0x01940809, 0x11320808, 0x01948809, 0x01940809, 0x11380808, 0x01948809, 0x01940809,
+            0x11430808, 0x01948809, 0x0FD10818, 0x0FDE0818, 0x0FEB0818, 0x0FF58818, 0x10038818, 0x10210818, 0x10288818, 0x103A8818,
+            0x10480818, 0x10558818, 0x10620818, 0x106B0818, 0x10848818, 0x108C0818, 0x109E0818, 0x10B58818, 0x10C00818, 0x10C98818,
+            0x10E90818, 0x10FB8818, 0x110B8818, 0x11238818, 0x112C8818, 0x11320818, 0x11380818, 0x11430818, 0x0FD1080C, 0x0FDE080C,
+            0x0FEB080C, 0x0FF5880C, 0x1003880C, 0x1021080C, 0x1028880C, 0x103A880C, 0x1048080C, 0x1055880C, 0x1062080C, 0x106B080C,
+            0x1084880C, 0x108C080C, 0x109E080C, 0x10B5880C, 0x10C0080C, 0x10C9880C, 0x10E9080C, 0x10FB880C, 0x110B880C, 0x1123880C,
+            0x112C880C, 0x1132080C, 0x1138080C, 0x1143080C, 0x0FCC080C, 0x04348805, 0x05198805, 0x07F70805, 0x05318805, 0x09208805,
+            0x054C0805, 0x07F40805, 0x05590805, 0x059E0805, 0x05AF8805, 0x01AF0805, 0x05D30805, 0x01A90805, 0x05EB8805, 0x01AA0805,
+            0x05FB0805, 0x07740805, 0x06030805, 0x019E0805, 0x06448805, 0x01CB0805, 0x06640805, 0x019D0805, 0x06740805, 0x03460809,
+            0x03460809, 0x03460809, 0x03460809, 0x067B0805, 0x01200809, 0x01200809, 0x03358809, 0x03358809, 0x03358809, 0x03358809,
+            0x03358809, 0x03358809, 0x06AE8805, 0x06E10805, 0x00000BC4, 0x06E10805, 0x072C8805, 0x073C8805, 0x12A50810, 0x12A50804,
+            0x10728810, 0x10728804, 0x10730810, 0x10B80810, 0x10DB8810, 0x0FD38804, 0x11000804, 0x10430810, 0x10430804, 0x10670810,
+            0x10670804, 0x11508810, 0x11508804, 0x0FD88810, 0x10880810, 0x0FD68810, 0x0FDB8810, 0x11290804, 0x112F8810, 0x112F8804,
+            0x11298804, 0x10438810, 0x10438804, 0x10BF8804, 0x100A0804, 0x10D90804, 0x10AD8804, 0x100C8804, 0x1055882A, 0x1123883A,
+            0x10EF0810, 0x114E8810, 0x11A58810, 0x11A58804, 0x11A60810, 0x11A60804, 0x11A68810, 0x11A68804, 0x11A70810, 0x11A70804,
+            0x11A78810, 0x11A78804, 0x11A88810, 0x11A88804, 0x11A90810, 0x11A90804, 0x11A98810, 0x11A98804, 0x11AA0810, 0x11AA0804,
+            0x11AA8810, 0x11AA8804, 0x11AB0810, 0x11AB0804, 0x11AC0810, 0x11AC0804, 0x11AC8810, 0x11AC8804, 0x11AD0810, 0x11AD0804,
+            0x11AE8810, 0x11AE8804, 0x11AF0810, 0x11AF0804, 0x11AF8810, 0x11AF8804, 0x11B00810, 0x11B00804, 0x11B08810, 0x11B08804,
+            0x11B10810, 0x11B10804, 0x11B18810, 0x11B18804, 0x11B20810, 0x11B20804, 0x11B28810, 0x11B28804, 0x11B30810, 0x11B30804,
+            0x11B38810, 0x11B38804, 0x11C10810, 0x11C10804, 0x11C18810, 0x11C18804, 0x11A80810, 0x11A80804, 0x11AB8810, 0x11AB8804,
+            0x11AD8810, 0x11AD8804, 0x11AE0810, 0x11AE0804, 0x11B40810, 0x11B40804, 0x11B48810, 0x11B48804, 0x11B60810, 0x11B60804,
+            0x11B68810, 0x11B68804, 0x11B70810, 0x11B70804, 0x11B90810, 0x11B90804, 0x11BA0810, 0x11BA0804, 0x11BA8810, 0x11BA8804,
+            0x11BB0810, 0x11BB0804, 0x11BB8810, 0x11BB8804, 0x11BC0810, 0x11BC0804, 0x11BC8810, 0x11BC8804, 0x11BE0810, 0x11BE0804,
+            0x11BF0810, 0x11BF0804, 0x11BF8810, 0x11BF8804, 0x11C00810, 0x11C00804, 0x11C20810, 0x11C20804, 0x11C28810, 0x11C28804,
+            0x11C30810, 0x11C30804, 0x11AB0808, 0x11A58808, 0x11AA8808, 0x07710805, 0x11B58810, 0x11B58804, 0x11BD8810, 0x11BD8804,
+            0x11B88810, 0x11B88804, 0x01440805, 0x013A8805, 0x01838805, 0x0EDB8805, 0x01448805, 0x01840805, 0x12D00804, 0x12D10804,
+            0x12D20804, 0x12D30804, 0x12D40804, 0x12D50804, 0x12D60804, 0x12D80804, 0x12D90804, 0x12DA0804, 0x12DB0804, 0x12DC0804,
+            0x12DD0804, 0x12DF0804, 0x12E00804, 0x12E10804, 0x12E20804, 0x12E30804, 0x12E40804, 0x12E60804, 0x12E70804, 0x12E80804,
+            0x12E90804, 0x12EA0804, 0x12EB0804, 0x12EC0804, 0x12ED0804, 0x12EE0804, 0x12EF0804, 0x12F00804, 0x12F10804, 0x12F30804,
+            0x12F40804, 0x12D70804, 0x12DE0804, 0x12E50804, 0x12F20804, 0x12F50804, 0x12F68804, 0x12F90804, 0x13EC8804, 0x13F30804,
+            0x13FF8804, 0x13F28804, 0x13FF0804, 0x14088804, 0x02298805, 0x14110804, 0x141B8804, 0x14240804, 0x14288804, 0x14300804,
+            0x14430804, 0x144B8804, 0x14500804, 0x145B0804, 0x145F8804, 0x14640804, 0x147C8804, 0x148C0804, 0x14938804, 0x14980804,
+            0x14A90804, 0x14AD8804, 0x14B58804, 0x14CD8804, 0x14A30804, 0x14CF8804, 0x14D30804, 0x14D68804, 0x14DA0804, 0x14DD8804,
+            0x14E10804, 0x14E48804, 0x14E80804, 0x11C98808, 0x11CD8808, 0x11E38808, 0x11E88808, 0x11FD8808, 0x120A8808, 0x12140808,
+            0x12188808, 0x122A0808, 0x12308808, 0x124B8808, 0x125F0808, 0x12648808, 0x12740808, 0x12768808, 0x129C0808, 0x12350808,
+            0x12398808, 0x11C38808, 0x11DF8808, 0x11FD0808, 0x12870808, 0x12898808, 0x128E8808, 0x12910808, 0x12960808, 0x01E58805,
+            0x01B60805, 0x01E68805, 0x01B80805, 0x01E80805, 0x01B90805, 0x01E88805, 0x010E0805, 0x013E8805, 0x01848805, 0x01ED0805,
+            0x01BA0805, 0x01EE0805, 0x01BB0805, 0x01810805, 0x01378805, 0x12790804, 0x01450805, 0x014A0805, 0x01128805, 0x014A8805,
+            0x01120805, 0x011E8805, 0x01DA8805, 0x01CD8805, 0x010C0805, 0x01458805, 0x01830805, 0x01CA8805, 0x01CF8805, 0x010E8805,
+            0x01130805, 0x01910805, 0x010D8805, 0x01EF0805, 0x011F8805, 0x01D40805, 0x01DC0805, 0x01138805, 0x01CF0805, 0x01140805,
+            0x05AE8805, 0x01D58805, 0x7DA00808, 0x671B0000, 0x00004608, 0x7DA00808, 0x69C10000, 0x00004608, 0x7DA00808, 0x672D8000,
+            0x7DA00808, 0x672D0000, 0x7DA00808, 0x672C8000, 0x00004608, 0x7DA00808, 0x675D8000, 0x7DA00808, 0x68C10000, 0x00004608,
+            0x7DA00808, 0x68F00000, 0x00004608, 0x7DA00808, 0x69000000, 0x00004608, 0x7DA00808, 0x69010000, 0x7DA00808, 0x69AE0000,
+            0x00004608, 0x7DA00808, 0x69B48000, 0x00004608, 0x7DA00808, 0x6E078000, 0x00004608, 0x7DA00808, 0x6E078000, 0x00004648,
+            0x7DA00808, 0x6E110000, 0x00004608, 0x7DA00808, 0x6E118000, 0x7DA00808, 0x6E110000, 0x7DA00808, 0x6E118000, 0x00004608,
+            0x7DA00808, 0x6EF98000, 0x7DA00808, 0x6F3D0000, 0x7DA00808, 0x6FA88000, 0x7DA00808, 0x6FA80000, 0x00004608, 0x7DA00808,
+            0x6FE20000, 0x7DA00808, 0x6FE18000, 0x00004608, 0x7DA00808, 0x71260000, 0x7DA00808, 0x729A8000, 0x7DA00808, 0x72F08000,
+            0x7DA00808, 0x72F28000, 0x00004608, 0x7DA00808, 0x73840000, 0x00004608, 0x7DA00808, 0x75BD0000, 0x00004608, 0x7DA00808,
+            0x75E68000, 0x7DA00808, 0x76088000, 0x7DA00808, 0x761A8000, 0x7DA00808, 0x761D0000, 0x7DA00808, 0x78360000, 0x7DA00808,
+            0x79158000, 0x7DA00808, 0x79158000, 0x00004608, 0x7DA00808, 0x67160000, 0x7DA00808, 0x792D8000, 0x00004608, 0x7DA00808,
+            0x79568000, 0x7DA00808, 0x79C58000, 0x00004608, 0x7DA00808, 0x7AC58000, 0x00004608, 0x7DA00808, 0x7B770000, 0x00004608,
+            0x7DA00808, 0x7C9D0000, 0x00004608, 0x7DA00808, 0x7C9D8000, 0x7DA00808, 0x7D7C8000, 0x00004608, 0x7DA00808, 0x7E7C8000,
+            0x7DA00808, 0x7F4F8000, 0x7DA00808, 0x7FA98000, 0x7DA00808, 0x7FA90000, 0x7DA00808, 0x7FA98000, 0x00004608, 0x7DA00808,
+            0x7FA98000, 0x00004648, 0x7DA00808, 0x7FA90000, 0x00004608, 0x7DA00808, 0x7FC50000, 0x00004608, 0x7DA00808, 0x7FC50000,
+            0x00004648, 0x7DA00808, 0x7FC58000, 0x7DA08808, 0x40010000, 0x7DA08808, 0x40400000, 0x7DA08808, 0x403F8000, 0x00004608,
+            0x7DA08808, 0x40448000, 0x00004608, 0x7DA08808, 0x40FE0000, 0x00004608, 0x7DA08808, 0x413C8000, 0x7DA08808, 0x413C8000,
+            0x00004608, 0x7DA08808, 0x413C8000, 0x00004648, 0x7DA08808, 0x43270000, 0x7DA08808, 0x44320000, 0x7DA08808, 0x44C00000,
+            0x7DA08808, 0x44BF8000, 0x7DA08808, 0x44E08000, 0x7DA08808, 0x44E90000, 0x7DA08808, 0x44E90000, 0x00004608, 0x7DA08808,
+            0x45D00000, 0x7DA08808, 0x468E8000, 0x7DA08808, 0x46D98000, 0x00004608, 0x7DA08808, 0x47B30000, 0x7DA08808, 0x47DB0000,
+            0x7DA08808, 0x47DB0000, 0x00004608, 0x7DA08808, 0x47DB0000, 0x00004648, 0x7DA08808, 0x48488000, 0x00004608, 0x7DA08808,
+            0x4A428000, 0x7DA08808, 0x4ABB8000, 0x7DA08808, 0x4ABC0000, 0x7DA08808, 0x4ABF8000, 0x7DA08808, 0x4AF40000, 0x7DA08808,
+            0x4B0E0000, 0x00004608, 0x7DA08808, 0x4B0E8000, 0x7DA08808, 0x4B740000, 0x00004608, 0x7DA08808, 0x4BA90000, 0x7DA08808,
+            0x4BF30000, 0x7DA08808, 0x4C3A8000, 0x7DA08808, 0x4C670000, 0x7DA08808, 0x4C6F0000, 0x7DA08808, 0x4C6F8000, 0x7DA08808,
+            0x4C700000, 0x00004608, 0x7DA08808, 0x4C700000, 0x7DA08808, 0x4CB18000, 0x7DA08808, 0x4CCB0000, 0x00004608, 0x7DA08808,
+            0x4D360000, 0x7DA08808, 0x4D540000, 0x00004608, 0x7DA08808, 0x4D9E0000, 0x00004608, 0x7DA08808, 0x4E3E0000, 0x7DA08808,
+            0x4F0F8000, 0x7DA08808, 0x4F3A8000, 0x00004608, 0x7DA08808, 0x4F530000, 0x7DA08808, 0x4F620000, 0x7DA08808, 0x4F7F0000,
+            0x7DA08808, 0x4FA50000, 0x00004608, 0x7DA08808, 0x4FA80000, 0x7DA08808, 0x4FA90000, 0x00004608, 0x7DA08808, 0x4FBF8000,
+            0x7DA08808, 0x4FC68000, 0x00004608, 0x7DA08808, 0x4FCC8000, 0x7DA08808, 0x4FCE0000, 0x00004608, 0x7DA08808, 0x4FCE0000,
+            0x00004648, 0x7DA08808, 0x4FCF8000, 0x7DA00808, 0x67000000, 0x7DA00808, 0x67140000, 0x7DA00808, 0x671B0000, 0x7DA00808,
+            0x671F8000, 0x7DA00808, 0x672C8000, 0x7DA00808, 0x67428000, 0x7DA00808, 0x67460000, 0x7DA00808, 0x67500000, 0x7DA00808,
+            0x675D0000, 0x7DA00808, 0x689F8000, 0x7DA00808, 0x68B28000, 0x7DA00808, 0x68B58000, 0x7DA00808, 0x68C10000, 0x7DA00808,
+            0x68CB0000, 0x7DA00808, 0x68D58000, 0x7DA00808, 0x68F00000, 0x7DA00808, 0x68FA8000, 0x7DA00808, 0x69000000, 0x7DA00808,
+            0x694D8000, 0x7DA00808, 0x697C8000, 0x7DA00808, 0x698A8000, 0x7DA00808, 0x698D0000, 0x7DA00808, 0x699C0000, 0x7DA00808,
+            0x69A08000, 0x7DA00808, 0x69AE0000, 0x7DA00808, 0x69B48000, 0x7DA00808, 0x69C10000, 0x7DA00808, 0x69DB0000, 0x7DA00808,
+            0x69E40000, 0x7DA00808, 0x69F18000, 0x7DA00808, 0x6B6B8000, 0x7DA00808, 0x6B8F8000, 0x7DA00808, 0x6C758000, 0x7DA00808,
+            0x6C810000, 0x7DA00808, 0x6C850000, 0x7DA00808, 0x6C8A8000, 0x7DA00808, 0x6C938000, 0x7DA00808, 0x6CB98000, 0x7DA00808,
+            0x6DA80000, 0x7DA00808, 0x6DC00000, 0x7DA00808, 0x6DFC0000, 0x7DA00808, 0x6E078000, 0x7DA00808, 0x6E1C0000, 0x7DA00808,
+            0x6E370000, 0x7DA00808, 0x6E388000, 0x7DA00808, 0x6EED8000, 0x7DA00808, 0x6EF28000, 0x7DA00808, 0x6EF88000, 0x7DA00808,
+            0x6EFF0000, 0x7DA00808, 0x6F390000, 0x7DA00808, 0x6F3F8000, 0x7DA00808, 0x6F7A0000, 0x7DA00808, 0x6F7F0000, 0x7DA00808,
+            0x6F858000, 0x7DA00808, 0x6F898000, 0x7DA00808, 0x6FA80000, 0x7DA00808, 0x6FB08000, 0x7DA00808, 0x6FB98000, 0x7DA00808,
+            0x6FE18000, 0x7DA00808, 0x71040000, 0x7DA00808, 0x711B0000, 0x7DA00808, 0x71258000, 0x7DA00808, 0x72978000, 0x7DA00808,
+            0x729A0000, 0x7DA00808, 0x72C38000, 0x7DA00808, 0x72CB8000, 0x7DA00808, 0x72D20000, 0x7DA00808, 0x72DC8000, 0x7DA00808,
+            0x72F00000, 0x7DA00808, 0x72F28000, 0x7DA00808, 0x73780000, 0x7DA00808, 0x73840000, 0x7DA00808, 0x73940000, 0x7DA00808,
+            0x75900000, 0x7DA00808, 0x75B10000, 0x7DA00808, 0x75BC8000, 0x7DA00808, 0x75D98000, 0x7DA00808, 0x75E58000, 0x7DA00808,
+            0x75EA0000, 0x7DA00808, 0x75ED8000, 0x7DA00808, 0x76078000, 0x7DA00808, 0x760A0000, 0x7DA00808, 0x761A0000, 0x7DA00808,
+            0x78358000, 0x7DA00808, 0x79150000, 0x7DA00808, 0x791B0000, 0x7DA00808, 0x791D8000, 0x7DA00808, 0x791F8000, 0x7DA00808,
+            0x79238000, 0x7DA00808, 0x792C8000, 0x7DA00808, 0x792D8000, 0x7DA00808, 0x79560000, 0x7DA00808, 0x79C20000, 0x7DA00808,
+            0x79C48000, 0x7DA00808, 0x7A6E0000, 0x7DA00808, 0x7A730000, 0x7DA00808, 0x7A8C0000, 0x7DA00808, 0x7A8F8000, 0x7DA00808,
+            0x7A940000, 0x7DA00808, 0x7A980000, 0x7DA00808, 0x7AC58000, 0x7DA00808, 0x7AC90000, 0x7DA00808, 0x7B3B0000, 0x7DA00808,
+            0x7B3E8000, 0x7DA00808, 0x7B570000, 0x7DA00808, 0x7B5F8000, 0x7DA00808, 0x7B770000, 0x7DA00808, 0x7BED8000, 0x7DA00808,
+            0x7BF10000, 0x7DA00808, 0x7BF98000, 0x7DA00808, 0x7C9D0000, 0x7DA00808, 0x7CDC0000, 0x7DA00808, 0x7CDF0000, 0x7DA00808,
+            0x7D3A0000, 0x7DA00808, 0x7D658000, 0x7DA00808, 0x7D7C8000, 0x7DA00808, 0x7E398000, 0x7DA00808, 0x7E7C0000, 0x7DA00808,
+            0x7F9B0000, 0x7DA00808, 0x7FA88000, 0x7DA00808, 0x7FC50000, 0x7DA00808, 0x7FDE8000, 0x7DA08808, 0x40008000, 0x7DA08808,
+            0x40060000, 0x7DA08808, 0x40090000, 0x7DA08808, 0x40198000, 0x7DA08808, 0x403F8000, 0x7DA08808, 0x40448000, 0x7DA08808,
+            0x40F18000, 0x7DA08808, 0x40F50000, 0x7DA08808, 0x40F98000, 0x7DA08808, 0x40FE0000, 0x7DA08808, 0x41060000, 0x7DA08808,
+            0x410D8000, 0x7DA08808, 0x410F8000, 0x7DA08808, 0x41370000, 0x7DA08808, 0x41390000, 0x7DA08808, 0x413C0000, 0x7DA08808,
+            0x43268000, 0x7DA08808, 0x43358000, 0x7DA08808, 0x44200000, 0x7DA08808, 0x44260000, 0x7DA08808, 0x44318000, 0x7DA08808,
+            0x44BF0000, 0x7DA08808, 0x44C58000, 0x7DA08808, 0x45000000, 0x7DA08808, 0x461B8000, 0x7DA08808, 0x46230000, 0x7DA08808,
+            0x462A8000, 0x7DA08808, 0x463C0000, 0x7DA08808, 0x464E8000, 0x7DA08808, 0x46B20000, 0x7DA08808, 0x46B80000, 0x7DA08808,
+            0x46D98000, 0x7DA08808, 0x47558000, 0x7DA08808, 0x47650000, 0x7DA08808, 0x47CD8000, 0x7DA08808, 0x47D80000, 0x7DA08808,
+            0x47DA8000, 0x7DA08808, 0x48488000, 0x7DA08808, 0x48A48000, 0x7DA08808, 0x48E30000, 0x7DA08808, 0x48E60000, 0x7DA08808,
+            0x48E88000, 0x7DA08808, 0x4AC00000, 0x7DA08808, 0x4B0E0000, 0x7DA08808, 0x4B5B0000, 0x7DA08808, 0x4B5C8000, 0x7DA08808,
+            0x4B740000, 0x7DA08808, 0x4BA88000, 0x7DA08808, 0x4BAF0000, 0x7DA08808, 0x4BB10000, 0x7DA08808, 0x4BB48000, 0x7DA08808,
+            0x4BE58000, 0x7DA08808, 0x4BF68000, 0x7DA08808, 0x4BF98000, 0x7DA08808, 0x4C008000, 0x7DA08808, 0x4C540000, 0x7DA08808,
+            0x4C6D8000, 0x7DA08808, 0x4CCB0000, 0x7DA08808, 0x4CCC8000, 0x7DA08808, 0x4CD60000, 0x7DA08808, 0x4D540000, 0x7DA08808,
+            0x4D6C0000, 0x7DA08808, 0x4D6F8000, 0x7DA08808, 0x4D928000, 0x7DA08808, 0x4D978000, 0x7DA08808, 0x4D990000, 0x7DA08808,
+            0x4D9E0000, 0x7DA08808, 0x4DAD0000, 0x7DA08808, 0x4E728000, 0x7DA08808, 0x4F3A8000, 0x7DA08808, 0x4F3F8000, 0x7DA08808,
+            0x4F528000, 0x7DA08808, 0x4F5D8000, 0x7DA08808, 0x4F618000, 0x7DA08808, 0x4F668000, 0x7DA08808, 0x4F688000, 0x7DA08808,
+            0x4F7C8000, 0x7DA08808, 0x4F7E8000, 0x7DA08808, 0x4F870000, 0x7DA08808, 0x4F898000, 0x7DA08808, 0x4F900000, 0x7DA08808,
+            0x4F9D8000, 0x7DA08808, 0x4FA50000, 0x7DA08808, 0x4FA90000, 0x7DA08808, 0x4FC68000, 0x7DA08808, 0x4FCE0000, 0x7DA08808,
+            0x4FD00000, 0x0E8D8805, 0x01048807, 0x011B0805, 0x01490805, 0x01E08805, 0x0EA58805, 0x0FAB8804, 0x21730808, 0x217E0808,
+            0x0EA60805, 0x01C50805, 0x010F0805, 0x01918805, 0x0EA70805, 0x00004044, 0x00004084, 0x000040C4, 0x00004104, 0x00004144,
+            0x00004184, 0x010F8805, 0x0FAE0804, 0x0FAE0804, 0x00000DC4, 0x0FAE8804, 0x0FAE8804, 0x00000DC4, 0x0FAF0804, 0x0EA60809,
+            0x0EA78805, 0x7DA00808, 0x69A20000, 0x7DA00808, 0x69A28000, 0x0FAC0804, 0x217C8808, 0x21738808, 0x01E10805, 0x0EA80805,
+            0x216D081A, 0x216D081C, 0x216D881A, 0x216D881C, 0x216E081A, 0x216E081C, 0x216F081A, 0x216F081C, 0x216F881A, 0x216F881C,
+            0x2170081C, 0x00000DC4, 0x2170881C, 0x2170881C, 0x00000DC4, 0x2171081C, 0x2171081C, 0x00000DC4, 0x2171881C, 0x2171881C,
+            0x00000DC4, 0x2172081C, 0x2172081C, 0x00000DC4, 0x2172881C, 0x2172881C, 0x00000DC4, 0x2173081C, 0x2173081C, 0x00000DC4,
+            0x2173881C, 0x2173881C, 0x00000DC4, 0x2174081C, 0x2174081C, 0x00000DC4, 0x2174881C, 0x2174881C, 0x00000DC4, 0x2175081C,
+            0x2175081C, 0x00000DC4, 0x2175881C, 0x2175881C, 0x00000DC4, 0x2176081A, 0x2176081C, 0x2176081C, 0x00000DC4, 0x2176881C,
+            0x2176881C, 0x00000DC4, 0x2177081C, 0x2177081C, 0x00000DC4, 0x2177881C, 0x217A081C, 0x00000DC4, 0x217A081C, 0x00000E04,
+            0x217A881C, 0x217A881C, 0x00000DC4, 0x217A881C, 0x00000E04, 0x217B081C, 0x217B081C, 0x00000DC4, 0x217B081C, 0x00000E04,
+            0x217B881C, 0x217B881C, 0x00000DC4, 0x217B881C, 0x00000E04, 0x217C081C, 0x217C081C, 0x00000DC4, 0x217C081C, 0x00000E04,
+            0x217C881C, 0x217F081A, 0x217F081C, 0x217F881A, 0x217F881C, 0x2180081A, 0x2180081C, 0x2183081A, 0x2183081C, 0x216E081C,
+            0x00000DC4, 0x2170081A, 0x2171881A, 0x00000DC4, 0x00000E04, 0x02618805, 0x0FAF8804, 0x0FAF8804, 0x00000DC4, 0x2180082C,
+            0x2181082C, 0x01100805, 0x216D081E, 0x216D0822, 0x216D881E, 0x216D8822, 0x216E081E, 0x216E0822, 0x216F081E, 0x216F0822,
+            0x216F881E, 0x216F8822, 0x21700822, 0x00000DC4, 0x21708822, 0x21708822, 0x00000DC4, 0x21710822, 0x21710822, 0x00000DC4,
+            0x21718822, 0x21718822, 0x00000DC4, 0x21720822, 0x21720822, 0x00000DC4, 0x21728822, 0x21728822, 0x00000DC4, 0x21730822,
+            0x21730822, 0x00000DC4, 0x21738822, 0x21738822, 0x00000DC4, 0x21740822, 0x21740822, 0x00000DC4, 0x21748822, 0x21748822,
+            0x00000DC4, 0x21750822, 0x21750822, 0x00000DC4, 0x21758822, 0x21758822, 0x00000DC4, 0x2176081E, 0x21760822, 0x21760822,
+            0x00000DC4, 0x21768822, 0x21768822, 0x00000DC4, 0x21770822, 0x21770822, 0x00000DC4, 0x21778822, 0x217A0822, 0x00000DC4,
+            0x217A0822, 0x00000E04, 0x217A8822, 0x217A8822, 0x00000DC4, 0x217A8822, 0x00000E04, 0x217B0822, 0x217B0822, 0x00000DC4,
+            0x217B0822, 0x00000E04, 0x217B8822, 0x217B8822, 0x00000DC4, 0x217B8822, 0x00000E04, 0x217C0822, 0x217C0822, 0x00000DC4,
+            0x217C0822, 0x00000E04, 0x217C8822, 0x217F081E, 0x217F0822, 0x217F881E, 0x217F8822, 0x2180081E, 0x21800822, 0x2183081E,
+            0x21830822, 0x216E0822, 0x00000DC4, 0x2170081E, 0x2171881E, 0x21830822, 0x00000DC4, 0x21838822, 0x00000DC4, 0x21840822,
+            0x00000DC4, 0x21848822, 0x00000DC4, 0x01108805, 0x0FB00804, 0x0FB08804, 0x00000DC4, 0x2172082C, 0x2177082C, 0x22148804,
+            0x22168804, 0x22178804, 0x22198804, 0x221C0804, 0x221F8804, 0x22248804, 0x22260804, 0x22278804, 0x222B8804, 0x222D0804,
+            0x22170804, 0x221B0804, 0x221E0804, 0x222F0804, 0x22260808, 0x22190804, 0x20BA8808, 0x21298808, 0x20BB8808, 0x212A8808,
+            0x20BC0808, 0x212C8808, 0x20C78808, 0x20BD8808, 0x20CB0808, 0x20BF0808, 0x20F98808, 0x20F90808, 0x20C48808, 0x21380808,
+            0x213A8808, 0x213B8808, 0x213E0808, 0x21400808, 0x21410808, 0x20C88808, 0x21430808, 0x21440808, 0x20C90808, 0x20CA8808,
+            0x20CB8808, 0x20CE0808, 0x20CF0808, 0x20D00808, 0x20D38808, 0x20D58808, 0x20DA8808, 0x20DE0808, 0x20E08808, 0x214D0808,
+            0x20E60808, 0x210B0808, 0x210D0808, 0x21118808, 0x21130808, 0x21180808, 0x21198808, 0x0EA90805, 0x7DA00828, 0x67000000,
+            0x7DA00828, 0x67460000, 0x7DA00828, 0x67048000, 0x7DA00828, 0x6B6D8000, 0x7DA00828, 0x67050000, 0x7DA00828, 0x67168000,
+            0x7DA00828, 0x67058000, 0x7DA00828, 0x7A990000, 0x7DA00828, 0x672C8000, 0x7DA00828, 0x670C8000, 0x7DA00828, 0x67008000,
+            0x7DA00828, 0x6C948000, 0x7DA00828, 0x6B980000, 0x7DA00828, 0x675D0000, 0x22148808, 0x00004648, 0x22218808, 0x00004648,
+            0x221C8808, 0x00004648, 0x221A0808, 0x00004648, 0x22270804, 0x22270808, 0x00004648, 0x22258804, 0x22250808, 0x00004648,
+            0x222E0808, 0x00004688, 0x22248808, 0x00004648, 0x222D8808, 0x00004648, 0x222E0808, 0x00004648, 0x22160804, 0x221B8804,
+            0x22278808, 0x00004648, 0x22288808, 0x00004648, 0x222C0804, 0x222B0804, 0x222D882C, 0x0000466C, 0x22150832, 0x22180832,
+            0x221A8832, 0x221C0832, 0x22230804, 0x221A0832, 0x221E8804, 0x222F8804, 0x0E938805, 0x2171081E, 0x2173081E, 0x2177081E,
+            0x2178881E, 0x217A081E, 0x217D881E, 0x2180881E, 0x01940809, 0x20BA8808, 0x01948809, 0x01940809, 0x20BB8808, 0x01948809,
+            0x01940809, 0x20BC0808, 0x01948809, 0x01940809, 0x20BD0808, 0x01948809, 0x01940809, 0x20BD8808, 0x01948809, 0x01940809,
+            0x20BE0808, 0x01948809, 0x01940809, 0x20BF0808, 0x01948809, 0x01940809, 0x20C00808, 0x01948809, 0x01940809, 0x20C08808,
+            0x01948809, 0x01940809, 0x20C18808, 0x01948809, 0x01940809, 0x20C20808, 0x01948809, 0x01940809, 0x20C28808, 0x01948809,
+            0x01940809, 0x20C30808, 0x01948809, 0x01940809, 0x20C38808, 0x01948809, 0x01940809, 0x20BA8808, 0x20F98808, 0x01948809,
+            0x01940809, 0x20BB8808, 0x20F98808, 0x01948809, 0x01940809, 0x20BC0808, 0x20F98808, 0x01948809, 0x01940809, 0x20BD0808,
+            0x20F98808, 0x01948809, 0x01940809, 0x20BD8808, 0x20F98808, 0x01948809, 0x01940809, 0x20BE0808, 0x20F98808, 0x01948809,
+            0x01940809, 0x20BF0808, 0x20F98808, 0x01948809, 0x01940809, 0x20C00808, 0x20F98808, 0x01948809, 0x01940809, 0x20C08808,
+            0x20F98808, 0x01948809, 0x01940809, 0x20C18808, 0x20F98808, 0x01948809, 0x01940809, 0x20C20808, 0x20F98808, 0x01948809,
+            0x01940809, 0x20C28808, 0x20F98808, 0x01948809, 0x01940809, 0x20C30808, 0x20F98808, 0x01948809, 0x01940809, 0x20C38808,
+            0x20F98808, 0x01948809, 0x01940809, 0x20C08808, 0x21000808, 0x01948809, 0x01940809, 0x20C00808, 0x20FD8808, 0x20C08808,
+            0x20FB8808, 0x212A0808, 0x01948809, 0x01940809, 0x20C00808, 0x20FD8808, 0x20C38808, 0x21000808, 0x01948809, 0x01940809,
+            0x7DA00808, 0x67000000, 0x01948809, 0x01940809, 0x7DA00808, 0x67460000, 0x01948809, 0x01940809, 0x7DA00808, 0x67048000,
+            0x01948809, 0x01940809, 0x7DA00808, 0x6B6D8000, 0x01948809, 0x01940809, 0x7DA00808, 0x674A0000, 0x01948809, 0x01940809,
+            0x7DA00808, 0x68B68000, 0x01948809, 0x01940809, 0x7DA00808, 0x67018000, 0x01948809, 0x01940809, 0x7DA00808, 0x68B58000,
+            0x01948809, 0x01940809, 0x7DA00808, 0x672E8000, 0x01948809, 0x01940809, 0x7DA00808, 0x69A08000, 0x01948809, 0x01940809,
+            0x7DA00808, 0x73840000, 0x01948809, 0x01940809, 0x7DA00808, 0x78358000, 0x01948809, 0x01940809, 0x7DA00808, 0x761A0000,
+            0x01948809, 0x01940809, 0x7DA00808, 0x73940000, 0x01948809, 0x01940809, 0x7DA08808, 0x48E88000, 0x01948809, 0x01940809,
+            0x7DA00808, 0x6B8F8000, 0x01948809, 0x01940809, 0x7DA00808, 0x72F28000, 0x01948809, 0x01940809, 0x7DA00808, 0x74150000,
+            0x01948809, 0x01940809, 0x7DA00808, 0x73848000, 0x01948809, 0x01940809, 0x7DA00808, 0x7C9F0000, 0x01948809, 0x01940809,
+            0x7DA00808, 0x6A068000, 0x01948809, 0x01940809, 0x7DA00808, 0x793C8000, 0x01948809, 0x01940809, 0x7DA08808, 0x46508000,
+            0x01948809, 0x01940809, 0x7DA00808, 0x7CAE8000, 0x01948809, 0x01940809, 0x7DA00808, 0x695A0000, 0x01948809, 0x01940809,
+            0x7DA00808, 0x67718000, 0x01948809, 0x01940809, 0x7DA00808, 0x6A3E0000, 0x01948809, 0x01940809, 0x7DA00808, 0x6DB30000,
+            0x01948809, 0x01940809, 0x7DA00808, 0x7B718000, 0x01948809, 0x01940809, 0x7DA00808, 0x67808000, 0x01948809, 0x01940809,
+            0x7DA08808, 0x46638000, 0x01948809, 0x01940809, 0x7DA00808, 0x69AA0000, 0x01948809, 0x01940809, 0x7DA00808, 0x7CB68000,
+            0x01948809, 0x01940809, 0x7DA00808, 0x67888000, 0x01948809, 0x01940809, 0x7DA08808, 0x40F50000, 0x01948809, 0x01940809,
+            0x7DA08808, 0x40F98000, 0x01948809, 0x7DA0080C, 0x6AA78000, 0x7DA0080C, 0x6F3E0000, 0x7DA0080C, 0x72C38000, 0x7DA0080C,
+            0x7DC78000, 0x0FCD880C, 0x0FCC080C, 0x0FCE080C, 0x0FCC080C, 0x0FCE880C, 0x0FCC080C, 0x0FCF080C, 0x0FCC080C, 0x0FCF880C,
+            0x0FCC080C, 0x0FD0080C, 0x0FCC080C, 0x10B5883A, 0x10FB883A, 0x1003883A, 0x0FCD080C, 0x0FCC880C, 0x0FCD080C, 0x0FCD080C,
+            0x0FCD080C, 0x0FCD880C, 0x0FCD080C, 0x0FCE080C, 0x0FCD080C, 0x0FCE880C, 0x0FCD080C, 0x0FCF080C, 0x0FCD080C, 0x0FCF880C,
+            0x0FCD080C, 0x0FD0080C, 0x0FCD080C, 0x0FD0880C, 0x0FCD880C, 0x0FCC880C, 0x0FCD880C, 0x0FCD080C, 0x0FCD880C, 0x0FCD880C,
+            0x0FCD880C, 0x0FCE080C, 0x0FCD880C, 0x0FCE880C, 0x20BA880C, 0x20BB880C, 0x20BD080C, 0x20BF080C, 0x20C0080C, 0x20C1880C,
+            0x20BA880C, 0x20F9880C, 0x20BB880C, 0x20F9880C, 0x20BC080C, 0x20F9880C, 0x20BD080C, 0x20F9880C, 0x20BD880C, 0x20F9880C,
+            0x20BE080C, 0x20F9880C, 0x20BF080C, 0x20F9880C, 0x20C0080C, 0x20F9880C, 0x20C0880C, 0x20F9880C, 0x20C1880C, 0x20F9880C,
+            0x20C2080C, 0x20F9880C, 0x20C2880C, 0x20F9880C, 0x20C3080C, 0x20F9880C, 0x20C3880C, 0x20F9880C, 0x20C1880C, 0x20F9880C,
+            0x2130080C, 0x20BA880C, 0x20FD880C, 0x20C0880C, 0x2100080C, 0x20C0080C, 0x2103080C, 0x20C0080C, 0x2100080C, 0x0EAA0805,
+            0x7DA0080C, 0x67000000, 0x7DA0080C, 0x67460000, 0x7DA0080C, 0x67048000, 0x7DA0080C, 0x6B6D8000, 0x7DA0080C, 0x674A0000,
+            0x7DA0080C, 0x68B68000, 0x7DA0080C, 0x67018000, 0x7DA0080C, 0x68B58000, 0x7DA0080C, 0x672E8000, 0x7DA0080C, 0x69A08000,
+            0x7DA0080C, 0x73840000, 0x7DA0080C, 0x78358000, 0x7DA0080C, 0x761A0000, 0x7DA0080C, 0x73940000, 0x7DA0880C, 0x48E88000,
+            0x7DA0080C, 0x6B8F8000, 0x7DA0080C, 0x72F28000, 0x7DA0080C, 0x74150000, 0x7DA0080C, 0x73848000, 0x7DA0080C, 0x7C9F0000,
+            0x7DA0080C, 0x6A068000, 0x7DA0080C, 0x793C8000, 0x7DA0880C, 0x46508000, 0x7DA0080C, 0x7CAE8000, 0x7DA0080C, 0x695A0000,
+            0x7DA0080C, 0x7CEC0000, 0x7DA0080C, 0x7A9B8000, 0x7DA0080C, 0x6CB98000, 0x7DA0880C, 0x48348000, 0x7DA0080C, 0x68950000,
+            0x7DA0080C, 0x69B80000, 0x7DA0080C, 0x76740000, 0x7DA0880C, 0x4C028000, 0x7DA0080C, 0x67888000, 0x7DA0080C, 0x68CC8000,
+            0x7DA0080C, 0x75B18000, 0x7DA0080C, 0x67050000, 0x7DA0080C, 0x67168000, 0x7DA0080C, 0x67058000, 0x7DA0080C, 0x6EF30000,
+            0x7DA0080C, 0x69F98000, 0x7DA0080C, 0x699D8000, 0x7DA0080C, 0x6DCB8000, 0x7DA0080C, 0x6DB30000, 0x7DA0080C, 0x7B718000,
+            0x7DA0080C, 0x67808000, 0x7DA0880C, 0x46638000, 0x7DA0080C, 0x69AA0000, 0x7DA0080C, 0x6C8E0000, 0x0FCD880C, 0x0FCF080C,
+            0x0FCD880C, 0x0FCF880C, 0x0FCD880C, 0x0FD0080C, 0x0FCD880C, 0x0FD0880C, 0x0FCE080C, 0x0FCC880C, 0x0FCE080C, 0x0FCD080C,
+            0x0FCE080C, 0x0FCD880C, 0x0FCE080C, 0x0FCE080C, 0x0FCE080C, 0x0FCE880C, 0x0FCE080C, 0x0FCF080C, 0x0FCE080C, 0x0FCF880C,
+            0x0FCE080C, 0x0FD0080C, 0x0FCE080C, 0x0FD0880C, 0x0FCC8808, 0x7DA00808, 0x73840000, 0x0FCD0808, 0x7DA00808, 0x73840000,
+            0x0FCD8808, 0x7DA00808, 0x73840000, 0x0FCE0808, 0x7DA00808, 0x73840000, 0x0FCE8808, 0x7DA00808, 0x73840000, 0x0FCF0808,
+            0x7DA00808, 0x73840000, 0x0FCF8808, 0x7DA00808, 0x73840000, 0x0FD00808, 0x7DA00808, 0x73840000, 0x0FD08808, 0x7DA00808,
+            0x73840000, 0x0FCC8808, 0x0FCC0808, 0x7DA00808, 0x73840000, 0x0FCC8808, 0x0FCC8808, 0x7DA00808, 0x73840000, 0x0FCC8808,
+            0x0FCD0808, 0x7DA00808, 0x73840000, 0x103A883A, 0x10288838, 0x10038838, 0x10C98838, 0x10288838, 0x10038838, 0x1123883A,
+            0x106B083A, 0x10FB883A, 0x0FF5883A, 0x216D0826, 0x216F0826, 0x7DA00838, 0x67720000, 0x7DA00838, 0x6A460000, 0x216D0838,
+            0x217A0838, 0x00000E38, 0x0FB00838, 0x21770838, 0x216D0838, 0x21818838, 0x217B0838, 0x216D0838, 0x216D0838, 0x21850838,
+            0x217B8838, 0x00000E38, 0x216D0838, 0x216D0838, 0x0FB00838, 0x21818838, 0x216D8838, 0x21780838, 0x21850838, 0x21710838,
+            0x00000DF8, 0x216D8838, 0x21850838, 0x21758838, 0x216E0838, 0x216F8838, 0x21850838, 0x216F0838, 0x21738838, 0x21710838,
+            0x0FB00838, 0x21770838, 0x00000DF8, 0x216F0838, 0x0FB00838, 0x21700838, 0x0FB00838, 0x216F8838, 0x21850838, 0x21738838,
+            0x216F8838, 0x0FB00838, 0x217D8838, 0x21700838, 0x216D8838, 0x21810838, 0x21700838, 0x21808838, 0x21760838, 0x21770838,
+            0x21700838, 0x21828838, 0x21810838, 0x0FB00838, 0x21700838, 0x00000DF8, 0x21828838, 0x21850838, 0x21700838, 0x00000DF8,
+            0x21850838, 0x217C8838, 0x21708838, 0x00000DF8, 0x21700838, 0x00000DF8, 0x21708838, 0x00000DF8, 0x21780838, 0x0FB00838,
+            0x21708838, 0x217F8838, 0x21810838, 0x0FB00838, 0x21708838, 0x00000DF8, 0x21818838, 0x21750838, 0x00000DF8, 0x0FB00838,
+            0x21708838, 0x21828838, 0x21708838, 0x21828838, 0x21710838, 0x00000DF8, 0x21808838, 0x217D8838, 0x21708838, 0x21828838,
+            0x217E0838, 0x0FB00838, 0x21770838, 0x21818838, 0x21708838, 0x21828838, 0x21830838, 0x21760838, 0x21770838, 0x21710838,
+            0x00000DF8, 0x21808838, 0x217D8838, 0x21710838, 0x00000DF8, 0x21808838, 0x217D8838, 0x21770838, 0x21850838, 0x21710838,
+            0x21818838, 0x21740838, 0x00000DF8, 0x216D8838, 0x21828838, 0x21710838, 0x21828838, 0x0FB00838, 0x21790838, 0x21718838,
+            0x0FB00838, 0x21738838, 0x21720838, 0x21818838, 0x21778838, 0x21720838, 0x0FB00838, 0x217C0838, 0x00000E38, 0x21728838,
+            0x216D8838, 0x21710838, 0x21818838, 0x21728838, 0x21850838, 0x21758838, 0x0FB00838, 0x217D8838, 0x21730838, 0x21810838,
+            0x21850838, 0x21710838, 0x00000DF8, 0x21740838, 0x21850838, 0x21758838, 0x21740838, 0x21850838, 0x21770838, 0x21750838,
+            0x00000DF8, 0x0FB00838, 0x21738838, 0x21768838, 0x00000DF8, 0x21730838, 0x21770838, 0x00000DF8, 0x21818838, 0x21770838,
+            0x21850838, 0x21778838, 0x21798838, 0x21798838, 0x21760838, 0x21770838, 0x217A0838, 0x216D8838, 0x21760838, 0x217A0838,
+            0x00000E38, 0x0FB00838, 0x21740838, 0x21850838, 0x21770838, 0x217A0838, 0x00000E38, 0x0FB00838, 0x21760838, 0x217A0838,
+            0x00000DF8, 0x0FB00838, 0x21820838, 0x21818838, 0x217A8838, 0x00000E38, 0x216D0838, 0x21738838, 0x21770838, 0x21818838,
+            0x217A8838, 0x00000E38, 0x21710838, 0x21818838, 0x217A8838, 0x00000E38, 0x21720838, 0x217A8838, 0x00000DF8, 0x21818838,
+            0x217B0838, 0x216D0838, 0x21808838, 0x21760838, 0x21770838, 0x00000DF8, 0x217B0838, 0x216D8838, 0x0FB00838, 0x21770838,
+            0x217B0838, 0x00000DF8, 0x21760838, 0x21730838, 0x216F0838, 0x21818838, 0x217B0838, 0x21808838, 0x21850838, 0x217B8838,
+            0x21710838, 0x21750838, 0x0FB00838, 0x21818838, 0x217B8838, 0x00000E38, 0x21748838, 0x217B8838, 0x00000E38, 0x21780838,
+            0x217A8838, 0x217B8838, 0x21818838, 0x21760838, 0x217B8838, 0x00000E38, 0x21850838, 0x21738838, 0x217B8838, 0x00000E38,
+            0x0FB00838, 0x21730838, 0x00000DF8, 0x217B8838, 0x00000DF8, 0x0FB00838, 0x21750838, 0x217C0838, 0x00000E38, 0x216D8838,
+            0x21850838, 0x21770838, 0x217C0838, 0x00000DF8, 0x21818838, 0x21770838, 0x217C0838, 0x21850838, 0x217C0838, 0x00000E38,
+            0x21850838, 0x21770838, 0x00000DF8, 0x217C0838, 0x0FB00838, 0x21818838, 0x217C0838, 0x0FB00838, 0x21850838, 0x217C8838,
+            0x216D8838, 0x21710838, 0x21828838, 0x217C8838, 0x216D8838, 0x21818838, 0x217C8838, 0x21760838, 0x217A0838, 0x217C8838,
+            0x21818838, 0x21710838, 0x217C8838, 0x21850838, 0x21730838, 0x21800838, 0x21850838, 0x217D0838, 0x21710838, 0x21828838,
+            0x21850838, 0x217D0838, 0x21810838, 0x217D0838, 0x21810838, 0x217A0838, 0x00000DF8, 0x0FB00838, 0x21818838, 0x217E0838,
+            0x21700838, 0x00000DF8, 0x217E0838, 0x21700838, 0x00000DF8, 0x21770838, 0x21850838, 0x217E0838, 0x0FB00838, 0x21770838,
+            0x21818838, 0x217F0838, 0x0FB00838, 0x21770838, 0x00000DF8, 0x217F0838, 0x0FB00838, 0x21818838, 0x217F8838, 0x216D0838,
+            0x21850838, 0x21810838, 0x21760838, 0x21770838, 0x21818838, 0x21810838, 0x21808838, 0x21818838, 0x217A8838, 0x00000E38,
+            0x0FB00838, 0x21818838, 0x0FB00838, 0x217B0838, 0x00000DF8, 0x21818838, 0x21820838, 0x217D8838, 0x21820838, 0x21850838,
+            0x21770838, 0x21718838, 0x00000DF8, 0x21850838, 0x21830838, 0x21760838, 0x21770838, 0x0FCC0808, 0x7DA00808, 0x785C8000,
+            0x0FCC8808, 0x7DA00808, 0x785C8000, 0x0FCD0808, 0x7DA00808, 0x785C8000, 0x0FCD8808, 0x7DA00808, 0x785C8000, 0x0FCE0808,
+            0x7DA00808, 0x785C8000, 0x0FCE8808, 0x7DA00808, 0x785C8000, 0x0FCF0808, 0x7DA00808, 0x785C8000, 0x0FCF8808, 0x7DA00808,
+            0x785C8000, 0x0FD00808, 0x7DA00808, 0x785C8000, 0x0FD08808, 0x7DA00808, 0x785C8000, 0x0FCC8808, 0x0FCC0808, 0x7DA00808,
+            0x785C8000, 0x0FCC8808, 0x0FCC8808, 0x7DA00808, 0x785C8000, 0x0FCC8808, 0x0FCD0808, 0x7DA00808, 0x785C8000, 0x0FCC8808,
+            0x0FCD8808, 0x7DA00808, 0x785C8000, 0x0FCC8808, 0x0FCE0808, 0x7DA00808, 0x785C8000, 0x0FCC8808, 0x0FCE8808, 0x7DA00808,
+            0x785C8000, 0x0FCC8808, 0x0FCF0808, 0x7DA00808, 0x785C8000, 0x0FCC8808, 0x0FCF8808, 0x7DA00808, 0x785C8000, 0x0FCC8808,
+            0x0FD00808, 0x7DA00808, 0x785C8000, 0x0FCC8808, 0x0FD08808, 0x7DA00808, 0x785C8000, 0x0FCD0808, 0x0FCC0808, 0x7DA00808,
+            0x785C8000, 0x0FCD0808, 0x0FCC8808, 0x7DA00808, 0x785C8000, 0x0FCD0808, 0x0FCD0808, 0x7DA00808, 0x785C8000, 0x0FCD0808,
+            0x0FCD8808, 0x7DA00808, 0x785C8000, 0x0FCD0808, 0x0FCE0808, 0x7DA00808, 0x785C8000, 0x103A8838, 0x10B5883A, 0x0FD10838,
+            0x0FF58838, 0x0FD10838, 0x0FD1083A, 0x110B883A, 0x0FDE0838, 0x0FD10838, 0x10C98838, 0x109E0838, 0x1123883A, 0x10B58838,
+            0x0FEB0838, 0x0FF58838, 0x10848838, 0x0FF58838, 0x10848838, 0x0FCD0838, 0x0FF58838, 0x10848838, 0x0FCD8838, 0x1048083A,
+            0x110B883A, 0x7DA00838, 0x6F398000, 0x7DA00838, 0x71080000, 0x7DA00838, 0x73168000, 0x7DA00838, 0x6A460000, 0x7DA00838,
+            0x6C938000, 0x7DA00838, 0x75B18000, 0x7DA00838, 0x73070000, 0x7DA00838, 0x765D8000, 0x7DA00838, 0x74150000, 0x7DA00838,
+            0x6F878000, 0x7DA00838, 0x678D0000, 0x7DA00838, 0x7C9F0000, 0x10B58838, 0x0FD1083A, 0x108C0838, 0x0FD1083A, 0x11980838,
+            0x0FD1083A, 0x10848838, 0x0FD1083A, 0x10620838, 0x0FD1083A, 0x1062083A, 0x0FDE083A, 0x1084883A, 0x0FDE083A, 0x1028883A,
+            0x0FDE083A, 0x0FEB0838, 0x0FD10838, 0x106B0838, 0x10620838, 0x0FEB0838, 0x0FD10838, 0x106B0838, 0x10B58838, 0x1021083A,
+            0x108C0838, 0x1021083A, 0x11980838, 0x1021083A, 0x11980838, 0x10288838, 0x10848838, 0x10288838, 0x10620838, 0x10288838,
+            0x103A883A, 0x11430838, 0x10620838, 0x103A883A, 0x11430838, 0x1084883A, 0x103A883A, 0x11430838, 0x1028883A, 0x103A883A,
+            0x11430838, 0x10FB883A, 0x103A883A, 0x11430838, 0x11980838, 0x106B0838, 0x10848838, 0x106B0838, 0x0FF58838, 0x106B0838,
+            0x10620838, 0x106B0838, 0x10210838, 0x10848838, 0x108C0838, 0x10848838, 0x11980838, 0x10848838, 0x10848838, 0x10848838,
+            0x0FEB0838, 0x10848838, 0x10620838, 0x10848838, 0x10848838, 0x10848838, 0x0FCD0838, 0x0FEB0838, 0x10848838, 0x0FCD0838,
+            0x10848838, 0x0FCD0838, 0x10620838, 0x10848838, 0x0FCD0838, 0x10848838, 0x10848838, 0x0FCD8838, 0x0FEB0838, 0x10848838,
+            0x0FCD8838, 0x10848838, 0x0FCD8838, 0x10620838, 0x10848838, 0x0FCD8838, 0x10848838, 0x033A8839, 0x10E90838, 0x10848838,
+            0x033A8839, 0x10E90838, 0x0FCD0838, 0x10B5883A, 0x0FD10838, 0x10620838, 0x10B5883A, 0x0FD10838, 0x1084883A, 0x10B5883A,
+            0x0FD10838, 0x1028883A, 0x10B5883A, 0x0FD10838, 0x10C98838, 0x0FD10838, 0x0FF58838, 0x10C98838, 0x0FD10838, 0x0FF58838,
+            0x033A8839, 0x10E90838, 0x10C98838, 0x0FD10838, 0x0FF58838, 0x033A8839, 0x10E90838, 0x0FCD0838, 0x10B58838, 0x10E90838,
+            0x108C0838, 0x10E90838, 0x11980838, 0x10E90838, 0x10848838, 0x10E90838, 0x10B58838, 0x1123883A, 0x108C0838, 0x1123883A,
+            0x11980838, 0x1123883A, 0x10848838, 0x1123883A, 0x10620838, 0x1123883A, 0x1084883A, 0x1123883A, 0x10B58838, 0x112C883A,
+            0x108C0838, 0x112C883A, 0x11980838, 0x112C883A, 0x10848838, 0x112C883A, 0x10620838, 0x112C883A, 0x1084883A, 0x112C883A,
+            0x10620838, 0x11A3083A, 0x1084883A, 0x11A3083A, 0x0FD10838, 0x013F0839, 0x10848838, 0x013F0839, 0x0FDE083A, 0x10C00838,
+            0x0FEB0838, 0x0FEB0838, 0x0FEB0838, 0x0FF58838, 0x0FEB083A, 0x033A8839, 0x10620838, 0x10288838, 0x0FEB083A, 0x109E0838,
+            0x013F0839, 0x0FF58838, 0x0FDE083A, 0x1028883A, 0x11380838, 0x103A8838, 0x0FD10838, 0x103A883A, 0x10B5883A, 0x10480838,
+            0x108C0838, 0x1062083A, 0x1062083A, 0x1062083A, 0x1084883A, 0x10620838, 0x10FB8838, 0x106B0838, 0x10848838, 0x106B0838,
+            0x108C0838, 0x106B0838, 0x109E0838, 0x10288838, 0x106B0838, 0x11320838, 0x10848838, 0x0FDE0838, 0x10848838, 0x10480838,
+            0x106B0838, 0x10848838, 0x109E0838, 0x106B0838, 0x10B5883A, 0x103A883A, 0x10B58838, 0x013F0839, 0x10848838, 0x013F0839,
+            0x10B5883A, 0x10B5883A, 0x1084883A, 0x10B5883A, 0x10C9883A, 0x10E90838, 0x10C98838, 0x10E9083A, 0x11238838, 0x112C883A,
+            0x0FDE0838, 0x1123883A, 0x033A8839, 0x10848838, 0x0FD1083A, 0x033A8839, 0x10848838, 0x0FCC8808, 0x7DA00808, 0x72F28000,
+            0x0FCD0808, 0x7DA00808, 0x72F28000, 0x0FCD8808, 0x7DA00808, 0x72F28000, 0x0FCE0808, 0x7DA00808, 0x72F28000, 0x0FCE8808,
+            0x7DA00808, 0x72F28000, 0x0FCF0808, 0x7DA00808, 0x72F28000, 0x0FCF8808, 0x7DA00808, 0x72F28000, 0x0FD00808, 0x7DA00808,
+            0x72F28000, 0x0FD08808, 0x7DA00808, 0x72F28000, 0x0FCC8808, 0x0FCC0808, 0x7DA00808, 0x72F28000, 0x0FCC8808, 0x0FCC8808,
+            0x7DA00808, 0x72F28000, 0x0FCC8808, 0x0FCD0808, 0x7DA00808, 0x72F28000, 0x0FCC8808, 0x0FCD8808, 0x7DA00808, 0x72F28000,
+            0x0FCC8808, 0x0FCE0808, 0x7DA00808, 0x72F28000, 0x0FCC8808, 0x0FCE8808, 0x7DA00808, 0x72F28000, 0x0FCC8808, 0x0FCF0808,
+            0x7DA00808, 0x72F28000, 0x0FCC8808, 0x0FCF8808, 0x7DA00808, 0x72F28000, 0x0FCC8808, 0x0FD00808, 0x7DA00808, 0x72F28000,
+            0x0FCC8808, 0x0FD08808, 0x7DA00808, 0x72F28000, 0x0FCD0808, 0x0FCC0808, 0x7DA00808, 0x72F28000, 0x0FCD0808, 0x0FCC8808,
+            0x7DA00808, 0x72F28000, 0x0FCD0808, 0x0FCD0808, 0x7DA00808, 0x72F28000, 0x0FCD0808, 0x0FCD8808, 0x7DA00808, 0x72F28000,
+            0x0FCD0808, 0x0FCE0808, 0x7DA00808, 0x72F28000, 0x0FCD0808, 0x0FCE8808, 0x7DA00808, 0x72F28000, 0x0FCD0808, 0x0FCF0808,
+            0x7DA00808, 0x72F28000, 0x0FCD0808, 0x0FCF8808, 0x7DA00808, 0x72F28000, 0x0FCD0808, 0x0FD00808, 0x7DA00808, 0x72F28000,
+            0x0FCD0808, 0x0FD08808, 0x7DA00808, 0x72F28000, 0x0FCD8808, 0x0FCC0808, 0x7DA00808, 0x72F28000, 0x0FCD8808, 0x0FCC8808,
+            0x7DA00808, 0x72F28000, 0x10288838, 0x0FD10838, 0x106B0838, 0x07FB0805, 0x22308804, 0x22B08804, 0x23308804, 0x23B08804,
+            0x24308804, 0x08468805, 0x247A0804, 0x24880804, 0x24870804, 0x24888804, 0x24878804, 0x24898804, 0x24770804, 0x24798804,
+            0x24790804, 0x01190805, 0x01460805, 0x1E5C8804, 0x1EDC8804, 0x01198805, 0x01468805, 0x013B8805, 0x1E888808, 0x1E918808,
+            0x1EA00808, 0x1E628808, 0x1EE20808, 0x1E6B8808, 0x1EE20808, 0x1E760808, 0x1EE20808, 0x1E800808, 0x1EE28808, 0x1E858808,
+            0x1EE20808, 0x1E888808, 0x1EE28808, 0x1E898808, 0x1EE28808, 0x1E8C8808, 0x1EE20808, 0x1E9F0808, 0x1EE20808, 0x1EB68808,
+            0x1EE20808, 0x1EC20808, 0x1EE20808, 0x1EC50808, 0x1EE28808, 0x1EC88808, 0x1EE20808, 0x1E938808, 0x1EC50808, 0x11EA8810,
+            0x11EA8804, 0x11EC0810, 0x11EC0804, 0x11EE8810, 0x11EE8804, 0x11F88810, 0x11F88804, 0x11FD0810, 0x11FD0804, 0x12470810,
+            0x12470804, 0x125A8810, 0x125A8804, 0x12788810, 0x12788804, 0x127C0810, 0x127C0804, 0x12848810, 0x12848804, 0x12890810,
+            0x12890804, 0x12898810, 0x12898804, 0x12908810, 0x12908804, 0x12930810, 0x12930804, 0x12958810, 0x12958804, 0x12A00810,
+            0x12A00804, 0x12610810, 0x12610804, 0x11DC8810, 0x11DC8804, 0x12128810, 0x12128804, 0x12180810, 0x12180804, 0x12260814,
+            0x00001444, 0x01D28805, 0x11E18808, 0x11F28808, 0x11F68808, 0x00000AC8, 0x12410808, 0x127C8808, 0x127E8808, 0x12568808,
+            0x01F18805, 0x12798804, 0x11DA0810, 0x11DA0804, 0x11F20810, 0x11F20804, 0x11E60810, 0x11E60804, 0x126D8810, 0x126D8804,
+            0x11F10810, 0x11F10804, 0x123E8810, 0x123E8804, 0x123B8810, 0x123B8804, 0x12618810, 0x12618804, 0x12640810, 0x12640804,
+            0x12670810, 0x12670804, 0x12560810, 0x12560804, 0x12760810, 0x12760804, 0x127A0828, 0x127E8828, 0x12498808, 0x128C8808,
+            0x1EE30804, 0x00002D84, 0x00002DC4, 0x01700805, 0x01470805, 0x01330805, 0x011A0805, 0x011F0805, 0x013C0805, 0x02820805,
+            0x11730810, 0x11730804, 0x11788810, 0x11788804, 0x10448810, 0x10448804, 0x10FB8814, 0x11430808, 0x10FB8808, 0x11430808,
+            0x11658810, 0x11658804, 0x11660810, 0x11660804, 0x11668810, 0x11668804, 0x10230804, 0x10EB0804, 0x0FD10814, 0x0FD10814,
+            0x0FD10808, 0x0FD10808, 0x0FD10814, 0x109E0814, 0x0FD10814, 0x110B8814, 0x0FD10808, 0x110B8808, 0x0FD10814, 0x11238814,
+            0x0FD10814, 0x00004608, 0x11238814, 0x0FD10808, 0x00004608, 0x11238808, 0x0FD10814, 0x11380814, 0x0FD10808, 0x11380808,
+            0x0FF50810, 0x0FF50804, 0x10678810, 0x10678804, 0x10680810, 0x10680804, 0x10688810, 0x10688804, 0x106F0810, 0x106F0804,
+            0x10700810, 0x10700804, 0x10B00810, 0x10B00804, 0x10AC0810, 0x10AC0804, 0x109E0814, 0x109E0814, 0x109E0808, 0x109E0808,
+            0x10B88810, 0x10B88804, 0x10BC0810, 0x10BC0804, 0x10BC8810, 0x10BC8804, 0x10C28810, 0x10C28804, 0x10C30810, 0x10C30804,
+            0x10CE8810, 0x10CE8804, 0x10E88810, 0x10E88804, 0x11260810, 0x11260804, 0x11238814, 0x11380814, 0x11238808, 0x11380808,
+            0x11510810, 0x11510804, 0x115C8810, 0x115C8804, 0x115D0810, 0x115D0804, 0x115F8810, 0x115F8804, 0x11618810, 0x11618804,
+            0x11620810, 0x11620804, 0x11628810, 0x11628804, 0x11628828, 0x10028804, 0x107D8804, 0x108B8804, 0x109B0804, 0x10E78804,
+            0x11090804, 0x11630804, 0x0FF58814, 0x00004648, 0x10210814, 0x00004648, 0x10210808, 0x00004648, 0x10288814, 0x00004648,
+            0x10360810, 0x10360804, 0x10800810, 0x10800804, 0x10C98814, 0x00004648, 0x10C98808, 0x00004648, 0x10E90814, 0x00004648,
+            0x10FB8814, 0x00004648, 0x10FB8808, 0x00004648, 0x02930805, 0x11738810, 0x11738804, 0x11160810, 0x107B0804, 0x11740804,
+            0x10958810, 0x10958804, 0x0FEF8810, 0x0FEF8804, 0x10408804, 0x0FE58810, 0x0FE58804, 0x10240810, 0x10240804, 0x0FD10814,
+            0x00000AC8, 0x109E0814, 0x00000AC8, 0x110B8814, 0x00000AC8, 0x10288814, 0x00000D48, 0x10288808, 0x00000D48, 0x10620814,
+            0x00000D48, 0x10620808, 0x00000D48, 0x108C0814, 0x00000D48, 0x108C0808, 0x00000D48, 0x10C98814, 0x00000D48, 0x10C98808,
+            0x00000D48, 0x10E90814, 0x00000D48, 0x10E90808, 0x00000D48, 0x10410810, 0x10160810, 0x102A8810, 0x10760810, 0x104C0810,
+            0x10C20804, 0x10690810, 0x11098810, 0x105C0810, 0x11368810, 0x0FEA8810, 0x0FEA8804, 0x10B28810, 0x10B28804, 0x11138810,
+            0x11138804, 0x0FD48810, 0x0FD48804, 0x10528810, 0x10528804, 0x11158810, 0x11158804, 0x112F0810, 0x112F0804, 0x0FF00810,
+            0x10ED0810, 0x11480810, 0x0FF88810, 0x0FF88804, 0x10EB8810, 0x10EB8804, 0x10440810, 0x10440804, 0x104E8804, 0x103A8828,
+            0x00000E68, 0x109E0828, 0x00004628, 0x10038828, 0x111E0804, 0x10280804, 0x10BD0804, 0x108A8804, 0x104E0804, 0x108B0804,
+            0x166E0804, 0x16720804, 0x16740804, 0x02B60805, 0x16718804, 0x0EB10805, 0x02B80805, 0x0FB78804, 0x02B90805, 0x1A100804,
+            0x1A160804, 0x1A1C8804, 0x1A1F8804, 0x1A210804, 0x1A228804, 0x1A248804, 0x1A270804, 0x1A250804, 0x1A290804, 0x1A1C0804,
+            0x1A1E8804, 0x1A140804, 0x1A1F0804, 0x1A220804, 0x1A238804, 0x1A200804, 0x1A298804, 0x022A0805, 0x014E0805, 0x16820804,
+            0x014C0805, 0x15108804, 0x15108808, 0x02008805, 0x15110804, 0x02020805, 0x14EC0804, 0x14F70804, 0x151B8804, 0x1AA58804,
+            0x00003904, 0x00003944, 0x00003984, 0x022D0805, 0x01500805, 0x1A938804, 0x01708805, 0x20EA0804, 0x00003284, 0x1BFE0804,
+            0x1C120804, 0x1C120808, 0x1C130804, 0x1C160804, 0x1C160808, 0x1C170804, 0x1C198804, 0x1C168804, 0x1C190804, 0x1C118804,
+            0x1C128804, 0x1C1A8804, 0x016B0805, 0x01310805, 0x01558805, 0x016E0805, 0x0FA68804, 0x022D8805, 0x1ABA8804, 0x1ABE8804,
+            0x1AC38804, 0x1ACE8804, 0x1ADB0804, 0x1B000804, 0x0FA70804, 0x1AC78804, 0x1AD88804, 0x1AB98804, 0x1ABB0804, 0x1AC10804,
+            0x1AC48804, 0x1ACB8804, 0x1ACD0804, 0x1ACF0804, 0x1AE90804, 0x1AD18804, 0x1AD30804, 0x1ADA0804, 0x1ADB8804, 0x1BB88804,
+            0x1BCF0804, 0x1BCD0804, 0x1BD40804, 0x022E8805, 0x01568805, 0x1AB90804, 0x1ABD8804, 0x1ABF0804, 0x1AC08804, 0x1AC40804,
+            0x1AC70804, 0x1AC90804, 0x1ACA0804, 0x1ACB0804, 0x1ACC8804, 0x1AD28804, 0x1AD48804, 0x1AE50804, 0x1AE68804, 0x1AE78804,
+            0x1AD78804, 0x0FA78804, 0x1AE80804, 0x1AC20804, 0x1ADE8804, 0x1B0C0804, 0x02CD8805, 0x1ADF0804, 0x1B0A8804, 0x1ABF8804,
+            0x1AC58804, 0x194B0804, 0x19658804, 0x19660804, 0x19668804, 0x19678804, 0x19680804, 0x19688804, 0x19690804, 0x19698804,
+            0x00003844, 0x196A8804, 0x00003884, 0x196B0804, 0x196B8804, 0x0FA80804, 0x02070805, 0x165C8804, 0x16660804, 0x01580805,
+            0x013C8805, 0x164E8804, 0x0FA88804, 0x16688804, 0x166D8804, 0x14290804, 0x148C8804, 0x147D0804, 0x14AE0804, 0x14BA0804,
+            0x0FDA8804, 0x0FD60804, 0x10060804, 0x10098804, 0x10238804, 0x102C8804, 0x10780804, 0x10750804, 0x108A0804, 0x109A8804,
+            0x109D8804, 0x10A10804, 0x10A70804, 0x10AA8804, 0x10A50804, 0x10A40804, 0x10A58804, 0x10CB8804, 0x10CE0804, 0x10E28804,
+            0x10DD8804, 0x10E38804, 0x10F40804, 0x110E0804, 0x11130804, 0x11100804, 0x11150804, 0x11368804, 0x11348804, 0x11408804,
+            0x02948805, 0x10448828, 0x10780828, 0x10730828, 0x11150828, 0x11600804, 0x10AB8804, 0x11610804, 0x0FDD8804, 0x11A38804,
+            0x0FF58808, 0x114A8808, 0x10FB8808, 0x10ED0808, 0x10E70804, 0x11300828, 0x026D0805, 0x1C6F0804, 0x164F0804, 0x16690804,
+            0x16620804, 0x01588805, 0x00003304, 0x166D0804, 0x211D0804, 0x21548804, 0x7DA08804, 0x46240000, 0x7DA00804, 0x737A0000,
+            0x7DA08804, 0x47650000, 0x7DA08804, 0x46640000, 0x7DA00804, 0x77688000, 0x7DA00804, 0x67190000, 0x7DA00804, 0x69F28000,
+            0x7DA08804, 0x4FCE0000, 0x7DA00804, 0x6CA88000, 0x7DA08804, 0x48E88000, 0x7DA00804, 0x6AC38000, 0x7DA00804, 0x6CA40000,
+            0x7DA00804, 0x70FB0000, 0x7DA00804, 0x7B348000, 0x7DA00804, 0x7FC28000, 0x7DA08804, 0x431F8000, 0x7DA08804, 0x43DD0000,
+            0x7DA08804, 0x447C0000, 0x7DA08804, 0x48478000, 0x7DA00804, 0x75010000, 0x7DA00804, 0x768D8000, 0x7DA00804, 0x786C8000,
+            0x7DA00804, 0x79EF0000, 0x7DA08804, 0x421E8000, 0x7DA08804, 0x48B50000, 0x7DA08804, 0x4CF88000, 0x7DA00804, 0x67410000,
+            0x7DA00804, 0x69BA8000, 0x7DA00804, 0x75820000, 0x7DA00804, 0x790D8000, 0x7DA08804, 0x43168000, 0x7DA08804, 0x4F0F0000,
+            0x7DA00804, 0x6EA80000, 0x7DA00804, 0x77F58000, 0x7DA08804, 0x42E68000, 0x7DA08804, 0x44B20000, 0x7DA00804, 0x71648000,
+            0x7DA08804, 0x40EC0000, 0x7DA08804, 0x440F8000, 0x7DA00804, 0x6F650000, 0x7DA00804, 0x738B8000, 0x7DA00804, 0x76B50000,
+            0x7DA00804, 0x797E0000, 0x7DA08804, 0x48670000, 0x7DA00804, 0x67C30000, 0x7DA00804, 0x68DB8000, 0x7DA00804, 0x696F0000,
+            0x7DA00804, 0x72620000, 0x7DA00804, 0x75698000, 0x7DA00804, 0x79080000, 0x7DA00804, 0x7B738000, 0x7DA08804, 0x40008000,
+            0x7DA08804, 0x43030000, 0x7DA08804, 0x432E0000, 0x7DA08804, 0x46F78000, 0x7DA08804, 0x4B990000, 0x7DA08804, 0x4DB78000,
+            0x7DA08804, 0x4EFD0000, 0x7DA00804, 0x7C460000, 0x7DA00804, 0x7CBF8000, 0x7DA00804, 0x7ED00000, 0x7DA08804, 0x41E48000,
+            0x7DA08804, 0x49820000, 0x7DA08804, 0x4F3F8000, 0x7DA08804, 0x456B0000, 0x7DA00804, 0x6C6F8000, 0x7DA00804, 0x6F820000,
+            0x7DA00804, 0x7E300000, 0x7DA08804, 0x403F0000, 0x7DA00804, 0x79310000, 0x7DA00804, 0x7C650000, 0x7DA08804, 0x46610000,
+            0x7DA08804, 0x4B7B8000, 0x7DA00804, 0x6C6C0000, 0x7DA00804, 0x6E310000, 0x7DA00804, 0x75098000, 0x7DA00804, 0x76ED0000,
+            0x7DA00804, 0x77878000, 0x7DA00804, 0x7E978000, 0x7DA00804, 0x7F1B8000, 0x7DA08804, 0x4B258000, 0x7DA00804, 0x69690000,
+            0x7DA08804, 0x40458000, 0x7DA00804, 0x68EE0000, 0x7DA00804, 0x68E60000, 0x7DA00804, 0x7D0E0000, 0x7DA00804, 0x7EDF0000,
+            0x7DA08804, 0x41F88000, 0x7DA08804, 0x4B3A8000, 0x7DA08804, 0x45C00000, 0x7DA00804, 0x71678000, 0x7DA08804, 0x457F0000,
+            0x7DA00804, 0x671C8000, 0x7DA00804, 0x6DF38000, 0x7DA00804, 0x70090000, 0x7DA00804, 0x79C38000, 0x7DA00804, 0x7AB80000,
+            0x7DA00804, 0x698B8000, 0x7DA00804, 0x7C7D8000, 0x7DA00804, 0x67DF8000, 0x7DA00804, 0x6FD48000, 0x7DA00804, 0x67068000,
+            0x7DA00804, 0x76660000, 0x7DA00804, 0x72BC0000, 0x7DA00804, 0x7E910000, 0x7DA00804, 0x69E18000, 0x7DA00804, 0x6C2F0000,
+            0x7DA00804, 0x7B808000, 0x7DA08804, 0x42248000, 0x7DA08804, 0x45550000, 0x7DA00804, 0x75DD0000, 0x7DA08804, 0x47D80000,
+            0x7DA00804, 0x76440000, 0x7DA00804, 0x717F0000, 0x7DA08804, 0x41728000, 0x7DA00804, 0x71D00000, 0x7DA00804, 0x7AB28000,
+            0x7DA00804, 0x67570000, 0x7DA00804, 0x68B48000, 0x7DA00804, 0x68E48000, 0x7DA00804, 0x74408000, 0x7DA00804, 0x7E738000,
+            0x7DA08804, 0x41378000, 0x7DA08804, 0x45690000, 0x7DA08804, 0x48E78000, 0x7DA00804, 0x697A8000, 0x7DA00804, 0x6A210000,
+            0x7DA00804, 0x6CB98000, 0x7DA00804, 0x6F760000, 0x7DA00804, 0x72E28000, 0x7DA00804, 0x77FF0000, 0x7DA00804, 0x7C950000,
+            0x7DA08804, 0x4AD68000, 0x7DA08804, 0x4D350000, 0x7DA08804, 0x4F4B8000, 0x7DA08804, 0x4F670000, 0x7DA00804, 0x694D8000,
+            0x7DA00804, 0x73630000, 0x7DA00804, 0x75BB8000, 0x7DA08804, 0x47B10000, 0x7DA00804, 0x6F3A0000, 0x7DA00804, 0x70C80000,
+            0x7DA00804, 0x71000000, 0x7DA00804, 0x724D0000, 0x7DA00804, 0x77918000, 0x7DA00804, 0x78A48000, 0x7DA00804, 0x7A448000,
+            0x7DA00804, 0x7CE50000, 0x7DA00804, 0x7EFA0000, 0x7DA08804, 0x40378000, 0x7DA08804, 0x47930000, 0x7DA08804, 0x42770000,
+            0x7DA08804, 0x48118000, 0x7DA08804, 0x49A50000, 0x7DA00804, 0x690B8000, 0x7DA00804, 0x69518000, 0x7DA00804, 0x6A5E8000,
+            0x7DA00804, 0x78640000, 0x7DA08804, 0x44610000, 0x7DA00804, 0x6F648000, 0x7DA00804, 0x6FFA8000, 0x7DA00804, 0x71BD8000,
+            0x7DA00804, 0x75D70000, 0x7DA00804, 0x7E1F0000, 0x7DA00804, 0x79BA8000, 0x7DA00804, 0x67720000, 0x7DA00804, 0x6B7C8000,
+            0x7DA00804, 0x6EDD0000, 0x7DA00804, 0x700E0000, 0x7DA00804, 0x79D90000, 0x7DA00804, 0x7A348000, 0x7DA00804, 0x7FCD0000,
+            0x7DA08804, 0x40230000, 0x7DA08804, 0x491A0000, 0x7DA08804, 0x4B7B0000, 0x7DA08804, 0x4BA40000, 0x7DA08804, 0x4C0C0000,
+            0x7DA00804, 0x67C58000, 0x7DA00804, 0x7CD70000, 0x7DA08804, 0x48DA0000, 0x7DA08804, 0x4B5C0000, 0x7DA00804, 0x70708000,
+            0x7DA00804, 0x67430000, 0x7DA00804, 0x686D0000, 0x7DA00804, 0x6DF70000, 0x7DA00804, 0x6E1F8000, 0x7DA00804, 0x72CC8000,
+            0x7DA00804, 0x78E70000, 0x7DA00804, 0x7B210000, 0x7DA08804, 0x427E0000, 0x7DA08804, 0x483E0000, 0x7DA08804, 0x4FC68000,
+            0x7DA00804, 0x73440000, 0x7DA08804, 0x4B170000, 0x7DA00804, 0x69448000, 0x7DA00804, 0x73BD8000, 0x7DA00804, 0x73F98000,
+            0x7DA00804, 0x76A08000, 0x7DA00804, 0x774E0000, 0x7DA00804, 0x7A048000, 0x7DA00804, 0x7AAC8000, 0x7DA00804, 0x7C358000,
+            0x7DA00804, 0x7E880000, 0x7DA08804, 0x4C2F0000, 0x7DA00804, 0x68B68000, 0x7DA00804, 0x71170000, 0x7DA08804, 0x4B3C0000,
+            0x7DA00804, 0x68158000, 0x7DA00804, 0x6E8C8000, 0x7DA00804, 0x76F50000, 0x7DA08804, 0x47950000, 0x7DA00804, 0x6FC58000,
+            0x7DA00804, 0x70A20000, 0x7DA00804, 0x740B8000, 0x7DA08804, 0x4B430000, 0x7DA00804, 0x69148000, 0x7DA00804, 0x6A078000,
+            0x7DA00804, 0x6E328000, 0x7DA00804, 0x73098000, 0x7DA00804, 0x73A70000, 0x7DA00804, 0x74540000, 0x7DA00804, 0x76728000,
+            0x7DA00804, 0x7A030000, 0x7DA00804, 0x7AF10000, 0x7DA00804, 0x7FBC8000, 0x7DA08804, 0x44678000, 0x7DA08804, 0x44708000,
+            0x7DA08804, 0x48E60000, 0x7DA08804, 0x4B710000, 0x7DA00804, 0x699F8000, 0x7DA00804, 0x775D0000, 0x7DA00804, 0x6A0E8000,
+            0x7DA00804, 0x78E80000, 0x7DA00804, 0x7A4C0000, 0x7DA08804, 0x42FD0000, 0x7DA08804, 0x4B518000, 0x7DA08804, 0x4E2B8000,
+            0x7DA08804, 0x4F4F8000, 0x7DA00804, 0x73CB8000, 0x7DA00804, 0x76E58000, 0x7DA08804, 0x40F40000, 0x7DA00804, 0x7D658000,
+            0x7DA00804, 0x7D900000, 0x7DA00804, 0x7E490000, 0x7DA00804, 0x79600000, 0x7DA00804, 0x784C8000, 0x7DA08804, 0x45AC0000,
+            0x7DA00804, 0x67600000, 0x7DA08804, 0x419B0000, 0x7DA00804, 0x691D0000, 0x7DA00804, 0x69038000, 0x7DA00804, 0x6F530000,
+            0x7DA00804, 0x71698000, 0x7DA00804, 0x7E6B0000, 0x7DA00804, 0x6DC28000, 0x7DA00804, 0x768F0000, 0x7DA00804, 0x735A0000,
+            0x7DA08804, 0x479D8000, 0x7DA08804, 0x44260000, 0x7DA08804, 0x4B268000, 0x7DA08804, 0x44C58000, 0x7DA00804, 0x6F698000,
+            0x7DA00804, 0x68A00000, 0x7DA00804, 0x6AE00000, 0x7DA08804, 0x7D070000, 0x7DA08804, 0x7D078000, 0x7DA00804, 0x6C2D0000,
+            0x7DA08804, 0x7D088000, 0x7DA00804, 0x733A0000, 0x7DA08804, 0x7D098000, 0x7DA08804, 0x7D0A0000, 0x7DA00804, 0x68EF0000,
+            0x7DA00804, 0x79950000, 0x7DA00804, 0x7B650000, 0x7DA00804, 0x7C9E0000, 0x7DA00804, 0x7CAF0000, 0x7DA00804, 0x7CB28000,
+            0x7DA00804, 0x7CC78000, 0x7DA08804, 0x4BAB0000, 0x7DA00804, 0x7E5F0000, 0x7DA00804, 0x7FDE8000, 0x7DA08804, 0x7D0F8000,
+            0x7DA08804, 0x43090000, 0x7DA08804, 0x7D108000, 0x7DA08804, 0x457C0000, 0x7DA08804, 0x7D118000, 0x7DA08804, 0x7D120000,
+            0x7DA08804, 0x481C0000, 0x7DA08804, 0x487E8000, 0x7DA08804, 0x7D138000, 0x7DA08804, 0x7D140000, 0x7DA08804, 0x7D148000,
+            0x7DA08804, 0x4C778000, 0x7DA08804, 0x4C7E0000, 0x7DA08804, 0x4C940000, 0x7DA08804, 0x4EDA0000, 0x7DA08804, 0x486F0000,
+            0x7DA08804, 0x4B5B8000, 0x7DA00804, 0x67D70000, 0x7DA00804, 0x68738000, 0x7DA00804, 0x68A68000, 0x7DA00804, 0x69648000,
+            0x7DA00804, 0x69720000, 0x7DA00804, 0x69A88000, 0x7DA00804, 0x6ACE8000, 0x7DA00804, 0x6B030000, 0x7DA00804, 0x6B340000,
+            0x7DA00804, 0x6C200000, 0x7DA00804, 0x6C540000, 0x7DA00804, 0x6E320000, 0x7DA00804, 0x6E370000, 0x7DA00804, 0x704A0000,
+            0x7DA00804, 0x70B40000, 0x7DA00804, 0x70C70000, 0x7DA00804, 0x70F90000, 0x7DA00804, 0x72A78000, 0x7DA00804, 0x72F10000,
+            0x7DA00804, 0x73488000, 0x7DA00804, 0x74428000, 0x7DA00804, 0x76BB8000, 0x7DA00804, 0x770D0000, 0x7DA00804, 0x77910000,
+            0x7DA00804, 0x78B70000, 0x7DA00804, 0x79158000, 0x7DA00804, 0x7A110000, 0x7DA00804, 0x7C488000, 0x7DA00804, 0x7C9F0000,
+            0x7DA00804, 0x7CA48000, 0x7DA00804, 0x7CA40000, 0x7DA00804, 0x7CA80000, 0x7DA00804, 0x7CAB0000, 0x7DA00804, 0x7CAE8000,
+            0x7DA00804, 0x7CC68000, 0x7DA00804, 0x7CC70000, 0x7DA00804, 0x7D200000, 0x7DA00804, 0x7D408000, 0x7DA00804, 0x7DE00000,
+            0x7DA00804, 0x7F048000, 0x7DA00804, 0x7F208000, 0x7DA00804, 0x7FB90000, 0x7DA08804, 0x40028000, 0x7DA08804, 0x40F68000,
+            0x7DA08804, 0x413C8000, 0x7DA08804, 0x422B8000, 0x7DA08804, 0x44880000, 0x7DA08804, 0x44CB0000, 0x7DA08804, 0x45808000,
+            0x7DA08804, 0x459C8000, 0x7DA08804, 0x46698000, 0x7DA08804, 0x46840000, 0x7DA08804, 0x47DB0000, 0x7DA08804, 0x4B718000,
+            0x7DA08804, 0x4BFF8000, 0x7DA08804, 0x4C1D8000, 0x7DA00804, 0x703A8000, 0x7DC20804, 0x61770000, 0x7DA08804, 0x410C0000,
+            0x7DA00804, 0x67130000, 0x7DA00804, 0x68DA8000, 0x7DA00804, 0x68B40000, 0x7DA00804, 0x67C00000, 0x7DA00804, 0x68A28000,
+            0x7DA00804, 0x68C00000, 0x7DA00804, 0x69638000, 0x7DA00804, 0x697D0000, 0x7DA00804, 0x6AAA8000, 0x7DA00804, 0x6ACC8000,
+            0x7DA00804, 0x6AF10000, 0x7DA00804, 0x6C598000, 0x7DA00804, 0x6CA20000, 0x7DA00804, 0x6CAA0000, 0x7DA00804, 0x6D310000,
+            0x7DA00804, 0x6D940000, 0x7DA00804, 0x6F690000, 0x7DA00804, 0x6F6C8000, 0x7DA00804, 0x6FB48000, 0x7DA00804, 0x6FD68000,
+            0x7DA00804, 0x706C0000, 0x7DA00804, 0x70A70000, 0x7DA00804, 0x70840000, 0x7DA00804, 0x70B00000, 0x7DA00804, 0x711A0000,
+            0x7DA00804, 0x71E20000, 0x7DA00804, 0x720E0000, 0x7DA00804, 0x72290000, 0x7DA00804, 0x72AB0000, 0x7DA00804, 0x738D8000,
+            0x7DA00804, 0x73AB0000, 0x7DA00804, 0x75BC8000, 0x7DA00804, 0x776D8000, 0x7DA00804, 0x77658000, 0x7DA00804, 0x780F0000,
+            0x7DA00804, 0x7BD38000, 0x7DA00804, 0x791A8000, 0x7DA00804, 0x79578000, 0x7DA00804, 0x7A388000, 0x7DA00804, 0x7A830000,
+            0x7DA00804, 0x7A9D8000, 0x7DA00804, 0x7B0E8000, 0x7DA00804, 0x7B0F8000, 0x7DA00804, 0x7B6D8000, 0x7DA00804, 0x7B7A0000,
+            0x7DA00804, 0x7BA50000, 0x7DA00804, 0x7BA00000, 0x7DA00804, 0x7C660000, 0x7DA00804, 0x7D588000, 0x7DA00804, 0x7E3D8000,
+            0x7DA00804, 0x7EAD8000, 0x7DA00804, 0x7F9F0000, 0x7DA08804, 0x41A90000, 0x7DA08804, 0x41F78000, 0x7DA08804, 0x43BC8000,
+            0x7DA08804, 0x44A08000, 0x7DA08804, 0x44C30000, 0x7DA08804, 0x455F8000, 0x7DA08804, 0x45658000, 0x7DA08804, 0x45768000,
+            0x7DA08804, 0x45C50000, 0x7DA08804, 0x479C0000, 0x7DA08804, 0x48390000, 0x7DA08804, 0x48CC8000, 0x7DA08804, 0x493B0000,
+            0x7DA08804, 0x4B3E0000, 0x7DA08804, 0x4BED8000, 0x7DA08804, 0x4C058000, 0x7DA08804, 0x4D890000, 0x7DC20804, 0x54250000,
+            0x7DC20804, 0x54220000, 0x7DC20804, 0x59EA8000, 0x7DC00804, 0x5DCE8000, 0x7DC00804, 0x600C0000, 0x7DC00804, 0x601C8000,
+            0x7DC20804, 0x69248000, 0x7DC20804, 0x6E680000, 0x7DC20804, 0x7F698000, 0x7DA08804, 0x4FA18000, 0x7DA08804, 0x4FC70000,
+            0x10210808, 0x10210808, 0x10210808, 0x10480808, 0x10210808, 0x106B0808, 0x10210808, 0x10210808, 0x10480808, 0x10210808,
+            0x10210808, 0x106B0808, 0x10E90808, 0x00004648, 0x10FB8808, 0x10E90808, 0x10FB8808, 0x13048808, 0x13060808, 0x13048808,
+            0x12FD0808, 0x13048808, 0x13000808, 0x130A0808, 0x13060808, 0x13048808, 0x13010808, 0x13138804, 0x00001584, 0x00001844,
+            0x13138808, 0x13138808, 0x00001644, 0x1316880A, 0x130F080A, 0x1310880A, 0x1314080A, 0x1318880A, 0x1319880A, 0x0333080B,
+            0x13190804, 0x00001784, 0x13190804, 0x00001744, 0x13190804, 0x000017C4, 0x00001784, 0x13190804, 0x000017C4, 0x00001744,
+            0x130F0804, 0x00001644, 0x130F0804, 0x00001684, 0x130F0804, 0x000017C4, 0x130F8804, 0x000017C4, 0x13100804, 0x000017C4,
+            0x13108804, 0x000017C4, 0x13110804, 0x000017C4, 0x13118804, 0x000017C4, 0x13120804, 0x000017C4, 0x13130804, 0x000017C4,
+            0x13138804, 0x000017C4, 0x13140832, 0x000017C4, 0x13140804, 0x000017C4, 0x13148804, 0x000017C4, 0x13150804, 0x000017C4,
+            0x13158804, 0x000017C4, 0x13160804, 0x000017C4, 0x13170832, 0x000017C4, 0x13170804, 0x000017C4, 0x13178804, 0x000017C4,
+            0x13180804, 0x000017C4, 0x13188804, 0x000017C4, 0x13190804, 0x000017C4, 0x13198804, 0x000017C4, 0x13118804, 0x000016C4,
+            0x130F8804, 0x00001804, 0x13140804, 0x00001804, 0x13170804, 0x00001804, 0x130F0808, 0x13148808, 0x13340834, 0x13340832,
+            0x133A8834, 0x133A8832, 0x133A882E, 0x133A8830, 0x133B0834, 0x133B0832, 0x133B082E, 0x133B0830, 0x133B8834, 0x133B8832,
+            0x133B882E, 0x133B8830, 0x13440834, 0x13440832, 0x1344082E, 0x13440830, 0x13458834, 0x13458832, 0x1345882E, 0x13458830,
+            0x13438834, 0x13438832, 0x1343882E, 0x13438830, 0x13748834, 0x13748832, 0x1374882E, 0x13748830, 0x13760834, 0x13760832,
+            0x1376082E, 0x13760830, 0x13488834, 0x13488832, 0x1348882E, 0x13488830, 0x13480834, 0x13480832, 0x1348082E, 0x13480830,
+            0x13490834, 0x13490832, 0x1349082E, 0x13490830, 0x134A0834, 0x134A0832, 0x134A082E, 0x134A0830, 0x13558834, 0x13558832,
+            0x13550834, 0x13550832, 0x13568834, 0x13568832, 0x13530834, 0x13530832, 0x135E0834, 0x135E0832, 0x135A8834, 0x135A8832,
+            0x137B8834, 0x137B8832, 0x137B882E, 0x137B8830, 0x137F8834, 0x137F8832, 0x137F882E, 0x137F8830, 0x13820834, 0x13820832,
+            0x1382082E, 0x13820830, 0x13810834, 0x13810832, 0x1381082E, 0x13810830, 0x138C8834, 0x138C8832, 0x138D8834, 0x138D8832,
+            0x138D882E, 0x138D8830, 0x13938834, 0x000020F4, 0x13938832, 0x000020F2, 0x13920834, 0x13920832, 0x1392082E, 0x13920830,
+            0x13918834, 0x13918832, 0x1391882E, 0x13918830, 0x13A28834, 0x13A28832, 0x13A28834, 0x000020F4, 0x13A28832, 0x000020F2,
+            0x029B0805, 0x137E0834, 0x137E0832, 0x137E082E, 0x137E0830, 0x13960834, 0x13960832, 0x13958834, 0x13958832, 0x13968834,
+            0x13968832, 0x13960834, 0x13320834, 0x13980834, 0x13980832, 0x13950834, 0x13950832, 0x13970834, 0x13970832, 0x139D8834,
+            0x139D8832, 0x139D882E, 0x139D8830, 0x139B082E, 0x139B0830, 0x13370834, 0x13390834, 0x13370832, 0x13390832, 0x13370834,
+            0x13938834, 0x13370832, 0x13938832, 0x13370834, 0x13940834, 0x13370832, 0x13940832, 0x13370834, 0x13960834, 0x13370832,
+            0x13960832, 0x13370834, 0x13958834, 0x13370832, 0x13958832, 0x13370834, 0x13968834, 0x13370832, 0x13968832, 0x13370834,
+            0x139D8834, 0x13370832, 0x139D8832, 0x1337082E, 0x139D882E, 0x13370834, 0x139B0834, 0x13370832, 0x139B0832, 0x1337082E,
+            0x139B082E, 0x139C0834, 0x139C0832, 0x139C082E, 0x139C0830, 0x13370834, 0x13478834, 0x13370834, 0x134C8834, 0x13370834,
+            0x138A0834, 0x13370834, 0x139B8834, 0x133A0834, 0x13478834, 0x133A0834, 0x134C8834, 0x133A0834, 0x134D0834, 0x133A0834,
+            0x138A0834, 0x133A0834, 0x139B0834, 0x133A0834, 0x139B8834, 0x13428834, 0x13478834, 0x13428834, 0x134C8834, 0x13428834,
+            0x134D0834, 0x13428834, 0x138A0834, 0x13428834, 0x139B0834, 0x13428834, 0x139B8834, 0x13430834, 0x13478834, 0x13430834,
+            0x138A0834, 0x13430834, 0x139B0834, 0x13430834, 0x139B8834, 0x13478834, 0x134C8834, 0x13478834, 0x138A0834, 0x134C8834,
+            0x13478834, 0x134C8834, 0x138A0834, 0x134D0834, 0x13478834, 0x134D0834, 0x134C8834, 0x134D0834, 0x138A0834, 0x13630834,
+            0x13478834, 0x13630834, 0x134C8834, 0x13630834, 0x134D0834, 0x13630834, 0x138A0834, 0x13688834, 0x134C8834, 0x13688834,
+            0x138A0834, 0x13690834, 0x13478834, 0x13690834, 0x134C8834, 0x13690834, 0x134D0834, 0x13690834, 0x138A0834, 0x136B8834,
+            0x134C8834, 0x136B8834, 0x138A0834, 0x136C0834, 0x138A0834, 0x136D8834, 0x13478834, 0x136D8834, 0x138A0834, 0x136E0834,
+            0x13478834, 0x136E0834, 0x138A0834, 0x13720834, 0x13478834, 0x13720834, 0x134C8834, 0x13720834, 0x134D0834, 0x13720834,
+            0x138A0834, 0x13720834, 0x139B0834, 0x13720834, 0x139B8834, 0x13780834, 0x134C8834, 0x13780834, 0x138A0834, 0x13780834,
+            0x139B0834, 0x13780834, 0x139B8834, 0x137B0834, 0x13390834, 0x137B0834, 0x13478834, 0x137B0834, 0x134C8834, 0x137B0834,
+            0x134D0834, 0x137B0834, 0x13860834, 0x137B0834, 0x138A0834, 0x137B0834, 0x139B0834, 0x137B0834, 0x139B8834, 0x13860834,
+            0x13478834, 0x13860834, 0x134C8834, 0x13860834, 0x134D0834, 0x13860834, 0x138A0834, 0x13860834, 0x139B0834, 0x13860834,
+            0x139B8834, 0x138A0834, 0x13478834, 0x138A0834, 0x134C8834, 0x138A0834, 0x134D0834, 0x138A0834, 0x138A0834, 0x138A0834,
+            0x139B0834, 0x138A0834, 0x139B8834, 0x138C0834, 0x13478834, 0x138C0834, 0x134C8834, 0x138C0834, 0x134D0834, 0x138C0834,
+            0x138A0834, 0x138C0834, 0x139B0834, 0x138C0834, 0x139B8834, 0x13910834, 0x13478834, 0x13910834, 0x138A0834, 0x13910834,
+            0x139B0834, 0x13910834, 0x139B8834, 0x139B8834, 0x13478834, 0x139B8834, 0x134C8834, 0x139B8834, 0x134D0834, 0x139B8834,
+            0x138A0834, 0x139B8834, 0x139B0834, 0x139B8834, 0x139B8834, 0x13528834, 0x00002634, 0x13598834, 0x00002634, 0x139B0834,
+            0x00002634, 0x00001C34, 0x00002034, 0x00001CF4, 0x00002034, 0x00001DB4, 0x00002034, 0x00001EB4, 0x00002034, 0x00001F74,
+            0x00002034, 0x00002034, 0x00002634, 0x13370832, 0x13598832, 0x13370832, 0x135A0832, 0x13370832, 0x138A0832, 0x13370832,
+            0x138C0832, 0x13370832, 0x139B8832, 0x133A0832, 0x13598832, 0x133A0832, 0x135A0832, 0x133A0832, 0x138A0832, 0x133A0832,
+            0x138C0832, 0x133A0832, 0x139B0832, 0x133A0832, 0x139B8832, 0x13428832, 0x13598832, 0x13428832, 0x135A0832, 0x13428832,
+            0x138A0832, 0x13428832, 0x138C0832, 0x13428832, 0x139B0832, 0x13428832, 0x139B8832, 0x13430832, 0x13598832, 0x13430832,
+            0x135A0832, 0x13430832, 0x138A0832, 0x13430832, 0x138C0832, 0x13430832, 0x139B0832, 0x13430832, 0x139B8832, 0x13720832,
+            0x139B0832, 0x13720832, 0x139B8832, 0x13780832, 0x139B0832, 0x13780832, 0x139B8832, 0x137B0832, 0x13390832, 0x137B0832,
+            0x13860832, 0x137B0832, 0x138A0832, 0x137B0832, 0x139B0832, 0x137B0832, 0x139B8832, 0x13860832, 0x138A0832, 0x13860832,
+            0x139B0832, 0x13860832, 0x139B8832, 0x138A0832, 0x13390832, 0x138A0832, 0x138A0832, 0x138C0832, 0x13598832, 0x138C0832,
+            0x135A0832, 0x138C0832, 0x138A0832, 0x138C0832, 0x138C0832, 0x138C0832, 0x139B0832, 0x138C0832, 0x139B8832, 0x139B0832,
+            0x00002632, 0x139B8832, 0x13598832, 0x139B8832, 0x135A0832, 0x139B8832, 0x138A0832, 0x139B8832, 0x138C0832, 0x139B8832,
+            0x139B0832, 0x139B8832, 0x139B8832, 0x1337082E, 0x1347882E, 0x1337082E, 0x134C882E, 0x1337082E, 0x134D082E, 0x1337082E,
+            0x138A082E, 0x1337082E, 0x1391082E, 0x133A082E, 0x1347882E, 0x133A082E, 0x134C882E, 0x133A082E, 0x134D082E, 0x133A082E,
+            0x138A082E, 0x133A082E, 0x1391082E, 0x1342882E, 0x1347882E, 0x1342882E, 0x134C882E, 0x1342882E, 0x134D082E, 0x1342882E,
+            0x138A082E, 0x1342882E, 0x1391082E, 0x1343082E, 0x138A082E, 0x1347882E, 0x134C882E, 0x1347882E, 0x138A082E, 0x134C882E,
+            0x1347882E, 0x134C882E, 0x138A082E, 0x134D082E, 0x1347882E, 0x134D082E, 0x138A082E, 0x1363082E, 0x1347882E, 0x1363082E,
+            0x134C882E, 0x1363082E, 0x134D082E, 0x1363082E, 0x138A082E, 0x1368882E, 0x134C882E, 0x1368882E, 0x134D082E, 0x1368882E,
+            0x138A082E, 0x1369082E, 0x1347882E, 0x1369082E, 0x134C882E, 0x1369082E, 0x134D082E, 0x1369082E, 0x138A082E, 0x136B882E,
+            0x134C882E, 0x136C082E, 0x138A082E, 0x136D882E, 0x1347882E, 0x136D882E, 0x138A082E, 0x136E082E, 0x1347882E, 0x136E082E,
+            0x138A082E, 0x1372082E, 0x1347882E, 0x1372082E, 0x134C882E, 0x1372082E, 0x134D082E, 0x1372082E, 0x138A082E, 0x1378082E,
+            0x134C882E, 0x1378082E, 0x138A082E, 0x137B082E, 0x1347882E, 0x137B082E, 0x134C882E, 0x137B082E, 0x134D082E, 0x137B082E,
+            0x1386082E, 0x137B082E, 0x138A082E, 0x1386082E, 0x1347882E, 0x1386082E, 0x134C882E, 0x1386082E, 0x134D082E, 0x1386082E,
+            0x138A082E, 0x1386082E, 0x1391082E, 0x138A082E, 0x1347882E, 0x138A082E, 0x134C882E, 0x138A082E, 0x134D082E, 0x138A082E,
+            0x138A082E, 0x138C082E, 0x1347882E, 0x138C082E, 0x134C882E, 0x138C082E, 0x134D082E, 0x138C082E, 0x138A082E, 0x138C082E,
+            0x1391082E, 0x1391082E, 0x1347882E, 0x1391082E, 0x138A082E, 0x1391082E, 0x0000262E, 0x139B882E, 0x1347882E, 0x139B882E,
+            0x134C882E, 0x139B882E, 0x134D082E, 0x139B882E, 0x138A082E, 0x139B882E, 0x1391082E, 0x13370830, 0x138A0830, 0x13370830,
+            0x13910830, 0x133A0830, 0x138A0830, 0x133A0830, 0x13910830, 0x13428830, 0x138A0830, 0x13428830, 0x13910830, 0x13430830,
+            0x138A0830, 0x13430830, 0x13910830, 0x13630830, 0x138A0830, 0x13630830, 0x13910830, 0x13638830, 0x138A0830, 0x13638830,
+            0x13910830, 0x137B0830, 0x13860830, 0x137B0830, 0x138A0830, 0x13860830, 0x138A0830, 0x138C0830, 0x138A0830, 0x138C0830,
+            0x13910830, 0x139B8830, 0x138A0830, 0x139B8830, 0x13910830, 0x00001DB0, 0x00002030, 0x00001EB0, 0x00002030, 0x00001F70,
+            0x00002030, 0x136B8834, 0x139B0834, 0x136B8834, 0x139B8834, 0x136D8834, 0x139B0834, 0x136D8834, 0x139B8834, 0x136E0834,
+            0x139B0834, 0x136E0834, 0x139B8834, 0x13630834, 0x139B0834, 0x13630834, 0x139B8834, 0x13638834, 0x139B0834, 0x13638834,
+            0x139B8834, 0x134C8834, 0x139B0834, 0x134C8834, 0x139B8834, 0x13478834, 0x139B0834, 0x13478834, 0x139B8834, 0x134D0834,
+            0x139B0834, 0x134D0834, 0x139B8834, 0x13688834, 0x139B0834, 0x13688834, 0x139B8834, 0x13690834, 0x139B0834, 0x13690834,
+            0x139B8834, 0x13638834, 0x13478834, 0x13638834, 0x134C8834, 0x13638834, 0x134D0834, 0x13638834, 0x138A0834, 0x13638834,
+            0x13598834, 0x13630834, 0x13598834, 0x13688834, 0x13598834, 0x13690834, 0x13598834, 0x136B8832, 0x139B0832, 0x136B8832,
+            0x139B8832, 0x136D8832, 0x139B0832, 0x136D8832, 0x139B8832, 0x136E0832, 0x139B0832, 0x136E0832, 0x139B8832, 0x13630832,
+            0x139B0832, 0x13630832, 0x139B8832, 0x13638832, 0x139B0832, 0x13638832, 0x139B8832, 0x134C8832, 0x139B0832, 0x134C8832,
+            0x139B8832, 0x13478832, 0x139B0832, 0x13478832, 0x139B8832, 0x134D0832, 0x139B0832, 0x134D0832, 0x139B8832, 0x13688832,
+            0x139B0832, 0x13688832, 0x139B8832, 0x13690832, 0x139B0832, 0x13690832, 0x139B8832, 0x13638832, 0x13478832, 0x13638832,
+            0x134C8832, 0x13638832, 0x134D0832, 0x13638832, 0x138A0832, 0x13638832, 0x13598832, 0x13630832, 0x13598832, 0x13688832,
+            0x13598832, 0x13690832, 0x13598832, 0x1363882E, 0x1347882E, 0x1363882E, 0x134C882E, 0x1363882E, 0x134D082E, 0x1363882E,
+            0x138A082E, 0x1363082E, 0x1391082E, 0x1363882E, 0x1391082E, 0x136B882E, 0x138A082E, 0x13630830, 0x13478830, 0x13630830,
+            0x134C8830, 0x13630830, 0x134D0830, 0x13638830, 0x13478830, 0x13638830, 0x134C8830, 0x13638830, 0x134D0830, 0x136B8830,
+            0x138A0830, 0x136C0830, 0x138A0830, 0x13390832, 0x00001B72, 0x13390834, 0x00001B74, 0x01C90805, 0x1342882E, 0x1347882E,
+            0x138A082E, 0x13428832, 0x134C8832, 0x13478832, 0x1342882E, 0x134C882E, 0x1347882E, 0x1342882E, 0x134C882E, 0x138A082E,
+            0x1342882E, 0x134D082E, 0x138A082E, 0x1342882E, 0x138A082E, 0x1347882E, 0x1342882E, 0x138A082E, 0x134C882E, 0x1342882E,
+            0x138A082E, 0x134D082E, 0x13478832, 0x138A0832, 0x134C8832, 0x1347882E, 0x138A082E, 0x134C882E, 0x134C8832, 0x138A0832,
+            0x139B8832, 0x134C8832, 0x138A0832, 0x139B0832, 0x1363082E, 0x134C882E, 0x1347882E, 0x1363082E, 0x1347882E, 0x134C882E,
+            0x13630832, 0x13478832, 0x139B0832, 0x13630832, 0x138A0832, 0x134C8832, 0x1363082E, 0x138A082E, 0x134C882E, 0x1363082E,
+            0x138A082E, 0x1347882E, 0x13630832, 0x138A0832, 0x138A0832, 0x1363082E, 0x138A082E, 0x138A082E, 0x13688832, 0x134C8832,
+            0x134C8832, 0x1368882E, 0x134C882E, 0x134C882E, 0x13688832, 0x138A0832, 0x138A0832, 0x13638832, 0x134C8832, 0x138A0832,
+            0x1363882E, 0x134C882E, 0x138A082E, 0x13638832, 0x13478832, 0x139B8832, 0x13638832, 0x138A0832, 0x134D0832, 0x1363882E,
+            0x138A082E, 0x134D082E, 0x13638832, 0x138A0832, 0x138A0832, 0x1363882E, 0x138A082E, 0x138A082E, 0x13690832, 0x134C8832,
+            0x139B0832, 0x13690832, 0x134D0832, 0x138A0832, 0x1369082E, 0x134D082E, 0x138A082E, 0x136B8832, 0x138A0832, 0x134C8832,
+            0x136B882E, 0x138A082E, 0x134C882E, 0x136B882E, 0x138A082E, 0x138A082E, 0x136B8832, 0x138A0832, 0x139B8832, 0x136D8832,
+            0x13478832, 0x138A0832, 0x136D8832, 0x138A0832, 0x138A0832, 0x136D882E, 0x138A082E, 0x138A082E, 0x136D8832, 0x138A0832,
+            0x139B0832, 0x136E0832, 0x138A0832, 0x138A0832, 0x136E0832, 0x138A0832, 0x139B8832, 0x136E0832, 0x138A0832, 0x139B0832,
+            0x13720832, 0x134D0832, 0x138A0832, 0x1372082E, 0x134D082E, 0x138A082E, 0x13780832, 0x138A0832, 0x134C8832, 0x13780832,
+            0x138A0832, 0x138A0832, 0x13860832, 0x134C8832, 0x138A0832, 0x13860832, 0x134C8832, 0x139B8832, 0x13860832, 0x134C8832,
+            0x139B0832, 0x1386082E, 0x1347882E, 0x1347882E, 0x13860832, 0x13478832, 0x13478832, 0x13860832, 0x134D0832, 0x138A0832,
+            0x1386082E, 0x134D082E, 0x138A082E, 0x13860832, 0x138A0832, 0x134C8832, 0x1386082E, 0x138A082E, 0x134C882E, 0x138A082E,
+            0x134C882E, 0x1347882E, 0x138A082E, 0x134C882E, 0x138A082E, 0x138A0832, 0x134C8832, 0x139B8832, 0x138A082E, 0x1347882E,
+            0x134C882E, 0x138A082E, 0x1347882E, 0x138A082E, 0x138A082E, 0x134D082E, 0x1347882E, 0x138A082E, 0x134D082E, 0x138A082E,
+            0x138A082E, 0x1347882E, 0x134D082E, 0x1391082E, 0x138A082E, 0x1347882E, 0x1391082E, 0x138A082E, 0x138A082E, 0x138C082E,
+            0x134C882E, 0x138A082E, 0x138C0832, 0x134C8832, 0x139B0832, 0x138C0832, 0x13478832, 0x138A0832, 0x138C082E, 0x1347882E,
+            0x138A082E, 0x138C0832, 0x13478832, 0x139B0832, 0x138C0832, 0x138A0832, 0x139B8832, 0x138C0832, 0x138A0832, 0x139B0832,
+            0x139B8832, 0x138A0832, 0x138A0832, 0x139B882E, 0x138A082E, 0x138A082E, 0x133A0832, 0x134D0832, 0x139B8832, 0x13428832,
+            0x13478832, 0x139B8832, 0x13428832, 0x13478832, 0x139B0832, 0x13428832, 0x134D0832, 0x139B8832, 0x13428832, 0x134D0832,
+            0x139B0832, 0x13428832, 0x138A0832, 0x139B8832, 0x13428832, 0x138A0832, 0x139B0832, 0x13478832, 0x138A0832, 0x139B8832,
+            0x13478832, 0x134C8832, 0x139B0832, 0x13478832, 0x138A0832, 0x139B0832, 0x13630832, 0x134D0832, 0x139B0832, 0x13688832,
+            0x134C8832, 0x139B8832, 0x13638832, 0x134C8832, 0x139B8832, 0x13690832, 0x134C8832, 0x139B8832, 0x13860832, 0x13478832,
+            0x139B8832, 0x13860832, 0x138A0832, 0x139B8832, 0x139B8832, 0x134C8832, 0x139B8832, 0x139B8832, 0x13478832, 0x139B8832,
+            0x139B8832, 0x138A0832, 0x139B8832, 0x138A0832, 0x138A0832, 0x139B8832, 0x13780832, 0x138A0832, 0x139B8832, 0x138C0832,
+            0x134C8832, 0x139B8832, 0x1378082E, 0x138A082E, 0x134C882E, 0x1386082E, 0x134C882E, 0x138A082E, 0x136D8832, 0x138A0832,
+            0x139B8832, 0x137B0832, 0x138A0832, 0x139B8832, 0x138C082E, 0x1347882E, 0x134C882E, 0x138A0832, 0x134D0832, 0x139B8832,
+            0x1386082E, 0x1347882E, 0x138A082E, 0x137B0832, 0x138A0832, 0x138A0832, 0x13860832, 0x13478832, 0x138A0832, 0x138C0832,
+            0x13478832, 0x134C8832, 0x13478832, 0x134C8832, 0x139B8832, 0x134C8832, 0x13478832, 0x139B8832, 0x138A0832, 0x13478832,
+            0x139B8832, 0x13720832, 0x138A0832, 0x139B8832, 0x133A0832, 0x134C8832, 0x139B8832, 0x137B082E, 0x138A082E, 0x138A082E,
+            0x136D882E, 0x1347882E, 0x138A082E, 0x1368882E, 0x138A082E, 0x138A082E, 0x13630832, 0x134D0832, 0x139B8832, 0x138C0832,
+            0x13478832, 0x139B8832, 0x13688834, 0x13860834, 0x13A28834, 0x13780834, 0x13860834, 0x13A28834, 0x13390834, 0x13860834,
+            0x13860834, 0x13910834, 0x13390834, 0x137B0834, 0x133A0834, 0x13598834, 0x138A0834, 0x134C8834, 0x138A0834, 0x13520834,
+            0x13688834, 0x13860834, 0x136D8834, 0x138A0834, 0x13598834, 0x13630834, 0x13940834, 0x13860834, 0x136D8834, 0x13860834,
+            0x139B8834, 0x13910834, 0x13940834, 0x13630834, 0x13860834, 0x138A0834, 0x13688834, 0x13860834, 0x139B0834, 0x13688834,
+            0x13860834, 0x139B0834, 0x01048835, 0x13390834, 0x13860834, 0x13860834, 0x13910834, 0x01048835, 0x136D8834, 0x13860834,
+            0x139B8834, 0x13910834, 0x01048835, 0x13940834, 0x13630834, 0x13860834, 0x138A0834, 0x13478834, 0x13860834, 0x01048835,
+            0x13478834, 0x13860834, 0x13390834, 0x13860834, 0x13910834, 0x13598834, 0x139C0834, 0x13390834, 0x13860834, 0x029A8805,
+            0x0111882D, 0x011B082D, 0x0149082D, 0x0120082D, 0x011D082D, 0x0133882D, 0x0136882D, 0x01C6082D, 0x013F082D, 0x013F082D,
+            0x013F082D, 0x013F082D, 0x013F082D, 0x010B082D, 0x010A882D, 0x0105882D, 0x0194082D, 0x0196082D, 0x01C5082D, 0x01C4082D,
+            0x01C1082D, 0x01C0082D, 0x01C2082D, 0x011B8805, 0x0195082D, 0x01050809, 0x01058809, 0x0111881F, 0x011B081F, 0x013F081F,
+            0x011D081F, 0x0120081F, 0x0136881F, 0x0133881F, 0x010B081F, 0x0194081F, 0x0196081F, 0x01C5081F, 0x01D6081F, 0x01D4881F,
+            0x01D0881F, 0x0333081F, 0x0106881F, 0x0335081F, 0x0336081F, 0x0335881F, 0x01D3881F, 0x0FB2081E, 0x01D6881F, 0x01D0081F,
+            0x00001B74, 0x00001B70, 0x00001C34, 0x00001CF4, 0x00001DB4, 0x00001DB0, 0x00001EB4, 0x00001EB0, 0x00001F74, 0x00001F70,
+            0x00002034, 0x00002030, 0x00002074, 0x00002070, 0x13320834, 0x13328832, 0x13330834, 0x13330832, 0x13348834, 0x13348832,
+            0x13350834, 0x13350832, 0x13370834, 0x13370832, 0x1337082E, 0x13370830, 0x13390834, 0x13390832, 0x133A0834, 0x133A0832,
+            0x133A082E, 0x133A0830, 0x13420834, 0x13420832, 0x13428834, 0x13428832, 0x1342882E, 0x13428830, 0x13430834, 0x13430832,
+            0x1343082E, 0x13430830, 0x13478834, 0x13478832, 0x1347882E, 0x13478830, 0x134C8834, 0x134C8832, 0x134C882E, 0x134C8830,
+            0x134D0834, 0x134D0832, 0x134D082E, 0x134D0830, 0x13520834, 0x13520832, 0x13528834, 0x13528832, 0x13598834, 0x13598832,
+            0x135A0834, 0x135A0832, 0x13630834, 0x13630832, 0x1363082E, 0x13630830, 0x13638834, 0x13638832, 0x1363882E, 0x13638830,
+            0x13688834, 0x13688832, 0x1368882E, 0x13688830, 0x13690834, 0x13690832, 0x1369082E, 0x13690830, 0x136B8834, 0x136B8832,
+            0x136B882E, 0x136B8830, 0x136C0834, 0x136C0832, 0x136C082E, 0x136C0830, 0x136D8834, 0x136D8832, 0x136D882E, 0x136D8830,
+            0x136E0834, 0x136E0832, 0x136E082E, 0x136E0830, 0x13720834, 0x13720832, 0x1372082E, 0x13720830, 0x13780834, 0x13780832,
+            0x1378082E, 0x13780830, 0x137B0834, 0x137B0832, 0x137B082E, 0x137B0830, 0x13860834, 0x13860832, 0x1386082E, 0x13860830,
+            0x138A0834, 0x138A0832, 0x138A082E, 0x138A0830, 0x138C0834, 0x138C0832, 0x138C082E, 0x138C0830, 0x13910834, 0x13910832,
+            0x1391082E, 0x13910830, 0x13940834, 0x13940832, 0x139B0834, 0x139B0832, 0x139B8834, 0x139B8832, 0x139B882E, 0x139B8830,
+            0x13860834, 0x13328834, 0x13860832, 0x13328832, 0x13860834, 0x13330834, 0x13860832, 0x13330832, 0x13860834, 0x13350834,
+            0x13860832, 0x13350832, 0x13860834, 0x13390834, 0x13860832, 0x13390832, 0x01338807, 0x018E8807, 0x01D60807, 0x0FB20806,
+            0x01D68807, 0x01D48807, 0x018B0807, 0x01940807, 0x01D08807, 0x03330807, 0x01118807, 0x01068807, 0x013F0807, 0x01D30807,
+            0x0FCC0806, 0x01200807, 0x011D0807, 0x03350807, 0x01368807, 0x01D00807, 0x0FD10812, 0x0FDE0812, 0x0FEB0812, 0x0FF58812,
+            0x10038812, 0x10210812, 0x10288812, 0x103A8812, 0x10480812, 0x10558812, 0x10620812, 0x106B0812, 0x10848812, 0x108C0812,
+            0x109E0812, 0x10B58812, 0x10C00812, 0x10C98812, 0x10E90812, 0x10FB8812, 0x110B8812, 0x11238812, 0x112C8812, 0x11320812,
+            0x11380812, 0x11430812, 0x01950807, 0x01D38807, 0x01958807, 0x025B8807, 0x01058807, 0x025A0807, 0x0FD10806, 0x0FDE0806,
+            0x0FEB0806, 0x0FF58806, 0x10038806, 0x10210806, 0x10288806, 0x103A8806, 0x10480806, 0x10558806, 0x10620806, 0x106B0806,
+            0x10848806, 0x108C0806, 0x109E0806, 0x10B58806, 0x10C00806, 0x10C98806, 0x10E90806, 0x10FB8806, 0x110B8806, 0x11238806,
+            0x112C8806, 0x11320806, 0x11380806, 0x11430806, 0x01960807, 0x03370807, 0x01968807, 0x03380807, 0x019F0807, 0x01490825,
+            0x01C20825, 0x011B0825, 0x01108825, 0x21848824, 0x216D0820, 0x216F0820, 0x217F0820, 0x21760820, 0x0FB00824, 0x216D0824,
+            0x216F0824, 0x21850824, 0x00000DE4, 0x00000E24, 0x20F90824, 0x20BA8824, 0x21298824, 0x20BB8824, 0x212A8824, 0x20BC0824,
+            0x212C8824, 0x20C78824, 0x20BD8824, 0x20CB0824, 0x20BF0824, 0x20F98824, 0x20FC8824, 0x20FF8824, 0x21028824, 0x0FB18806,
+            0x0FB28806, 0x03368807, 0x025C0807, 0x03378807, 0x0FB30806, 0x0FC00806, 0x04358825, 0x02F60825, 0x02F70825, 0x02F68825,
+            0x02F78825, 0x04848825, 0x049A0825, 0x0EAA8805, 0x7FFE8804, 0x267E0804, 0x26840804, 0x26910804, 0x269A8804, 0x269B8804,
+            0x26A30804, 0x26AA0804, 0x01858805, 0x0EDF0805, 0x08620805, 0x0EF10805, 0x0FCE8804, 0x0EF20805, 0x0EF40805, 0x0EF70805,
+            0x0FCD0804, 0x0EFB0805, 0x0F048805, 0x08668805, 0x0F070805, 0x086F0805, 0x08708805, 0x08770805, 0x08778805, 0x000045C4,
+            0x25608804, 0x256F0804, 0x0F078805, 0x25948804, 0x259C8804, 0x259C0804, 0x0EDC0805, 0x25A48804, 0x12BC8804, 0x12BC8808,
+            0x12BE0808, 0x12C00808, 0x12C30808, 0x12C50808, 0x287F8804, 0x01870805, 0x288E8804, 0x28A08804, 0x01878805, 0x0F108805,
+            0x25B38810, 0x25B38804, 0x26250804, 0x1C9A0810, 0x1C9A0804, 0x26340804, 0x26480804, 0x022F0805, 0x26E78804, 0x27678804,
+            0x27830804, 0x278E0804, 0x27920804, 0x27950804, 0x27958804, 0x27AB8804, 0x27AC8804, 0x27AD0804, 0x28058804, 0x01710805,
+            0x0F198805, 0x27E50804, 0x27EB8832, 0x27EB8804, 0x088E0805, 0x0F120805, 0x27F00832, 0x27F00804, 0x27F08832, 0x27F08804,
+            0x27F20832, 0x27F20804, 0x27F48832, 0x27F48804, 0x27F50832, 0x27F50804, 0x27F58832, 0x27F58804, 0x27F60832, 0x27F60804,
+            0x27F68832, 0x27F68804, 0x27FA0832, 0x27FA0804, 0x0FCE0804, 0x0F130805, 0x27FB0804, 0x28048804, 0x0F148805, 0x131A0804,
+            0x0F180805, 0x01880805, 0x25878804, 0x01850805, 0x2CEB0808, 0x00004608, 0x2CEB8808, 0x00004608, 0x2CEC0808, 0x00004608,
+            0x2CEC8808, 0x00004608, 0x2CED0808, 0x00004608, 0x2CED8808, 0x00004608, 0x2CEE0808, 0x00004608, 0x2CEE0808, 0x00004648,
+            0x2CEE8808, 0x00004608, 0x2CEF0808, 0x00004608, 0x2CEF8808, 0x00004608, 0x2CEF8808, 0x00004648, 0x2CF00808, 0x00004608,
+            0x2CF00808, 0x00004648, 0x2CF08808, 0x00004608, 0x2CF08808, 0x00004648, 0x2CF10808, 0x00004608, 0x2CF18808, 0x00004608,
+            0x2CF20808, 0x00004608, 0x2CF28808, 0x00004648, 0x2CF28808, 0x00004688, 0x2CF30808, 0x00004608, 0x2CF38808, 0x00004608,
+            0x2CF40808, 0x00004608, 0x2CF48808, 0x00004608, 0x2CF48808, 0x00004648, 0x2CF50808, 0x00004608, 0x2CF50808, 0x00004648,
+            0x2CF58808, 0x00004608, 0x2CF60808, 0x00004608, 0x2CF78804, 0x2CEB0804, 0x2CF28808, 0x00004608, 0x2CF30804, 0x0F958805,
+            0x0F900805, 0x2CF68804, 0x0F7A8805, 0x0F7E0805, 0x0F908805, 0x18D78804, 0x18D98804, 0x18DA8804, 0x18DB0804, 0x18DC0804,
+            0x18DD8804, 0x18DF0804, 0x18E08804, 0x18E18804, 0x18EA8804, 0x18DB8804, 0x18E10804, 0x18E00804, 0x18EA0804, 0x00003344,
+            0x00003384, 0x000033C4, 0x18ED0804, 0x0F2F0805, 0x02320805, 0x01590805, 0x02350805, 0x27AD8804, 0x0F160805, 0x27BC0804,
+            0x0F170805, 0x28390804, 0x283C8808, 0x00004648, 0x283D0804, 0x0F1C0805, 0x02378805, 0x27CA8804, 0x27E10808, 0x00004608,
+            0x27E18804, 0x02370805, 0x01718805, 0x28108804, 0x0F1D8805, 0x281B8804, 0x0F1F8805, 0x28250804, 0x023B0805, 0x0F218805,
+            0x1E460804, 0x1E460808, 0x00004608, 0x1E468804, 0x1E470808, 0x00004608, 0x1E478804, 0x1E488808, 0x00004608, 0x1E490804,
+            0x1E490808, 0x00004608, 0x1E498804, 0x1E498808, 0x00004608, 0x1E4A0804, 0x1E4A0808, 0x00004608, 0x1E4A8804, 0x1E4A8808,
+            0x00004608, 0x1E4B0804, 0x1E4B0808, 0x00004608, 0x1E4B8804, 0x1E4C0808, 0x00004608, 0x1E4C8804, 0x1E4C8808, 0x00004608,
+            0x1E4D0804, 0x1E4D0808, 0x00004608, 0x1E4D8804, 0x1E4D8808, 0x00004608, 0x1E4E0804, 0x1E4E0808, 0x00004608, 0x1E4E8804,
+            0x1E4E8808, 0x00004608, 0x1E4F0804, 0x1E510808, 0x00004608, 0x1E518804, 0x1E518808, 0x00004608, 0x1E520804, 0x1E520808,
+            0x00004608, 0x1E528804, 0x1E528808, 0x00004608, 0x1E530804, 0x1E538808, 0x00004608, 0x1E540804, 0x1E558808, 0x00004608,
+            0x1E560804, 0x1E560808, 0x00004608, 0x1E568804, 0x1E568808, 0x00004608, 0x1E570804, 0x1E570808, 0x00004608, 0x1E578804,
+            0x1E578808, 0x00004608, 0x1E580804, 0x1E598808, 0x00004608, 0x1E5A0804, 0x1E5A0808, 0x00004608, 0x1E5A8804, 0x1E5A8808,
+            0x00004608, 0x1E5B0804, 0x1E5B0808, 0x00004608, 0x1E5B8804, 0x1E318810, 0x1E318814, 0x00004608, 0x1E320810, 0x1E358814,
+            0x00004608, 0x1E358814, 0x00004648, 0x1E360810, 0x1E380814, 0x00004608, 0x1E388810, 0x1E3D0814, 0x00004608, 0x1E3D8810,
+            0x1E3D8814, 0x00004608, 0x1E3D8814, 0x00004648, 0x1E3E0810, 0x1E3F0814, 0x00004608, 0x1E3F8810, 0x1E428814, 0x00004608,
+            0x1E430810, 0x1E430814, 0x00004608, 0x1E438810, 0x1E318804, 0x1E318808, 0x00004608, 0x1E320804, 0x1E358808, 0x00004608,
+            0x1E358808, 0x00004648, 0x1E360804, 0x1E380808, 0x00004608, 0x1E388804, 0x1E3D0808, 0x00004608, 0x1E3D8804, 0x1E3D8808,
+            0x00004608, 0x1E3D8808, 0x00004648, 0x1E3E0804, 0x1E3F0808, 0x00004608, 0x1E3F8804, 0x1E428808, 0x00004608, 0x1E430804,
+            0x1E430808, 0x00004608, 0x1E438804, 0x0EDD0805, 0x1B0D8804, 0x1B108804, 0x1B0E0804, 0x1B1E8804, 0x0ED08805, 0x285F0804,
+            0x28700804, 0x28748804, 0x01110805, 0x286F8804, 0x28740804, 0x284B0804, 0x284B0832, 0x284B8804, 0x284B8832, 0x284C0804,
+            0x284C8832, 0x284D0804, 0x28508832, 0x28508808, 0x00004648, 0x28510804, 0x28518808, 0x00004648, 0x28520804, 0x28528832,
+            0x28528808, 0x00004648, 0x28530804, 0x28540832, 0x28540808, 0x00004648, 0x0F230805, 0x28518808, 0x28530808, 0x28548804,
+            0x285D0808, 0x00004648, 0x0F258805, 0x01748805, 0x28750804, 0x0F270805, 0x282E0804, 0x28310808, 0x28328808, 0x18CC8804,
+            0x18B50804, 0x18CD8804, 0x015A0805, 0x022F8805, 0x0F298805, 0x18D70804, 0x16A38804, 0x16AE8804, 0x00003084, 0x16AF0804,
+            0x16AF0804, 0x00003084, 0x16AF8804, 0x16B38804, 0x00003084, 0x16B68804, 0x023D0805, 0x01770805, 0x015B0805, 0x26620804,
+            0x1B1F8804, 0x1B308804, 0x1B328804, 0x1B378804, 0x1B380804, 0x1B398804, 0x01780805, 0x015C0805, 0x013D0805, 0x1B320804,
+            0x1B388804, 0x1B300804, 0x16BD8804, 0x16CE0804, 0x023E0805, 0x16CD8804, 0x16D08804, 0x16EA8804, 0x16F00804, 0x16E88804,
+            0x16CF8804, 0x015D0805, 0x023F8805, 0x01788805, 0x00003404, 0x00003444, 0x023F0805, 0x16EF8804, 0x16D00804, 0x02400805,
+            0x16EA0804, 0x02408805, 0x01790805, 0x0F368805, 0x16F20804, 0x16FB0804, 0x170B8804, 0x015E0805, 0x02410805, 0x17288804,
+            0x172B8804, 0x172D0804, 0x172D8804, 0x172F8804, 0x17370804, 0x172A8804, 0x173A0804, 0x017A0805, 0x170C0804, 0x17238804,
+            0x17280804, 0x173B8804, 0x173F8804, 0x17408804, 0x17418804, 0x174C8804, 0x17500804, 0x17510804, 0x17538804, 0x17550804,
+            0x17598804, 0x175A0804, 0x175A8804, 0x173B0804, 0x175C0804, 0x175C8804, 0x17540804, 0x173F0804, 0x17400804, 0x17588804,
+            0x175E0804, 0x177B0804, 0x17788804, 0x177A0804, 0x175D0804, 0x015F0805, 0x02430805, 0x02440805, 0x02438805, 0x02450805,
+            0x02458805, 0x177A8804, 0x17790804, 0x17828804, 0x179B8804, 0x17A00804, 0x17A08804, 0x17A30804, 0x179A8804, 0x02460805,
+            0x17820804, 0x17A38804, 0x17BE8804, 0x17BF0804, 0x17BF8804, 0x17C08804, 0x02468805, 0x01600805, 0x02470805, 0x17A48808,
+            0x00004608, 0x17A48808, 0x00004648, 0x17A50808, 0x00004608, 0x17A58808, 0x00004608, 0x17BC8808, 0x00004608, 0x17BD0808,
+            0x00004608, 0x17C10804, 0x17DF8804, 0x01610805, 0x02510805, 0x17E00804, 0x01F98805, 0x17E08804, 0x17E70804, 0x17E88804,
+            0x17E60804, 0x17E58804, 0x17E68804, 0x17F60804, 0x17F68804, 0x17E80804, 0x18528804, 0x18548808, 0x00004608, 0x18550804,
+            0x185C8808, 0x00004608, 0x185D0804, 0x18560808, 0x00004608, 0x18648804, 0x185E8804, 0x0F288805, 0x01620805, 0x017A8805,
+            0x02CF0805, 0x18368804, 0x18520804, 0x02518805, 0x24D78810, 0x24D78804, 0x0F3C0805, 0x24D70804, 0x17FB8804, 0x17FF0804,
+            0x17FF8804, 0x18028804, 0x18040804, 0x18050804, 0x180C8804, 0x180D8804, 0x180E8804, 0x18150804, 0x18158804, 0x18168804,
+            0x18020804, 0x180C0804, 0x180D0804, 0x180E0804, 0x01630805, 0x02520805, 0x017B0805, 0x18178804, 0x181B8804, 0x18300804,
+            0x18338804, 0x18348804, 0x18360804, 0x182F0804, 0x02528805, 0x182F8804, 0x18340804, 0x19B08804, 0x199C8804, 0x199D8804,
+            0x199D0804, 0x19B60804, 0x19AD082E, 0x19AC8832, 0x02130805, 0x19B68804, 0x19B70804, 0x19BA0804, 0x19BB0804, 0x19BA8804,
+            0x19BB8804, 0x19B90804, 0x19BC8804, 0x19BE0804, 0x19BD8804, 0x19D10804, 0x19CD882E, 0x19CF082E, 0x19D0082E, 0x19BD0832,
+            0x19BE0832, 0x19BF8832, 0x19C50832, 0x19C70832, 0x19C98832, 0x19CD8832, 0x19CF0832, 0x19D00832, 0x19CC8832, 0x00003484,
+            0x19D20804, 0x02170805, 0x19D28804, 0x02188805, 0x24EB0804, 0x24E78804, 0x24F58804, 0x24F90804, 0x24F68804, 0x24F98804,
+            0x24FC8804, 0x24FB8804, 0x25028804, 0x24FD0804, 0x24FC0804, 0x25030804, 0x25008804, 0x24FF8804, 0x25010804, 0x25000804,
+            0x24FA0804, 0x25038804, 0x24FB0804, 0x24FA8804, 0x24FE8804, 0x24FD8804, 0x25018804, 0x24FF0804, 0x24FE0804, 0x25020804,
+            0x18ED8804, 0x18F20804, 0x19050804, 0x19090804, 0x190B0804, 0x19048804, 0x01638805, 0x02358805, 0x0F318805, 0x021B0805,
+            0x19D30804, 0x19D40804, 0x19D50804, 0x19D60804, 0x19D70804, 0x19D80804, 0x19D90804, 0x19DA0804, 0x19DB0804, 0x19DC0804,
+            0x19DD0804, 0x19DE0804, 0x19DF0804, 0x19E00804, 0x19E10804, 0x19E20804, 0x19E30804, 0x19E40804, 0x19E50804, 0x19E60804,
+            0x19E70804, 0x19E80804, 0x19E90804, 0x19EA8804, 0x19EB8804, 0x19EC8804, 0x19ED8804, 0x19EE8804, 0x19EF8804, 0x19D38804,
+            0x19D48804, 0x19D58804, 0x19D68804, 0x19D78804, 0x19D88804, 0x19D98804, 0x19DA8804, 0x19DB8804, 0x19DC8804, 0x19DD8804,
+            0x19DE8804, 0x19DF8804, 0x19E08804, 0x19E18804, 0x19E28804, 0x19E38804, 0x19E48804, 0x19E58804, 0x19E68804, 0x19E78804,
+            0x19E88804, 0x19EA0804, 0x19EB0804, 0x19EC0804, 0x19ED0804, 0x19EE0804, 0x19EF0804, 0x19F00804, 0x18660804, 0x18698804,
+            0x186A8804, 0x18808804, 0x18810804, 0x18820804, 0x18828804, 0x1878082E, 0x18780832, 0x18840804, 0x18870804, 0x18880804,
+            0x189A8804, 0x189B8804, 0x189C8804, 0x18838804, 0x1A788804, 0x017B8805, 0x24890804, 0x0EB58805, 0x02A80805, 0x0FB88804,
+            0x02AC0805, 0x02530805, 0x28A48804, 0x29248804, 0x29A48804, 0x29D70804, 0x29D60804, 0x2A0F8804, 0x0FCD8804, 0x0F960805,
+            0x0FCF8804, 0x0FD00804, 0x0FD08804, 0x0F970805, 0x01888805, 0x2A718804, 0x2AD38804, 0x2B538804, 0x2BD38804, 0x2C538804,
+            0x2CD38804, 0x2CF88804, 0x2D788804, 0x2DF88804, 0x1F0B0804, 0x1F8B0804, 0x200B0804, 0x266E8804, 0x01648805, 0x20278804,
+            0x00002E04, 0x00002E44, 0x00002E84, 0x00002EC4, 0x00002F04, 0x01478805, 0x25040804, 0x00003D84, 0x00003DC4, 0x00003E04,
+            0x00003E44, 0x00003E84, 0x00003EC4, 0x00003F04, 0x02538805, 0x088F0805, 0x251C0804, 0x0FA98804, 0x02560805, 0x08910805,
+            0x0F408805, 0x251D0804, 0x25278804, 0x20990810, 0x20990804, 0x0F440805, 0x0FCC8808, 0x00004608, 0x0FCD0808, 0x00004608,
+            0x0FCD8804, 0x00004604, 0x011A8805, 0x01480805, 0x02568805, 0x248E8804, 0x24910804, 0x24910808, 0x24920804, 0x24960804,
+            0x24978804, 0x24978808, 0x24990804, 0x24A08808, 0x24A18804, 0x24A88804, 0x24A98804, 0x24AD0804, 0x24AE8808, 0x24AF8804,
+            0x24908804, 0x24A90804, 0x24A80804, 0x24958804, 0x24AC8804, 0x24970804, 0x24B40804, 0x24B20804, 0x24B48804, 0x24B78804,
+            0x24BA0804, 0x24BC8804, 0x24BF8804, 0x24C48804, 0x24C78804, 0x24C98804, 0x24C38804, 0x24C70804, 0x24B70804, 0x24C90804,
+            0x24B98804, 0x24BC0804, 0x24C88804, 0x24BF0804, 0x24C40804, 0x24CE8804, 0x0FAC8804, 0x011C8805, 0x0FAD8804, 0x000041C4,
+            0x00004204, 0x216E8822, 0x218C0804, 0x21858804, 0x218C8804, 0x220C8804, 0x2183881A, 0x2183881E, 0x25DF8804, 0x26150804,
+            0x261B8804, 0x26200804, 0x098A0805, 0x01488805, 0x08920805, 0x090D0805, 0x092A0805, 0x09220805, 0x092A8805, 0x09390805,
+            0x00000000, 0x09398805, 0x00000000, 0x09398805, 0x00000000, 0x00000000, 0x093C8805, 0x093E0805, 0x093F0805, 0x094E0805,
+            0x09538805, 0x00000000, 0x09540805, 0x00000000, 0x09538805, 0x00000000, 0x00000000, 0x09540805, 0x00000000, 0x00000000,
+            0x09548805, 0x09688805, 0x09898805, 0x0F490805, 0x081B0805, 0x0F9E8805, 0x0FD10816, 0x10288816, 0x10558816, 0x10620816,
+            0x109E0816, 0x10E90816, 0x10FB8816, 0x110B8816, 0x11238816, 0x112C8816, 0x11320816, 0x11380816, 0x0FD1080A, 0x0FDE080A,
+            0x0FEB080A, 0x1021080A, 0x1062080A, 0x1084880A, 0x108C080A, 0x10B5880A, 0x10C0080A, 0x10C9880A, 0x10E9080A, 0x10FB880A,
+            0x110B880A, 0x1123880A, 0x112C880A, 0x1132080A, 0x1138080A, 0x1143080A, 0x104A080A, 0x1057880A, 0x118F0816, 0x11910816,
+            0x11938816, 0x11948816, 0x11968816, 0x11980816, 0x119C8816, 0x11950816, 0x119E0816, 0x11A00816, 0x11A30816, 0x032E080B,
+            0x118F080A, 0x1191080A, 0x1193880A, 0x1194880A, 0x1196880A, 0x1198080A, 0x119C880A, 0x119E080A, 0x11A0080A, 0x11A3080A,
+            0x032C080B, 0x1191880A, 0x1195080A, 0x11A1080A, 0x11920816, 0x1192080A, 0x0FCC080A, 0x0D7F8805, 0x0DFF8805, 0x0E7F8805,
+            0x0E818805, 0x0E858805, 0x0E8C8805, 0x02578805, 0x12A50808, 0x12A90808, 0x12B28808, 0x12B68808, 0x12B80808, 0x25310804,
+            0x25478804, 0x0FAA8804, 0x254A0804, 0x08918805, 0x254A8804, 0x00003F44, 0x00003F84, 0x00003FC4, 0x00004004, 0x0FBB8804,
+            0x20368804, 0x20A90810, 0x20A90804, 0x00002F44, 0x00002FC4, 0x00003004, 0x00003044, 0x00002F84, 0x20BA0804, 0x01360805,
+            0x013D8805, 0x0F4E0805, 0x098A8805, 0x0F628805, 0x0FC88804, 0x0F640805, 0x0F650805, 0x098B0805, 0x0FCD8808, 0x00004608,
+            0x0FCE0808, 0x00004608, 0x0FCE8808, 0x00004608, 0x0FCF0808, 0x00004608, 0x0FCF8808, 0x00004608, 0x0FD00808, 0x00004608,
+            0x0FD08808, 0x00004608, 0x0F770805, 0x1339080A, 0x133A080A, 0x1347880A, 0x1352080A, 0x1394080A, 0x135A080A, 0x134C880A,
+            0x136B880A, 0x139B880A, 0x137B080A, 0x1386080A, 0x138A080A, 0x138C080A, 0x1363080A, 0x136D880A, 0x1372080A, 0x1368880A,
+            0x1378080A, 0x1359880A, 0x1363880A, 0x1342880A, 0x134D080A, 0x1352880A, 0x1369080A, 0x136C080A, 0x136E080A, 0x1339880A,
+            0x138C880A, 0x1372880A, 0x1377880A, 0x1391080A, 0x02978805, 0x098B8805, 0x09A18805, 0x09D38805, 0x09DB0805, 0x09E28805,
+            0x09EA0805, 0x0FCC0808, 0x013F0809, 0x0FCC0808, 0x01118809, 0x0FCC8808, 0x01118809, 0x0FCD0808, 0x01118809, 0x0FCD8808,
+            0x01118809, 0x0FCE0808, 0x01118809, 0x0FCE8808, 0x01118809, 0x0FCF0808, 0x01118809, 0x0FCF8808, 0x01118809, 0x0FD00808,
+            0x01118809, 0x0FD08808, 0x01118809, 0x0A2D8805, 0x01940809, 0x0FD10814, 0x01948809, 0x01940809, 0x0FDE0814, 0x01948809,
+            0x01940809, 0x0FEB0814, 0x01948809, 0x01940809, 0x0FF58814, 0x01948809, 0x01940809, 0x10038814, 0x01948809, 0x01940809,
+            0x10210814, 0x01948809, 0x01940809, 0x10288814, 0x01948809, 0x01940809, 0x103A8814, 0x01948809, 0x01940809, 0x10480814,
+            0x01948809, 0x01940809, 0x10558814, 0x01948809, 0x01940809, 0x10620814, 0x01948809, 0x01940809, 0x106B0814, 0x01948809,
+            0x01940809, 0x10848814, 0x01948809, 0x01940809, 0x108C0814, 0x01948809, 0x01940809, 0x109E0814, 0x01948809, 0x01940809,
+            0x10B58814, 0x01948809, 0x01940809, 0x10C00814, 0x01948809, 0x01940809, 0x10C98814, 0x01948809, 0x01940809, 0x10E90814,
+            0x01948809, 0x01940809, 0x10FB8814, 0x01948809, 0x01940809, 0x110B8814, 0x01948809, 0x01940809, 0x11238814, 0x01948809,
+            0x01940809, 0x112C8814, 0x01948809, 0x01940809, 0x11320814, 0x01948809, 0x01940809, 0x11380814, 0x01948809, 0x01940809,
+            0x11430814, 0x01948809, 0x01C50809, 0x10E90814, 0x01C58809, 0x0FEB0818, 0x0FF58818, 0x112C8818, 0x11430818, 0x02E98805,
+            0x0FEB083A, 0x1021083A, 0x10C0083A, 0x10E9083A, 0x1132083A, 0x1138083A, 0x1143083A, 0x103A883A, 0x1123883A, 0x10E9083A,
+            0x0FF5883A, 0x10E9083A, 0x10E9083A, 0x10B5883A, 0x10B5883A, 0x1123883A, 0x112C883A, 0x0FEB083A, 0x10848828, 0x0FEB0828,
+            0x10848828, 0x0FF58828, 0x10848828, 0x10C98828, 0x0A2F0805, 0x1048083A, 0x0FEB083A, 0x10B5883A, 0x0FD1083A, 0x10E9083A,
+            0x0FD1083A, 0x0FD1083A, 0x0FDE083A, 0x0FF5883A, 0x1055883A, 0x0FEB083A, 0x106B083A, 0x0FEB083A, 0x109E083A, 0x109E083A,
+            0x106B083A, 0x1021083A, 0x10C9883A, 0x1003883A, 0x1003883A, 0x1048083A, 0x0FF5883A, 0x108C083A, 0x1003883A, 0x112C883A,
+            0x108C083A, 0x1028883A, 0x109E083A, 0x1062083A, 0x10E9083A, 0x109E083A, 0x10E9083A, 0x110B883A, 0x10B5883A, 0x01338839,
+            0x1123883A, 0x10E9083A, 0x0FCD8838, 0x0FF5883A, 0x0FCD0838, 0x108C0838, 0x0FF58838, 0x01048839, 0x10E9083A, 0x0FEB0838,
+            0x10C98838, 0x0FCD0838, 0x1062083A, 0x0FCE0838, 0x1062083A, 0x0FD00838, 0x1062083A, 0x0FCE8838, 0x013F0839, 0x0FCC8838,
+            0x0FCF8838, 0x013F0839, 0x0FCC8838, 0x0FCD0838, 0x0FCD0838, 0x013F0839, 0x0FCD0838, 0x0FCF0838, 0x0FCC0838, 0x10B5883A,
+            0x0FCC8838, 0x0FCD0838, 0x0FCC0838, 0x10B5883A, 0x0FF58838, 0x103A883A, 0x0FEB0838, 0x103A883A, 0x0FF58838, 0x10C9883A,
+            0x103A883A, 0x10480838, 0x01048839, 0x10C9883A, 0x10038838, 0x10E90838, 0x106B083A, 0x109E0838, 0x10E90838, 0x10E90838,
+            0x106B0838, 0x10038838, 0x10E90838, 0x10E90838, 0x10E9083A, 0x103A883A, 0x1123883A, 0x110B883A, 0x103A883A, 0x0FF5883A,
+            0x1123883A, 0x109E083A, 0x0FF5883A, 0x02EA8805, 0x05910805, 0x217C0838, 0x21700838, 0x21720838, 0x21720838, 0x21728838,
+            0x7DA00838, 0x71258000, 0x7DA00838, 0x6DAB8000, 0x7DA00838, 0x69E60000, 0x21768838, 0x00000DF8, 0x7DA00838, 0x67460000,
+            0x7DA00838, 0x6C8D0000, 0x7DA08838, 0x44F18000, 0x7DA00838, 0x6C948000, 0x7DA00838, 0x67520000, 0x7DA00838, 0x73100000,
+            0x7DA00838, 0x78908000, 0x7DA00838, 0x72CC8000, 0x7DA00838, 0x69268000, 0x7DA00838, 0x6FC60000, 0x7DA00838, 0x68C68000,
+            0x7DA00838, 0x72D80000, 0x7DA00838, 0x690E8000, 0x7DA00838, 0x7EA10000, 0x7DA00838, 0x7A8F8000, 0x7DA08838, 0x46548000,
+            0x7DA00838, 0x6C780000, 0x7DA00838, 0x6A1C8000, 0x7DA00838, 0x778A0000, 0x7DA00838, 0x714A8000, 0x7DA00838, 0x71AA8000,
+            0x7DA00838, 0x67000000, 0x7DA00838, 0x67048000, 0x7DA08838, 0x48250000, 0x7DA00838, 0x6EF30000, 0x7DA00838, 0x67168000,
+            0x7DA00838, 0x69F98000, 0x7DA00838, 0x71838000, 0x7DA08838, 0x46B80000, 0x7DA00838, 0x71298000, 0x7DA00838, 0x7CC08000,
+            0x7DA00838, 0x7D3D0000, 0x7DA00838, 0x6A040000, 0x7DA00838, 0x77400000, 0x7DA00838, 0x73848000, 0x7DA00838, 0x73840000,
+            0x7DA00838, 0x7A998000, 0x7DA00838, 0x69390000, 0x7DA00838, 0x6ADB0000, 0x7DA08838, 0x48A68000, 0x01C50809, 0x7DA00808,
+            0x73960000, 0x01C58809, 0x01C50809, 0x7DA00808, 0x67048000, 0x01C58809, 0x01C50809, 0x7DA00808, 0x67460000, 0x01C58809,
+            0x01C50809, 0x7DA00808, 0x6DC48000, 0x01C58809, 0x01C50809, 0x7DA00808, 0x785C8000, 0x01C58809, 0x01C50809, 0x7DA00808,
+            0x71298000, 0x01C58809, 0x01C50809, 0x7DA00808, 0x7B6B8000, 0x01C58809, 0x01C50809, 0x7DA00808, 0x696E8000, 0x01C58809,
+            0x01C50809, 0x7DA00808, 0x72AB8000, 0x01C58809, 0x7DA0080C, 0x6FCB8000, 0x7DA0080C, 0x69F78000, 0x0A308805, 0x0A338805,
+            0x0AB38805, 0x0B338805, 0x0C4F0805, 0x0CBB0805, 0x0CC18805, 0x0CC80805, 0x0D020805, 0x0D2E8805, 0x0D348805, 0x0D3A8805,
+            0x0D568805, 0x0D5B8805, 0x0D6F8805, 0x0D7E8805, 0x0BB38805, 0x0BF00805, 0x0C190805, 0x09FC8805, 0x0A268805, 0x0C328805,
+            0x0C350805, 0x0C368805, 0x0C3A0805, 0x0C468805, 0x0C4A0805, 0x0C4B8805, 0x04B48805, 0x04FE0805, 0x7DA00804, 0x671E8000,
+            0x7DA00804, 0x671C0000, 0x7DA00804, 0x67208000, 0x7DC20804, 0x40910000, 0x7DA00804, 0x67B00000, 0x7DA00804, 0x67DD8000,
+            0x7DA00804, 0x68010000, 0x7DA00804, 0x683D0000, 0x7DA00804, 0x684C8000, 0x7DA00804, 0x68678000, 0x7DC00804, 0x5A4F0000,
+            0x7DC20804, 0x431D0000, 0x7DA00804, 0x68AA0000, 0x7DA00804, 0x68B20000, 0x7DA00804, 0x68BB8000, 0x7DC20804, 0x428E0000,
+            0x7DC00804, 0x5A5C8000, 0x7DA00804, 0x68B38000, 0x7DA00804, 0x68C68000, 0x7DC20804, 0x42A58000, 0x7DA00804, 0x68CB8000,
+            0x7DA00804, 0x68D20000, 0x7DA00804, 0x67660000, 0x7DA00804, 0x68D60000, 0x7DC28804, 0x48EF8000, 0x7DA00804, 0x68FA8000,
+            0x7DA00804, 0x69018000, 0x7DC00804, 0x5A6F8000, 0x7DA00804, 0x691D8000, 0x7DA00804, 0x69230000, 0x7DA00804, 0x69390000,
+            0x7DA00804, 0x693B8000, 0x7DC00804, 0x5A8A8000, 0x7DA00804, 0x69828000, 0x7DA00804, 0x69830000, 0x7DA00804, 0x69A48000,
+            0x7DA00804, 0x69AD0000, 0x7DA00804, 0x69B98000, 0x7DA00804, 0x69BE8000, 0x7DA00804, 0x69BF8000, 0x7DC20804, 0x45160000,
+            0x7DA00804, 0x78380000, 0x7DA00804, 0x69E50000, 0x7DA00804, 0x69EF8000, 0x7DC20804, 0x45B18000, 0x7DA00804, 0x69F58000,
+            0x7DA00804, 0x69F88000, 0x7DA00804, 0x6A030000, 0x7DA00804, 0x6A4F0000, 0x7DA00804, 0x6A1C0000, 0x7DA00804, 0x6A240000,
+            0x7DA00804, 0x6A340000, 0x7DA00804, 0x6A510000, 0x7DA00804, 0x6A7B0000, 0x7DA00804, 0x6A880000, 0x7DA00804, 0x6AA98000,
+            0x7DA00804, 0x6AB18000, 0x7DA00804, 0x6AC20000, 0x7DA00804, 0x6AD58000, 0x7DA00804, 0x6AD98000, 0x7DA00804, 0x6AE10000,
+            0x7DA00804, 0x6B8B0000, 0x7DA00804, 0x6B8B8000, 0x7DA00804, 0x6B288000, 0x7DA00804, 0x6B3A0000, 0x7DA00804, 0x6C770000,
+            0x7DA00804, 0x6BE70000, 0x7DA00804, 0x6BFA0000, 0x7DA00804, 0x6C068000, 0x7DA00804, 0x6BC58000, 0x7DA00804, 0x6C190000,
+            0x7DA00804, 0x6C188000, 0x7DA00804, 0x6C560000, 0x7DC20804, 0x4A720000, 0x7DA00804, 0x6C790000, 0x7DA00804, 0x6C7B8000,
+            0x7DA00804, 0x6C830000, 0x7DA00804, 0x6C8D0000, 0x7DA00804, 0x6C910000, 0x7DA00804, 0x6CB10000, 0x7DC20804, 0x4B540000,
+            0x7DC20804, 0x4B750000, 0x7DA00804, 0x6CF60000, 0x7DA00804, 0x6D0D8000, 0x7DA00804, 0x6D138000, 0x7DA00804, 0x6CEC0000,
+            0x7DA00804, 0x6D330000, 0x7DC00804, 0x5B770000, 0x7DC00804, 0x5B7E0000, 0x7DA00804, 0x6D840000, 0x7DA00804, 0x6D9F0000,
+            0x7DC20804, 0x4CE40000, 0x7DA00804, 0x6DE18000, 0x7DA00804, 0x6DEC0000, 0x7DA00804, 0x6DF98000, 0x7DC20804, 0x4D8C0000,
+            0x7DA00804, 0x6DFF8000, 0x7DA00804, 0x6E030000, 0x7DA00804, 0x6FA98000, 0x7DA00804, 0x6E110000, 0x7DC00804, 0x5BC08000,
+            0x7DA00804, 0x6E300000, 0x7DA00804, 0x6E600000, 0x7DA00804, 0x6E468000, 0x7DC20804, 0x4EF20000, 0x7DA00804, 0x6EA18000,
+            0x7DC20804, 0x4EF30000, 0x7DA00804, 0x6EB70000, 0x7DA00804, 0x6EB58000, 0x7DA00804, 0x6EBE0000, 0x7DA00804, 0x6EF08000,
+            0x7DA00804, 0x6EF10000, 0x7DC00804, 0x5C178000, 0x7DA00804, 0x6EFE8000, 0x7DA00804, 0x6F140000, 0x7DA00804, 0x6F1E8000,
+            0x7DA00804, 0x6F348000, 0x7DC00804, 0x5C310000, 0x7DC20804, 0x50C18000, 0x7DC00804, 0x5C3E0000, 0x7DA00804, 0x6F580000,
+            0x7DA00804, 0x6F598000, 0x7DA00804, 0x6F5B0000, 0x7DC28804, 0x51C90000, 0x7DA00804, 0x6F7F0000, 0x7DC20804, 0x51988000,
+            0x7DA08804, 0x41008000, 0x7DA00804, 0x6F910000, 0x7DC00804, 0x5C638000, 0x7DC20804, 0x595C0000, 0x7DC20804, 0x70ED0000,
+            0x7DA00804, 0x6FB10000, 0x7DA00804, 0x6FB58000, 0x7DC00804, 0x5C718000, 0x7DA00804, 0x6FCD0000, 0x7DA00804, 0x6FE68000,
+            0x7DA00804, 0x6FEB8000, 0x7DA00804, 0x6FFC8000, 0x7DA00804, 0x70408000, 0x7DC00804, 0x5C9D0000, 0x7DC00804, 0x5C8E0000,
+            0x7DC20804, 0x536A0000, 0x7DA00804, 0x70638000, 0x7DA00804, 0x70A40000, 0x7DA00804, 0x70A60000, 0x7DA00804, 0x70BD0000,
+            0x7DA00804, 0x70D90000, 0x7DA00804, 0x70D20000, 0x7DA00804, 0x70D78000, 0x7DA00804, 0x70EF0000, 0x7DA00804, 0x71080000,
+            0x7DA00804, 0x710D8000, 0x7DA00804, 0x712E8000, 0x7DA00804, 0x71588000, 0x7DA00804, 0x716A0000, 0x7DA00804, 0x71A80000,
+            0x7DC20804, 0x55860000, 0x7DA00804, 0x719E8000, 0x7DA00804, 0x717E0000, 0x7DA00804, 0x71B40000, 0x7DA00804, 0x71C18000,
+            0x7DA00804, 0x71F20000, 0x7DC20804, 0x55F88000, 0x7DA00804, 0x72110000, 0x7DA00804, 0x71E28000, 0x7DA00804, 0x71D48000,
+            0x7DC00804, 0x5D170000, 0x7DA00804, 0x72348000, 0x7DA00804, 0x723F0000, 0x7DA00804, 0x724E8000, 0x7DA00804, 0x723B8000,
+            0x7DC00804, 0x5D360000, 0x7DA00804, 0x72B60000, 0x7DC20804, 0x58050000, 0x7DA00804, 0x72F18000, 0x7DA00804, 0x737C0000,
+            0x7DA00804, 0x73248000, 0x7DC00804, 0x5D8C8000, 0x7DC00804, 0x5D840000, 0x7DC00804, 0x5D720000, 0x7DA00804, 0x68C90000,
+            0x7DA00804, 0x68CA8000, 0x7DA00804, 0x73800000, 0x7DA00804, 0x734E0000, 0x7DA08804, 0x40568000, 0x7DC00804, 0x61EC8000,
+            0x7DA00804, 0x73908000, 0x7DA00804, 0x73AF0000, 0x7DA00804, 0x73A98000, 0x7DC20804, 0x59E18000, 0x7DC00804, 0x5DA48000,
+            0x7DA00804, 0x73FD0000, 0x7DA00804, 0x73C28000, 0x7DA00804, 0x74290000, 0x7DC20804, 0x5A368000, 0x7DA00804, 0x74470000,
+            0x7DA00804, 0x740F8000, 0x7DA00804, 0x748A0000, 0x7DA00804, 0x74A10000, 0x7DA00804, 0x74D18000, 0x7DA00804, 0x74F50000,
+            0x7DA00804, 0x75540000, 0x7DC20804, 0x5B518000, 0x7DA00804, 0x756D8000, 0x7DC00804, 0x5E0C0000, 0x7DA00804, 0x75908000,
+            0x7DC20804, 0x5C538000, 0x7DA00804, 0x75AA0000, 0x7DC00804, 0x5E270000, 0x7DA00804, 0x75B90000, 0x7DA00804, 0x75CF8000,
+            0x7DA00804, 0x75DD8000, 0x7DC20804, 0x5D468000, 0x7DC20804, 0x4E858000, 0x7DC20804, 0x5D7D0000, 0x7DA00804, 0x76270000,
+            0x7DC20804, 0x5E5E0000, 0x7DA00804, 0x765F8000, 0x7DA00804, 0x76668000, 0x7DA00804, 0x76338000, 0x7DA00804, 0x768B0000,
+            0x7DA00804, 0x769F0000, 0x7DA00804, 0x76B48000, 0x7DA00804, 0x76BC0000, 0x7DA00804, 0x76C28000, 0x7DC20804, 0x5E8F0000,
+            0x7DA00804, 0x769A0000, 0x7DA00804, 0x77178000, 0x7DA00804, 0x77370000, 0x7DC00804, 0x5E998000, 0x7DA00804, 0x77638000,
+            0x7DC20804, 0x5F688000, 0x7DA00804, 0x76FC8000, 0x7DA00804, 0x77B70000, 0x7DC20804, 0x5FAF0000, 0x7DC20804, 0x5FC70000,
+            0x7DA00804, 0x77E30000, 0x7DA00804, 0x781C8000, 0x7DA00804, 0x780D8000, 0x7DC00804, 0x5ECB0000, 0x7DA00804, 0x78250000,
+            0x7DA00804, 0x783E8000, 0x7DA00804, 0x783B8000, 0x7DA00804, 0x78568000, 0x7DC20804, 0x42928000, 0x7DA00804, 0x78A28000,
+            0x7DC20804, 0x61318000, 0x7DA00804, 0x78CE0000, 0x7DC20804, 0x61D58000, 0x7DA00804, 0x79140000, 0x7DA00804, 0x79280000,
+            0x7DC20804, 0x63040000, 0x7DA00804, 0x79400000, 0x7DA00804, 0x794A8000, 0x7DC20804, 0x639A8000, 0x7DC20804, 0x640A0000,
+            0x7DA00804, 0x79BD0000, 0x7DA00804, 0x79C58000, 0x7DC00804, 0x5F560000, 0x7DA00804, 0x79D28000, 0x7DC00804, 0x5F5C0000,
+            0x7DA00804, 0x7A238000, 0x7DA00804, 0x7A2E0000, 0x7DA00804, 0x7A428000, 0x7DA00804, 0x7A650000, 0x7DC00804, 0x5F8D8000,
+            0x7DA00804, 0x7A920000, 0x7DC20804, 0x661B0000, 0x7DA00804, 0x7A9F0000, 0x7DC20804, 0x66490000, 0x7DC20804, 0x50CF8000,
+            0x7DA00804, 0x7B080000, 0x7DC20804, 0x67D08000, 0x7DC20804, 0x67DC0000, 0x7DC20804, 0x68220000, 0x7DC00804, 0x5FFE0000,
+            0x7DC00804, 0x60040000, 0x7DC20804, 0x68798000, 0x7DC20804, 0x68790000, 0x7DC20804, 0x688C8000, 0x7DC20804, 0x68998000,
+            0x7DA00804, 0x7B8F0000, 0x7DA00804, 0x7B8F8000, 0x7DA00804, 0x7BC58000, 0x7DC00804, 0x60230000, 0x7DC00804, 0x604B0000,
+            0x7DC20804, 0x6A0E8000, 0x7DA00804, 0x7C270000, 0x7DC00804, 0x60718000, 0x7DC20804, 0x6B130000, 0x7DC20804, 0x6B4D0000,
+            0x7DC20804, 0x6B628000, 0x7DA00804, 0x7CF58000, 0x7DC00804, 0x60978000, 0x7DA00804, 0x7D250000, 0x7DA00804, 0x7D278000,
+            0x7DC20804, 0x6CBE0000, 0x7DC20804, 0x6D538000, 0x7DA00804, 0x7D770000, 0x7DC00804, 0x61010000, 0x7DC20804, 0x6DD58000,
+            0x7DA00804, 0x7DE30000, 0x7DA00804, 0x7DE48000, 0x7DC00804, 0x61138000, 0x7DC20804, 0x6E400000, 0x7DA00804, 0x7E690000,
+            0x7DC00804, 0x61500000, 0x7DA00804, 0x7E740000, 0x7DA00804, 0x7E718000, 0x7DA00804, 0x7E800000, 0x7DC20804, 0x6FC30000,
+            0x7DA00804, 0x7EB18000, 0x7DC00804, 0x61808000, 0x7DA00804, 0x7EE38000, 0x7DA00804, 0x7F010000, 0x7DA00804, 0x7F228000,
+            0x7DC00804, 0x619A0000, 0x7DC20804, 0x71140000, 0x7DC20804, 0x71238000, 0x7DC00804, 0x61AC8000, 0x7DC20804, 0x716C8000,
+            0x7DA00804, 0x7FBD0000, 0x7DC20804, 0x719F0000, 0x7DA00804, 0x7FCA8000, 0x7DA00804, 0x7FFD0000, 0x7DC20804, 0x726D0000,
+            0x7DC20804, 0x72918000, 0x7DA08804, 0x40300000, 0x7DC20804, 0x72D40000, 0x7DA08804, 0x40380000, 0x7DC20804, 0x59AF8000,
+            0x7DC00804, 0x61EA8000, 0x7DA08804, 0x40590000, 0x7DA08804, 0x40818000, 0x7DC00804, 0x62058000, 0x7DA08804, 0x409F0000,
+            0x7DA00804, 0x6D5A8000, 0x7DC20804, 0x73D38000, 0x7DC20804, 0x73DA8000, 0x7DC20804, 0x59C98000, 0x7DC20804, 0x59CE0000,
+            0x7DA08804, 0x41020000, 0x7DA08804, 0x47CF0000, 0x7DC00804, 0x62358000, 0x7DA08804, 0x41488000, 0x7DA08804, 0x41458000,
+            0x7DA08804, 0x414E8000, 0x7DA00804, 0x69598000, 0x7DA08804, 0x41588000, 0x7DA08804, 0x41598000, 0x7DA08804, 0x415E8000,
+            0x7DA08804, 0x41730000, 0x7DC20804, 0x759E0000, 0x7DA08804, 0x418E8000, 0x7DA08804, 0x41B18000, 0x7DA08804, 0x41D68000,
+            0x7DA08804, 0x41918000, 0x7DA08804, 0x41DE8000, 0x7DA08804, 0x41F38000, 0x7DA08804, 0x41A98000, 0x7DA08804, 0x41E50000,
+            0x7DA08804, 0x41E60000, 0x7DA08804, 0x41EE0000, 0x7DC20804, 0x761B0000, 0x7DC20804, 0x76B58000, 0x7DC20804, 0x766A8000,
+            0x7DC00804, 0x62958000, 0x7DA08804, 0x42788000, 0x7DA08804, 0x42798000, 0x7DA08804, 0x428B0000, 0x7DC20804, 0x79E50000,
+            0x7DA08804, 0x42B20000, 0x7DC20804, 0x77960000, 0x7DC00804, 0x62AE8000, 0x7DC00804, 0x62B08000, 0x7DC20804, 0x77D88000,
+            0x7DC20804, 0x78690000, 0x7DC00804, 0x62B58000, 0x7DA08804, 0x43280000, 0x7DA08804, 0x43338000, 0x7DA08804, 0x43348000,
+            0x7DA08804, 0x43548000, 0x7DA08804, 0x43440000, 0x7DA08804, 0x43870000, 0x7DA08804, 0x43710000, 0x7DA08804, 0x43940000,
+            0x7DA08804, 0x43B58000, 0x7DA08804, 0x43C30000, 0x7DC00804, 0x62EB8000, 0x7DA08804, 0x43F08000, 0x7DA08804, 0x44008000,
+            0x7DC00804, 0x62FC8000, 0x7DA08804, 0x44300000, 0x7DA08804, 0x44318000, 0x7DC20804, 0x7B338000, 0x7DA08804, 0x446B8000,
+            0x7DA08804, 0x446F0000, 0x7DC00804, 0x631A8000, 0x7DA08804, 0x447D0000, 0x7DC00804, 0x5A5D8000, 0x7DC20804, 0x7C570000,
+            0x7DC20804, 0x7CB30000, 0x7DC00804, 0x635F0000, 0x7DC00804, 0x63638000, 0x7DA08804, 0x45500000, 0x7DA08804, 0x462A8000,
+            0x7DC20804, 0x7E540000, 0x7DA08804, 0x46558000, 0x7DA08804, 0x46608000, 0x7DA08804, 0x468D8000, 0x7DA08804, 0x46BB8000,
+            0x7DC20804, 0x7F978000, 0x7DC20804, 0x44020000, 0x7DA08804, 0x46E58000, 0x7DA08804, 0x46DE0000, 0x7DA08804, 0x46F80000,
+            0x7DC20804, 0x446F0000, 0x7DA08804, 0x476A0000, 0x7DC28804, 0x42E90000, 0x7DC28804, 0x42F68000, 0x7DA08804, 0x484A0000,
+            0x7DA08804, 0x48788000, 0x7DA08804, 0x48888000, 0x7DC28804, 0x43970000, 0x7DA08804, 0x488D8000, 0x7DA08804, 0x491C0000,
+            0x7DA08804, 0x496B8000, 0x7DA08804, 0x496C0000, 0x7DA08804, 0x493E0000, 0x7DA08804, 0x49FC8000, 0x7DA08804, 0x4A0A8000,
+            0x7DC28804, 0x45FD0000, 0x7DA08804, 0x4AC58000, 0x7DC00804, 0x64CA8000, 0x7DA08804, 0x4ADB8000, 0x7DC28804, 0x46BB8000,
+            0x7DC00804, 0x64F30000, 0x7DA08804, 0x4B618000, 0x7DA00804, 0x6ED90000, 0x7DA08804, 0x4B918000, 0x7DC28804, 0x48A28000,
+            0x7DC28804, 0x490D0000, 0x7DC00804, 0x65370000, 0x7DC00804, 0x653B0000, 0x7DA08804, 0x4BF00000, 0x7DC28804, 0x4A050000,
+            0x7DC00804, 0x65590000, 0x7DC28804, 0x4A4B0000, 0x7DA08804, 0x4C148000, 0x7DC28804, 0x4ADB0000, 0x7DA08804, 0x4C710000,
+            0x7DC00804, 0x65998000, 0x7DA08804, 0x4C948000, 0x7DA08804, 0x4CD38000, 0x7DA08804, 0x4CE10000, 0x7DA08804, 0x4CFF0000,
+            0x7DC00804, 0x65E70000, 0x7DC28804, 0x4D980000, 0x7DA08804, 0x4E200000, 0x7DA08804, 0x4E7E8000, 0x7DC00804, 0x66670000,
+            0x7DC00804, 0x66768000, 0x7DA08804, 0x4EB38000, 0x7DC28804, 0x50670000, 0x7DC00804, 0x667C0000, 0x7DC28804, 0x50828000,
+            0x7DC28804, 0x51070000, 0x7DC28804, 0x51488000, 0x7DA08804, 0x4F5D8000, 0x7DC00804, 0x66AB0000, 0x7DA08804, 0x4F7C8000,
+            0x7DA08804, 0x4F7F0000, 0x7DA08804, 0x4F828000, 0x7DA08804, 0x4F878000, 0x7DA08804, 0x4F8B0000, 0x7DA08804, 0x4F9D8000,
+            0x7DC28804, 0x53000000, 0x13328804, 0x13330804, 0x13350804, 0x153D8804, 0x159E0804, 0x15A60804, 0x15B78804, 0x15B70804,
+            0x15DA8804, 0x15FF8804, 0x16268804, 0x16260804, 0x164D8804, 0x190B8804, 0x19288804, 0x190C0804, 0x19288804, 0x190C8804,
+            0x19288804, 0x190D0804, 0x19288804, 0x190D8804, 0x19288804, 0x190E0804, 0x19288804, 0x190E8804, 0x19288804, 0x190F0804,
+            0x19288804, 0x190F8804, 0x19288804, 0x19100804, 0x19288804, 0x19108804, 0x19288804, 0x19110804, 0x19288804, 0x19118804,
+            0x19288804, 0x19120804, 0x19288804, 0x19128804, 0x19288804, 0x19130804, 0x19288804, 0x19138804, 0x19288804, 0x19140804,
+            0x19288804, 0x19148804, 0x19288804, 0x19150804, 0x19288804, 0x19158804, 0x19288804, 0x19160804, 0x19288804, 0x19168804,
+            0x19288804, 0x19170804, 0x19288804, 0x19178804, 0x19288804, 0x19180804, 0x19288804, 0x19188804, 0x19288804, 0x19190804,
+            0x19288804, 0x19198804, 0x19288804, 0x191A0804, 0x19288804, 0x191A8804, 0x19288804, 0x191B0804, 0x19288804, 0x191B8804,
+            0x19288804, 0x191C0804, 0x19288804, 0x191C8804, 0x19288804, 0x191D0804, 0x19288804, 0x191D8804, 0x19288804, 0x191E0804,
+            0x19288804, 0x191E8804, 0x19288804, 0x191F0804, 0x19288804, 0x191F8804, 0x19288804, 0x19200804, 0x19288804, 0x19208804,
+            0x19288804, 0x19210804, 0x19288804, 0x19218804, 0x19288804, 0x19220804, 0x19288804, 0x190B8804, 0x19290804, 0x190C0804,
+            0x19290804, 0x190C8804, 0x19290804, 0x190D0804, 0x19290804, 0x190D8804, 0x19290804, 0x190E0804, 0x19290804, 0x190E8804,
+            0x19290804, 0x190F0804, 0x19290804, 0x190F8804, 0x19290804, 0x19100804, 0x19290804, 0x19108804, 0x19290804, 0x19110804,
+            0x19290804, 0x19118804, 0x19290804, 0x19120804, 0x19290804, 0x19128804, 0x19290804, 0x19130804, 0x19290804, 0x19138804,
+            0x19290804, 0x19140804, 0x19290804, 0x19148804, 0x19290804, 0x19150804, 0x19290804, 0x19158804, 0x19290804, 0x19160804,
+            0x19290804, 0x19168804, 0x19290804, 0x19170804, 0x19290804, 0x19178804, 0x19290804, 0x19180804, 0x19290804, 0x19188804,
+            0x19290804, 0x19190804, 0x19290804, 0x19198804, 0x19290804, 0x191A0804, 0x19290804, 0x191A8804, 0x19290804, 0x191B0804,
+            0x19290804, 0x191B8804, 0x19290804, 0x191C0804, 0x19290804, 0x191C8804, 0x19290804, 0x191D0804, 0x19290804, 0x191D8804,
+            0x19290804, 0x191E0804, 0x19290804, 0x191E8804, 0x19290804, 0x191F0804, 0x19290804, 0x191F8804, 0x19290804, 0x19200804,
+            0x19290804, 0x19208804, 0x19290804, 0x19210804, 0x19290804, 0x19218804, 0x19290804, 0x19220804, 0x19290804, 0x190B8804,
+            0x19298804, 0x190C0804, 0x19298804, 0x190C8804, 0x19298804, 0x190D0804, 0x19298804, 0x190D8804, 0x19298804, 0x190E0804,
+            0x19298804, 0x190E8804, 0x19298804, 0x190F0804, 0x19298804, 0x190F8804, 0x19298804, 0x19100804, 0x19298804, 0x19108804,
+            0x19298804, 0x19110804, 0x19298804, 0x19118804, 0x19298804, 0x19120804, 0x19298804, 0x19128804, 0x19298804, 0x19130804,
+            0x19298804, 0x19138804, 0x19298804, 0x19140804, 0x19298804, 0x19148804, 0x19298804, 0x19150804, 0x19298804, 0x19158804,
+            0x19298804, 0x19160804, 0x19298804, 0x19168804, 0x19298804, 0x19170804, 0x19298804, 0x19178804, 0x19298804, 0x19180804,
+            0x19298804, 0x19188804, 0x19298804, 0x19190804, 0x19298804, 0x19198804, 0x19298804, 0x191A0804, 0x19298804, 0x191A8804,
+            0x19298804, 0x191B0804, 0x19298804, 0x191B8804, 0x19298804, 0x191C0804, 0x19298804, 0x191C8804, 0x19298804, 0x191D0804,
+            0x19298804, 0x191D8804, 0x19298804, 0x191E0804, 0x19298804, 0x191E8804, 0x19298804, 0x191F0804, 0x19298804, 0x191F8804,
+            0x19298804, 0x19200804, 0x19298804, 0x19208804, 0x19298804, 0x19210804, 0x19298804, 0x19218804, 0x19298804, 0x19220804,
+            0x19298804, 0x190B8804, 0x192A0804, 0x190C0804, 0x192A0804, 0x190C8804, 0x192A0804, 0x190D0804, 0x192A0804, 0x190D8804,
+            0x192A0804, 0x190E0804, 0x192A0804, 0x190E8804, 0x192A0804, 0x190F0804, 0x192A0804, 0x190F8804, 0x192A0804, 0x19100804,
+            0x192A0804, 0x19108804, 0x192A0804, 0x19110804, 0x192A0804, 0x19118804, 0x192A0804, 0x19120804, 0x192A0804, 0x19128804,
+            0x192A0804, 0x19130804, 0x192A0804, 0x19138804, 0x192A0804, 0x19140804, 0x192A0804, 0x19148804, 0x192A0804, 0x19150804,
+            0x192A0804, 0x19158804, 0x192A0804, 0x19160804, 0x192A0804, 0x19168804, 0x192A0804, 0x19170804, 0x192A0804, 0x19178804,
+            0x192A0804, 0x19180804, 0x192A0804, 0x19188804, 0x192A0804, 0x19190804, 0x192A0804, 0x19198804, 0x192A0804, 0x191A0804,
+            0x192A0804, 0x191A8804, 0x192A0804, 0x191B0804, 0x192A0804, 0x191B8804, 0x192A0804, 0x191C0804, 0x192A0804, 0x191C8804,
+            0x192A0804, 0x191D0804, 0x192A0804, 0x191D8804, 0x192A0804, 0x191E0804, 0x192A0804, 0x191E8804, 0x192A0804, 0x191F0804,
+            0x192A0804, 0x191F8804, 0x192A0804, 0x19200804, 0x192A0804, 0x19208804, 0x192A0804, 0x19210804, 0x192A0804, 0x19218804,
+            0x192A0804, 0x19220804, 0x192A0804, 0x190B8804, 0x192A8804, 0x190C0804, 0x192A8804, 0x190C8804, 0x192A8804, 0x190D0804,
+            0x192A8804, 0x190D8804, 0x192A8804, 0x190E0804, 0x192A8804, 0x190E8804, 0x192A8804, 0x190F0804, 0x192A8804, 0x190F8804,
+            0x192A8804, 0x19100804, 0x192A8804, 0x19108804, 0x192A8804, 0x19110804, 0x192A8804, 0x19118804, 0x192A8804, 0x19120804,
+            0x192A8804, 0x19128804, 0x192A8804, 0x19130804, 0x192A8804, 0x19138804, 0x192A8804, 0x19140804, 0x192A8804, 0x19148804,
+            0x192A8804, 0x19150804, 0x192A8804, 0x19158804, 0x192A8804, 0x19160804, 0x192A8804, 0x19168804, 0x192A8804, 0x19170804,
+            0x192A8804, 0x19178804, 0x192A8804, 0x19180804, 0x192A8804, 0x19188804, 0x192A8804, 0x19190804, 0x192A8804, 0x19198804,
+            0x192A8804, 0x191A0804, 0x192A8804, 0x191A8804, 0x192A8804, 0x191B0804, 0x192A8804, 0x191B8804, 0x192A8804, 0x191C0804,
+            0x192A8804, 0x191C8804, 0x192A8804, 0x191D0804, 0x192A8804, 0x191D8804, 0x192A8804, 0x191E0804, 0x192A8804, 0x191E8804,
+            0x192A8804, 0x191F0804, 0x192A8804, 0x191F8804, 0x192A8804, 0x19200804, 0x192A8804, 0x19208804, 0x192A8804, 0x19210804,
+            0x192A8804, 0x19218804, 0x192A8804, 0x19220804, 0x192A8804, 0x19248804, 0x192C0804, 0x19488804, 0x192C8804, 0x19488804,
+            0x192D0804, 0x19488804, 0x192D8804, 0x19488804, 0x192E0804, 0x19488804, 0x192E8804, 0x19488804, 0x192F0804, 0x19488804,
+            0x19300804, 0x19488804, 0x19308804, 0x19488804, 0x19320804, 0x19488804, 0x19310804, 0x19488804, 0x19328804, 0x19488804,
+            0x19330804, 0x19488804, 0x19338804, 0x19488804, 0x19340804, 0x19488804, 0x19348804, 0x19488804, 0x19350804, 0x19488804,
+            0x19358804, 0x19488804, 0x19360804, 0x19488804, 0x19368804, 0x19488804, 0x19370804, 0x19488804, 0x19378804, 0x19488804,
+            0x19380804, 0x19488804, 0x19388804, 0x19488804, 0x19390804, 0x19488804, 0x19398804, 0x19488804, 0x193A0804, 0x19488804,
+            0x193A8804, 0x19488804, 0x193B0804, 0x19488804, 0x193B8804, 0x19488804, 0x193C0804, 0x19488804, 0x193C8804, 0x19488804,
+            0x193D0804, 0x19488804, 0x193D8804, 0x19488804, 0x193E0804, 0x19488804, 0x193E8804, 0x19488804, 0x192F8804, 0x19488804,
+            0x193F0804, 0x19488804, 0x193F8804, 0x19488804, 0x19400804, 0x19488804, 0x19408804, 0x19488804, 0x193F0808, 0x19378808,
+            0x19488804, 0x193F0808, 0x193B8808, 0x19488804, 0x192B8804, 0x19488804, 0x19318804, 0x19488804, 0x192C0804, 0x19490804,
+            0x192C8804, 0x19490804, 0x192D0804, 0x19490804, 0x192D8804, 0x19490804, 0x192E0804, 0x19490804, 0x192E8804, 0x19490804,
+            0x192F0804, 0x19490804, 0x19300804, 0x19490804, 0x19308804, 0x19490804, 0x19320804, 0x19490804, 0x19310804, 0x19490804,
+            0x19328804, 0x19490804, 0x19330804, 0x19490804, 0x19338804, 0x19490804, 0x19340804, 0x19490804, 0x19348804, 0x19490804,
+            0x19350804, 0x19490804, 0x19358804, 0x19490804, 0x19360804, 0x19490804, 0x19368804, 0x19490804, 0x19370804, 0x19490804,
+            0x19378804, 0x19490804, 0x19380804, 0x19490804, 0x19388804, 0x19490804, 0x19390804, 0x19490804, 0x19398804, 0x19490804,
+            0x193A0804, 0x19490804, 0x193A8804, 0x19490804, 0x193B0804, 0x19490804, 0x193B8804, 0x19490804, 0x193C0804, 0x19490804,
+            0x193C8804, 0x19490804, 0x193D0804, 0x19490804, 0x193D8804, 0x19490804, 0x193E0804, 0x19490804, 0x193E8804, 0x19490804,
+            0x192F8804, 0x19490804, 0x193F0804, 0x19490804, 0x193F8804, 0x19490804, 0x19400804, 0x19490804, 0x19408804, 0x19490804,
+            0x193F0808, 0x19378808, 0x19490804, 0x193F0808, 0x193B8808, 0x19490804, 0x192B8804, 0x19490804, 0x19318804, 0x19490804,
+            0x192C0804, 0x19498804, 0x192C8804, 0x19498804, 0x192D0804, 0x19498804, 0x192D8804, 0x19498804, 0x192E0804, 0x19498804,
+            0x192E8804, 0x19498804, 0x192F0804, 0x19498804, 0x19300804, 0x19498804, 0x19308804, 0x19498804, 0x19320804, 0x19498804,
+            0x19310804, 0x19498804, 0x19328804, 0x19498804, 0x19330804, 0x19498804, 0x19338804, 0x19498804, 0x19340804, 0x19498804,
+            0x19348804, 0x19498804, 0x19350804, 0x19498804, 0x19358804, 0x19498804, 0x19360804, 0x19498804, 0x19368804, 0x19498804,
+            0x19370804, 0x19498804, 0x19378804, 0x19498804, 0x19380804, 0x19498804, 0x19388804, 0x19498804, 0x19390804, 0x19498804,
+            0x19398804, 0x19498804, 0x193A0804, 0x19498804, 0x193A8804, 0x19498804, 0x193B0804, 0x19498804, 0x193B8804, 0x19498804,
+            0x193C0804, 0x19498804, 0x193C8804, 0x19498804, 0x193D0804, 0x19498804, 0x193D8804, 0x19498804, 0x193E0804, 0x19498804,
+            0x193E8804, 0x19498804, 0x192F8804, 0x19498804, 0x193F0804, 0x19498804, 0x193F8804, 0x19498804, 0x19400804, 0x19498804,
+            0x19408804, 0x19498804, 0x193F0808, 0x19378808, 0x19498804, 0x193F0808, 0x193B8808, 0x19498804, 0x192B8804, 0x19498804,
+            0x19318804, 0x19498804, 0x192C0804, 0x194A0804, 0x192C8804, 0x194A0804, 0x192D0804, 0x194A0804, 0x192D8804, 0x194A0804,
+            0x192E0804, 0x194A0804, 0x192E8804, 0x194A0804, 0x192F0804, 0x194A0804, 0x19300804, 0x194A0804, 0x19308804, 0x194A0804,
+            0x19320804, 0x194A0804, 0x19310804, 0x194A0804, 0x19328804, 0x194A0804, 0x19330804, 0x194A0804, 0x19338804, 0x194A0804,
+            0x19340804, 0x194A0804, 0x19348804, 0x194A0804, 0x19350804, 0x194A0804, 0x19358804, 0x194A0804, 0x19360804, 0x194A0804,
+            0x19368804, 0x194A0804, 0x19370804, 0x194A0804, 0x19378804, 0x194A0804, 0x19380804, 0x194A0804, 0x19388804, 0x194A0804,
+            0x19390804, 0x194A0804, 0x19398804, 0x194A0804, 0x193A0804, 0x194A0804, 0x193A8804, 0x194A0804, 0x193B0804, 0x194A0804,
+            0x193B8804, 0x194A0804, 0x193C0804, 0x194A0804, 0x193C8804, 0x194A0804, 0x193D0804, 0x194A0804, 0x193D8804, 0x194A0804,
+            0x193E0804, 0x194A0804, 0x193E8804, 0x194A0804, 0x192F8804, 0x194A0804, 0x193F0804, 0x194A0804, 0x193F8804, 0x194A0804,
+            0x19400804, 0x194A0804, 0x19408804, 0x194A0804, 0x193F0808, 0x19378808, 0x194A0804, 0x193F0808, 0x193B8808, 0x194A0804,
+            0x192B8804, 0x194A0804, 0x19318804, 0x194A0804, 0x192C0804, 0x194A8804, 0x192C8804, 0x194A8804, 0x192D0804, 0x194A8804,
+            0x192D8804, 0x194A8804, 0x192E0804, 0x194A8804, 0x192E8804, 0x194A8804, 0x192F0804, 0x194A8804, 0x19300804, 0x194A8804,
+            0x19308804, 0x194A8804, 0x19320804, 0x194A8804, 0x19310804, 0x194A8804, 0x19328804, 0x194A8804, 0x19330804, 0x194A8804,
+            0x19338804, 0x194A8804, 0x19340804, 0x194A8804, 0x19348804, 0x194A8804, 0x19350804, 0x194A8804, 0x19358804, 0x194A8804,
+            0x19360804, 0x194A8804, 0x19368804, 0x194A8804, 0x19370804, 0x194A8804, 0x19378804, 0x194A8804, 0x19380804, 0x194A8804,
+            0x19388804, 0x194A8804, 0x19390804, 0x194A8804, 0x19398804, 0x194A8804, 0x193A0804, 0x194A8804, 0x193A8804, 0x194A8804,
+            0x193B0804, 0x194A8804, 0x193B8804, 0x194A8804, 0x193C0804, 0x194A8804, 0x193C8804, 0x194A8804, 0x193D0804, 0x194A8804,
+            0x193D8804, 0x194A8804, 0x193E0804, 0x194A8804, 0x193E8804, 0x194A8804, 0x192F8804, 0x194A8804, 0x193F0804, 0x194A8804,
+            0x193F8804, 0x194A8804, 0x19400804, 0x194A8804, 0x19408804, 0x194A8804, 0x193F0808, 0x19378808, 0x194A8804, 0x193F0808,
+            0x193B8808, 0x194A8804, 0x192B8804, 0x194A8804, 0x19318804, 0x194A8804, 0x19430804, 0x19958804, 0x19978804, 0x19968804,
+            0x19988804, 0x19980804, 0x19998804, 0x19990804, 0x1B6F0804, 0x1B878804, 0x1B6F8804, 0x1B878804, 0x1B700804, 0x1B878804,
+            0x1B708804, 0x1B878804, 0x1B710804, 0x1B878804, 0x1B718804, 0x1B878804, 0x1B720804, 0x1B878804, 0x1B728804, 0x1B878804,
+            0x1B730804, 0x1B878804, 0x1B738804, 0x1B878804, 0x1B740804, 0x1B878804, 0x1B748804, 0x1B878804, 0x1B750804, 0x1B878804,
+            0x1B758804, 0x1B878804, 0x1B760804, 0x1B878804, 0x1B768804, 0x1B878804, 0x1B770804, 0x1B878804, 0x1B778804, 0x1B878804,
+            0x1B780804, 0x1B878804, 0x1B788804, 0x1B878804, 0x1B790804, 0x1B878804, 0x1B798804, 0x1B878804, 0x1B7A0804, 0x1B878804,
+            0x1B7A8804, 0x1B878804, 0x1B7B0804, 0x1B878804, 0x1B7B8804, 0x1B878804, 0x1B7C0804, 0x1B878804, 0x1B7C8804, 0x1B878804,
+            0x1B7D0804, 0x1B878804, 0x1B7D8804, 0x1B878804, 0x1B7E0804, 0x1B878804, 0x1B7E8804, 0x1B878804, 0x1B7F0804, 0x1B878804,
+            0x1B7F8804, 0x1B878804, 0x1B800804, 0x1B878804, 0x1B808804, 0x1B878804, 0x1B810804, 0x1B878804, 0x1B818804, 0x1B878804,
+            0x1B820804, 0x1B878804, 0x1B828804, 0x1B878804, 0x1B830804, 0x1B878804, 0x1B838804, 0x1B878804, 0x1B840804, 0x1B878804,
+            0x1B848804, 0x1B878804, 0x1B6F0804, 0x1B880804, 0x1B6F8804, 0x1B880804, 0x1B700804, 0x1B880804, 0x1B708804, 0x1B880804,
+            0x1B710804, 0x1B880804, 0x1B718804, 0x1B880804, 0x1B720804, 0x1B880804, 0x1B728804, 0x1B880804, 0x1B730804, 0x1B880804,
+            0x1B738804, 0x1B880804, 0x1B740804, 0x1B880804, 0x1B748804, 0x1B880804, 0x1B750804, 0x1B880804, 0x1B758804, 0x1B880804,
+            0x1B760804, 0x1B880804, 0x1B768804, 0x1B880804, 0x1B770804, 0x1B880804, 0x1B778804, 0x1B880804, 0x1B780804, 0x1B880804,
+            0x1B788804, 0x1B880804, 0x1B790804, 0x1B880804, 0x1B798804, 0x1B880804, 0x1B7A0804, 0x1B880804, 0x1B7A8804, 0x1B880804,
+            0x1B7B0804, 0x1B880804, 0x1B7B8804, 0x1B880804, 0x1B7C0804, 0x1B880804, 0x1B7C8804, 0x1B880804, 0x1B7D0804, 0x1B880804,
+            0x1B7D8804, 0x1B880804, 0x1B7E0804, 0x1B880804, 0x1B7E8804, 0x1B880804, 0x1B7F0804, 0x1B880804, 0x1B7F8804, 0x1B880804,
+            0x1B800804, 0x1B880804, 0x1B808804, 0x1B880804, 0x1B810804, 0x1B880804, 0x1B818804, 0x1B880804, 0x1B820804, 0x1B880804,
+            0x1B828804, 0x1B880804, 0x1B830804, 0x1B880804, 0x1B838804, 0x1B880804, 0x1B840804, 0x1B880804, 0x1B848804, 0x1B880804,
+            0x1B6F0804, 0x1B888804, 0x1B6F8804, 0x1B888804, 0x1B700804, 0x1B888804, 0x1B708804, 0x1B888804, 0x1B710804, 0x1B888804,
+            0x1B718804, 0x1B888804, 0x1B720804, 0x1B888804, 0x1B728804, 0x1B888804, 0x1B730804, 0x1B888804, 0x1B738804, 0x1B888804,
+            0x1B740804, 0x1B888804, 0x1B748804, 0x1B888804, 0x1B750804, 0x1B888804, 0x1B758804, 0x1B888804, 0x1B760804, 0x1B888804,
+            0x1B768804, 0x1B888804, 0x1B770804, 0x1B888804, 0x1B778804, 0x1B888804, 0x1B780804, 0x1B888804, 0x1B788804, 0x1B888804,
+            0x1B790804, 0x1B888804, 0x1B798804, 0x1B888804, 0x1B7A0804, 0x1B888804, 0x1B7A8804, 0x1B888804, 0x1B7B0804, 0x1B888804,
+            0x1B7B8804, 0x1B888804, 0x1B7C0804, 0x1B888804, 0x1B7C8804, 0x1B888804, 0x1B7D0804, 0x1B888804, 0x1B7D8804, 0x1B888804,
+            0x1B7E0804, 0x1B888804, 0x1B7E8804, 0x1B888804, 0x1B7F0804, 0x1B888804, 0x1B7F8804, 0x1B888804, 0x1B800804, 0x1B888804,
+            0x1B808804, 0x1B888804, 0x1B810804, 0x1B888804, 0x1B818804, 0x1B888804, 0x1B820804, 0x1B888804, 0x1B828804, 0x1B888804,
+            0x1B830804, 0x1B888804, 0x1B838804, 0x1B888804, 0x1B840804, 0x1B888804, 0x1B848804, 0x1B888804, 0x1B6F0804, 0x1B8A0804,
+            0x1B6F8804, 0x1B8A0804, 0x1B700804, 0x1B8A0804, 0x1B708804, 0x1B8A0804, 0x1B710804, 0x1B8A0804, 0x1B718804, 0x1B8A0804,
+            0x1B720804, 0x1B8A0804, 0x1B728804, 0x1B8A0804, 0x1B730804, 0x1B8A0804, 0x1B738804, 0x1B8A0804, 0x1B740804, 0x1B8A0804,
+            0x1B748804, 0x1B8A0804, 0x1B750804, 0x1B8A0804, 0x1B758804, 0x1B8A0804, 0x1B760804, 0x1B8A0804, 0x1B768804, 0x1B8A0804,
+            0x1B770804, 0x1B8A0804, 0x1B778804, 0x1B8A0804, 0x1B780804, 0x1B8A0804, 0x1B788804, 0x1B8A0804, 0x1B790804, 0x1B8A0804,
+            0x1B798804, 0x1B8A0804, 0x1B7A0804, 0x1B8A0804, 0x1B7A8804, 0x1B8A0804, 0x1B7B0804, 0x1B8A0804, 0x1B7B8804, 0x1B8A0804,
+            0x1B7C0804, 0x1B8A0804, 0x1B7C8804, 0x1B8A0804, 0x1B7D0804, 0x1B8A0804, 0x1B7D8804, 0x1B8A0804, 0x1B7E0804, 0x1B8A0804,
+            0x1B7E8804, 0x1B8A0804, 0x1B7F0804, 0x1B8A0804, 0x1B7F8804, 0x1B8A0804, 0x1B800804, 0x1B8A0804, 0x1B808804, 0x1B8A0804,
+            0x1B810804, 0x1B8A0804, 0x1B818804, 0x1B8A0804, 0x1B820804, 0x1B8A0804, 0x1B828804, 0x1B8A0804, 0x1B830804, 0x1B8A0804,
+            0x1B838804, 0x1B8A0804, 0x1B840804, 0x1B8A0804, 0x1B848804, 0x1B8A0804, 0x1BFC0804, 0x194B0804, 0x19658804, 0x194B8804,
+            0x19658804, 0x194C0804, 0x19658804, 0x194C8804, 0x19658804, 0x194D0804, 0x19658804, 0x194D8804, 0x19658804, 0x194E0804,
+            0x19658804, 0x194E8804, 0x19658804, 0x194F0804, 0x19658804, 0x194F8804, 0x19658804, 0x19500804, 0x19658804, 0x19508804,
+            0x19658804, 0x19510804, 0x19658804, 0x19518804, 0x19658804, 0x19520804, 0x19658804, 0x19528804, 0x19658804, 0x19530804,
+            0x19658804, 0x19538804, 0x19658804, 0x19540804, 0x19658804, 0x19548804, 0x19658804, 0x19550804, 0x19658804, 0x19558804,
+            0x19658804, 0x19560804, 0x19658804, 0x19568804, 0x19658804, 0x19570804, 0x19658804, 0x19578804, 0x19658804, 0x19580804,
+            0x19658804, 0x19588804, 0x19658804, 0x19590804, 0x19658804, 0x19598804, 0x19658804, 0x195A0804, 0x19658804, 0x195A8804,
+            0x19658804, 0x195B0804, 0x19658804, 0x195B8804, 0x19658804, 0x195C0804, 0x19658804, 0x195C8804, 0x19658804, 0x195D0804,
+            0x19658804, 0x195D8804, 0x19658804, 0x195E0804, 0x19658804, 0x195E8804, 0x19658804, 0x195F0804, 0x19658804, 0x195F8804,
+            0x19658804, 0x19600804, 0x19658804, 0x19608804, 0x19658804, 0x19610804, 0x19658804, 0x19618804, 0x19658804, 0x19620804,
+            0x19658804, 0x19628804, 0x19658804, 0x194B0804, 0x19660804, 0x194B8804, 0x19660804, 0x194C0804, 0x19660804, 0x194C8804,
+            0x19660804, 0x194D0804, 0x19660804, 0x194D8804, 0x19660804, 0x194E0804, 0x19660804, 0x194E8804, 0x19660804, 0x194F0804,
+            0x19660804, 0x194F8804, 0x19660804, 0x19500804, 0x19660804, 0x19508804, 0x19660804, 0x19510804, 0x19660804, 0x19518804,
+            0x19660804, 0x19520804, 0x19660804, 0x19528804, 0x19660804, 0x19530804, 0x19660804, 0x19538804, 0x19660804, 0x19540804,
+            0x19660804, 0x19548804, 0x19660804, 0x19550804, 0x19660804, 0x19558804, 0x19660804, 0x19560804, 0x19660804, 0x19568804,
+            0x19660804, 0x19570804, 0x19660804, 0x19578804, 0x19660804, 0x19580804, 0x19660804, 0x19588804, 0x19660804, 0x19590804,
+            0x19660804, 0x19598804, 0x19660804, 0x195A0804, 0x19660804, 0x195A8804, 0x19660804, 0x195B0804, 0x19660804, 0x195B8804,
+            0x19660804, 0x195C0804, 0x19660804, 0x195C8804, 0x19660804, 0x195D0804, 0x19660804, 0x195D8804, 0x19660804, 0x195E0804,
+            0x19660804, 0x195E8804, 0x19660804, 0x195F0804, 0x19660804, 0x195F8804, 0x19660804, 0x19600804, 0x19660804, 0x19608804,
+            0x19660804, 0x19610804, 0x19660804, 0x19618804, 0x19660804, 0x19620804, 0x19660804, 0x19628804, 0x19660804, 0x194B0804,
+            0x19678804, 0x194B8804, 0x19678804, 0x194C0804, 0x19678804, 0x194C8804, 0x19678804, 0x194D0804, 0x19678804, 0x194D8804,
+            0x19678804, 0x194E0804, 0x19678804, 0x194E8804, 0x19678804, 0x194F0804, 0x19678804, 0x194F8804, 0x19678804, 0x19500804,
+            0x19678804, 0x19508804, 0x19678804, 0x19510804, 0x19678804, 0x19518804, 0x19678804, 0x19520804, 0x19678804, 0x19528804,
+            0x19678804, 0x19530804, 0x19678804, 0x19538804, 0x19678804, 0x19540804, 0x19678804, 0x19548804, 0x19678804, 0x19550804,
+            0x19678804, 0x19558804, 0x19678804, 0x19560804, 0x19678804, 0x19568804, 0x19678804, 0x19570804, 0x19678804, 0x19578804,
+            0x19678804, 0x19580804, 0x19678804, 0x19588804, 0x19678804, 0x19590804, 0x19678804, 0x19598804, 0x19678804, 0x195A0804,
+            0x19678804, 0x195A8804, 0x19678804, 0x195B0804, 0x19678804, 0x195B8804, 0x19678804, 0x195C0804, 0x19678804, 0x195C8804,
+            0x19678804, 0x195D0804, 0x19678804, 0x195D8804, 0x19678804, 0x195E0804, 0x19678804, 0x195E8804, 0x19678804, 0x195F0804,
+            0x19678804, 0x195F8804, 0x19678804, 0x19600804, 0x19678804, 0x19608804, 0x19678804, 0x19610804, 0x19678804, 0x19618804,
+            0x19678804, 0x19620804, 0x19678804, 0x19628804, 0x19678804, 0x194B0804, 0x19688804, 0x194B8804, 0x19688804, 0x194C0804,
+            0x19688804, 0x194C8804, 0x19688804, 0x194D0804, 0x19688804, 0x194D8804, 0x19688804, 0x194E0804, 0x19688804, 0x194E8804,
+            0x19688804, 0x194F0804, 0x19688804, 0x194F8804, 0x19688804, 0x19500804, 0x19688804, 0x19508804, 0x19688804, 0x19510804,
+            0x19688804, 0x19518804, 0x19688804, 0x19520804, 0x19688804, 0x19528804, 0x19688804, 0x19530804, 0x19688804, 0x19538804,
+            0x19688804, 0x19540804, 0x19688804, 0x19548804, 0x19688804, 0x19550804, 0x19688804, 0x19558804, 0x19688804, 0x19560804,
+            0x19688804, 0x19568804, 0x19688804, 0x19570804, 0x19688804, 0x19578804, 0x19688804, 0x19580804, 0x19688804, 0x19588804,
+            0x19688804, 0x19590804, 0x19688804, 0x19598804, 0x19688804, 0x195A0804, 0x19688804, 0x195A8804, 0x19688804, 0x195B0804,
+            0x19688804, 0x195B8804, 0x19688804, 0x195C0804, 0x19688804, 0x195C8804, 0x19688804, 0x195D0804, 0x19688804, 0x195D8804,
+            0x19688804, 0x195E0804, 0x19688804, 0x195E8804, 0x19688804, 0x195F0804, 0x19688804, 0x195F8804, 0x19688804, 0x19600804,
+            0x19688804, 0x19608804, 0x19688804, 0x19610804, 0x19688804, 0x19618804, 0x19688804, 0x19620804, 0x19688804, 0x19628804,
+            0x19688804, 0x194B0804, 0x19690804, 0x194B8804, 0x19690804, 0x194C0804, 0x19690804, 0x194C8804, 0x19690804, 0x194D0804,
+            0x19690804, 0x194D8804, 0x19690804, 0x194E0804, 0x19690804, 0x194E8804, 0x19690804, 0x194F0804, 0x19690804, 0x194F8804,
+            0x19690804, 0x19500804, 0x19690804, 0x19508804, 0x19690804, 0x19510804, 0x19690804, 0x19518804, 0x19690804, 0x19520804,
+            0x19690804, 0x19528804, 0x19690804, 0x19530804, 0x19690804, 0x19538804, 0x19690804, 0x19540804, 0x19690804, 0x19548804,
+            0x19690804, 0x19550804, 0x19690804, 0x19558804, 0x19690804, 0x19560804, 0x19690804, 0x19568804, 0x19690804, 0x19570804,
+            0x19690804, 0x19578804, 0x19690804, 0x19580804, 0x19690804, 0x19588804, 0x19690804, 0x19590804, 0x19690804, 0x19598804,
+            0x19690804, 0x195A0804, 0x19690804, 0x195A8804, 0x19690804, 0x195B0804, 0x19690804, 0x195B8804, 0x19690804, 0x195C0804,
+            0x19690804, 0x195C8804, 0x19690804, 0x195D0804, 0x19690804, 0x195D8804, 0x19690804, 0x195E0804, 0x19690804, 0x195E8804,
+            0x19690804, 0x195F0804, 0x19690804, 0x195F8804, 0x19690804, 0x19600804, 0x19690804, 0x19608804, 0x19690804, 0x19610804,
+            0x19690804, 0x19618804, 0x19690804, 0x19620804, 0x19690804, 0x19628804, 0x19690804, 0x1B360804, 0x1B368804, 0x175B0804,
+            0x17A18804, 0x17A10804, 0x17A28804, 0x17C00804, 0x18160804
+        };
+
+        // Single code point mappings (runs).
+        const std::uint32_t _s_ducet_run_starts[] = {
+            0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009,
+            0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+            0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+            0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x002A, 0x002B, 0x002C,
+            0x002D, 0x002E, 0x002F, 0x0030, 0x003A, 0x003B, 0x003C, 0x003F, 0x0040, 0x0041,
+            0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B,
+            0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+            0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+            0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+            0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+            0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D,
+            0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+            0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091,
+            0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B,
+            0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5,
+            0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+            0x00B0, 0x00B1, 0x00B2, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA,
+            0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4,
+            0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE,
+            0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8,
+            0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x00E0, 0x00E1, 0x00E2,
+            0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC,
+            0x00ED, 0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6,
+            0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100,
+            0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A,
+            0x010B, 0x010C, 0x010D, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114,
+            0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E,
+            0x011F, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0127, 0x0128,
+            0x0129, 0x012A, 0x012B, 0x012C, 0x012D, 0x012E, 0x012F, 0x0130, 0x0131, 0x0132,
+            0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C,
+            0x013D, 0x013E, 0x013F, 0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0146,
+            0x0147, 0x0148, 0x0149, 0x014A, 0x014B, 0x014C, 0x014D, 0x014E, 0x014F, 0x0150,
+            0x0151, 0x0152, 0x0153, 0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 0x015A,
+            0x015B, 0x015C, 0x015D, 0x015E, 0x015F, 0x0160, 0x0161, 0x0162, 0x0163, 0x0164,
+            0x0165, 0x0166, 0x0167, 0x0168, 0x0169, 0x016A, 0x016B, 0x016C, 0x016D, 0x016E,
+            0x016F, 0x0170, 0x0171, 0x0172, 0x0173, 0x0174, 0x0175, 0x0176, 0x0177, 0x0178,
+            0x0179, 0x017A, 0x017B, 0x017C, 0x017D, 0x017E, 0x017F, 0x0180, 0x0181, 0x0182,
+            0x0183, 0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0x0189, 0x018A, 0x018B, 0x018C,
+            0x018D, 0x018E, 0x018F, 0x0190, 0x0191, 0x0192, 0x0193, 0x0194, 0x0195, 0x0196,
+            0x0197, 0x0198, 0x0199, 0x019A, 0x019B, 0x019C, 0x019D, 0x019E, 0x019F, 0x01A0,
+            0x01A1, 0x01A2, 0x01A3, 0x01A4, 0x01A5, 0x01A6, 0x01A7, 0x01A8, 0x01A9, 0x01AA,
+            0x01AB, 0x01AC, 0x01AD, 0x01AE, 0x01AF, 0x01B0, 0x01B1, 0x01B2, 0x01B3, 0x01B4,
+            0x01B5, 0x01B6, 0x01B7, 0x01B8, 0x01B9, 0x01BA, 0x01BB, 0x01BC, 0x01BD, 0x01BE,
+            0x01BF, 0x01C0, 0x01C1, 0x01C2, 0x01C3, 0x01C4, 0x01C5, 0x01C6, 0x01C7, 0x01C8,
+            0x01C9, 0x01CA, 0x01CB, 0x01CC, 0x01CD, 0x01CE, 0x01CF, 0x01D0, 0x01D1, 0x01D2,
+            0x01D3, 0x01D4, 0x01D5, 0x01D6, 0x01D7, 0x01D8, 0x01D9, 0x01DA, 0x01DB, 0x01DC,
+            0x01DD, 0x01DE, 0x01DF, 0x01E0, 0x01E1, 0x01E2, 0x01E3, 0x01E4, 0x01E5, 0x01E6,
+            0x01E7, 0x01E8, 0x01E9, 0x01EA, 0x01EB, 0x01EC, 0x01ED, 0x01EE, 0x01EF, 0x01F0,
+            0x01F1, 0x01F2, 0x01F3, 0x01F4, 0x01F5, 0x01F6, 0x01F7, 0x01F8, 0x01F9, 0x01FA,
+            0x01FB, 0x01FC, 0x01FD, 0x01FE, 0x01FF, 0x0200, 0x0201, 0x0202, 0x0203, 0x0204,
+            0x0205, 0x0206, 0x0207, 0x0208, 0x0209, 0x020A, 0x020B, 0x020C, 0x020D, 0x020E,
+            0x020F, 0x0210, 0x0211, 0x0212, 0x0213, 0x0214, 0x0215, 0x0216, 0x0217, 0x0218,
+            0x0219, 0x021A, 0x021B, 0x021C, 0x021D, 0x021E, 0x021F, 0x0220, 0x0221, 0x0222,
+            0x0223, 0x0224, 0x0225, 0x0226, 0x0227, 0x0228, 0x0229, 0x022A, 0x022B, 0x022C,
+            0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0233, 0x0234, 0x0235, 0x0236,
+            0x0237, 0x0238, 0x0239, 0x023A, 0x023B, 0x023C, 0x023D, 0x023E, 0x023F, 0x0240,
+            0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A,
+            0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254,
+            0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+            0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268,
+            0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270, 0x0271, 0x0272,
+            0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C,
+            0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+            0x0287, 0x0288, 0x0289, 0x028A, 0x028B, 0x028C, 0x028D, 0x028E, 0x028F, 0x0290,
+            0x0291, 0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x0297, 0x0298, 0x0299, 0x029A,
+            0x029B, 0x029C, 0x029D, 0x029E, 0x029F, 0x02A0, 0x02A1, 0x02A2, 0x02A3, 0x02A4,
+            0x02A5, 0x02A6, 0x02A7, 0x02A8, 0x02A9, 0x02AA, 0x02AB, 0x02AC, 0x02AD, 0x02AE,
+            0x02AF, 0x02B0, 0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8,
+            0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0, 0x02C1, 0x02C2,
+            0x02D0, 0x02D2, 0x02D6, 0x02D8, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02E0,
+            0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02EE, 0x02EF, 0x0300, 0x0301, 0x0302,
+            0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C,
+            0x030D, 0x030E, 0x030F, 0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0x0316,
+            0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F, 0x0320,
+            0x0321, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326, 0x0327, 0x0328, 0x0329, 0x032A,
+            0x032B, 0x032C, 0x032D, 0x032E, 0x032F, 0x0330, 0x0331, 0x0332, 0x0333, 0x0334,
+            0x0335, 0x0336, 0x0337, 0x0338, 0x0339, 0x033A, 0x033B, 0x033C, 0x033D, 0x033E,
+            0x033F, 0x0340, 0x0341, 0x0342, 0x0343, 0x0344, 0x0345, 0x0346, 0x0347, 0x0348,
+            0x0349, 0x034A, 0x034B, 0x034C, 0x034D, 0x034E, 0x034F, 0x0350, 0x0351, 0x0352,
+            0x0353, 0x0354, 0x0355, 0x0356, 0x0357, 0x0358, 0x0359, 0x035A, 0x035B, 0x035C,
+            0x035D, 0x035E, 0x035F, 0x0360, 0x0361, 0x0362, 0x0363, 0x0364, 0x0365, 0x0366,
+            0x0367, 0x0368, 0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F, 0x0370,
+            0x0371, 0x0372, 0x0373, 0x0374, 0x0376, 0x0377, 0x037A, 0x037B, 0x037C, 0x037D,
+            0x037E, 0x037F, 0x0384, 0x0385, 0x0386, 0x0387, 0x0388, 0x0389, 0x038A, 0x038C,
+            0x038E, 0x038F, 0x0390, 0x0391, 0x0394, 0x0396, 0x0397, 0x039A, 0x039C, 0x03A1,
+            0x03A3, 0x03A4, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF, 0x03B0,
+            0x03B1, 0x03B4, 0x03B6, 0x03B7, 0x03BA, 0x03BC, 0x03C1, 0x03C2, 0x03C3, 0x03C4,
+            0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x03CF, 0x03D0, 0x03D1, 0x03D2,
+            0x03D3, 0x03D4, 0x03D5, 0x03D6, 0x03D7, 0x03D8, 0x03D9, 0x03DA, 0x03DB, 0x03DC,
+            0x03DD, 0x03DE, 0x03DF, 0x03E0, 0x03E1, 0x03E2, 0x03E3, 0x03E4, 0x03E5, 0x03E6,
+            0x03E7, 0x03E8, 0x03E9, 0x03EA, 0x03EB, 0x03EC, 0x03ED, 0x03EE, 0x03EF, 0x03F0,
+            0x03F1, 0x03F2, 0x03F3, 0x03F4, 0x03F5, 0x03F6, 0x03F7, 0x03F8, 0x03F9, 0x03FA,
+            0x03FB, 0x03FC, 0x03FD, 0x03FE, 0x03FF, 0x0400, 0x0401, 0x0402, 0x0403, 0x0404,
+            0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x040D, 0x040E,
+            0x040F, 0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418,
+            0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, 0x0420, 0x0421, 0x0422,
+            0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C,
+            0x042D, 0x042E, 0x042F, 0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436,
+            0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440,
+            0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A,
+            0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0450, 0x0451, 0x0452, 0x0453, 0x0454,
+            0x0455, 0x0456, 0x0457, 0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x045D, 0x045E,
+            0x045F, 0x0460, 0x0461, 0x0462, 0x0463, 0x0464, 0x0465, 0x0466, 0x0467, 0x0468,
+            0x0469, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0470, 0x0471, 0x0472,
+            0x0473, 0x0474, 0x0475, 0x0476, 0x0477, 0x0478, 0x0479, 0x047A, 0x047B, 0x047C,
+            0x047D, 0x047E, 0x047F, 0x0480, 0x0481, 0x0482, 0x0483, 0x0484, 0x0485, 0x0486,
+            0x0487, 0x0488, 0x0489, 0x048A, 0x048B, 0x048C, 0x048D, 0x048E, 0x048F, 0x0490,
+            0x0491, 0x0492, 0x0493, 0x0494, 0x0495, 0x0496, 0x0497, 0x0498, 0x0499, 0x049A,
+            0x049B, 0x049C, 0x049D, 0x049E, 0x049F, 0x04A0, 0x04A1, 0x04A2, 0x04A3, 0x04A4,
+            0x04A5, 0x04A6, 0x04A7, 0x04A8, 0x04A9, 0x04AA, 0x04AB, 0x04AC, 0x04AD, 0x04AE,
+            0x04AF, 0x04B0, 0x04B1, 0x04B2, 0x04B3, 0x04B4, 0x04B5, 0x04B6, 0x04B7, 0x04B8,
+            0x04B9, 0x04BA, 0x04BB, 0x04BC, 0x04BD, 0x04BE, 0x04BF, 0x04C0, 0x04C1, 0x04C2,
+            0x04C3, 0x04C4, 0x04C5, 0x04C6, 0x04C7, 0x04C8, 0x04C9, 0x04CA, 0x04CB, 0x04CC,
+            0x04CD, 0x04CE, 0x04CF, 0x04D0, 0x04D1, 0x04D2, 0x04D3, 0x04D4, 0x04D5, 0x04D6,
+            0x04D7, 0x04D8, 0x04D9, 0x04DA, 0x04DB, 0x04DC, 0x04DD, 0x04DE, 0x04DF, 0x04E0,
+            0x04E1, 0x04E2, 0x04E3, 0x04E4, 0x04E5, 0x04E6, 0x04E7, 0x04E8, 0x04E9, 0x04EA,
+            0x04EB, 0x04EC, 0x04ED, 0x04EE, 0x04EF, 0x04F0, 0x04F1, 0x04F2, 0x04F3, 0x04F4,
+            0x04F5, 0x04F6, 0x04F7, 0x04F8, 0x04F9, 0x04FA, 0x04FB, 0x04FC, 0x04FD, 0x04FE,
+            0x04FF, 0x0500, 0x0501, 0x0502, 0x0503, 0x0504, 0x0505, 0x0506, 0x0507, 0x0508,
+            0x0509, 0x050A, 0x050B, 0x050C, 0x050D, 0x050E, 0x050F, 0x0510, 0x0511, 0x0512,
+            0x0513, 0x0514, 0x0515, 0x0516, 0x0517, 0x0518, 0x0519, 0x051A, 0x051B, 0x051C,
+            0x051D, 0x051E, 0x051F, 0x0520, 0x0521, 0x0522, 0x0523, 0x0524, 0x0525, 0x0526,
+            0x0527, 0x0528, 0x0529, 0x052A, 0x052B, 0x052C, 0x052D, 0x052E, 0x052F, 0x0531,
+            0x0532, 0x0546, 0x0559, 0x055A, 0x055C, 0x055D, 0x055E, 0x055F, 0x0560, 0x0561,
+            0x0562, 0x0576, 0x0587, 0x0588, 0x0589, 0x058A, 0x058D, 0x058F, 0x0591, 0x0592,
+            0x0593, 0x0594, 0x0595, 0x0596, 0x0597, 0x0598, 0x0599, 0x059A, 0x059B, 0x059C,
+            0x059D, 0x059E, 0x059F, 0x05A0, 0x05A1, 0x05A2, 0x05A3, 0x05A4, 0x05A5, 0x05A6,
+            0x05A7, 0x05A8, 0x05A9, 0x05AA, 0x05AB, 0x05AC, 0x05AD, 0x05AE, 0x05AF, 0x05B0,
+            0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7, 0x05B8, 0x05B9, 0x05BA,
+            0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF, 0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05C4,
+            0x05C5, 0x05C6, 0x05C7, 0x05D0, 0x05DA, 0x05DB, 0x05DD, 0x05DE, 0x05DF, 0x05E0,
+            0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05EF, 0x05F0, 0x05F1, 0x05F2, 0x05F3, 0x0600,
+            0x0601, 0x0602, 0x0603, 0x0604, 0x0605, 0x0606, 0x0607, 0x0608, 0x0609, 0x060A,
+            0x060B, 0x060C, 0x060E, 0x0610, 0x0611, 0x0612, 0x0613, 0x0614, 0x0615, 0x0616,
+            0x0617, 0x0618, 0x0619, 0x061A, 0x061B, 0x061C, 0x061E, 0x061F, 0x0620, 0x0621,
+            0x0624, 0x0626, 0x0627, 0x0628, 0x0629, 0x062C, 0x062D, 0x062F, 0x0631, 0x0633,
+            0x0635, 0x0637, 0x0639, 0x063B, 0x063D, 0x0640, 0x0641, 0x0642, 0x0643, 0x0644,
+            0x0645, 0x0646, 0x0647, 0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E,
+            0x064F, 0x0650, 0x0651, 0x0652, 0x0653, 0x0654, 0x0655, 0x0656, 0x0657, 0x0658,
+            0x0659, 0x065A, 0x065B, 0x065C, 0x065D, 0x065E, 0x065F, 0x0660, 0x066A, 0x066B,
+            0x066D, 0x066E, 0x066F, 0x0670, 0x0671, 0x0672, 0x0673, 0x0674, 0x0675, 0x0676,
+            0x0677, 0x0678, 0x0679, 0x067B, 0x067C, 0x067E, 0x067F, 0x0680, 0x0681, 0x0683,
+            0x0685, 0x0686, 0x0687, 0x0688, 0x068E, 0x0691, 0x069A, 0x069D, 0x069E, 0x069F,
+            0x06A0, 0x06A1, 0x06A3, 0x06A5, 0x06A7, 0x06A8, 0x06A9, 0x06AD, 0x06AF, 0x06B0,
+            0x06B5, 0x06B9, 0x06BA, 0x06BB, 0x06BE, 0x06BF, 0x06C0, 0x06C1, 0x06C2, 0x06C3,
+            0x06C4, 0x06CC, 0x06CF, 0x06D0, 0x06D2, 0x06D3, 0x06D4, 0x06D5, 0x06D6, 0x06D7,
+            0x06D8, 0x06D9, 0x06DA, 0x06DB, 0x06DC, 0x06DD, 0x06DE, 0x06DF, 0x06E0, 0x06E1,
+            0x06E2, 0x06E3, 0x06E4, 0x06E5, 0x06E6, 0x06E7, 0x06E8, 0x06E9, 0x06EA, 0x06EB,
+            0x06EC, 0x06ED, 0x06EE, 0x06EF, 0x06F0, 0x06FA, 0x06FB, 0x06FC, 0x06FD, 0x06FE,
+            0x06FF, 0x0700, 0x0701, 0x0703, 0x0709, 0x070A, 0x070F, 0x0710, 0x0711, 0x0712,
+            0x0714, 0x0715, 0x0716, 0x0717, 0x071A, 0x071C, 0x071D, 0x0720, 0x0724, 0x0725,
+            0x0727, 0x0728, 0x072D, 0x072E, 0x072F, 0x0730, 0x0731, 0x0732, 0x0733, 0x0734,
+            0x0735, 0x0736, 0x0737, 0x0738, 0x0739, 0x073A, 0x073B, 0x073C, 0x073D, 0x073E,
+            0x073F, 0x0740, 0x0741, 0x0742, 0x0743, 0x0744, 0x0745, 0x0746, 0x0747, 0x0748,
+            0x0749, 0x074A, 0x074D, 0x074E, 0x074F, 0x0750, 0x0756, 0x0757, 0x0759, 0x075B,
+            0x075C, 0x075D, 0x0760, 0x0762, 0x0763, 0x0765, 0x0767, 0x076A, 0x076B, 0x076D,
+            0x076E, 0x0770, 0x0771, 0x0772, 0x0773, 0x0775, 0x0778, 0x077A, 0x077C, 0x077D,
+            0x077F, 0x0780, 0x0781, 0x0784, 0x0788, 0x0789, 0x078C, 0x078D, 0x078F, 0x0791,
+            0x0798, 0x0799, 0x079B, 0x079C, 0x079D, 0x07A0, 0x07A2, 0x07A4, 0x07A5, 0x07A6,
+            0x07B1, 0x07C0, 0x07CA, 0x07E8, 0x07E9, 0x07EA, 0x07EB, 0x07EC, 0x07ED, 0x07EE,
+            0x07EF, 0x07F0, 0x07F1, 0x07F2, 0x07F3, 0x07F4, 0x07F6, 0x07F7, 0x07F8, 0x07F9,
+            0x07FA, 0x07FD, 0x07FE, 0x0800, 0x0818, 0x0819, 0x081A, 0x081C, 0x081D, 0x081E,
+            0x081F, 0x0820, 0x0821, 0x0822, 0x0823, 0x0824, 0x0825, 0x0826, 0x0827, 0x0828,
+            0x0829, 0x082A, 0x082B, 0x082C, 0x082D, 0x0830, 0x0840, 0x0859, 0x085A, 0x085B,
+            0x085E, 0x0860, 0x08A0, 0x08A1, 0x08A2, 0x08A3, 0x08A4, 0x08A5, 0x08A6, 0x08A7,
+            0x08A8, 0x08AA, 0x08AB, 0x08AC, 0x08AD, 0x08AE, 0x08AF, 0x08B0, 0x08B1, 0x08B2,
+            0x08B3, 0x08B4, 0x08B6, 0x08B8, 0x08B9, 0x08BA, 0x08BB, 0x08BC, 0x08BD, 0x08BE,
+            0x08BF, 0x08C1, 0x08C2, 0x08C3, 0x08C4, 0x08C5, 0x08C7, 0x08D3, 0x08D4, 0x08D5,
+            0x08D6, 0x08D7, 0x08D8, 0x08D9, 0x08DA, 0x08DB, 0x08DC, 0x08DD, 0x08DE, 0x08DF,
+            0x08E0, 0x08E1, 0x08E2, 0x08E3, 0x08E4, 0x08E5, 0x08E6, 0x08E7, 0x08E8, 0x08E9,
+            0x08EA, 0x08EB, 0x08EC, 0x08ED, 0x08EE, 0x08EF, 0x08F0, 0x08F1, 0x08F2, 0x08F3,
+            0x08F4, 0x08F5, 0x08F6, 0x08F7, 0x08F8, 0x08F9, 0x08FA, 0x08FB, 0x08FC, 0x08FD,
+            0x08FE, 0x08FF, 0x0900, 0x0901, 0x0902, 0x0903, 0x0904, 0x0907, 0x090C, 0x090D,
+            0x0911, 0x0918, 0x091D, 0x0921, 0x0922, 0x0929, 0x092A, 0x092D, 0x0930, 0x0931,
+            0x0932, 0x0934, 0x0935, 0x093A, 0x093C, 0x093D, 0x093E, 0x093F, 0x0945, 0x0946,
+            0x0948, 0x0949, 0x094E, 0x094F, 0x0950, 0x0951, 0x0952, 0x0953, 0x0954, 0x0955,
+            0x0956, 0x0958, 0x0959, 0x095A, 0x095B, 0x095C, 0x095D, 0x095E, 0x095F, 0x0960,
+            0x0961, 0x0962, 0x0964, 0x0966, 0x0970, 0x0971, 0x0972, 0x0973, 0x0978, 0x0979,
+            0x097A, 0x097B, 0x097C, 0x097D, 0x097E, 0x097F, 0x0980, 0x0981, 0x0982, 0x0983,
+            0x0985, 0x098C, 0x098F, 0x0993, 0x09AA, 0x09B2, 0x09B6, 0x09BC, 0x09BD, 0x09C7,
+            0x09C8, 0x09CB, 0x09CE, 0x09D7, 0x09DC, 0x09DD, 0x09DF, 0x09E0, 0x09E1, 0x09E2,
+            0x09E6, 0x09F0, 0x09F1, 0x09F2, 0x09F4, 0x09FA, 0x09FB, 0x09FC, 0x09FD, 0x09FE,
+            0x0A01, 0x0A02, 0x0A03, 0x0A05, 0x0A07, 0x0A09, 0x0A0F, 0x0A10, 0x0A13, 0x0A14,
+            0x0A15, 0x0A2A, 0x0A30, 0x0A32, 0x0A33, 0x0A35, 0x0A36, 0x0A38, 0x0A3C, 0x0A3E,
+            0x0A47, 0x0A4B, 0x0A51, 0x0A59, 0x0A5A, 0x0A5B, 0x0A5C, 0x0A5E, 0x0A66, 0x0A70,
+            0x0A71, 0x0A72, 0x0A73, 0x0A74, 0x0A75, 0x0A76, 0x0A81, 0x0A82, 0x0A83, 0x0A85,
+            0x0A8C, 0x0A8D, 0x0A8F, 0x0A93, 0x0A9D, 0x0AAA, 0x0AB2, 0x0AB3, 0x0AB5, 0x0ABC,
+            0x0ABD, 0x0AC5, 0x0AC7, 0x0ACB, 0x0AD0, 0x0AE0, 0x0AE1, 0x0AE2, 0x0AE6, 0x0AF0,
+            0x0AF1, 0x0AF9, 0x0AFA, 0x0AFB, 0x0AFC, 0x0AFD, 0x0AFE, 0x0AFF, 0x0B01, 0x0B02,
+            0x0B03, 0x0B05, 0x0B0C, 0x0B0F, 0x0B13, 0x0B2A, 0x0B30, 0x0B32, 0x0B35, 0x0B36,
+            0x0B3C, 0x0B3D, 0x0B47, 0x0B48, 0x0B4B, 0x0B55, 0x0B56, 0x0B5C, 0x0B5D, 0x0B5F,
+            0x0B60, 0x0B61, 0x0B62, 0x0B66, 0x0B70, 0x0B71, 0x0B72, 0x0B82, 0x0B83, 0x0B85,
+            0x0B8E, 0x0B92, 0x0B93, 0x0B95, 0x0B99, 0x0B9C, 0x0B9E, 0x0BA3, 0x0BA8, 0x0BA9,
+            0x0BAA, 0x0BAE, 0x0BB1, 0x0BB2, 0x0BB3, 0x0BB4, 0x0BB5, 0x0BB6, 0x0BBE, 0x0BC6,
+            0x0BC7, 0x0BC8, 0x0BCA, 0x0BD0, 0x0BD7, 0x0BE6, 0x0BF0, 0x0BF3, 0x0BF9, 0x0BFA,
+            0x0C00, 0x0C01, 0x0C02, 0x0C03, 0x0C04, 0x0C05, 0x0C0C, 0x0C0E, 0x0C12, 0x0C1B,
+            0x0C1D, 0x0C2A, 0x0C33, 0x0C35, 0x0C3D, 0x0C46, 0x0C47, 0x0C4A, 0x0C55, 0x0C58,
+            0x0C59, 0x0C5A, 0x0C60, 0x0C61, 0x0C62, 0x0C66, 0x0C77, 0x0C78, 0x0C7C, 0x0C7F,
+            0x0C80, 0x0C81, 0x0C82, 0x0C83, 0x0C84, 0x0C85, 0x0C8C, 0x0C8E, 0x0C92, 0x0CAA,
+            0x0CB3, 0x0CB5, 0x0CBC, 0x0CBD, 0x0CBE, 0x0CBF, 0x0CC0, 0x0CC6, 0x0CC7, 0x0CCA,
+            0x0CCB, 0x0CD5, 0x0CDE, 0x0CE0, 0x0CE1, 0x0CE2, 0x0CE6, 0x0CF1, 0x0D00, 0x0D01,
+            0x0D02, 0x0D03, 0x0D04, 0x0D05, 0x0D09, 0x0D0C, 0x0D0E, 0x0D12, 0x0D31, 0x0D32,
+            0x0D33, 0x0D35, 0x0D3A, 0x0D3B, 0x0D3C, 0x0D3D, 0x0D3E, 0x0D46, 0x0D47, 0x0D48,
+            0x0D4A, 0x0D4D, 0x0D4E, 0x0D4F, 0x0D54, 0x0D55, 0x0D56, 0x0D57, 0x0D58, 0x0D5F,
+            0x0D60, 0x0D61, 0x0D62, 0x0D66, 0x0D70, 0x0D79, 0x0D7A, 0x0D7B, 0x0D7C, 0x0D7D,
+            0x0D7E, 0x0D7F, 0x0D81, 0x0D82, 0x0D83, 0x0D85, 0x0D9A, 0x0DB3, 0x0DBD, 0x0DC0,
+            0x0DCA, 0x0DCF, 0x0DD6, 0x0DD8, 0x0DD9, 0x0DDA, 0x0DDC, 0x0DDD, 0x0DDF, 0x0DE6,
+            0x0DF2, 0x0DF3, 0x0DF4, 0x0E01, 0x0E3F, 0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44,
+            0x0E45, 0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E,
+            0x0E4F, 0x0E50, 0x0E5A, 0x0E81, 0x0E84, 0x0E86, 0x0E8A, 0x0E8C, 0x0E8D, 0x0E8E,
+            0x0E8F, 0x0EA5, 0x0EA7, 0x0EAA, 0x0EAB, 0x0EC0, 0x0EC1, 0x0EC2, 0x0EC3, 0x0EC4,
+            0x0EC6, 0x0EC8, 0x0EC9, 0x0ECA, 0x0ECB, 0x0ECC, 0x0ECD, 0x0ED0, 0x0EDC, 0x0EDD,
+            0x0EDE, 0x0EDF, 0x0F00, 0x0F01, 0x0F04, 0x0F0B, 0x0F0C, 0x0F0D, 0x0F13, 0x0F14,
+            0x0F15, 0x0F18, 0x0F19, 0x0F1A, 0x0F20, 0x0F2A, 0x0F33, 0x0F34, 0x0F35, 0x0F36,
+            0x0F37, 0x0F38, 0x0F39, 0x0F3A, 0x0F3E, 0x0F3F, 0x0F40, 0x0F41, 0x0F42, 0x0F43,
+            0x0F44, 0x0F45, 0x0F46, 0x0F47, 0x0F49, 0x0F4A, 0x0F4B, 0x0F4C, 0x0F4D, 0x0F4E,
+            0x0F4F, 0x0F50, 0x0F51, 0x0F52, 0x0F53, 0x0F54, 0x0F55, 0x0F56, 0x0F57, 0x0F58,
+            0x0F59, 0x0F5A, 0x0F5B, 0x0F5C, 0x0F5D, 0x0F5E, 0x0F5F, 0x0F60, 0x0F61, 0x0F62,
+            0x0F63, 0x0F64, 0x0F65, 0x0F66, 0x0F67, 0x0F68, 0x0F69, 0x0F6A, 0x0F6B, 0x0F6C,
+            0x0F71, 0x0F72, 0x0F74, 0x0F7E, 0x0F7F, 0x0F80, 0x0F82, 0x0F83, 0x0F84, 0x0F85,
+            0x0F86, 0x0F87, 0x0F88, 0x0F89, 0x0F8A, 0x0F8C, 0x0F8D, 0x0F8E, 0x0F8F, 0x0F90,
+            0x0F91, 0x0F92, 0x0F93, 0x0F94, 0x0F95, 0x0F96, 0x0F97, 0x0F99, 0x0F9A, 0x0F9B,
+            0x0F9C, 0x0F9D, 0x0F9E, 0x0F9F, 0x0FA0, 0x0FA1, 0x0FA2, 0x0FA3, 0x0FA4, 0x0FA5,
+            0x0FA6, 0x0FA7, 0x0FA8, 0x0FA9, 0x0FAA, 0x0FAB, 0x0FAC, 0x0FAD, 0x0FAE, 0x0FAF,
+            0x0FB0, 0x0FB1, 0x0FB2, 0x0FB3, 0x0FB4, 0x0FB5, 0x0FB6, 0x0FB7, 0x0FB8, 0x0FB9,
+            0x0FBA, 0x0FBB, 0x0FBC, 0x0FBE, 0x0FC6, 0x0FC7, 0x0FCE, 0x0FD0, 0x0FD2, 0x0FD5,
+            0x0FD9, 0x1000, 0x1001, 0x1002, 0x1003, 0x1004, 0x1005, 0x1006, 0x1007, 0x1008,
+            0x1009, 0x100A, 0x100C, 0x100D, 0x100E, 0x100F, 0x1010, 0x1013, 0x1014, 0x1015,
+            0x1017, 0x1018, 0x1019, 0x101A, 0x101B, 0x101C, 0x101D, 0x101E, 0x101F, 0x1020,
+            0x1021, 0x1025, 0x1026, 0x1027, 0x102B, 0x102C, 0x102D, 0x102E, 0x102F, 0x1030,
+            0x1031, 0x1032, 0x1033, 0x1034, 0x1035, 0x1036, 0x1037, 0x1038, 0x1039, 0x103B,
+            0x103C, 0x103D, 0x103E, 0x103F, 0x1040, 0x104A, 0x104C, 0x1050, 0x1052, 0x1056,
+            0x105A, 0x105B, 0x105C, 0x105E, 0x105F, 0x1060, 0x1061, 0x1062, 0x1063, 0x1065,
+            0x1066, 0x1067, 0x1069, 0x106E, 0x106F, 0x1071, 0x1072, 0x1073, 0x1075, 0x1076,
+            0x1077, 0x1078, 0x1079, 0x107A, 0x107B, 0x107C, 0x107D, 0x107F, 0x1080, 0x1081,
+            0x1082, 0x1083, 0x1084, 0x1085, 0x1086, 0x1087, 0x1088, 0x1089, 0x108B, 0x108C,
+            0x108E, 0x108F, 0x1090, 0x109A, 0x109C, 0x109D, 0x109E, 0x10A0, 0x10A1, 0x10A2,
+            0x10A3, 0x10A4, 0x10A5, 0x10A6, 0x10A7, 0x10A8, 0x10A9, 0x10AA, 0x10AB, 0x10AC,
+            0x10AD, 0x10AE, 0x10AF, 0x10B0, 0x10B1, 0x10B2, 0x10B3, 0x10B4, 0x10B5, 0x10B6,
+            0x10B7, 0x10B8, 0x10B9, 0x10BA, 0x10BB, 0x10BC, 0x10BD, 0x10BE, 0x10BF, 0x10C0,
+            0x10C1, 0x10C2, 0x10C3, 0x10C4, 0x10C5, 0x10C7, 0x10CD, 0x10D0, 0x10D1, 0x10D2,
+            0x10D3, 0x10D4, 0x10D5, 0x10D6, 0x10D7, 0x10D8, 0x10D9, 0x10DA, 0x10DB, 0x10DC,
+            0x10DD, 0x10DE, 0x10DF, 0x10E0, 0x10E1, 0x10E2, 0x10E3, 0x10E4, 0x10E5, 0x10E6,
+            0x10E7, 0x10E8, 0x10E9, 0x10EA, 0x10EB, 0x10EC, 0x10ED, 0x10EE, 0x10EF, 0x10F0,
+            0x10F1, 0x10F2, 0x10F3, 0x10F4, 0x10F5, 0x10F6, 0x10F8, 0x10FB, 0x10FC, 0x10FD,
+            0x10FE, 0x1100, 0x115F, 0x11A8, 0x1200, 0x1210, 0x1220, 0x1230, 0x1238, 0x1240,
+            0x124A, 0x1250, 0x1258, 0x125A, 0x1260, 0x1268, 0x1278, 0x1280, 0x128A, 0x1290,
+            0x1298, 0x12A0, 0x12A8, 0x12B2, 0x12B8, 0x12C0, 0x12C2, 0x12C8, 0x12D8, 0x12E0,
+            0x12F8, 0x1300, 0x1308, 0x1312, 0x1318, 0x1320, 0x1328, 0x1330, 0x1338, 0x1340,
+            0x1350, 0x1358, 0x135D, 0x135E, 0x135F, 0x1360, 0x1361, 0x1362, 0x1363, 0x1367,
+            0x1368, 0x1369, 0x1372, 0x1380, 0x1384, 0x1388, 0x138C, 0x1390, 0x13A0, 0x13F8,
+            0x1400, 0x1401, 0x1501, 0x157C, 0x157D, 0x157E, 0x158E, 0x1596, 0x15A7, 0x166D,
+            0x166E, 0x166F, 0x1670, 0x1671, 0x1677, 0x1680, 0x1681, 0x169B, 0x16A0, 0x16A1,
+            0x16A2, 0x16A3, 0x16A4, 0x16A5, 0x16A6, 0x16A7, 0x16A8, 0x16A9, 0x16AA, 0x16AB,
+            0x16AC, 0x16AD, 0x16AE, 0x16AF, 0x16B3, 0x16B4, 0x16B5, 0x16B6, 0x16B7, 0x16B8,
+            0x16B9, 0x16BB, 0x16BC, 0x16BD, 0x16BE, 0x16BF, 0x16C0, 0x16C1, 0x16C2, 0x16C3,
+            0x16C4, 0x16C5, 0x16C6, 0x16C7, 0x16CB, 0x16CC, 0x16CD, 0x16CE, 0x16CF, 0x16D0,
+            0x16D1, 0x16D2, 0x16D3, 0x16D4, 0x16D5, 0x16D6, 0x16D7, 0x16D8, 0x16D9, 0x16DA,
+            0x16DB, 0x16DC, 0x16DD, 0x16DE, 0x16E0, 0x16E1, 0x16E3, 0x16E4, 0x16E5, 0x16E7,
+            0x16E8, 0x16E9, 0x16EA, 0x16EB, 0x16EE, 0x16EF, 0x16F0, 0x16F1, 0x16F2, 0x16F3,
+            0x16F4, 0x16F5, 0x16F6, 0x16F7, 0x16F8, 0x1700, 0x170E, 0x1720, 0x1735, 0x1740,
+            0x1760, 0x176E, 0x1772, 0x1780, 0x17A3, 0x17B4, 0x17B5, 0x17B6, 0x17C6, 0x17C7,
+            0x17C8, 0x17C9, 0x17CA, 0x17CB, 0x17CC, 0x17CD, 0x17CE, 0x17CF, 0x17D0, 0x17D1,
+            0x17D2, 0x17D3, 0x17D4, 0x17D6, 0x17D7, 0x17D8, 0x17DB, 0x17DC, 0x17DD, 0x17E0,
+            0x17F0, 0x1800, 0x1801, 0x1802, 0x1803, 0x1804, 0x1806, 0x1808, 0x1809, 0x180A,
+            0x180B, 0x180C, 0x180D, 0x180E, 0x1810, 0x1820, 0x1821, 0x1822, 0x1823, 0x1824,
+            0x1825, 0x1826, 0x1827, 0x182A, 0x182B, 0x182C, 0x182D, 0x182E, 0x182F, 0x1832,
+            0x1833, 0x1834, 0x1835, 0x1836, 0x1837, 0x1838, 0x1839, 0x183A, 0x183B, 0x183D,
+            0x183E, 0x183F, 0x1843, 0x1844, 0x1845, 0x1846, 0x1847, 0x1848, 0x1849, 0x184A,
+            0x184B, 0x184C, 0x184D, 0x184E, 0x184F, 0x1850, 0x1851, 0x1852, 0x1853, 0x1854,
+            0x1855, 0x1856, 0x1857, 0x1858, 0x1859, 0x185A, 0x185C, 0x185D, 0x185E, 0x185F,
+            0x1860, 0x1861, 0x1862, 0x1863, 0x1864, 0x1865, 0x1866, 0x1867, 0x1868, 0x1869,
+            0x186A, 0x186B, 0x186C, 0x186D, 0x186E, 0x186F, 0x1870, 0x1871, 0x1872, 0x1873,
+            0x1874, 0x1875, 0x1876, 0x1877, 0x1878, 0x1880, 0x1887, 0x1888, 0x1889, 0x188A,
+            0x188B, 0x188C, 0x188D, 0x188F, 0x1891, 0x1892, 0x1894, 0x1895, 0x1896, 0x1898,
+            0x1899, 0x189A, 0x189B, 0x189C, 0x189E, 0x189F, 0x18A0, 0x18A1, 0x18A2, 0x18A3,
+            0x18A4, 0x18A6, 0x18A8, 0x18A9, 0x18AA, 0x18B0, 0x1900, 0x191D, 0x191E, 0x1920,
+            0x1930, 0x1939, 0x193A, 0x193B, 0x1940, 0x1944, 0x1945, 0x1946, 0x1950, 0x1970,
+            0x1980, 0x19B0, 0x19B5, 0x19B6, 0x19B7, 0x19B8, 0x19BA, 0x19BB, 0x19D0, 0x19DA,
+            0x19DE, 0x19DF, 0x19E0, 0x1A00, 0x1A1E, 0x1A20, 0x1A4D, 0x1A53, 0x1A54, 0x1A55,
+            0x1A58, 0x1A59, 0x1A5A, 0x1A5B, 0x1A5C, 0x1A60, 0x1A61, 0x1A62, 0x1A64, 0x1A65,
+            0x1A6B, 0x1A6C, 0x1A6D, 0x1A6E, 0x1A70, 0x1A73, 0x1A74, 0x1A75, 0x1A76, 0x1A77,
+            0x1A78, 0x1A79, 0x1A7A, 0x1A7B, 0x1A7C, 0x1A7F, 0x1A80, 0x1A90, 0x1AA0, 0x1AA7,
+            0x1AA8, 0x1AAC, 0x1AB0, 0x1AB1, 0x1AB2, 0x1AB3, 0x1AB4, 0x1AB5, 0x1AB6, 0x1AB7,
+            0x1AB8, 0x1AB9, 0x1ABA, 0x1ABB, 0x1ABC, 0x1ABD, 0x1ABE, 0x1ABF, 0x1AC0, 0x1B00,
+            0x1B01, 0x1B02, 0x1B03, 0x1B04, 0x1B05, 0x1B06, 0x1B07, 0x1B08, 0x1B09, 0x1B0A,
+            0x1B0B, 0x1B0C, 0x1B0D, 0x1B0E, 0x1B11, 0x1B12, 0x1B14, 0x1B23, 0x1B28, 0x1B30,
+            0x1B33, 0x1B34, 0x1B35, 0x1B3A, 0x1B3B, 0x1B3C, 0x1B3D, 0x1B3E, 0x1B3F, 0x1B40,
+            0x1B42, 0x1B43, 0x1B45, 0x1B47, 0x1B48, 0x1B49, 0x1B4A, 0x1B50, 0x1B5A, 0x1B5C,
+            0x1B5D, 0x1B5E, 0x1B60, 0x1B61, 0x1B6B, 0x1B6C, 0x1B6D, 0x1B6E, 0x1B6F, 0x1B70,
+            0x1B71, 0x1B72, 0x1B73, 0x1B74, 0x1B80, 0x1B81, 0x1B82, 0x1B83, 0x1B8B, 0x1B99,
+            0x1B9A, 0x1B9B, 0x1B9C, 0x1B9D, 0x1B9E, 0x1BA0, 0x1BA1, 0x1BA2, 0x1BA3, 0x1BA4,
+            0x1BAC, 0x1BAD, 0x1BAE, 0x1BAF, 0x1BB0, 0x1BBA, 0x1BBB, 0x1BBC, 0x1BBD, 0x1BBE,
+            0x1BBF, 0x1BC0, 0x1BC1, 0x1BC2, 0x1BC3, 0x1BC4, 0x1BC5, 0x1BC6, 0x1BC7, 0x1BC8,
+            0x1BC9, 0x1BCA, 0x1BCB, 0x1BCC, 0x1BCD, 0x1BCE, 0x1BCF, 0x1BD0, 0x1BD3, 0x1BD4,
+            0x1BD5, 0x1BD6, 0x1BD7, 0x1BD8, 0x1BD9, 0x1BDA, 0x1BDB, 0x1BDC, 0x1BDD, 0x1BDF,
+            0x1BE0, 0x1BE6, 0x1BE7, 0x1BE8, 0x1BE9, 0x1BEB, 0x1BEC, 0x1BED, 0x1BEE, 0x1BEF,
+            0x1BF0, 0x1BFC, 0x1C00, 0x1C0A, 0x1C1B, 0x1C1C, 0x1C24, 0x1C25, 0x1C26, 0x1C36,
+            0x1C37, 0x1C3B, 0x1C3D, 0x1C40, 0x1C4D, 0x1C50, 0x1C5A, 0x1C7E, 0x1C80, 0x1C81,
+            0x1C82, 0x1C83, 0x1C84, 0x1C85, 0x1C86, 0x1C87, 0x1C88, 0x1C90, 0x1C91, 0x1C92,
+            0x1C93, 0x1C94, 0x1C95, 0x1C96, 0x1C97, 0x1C98, 0x1C99, 0x1C9A, 0x1C9B, 0x1C9C,
+            0x1C9D, 0x1C9E, 0x1C9F, 0x1CA0, 0x1CA1, 0x1CA2, 0x1CA3, 0x1CA4, 0x1CA5, 0x1CA6,
+            0x1CA7, 0x1CA8, 0x1CA9, 0x1CAA, 0x1CAB, 0x1CAC, 0x1CAD, 0x1CAE, 0x1CAF, 0x1CB0,
+            0x1CB1, 0x1CB2, 0x1CB3, 0x1CB4, 0x1CB5, 0x1CB6, 0x1CB8, 0x1CBD, 0x1CBE, 0x1CC0,
+            0x1CD0, 0x1CD1, 0x1CD2, 0x1CD3, 0x1CD4, 0x1CD5, 0x1CD6, 0x1CD7, 0x1CD8, 0x1CD9,
+            0x1CDA, 0x1CDB, 0x1CDC, 0x1CDD, 0x1CDE, 0x1CDF, 0x1CE0, 0x1CE1, 0x1CE2, 0x1CE3,
+            0x1CE4, 0x1CE5, 0x1CE6, 0x1CE7, 0x1CE8, 0x1CE9, 0x1CEA, 0x1CEB, 0x1CEC, 0x1CED,
+            0x1CEE, 0x1CEF, 0x1CF0, 0x1CF1, 0x1CF2, 0x1CF3, 0x1CF4, 0x1CF5, 0x1CF7, 0x1CF8,
+            0x1CF9, 0x1CFA, 0x1D00, 0x1D01, 0x1D03, 0x1D04, 0x1D05, 0x1D07, 0x1D08, 0x1D09,
+            0x1D0A, 0x1D0B, 0x1D0C, 0x1D0D, 0x1D0E, 0x1D0F, 0x1D10, 0x1D11, 0x1D12, 0x1D13,
+            0x1D14, 0x1D15, 0x1D16, 0x1D18, 0x1D19, 0x1D1A, 0x1D1B, 0x1D1C, 0x1D1D, 0x1D1F,
+            0x1D20, 0x1D21, 0x1D22, 0x1D23, 0x1D24, 0x1D26, 0x1D27, 0x1D28, 0x1D29, 0x1D2A,
+            0x1D2B, 0x1D2C, 0x1D2D, 0x1D2E, 0x1D2F, 0x1D30, 0x1D31, 0x1D32, 0x1D33, 0x1D34,
+            0x1D35, 0x1D36, 0x1D37, 0x1D38, 0x1D39, 0x1D3A, 0x1D3B, 0x1D3C, 0x1D3D, 0x1D3E,
+            0x1D3F, 0x1D40, 0x1D41, 0x1D42, 0x1D43, 0x1D44, 0x1D45, 0x1D46, 0x1D47, 0x1D48,
+            0x1D49, 0x1D4A, 0x1D4B, 0x1D4C, 0x1D4D, 0x1D4E, 0x1D4F, 0x1D50, 0x1D51, 0x1D52,
+            0x1D53, 0x1D54, 0x1D56, 0x1D57, 0x1D58, 0x1D59, 0x1D5A, 0x1D5B, 0x1D5C, 0x1D5D,
+            0x1D5F, 0x1D60, 0x1D62, 0x1D63, 0x1D64, 0x1D65, 0x1D66, 0x1D68, 0x1D69, 0x1D6B,
+            0x1D6C, 0x1D6D, 0x1D6E, 0x1D6F, 0x1D70, 0x1D71, 0x1D72, 0x1D73, 0x1D74, 0x1D75,
+            0x1D76, 0x1D77, 0x1D78, 0x1D79, 0x1D7A, 0x1D7B, 0x1D7C, 0x1D7D, 0x1D7E, 0x1D7F,
+            0x1D80, 0x1D81, 0x1D82, 0x1D83, 0x1D84, 0x1D85, 0x1D86, 0x1D87, 0x1D88, 0x1D89,
+            0x1D8A, 0x1D8B, 0x1D8C, 0x1D8D, 0x1D8E, 0x1D8F, 0x1D90, 0x1D91, 0x1D92, 0x1D93,
+            0x1D94, 0x1D95, 0x1D96, 0x1D97, 0x1D98, 0x1D99, 0x1D9A, 0x1D9B, 0x1D9C, 0x1D9D,
+            0x1D9E, 0x1D9F, 0x1DA0, 0x1DA1, 0x1DA2, 0x1DA3, 0x1DA4, 0x1DA5, 0x1DA6, 0x1DA7,
+            0x1DA8, 0x1DA9, 0x1DAA, 0x1DAB, 0x1DAC, 0x1DAD, 0x1DAE, 0x1DAF, 0x1DB0, 0x1DB1,
+            0x1DB2, 0x1DB3, 0x1DB4, 0x1DB5, 0x1DB6, 0x1DB7, 0x1DB8, 0x1DB9, 0x1DBA, 0x1DBB,
+            0x1DBC, 0x1DBD, 0x1DBE, 0x1DBF, 0x1DC0, 0x1DC1, 0x1DC2, 0x1DC3, 0x1DC4, 0x1DC5,
+            0x1DC6, 0x1DC7, 0x1DC8, 0x1DC9, 0x1DCA, 0x1DCB, 0x1DCC, 0x1DCD, 0x1DCE, 0x1DCF,
+            0x1DD0, 0x1DD1, 0x1DD2, 0x1DD3, 0x1DD4, 0x1DD5, 0x1DD6, 0x1DD7, 0x1DD8, 0x1DD9,
+            0x1DDA, 0x1DDB, 0x1DDC, 0x1DDD, 0x1DDE, 0x1DDF, 0x1DE0, 0x1DE1, 0x1DE2, 0x1DE3,
+            0x1DE4, 0x1DE5, 0x1DE6, 0x1DE7, 0x1DE8, 0x1DE9, 0x1DEA, 0x1DEB, 0x1DEC, 0x1DED,
+            0x1DEE, 0x1DEF, 0x1DF0, 0x1DF1, 0x1DF2, 0x1DF3, 0x1DF4, 0x1DF5, 0x1DF6, 0x1DF7,
+            0x1DF8, 0x1DF9, 0x1DFB, 0x1DFC, 0x1DFD, 0x1DFE, 0x1DFF, 0x1E00, 0x1E01, 0x1E02,
+            0x1E03, 0x1E04, 0x1E05, 0x1E06, 0x1E07, 0x1E08, 0x1E09, 0x1E0A, 0x1E0B, 0x1E0C,
+            0x1E0D, 0x1E0E, 0x1E0F, 0x1E10, 0x1E11, 0x1E12, 0x1E13, 0x1E14, 0x1E15, 0x1E16,
+            0x1E17, 0x1E18, 0x1E19, 0x1E1A, 0x1E1B, 0x1E1C, 0x1E1D, 0x1E1E, 0x1E1F, 0x1E20,
+            0x1E21, 0x1E22, 0x1E23, 0x1E24, 0x1E25, 0x1E26, 0x1E27, 0x1E28, 0x1E29, 0x1E2A,
+            0x1E2B, 0x1E2C, 0x1E2D, 0x1E2E, 0x1E2F, 0x1E30, 0x1E31, 0x1E32, 0x1E33, 0x1E34,
+            0x1E35, 0x1E36, 0x1E37, 0x1E38, 0x1E39, 0x1E3A, 0x1E3B, 0x1E3C, 0x1E3D, 0x1E3E,
+            0x1E3F, 0x1E40, 0x1E41, 0x1E42, 0x1E43, 0x1E44, 0x1E45, 0x1E46, 0x1E47, 0x1E48,
+            0x1E49, 0x1E4A, 0x1E4B, 0x1E4C, 0x1E4D, 0x1E4E, 0x1E4F, 0x1E50, 0x1E51, 0x1E52,
+            0x1E53, 0x1E54, 0x1E55, 0x1E56, 0x1E57, 0x1E58, 0x1E59, 0x1E5A, 0x1E5B, 0x1E5C,
+            0x1E5D, 0x1E5E, 0x1E5F, 0x1E60, 0x1E61, 0x1E62, 0x1E63, 0x1E64, 0x1E65, 0x1E66,
+            0x1E67, 0x1E68, 0x1E69, 0x1E6A, 0x1E6B, 0x1E6C, 0x1E6D, 0x1E6E, 0x1E6F, 0x1E70,
+            0x1E71, 0x1E72, 0x1E73, 0x1E74, 0x1E75, 0x1E76, 0x1E77, 0x1E78, 0x1E79, 0x1E7A,
+            0x1E7B, 0x1E7C, 0x1E7D, 0x1E7E, 0x1E7F, 0x1E80, 0x1E81, 0x1E82, 0x1E83, 0x1E84,
+            0x1E85, 0x1E86, 0x1E87, 0x1E88, 0x1E89, 0x1E8A, 0x1E8B, 0x1E8C, 0x1E8D, 0x1E8E,
+            0x1E8F, 0x1E90, 0x1E91, 0x1E92, 0x1E93, 0x1E94, 0x1E95, 0x1E96, 0x1E97, 0x1E98,
+            0x1E99, 0x1E9A, 0x1E9B, 0x1E9C, 0x1E9E, 0x1E9F, 0x1EA0, 0x1EA1, 0x1EA2, 0x1EA3,
+            0x1EA4, 0x1EA5, 0x1EA6, 0x1EA7, 0x1EA8, 0x1EA9, 0x1EAA, 0x1EAB, 0x1EAC, 0x1EAD,
+            0x1EAE, 0x1EAF, 0x1EB0, 0x1EB1, 0x1EB2, 0x1EB3, 0x1EB4, 0x1EB5, 0x1EB6, 0x1EB7,
+            0x1EB8, 0x1EB9, 0x1EBA, 0x1EBB, 0x1EBC, 0x1EBD, 0x1EBE, 0x1EBF, 0x1EC0, 0x1EC1,
+            0x1EC2, 0x1EC3, 0x1EC4, 0x1EC5, 0x1EC6, 0x1EC7, 0x1EC8, 0x1EC9, 0x1ECA, 0x1ECB,
+            0x1ECC, 0x1ECD, 0x1ECE, 0x1ECF, 0x1ED0, 0x1ED1, 0x1ED2, 0x1ED3, 0x1ED4, 0x1ED5,
+            0x1ED6, 0x1ED7, 0x1ED8, 0x1ED9, 0x1EDA, 0x1EDB, 0x1EDC, 0x1EDD, 0x1EDE, 0x1EDF,
+            0x1EE0, 0x1EE1, 0x1EE2, 0x1EE3, 0x1EE4, 0x1EE5, 0x1EE6, 0x1EE7, 0x1EE8, 0x1EE9,
+            0x1EEA, 0x1EEB, 0x1EEC, 0x1EED, 0x1EEE, 0x1EEF, 0x1EF0, 0x1EF1, 0x1EF2, 0x1EF3,
+            0x1EF4, 0x1EF5, 0x1EF6, 0x1EF7, 0x1EF8, 0x1EF9, 0x1EFA, 0x1EFB, 0x1EFC, 0x1EFD,
+            0x1EFE, 0x1EFF, 0x1F00, 0x1F01, 0x1F02, 0x1F03, 0x1F04, 0x1F05, 0x1F06, 0x1F07,
+            0x1F08, 0x1F09, 0x1F0A, 0x1F0B, 0x1F0C, 0x1F0D, 0x1F0E, 0x1F0F, 0x1F10, 0x1F11,
+            0x1F12, 0x1F13, 0x1F14, 0x1F15, 0x1F18, 0x1F19, 0x1F1A, 0x1F1B, 0x1F1C, 0x1F1D,
+            0x1F20, 0x1F21, 0x1F22, 0x1F23, 0x1F24, 0x1F25, 0x1F26, 0x1F27, 0x1F28, 0x1F29,
+            0x1F2A, 0x1F2B, 0x1F2C, 0x1F2D, 0x1F2E, 0x1F2F, 0x1F30, 0x1F31, 0x1F32, 0x1F33,
+            0x1F34, 0x1F35, 0x1F36, 0x1F37, 0x1F38, 0x1F39, 0x1F3A, 0x1F3B, 0x1F3C, 0x1F3D,
+            0x1F3E, 0x1F3F, 0x1F40, 0x1F41, 0x1F42, 0x1F43, 0x1F44, 0x1F45, 0x1F48, 0x1F49,
+            0x1F4A, 0x1F4B, 0x1F4C, 0x1F4D, 0x1F50, 0x1F51, 0x1F52, 0x1F53, 0x1F54, 0x1F55,
+            0x1F56, 0x1F57, 0x1F59, 0x1F5B, 0x1F5D, 0x1F5F, 0x1F60, 0x1F61, 0x1F62, 0x1F63,
+            0x1F64, 0x1F65, 0x1F66, 0x1F67, 0x1F68, 0x1F69, 0x1F6A, 0x1F6B, 0x1F6C, 0x1F6D,
+            0x1F6E, 0x1F6F, 0x1F70, 0x1F71, 0x1F72, 0x1F73, 0x1F74, 0x1F75, 0x1F76, 0x1F77,
+            0x1F78, 0x1F79, 0x1F7A, 0x1F7B, 0x1F7C, 0x1F7D, 0x1F80, 0x1F81, 0x1F82, 0x1F83,
+            0x1F84, 0x1F85, 0x1F86, 0x1F87, 0x1F88, 0x1F89, 0x1F8A, 0x1F8B, 0x1F8C, 0x1F8D,
+            0x1F8E, 0x1F8F, 0x1F90, 0x1F91, 0x1F92, 0x1F93, 0x1F94, 0x1F95, 0x1F96, 0x1F97,
+            0x1F98, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x1FA0, 0x1FA1,
+            0x1FA2, 0x1FA3, 0x1FA4, 0x1FA5, 0x1FA6, 0x1FA7, 0x1FA8, 0x1FA9, 0x1FAA, 0x1FAB,
+            0x1FAC, 0x1FAD, 0x1FAE, 0x1FAF, 0x1FB0, 0x1FB1, 0x1FB2, 0x1FB3, 0x1FB4, 0x1FB6,
+            0x1FB7, 0x1FB8, 0x1FB9, 0x1FBA, 0x1FBB, 0x1FBC, 0x1FBD, 0x1FBE, 0x1FBF, 0x1FC0,
+            0x1FC1, 0x1FC2, 0x1FC3, 0x1FC4, 0x1FC6, 0x1FC7, 0x1FC8, 0x1FC9, 0x1FCA, 0x1FCB,
+            0x1FCC, 0x1FCD, 0x1FCE, 0x1FCF, 0x1FD0, 0x1FD1, 0x1FD2, 0x1FD3, 0x1FD6, 0x1FD7,
+            0x1FD8, 0x1FD9, 0x1FDA, 0x1FDB, 0x1FDD, 0x1FDE, 0x1FDF, 0x1FE0, 0x1FE1, 0x1FE2,
+            0x1FE3, 0x1FE4, 0x1FE5, 0x1FE6, 0x1FE7, 0x1FE8, 0x1FE9, 0x1FEA, 0x1FEB, 0x1FEC,
+            0x1FED, 0x1FEE, 0x1FEF, 0x1FF2, 0x1FF3, 0x1FF4, 0x1FF6, 0x1FF7, 0x1FF8, 0x1FF9,
+            0x1FFA, 0x1FFB, 0x1FFC, 0x1FFD, 0x1FFE, 0x2000, 0x2001, 0x2002, 0x2003, 0x2004,
+            0x2005, 0x2006, 0x2007, 0x2008, 0x2009, 0x200A, 0x200B, 0x200C, 0x200D, 0x200E,
+            0x200F, 0x2010, 0x2011, 0x2012, 0x2016, 0x2017, 0x2018, 0x201C, 0x2020, 0x2022,
+            0x2024, 0x2025, 0x2026, 0x2027, 0x2028, 0x202A, 0x202B, 0x202C, 0x202D, 0x202E,
+            0x202F, 0x2030, 0x2031, 0x2032, 0x2033, 0x2034, 0x2035, 0x2036, 0x2037, 0x2038,
+            0x2039, 0x203B, 0x203C, 0x203D, 0x203E, 0x203F, 0x2040, 0x2041, 0x2043, 0x2044,
+            0x2045, 0x2047, 0x2048, 0x2049, 0x204A, 0x204B, 0x204C, 0x204E, 0x204F, 0x2050,
+            0x2051, 0x2052, 0x2053, 0x2054, 0x2055, 0x2057, 0x2058, 0x205F, 0x2060, 0x2061,
+            0x2062, 0x2063, 0x2064, 0x2066, 0x2067, 0x2068, 0x2069, 0x206A, 0x206B, 0x206C,
+            0x206D, 0x206E, 0x206F, 0x2070, 0x2071, 0x2074, 0x207A, 0x207B, 0x207C, 0x207D,
+            0x207F, 0x2080, 0x208A, 0x208B, 0x208C, 0x208D, 0x2090, 0x2091, 0x2092, 0x2093,
+            0x2094, 0x2095, 0x2096, 0x2097, 0x2098, 0x2099, 0x209A, 0x209B, 0x209C, 0x20A0,
+            0x20A8, 0x20A9, 0x20BA, 0x20D0, 0x20D1, 0x20D2, 0x20D3, 0x20D4, 0x20D5, 0x20D6,
+            0x20D7, 0x20D8, 0x20D9, 0x20DA, 0x20DB, 0x20DC, 0x20DD, 0x20DE, 0x20DF, 0x20E0,
+            0x20E1, 0x20E2, 0x20E3, 0x20E4, 0x20E5, 0x20E6, 0x20E7, 0x20E8, 0x20E9, 0x20EA,
+            0x20EB, 0x20EC, 0x20ED, 0x20EE, 0x20EF, 0x20F0, 0x2100, 0x2101, 0x2102, 0x2103,
+            0x2104, 0x2105, 0x2106, 0x2107, 0x2108, 0x2109, 0x210A, 0x210B, 0x210C, 0x210D,
+            0x210E, 0x210F, 0x2110, 0x2111, 0x2112, 0x2113, 0x2114, 0x2115, 0x2116, 0x2117,
+            0x2119, 0x211A, 0x211B, 0x211C, 0x211D, 0x211E, 0x2120, 0x2121, 0x2122, 0x2123,
+            0x2124, 0x2125, 0x2126, 0x2127, 0x2128, 0x2129, 0x212A, 0x212B, 0x212C, 0x212D,
+            0x212E, 0x212F, 0x2130, 0x2131, 0x2132, 0x2133, 0x2134, 0x2135, 0x2139, 0x213A,
+            0x213B, 0x213C, 0x213D, 0x213E, 0x213F, 0x2140, 0x2141, 0x2145, 0x2146, 0x2147,
+            0x2148, 0x2149, 0x214A, 0x214B, 0x214C, 0x214D, 0x214E, 0x214F, 0x2150, 0x2151,
+            0x2152, 0x2153, 0x2154, 0x2155, 0x2156, 0x2157, 0x2158, 0x2159, 0x215A, 0x215B,
+            0x215C, 0x215D, 0x215E, 0x215F, 0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165,
+            0x2166, 0x2167, 0x2168, 0x2169, 0x216A, 0x216B, 0x216C, 0x216D, 0x216E, 0x216F,
+            0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179,
+            0x217A, 0x217B, 0x217C, 0x217D, 0x217E, 0x217F, 0x2180, 0x2183, 0x2184, 0x2185,
+            0x2186, 0x2189, 0x218A, 0x2190, 0x2191, 0x2192, 0x2193, 0x219A, 0x219B, 0x219C,
+            0x21AE, 0x21AF, 0x21CD, 0x21CE, 0x21CF, 0x21D0, 0x2204, 0x2205, 0x2209, 0x220A,
+            0x220C, 0x220D, 0x220E, 0x2212, 0x2213, 0x2216, 0x221C, 0x221D, 0x2224, 0x2225,
+            0x2226, 0x2227, 0x222C, 0x222D, 0x222E, 0x222F, 0x2230, 0x2231, 0x2241, 0x2242,
+            0x2244, 0x2245, 0x2247, 0x2248, 0x2249, 0x224A, 0x2260, 0x2261, 0x2262, 0x2263,
+            0x226D, 0x226E, 0x226F, 0x2270, 0x2271, 0x2272, 0x2274, 0x2275, 0x2276, 0x2278,
+            0x2279, 0x227A, 0x2280, 0x2281, 0x2282, 0x2284, 0x2285, 0x2286, 0x2288, 0x2289,
+            0x228A, 0x22AC, 0x22AD, 0x22AE, 0x22AF, 0x22B0, 0x22BD, 0x22E0, 0x22E1, 0x22E2,
+            0x22E3, 0x22E4, 0x22EA, 0x22EB, 0x22EC, 0x22ED, 0x22EE, 0x2308, 0x230C, 0x2329,
+            0x232B, 0x2440, 0x2460, 0x2469, 0x246A, 0x246B, 0x246C, 0x246D, 0x246E, 0x246F,
+            0x2470, 0x2471, 0x2472, 0x2473, 0x2474, 0x2475, 0x2476, 0x2477, 0x2478, 0x2479,
+            0x247A, 0x247B, 0x247C, 0x247D, 0x247E, 0x247F, 0x2480, 0x2481, 0x2482, 0x2483,
+            0x2484, 0x2485, 0x2486, 0x2487, 0x2488, 0x2489, 0x248A, 0x248B, 0x248C, 0x248D,
+            0x248E, 0x248F, 0x2490, 0x2491, 0x2492, 0x2493, 0x2494, 0x2495, 0x2496, 0x2497,
+            0x2498, 0x2499, 0x249A, 0x249B, 0x249C, 0x249D, 0x249E, 0x249F, 0x24A0, 0x24A1,
+            0x24A2, 0x24A3, 0x24A4, 0x24A5, 0x24A6, 0x24A7, 0x24A8, 0x24A9, 0x24AA, 0x24AB,
+            0x24AC, 0x24AD, 0x24AE, 0x24AF, 0x24B0, 0x24B1, 0x24B2, 0x24B3, 0x24B4, 0x24B5,
+            0x24B6, 0x24B7, 0x24B8, 0x24B9, 0x24BA, 0x24BB, 0x24BC, 0x24BD, 0x24BE, 0x24BF,
+            0x24C0, 0x24C1, 0x24C2, 0x24C3, 0x24C4, 0x24C5, 0x24C6, 0x24C7, 0x24C8, 0x24C9,
+            0x24CA, 0x24CB, 0x24CC, 0x24CD, 0x24CE, 0x24CF, 0x24D0, 0x24D1, 0x24D2, 0x24D3,
+            0x24D4, 0x24D5, 0x24D6, 0x24D7, 0x24D8, 0x24D9, 0x24DA, 0x24DB, 0x24DC, 0x24DD,
+            0x24DE, 0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3, 0x24E4, 0x24E5, 0x24E6, 0x24E7,
+            0x24E8, 0x24E9, 0x24EA, 0x24EB, 0x24EC, 0x24ED, 0x24EE, 0x24EF, 0x24F0, 0x24F1,
+            0x24F2, 0x24F3, 0x24F4, 0x24F5, 0x24FE, 0x24FF, 0x2500, 0x2600, 0x2630, 0x2638,
+            0x266D, 0x2670, 0x268A, 0x2690, 0x2700, 0x2721, 0x2768, 0x2776, 0x277F, 0x2780,
+            0x2789, 0x278A, 0x2793, 0x2794, 0x27C5, 0x27C7, 0x27E6, 0x27F0, 0x2800, 0x2900,
+            0x2983, 0x2999, 0x29D8, 0x29DC, 0x29FC, 0x29FE, 0x2A0C, 0x2A0D, 0x2A74, 0x2A75,
+            0x2A76, 0x2A77, 0x2ADC, 0x2ADD, 0x2B76, 0x2B97, 0x2C00, 0x2C30, 0x2C60, 0x2C61,
+            0x2C62, 0x2C63, 0x2C64, 0x2C65, 0x2C66, 0x2C67, 0x2C68, 0x2C69, 0x2C6A, 0x2C6B,
+            0x2C6C, 0x2C6D, 0x2C6E, 0x2C6F, 0x2C70, 0x2C71, 0x2C72, 0x2C73, 0x2C74, 0x2C75,
+            0x2C76, 0x2C77, 0x2C78, 0x2C79, 0x2C7A, 0x2C7B, 0x2C7C, 0x2C7D, 0x2C7E, 0x2C7F,
+            0x2C80, 0x2C81, 0x2C82, 0x2C83, 0x2C84, 0x2C85, 0x2C86, 0x2C87, 0x2C88, 0x2C89,
+            0x2C8A, 0x2C8B, 0x2C8C, 0x2C8D, 0x2C8E, 0x2C8F, 0x2C90, 0x2C91, 0x2C92, 0x2C93,
+            0x2C94, 0x2C95, 0x2C96, 0x2C97, 0x2C98, 0x2C99, 0x2C9A, 0x2C9B, 0x2C9C, 0x2C9D,
+            0x2C9E, 0x2C9F, 0x2CA0, 0x2CA1, 0x2CA2, 0x2CA3, 0x2CA4, 0x2CA5, 0x2CA6, 0x2CA7,
+            0x2CA8, 0x2CA9, 0x2CAA, 0x2CAB, 0x2CAC, 0x2CAD, 0x2CAE, 0x2CAF, 0x2CB0, 0x2CB1,
+            0x2CB2, 0x2CB3, 0x2CB4, 0x2CB5, 0x2CB6, 0x2CB7, 0x2CB8, 0x2CB9, 0x2CBA, 0x2CBB,
+            0x2CBC, 0x2CBD, 0x2CBE, 0x2CBF, 0x2CC0, 0x2CC1, 0x2CC2, 0x2CC3, 0x2CC4, 0x2CC5,
+            0x2CC6, 0x2CC7, 0x2CC8, 0x2CC9, 0x2CCA, 0x2CCB, 0x2CCC, 0x2CCD, 0x2CCE, 0x2CCF,
+            0x2CD0, 0x2CD1, 0x2CD2, 0x2CD3, 0x2CD4, 0x2CD5, 0x2CD6, 0x2CD7, 0x2CD8, 0x2CD9,
+            0x2CDA, 0x2CDB, 0x2CDC, 0x2CDD, 0x2CDE, 0x2CDF, 0x2CE0, 0x2CE1, 0x2CE2, 0x2CE3,
+            0x2CE4, 0x2CE5, 0x2CEB, 0x2CEC, 0x2CED, 0x2CEE, 0x2CEF, 0x2CF0, 0x2CF1, 0x2CF2,
+            0x2CF3, 0x2CF9, 0x2CFA, 0x2CFC, 0x2CFD, 0x2CFE, 0x2CFF, 0x2D00, 0x2D01, 0x2D02,
+            0x2D03, 0x2D04, 0x2D05, 0x2D06, 0x2D07, 0x2D08, 0x2D09, 0x2D0A, 0x2D0B, 0x2D0C,
+            0x2D0D, 0x2D0E, 0x2D0F, 0x2D10, 0x2D11, 0x2D12, 0x2D13, 0x2D14, 0x2D15, 0x2D16,
+            0x2D17, 0x2D18, 0x2D19, 0x2D1A, 0x2D1B, 0x2D1C, 0x2D1D, 0x2D1E, 0x2D1F, 0x2D20,
+            0x2D21, 0x2D22, 0x2D23, 0x2D24, 0x2D25, 0x2D27, 0x2D2D, 0x2D30, 0x2D3C, 0x2D54,
+            0x2D66, 0x2D67, 0x2D6F, 0x2D70, 0x2D7F, 0x2D80, 0x2D81, 0x2D82, 0x2D83, 0x2D84,
+            0x2D85, 0x2D86, 0x2D87, 0x2D88, 0x2D89, 0x2D8A, 0x2D8B, 0x2D8C, 0x2D8D, 0x2D8E,
+            0x2D8F, 0x2D90, 0x2D91, 0x2D92, 0x2D93, 0x2DA0, 0x2DA8, 0x2DB0, 0x2DB8, 0x2DC0,
+            0x2DC8, 0x2DD0, 0x2DD8, 0x2DE0, 0x2DE1, 0x2DE2, 0x2DE3, 0x2DE4, 0x2DE5, 0x2DE6,
+            0x2DE7, 0x2DE8, 0x2DE9, 0x2DEA, 0x2DEB, 0x2DEC, 0x2DED, 0x2DEE, 0x2DEF, 0x2DF0,
+            0x2DF1, 0x2DF2, 0x2DF3, 0x2DF4, 0x2DF5, 0x2DF6, 0x2DF7, 0x2DF8, 0x2DF9, 0x2DFA,
+            0x2DFB, 0x2DFC, 0x2DFD, 0x2DFE, 0x2DFF, 0x2E00, 0x2E02, 0x2E06, 0x2E09, 0x2E0B,
+            0x2E0C, 0x2E0E, 0x2E17, 0x2E18, 0x2E19, 0x2E1A, 0x2E1C, 0x2E1E, 0x2E20, 0x2E2A,
+            0x2E2E, 0x2E2F, 0x2E30, 0x2E31, 0x2E32, 0x2E33, 0x2E34, 0x2E35, 0x2E36, 0x2E39,
+            0x2E3A, 0x2E3C, 0x2E3D, 0x2E3E, 0x2E3F, 0x2E40, 0x2E41, 0x2E42, 0x2E43, 0x2E44,
+            0x2E49, 0x2E4A, 0x2E4B, 0x2E4C, 0x2E4D, 0x2E4E, 0x2E50, 0x2E52, 0x2E80, 0x2E81,
+            0x2E82, 0x2E83, 0x2E84, 0x2E85, 0x2E86, 0x2E87, 0x2E88, 0x2E89, 0x2E8A, 0x2E8B,
+            0x2E8C, 0x2E8D, 0x2E8E, 0x2E8F, 0x2E90, 0x2E91, 0x2E92, 0x2E93, 0x2E94, 0x2E95,
+            0x2E96, 0x2E97, 0x2E98, 0x2E99, 0x2E9B, 0x2E9C, 0x2E9D, 0x2E9E, 0x2E9F, 0x2EA0,
+            0x2EA1, 0x2EA2, 0x2EA3, 0x2EA4, 0x2EA5, 0x2EA6, 0x2EA7, 0x2EA8, 0x2EA9, 0x2EAA,
+            0x2EAB, 0x2EAC, 0x2EAD, 0x2EAE, 0x2EAF, 0x2EB0, 0x2EB1, 0x2EB2, 0x2EB3, 0x2EB4,
+            0x2EB5, 0x2EB6, 0x2EB7, 0x2EB8, 0x2EB9, 0x2EBA, 0x2EBB, 0x2EBC, 0x2EBD, 0x2EBE,
+            0x2EBF, 0x2EC0, 0x2EC1, 0x2EC2, 0x2EC3, 0x2EC4, 0x2EC5, 0x2EC6, 0x2EC7, 0x2EC8,
+            0x2EC9, 0x2ECA, 0x2ECB, 0x2ECC, 0x2ECD, 0x2ECE, 0x2ECF, 0x2ED0, 0x2ED1, 0x2ED2,
+            0x2ED3, 0x2ED4, 0x2ED5, 0x2ED6, 0x2ED7, 0x2ED8, 0x2ED9, 0x2EDA, 0x2EDB, 0x2EDC,
+            0x2EDD, 0x2EDE, 0x2EDF, 0x2EE0, 0x2EE1, 0x2EE2, 0x2EE3, 0x2EE4, 0x2EE5, 0x2EE6,
+            0x2EE7, 0x2EE8, 0x2EE9, 0x2EEA, 0x2EEB, 0x2EEC, 0x2EED, 0x2EEE, 0x2EEF, 0x2EF0,
+            0x2EF1, 0x2EF2, 0x2EF3, 0x2F00, 0x2F01, 0x2F02, 0x2F03, 0x2F04, 0x2F05, 0x2F06,
+            0x2F07, 0x2F08, 0x2F09, 0x2F0A, 0x2F0B, 0x2F0C, 0x2F0D, 0x2F0E, 0x2F0F, 0x2F10,
+            0x2F11, 0x2F12, 0x2F13, 0x2F14, 0x2F15, 0x2F16, 0x2F17, 0x2F18, 0x2F19, 0x2F1A,
+            0x2F1B, 0x2F1C, 0x2F1D, 0x2F1E, 0x2F1F, 0x2F20, 0x2F21, 0x2F22, 0x2F23, 0x2F24,
+            0x2F25, 0x2F26, 0x2F27, 0x2F28, 0x2F29, 0x2F2A, 0x2F2B, 0x2F2C, 0x2F2D, 0x2F2E,
+            0x2F2F, 0x2F30, 0x2F31, 0x2F32, 0x2F33, 0x2F34, 0x2F35, 0x2F36, 0x2F37, 0x2F38,
+            0x2F39, 0x2F3A, 0x2F3B, 0x2F3C, 0x2F3D, 0x2F3E, 0x2F3F, 0x2F40, 0x2F41, 0x2F42,
+            0x2F43, 0x2F44, 0x2F45, 0x2F46, 0x2F47, 0x2F48, 0x2F49, 0x2F4A, 0x2F4B, 0x2F4C,
+            0x2F4D, 0x2F4E, 0x2F4F, 0x2F50, 0x2F51, 0x2F52, 0x2F53, 0x2F54, 0x2F55, 0x2F56,
+            0x2F57, 0x2F58, 0x2F59, 0x2F5A, 0x2F5B, 0x2F5C, 0x2F5D, 0x2F5E, 0x2F5F, 0x2F60,
+            0x2F61, 0x2F62, 0x2F63, 0x2F64, 0x2F65, 0x2F66, 0x2F67, 0x2F68, 0x2F69, 0x2F6A,
+            0x2F6B, 0x2F6C, 0x2F6D, 0x2F6E, 0x2F6F, 0x2F70, 0x2F71, 0x2F72, 0x2F73, 0x2F74,
+            0x2F75, 0x2F76, 0x2F77, 0x2F78, 0x2F79, 0x2F7A, 0x2F7B, 0x2F7C, 0x2F7D, 0x2F7E,
+            0x2F7F, 0x2F80, 0x2F81, 0x2F82, 0x2F83, 0x2F84, 0x2F85, 0x2F86, 0x2F87, 0x2F88,
+            0x2F89, 0x2F8A, 0x2F8B, 0x2F8C, 0x2F8D, 0x2F8E, 0x2F8F, 0x2F90, 0x2F91, 0x2F92,
+            0x2F93, 0x2F94, 0x2F95, 0x2F96, 0x2F97, 0x2F98, 0x2F99, 0x2F9A, 0x2F9B, 0x2F9C,
+            0x2F9D, 0x2F9E, 0x2F9F, 0x2FA0, 0x2FA1, 0x2FA2, 0x2FA3, 0x2FA4, 0x2FA5, 0x2FA6,
+            0x2FA7, 0x2FA8, 0x2FA9, 0x2FAA, 0x2FAB, 0x2FAC, 0x2FAD, 0x2FAE, 0x2FAF, 0x2FB0,
+            0x2FB1, 0x2FB2, 0x2FB3, 0x2FB4, 0x2FB5, 0x2FB6, 0x2FB7, 0x2FB8, 0x2FB9, 0x2FBA,
+            0x2FBB, 0x2FBC, 0x2FBD, 0x2FBE, 0x2FBF, 0x2FC0, 0x2FC1, 0x2FC2, 0x2FC3, 0x2FC4,
+            0x2FC5, 0x2FC6, 0x2FC7, 0x2FC8, 0x2FC9, 0x2FCA, 0x2FCB, 0x2FCC, 0x2FCD, 0x2FCE,
+            0x2FCF, 0x2FD0, 0x2FD1, 0x2FD2, 0x2FD3, 0x2FD4, 0x2FD5, 0x2FF0, 0x3000, 0x3001,
+            0x3002, 0x3003, 0x3004, 0x3005, 0x3006, 0x3007, 0x3008, 0x3012, 0x3014, 0x301C,
+            0x301D, 0x3020, 0x3021, 0x302A, 0x302B, 0x302C, 0x302D, 0x302E, 0x302F, 0x3030,
+            0x3031, 0x3032, 0x3033, 0x3034, 0x3035, 0x3036, 0x3037, 0x3038, 0x3039, 0x303A,
+            0x303B, 0x303C, 0x303D, 0x303E, 0x3041, 0x3042, 0x3043, 0x3044, 0x3045, 0x3046,
+            0x3047, 0x3048, 0x3049, 0x304A, 0x304C, 0x304D, 0x304E, 0x304F, 0x3050, 0x3051,
+            0x3052, 0x3053, 0x3054, 0x3055, 0x3056, 0x3057, 0x3058, 0x3059, 0x305A, 0x305B,
+            0x305C, 0x305D, 0x305E, 0x305F, 0x3060, 0x3061, 0x3062, 0x3063, 0x3064, 0x3065,
+            0x3066, 0x3067, 0x3068, 0x3069, 0x306A, 0x3070, 0x3071, 0x3072, 0x3073, 0x3074,
+            0x3075, 0x3076, 0x3077, 0x3078, 0x3079, 0x307A, 0x307B, 0x307C, 0x307D, 0x307E,
+            0x3083, 0x3084, 0x3085, 0x3086, 0x3087, 0x3088, 0x308E, 0x308F, 0x3094, 0x3095,
+            0x3096, 0x3099, 0x309A, 0x309B, 0x309D, 0x309E, 0x309F, 0x30A0, 0x30A1, 0x30A2,
+            0x30A3, 0x30A4, 0x30A5, 0x30A6, 0x30A7, 0x30A8, 0x30A9, 0x30AA, 0x30AC, 0x30AD,
+            0x30AE, 0x30AF, 0x30B0, 0x30B1, 0x30B2, 0x30B3, 0x30B4, 0x30B5, 0x30B6, 0x30B7,
+            0x30B8, 0x30B9, 0x30BA, 0x30BB, 0x30BC, 0x30BD, 0x30BE, 0x30BF, 0x30C0, 0x30C1,
+            0x30C2, 0x30C3, 0x30C4, 0x30C5, 0x30C6, 0x30C7, 0x30C8, 0x30C9, 0x30CA, 0x30D0,
+            0x30D1, 0x30D2, 0x30D3, 0x30D4, 0x30D5, 0x30D6, 0x30D7, 0x30D8, 0x30D9, 0x30DA,
+            0x30DB, 0x30DC, 0x30DD, 0x30DE, 0x30E3, 0x30E4, 0x30E5, 0x30E6, 0x30E7, 0x30E8,
+            0x30EE, 0x30EF, 0x30F4, 0x30F5, 0x30F6, 0x30F7, 0x30F8, 0x30F9, 0x30FA, 0x30FB,
+            0x30FC, 0x30FE, 0x30FF, 0x3105, 0x3108, 0x3109, 0x310C, 0x310F, 0x3113, 0x311A,
+            0x311C, 0x311E, 0x3125, 0x3126, 0x312A, 0x312B, 0x312C, 0x312D, 0x312E, 0x312F,
+            0x3131, 0x3133, 0x3134, 0x3135, 0x3137, 0x313A, 0x3140, 0x3141, 0x3144, 0x3145,
+            0x314F, 0x3164, 0x3165, 0x3167, 0x3169, 0x316A, 0x316B, 0x316C, 0x316D, 0x316E,
+            0x316F, 0x3170, 0x3171, 0x3173, 0x3174, 0x3176, 0x3177, 0x3178, 0x317D, 0x317E,
+            0x317F, 0x3180, 0x3181, 0x3182, 0x3184, 0x3187, 0x3189, 0x318A, 0x318C, 0x318D,
+            0x318E, 0x3190, 0x3192, 0x3193, 0x3194, 0x3195, 0x3196, 0x3197, 0x3198, 0x3199,
+            0x319A, 0x319B, 0x319C, 0x319D, 0x319E, 0x319F, 0x31A0, 0x31A1, 0x31A2, 0x31A3,
+            0x31A4, 0x31A5, 0x31A6, 0x31A7, 0x31A8, 0x31A9, 0x31AA, 0x31AB, 0x31AC, 0x31AD,
+            0x31AE, 0x31AF, 0x31B0, 0x31B2, 0x31B3, 0x31B4, 0x31B5, 0x31B6, 0x31B7, 0x31B8,
+            0x31BB, 0x31BC, 0x31BE, 0x31C0, 0x31F0, 0x31F1, 0x31F3, 0x31F4, 0x31F5, 0x31FA,
+            0x31FB, 0x3200, 0x3201, 0x3202, 0x3203, 0x3204, 0x3205, 0x3206, 0x3207, 0x3208,
+            0x3209, 0x320A, 0x320B, 0x320C, 0x320D, 0x320E, 0x320F, 0x3210, 0x3211, 0x3212,
+            0x3213, 0x3214, 0x3215, 0x3216, 0x3217, 0x3218, 0x3219, 0x321A, 0x321B, 0x321C,
+            0x321D, 0x321E, 0x3220, 0x3221, 0x3222, 0x3223, 0x3224, 0x3225, 0x3226, 0x3227,
+            0x3228, 0x3229, 0x322A, 0x322B, 0x322C, 0x322D, 0x322E, 0x322F, 0x3230, 0x3231,
+            0x3232, 0x3233, 0x3234, 0x3235, 0x3236, 0x3237, 0x3238, 0x3239, 0x323A, 0x323B,
+            0x323C, 0x323D, 0x323E, 0x323F, 0x3240, 0x3241, 0x3242, 0x3243, 0x3244, 0x3245,
+            0x3246, 0x3247, 0x3248, 0x3249, 0x324A, 0x324B, 0x324C, 0x324D, 0x324E, 0x324F,
+            0x3250, 0x3251, 0x3252, 0x3253, 0x3254, 0x3255, 0x3256, 0x3257, 0x3258, 0x3259,
+            0x325A, 0x325B, 0x325C, 0x325D, 0x325E, 0x325F, 0x3260, 0x3261, 0x3263, 0x3266,
+            0x3267, 0x3269, 0x326E, 0x326F, 0x3270, 0x3271, 0x3272, 0x3273, 0x3274, 0x3275,
+            0x3276, 0x3277, 0x3278, 0x3279, 0x327A, 0x327B, 0x327C, 0x327D, 0x327E, 0x327F,
+            0x3280, 0x3281, 0x3282, 0x3283, 0x3284, 0x3285, 0x3286, 0x3287, 0x3288, 0x3289,
+            0x328A, 0x328B, 0x328C, 0x328D, 0x328E, 0x328F, 0x3290, 0x3291, 0x3292, 0x3293,
+            0x3294, 0x3295, 0x3296, 0x3297, 0x3298, 0x3299, 0x329A, 0x329B, 0x329C, 0x329D,
+            0x329E, 0x329F, 0x32A0, 0x32A1, 0x32A2, 0x32A3, 0x32A4, 0x32A5, 0x32A6, 0x32A7,
+            0x32A8, 0x32A9, 0x32AA, 0x32AB, 0x32AC, 0x32AD, 0x32AE, 0x32AF, 0x32B0, 0x32B1,
+            0x32B2, 0x32B3, 0x32B4, 0x32B5, 0x32B6, 0x32B7, 0x32B8, 0x32B9, 0x32BA, 0x32BB,
+            0x32BC, 0x32BD, 0x32BE, 0x32BF, 0x32C0, 0x32C1, 0x32C2, 0x32C3, 0x32C4, 0x32C5,
+            0x32C6, 0x32C7, 0x32C8, 0x32C9, 0x32CA, 0x32CB, 0x32CC, 0x32CD, 0x32CE, 0x32CF,
+            0x32D0, 0x32D3, 0x32FF, 0x3300, 0x3301, 0x3302, 0x3303, 0x3304, 0x3305, 0x3306,
+            0x3307, 0x3308, 0x3309, 0x330A, 0x330B, 0x330C, 0x330D, 0x330E, 0x330F, 0x3310,
+            0x3311, 0x3312, 0x3313, 0x3314, 0x3315, 0x3316, 0x3317, 0x3318, 0x3319, 0x331A,
+            0x331B, 0x331C, 0x331D, 0x331E, 0x331F, 0x3320, 0x3321, 0x3322, 0x3323, 0x3324,
+            0x3325, 0x3326, 0x3327, 0x3328, 0x3329, 0x332A, 0x332B, 0x332C, 0x332D, 0x332E,
+            0x332F, 0x3330, 0x3331, 0x3332, 0x3333, 0x3334, 0x3335, 0x3336, 0x3337, 0x3338,
+            0x3339, 0x333A, 0x333B, 0x333C, 0x333D, 0x333E, 0x333F, 0x3340, 0x3341, 0x3342,
+            0x3343, 0x3344, 0x3345, 0x3346, 0x3347, 0x3348, 0x3349, 0x334A, 0x334B, 0x334C,
+            0x334D, 0x334E, 0x334F, 0x3350, 0x3351, 0x3352, 0x3353, 0x3354, 0x3355, 0x3356,
+            0x3357, 0x3358, 0x3359, 0x335A, 0x335B, 0x335C, 0x335D, 0x335E, 0x335F, 0x3360,
+            0x3361, 0x3362, 0x3363, 0x3364, 0x3365, 0x3366, 0x3367, 0x3368, 0x3369, 0x336A,
+            0x336B, 0x336C, 0x336D, 0x336E, 0x336F, 0x3370, 0x3371, 0x3372, 0x3373, 0x3374,
+            0x3375, 0x3376, 0x3377, 0x3378, 0x3379, 0x337A, 0x337B, 0x337C, 0x337D, 0x337E,
+            0x337F, 0x3380, 0x3381, 0x3382, 0x3383, 0x3384, 0x3385, 0x3386, 0x3387, 0x3388,
+            0x3389, 0x338A, 0x338B, 0x338C, 0x338D, 0x338E, 0x338F, 0x3390, 0x3391, 0x3392,
+            0x3393, 0x3394, 0x3395, 0x3396, 0x3397, 0x3398, 0x3399, 0x339A, 0x339B, 0x339C,
+            0x339D, 0x339E, 0x339F, 0x33A0, 0x33A1, 0x33A2, 0x33A3, 0x33A4, 0x33A5, 0x33A6,
+            0x33A7, 0x33A8, 0x33A9, 0x33AA, 0x33AB, 0x33AC, 0x33AD, 0x33AE, 0x33AF, 0x33B0,
+            0x33B1, 0x33B2, 0x33B3, 0x33B4, 0x33B5, 0x33B6, 0x33B7, 0x33B8, 0x33B9, 0x33BA,
+            0x33BB, 0x33BC, 0x33BD, 0x33BE, 0x33BF, 0x33C0, 0x33C1, 0x33C2, 0x33C3, 0x33C4,
+            0x33C5, 0x33C6, 0x33C7, 0x33C8, 0x33C9, 0x33CA, 0x33CB, 0x33CC, 0x33CD, 0x33CE,
+            0x33CF, 0x33D0, 0x33D1, 0x33D2, 0x33D3, 0x33D4, 0x33D5, 0x33D6, 0x33D7, 0x33D8,
+            0x33D9, 0x33DA, 0x33DB, 0x33DC, 0x33DD, 0x33DE, 0x33DF, 0x33E0, 0x33E1, 0x33E2,
+            0x33E3, 0x33E4, 0x33E5, 0x33E6, 0x33E7, 0x33E8, 0x33E9, 0x33EA, 0x33EB, 0x33EC,
+            0x33ED, 0x33EE, 0x33EF, 0x33F0, 0x33F1, 0x33F2, 0x33F3, 0x33F4, 0x33F5, 0x33F6,
+            0x33F7, 0x33F8, 0x33F9, 0x33FA, 0x33FB, 0x33FC, 0x33FD, 0x33FE, 0x33FF, 0x4DC0,
+            0xA000, 0xA100, 0xA200, 0xA300, 0xA400, 0xA490, 0xA4D0, 0xA4EA, 0xA4EB, 0xA4EC,
+            0xA4ED, 0xA4EE, 0xA4F8, 0xA4FC, 0xA4FD, 0xA4FE, 0xA4FF, 0xA500, 0xA600, 0xA60D,
+            0xA60E, 0xA60F, 0xA610, 0xA611, 0xA612, 0xA613, 0xA614, 0xA615, 0xA616, 0xA617,
+            0xA618, 0xA619, 0xA61A, 0xA61B, 0xA61C, 0xA61D, 0xA61E, 0xA61F, 0xA620, 0xA62A,
+            0xA62B, 0xA640, 0xA641, 0xA642, 0xA643, 0xA644, 0xA645, 0xA646, 0xA647, 0xA648,
+            0xA649, 0xA64A, 0xA64B, 0xA64C, 0xA64D, 0xA64E, 0xA64F, 0xA650, 0xA651, 0xA652,
+            0xA653, 0xA654, 0xA655, 0xA656, 0xA657, 0xA658, 0xA659, 0xA65A, 0xA65B, 0xA65C,
+            0xA65D, 0xA65E, 0xA65F, 0xA660, 0xA661, 0xA662, 0xA663, 0xA664, 0xA665, 0xA666,
+            0xA667, 0xA668, 0xA669, 0xA66A, 0xA66B, 0xA66C, 0xA66D, 0xA66E, 0xA66F, 0xA670,
+            0xA671, 0xA672, 0xA673, 0xA674, 0xA675, 0xA676, 0xA677, 0xA678, 0xA679, 0xA67A,
+            0xA67B, 0xA67C, 0xA67D, 0xA67E, 0xA67F, 0xA680, 0xA681, 0xA682, 0xA683, 0xA684,
+            0xA685, 0xA686, 0xA687, 0xA688, 0xA689, 0xA68A, 0xA68B, 0xA68C, 0xA68D, 0xA68E,
+            0xA68F, 0xA690, 0xA691, 0xA692, 0xA693, 0xA694, 0xA695, 0xA696, 0xA697, 0xA698,
+            0xA699, 0xA69A, 0xA69B, 0xA69C, 0xA69D, 0xA69E, 0xA69F, 0xA6A0, 0xA6F0, 0xA6F1,
+            0xA6F2, 0xA6F3, 0xA6F4, 0xA6F5, 0xA6F6, 0xA6F7, 0xA700, 0xA722, 0xA723, 0xA724,
+            0xA725, 0xA726, 0xA727, 0xA728, 0xA729, 0xA72A, 0xA72B, 0xA72C, 0xA72D, 0xA72E,
+            0xA72F, 0xA730, 0xA731, 0xA732, 0xA733, 0xA734, 0xA735, 0xA736, 0xA737, 0xA738,
+            0xA739, 0xA73A, 0xA73B, 0xA73C, 0xA73D, 0xA73E, 0xA73F, 0xA740, 0xA741, 0xA742,
+            0xA743, 0xA744, 0xA745, 0xA746, 0xA747, 0xA748, 0xA749, 0xA74A, 0xA74B, 0xA74C,
+            0xA74D, 0xA74E, 0xA74F, 0xA750, 0xA751, 0xA752, 0xA753, 0xA754, 0xA755, 0xA756,
+            0xA757, 0xA758, 0xA759, 0xA75A, 0xA75B, 0xA75C, 0xA75D, 0xA75E, 0xA75F, 0xA760,
+            0xA761, 0xA762, 0xA763, 0xA764, 0xA765, 0xA766, 0xA767, 0xA768, 0xA769, 0xA76A,
+            0xA76B, 0xA76C, 0xA76D, 0xA76E, 0xA76F, 0xA770, 0xA771, 0xA772, 0xA773, 0xA774,
+            0xA775, 0xA777, 0xA778, 0xA779, 0xA77A, 0xA77B, 0xA77C, 0xA77D, 0xA77E, 0xA77F,
+            0xA780, 0xA781, 0xA782, 0xA783, 0xA784, 0xA785, 0xA786, 0xA787, 0xA788, 0xA78B,
+            0xA78C, 0xA78D, 0xA78E, 0xA78F, 0xA790, 0xA791, 0xA792, 0xA793, 0xA795, 0xA796,
+            0xA797, 0xA798, 0xA799, 0xA79A, 0xA79B, 0xA79C, 0xA79D, 0xA79E, 0xA79F, 0xA7A0,
+            0xA7A1, 0xA7A2, 0xA7A3, 0xA7A4, 0xA7A5, 0xA7A6, 0xA7A7, 0xA7A8, 0xA7A9, 0xA7AA,
+            0xA7AB, 0xA7AC, 0xA7AD, 0xA7AE, 0xA7AF, 0xA7B0, 0xA7B1, 0xA7B2, 0xA7B3, 0xA7B4,
+            0xA7B5, 0xA7B6, 0xA7B7, 0xA7B8, 0xA7B9, 0xA7BA, 0xA7BB, 0xA7BC, 0xA7BD, 0xA7BE,
+            0xA7BF, 0xA7C2, 0xA7C3, 0xA7C4, 0xA7C5, 0xA7C6, 0xA7C7, 0xA7C8, 0xA7C9, 0xA7CA,
+            0xA7F5, 0xA7F6, 0xA7F7, 0xA7F8, 0xA7F9, 0xA7FA, 0xA7FB, 0xA7FC, 0xA7FD, 0xA7FE,
+            0xA7FF, 0xA800, 0xA807, 0xA80B, 0xA80C, 0xA828, 0xA82C, 0xA830, 0xA836, 0xA838,
+            0xA839, 0xA840, 0xA848, 0xA854, 0xA858, 0xA859, 0xA85B, 0xA85D, 0xA85E, 0xA862,
+            0xA866, 0xA867, 0xA868, 0xA869, 0xA86D, 0xA86E, 0xA86F, 0xA871, 0xA873, 0xA874,
+            0xA876, 0xA880, 0xA881, 0xA882, 0xA8C5, 0xA8CE, 0xA8D0, 0xA8E0, 0xA8E1, 0xA8E2,
+            0xA8E3, 0xA8E4, 0xA8E5, 0xA8E6, 0xA8E7, 0xA8E8, 0xA8E9, 0xA8EA, 0xA8EB, 0xA8EC,
+            0xA8ED, 0xA8EE, 0xA8EF, 0xA8F0, 0xA8F1, 0xA8F2, 0xA8F3, 0xA8F4, 0xA8F5, 0xA8F6,
+            0xA8F7, 0xA8F8, 0xA8FB, 0xA8FC, 0xA8FD, 0xA8FE, 0xA8FF, 0xA900, 0xA90A, 0xA92B,
+            0xA92C, 0xA92D, 0xA92E, 0xA92F, 0xA930, 0xA95F, 0xA960, 0xA980, 0xA981, 0xA982,
+            0xA983, 0xA984, 0xA9AB, 0xA9AC, 0xA9AD, 0xA9B3, 0xA9B4, 0xA9B5, 0xA9B6, 0xA9BA,
+            0xA9BC, 0xA9BD, 0xA9BE, 0xA9BF, 0xA9C0, 0xA9C1, 0xA9C7, 0xA9C8, 0xA9CA, 0xA9CF,
+            0xA9D0, 0xA9DE, 0xA9E0, 0xA9E1, 0xA9E2, 0xA9E3, 0xA9E4, 0xA9E5, 0xA9E6, 0xA9E7,
+            0xA9E8, 0xA9E9, 0xA9EA, 0xA9EB, 0xA9EC, 0xA9ED, 0xA9EE, 0xA9EF, 0xA9F0, 0xA9FA,
+            0xA9FB, 0xA9FC, 0xA9FD, 0xA9FE, 0xAA00, 0xAA29, 0xAA33, 0xAA40, 0xAA50, 0xAA5C,
+            0xAA5D, 0xAA60, 0xAA61, 0xAA62, 0xAA63, 0xAA64, 0xAA65, 0xAA66, 0xAA67, 0xAA68,
+            0xAA69, 0xAA6A, 0xAA6B, 0xAA6C, 0xAA6D, 0xAA6E, 0xAA6F, 0xAA70, 0xAA71, 0xAA72,
+            0xAA73, 0xAA74, 0xAA77, 0xAA7A, 0xAA7B, 0xAA7E, 0xAA7F, 0xAA80, 0xAAB5, 0xAAB6,
+            0xAAB7, 0xAAB9, 0xAABA, 0xAABB, 0xAABC, 0xAABD, 0xAABF, 0xAAC0, 0xAAC1, 0xAAC2,
+            0xAADB, 0xAADD, 0xAADE, 0xAAE0, 0xAAEB, 0xAAF0, 0xAAF1, 0xAAF2, 0xAAF3, 0xAAF5,
+            0xAAF6, 0xAB01, 0xAB09, 0xAB11, 0xAB20, 0xAB28, 0xAB30, 0xAB31, 0xAB32, 0xAB34,
+            0xAB35, 0xAB36, 0xAB37, 0xAB38, 0xAB3A, 0xAB3B, 0xAB3C, 0xAB3D, 0xAB3E, 0xAB3F,
+            0xAB40, 0xAB41, 0xAB43, 0xAB45, 0xAB46, 0xAB47, 0xAB49, 0xAB4A, 0xAB4D, 0xAB4E,
+            0xAB4F, 0xAB50, 0xAB52, 0xAB53, 0xAB56, 0xAB5A, 0xAB5B, 0xAB5C, 0xAB5D, 0xAB5E,
+            0xAB5F, 0xAB60, 0xAB62, 0xAB63, 0xAB64, 0xAB65, 0xAB66, 0xAB67, 0xAB68, 0xAB69,
+            0xAB6A, 0xAB70, 0xABC0, 0xABDB, 0xABE3, 0xABEB, 0xABEC, 0xABED, 0xABF0, 0xD7B0,
+            0xD7CB, 0xF900, 0xF901, 0xF902, 0xF903, 0xF904, 0xF905, 0xF906, 0xF907, 0xF908,
+            0xF909, 0xF90A, 0xF90B, 0xF90C, 0xF90D, 0xF90E, 0xF90F, 0xF910, 0xF911, 0xF912,
+            0xF913, 0xF914, 0xF915, 0xF916, 0xF917, 0xF918, 0xF919, 0xF91A, 0xF91B, 0xF91C,
+            0xF91D, 0xF91E, 0xF91F, 0xF920, 0xF921, 0xF922, 0xF923, 0xF924, 0xF925, 0xF926,
+            0xF927, 0xF928, 0xF929, 0xF92A, 0xF92B, 0xF92C, 0xF92D, 0xF92E, 0xF92F, 0xF930,
+            0xF931, 0xF932, 0xF933, 0xF934, 0xF935, 0xF936, 0xF937, 0xF938, 0xF939, 0xF93A,
+            0xF93B, 0xF93C, 0xF93D, 0xF93E, 0xF93F, 0xF940, 0xF941, 0xF942, 0xF943, 0xF944,
+            0xF945, 0xF946, 0xF947, 0xF948, 0xF949, 0xF94A, 0xF94B, 0xF94C, 0xF94D, 0xF94E,
+            0xF94F, 0xF950, 0xF951, 0xF952, 0xF953, 0xF954, 0xF955, 0xF956, 0xF957, 0xF958,
+            0xF959, 0xF95A, 0xF95B, 0xF95C, 0xF95D, 0xF95E, 0xF95F, 0xF960, 0xF961, 0xF962,
+            0xF963, 0xF964, 0xF965, 0xF966, 0xF967, 0xF968, 0xF969, 0xF96A, 0xF96B, 0xF96C,
+            0xF96D, 0xF96E, 0xF96F, 0xF970, 0xF971, 0xF972, 0xF973, 0xF974, 0xF975, 0xF976,
+            0xF977, 0xF978, 0xF979, 0xF97A, 0xF97B, 0xF97C, 0xF97D, 0xF97E, 0xF97F, 0xF980,
+            0xF981, 0xF982, 0xF983, 0xF984, 0xF985, 0xF986, 0xF987, 0xF988, 0xF989, 0xF98A,
+            0xF98B, 0xF98C, 0xF98D, 0xF98E, 0xF98F, 0xF990, 0xF991, 0xF992, 0xF993, 0xF994,
+            0xF995, 0xF996, 0xF997, 0xF998, 0xF999, 0xF99A, 0xF99B, 0xF99C, 0xF99D, 0xF99E,
+            0xF99F, 0xF9A0, 0xF9A1, 0xF9A2, 0xF9A3, 0xF9A4, 0xF9A5, 0xF9A6, 0xF9A7, 0xF9A8,
+            0xF9A9, 0xF9AA, 0xF9AB, 0xF9AC, 0xF9AD, 0xF9AE, 0xF9AF, 0xF9B0, 0xF9B1, 0xF9B2,
+            0xF9B3, 0xF9B4, 0xF9B5, 0xF9B6, 0xF9B7, 0xF9B8, 0xF9B9, 0xF9BA, 0xF9BB, 0xF9BC,
+            0xF9BD, 0xF9BE, 0xF9BF, 0xF9C0, 0xF9C1, 0xF9C2, 0xF9C3, 0xF9C4, 0xF9C5, 0xF9C6,
+            0xF9C7, 0xF9C8, 0xF9C9, 0xF9CA, 0xF9CB, 0xF9CC, 0xF9CD, 0xF9CE, 0xF9CF, 0xF9D0,
+            0xF9D1, 0xF9D2, 0xF9D3, 0xF9D4, 0xF9D5, 0xF9D6, 0xF9D7, 0xF9D8, 0xF9D9, 0xF9DA,
+            0xF9DB, 0xF9DC, 0xF9DD, 0xF9DE, 0xF9DF, 0xF9E0, 0xF9E1, 0xF9E2, 0xF9E3, 0xF9E4,
+            0xF9E5, 0xF9E6, 0xF9E7, 0xF9E8, 0xF9E9, 0xF9EA, 0xF9EB, 0xF9EC, 0xF9ED, 0xF9EE,
+            0xF9EF, 0xF9F0, 0xF9F1, 0xF9F2, 0xF9F3, 0xF9F4, 0xF9F5, 0xF9F6, 0xF9F7, 0xF9F8,
+            0xF9F9, 0xF9FA, 0xF9FB, 0xF9FC, 0xF9FD, 0xF9FE, 0xF9FF, 0xFA00, 0xFA01, 0xFA02,
+            0xFA03, 0xFA04, 0xFA05, 0xFA06, 0xFA07, 0xFA08, 0xFA09, 0xFA0A, 0xFA0B, 0xFA0C,
+            0xFA0D, 0xFA0E, 0xFA0F, 0xFA10, 0xFA11, 0xFA12, 0xFA13, 0xFA14, 0xFA15, 0xFA16,
+            0xFA17, 0xFA18, 0xFA19, 0xFA1A, 0xFA1B, 0xFA1C, 0xFA1D, 0xFA1E, 0xFA1F, 0xFA20,
+            0xFA21, 0xFA22, 0xFA23, 0xFA24, 0xFA25, 0xFA26, 0xFA27, 0xFA28, 0xFA29, 0xFA2A,
+            0xFA2B, 0xFA2C, 0xFA2D, 0xFA2E, 0xFA2F, 0xFA30, 0xFA31, 0xFA32, 0xFA33, 0xFA34,
+            0xFA35, 0xFA36, 0xFA37, 0xFA38, 0xFA39, 0xFA3A, 0xFA3B, 0xFA3C, 0xFA3D, 0xFA3E,
+            0xFA3F, 0xFA40, 0xFA41, 0xFA42, 0xFA43, 0xFA44, 0xFA45, 0xFA46, 0xFA47, 0xFA48,
+            0xFA49, 0xFA4A, 0xFA4B, 0xFA4C, 0xFA4D, 0xFA4E, 0xFA4F, 0xFA50, 0xFA51, 0xFA52,
+            0xFA53, 0xFA54, 0xFA55, 0xFA56, 0xFA57, 0xFA58, 0xFA59, 0xFA5A, 0xFA5B, 0xFA5C,
+            0xFA5D, 0xFA5E, 0xFA5F, 0xFA60, 0xFA61, 0xFA62, 0xFA63, 0xFA64, 0xFA65, 0xFA66,
+            0xFA67, 0xFA68, 0xFA69, 0xFA6A, 0xFA6B, 0xFA6C, 0xFA6D, 0xFA70, 0xFA71, 0xFA72,
+            0xFA73, 0xFA74, 0xFA75, 0xFA76, 0xFA77, 0xFA78, 0xFA79, 0xFA7A, 0xFA7B, 0xFA7C,
+            0xFA7D, 0xFA7E, 0xFA7F, 0xFA80, 0xFA81, 0xFA82, 0xFA83, 0xFA84, 0xFA85, 0xFA86,
+            0xFA87, 0xFA88, 0xFA89, 0xFA8A, 0xFA8B, 0xFA8C, 0xFA8D, 0xFA8E, 0xFA8F, 0xFA90,
+            0xFA91, 0xFA92, 0xFA93, 0xFA94, 0xFA95, 0xFA96, 0xFA97, 0xFA98, 0xFA99, 0xFA9A,
+            0xFA9B, 0xFA9C, 0xFA9D, 0xFA9E, 0xFA9F, 0xFAA0, 0xFAA1, 0xFAA2, 0xFAA3, 0xFAA4,
+            0xFAA5, 0xFAA6, 0xFAA7, 0xFAA8, 0xFAA9, 0xFAAA, 0xFAAB, 0xFAAC, 0xFAAD, 0xFAAE,
+            0xFAAF, 0xFAB0, 0xFAB1, 0xFAB2, 0xFAB3, 0xFAB4, 0xFAB5, 0xFAB6, 0xFAB7, 0xFAB8,
+            0xFAB9, 0xFABA, 0xFABB, 0xFABC, 0xFABD, 0xFABE, 0xFABF, 0xFAC0, 0xFAC1, 0xFAC2,
+            0xFAC3, 0xFAC4, 0xFAC5, 0xFAC6, 0xFAC7, 0xFAC8, 0xFAC9, 0xFACA, 0xFACB, 0xFACC,
+            0xFACD, 0xFACE, 0xFACF, 0xFAD0, 0xFAD1, 0xFAD2, 0xFAD3, 0xFAD4, 0xFAD5, 0xFAD6,
+            0xFAD7, 0xFAD8, 0xFAD9, 0xFB00, 0xFB01, 0xFB02, 0xFB03, 0xFB04, 0xFB05, 0xFB06,
+            0xFB13, 0xFB14, 0xFB15, 0xFB16, 0xFB17, 0xFB1D, 0xFB1E, 0xFB1F, 0xFB20, 0xFB21,
+            0xFB22, 0xFB24, 0xFB27, 0xFB28, 0xFB29, 0xFB2A, 0xFB2B, 0xFB2C, 0xFB2D, 0xFB2E,
+            0xFB2F, 0xFB30, 0xFB31, 0xFB32, 0xFB33, 0xFB34, 0xFB35, 0xFB36, 0xFB38, 0xFB39,
+            0xFB3A, 0xFB3B, 0xFB3C, 0xFB3E, 0xFB40, 0xFB41, 0xFB43, 0xFB44, 0xFB46, 0xFB47,
+            0xFB48, 0xFB49, 0xFB4A, 0xFB4B, 0xFB4C, 0xFB4D, 0xFB4E, 0xFB4F, 0xFB50, 0xFB51,
+            0xFB52, 0xFB53, 0xFB54, 0xFB55, 0xFB56, 0xFB57, 0xFB58, 0xFB59, 0xFB5A, 0xFB5B,
+            0xFB5C, 0xFB5D, 0xFB5E, 0xFB5F, 0xFB60, 0xFB61, 0xFB62, 0xFB63, 0xFB64, 0xFB65,
+            0xFB66, 0xFB67, 0xFB68, 0xFB69, 0xFB6A, 0xFB6B, 0xFB6C, 0xFB6D, 0xFB6E, 0xFB6F,
+            0xFB70, 0xFB71, 0xFB72, 0xFB73, 0xFB74, 0xFB75, 0xFB76, 0xFB77, 0xFB78, 0xFB79,
+            0xFB7A, 0xFB7B, 0xFB7C, 0xFB7D, 0xFB7E, 0xFB7F, 0xFB80, 0xFB81, 0xFB82, 0xFB83,
+            0xFB84, 0xFB85, 0xFB86, 0xFB87, 0xFB88, 0xFB89, 0xFB8A, 0xFB8B, 0xFB8C, 0xFB8D,
+            0xFB8E, 0xFB8F, 0xFB90, 0xFB91, 0xFB92, 0xFB93, 0xFB94, 0xFB95, 0xFB96, 0xFB97,
+            0xFB98, 0xFB99, 0xFB9A, 0xFB9B, 0xFB9C, 0xFB9D, 0xFB9E, 0xFB9F, 0xFBA0, 0xFBA1,
+            0xFBA2, 0xFBA3, 0xFBA4, 0xFBA5, 0xFBA6, 0xFBA7, 0xFBA8, 0xFBA9, 0xFBAA, 0xFBAB,
+            0xFBAC, 0xFBAD, 0xFBAE, 0xFBAF, 0xFBB0, 0xFBB1, 0xFBB2, 0xFBD3, 0xFBD4, 0xFBD5,
+            0xFBD6, 0xFBD7, 0xFBD8, 0xFBD9, 0xFBDA, 0xFBDB, 0xFBDC, 0xFBDD, 0xFBDE, 0xFBDF,
+            0xFBE0, 0xFBE1, 0xFBE2, 0xFBE3, 0xFBE4, 0xFBE5, 0xFBE6, 0xFBE7, 0xFBE8, 0xFBE9,
+            0xFBEA, 0xFBEB, 0xFBEC, 0xFBED, 0xFBEE, 0xFBEF, 0xFBF0, 0xFBF1, 0xFBF2, 0xFBF3,
+            0xFBF4, 0xFBF5, 0xFBF6, 0xFBF7, 0xFBF8, 0xFBF9, 0xFBFA, 0xFBFB, 0xFBFC, 0xFBFD,
+            0xFBFE, 0xFBFF, 0xFC00, 0xFC01, 0xFC02, 0xFC03, 0xFC04, 0xFC05, 0xFC06, 0xFC07,
+            0xFC08, 0xFC09, 0xFC0A, 0xFC0B, 0xFC0C, 0xFC0D, 0xFC0E, 0xFC0F, 0xFC10, 0xFC11,
+            0xFC12, 0xFC13, 0xFC14, 0xFC15, 0xFC16, 0xFC17, 0xFC18, 0xFC19, 0xFC1A, 0xFC1B,
+            0xFC1C, 0xFC1D, 0xFC1E, 0xFC1F, 0xFC20, 0xFC21, 0xFC22, 0xFC23, 0xFC24, 0xFC25,
+            0xFC26, 0xFC27, 0xFC28, 0xFC29, 0xFC2A, 0xFC2B, 0xFC2C, 0xFC2D, 0xFC2E, 0xFC2F,
+            0xFC30, 0xFC31, 0xFC32, 0xFC33, 0xFC34, 0xFC35, 0xFC36, 0xFC37, 0xFC38, 0xFC39,
+            0xFC3A, 0xFC3B, 0xFC3C, 0xFC3D, 0xFC3E, 0xFC3F, 0xFC40, 0xFC41, 0xFC42, 0xFC43,
+            0xFC44, 0xFC45, 0xFC46, 0xFC47, 0xFC48, 0xFC49, 0xFC4A, 0xFC4B, 0xFC4C, 0xFC4D,
+            0xFC4E, 0xFC4F, 0xFC50, 0xFC51, 0xFC52, 0xFC53, 0xFC54, 0xFC55, 0xFC56, 0xFC57,
+            0xFC58, 0xFC59, 0xFC5A, 0xFC5B, 0xFC5C, 0xFC5D, 0xFC5E, 0xFC5F, 0xFC60, 0xFC61,
+            0xFC62, 0xFC63, 0xFC64, 0xFC65, 0xFC66, 0xFC67, 0xFC68, 0xFC69, 0xFC6A, 0xFC6B,
+            0xFC6C, 0xFC6D, 0xFC6E, 0xFC6F, 0xFC70, 0xFC71, 0xFC72, 0xFC73, 0xFC74, 0xFC75,
+            0xFC76, 0xFC77, 0xFC78, 0xFC79, 0xFC7A, 0xFC7B, 0xFC7C, 0xFC7D, 0xFC7E, 0xFC7F,
+            0xFC80, 0xFC81, 0xFC82, 0xFC83, 0xFC84, 0xFC85, 0xFC86, 0xFC87, 0xFC88, 0xFC89,
+            0xFC8A, 0xFC8B, 0xFC8C, 0xFC8D, 0xFC8E, 0xFC8F, 0xFC90, 0xFC91, 0xFC92, 0xFC93,
+            0xFC94, 0xFC95, 0xFC96, 0xFC97, 0xFC98, 0xFC99, 0xFC9A, 0xFC9B, 0xFC9C, 0xFC9D,
+            0xFC9E, 0xFC9F, 0xFCA0, 0xFCA1, 0xFCA2, 0xFCA3, 0xFCA4, 0xFCA5, 0xFCA6, 0xFCA7,
+            0xFCA8, 0xFCA9, 0xFCAA, 0xFCAB, 0xFCAC, 0xFCAD, 0xFCAE, 0xFCAF, 0xFCB0, 0xFCB1,
+            0xFCB2, 0xFCB3, 0xFCB4, 0xFCB5, 0xFCB6, 0xFCB7, 0xFCB8, 0xFCB9, 0xFCBA, 0xFCBB,
+            0xFCBC, 0xFCBD, 0xFCBE, 0xFCBF, 0xFCC0, 0xFCC1, 0xFCC2, 0xFCC3, 0xFCC4, 0xFCC5,
+            0xFCC6, 0xFCC7, 0xFCC8, 0xFCC9, 0xFCCA, 0xFCCB, 0xFCCC, 0xFCCD, 0xFCCE, 0xFCCF,
+            0xFCD0, 0xFCD1, 0xFCD2, 0xFCD3, 0xFCD4, 0xFCD5, 0xFCD6, 0xFCD7, 0xFCD8, 0xFCD9,
+            0xFCDA, 0xFCDB, 0xFCDC, 0xFCDD, 0xFCDE, 0xFCDF, 0xFCE0, 0xFCE1, 0xFCE2, 0xFCE3,
+            0xFCE4, 0xFCE5, 0xFCE6, 0xFCE7, 0xFCE8, 0xFCE9, 0xFCEA, 0xFCEB, 0xFCEC, 0xFCED,
+            0xFCEE, 0xFCEF, 0xFCF0, 0xFCF1, 0xFCF2, 0xFCF3, 0xFCF4, 0xFCF5, 0xFCF6, 0xFCF7,
+            0xFCF8, 0xFCF9, 0xFCFA, 0xFCFB, 0xFCFC, 0xFCFD, 0xFCFE, 0xFCFF, 0xFD00, 0xFD01,
+            0xFD02, 0xFD03, 0xFD04, 0xFD05, 0xFD06, 0xFD07, 0xFD08, 0xFD09, 0xFD0A, 0xFD0B,
+            0xFD0C, 0xFD0D, 0xFD0E, 0xFD0F, 0xFD10, 0xFD11, 0xFD12, 0xFD13, 0xFD14, 0xFD15,
+            0xFD16, 0xFD17, 0xFD18, 0xFD19, 0xFD1A, 0xFD1B, 0xFD1C, 0xFD1D, 0xFD1E, 0xFD1F,
+            0xFD20, 0xFD21, 0xFD22, 0xFD23, 0xFD24, 0xFD25, 0xFD26, 0xFD27, 0xFD28, 0xFD29,
+            0xFD2A, 0xFD2B, 0xFD2C, 0xFD2D, 0xFD2E, 0xFD2F, 0xFD30, 0xFD31, 0xFD32, 0xFD33,
+            0xFD34, 0xFD35, 0xFD36, 0xFD37, 0xFD38, 0xFD39, 0xFD3A, 0xFD3B, 0xFD3C, 0xFD3D,
+            0xFD3E, 0xFD50, 0xFD51, 0xFD52, 0xFD53, 0xFD54, 0xFD55, 0xFD56, 0xFD57, 0xFD58,
+            0xFD59, 0xFD5A, 0xFD5B, 0xFD5C, 0xFD5D, 0xFD5E, 0xFD5F, 0xFD60, 0xFD61, 0xFD62,
+            0xFD63, 0xFD64, 0xFD65, 0xFD66, 0xFD67, 0xFD68, 0xFD69, 0xFD6A, 0xFD6B, 0xFD6C,
+            0xFD6D, 0xFD6E, 0xFD6F, 0xFD70, 0xFD71, 0xFD72, 0xFD73, 0xFD74, 0xFD75, 0xFD76,
+            0xFD77, 0xFD78, 0xFD79, 0xFD7A, 0xFD7B, 0xFD7C, 0xFD7D, 0xFD7E, 0xFD7F, 0xFD80,
+            0xFD81, 0xFD82, 0xFD83, 0xFD84, 0xFD85, 0xFD86, 0xFD87, 0xFD88, 0xFD89, 0xFD8A,
+            0xFD8B, 0xFD8C, 0xFD8D, 0xFD8E, 0xFD8F, 0xFD92, 0xFD93, 0xFD94, 0xFD95, 0xFD96,
+            0xFD97, 0xFD98, 0xFD99, 0xFD9A, 0xFD9B, 0xFD9C, 0xFD9D, 0xFD9E, 0xFD9F, 0xFDA0,
+            0xFDA1, 0xFDA2, 0xFDA3, 0xFDA4, 0xFDA5, 0xFDA6, 0xFDA7, 0xFDA8, 0xFDA9, 0xFDAA,
+            0xFDAB, 0xFDAC, 0xFDAD, 0xFDAE, 0xFDAF, 0xFDB0, 0xFDB1, 0xFDB2, 0xFDB3, 0xFDB4,
+            0xFDB5, 0xFDB6, 0xFDB7, 0xFDB8, 0xFDB9, 0xFDBA, 0xFDBB, 0xFDBC, 0xFDBD, 0xFDBE,
+            0xFDBF, 0xFDC0, 0xFDC1, 0xFDC2, 0xFDC3, 0xFDC4, 0xFDC5, 0xFDC6, 0xFDC7, 0xFDF0,
+            0xFDF1, 0xFDF2, 0xFDF3, 0xFDF4, 0xFDF5, 0xFDF6, 0xFDF7, 0xFDF8, 0xFDF9, 0xFDFA,
+            0xFDFB, 0xFDFC, 0xFDFD, 0xFE00, 0xFE01, 0xFE02, 0xFE03, 0xFE04, 0xFE05, 0xFE06,
+            0xFE07, 0xFE08, 0xFE09, 0xFE0A, 0xFE0B, 0xFE0C, 0xFE0D, 0xFE0E, 0xFE0F, 0xFE10,
+            0xFE11, 0xFE12, 0xFE13, 0xFE14, 0xFE15, 0xFE16, 0xFE17, 0xFE19, 0xFE20, 0xFE21,
+            0xFE22, 0xFE23, 0xFE24, 0xFE25, 0xFE26, 0xFE27, 0xFE28, 0xFE29, 0xFE2A, 0xFE2B,
+            0xFE2C, 0xFE2D, 0xFE2E, 0xFE2F, 0xFE30, 0xFE31, 0xFE32, 0xFE33, 0xFE34, 0xFE35,
+            0xFE37, 0xFE39, 0xFE3B, 0xFE3D, 0xFE3F, 0xFE41, 0xFE45, 0xFE47, 0xFE49, 0xFE4A,
+            0xFE4B, 0xFE4C, 0xFE4E, 0xFE4F, 0xFE50, 0xFE51, 0xFE52, 0xFE54, 0xFE55, 0xFE56,
+            0xFE57, 0xFE58, 0xFE59, 0xFE5B, 0xFE5D, 0xFE5F, 0xFE60, 0xFE61, 0xFE62, 0xFE63,
+            0xFE64, 0xFE65, 0xFE66, 0xFE68, 0xFE69, 0xFE6A, 0xFE6B, 0xFE70, 0xFE71, 0xFE72,
+            0xFE73, 0xFE74, 0xFE76, 0xFE77, 0xFE78, 0xFE79, 0xFE7A, 0xFE7B, 0xFE7C, 0xFE7D,
+            0xFE7E, 0xFE7F, 0xFE80, 0xFE82, 0xFE83, 0xFE84, 0xFE85, 0xFE86, 0xFE87, 0xFE88,
+            0xFE89, 0xFE8A, 0xFE8B, 0xFE8C, 0xFE8D, 0xFE8E, 0xFE8F, 0xFE90, 0xFE91, 0xFE92,
+            0xFE93, 0xFE94, 0xFE95, 0xFE96, 0xFE97, 0xFE98, 0xFE99, 0xFE9A, 0xFE9B, 0xFE9C,
+            0xFE9D, 0xFE9E, 0xFE9F, 0xFEA0, 0xFEA1, 0xFEA2, 0xFEA3, 0xFEA4, 0xFEA5, 0xFEA6,
+            0xFEA7, 0xFEA8, 0xFEA9, 0xFEAA, 0xFEAB, 0xFEAC, 0xFEAD, 0xFEAE, 0xFEAF, 0xFEB0,
+            0xFEB1, 0xFEB2, 0xFEB3, 0xFEB4, 0xFEB5, 0xFEB6, 0xFEB7, 0xFEB8, 0xFEB9, 0xFEBA,
+            0xFEBB, 0xFEBC, 0xFEBD, 0xFEBE, 0xFEBF, 0xFEC0, 0xFEC1, 0xFEC2, 0xFEC3, 0xFEC4,
+            0xFEC5, 0xFEC6, 0xFEC7, 0xFEC8, 0xFEC9, 0xFECA, 0xFECB, 0xFECC, 0xFECD, 0xFECE,
+            0xFECF, 0xFED0, 0xFED1, 0xFED2, 0xFED3, 0xFED4, 0xFED5, 0xFED6, 0xFED7, 0xFED8,
+            0xFED9, 0xFEDA, 0xFEDB, 0xFEDC, 0xFEDD, 0xFEDE, 0xFEDF, 0xFEE0, 0xFEE1, 0xFEE2,
+            0xFEE3, 0xFEE4, 0xFEE5, 0xFEE6, 0xFEE7, 0xFEE8, 0xFEE9, 0xFEEA, 0xFEEB, 0xFEEC,
+            0xFEED, 0xFEEE, 0xFEEF, 0xFEF0, 0xFEF1, 0xFEF2, 0xFEF3, 0xFEF4, 0xFEF5, 0xFEF6,
+            0xFEF7, 0xFEF8, 0xFEF9, 0xFEFA, 0xFEFB, 0xFEFC, 0xFEFF, 0xFF01, 0xFF02, 0xFF03,
+            0xFF04, 0xFF05, 0xFF06, 0xFF07, 0xFF08, 0xFF0A, 0xFF0B, 0xFF0C, 0xFF0D, 0xFF0E,
+            0xFF0F, 0xFF10, 0xFF1A, 0xFF1B, 0xFF1C, 0xFF1F, 0xFF20, 0xFF21, 0xFF22, 0xFF23,
+            0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28, 0xFF29, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D,
+            0xFF2E, 0xFF2F, 0xFF30, 0xFF31, 0xFF32, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37,
+            0xFF38, 0xFF39, 0xFF3A, 0xFF3B, 0xFF3C, 0xFF3D, 0xFF3E, 0xFF3F, 0xFF40, 0xFF41,
+            0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFF4A, 0xFF4B,
+            0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55,
+            0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A, 0xFF5B, 0xFF5C, 0xFF5D, 0xFF5E, 0xFF5F,
+            0xFF61, 0xFF62, 0xFF64, 0xFF65, 0xFF66, 0xFF67, 0xFF6A, 0xFF6C, 0xFF6F, 0xFF70,
+            0xFF71, 0xFF74, 0xFF9D, 0xFF9E, 0xFF9F, 0xFFA0, 0xFFA1, 0xFFA3, 0xFFA4, 0xFFA5,
+            0xFFA7, 0xFFAA, 0xFFB0, 0xFFB1, 0xFFB4, 0xFFB5, 0xFFC2, 0xFFCA, 0xFFD2, 0xFFDA,
+            0xFFE0, 0xFFE1, 0xFFE2, 0xFFE3, 0xFFE4, 0xFFE5, 0xFFE6, 0xFFE8, 0xFFE9, 0xFFEA,
+            0xFFEB, 0xFFEC, 0xFFED, 0xFFEE, 0xFFF9, 0xFFFA, 0xFFFB, 0xFFFC, 0xFFFD, 0x10000,
+            0x1000D, 0x10028, 0x1003C, 0x1003F, 0x10050, 0x10080, 0x10100, 0x10107, 0x10110, 0x10137,
+            0x10140, 0x10142, 0x10143, 0x10144, 0x10148, 0x10149, 0x1014F, 0x10150, 0x10158, 0x10159,
+            0x1015A, 0x1015C, 0x1015D, 0x1015E, 0x1015F, 0x10160, 0x10173, 0x10174, 0x10179, 0x1018A,
+            0x1018B, 0x1018C, 0x10190, 0x101A0, 0x101D0, 0x101FD, 0x10280, 0x102A0, 0x102E0, 0x102E1,
+            0x102EA, 0x10300, 0x1030F, 0x1031F, 0x10320, 0x10321, 0x10322, 0x1032D, 0x10350, 0x10376,
+            0x10377, 0x10378, 0x10379, 0x1037A, 0x10380, 0x1039F, 0x103A0, 0x103C8, 0x103D0, 0x103D1,
+            0x103D3, 0x10400, 0x10428, 0x10480, 0x104A0, 0x104B0, 0x104D8, 0x10500, 0x10530, 0x1056F,
+            0x10600, 0x10700, 0x10740, 0x10760, 0x10800, 0x10808, 0x1080A, 0x10837, 0x1083C, 0x1083F,
+            0x10840, 0x10857, 0x10858, 0x1085B, 0x10860, 0x1086D, 0x1086E, 0x10877, 0x10879, 0x1087E,
+            0x10880, 0x10881, 0x10882, 0x10883, 0x10886, 0x10887, 0x1088C, 0x1088D, 0x1088E, 0x1088F,
+            0x10890, 0x10891, 0x10892, 0x10893, 0x10894, 0x10895, 0x1089C, 0x1089D, 0x108A7, 0x108AB,
+            0x108AD, 0x108E0, 0x108F4, 0x108FB, 0x108FC, 0x108FD, 0x10900, 0x10916, 0x10917, 0x1091A,
+            0x1091F, 0x10920, 0x1093F, 0x10980, 0x10981, 0x10982, 0x10983, 0x10984, 0x10985, 0x10986,
+            0x10987, 0x10988, 0x10989, 0x1098A, 0x1098B, 0x1098C, 0x1098D, 0x1098E, 0x1098F, 0x10990,
+            0x10991, 0x10992, 0x10993, 0x10994, 0x10995, 0x10996, 0x10997, 0x10998, 0x10999, 0x1099A,
+            0x1099B, 0x1099C, 0x1099D, 0x1099E, 0x109A0, 0x109B0, 0x109B1, 0x109BC, 0x109BD, 0x109BE,
+            0x109C0, 0x109C9, 0x109D2, 0x109F6, 0x10A00, 0x10A05, 0x10A0C, 0x10A0D, 0x10A0E, 0x10A0F,
+            0x10A10, 0x10A11, 0x10A15, 0x10A19, 0x10A1B, 0x10A1C, 0x10A2D, 0x10A32, 0x10A33, 0x10A34,
+            0x10A35, 0x10A38, 0x10A39, 0x10A3A, 0x10A3F, 0x10A40, 0x10A44, 0x10A50, 0x10A56, 0x10A58,
+            0x10A60, 0x10A7D, 0x10A7E, 0x10A80, 0x10A9D, 0x10A9E, 0x10AC0, 0x10AC8, 0x10AC9, 0x10AE5,
+            0x10AE6, 0x10AEB, 0x10AEC, 0x10AED, 0x10AF0, 0x10B00, 0x10B2E, 0x10B2F, 0x10B39, 0x10B3A,
+            0x10B40, 0x10B58, 0x10B5C, 0x10B60, 0x10B78, 0x10B7C, 0x10B80, 0x10B99, 0x10BA9, 0x10BAD,
+            0x10C00, 0x10C01, 0x10C02, 0x10C04, 0x10C05, 0x10C08, 0x10C09, 0x10C0A, 0x10C0B, 0x10C0C,
+            0x10C0D, 0x10C0E, 0x10C0F, 0x10C10, 0x10C11, 0x10C12, 0x10C13, 0x10C15, 0x10C16, 0x10C17,
+            0x10C18, 0x10C19, 0x10C1A, 0x10C1B, 0x10C1C, 0x10C1D, 0x10C1E, 0x10C1F, 0x10C20, 0x10C25,
+            0x10C26, 0x10C27, 0x10C28, 0x10C29, 0x10C2A, 0x10C2B, 0x10C2C, 0x10C2E, 0x10C2F, 0x10C33,
+            0x10C34, 0x10C35, 0x10C36, 0x10C37, 0x10C38, 0x10C39, 0x10C3A, 0x10C3B, 0x10C3C, 0x10C40,
+            0x10C41, 0x10C42, 0x10C43, 0x10C44, 0x10C45, 0x10C46, 0x10C47, 0x10C80, 0x10C81, 0x10C82,
+            0x10C8A, 0x10C8B, 0x10C8C, 0x10C91, 0x10C92, 0x10C9C, 0x10C9D, 0x10C9E, 0x10C9F, 0x10CA0,
+            0x10CA3, 0x10CA4, 0x10CAB, 0x10CAC, 0x10CAD, 0x10CAE, 0x10CC0, 0x10CC1, 0x10CC2, 0x10CCA,
+            0x10CCB, 0x10CCC, 0x10CD1, 0x10CD2, 0x10CDC, 0x10CDD, 0x10CDE, 0x10CDF, 0x10CE0, 0x10CE3,
+            0x10CE4, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE, 0x10CFA, 0x10CFB, 0x10CFC, 0x10D00, 0x10D01,
+            0x10D1D, 0x10D22, 0x10D24, 0x10D25, 0x10D26, 0x10D27, 0x10D30, 0x10E60, 0x10E69, 0x10E80,
+            0x10EA1, 0x10EA9, 0x10EAB, 0x10EAC, 0x10EAD, 0x10EB0, 0x10EB1, 0x10F00, 0x10F01, 0x10F02,
+            0x10F03, 0x10F04, 0x10F06, 0x10F07, 0x10F0F, 0x10F10, 0x10F11, 0x10F13, 0x10F14, 0x10F16,
+            0x10F17, 0x10F18, 0x10F1B, 0x10F1C, 0x10F1D, 0x10F22, 0x10F27, 0x10F30, 0x10F45, 0x10F46,
+            0x10F47, 0x10F48, 0x10F49, 0x10F4A, 0x10F4B, 0x10F4C, 0x10F4D, 0x10F4E, 0x10F4F, 0x10F50,
+            0x10F51, 0x10F52, 0x10F55, 0x10FB0, 0x10FC5, 0x10FC9, 0x10FE0, 0x10FF6, 0x11000, 0x11001,
+            0x11002, 0x11003, 0x11005, 0x11034, 0x11047, 0x11049, 0x11052, 0x1105B, 0x11066, 0x1107F,
+            0x11080, 0x11081, 0x11082, 0x11083, 0x1109A, 0x1109B, 0x1109C, 0x1109D, 0x110AB, 0x110AC,
+            0x110BA, 0x110BB, 0x110BD, 0x110BE, 0x110C0, 0x110CD, 0x110D0, 0x110F0, 0x11100, 0x11101,
+            0x11102, 0x11103, 0x11124, 0x11127, 0x11131, 0x11132, 0x11133, 0x11136, 0x11140, 0x11141,
+            0x11143, 0x11144, 0x11145, 0x11147, 0x11150, 0x11170, 0x11173, 0x11174, 0x11176, 0x11180,
+            0x11181, 0x11182, 0x11183, 0x111B3, 0x111BD, 0x111C1, 0x111C4, 0x111C5, 0x111C7, 0x111C8,
+            0x111C9, 0x111CA, 0x111CB, 0x111CC, 0x111CD, 0x111CE, 0x111CF, 0x111D0, 0x111DA, 0x111DB,
+            0x111DC, 0x111DD, 0x111DE, 0x111E1, 0x111EA, 0x11200, 0x11213, 0x11234, 0x11235, 0x11236,
+            0x11237, 0x11238, 0x1123A, 0x1123E, 0x11280, 0x11284, 0x11288, 0x1128A, 0x1128F, 0x1129F,
+            0x112A5, 0x112A7, 0x112A9, 0x112B0, 0x112DF, 0x112E0, 0x112E9, 0x112EA, 0x112F0, 0x11300,
+            0x11301, 0x11302, 0x11303, 0x11305, 0x1130C, 0x1130F, 0x11313, 0x1132A, 0x11332, 0x11335,
+            0x1133B, 0x1133C, 0x1133D, 0x1133E, 0x11347, 0x11348, 0x1134B, 0x11350, 0x11357, 0x1135D,
+            0x1135E, 0x11360, 0x11361, 0x11362, 0x11366, 0x11367, 0x11368, 0x11369, 0x1136A, 0x1136B,
+            0x1136C, 0x11370, 0x11371, 0x11372, 0x11373, 0x11374, 0x11400, 0x11435, 0x11443, 0x11444,
+            0x11445, 0x11446, 0x11447, 0x11448, 0x11449, 0x1144B, 0x1144D, 0x1144E, 0x11450, 0x1145A,
+            0x1145B, 0x1145D, 0x1145E, 0x1145F, 0x11460, 0x11480, 0x114B0, 0x114B9, 0x114BA, 0x114BF,
+            0x114C0, 0x114C1, 0x114C2, 0x114C3, 0x114C4, 0x114C6, 0x114C7, 0x114D0, 0x11580, 0x115B8,
+            0x115B9, 0x115BA, 0x115BC, 0x115BD, 0x115BE, 0x115BF, 0x115C0, 0x115C1, 0x115C2, 0x115C4,
+            0x115D8, 0x115D9, 0x115DA, 0x115DB, 0x115DC, 0x115DD, 0x11600, 0x1163D, 0x1163E, 0x1163F,
+            0x11640, 0x11641, 0x11643, 0x11644, 0x11650, 0x11660, 0x11680, 0x1168A, 0x1168C, 0x116A7,
+            0x116A8, 0x116A9, 0x116AA, 0x116AB, 0x116AC, 0x116AD, 0x116B7, 0x116B8, 0x116C0, 0x11700,
+            0x11705, 0x11706, 0x11716, 0x11717, 0x1171A, 0x1171D, 0x11720, 0x11730, 0x1173A, 0x1173C,
+            0x1173E, 0x1173F, 0x11800, 0x11837, 0x11838, 0x11839, 0x1183A, 0x1183B, 0x118A0, 0x118C0,
+            0x118E0, 0x118EA, 0x118FF, 0x11900, 0x11909, 0x1190C, 0x11911, 0x11915, 0x11918, 0x11926,
+            0x11927, 0x11928, 0x11935, 0x11937, 0x1193B, 0x1193C, 0x1193D, 0x1193F, 0x11940, 0x11941,
+            0x11942, 0x11943, 0x11944, 0x11945, 0x11946, 0x11950, 0x119A0, 0x119AA, 0x119D1, 0x119DA,
+            0x119DB, 0x119DE, 0x119DF, 0x119E0, 0x119E1, 0x119E2, 0x119E3, 0x119E4, 0x11A00, 0x11A0B,
+            0x11A0C, 0x11A32, 0x11A33, 0x11A34, 0x11A35, 0x11A36, 0x11A37, 0x11A38, 0x11A39, 0x11A3A,
+            0x11A3B, 0x11A3F, 0x11A47, 0x11A50, 0x11A54, 0x11A55, 0x11A56, 0x11A57, 0x11A59, 0x11A5B,
+            0x11A5D, 0x11A83, 0x11A84, 0x11A86, 0x11A88, 0x11A89, 0x11A8A, 0x11A8B, 0x11A8C, 0x11A8D,
+            0x11A8E, 0x11A90, 0x11A91, 0x11A93, 0x11A94, 0x11A95, 0x11A96, 0x11A97, 0x11A98, 0x11A99,
+            0x11A9A, 0x11A9D, 0x11A9E, 0x11AC0, 0x11AD5, 0x11ADC, 0x11ADE, 0x11ADF, 0x11AE4, 0x11AE5,
+            0x11AE6, 0x11AE7, 0x11AE8, 0x11AE9, 0x11AEA, 0x11AEB, 0x11AEC, 0x11AED, 0x11AEE, 0x11AEF,
+            0x11AF0, 0x11AF1, 0x11AF2, 0x11AF3, 0x11AF4, 0x11AF5, 0x11AF6, 0x11AF7, 0x11AF8, 0x11C00,
+            0x11C0A, 0x11C2F, 0x11C38, 0x11C3C, 0x11C3D, 0x11C3E, 0x11C3F, 0x11C40, 0x11C41, 0x11C43,
+            0x11C50, 0x11C5A, 0x11C63, 0x11C70, 0x11C72, 0x11C73, 0x11C74, 0x11C75, 0x11C76, 0x11C77,
+            0x11C78, 0x11C79, 0x11C7A, 0x11C7B, 0x11C7C, 0x11C7D, 0x11C7E, 0x11C7F, 0x11C80, 0x11C81,
+            0x11C82, 0x11C83, 0x11C84, 0x11C85, 0x11C86, 0x11C87, 0x11C88, 0x11C8A, 0x11C8B, 0x11C8C,
+            0x11C8D, 0x11C8E, 0x11C8F, 0x11C92, 0x11C93, 0x11C94, 0x11C95, 0x11C96, 0x11C97, 0x11C98,
+            0x11C99, 0x11C9A, 0x11C9B, 0x11C9C, 0x11C9D, 0x11C9E, 0x11C9F, 0x11CA0, 0x11CA1, 0x11CA2,
+            0x11CA3, 0x11CA4, 0x11CA5, 0x11CA6, 0x11CA7, 0x11CA9, 0x11CAA, 0x11CAB, 0x11CAC, 0x11CAD,
+            0x11CAE, 0x11CAF, 0x11CB5, 0x11CB6, 0x11D00, 0x11D08, 0x11D0B, 0x11D3A, 0x11D3C, 0x11D3F,
+            0x11D40, 0x11D41, 0x11D42, 0x11D43, 0x11D44, 0x11D46, 0x11D47, 0x11D50, 0x11D60, 0x11D67,
+            0x11D6A, 0x11D90, 0x11D93, 0x11D95, 0x11D96, 0x11D97, 0x11D98, 0x11DA0, 0x11EE0, 0x11EF7,
+            0x11FB0, 0x11FC0, 0x11FD5, 0x11FDD, 0x11FE1, 0x11FFF, 0x12000, 0x12100, 0x12200, 0x12263,
+            0x122D4, 0x122D6, 0x12400, 0x12408, 0x1240F, 0x12415, 0x1241E, 0x12423, 0x12425, 0x1242C,
+            0x1242F, 0x12432, 0x12434, 0x12437, 0x1243A, 0x1243B, 0x1243D, 0x1243E, 0x1243F, 0x12440,
+            0x12442, 0x12443, 0x12445, 0x12447, 0x12448, 0x12449, 0x1244A, 0x1244F, 0x12453, 0x12455,
+            0x12456, 0x12458, 0x1245A, 0x12469, 0x12470, 0x12480, 0x13000, 0x13100, 0x13200, 0x13300,
+            0x13400, 0x13430, 0x13431, 0x13432, 0x13433, 0x13434, 0x13435, 0x13436, 0x13437, 0x13438,
+            0x14400, 0x14500, 0x14600, 0x16800, 0x16900, 0x16A00, 0x16A40, 0x16A60, 0x16A6E, 0x16AD0,
+            0x16AF0, 0x16AF1, 0x16AF2, 0x16AF3, 0x16AF4, 0x16AF5, 0x16B00, 0x16B30, 0x16B31, 0x16B32,
+            0x16B33, 0x16B34, 0x16B35, 0x16B36, 0x16B37, 0x16B3C, 0x16B40, 0x16B42, 0x16B44, 0x16B45,
+            0x16B50, 0x16B5B, 0x16B63, 0x16B7D, 0x16E40, 0x16E60, 0x16E80, 0x16E8A, 0x16E94, 0x16E95,
+            0x16E96, 0x16E97, 0x16E98, 0x16E99, 0x16F00, 0x16F04, 0x16F06, 0x16F07, 0x16F0E, 0x16F10,
+            0x16F13, 0x16F14, 0x16F25, 0x16F26, 0x16F33, 0x16F34, 0x16F3A, 0x16F3F, 0x16F40, 0x16F45,
+            0x16F46, 0x16F47, 0x16F48, 0x16F49, 0x16F4A, 0x16F4F, 0x16F50, 0x16F54, 0x16F59, 0x16F5D,
+            0x16F61, 0x16F66, 0x16F6E, 0x16F73, 0x16F75, 0x16F7F, 0x16F80, 0x16F81, 0x16F82, 0x16F83,
+            0x16F84, 0x16F85, 0x16F86, 0x16F87, 0x16F8F, 0x16FE0, 0x16FE2, 0x16FE3, 0x16FE4, 0x16FF0,
+            0x16FF1, 0x1B000, 0x1B001, 0x1B002, 0x1B00F, 0x1B10F, 0x1B150, 0x1B164, 0x1BC00, 0x1BC70,
+            0x1BC80, 0x1BC90, 0x1BC9C, 0x1BC9D, 0x1BC9E, 0x1BC9F, 0x1BCA0, 0x1BCA1, 0x1BCA2, 0x1BCA3,
+            0x1D000, 0x1D100, 0x1D129, 0x1D12A, 0x1D13A, 0x1D15E, 0x1D15F, 0x1D160, 0x1D161, 0x1D162,
+            0x1D163, 0x1D164, 0x1D165, 0x1D166, 0x1D167, 0x1D168, 0x1D169, 0x1D16A, 0x1D16D, 0x1D16E,
+            0x1D16F, 0x1D170, 0x1D171, 0x1D172, 0x1D173, 0x1D174, 0x1D175, 0x1D176, 0x1D177, 0x1D178,
+            0x1D179, 0x1D17A, 0x1D17B, 0x1D17C, 0x1D17D, 0x1D17E, 0x1D17F, 0x1D180, 0x1D181, 0x1D182,
+            0x1D183, 0x1D185, 0x1D186, 0x1D187, 0x1D188, 0x1D189, 0x1D18A, 0x1D18B, 0x1D18C, 0x1D1AA,
+            0x1D1AB, 0x1D1AC, 0x1D1AD, 0x1D1AE, 0x1D1BB, 0x1D1BC, 0x1D1BD, 0x1D1BE, 0x1D1BF, 0x1D1C0,
+            0x1D1C1, 0x1D200, 0x1D242, 0x1D243, 0x1D244, 0x1D245, 0x1D2E0, 0x1D2EA, 0x1D300, 0x1D360,
+            0x1D369, 0x1D372, 0x1D377, 0x1D378, 0x1D400, 0x1D401, 0x1D402, 0x1D403, 0x1D404, 0x1D405,
+            0x1D406, 0x1D407, 0x1D408, 0x1D409, 0x1D40A, 0x1D40B, 0x1D40C, 0x1D40D, 0x1D40E, 0x1D40F,
+            0x1D410, 0x1D411, 0x1D412, 0x1D413, 0x1D414, 0x1D415, 0x1D416, 0x1D417, 0x1D418, 0x1D419,
+            0x1D41A, 0x1D41B, 0x1D41C, 0x1D41D, 0x1D41E, 0x1D41F, 0x1D420, 0x1D421, 0x1D422, 0x1D423,
+            0x1D424, 0x1D425, 0x1D426, 0x1D427, 0x1D428, 0x1D429, 0x1D42A, 0x1D42B, 0x1D42C, 0x1D42D,
+            0x1D42E, 0x1D42F, 0x1D430, 0x1D431, 0x1D432, 0x1D433, 0x1D434, 0x1D435, 0x1D436, 0x1D437,
+            0x1D438, 0x1D439, 0x1D43A, 0x1D43B, 0x1D43C, 0x1D43D, 0x1D43E, 0x1D43F, 0x1D440, 0x1D441,
+            0x1D442, 0x1D443, 0x1D444, 0x1D445, 0x1D446, 0x1D447, 0x1D448, 0x1D449, 0x1D44A, 0x1D44B,
+            0x1D44C, 0x1D44D, 0x1D44E, 0x1D44F, 0x1D450, 0x1D451, 0x1D452, 0x1D453, 0x1D454, 0x1D456,
+            0x1D457, 0x1D458, 0x1D459, 0x1D45A, 0x1D45B, 0x1D45C, 0x1D45D, 0x1D45E, 0x1D45F, 0x1D460,
+            0x1D461, 0x1D462, 0x1D463, 0x1D464, 0x1D465, 0x1D466, 0x1D467, 0x1D468, 0x1D469, 0x1D46A,
+            0x1D46B, 0x1D46C, 0x1D46D, 0x1D46E, 0x1D46F, 0x1D470, 0x1D471, 0x1D472, 0x1D473, 0x1D474,
+            0x1D475, 0x1D476, 0x1D477, 0x1D478, 0x1D479, 0x1D47A, 0x1D47B, 0x1D47C, 0x1D47D, 0x1D47E,
+            0x1D47F, 0x1D480, 0x1D481, 0x1D482, 0x1D483, 0x1D484, 0x1D485, 0x1D486, 0x1D487, 0x1D488,
+            0x1D489, 0x1D48A, 0x1D48B, 0x1D48C, 0x1D48D, 0x1D48E, 0x1D48F, 0x1D490, 0x1D491, 0x1D492,
+            0x1D493, 0x1D494, 0x1D495, 0x1D496, 0x1D497, 0x1D498, 0x1D499, 0x1D49A, 0x1D49B, 0x1D49C,
+            0x1D49E, 0x1D49F, 0x1D4A2, 0x1D4A5, 0x1D4A6, 0x1D4A9, 0x1D4AA, 0x1D4AB, 0x1D4AC, 0x1D4AE,
+            0x1D4AF, 0x1D4B0, 0x1D4B1, 0x1D4B2, 0x1D4B3, 0x1D4B4, 0x1D4B5, 0x1D4B6, 0x1D4B7, 0x1D4B8,
+            0x1D4B9, 0x1D4BB, 0x1D4BD, 0x1D4BE, 0x1D4BF, 0x1D4C0, 0x1D4C1, 0x1D4C2, 0x1D4C3, 0x1D4C5,
+            0x1D4C6, 0x1D4C7, 0x1D4C8, 0x1D4C9, 0x1D4CA, 0x1D4CB, 0x1D4CC, 0x1D4CD, 0x1D4CE, 0x1D4CF,
+            0x1D4D0, 0x1D4D1, 0x1D4D2, 0x1D4D3, 0x1D4D4, 0x1D4D5, 0x1D4D6, 0x1D4D7, 0x1D4D8, 0x1D4D9,
+            0x1D4DA, 0x1D4DB, 0x1D4DC, 0x1D4DD, 0x1D4DE, 0x1D4DF, 0x1D4E0, 0x1D4E1, 0x1D4E2, 0x1D4E3,
+            0x1D4E4, 0x1D4E5, 0x1D4E6, 0x1D4E7, 0x1D4E8, 0x1D4E9, 0x1D4EA, 0x1D4EB, 0x1D4EC, 0x1D4ED,
+            0x1D4EE, 0x1D4EF, 0x1D4F0, 0x1D4F1, 0x1D4F2, 0x1D4F3, 0x1D4F4, 0x1D4F5, 0x1D4F6, 0x1D4F7,
+            0x1D4F8, 0x1D4F9, 0x1D4FA, 0x1D4FB, 0x1D4FC, 0x1D4FD, 0x1D4FE, 0x1D4FF, 0x1D500, 0x1D501,
+            0x1D502, 0x1D503, 0x1D504, 0x1D505, 0x1D507, 0x1D508, 0x1D509, 0x1D50A, 0x1D50D, 0x1D50E,
+            0x1D50F, 0x1D510, 0x1D511, 0x1D512, 0x1D513, 0x1D514, 0x1D516, 0x1D517, 0x1D518, 0x1D519,
+            0x1D51A, 0x1D51B, 0x1D51C, 0x1D51E, 0x1D51F, 0x1D520, 0x1D521, 0x1D522, 0x1D523, 0x1D524,
+            0x1D525, 0x1D526, 0x1D527, 0x1D528, 0x1D529, 0x1D52A, 0x1D52B, 0x1D52C, 0x1D52D, 0x1D52E,
+            0x1D52F, 0x1D530, 0x1D531, 0x1D532, 0x1D533, 0x1D534, 0x1D535, 0x1D536, 0x1D537, 0x1D538,
+            0x1D539, 0x1D53B, 0x1D53C, 0x1D53D, 0x1D53E, 0x1D540, 0x1D541, 0x1D542, 0x1D543, 0x1D544,
+            0x1D546, 0x1D54A, 0x1D54B, 0x1D54C, 0x1D54D, 0x1D54E, 0x1D54F, 0x1D550, 0x1D552, 0x1D553,
+            0x1D554, 0x1D555, 0x1D556, 0x1D557, 0x1D558, 0x1D559, 0x1D55A, 0x1D55B, 0x1D55C, 0x1D55D,
+            0x1D55E, 0x1D55F, 0x1D560, 0x1D561, 0x1D562, 0x1D563, 0x1D564, 0x1D565, 0x1D566, 0x1D567,
+            0x1D568, 0x1D569, 0x1D56A, 0x1D56B, 0x1D56C, 0x1D56D, 0x1D56E, 0x1D56F, 0x1D570, 0x1D571,
+            0x1D572, 0x1D573, 0x1D574, 0x1D575, 0x1D576, 0x1D577, 0x1D578, 0x1D579, 0x1D57A, 0x1D57B,
+            0x1D57C, 0x1D57D, 0x1D57E, 0x1D57F, 0x1D580, 0x1D581, 0x1D582, 0x1D583, 0x1D584, 0x1D585,
+            0x1D586, 0x1D587, 0x1D588, 0x1D589, 0x1D58A, 0x1D58B, 0x1D58C, 0x1D58D, 0x1D58E, 0x1D58F,
+            0x1D590, 0x1D591, 0x1D592, 0x1D593, 0x1D594, 0x1D595, 0x1D596, 0x1D597, 0x1D598, 0x1D599,
+            0x1D59A, 0x1D59B, 0x1D59C, 0x1D59D, 0x1D59E, 0x1D59F, 0x1D5A0, 0x1D5A1, 0x1D5A2, 0x1D5A3,
+            0x1D5A4, 0x1D5A5, 0x1D5A6, 0x1D5A7, 0x1D5A8, 0x1D5A9, 0x1D5AA, 0x1D5AB, 0x1D5AC, 0x1D5AD,
+            0x1D5AE, 0x1D5AF, 0x1D5B0, 0x1D5B1, 0x1D5B2, 0x1D5B3, 0x1D5B4, 0x1D5B5, 0x1D5B6, 0x1D5B7,
+            0x1D5B8, 0x1D5B9, 0x1D5BA, 0x1D5BB, 0x1D5BC, 0x1D5BD, 0x1D5BE, 0x1D5BF, 0x1D5C0, 0x1D5C1,
+            0x1D5C2, 0x1D5C3, 0x1D5C4, 0x1D5C5, 0x1D5C6, 0x1D5C7, 0x1D5C8, 0x1D5C9, 0x1D5CA, 0x1D5CB,
+            0x1D5CC, 0x1D5CD, 0x1D5CE, 0x1D5CF, 0x1D5D0, 0x1D5D1, 0x1D5D2, 0x1D5D3, 0x1D5D4, 0x1D5D5,
+            0x1D5D6, 0x1D5D7, 0x1D5D8, 0x1D5D9, 0x1D5DA, 0x1D5DB, 0x1D5DC, 0x1D5DD, 0x1D5DE, 0x1D5DF,
+            0x1D5E0, 0x1D5E1, 0x1D5E2, 0x1D5E3, 0x1D5E4, 0x1D5E5, 0x1D5E6, 0x1D5E7, 0x1D5E8, 0x1D5E9,
+            0x1D5EA, 0x1D5EB, 0x1D5EC, 0x1D5ED, 0x1D5EE, 0x1D5EF, 0x1D5F0, 0x1D5F1, 0x1D5F2, 0x1D5F3,
+            0x1D5F4, 0x1D5F5, 0x1D5F6, 0x1D5F7, 0x1D5F8, 0x1D5F9, 0x1D5FA, 0x1D5FB, 0x1D5FC, 0x1D5FD,
+            0x1D5FE, 0x1D5FF, 0x1D600, 0x1D601, 0x1D602, 0x1D603, 0x1D604, 0x1D605, 0x1D606, 0x1D607,
+            0x1D608, 0x1D609, 0x1D60A, 0x1D60B, 0x1D60C, 0x1D60D, 0x1D60E, 0x1D60F, 0x1D610, 0x1D611,
+            0x1D612, 0x1D613, 0x1D614, 0x1D615, 0x1D616, 0x1D617, 0x1D618, 0x1D619, 0x1D61A, 0x1D61B,
+            0x1D61C, 0x1D61D, 0x1D61E, 0x1D61F, 0x1D620, 0x1D621, 0x1D622, 0x1D623, 0x1D624, 0x1D625,
+            0x1D626, 0x1D627, 0x1D628, 0x1D629, 0x1D62A, 0x1D62B, 0x1D62C, 0x1D62D, 0x1D62E, 0x1D62F,
+            0x1D630, 0x1D631, 0x1D632, 0x1D633, 0x1D634, 0x1D635, 0x1D636, 0x1D637, 0x1D638, 0x1D639,
+            0x1D63A, 0x1D63B, 0x1D63C, 0x1D63D, 0x1D63E, 0x1D63F, 0x1D640, 0x1D641, 0x1D642, 0x1D643,
+            0x1D644, 0x1D645, 0x1D646, 0x1D647, 0x1D648, 0x1D649, 0x1D64A, 0x1D64B, 0x1D64C, 0x1D64D,
+            0x1D64E, 0x1D64F, 0x1D650, 0x1D651, 0x1D652, 0x1D653, 0x1D654, 0x1D655, 0x1D656, 0x1D657,
+            0x1D658, 0x1D659, 0x1D65A, 0x1D65B, 0x1D65C, 0x1D65D, 0x1D65E, 0x1D65F, 0x1D660, 0x1D661,
+            0x1D662, 0x1D663, 0x1D664, 0x1D665, 0x1D666, 0x1D667, 0x1D668, 0x1D669, 0x1D66A, 0x1D66B,
+            0x1D66C, 0x1D66D, 0x1D66E, 0x1D66F, 0x1D670, 0x1D671, 0x1D672, 0x1D673, 0x1D674, 0x1D675,
+            0x1D676, 0x1D677, 0x1D678, 0x1D679, 0x1D67A, 0x1D67B, 0x1D67C, 0x1D67D, 0x1D67E, 0x1D67F,
+            0x1D680, 0x1D681, 0x1D682, 0x1D683, 0x1D684, 0x1D685, 0x1D686, 0x1D687, 0x1D688, 0x1D689,
+            0x1D68A, 0x1D68B, 0x1D68C, 0x1D68D, 0x1D68E, 0x1D68F, 0x1D690, 0x1D691, 0x1D692, 0x1D693,
+            0x1D694, 0x1D695, 0x1D696, 0x1D697, 0x1D698, 0x1D699, 0x1D69A, 0x1D69B, 0x1D69C, 0x1D69D,
+            0x1D69E, 0x1D69F, 0x1D6A0, 0x1D6A1, 0x1D6A2, 0x1D6A3, 0x1D6A4, 0x1D6A5, 0x1D6A8, 0x1D6AB,
+            0x1D6AD, 0x1D6AE, 0x1D6B1, 0x1D6B3, 0x1D6B8, 0x1D6B9, 0x1D6BA, 0x1D6BB, 0x1D6C0, 0x1D6C1,
+            0x1D6C2, 0x1D6C5, 0x1D6C7, 0x1D6C8, 0x1D6CB, 0x1D6CD, 0x1D6D2, 0x1D6D3, 0x1D6D4, 0x1D6D5,
+            0x1D6DA, 0x1D6DB, 0x1D6DC, 0x1D6DD, 0x1D6DE, 0x1D6DF, 0x1D6E0, 0x1D6E1, 0x1D6E2, 0x1D6E5,
+            0x1D6E7, 0x1D6E8, 0x1D6EB, 0x1D6ED, 0x1D6F2, 0x1D6F3, 0x1D6F4, 0x1D6F5, 0x1D6FA, 0x1D6FB,
+            0x1D6FC, 0x1D6FF, 0x1D701, 0x1D702, 0x1D705, 0x1D707, 0x1D70C, 0x1D70D, 0x1D70E, 0x1D70F,
+            0x1D714, 0x1D715, 0x1D716, 0x1D717, 0x1D718, 0x1D719, 0x1D71A, 0x1D71B, 0x1D71C, 0x1D71F,
+            0x1D721, 0x1D722, 0x1D725, 0x1D727, 0x1D72C, 0x1D72D, 0x1D72E, 0x1D72F, 0x1D734, 0x1D735,
+            0x1D736, 0x1D739, 0x1D73B, 0x1D73C, 0x1D73F, 0x1D741, 0x1D746, 0x1D747, 0x1D748, 0x1D749,
+            0x1D74E, 0x1D74F, 0x1D750, 0x1D751, 0x1D752, 0x1D753, 0x1D754, 0x1D755, 0x1D756, 0x1D759,
+            0x1D75B, 0x1D75C, 0x1D75F, 0x1D761, 0x1D766, 0x1D767, 0x1D768, 0x1D769, 0x1D76E, 0x1D76F,
+            0x1D770, 0x1D773, 0x1D775, 0x1D776, 0x1D779, 0x1D77B, 0x1D780, 0x1D781, 0x1D782, 0x1D783,
+            0x1D788, 0x1D789, 0x1D78A, 0x1D78B, 0x1D78C, 0x1D78D, 0x1D78E, 0x1D78F, 0x1D790, 0x1D793,
+            0x1D795, 0x1D796, 0x1D799, 0x1D79B, 0x1D7A0, 0x1D7A1, 0x1D7A2, 0x1D7A3, 0x1D7A8, 0x1D7A9,
+            0x1D7AA, 0x1D7AD, 0x1D7AF, 0x1D7B0, 0x1D7B3, 0x1D7B5, 0x1D7BA, 0x1D7BB, 0x1D7BC, 0x1D7BD,
+            0x1D7C2, 0x1D7C3, 0x1D7C4, 0x1D7C5, 0x1D7C6, 0x1D7C7, 0x1D7C8, 0x1D7C9, 0x1D7CA, 0x1D7CB,
+            0x1D7CE, 0x1D7D8, 0x1D7E2, 0x1D7EC, 0x1D7F6, 0x1D800, 0x1D900, 0x1DA00, 0x1DA01, 0x1DA02,
+            0x1DA03, 0x1DA04, 0x1DA05, 0x1DA06, 0x1DA07, 0x1DA08, 0x1DA09, 0x1DA0A, 0x1DA0B, 0x1DA0C,
+            0x1DA0D, 0x1DA0E, 0x1DA0F, 0x1DA10, 0x1DA11, 0x1DA12, 0x1DA13, 0x1DA14, 0x1DA15, 0x1DA16,
+            0x1DA17, 0x1DA18, 0x1DA19, 0x1DA1A, 0x1DA1B, 0x1DA1C, 0x1DA1D, 0x1DA1E, 0x1DA1F, 0x1DA20,
+            0x1DA21, 0x1DA22, 0x1DA23, 0x1DA24, 0x1DA25, 0x1DA26, 0x1DA27, 0x1DA28, 0x1DA29, 0x1DA2A,
+            0x1DA2B, 0x1DA2C, 0x1DA2D, 0x1DA2E, 0x1DA2F, 0x1DA30, 0x1DA31, 0x1DA32, 0x1DA33, 0x1DA34,
+            0x1DA35, 0x1DA36, 0x1DA37, 0x1DA3B, 0x1DA3C, 0x1DA3D, 0x1DA3E, 0x1DA3F, 0x1DA40, 0x1DA41,
+            0x1DA42, 0x1DA43, 0x1DA44, 0x1DA45, 0x1DA46, 0x1DA47, 0x1DA48, 0x1DA49, 0x1DA4A, 0x1DA4B,
+            0x1DA4C, 0x1DA4D, 0x1DA4E, 0x1DA4F, 0x1DA50, 0x1DA51, 0x1DA52, 0x1DA53, 0x1DA54, 0x1DA55,
+            0x1DA56, 0x1DA57, 0x1DA58, 0x1DA59, 0x1DA5A, 0x1DA5B, 0x1DA5C, 0x1DA5D, 0x1DA5E, 0x1DA5F,
+            0x1DA60, 0x1DA61, 0x1DA62, 0x1DA63, 0x1DA64, 0x1DA65, 0x1DA66, 0x1DA67, 0x1DA68, 0x1DA69,
+            0x1DA6A, 0x1DA6B, 0x1DA6C, 0x1DA6D, 0x1DA75, 0x1DA76, 0x1DA84, 0x1DA85, 0x1DA87, 0x1DA9B,
+            0x1DA9C, 0x1DA9D, 0x1DA9E, 0x1DA9F, 0x1DAA1, 0x1DAA2, 0x1DAA3, 0x1DAA4, 0x1DAA5, 0x1DAA6,
+            0x1DAA7, 0x1DAA8, 0x1DAA9, 0x1DAAA, 0x1DAAB, 0x1DAAC, 0x1DAAD, 0x1DAAE, 0x1DAAF, 0x1E000,
+            0x1E008, 0x1E01B, 0x1E023, 0x1E026, 0x1E100, 0x1E130, 0x1E131, 0x1E132, 0x1E133, 0x1E134,
+            0x1E135, 0x1E136, 0x1E137, 0x1E13C, 0x1E140, 0x1E14E, 0x1E14F, 0x1E2C0, 0x1E2EC, 0x1E2ED,
+            0x1E2EE, 0x1E2EF, 0x1E2F0, 0x1E2FF, 0x1E800, 0x1E8C7, 0x1E8D0, 0x1E8D1, 0x1E8D2, 0x1E8D3,
+            0x1E8D4, 0x1E8D5, 0x1E8D6, 0x1E900, 0x1E922, 0x1E944, 0x1E945, 0x1E946, 0x1E947, 0x1E948,
+            0x1E949, 0x1E94A, 0x1E94B, 0x1E950, 0x1E95E, 0x1E95F, 0x1EC71, 0x1EC7A, 0x1ECA3, 0x1ECAC,
+            0x1ECAD, 0x1ECB0, 0x1ECB1, 0x1ECB2, 0x1ECB3, 0x1ED01, 0x1ED0A, 0x1ED2E, 0x1ED2F, 0x1ED30,
+            0x1ED31, 0x1ED32, 0x1ED33, 0x1ED34, 0x1ED35, 0x1ED36, 0x1ED37, 0x1EE00, 0x1EE01, 0x1EE02,
+            0x1EE03, 0x1EE05, 0x1EE06, 0x1EE07, 0x1EE08, 0x1EE09, 0x1EE0A, 0x1EE0B, 0x1EE0C, 0x1EE0D,
+            0x1EE0E, 0x1EE0F, 0x1EE10, 0x1EE11, 0x1EE12, 0x1EE13, 0x1EE14, 0x1EE15, 0x1EE17, 0x1EE18,
+            0x1EE19, 0x1EE1A, 0x1EE1B, 0x1EE1C, 0x1EE1D, 0x1EE1E, 0x1EE1F, 0x1EE21, 0x1EE22, 0x1EE24,
+            0x1EE27, 0x1EE29, 0x1EE2A, 0x1EE2B, 0x1EE2C, 0x1EE2D, 0x1EE2E, 0x1EE2F, 0x1EE30, 0x1EE31,
+            0x1EE32, 0x1EE34, 0x1EE35, 0x1EE37, 0x1EE39, 0x1EE3B, 0x1EE42, 0x1EE47, 0x1EE49, 0x1EE4B,
+            0x1EE4D, 0x1EE4E, 0x1EE4F, 0x1EE51, 0x1EE52, 0x1EE54, 0x1EE57, 0x1EE59, 0x1EE5B, 0x1EE5D,
+            0x1EE5F, 0x1EE61, 0x1EE62, 0x1EE64, 0x1EE67, 0x1EE68, 0x1EE69, 0x1EE6A, 0x1EE6C, 0x1EE6D,
+            0x1EE6E, 0x1EE6F, 0x1EE70, 0x1EE71, 0x1EE72, 0x1EE74, 0x1EE75, 0x1EE77, 0x1EE79, 0x1EE7A,
+            0x1EE7B, 0x1EE7C, 0x1EE7E, 0x1EE80, 0x1EE81, 0x1EE82, 0x1EE83, 0x1EE84, 0x1EE85, 0x1EE86,
+            0x1EE87, 0x1EE88, 0x1EE89, 0x1EE8B, 0x1EE8C, 0x1EE8D, 0x1EE8E, 0x1EE8F, 0x1EE90, 0x1EE91,
+            0x1EE92, 0x1EE93, 0x1EE94, 0x1EE95, 0x1EE97, 0x1EE98, 0x1EE99, 0x1EE9A, 0x1EE9B, 0x1EEA1,
+            0x1EEA2, 0x1EEA3, 0x1EEA5, 0x1EEA6, 0x1EEA7, 0x1EEA8, 0x1EEA9, 0x1EEAB, 0x1EEAC, 0x1EEAD,
+            0x1EEAE, 0x1EEAF, 0x1EEB0, 0x1EEB1, 0x1EEB2, 0x1EEB3, 0x1EEB4, 0x1EEB5, 0x1EEB7, 0x1EEB8,
+            0x1EEB9, 0x1EEBA, 0x1EEBB, 0x1EEF0, 0x1F000, 0x1F030, 0x1F0A0, 0x1F0B1, 0x1F0C1, 0x1F0D1,
+            0x1F100, 0x1F101, 0x1F102, 0x1F103, 0x1F104, 0x1F105, 0x1F106, 0x1F107, 0x1F108, 0x1F109,
+            0x1F10A, 0x1F10B, 0x1F10C, 0x1F10D, 0x1F110, 0x1F111, 0x1F112, 0x1F113, 0x1F114, 0x1F115,
+            0x1F116, 0x1F117, 0x1F118, 0x1F119, 0x1F11A, 0x1F11B, 0x1F11C, 0x1F11D, 0x1F11E, 0x1F11F,
+            0x1F120, 0x1F121, 0x1F122, 0x1F123, 0x1F124, 0x1F125, 0x1F126, 0x1F127, 0x1F128, 0x1F129,
+            0x1F12A, 0x1F12B, 0x1F12C, 0x1F12D, 0x1F12E, 0x1F12F, 0x1F130, 0x1F131, 0x1F132, 0x1F133,
+            0x1F134, 0x1F135, 0x1F136, 0x1F137, 0x1F138, 0x1F139, 0x1F13A, 0x1F13B, 0x1F13C, 0x1F13D,
+            0x1F13E, 0x1F13F, 0x1F140, 0x1F141, 0x1F142, 0x1F143, 0x1F144, 0x1F145, 0x1F146, 0x1F147,
+            0x1F148, 0x1F149, 0x1F14A, 0x1F14B, 0x1F14C, 0x1F14D, 0x1F14E, 0x1F14F, 0x1F150, 0x1F151,
+            0x1F152, 0x1F153, 0x1F154, 0x1F155, 0x1F156, 0x1F157, 0x1F158, 0x1F159, 0x1F15A, 0x1F15B,
+            0x1F15C, 0x1F15D, 0x1F15E, 0x1F15F, 0x1F160, 0x1F161, 0x1F162, 0x1F163, 0x1F164, 0x1F165,
+            0x1F166, 0x1F167, 0x1F168, 0x1F169, 0x1F16A, 0x1F16B, 0x1F16C, 0x1F16D, 0x1F170, 0x1F171,
+            0x1F172, 0x1F173, 0x1F174, 0x1F175, 0x1F176, 0x1F177, 0x1F178, 0x1F179, 0x1F17A, 0x1F17B,
+            0x1F17C, 0x1F17D, 0x1F17E, 0x1F17F, 0x1F180, 0x1F181, 0x1F182, 0x1F183, 0x1F184, 0x1F185,
+            0x1F186, 0x1F187, 0x1F188, 0x1F189, 0x1F18A, 0x1F18B, 0x1F18C, 0x1F18D, 0x1F18E, 0x1F18F,
+            0x1F190, 0x1F191, 0x1F192, 0x1F193, 0x1F194, 0x1F195, 0x1F196, 0x1F197, 0x1F198, 0x1F199,
+            0x1F19A, 0x1F19B, 0x1F19C, 0x1F19D, 0x1F19E, 0x1F19F, 0x1F1A0, 0x1F1A1, 0x1F1A2, 0x1F1A3,
+            0x1F1A4, 0x1F1A5, 0x1F1A6, 0x1F1A7, 0x1F1A8, 0x1F1A9, 0x1F1AA, 0x1F1AB, 0x1F1AC, 0x1F1AD,
+            0x1F1E6, 0x1F200, 0x1F201, 0x1F202, 0x1F210, 0x1F211, 0x1F212, 0x1F213, 0x1F214, 0x1F215,
+            0x1F216, 0x1F217, 0x1F218, 0x1F219, 0x1F21A, 0x1F21B, 0x1F21C, 0x1F21D, 0x1F21E, 0x1F21F,
+            0x1F220, 0x1F221, 0x1F222, 0x1F223, 0x1F224, 0x1F225, 0x1F226, 0x1F227, 0x1F228, 0x1F229,
+            0x1F22A, 0x1F22B, 0x1F22C, 0x1F22D, 0x1F22E, 0x1F22F, 0x1F230, 0x1F231, 0x1F232, 0x1F233,
+            0x1F234, 0x1F235, 0x1F236, 0x1F237, 0x1F238, 0x1F239, 0x1F23A, 0x1F23B, 0x1F240, 0x1F241,
+            0x1F242, 0x1F243, 0x1F244, 0x1F245, 0x1F246, 0x1F247, 0x1F248, 0x1F250, 0x1F251, 0x1F260,
+            0x1F300, 0x1F400, 0x1F500, 0x1F600, 0x1F6E0, 0x1F6F0, 0x1F700, 0x1F780, 0x1F7E0, 0x1F800,
+            0x1F810, 0x1F850, 0x1F860, 0x1F890, 0x1F8B0, 0x1F900, 0x1F97A, 0x1F9CD, 0x1FA00, 0x1FA60,
+            0x1FA70, 0x1FA78, 0x1FA80, 0x1FA90, 0x1FAB0, 0x1FAC0, 0x1FAD0, 0x1FB00, 0x1FB94, 0x1FBF0,
+            0x2F800, 0x2F801, 0x2F802, 0x2F803, 0x2F804, 0x2F805, 0x2F806, 0x2F807, 0x2F808, 0x2F809,
+            0x2F80A, 0x2F80B, 0x2F80C, 0x2F80D, 0x2F80E, 0x2F80F, 0x2F810, 0x2F811, 0x2F812, 0x2F813,
+            0x2F814, 0x2F815, 0x2F816, 0x2F817, 0x2F818, 0x2F819, 0x2F81A, 0x2F81B, 0x2F81C, 0x2F81D,
+            0x2F81E, 0x2F81F, 0x2F820, 0x2F821, 0x2F822, 0x2F823, 0x2F824, 0x2F825, 0x2F826, 0x2F827,
+            0x2F828, 0x2F829, 0x2F82A, 0x2F82B, 0x2F82C, 0x2F82D, 0x2F82E, 0x2F82F, 0x2F830, 0x2F831,
+            0x2F832, 0x2F833, 0x2F834, 0x2F835, 0x2F836, 0x2F837, 0x2F838, 0x2F839, 0x2F83A, 0x2F83B,
+            0x2F83C, 0x2F83D, 0x2F83E, 0x2F83F, 0x2F840, 0x2F841, 0x2F842, 0x2F843, 0x2F844, 0x2F845,
+            0x2F846, 0x2F847, 0x2F848, 0x2F849, 0x2F84A, 0x2F84B, 0x2F84C, 0x2F84D, 0x2F84E, 0x2F84F,
+            0x2F850, 0x2F851, 0x2F852, 0x2F853, 0x2F854, 0x2F855, 0x2F856, 0x2F857, 0x2F858, 0x2F859,
+            0x2F85A, 0x2F85B, 0x2F85C, 0x2F85D, 0x2F85E, 0x2F85F, 0x2F860, 0x2F861, 0x2F862, 0x2F863,
+            0x2F864, 0x2F865, 0x2F866, 0x2F867, 0x2F868, 0x2F869, 0x2F86A, 0x2F86B, 0x2F86C, 0x2F86D,
+            0x2F86E, 0x2F86F, 0x2F870, 0x2F871, 0x2F872, 0x2F873, 0x2F874, 0x2F875, 0x2F876, 0x2F877,
+            0x2F878, 0x2F879, 0x2F87A, 0x2F87B, 0x2F87C, 0x2F87D, 0x2F87E, 0x2F87F, 0x2F880, 0x2F881,
+            0x2F882, 0x2F883, 0x2F884, 0x2F885, 0x2F886, 0x2F887, 0x2F888, 0x2F889, 0x2F88A, 0x2F88B,
+            0x2F88C, 0x2F88D, 0x2F88E, 0x2F88F, 0x2F890, 0x2F891, 0x2F892, 0x2F893, 0x2F894, 0x2F895,
+            0x2F896, 0x2F897, 0x2F898, 0x2F899, 0x2F89A, 0x2F89B, 0x2F89C, 0x2F89D, 0x2F89E, 0x2F89F,
+            0x2F8A0, 0x2F8A1, 0x2F8A2, 0x2F8A3, 0x2F8A4, 0x2F8A5, 0x2F8A6, 0x2F8A7, 0x2F8A8, 0x2F8A9,
+            0x2F8AA, 0x2F8AB, 0x2F8AC, 0x2F8AD, 0x2F8AE, 0x2F8AF, 0x2F8B0, 0x2F8B1, 0x2F8B2, 0x2F8B3,
+            0x2F8B4, 0x2F8B5, 0x2F8B6, 0x2F8B7, 0x2F8B8, 0x2F8B9, 0x2F8BA, 0x2F8BB, 0x2F8BC, 0x2F8BD,
+            0x2F8BE, 0x2F8BF, 0x2F8C0, 0x2F8C1, 0x2F8C2, 0x2F8C3, 0x2F8C4, 0x2F8C5, 0x2F8C6, 0x2F8C7,
+            0x2F8C8, 0x2F8C9, 0x2F8CA, 0x2F8CB, 0x2F8CC, 0x2F8CD, 0x2F8CE, 0x2F8CF, 0x2F8D0, 0x2F8D1,
+            0x2F8D2, 0x2F8D3, 0x2F8D4, 0x2F8D5, 0x2F8D6, 0x2F8D7, 0x2F8D8, 0x2F8D9, 0x2F8DA, 0x2F8DB,
+            0x2F8DC, 0x2F8DD, 0x2F8DE, 0x2F8DF, 0x2F8E0, 0x2F8E1, 0x2F8E2, 0x2F8E3, 0x2F8E4, 0x2F8E5,
+            0x2F8E6, 0x2F8E7, 0x2F8E8, 0x2F8E9, 0x2F8EA, 0x2F8EB, 0x2F8EC, 0x2F8ED, 0x2F8EE, 0x2F8EF,
+            0x2F8F0, 0x2F8F1, 0x2F8F2, 0x2F8F3, 0x2F8F4, 0x2F8F5, 0x2F8F6, 0x2F8F7, 0x2F8F8, 0x2F8F9,
+            0x2F8FA, 0x2F8FB, 0x2F8FC, 0x2F8FD, 0x2F8FE, 0x2F8FF, 0x2F900, 0x2F901, 0x2F902, 0x2F903,
+            0x2F904, 0x2F905, 0x2F906, 0x2F907, 0x2F908, 0x2F909, 0x2F90A, 0x2F90B, 0x2F90C, 0x2F90D,
+            0x2F90E, 0x2F90F, 0x2F910, 0x2F911, 0x2F912, 0x2F913, 0x2F914, 0x2F915, 0x2F916, 0x2F917,
+            0x2F918, 0x2F919, 0x2F91A, 0x2F91B, 0x2F91C, 0x2F91D, 0x2F91E, 0x2F91F, 0x2F920, 0x2F921,
+            0x2F922, 0x2F923, 0x2F924, 0x2F925, 0x2F926, 0x2F927, 0x2F928, 0x2F929, 0x2F92A, 0x2F92B,
+            0x2F92C, 0x2F92D, 0x2F92E, 0x2F92F, 0x2F930, 0x2F931, 0x2F932, 0x2F933, 0x2F934, 0x2F935,
+            0x2F936, 0x2F937, 0x2F938, 0x2F939, 0x2F93A, 0x2F93B, 0x2F93C, 0x2F93D, 0x2F93E, 0x2F93F,
+            0x2F940, 0x2F941, 0x2F942, 0x2F943, 0x2F944, 0x2F945, 0x2F946, 0x2F947, 0x2F948, 0x2F949,
+            0x2F94A, 0x2F94B, 0x2F94C, 0x2F94D, 0x2F94E, 0x2F94F, 0x2F950, 0x2F951, 0x2F952, 0x2F953,
+            0x2F954, 0x2F955, 0x2F956, 0x2F957, 0x2F958, 0x2F959, 0x2F95A, 0x2F95B, 0x2F95C, 0x2F95D,
+            0x2F95E, 0x2F95F, 0x2F960, 0x2F961, 0x2F962, 0x2F963, 0x2F964, 0x2F965, 0x2F966, 0x2F967,
+            0x2F968, 0x2F969, 0x2F96A, 0x2F96B, 0x2F96C, 0x2F96D, 0x2F96E, 0x2F96F, 0x2F970, 0x2F971,
+            0x2F972, 0x2F973, 0x2F974, 0x2F975, 0x2F976, 0x2F977, 0x2F978, 0x2F979, 0x2F97A, 0x2F97B,
+            0x2F97C, 0x2F97D, 0x2F97E, 0x2F97F, 0x2F980, 0x2F981, 0x2F982, 0x2F983, 0x2F984, 0x2F985,
+            0x2F986, 0x2F987, 0x2F988, 0x2F989, 0x2F98A, 0x2F98B, 0x2F98C, 0x2F98D, 0x2F98E, 0x2F98F,
+            0x2F990, 0x2F991, 0x2F992, 0x2F993, 0x2F994, 0x2F995, 0x2F996, 0x2F997, 0x2F998, 0x2F999,
+            0x2F99A, 0x2F99B, 0x2F99C, 0x2F99D, 0x2F99E, 0x2F99F, 0x2F9A0, 0x2F9A1, 0x2F9A2, 0x2F9A3,
+            0x2F9A4, 0x2F9A5, 0x2F9A6, 0x2F9A7, 0x2F9A8, 0x2F9A9, 0x2F9AA, 0x2F9AB, 0x2F9AC, 0x2F9AD,
+            0x2F9AE, 0x2F9AF, 0x2F9B0, 0x2F9B1, 0x2F9B2, 0x2F9B3, 0x2F9B4, 0x2F9B5, 0x2F9B6, 0x2F9B7,
+            0x2F9B8, 0x2F9B9, 0x2F9BA, 0x2F9BB, 0x2F9BC, 0x2F9BD, 0x2F9BE, 0x2F9BF, 0x2F9C0, 0x2F9C1,
+            0x2F9C2, 0x2F9C3, 0x2F9C4, 0x2F9C5, 0x2F9C6, 0x2F9C7, 0x2F9C8, 0x2F9C9, 0x2F9CA, 0x2F9CB,
+            0x2F9CC, 0x2F9CD, 0x2F9CE, 0x2F9CF, 0x2F9D0, 0x2F9D1, 0x2F9D2, 0x2F9D3, 0x2F9D4, 0x2F9D5,
+            0x2F9D6, 0x2F9D7, 0x2F9D8, 0x2F9D9, 0x2F9DA, 0x2F9DB, 0x2F9DC, 0x2F9DD, 0x2F9DE, 0x2F9DF,
+            0x2F9E0, 0x2F9E1, 0x2F9E2, 0x2F9E3, 0x2F9E4, 0x2F9E5, 0x2F9E6, 0x2F9E7, 0x2F9E8, 0x2F9E9,
+            0x2F9EA, 0x2F9EB, 0x2F9EC, 0x2F9ED, 0x2F9EE, 0x2F9EF, 0x2F9F0, 0x2F9F1, 0x2F9F2, 0x2F9F3,
+            0x2F9F4, 0x2F9F5, 0x2F9F6, 0x2F9F7, 0x2F9F8, 0x2F9F9, 0x2F9FA, 0x2F9FB, 0x2F9FC, 0x2F9FD,
+            0x2F9FE, 0x2F9FF, 0x2FA00, 0x2FA01, 0x2FA02, 0x2FA03, 0x2FA04, 0x2FA05, 0x2FA06, 0x2FA07,
+            0x2FA08, 0x2FA09, 0x2FA0A, 0x2FA0B, 0x2FA0C, 0x2FA0D, 0x2FA0E, 0x2FA0F, 0x2FA10, 0x2FA11,
+            0x2FA12, 0x2FA13, 0x2FA14, 0x2FA15, 0x2FA16, 0x2FA17, 0x2FA18, 0x2FA19, 0x2FA1A, 0x2FA1B,
+            0x2FA1C, 0x2FA1D, 0xE0001, 0xE0020, 0xE0021, 0xE0022, 0xE0023, 0xE0024, 0xE0025, 0xE0026,
+            0xE0027, 0xE0028, 0xE0029, 0xE002A, 0xE002B, 0xE002C, 0xE002D, 0xE002E, 0xE002F, 0xE0030,
+            0xE0031, 0xE0032, 0xE0033, 0xE0034, 0xE0035, 0xE0036, 0xE0037, 0xE0038, 0xE0039, 0xE003A,
+            0xE003B, 0xE003C, 0xE003D, 0xE003E, 0xE003F, 0xE0040, 0xE0041, 0xE0042, 0xE0043, 0xE0044,
+            0xE0045, 0xE0046, 0xE0047, 0xE0048, 0xE0049, 0xE004A, 0xE004B, 0xE004C, 0xE004D, 0xE004E,
+            0xE004F, 0xE0050, 0xE0051, 0xE0052, 0xE0053, 0xE0054, 0xE0055, 0xE0056, 0xE0057, 0xE0058,
+            0xE0059, 0xE005A, 0xE005B, 0xE005C, 0xE005D, 0xE005E, 0xE005F, 0xE0060, 0xE0061, 0xE0062,
+            0xE0063, 0xE0064, 0xE0065, 0xE0066, 0xE0067, 0xE0068, 0xE0069, 0xE006A, 0xE006B, 0xE006C,
+            0xE006D, 0xE006E, 0xE006F, 0xE0070, 0xE0071, 0xE0072, 0xE0073, 0xE0074, 0xE0075, 0xE0076,
+            0xE0077, 0xE0078, 0xE0079, 0xE007A, 0xE007B, 0xE007C, 0xE007D, 0xE007E, 0xE007F, 0xE0100,
+            0xE0101, 0xE0102, 0xE0103, 0xE0104, 0xE0105, 0xE0106, 0xE0107, 0xE0108, 0xE0109, 0xE010A,
+            0xE010B, 0xE010C, 0xE010D, 0xE010E, 0xE010F, 0xE0110, 0xE0111, 0xE0112, 0xE0113, 0xE0114,
+            0xE0115, 0xE0116, 0xE0117, 0xE0118, 0xE0119, 0xE011A, 0xE011B, 0xE011C, 0xE011D, 0xE011E,
+            0xE011F, 0xE0120, 0xE0121, 0xE0122, 0xE0123, 0xE0124, 0xE0125, 0xE0126, 0xE0127, 0xE0128,
+            0xE0129, 0xE012A, 0xE012B, 0xE012C, 0xE012D, 0xE012E, 0xE012F, 0xE0130, 0xE0131, 0xE0132,
+            0xE0133, 0xE0134, 0xE0135, 0xE0136, 0xE0137, 0xE0138, 0xE0139, 0xE013A, 0xE013B, 0xE013C,
+            0xE013D, 0xE013E, 0xE013F, 0xE0140, 0xE0141, 0xE0142, 0xE0143, 0xE0144, 0xE0145, 0xE0146,
+            0xE0147, 0xE0148, 0xE0149, 0xE014A, 0xE014B, 0xE014C, 0xE014D, 0xE014E, 0xE014F, 0xE0150,
+            0xE0151, 0xE0152, 0xE0153, 0xE0154, 0xE0155, 0xE0156, 0xE0157, 0xE0158, 0xE0159, 0xE015A,
+            0xE015B, 0xE015C, 0xE015D, 0xE015E, 0xE015F, 0xE0160, 0xE0161, 0xE0162, 0xE0163, 0xE0164,
+            0xE0165, 0xE0166, 0xE0167, 0xE0168, 0xE0169, 0xE016A, 0xE016B, 0xE016C, 0xE016D, 0xE016E,
+            0xE016F, 0xE0170, 0xE0171, 0xE0172, 0xE0173, 0xE0174, 0xE0175, 0xE0176, 0xE0177, 0xE0178,
+            0xE0179, 0xE017A, 0xE017B, 0xE017C, 0xE017D, 0xE017E, 0xE017F, 0xE0180, 0xE0181, 0xE0182,
+            0xE0183, 0xE0184, 0xE0185, 0xE0186, 0xE0187, 0xE0188, 0xE0189, 0xE018A, 0xE018B, 0xE018C,
+            0xE018D, 0xE018E, 0xE018F, 0xE0190, 0xE0191, 0xE0192, 0xE0193, 0xE0194, 0xE0195, 0xE0196,
+            0xE0197, 0xE0198, 0xE0199, 0xE019A, 0xE019B, 0xE019C, 0xE019D, 0xE019E, 0xE019F, 0xE01A0,
+            0xE01A1, 0xE01A2, 0xE01A3, 0xE01A4, 0xE01A5, 0xE01A6, 0xE01A7, 0xE01A8, 0xE01A9, 0xE01AA,
+            0xE01AB, 0xE01AC, 0xE01AD, 0xE01AE, 0xE01AF, 0xE01B0, 0xE01B1, 0xE01B2, 0xE01B3, 0xE01B4,
+            0xE01B5, 0xE01B6, 0xE01B7, 0xE01B8, 0xE01B9, 0xE01BA, 0xE01BB, 0xE01BC, 0xE01BD, 0xE01BE,
+            0xE01BF, 0xE01C0, 0xE01C1, 0xE01C2, 0xE01C3, 0xE01C4, 0xE01C5, 0xE01C6, 0xE01C7, 0xE01C8,
+            0xE01C9, 0xE01CA, 0xE01CB, 0xE01CC, 0xE01CD, 0xE01CE, 0xE01CF, 0xE01D0, 0xE01D1, 0xE01D2,
+            0xE01D3, 0xE01D4, 0xE01D5, 0xE01D6, 0xE01D7, 0xE01D8, 0xE01D9, 0xE01DA, 0xE01DB, 0xE01DC,
+            0xE01DD, 0xE01DE, 0xE01DF, 0xE01E0, 0xE01E1, 0xE01E2, 0xE01E3, 0xE01E4, 0xE01E5, 0xE01E6,
+            0xE01E7, 0xE01E8, 0xE01E9, 0xE01EA, 0xE01EB, 0xE01EC, 0xE01ED, 0xE01EE, 0xE01EF
+        };
+
+        const std::uint32_t _s_ducet_run_info[] = {
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00810001,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010002, 0x00010003,
+            0x00010004, 0x00010005, 0x00010006, 0x00010007, 0x00010008, 0x00010009, 0x0021000A, 0x0001000B, 0x0001000C, 0x0001000D,
+            0x0001000E, 0x0001000F, 0x00010010, 0x01210011, 0x00010012, 0x00010013, 0x00410014, 0x00010015, 0x00010016, 0x00010017,
+            0x00010018, 0x00010019, 0x0001001A, 0x0001001B, 0x0001001C, 0x0001001D, 0x0001001E, 0x0001001F, 0x00010020, 0x00010021,
+            0x20010022, 0x00010023, 0x00010024, 0x00010025, 0x00010026, 0x00010027, 0x00010028, 0x00010029, 0x0001002A, 0x0001002B,
+            0x0001002C, 0x0001002D, 0x0001002E, 0x0001002F, 0x00010030, 0x00010031, 0x00010032, 0x00010033, 0x00010034, 0x00010035,
+            0x00010036, 0x00010037, 0x00010038, 0x00010039, 0x0001003A, 0x0001003B, 0x0001003C, 0x0001003D, 0x0001003E, 0x0001003F,
+            0x00010040, 0x00010041, 0x20010042, 0x00010043, 0x00010044, 0x00010045, 0x00010046, 0x00010047, 0x00010048, 0x00010049,
+            0x0001004A, 0x0001004B, 0x0001004C, 0x0001004D, 0x0001004E, 0x0001004F, 0x00010050, 0x00010051, 0x00010052, 0x00010053,
+            0x00010054, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010055, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010056, 0x00010057, 0x00010058, 0x00010059, 0x0001005A, 0x0001005B,
+            0x0001005C, 0x0001005D, 0x0001005E, 0x0001005F, 0x00010060, 0x00010061, 0x00010062, 0x00010000, 0x00010063, 0x00010064,
+            0x00010065, 0x00010066, 0x00210067, 0x00010068, 0x00010069, 0x0001006A, 0x0001006B, 0x0001006C, 0x0001006D, 0x0001006E,
+            0x0001006F, 0x00030070, 0x00030073, 0x00030076, 0x00010079, 0x0002007A, 0x0002007C, 0x0002007E, 0x00020080, 0x00020082,
+            0x00020084, 0x00030086, 0x00020089, 0x0002008B, 0x0002008D, 0x0002008F, 0x00020091, 0x00020093, 0x00020095, 0x00020097,
+            0x00020099, 0x0002009B, 0x0002009D, 0x0002009F, 0x000200A1, 0x000200A3, 0x000200A5, 0x000200A7, 0x000100A9, 0x000200AA,
+            0x000200AC, 0x000200AE, 0x000200B0, 0x000200B2, 0x000200B4, 0x000100B6, 0x000300B7, 0x000200BA, 0x000200BC, 0x000200BE,
+            0x000200C0, 0x000200C2, 0x000200C4, 0x000300C6, 0x000200C9, 0x000200CB, 0x000200CD, 0x000200CF, 0x000200D1, 0x000200D3,
+            0x000200D5, 0x000200D7, 0x000200D9, 0x000200DB, 0x000200DD, 0x000200DF, 0x000200E1, 0x000200E3, 0x000200E5, 0x000200E7,
+            0x000100E9, 0x000200EA, 0x000200EC, 0x000200EE, 0x000200F0, 0x000200F2, 0x000200F4, 0x000100F6, 0x000200F7, 0x000200F9,
+            0x000200FB, 0x000200FD, 0x000200FF, 0x00020101, 0x00020103, 0x00020105, 0x00020107, 0x00020109, 0x0002010B, 0x0002010D,
+            0x0002010F, 0x00020111, 0x00020113, 0x00020115, 0x00020117, 0x00020119, 0x0002011B, 0x0002011D, 0x0002011F, 0x00020121,
+            0x00020123, 0x00020125, 0x00020127, 0x00020129, 0x0002012B, 0x0002012D, 0x0002012F, 0x00020131, 0x00020133, 0x00020135,
+            0x00020137, 0x00020139, 0x0002013B, 0x0002013D, 0x0002013F, 0x00020141, 0x00020143, 0x00020145, 0x00020147, 0x00020149,
+            0x0002014B, 0x0002014D, 0x0002014F, 0x00020151, 0x00020153, 0x00020155, 0x00020157, 0x00020159, 0x0001015B, 0x0002015C,
+            0x0002015E, 0x00020160, 0x00020162, 0x00020164, 0x00020166, 0x00010168, 0x00020169, 0x0002016B, 0x0002016D, 0x0002016F,
+            0x00020171, 0x00020173, 0x00020175, 0x00020177, 0x00020179, 0x0002017B, 0x0002017D, 0x0002017F, 0x00020181, 0x00020183,
+            0x00020185, 0x00020187, 0x00020189, 0x0001018B, 0x0001018C, 0x0002018D, 0x0002018F, 0x00020191, 0x00020193, 0x00020195,
+            0x00020197, 0x00030199, 0x0003019C, 0x0002019F, 0x000201A1, 0x000201A3, 0x000201A5, 0x000201A7, 0x000201A9, 0x000201AB,
+            0x000201AD, 0x000201AF, 0x000201B1, 0x000201B3, 0x000201B5, 0x000201B7, 0x000201B9, 0x000201BB, 0x000201BD, 0x000201BF,
+            0x000201C1, 0x000101C3, 0x000101C4, 0x000201C5, 0x000201C7, 0x000201C9, 0x000201CB, 0x000201CD, 0x000201CF, 0x000201D1,
+            0x000201D3, 0x000201D5, 0x000201D7, 0x000201D9, 0x000201DB, 0x000201DD, 0x000201DF, 0x000201E1, 0x000201E3, 0x000201E5,
+            0x000201E7, 0x000201E9, 0x000201EB, 0x000201ED, 0x000201EF, 0x000201F1, 0x000201F3, 0x000101F5, 0x000101F6, 0x000101F7,
+            0x000101F8, 0x000101F9, 0x000101FA, 0x000101FB, 0x000101FC, 0x000101FD, 0x000101FE, 0x000101FF, 0x00010200, 0x00010201,
+            0x00020202, 0x00010204, 0x00010205, 0x00010206, 0x00010207, 0x00010208, 0x00010209, 0x0001020A, 0x0001020B, 0x0001020C,
+            0x0001020D, 0x0001020E, 0x0001020F, 0x00010210, 0x00010211, 0x00010212, 0x00010213, 0x00010214, 0x00010215, 0x00020216,
+            0x00020218, 0x0001021A, 0x0001021B, 0x0001021C, 0x0001021D, 0x0001021E, 0x0001021F, 0x00010220, 0x00010221, 0x00010222,
+            0x00010223, 0x00010224, 0x00010225, 0x00010226, 0x00020227, 0x00020229, 0x0001022B, 0x0001022C, 0x0001022D, 0x0001022E,
+            0x0001022F, 0x00010230, 0x00010231, 0x00010232, 0x00010233, 0x00010234, 0x00010235, 0x00010236, 0x00010237, 0x00020238,
+            0x0001023A, 0x0001023B, 0x0001023C, 0x0001023D, 0x0001023E, 0x0003023F, 0x00030242, 0x00030245, 0x00020248, 0x0002024A,
+            0x0002024C, 0x0002024E, 0x00020250, 0x00020252, 0x00020254, 0x00020256, 0x00020258, 0x0002025A, 0x0002025C, 0x0002025E,
+            0x00020260, 0x00020262, 0x00030264, 0x00030267, 0x0003026A, 0x0003026D, 0x00030270, 0x00030273, 0x00030276, 0x00030279,
+            0x0001027C, 0x0003027D, 0x00030280, 0x00030283, 0x00030286, 0x00040289, 0x0004028D, 0x00010291, 0x00010292, 0x00020293,
+            0x00020295, 0x00020297, 0x00020299, 0x0002029B, 0x0002029D, 0x0003029F, 0x000302A2, 0x000202A5, 0x000202A7, 0x000202A9,
+            0x000202AB, 0x000202AD, 0x000202AF, 0x000202B1, 0x000202B3, 0x000102B5, 0x000102B6, 0x000202B7, 0x000202B9, 0x000302BB,
+            0x000302BE, 0x000402C1, 0x000402C5, 0x000302C9, 0x000302CC, 0x000202CF, 0x000202D1, 0x000202D3, 0x000202D5, 0x000202D7,
+            0x000202D9, 0x000202DB, 0x000202DD, 0x000202DF, 0x000202E1, 0x000202E3, 0x000202E5, 0x000202E7, 0x000202E9, 0x000202EB,
+            0x000202ED, 0x000202EF, 0x000202F1, 0x000202F3, 0x000202F5, 0x000202F7, 0x000202F9, 0x000202FB, 0x000202FD, 0x000202FF,
+            0x00020301, 0x00020303, 0x00020305, 0x00010307, 0x00010308, 0x00020309, 0x0002030B, 0x0001030D, 0x0001030E, 0x0001030F,
+            0x00010310, 0x00010311, 0x00010312, 0x00020313, 0x00020315, 0x00020317, 0x00020319, 0x0003031B, 0x0003031E, 0x00030321,
+            0x00030324, 0x00020327, 0x00020329, 0x0003032B, 0x0003032E, 0x00020331, 0x00020333, 0x00010335, 0x00010336, 0x00010337,
+            0x00010338, 0x00020339, 0x0002033B, 0x0001033D, 0x0001033E, 0x0001033F, 0x00010340, 0x00010341, 0x00010342, 0x00010343,
+            0x00010344, 0x00010345, 0x00010346, 0x00010347, 0x00010348, 0x00010349, 0x0001034A, 0x0001034B, 0x0001034C, 0x0001034D,
+            0x0001034E, 0x0001034F, 0x00010350, 0x00010351, 0x00010352, 0x00010353, 0x00010354, 0x00010355, 0x00010356, 0x00010357,
+            0x00010358, 0x00010359, 0x0001035A, 0x0001035B, 0x0001035C, 0x0001035D, 0x0001035E, 0x0001035F, 0x00010360, 0x00010361,
+            0x00010362, 0x00010363, 0x00010364, 0x00010365, 0x00010366, 0x00010367, 0x00010368, 0x00010369, 0x0001036A, 0x0001036B,
+            0x0001036C, 0x0001036D, 0x0001036E, 0x0001036F, 0x00010370, 0x00010371, 0x00010372, 0x00010373, 0x00010374, 0x00010375,
+            0x00010376, 0x00010377, 0x00010378, 0x00010379, 0x0001037A, 0x0001037B, 0x0001037C, 0x0001037D, 0x0001037E, 0x0001037F,
+            0x00010380, 0x00010381, 0x00010382, 0x00010383, 0x00010384, 0x00010385, 0x00010386, 0x00010387, 0x00010388, 0x00010389,
+            0x0001038A, 0x0001038B, 0x0001038C, 0x0001038D, 0x0001038E, 0x0001038F, 0x00010390, 0x00010391, 0x00010392, 0x00010393,
+            0x00010394, 0x00010395, 0x00010396, 0x00010397, 0x00010398, 0x00010399, 0x0001039A, 0x0001039B, 0x0001039C, 0x0001039D,
+            0x0001039E, 0x0001039F, 0x000103A0, 0x000103A1, 0x000103A2, 0x000103A3, 0x000103A4, 0x000103A5, 0x000202AF, 0x000203A6,
+            0x000203A8, 0x00020238, 0x000203AA, 0x000203AC, 0x000203AE, 0x000203B0, 0x000203B2, 0x000103B4, 0x000103B5, 0x000103B6,
+            0x000103B7, 0x000103B8, 0x000103B9, 0x000103BA, 0x000103BB, 0x000103BC, 0x000103BD, 0x000103BE, 0x000103BF, 0x000103C0,
+            0x000103C1, 0x000103C2, 0x000103C3, 0x000103C4, 0x000103C5, 0x000103C6, 0x000103C7, 0x000103C8, 0x000103C9, 0x01A103CA,
+            0x002103CB, 0x006103CC, 0x002103CD, 0x002103CE, 0x000103CF, 0x000103D0, 0x000103D1, 0x000103D2, 0x002103D3, 0x000103D4,
+            0x000103D5, 0x000103D6, 0x000103D7, 0x000103D8, 0x010103D9, 0x000103DA, 0x020103DB, 0x000103DC, 0x000103DD, 0x000103DE,
+            0x000103DF, 0x000103E0, 0x000103E1, 0x000103E2, 0x000103E3, 0x000103E4, 0x000103E5, 0x000103E6, 0x000103E7, 0x000103E8,
+            0x000103E9, 0x000103E9, 0x000103EA, 0x000103EB, 0x000103EC, 0x000103E9, 0x000103ED, 0x000103EE, 0x000103E9, 0x000103EF,
+            0x000103EF, 0x000103EF, 0x000103EF, 0x000103E9, 0x000103F0, 0x000103EF, 0x000103EF, 0x000103EF, 0x000103EF, 0x000103EF,
+            0x000103F1, 0x000103F2, 0x000103F3, 0x000103F4, 0x000103F5, 0x000103F6, 0x000103F7, 0x000103F8, 0x000103EF, 0x000103EF,
+            0x000103EF, 0x000103EF, 0x000103F9, 0x000103FA, 0x000103EF, 0x000103FB, 0x000103FC, 0x000103FD, 0x000103EF, 0x000103FE,
+            0x000103FF, 0x00010400, 0x00010400, 0x00010401, 0x00010402, 0x000103EF, 0x000103EF, 0x000103EF, 0x000103E9, 0x000103E9,
+            0x000103E9, 0x000103DC, 0x000103DD, 0x00010403, 0x000103ED, 0x00020404, 0x00010406, 0x000103E9, 0x000103EF, 0x000103EF,
+            0x000103EF, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103EF, 0x000103EF, 0x00010000, 0x000103E9, 0x000103E9, 0x000103E9,
+            0x000103EF, 0x000103EF, 0x000103EF, 0x000103EF, 0x000103E9, 0x00010407, 0x000103EF, 0x000103EF, 0x000103E9, 0x000103EF,
+            0x000103E9, 0x000103E9, 0x000103EF, 0x00010408, 0x00010409, 0x000103EF, 0x0001040A, 0x0001040B, 0x0001040C, 0x0001040D,
+            0x0001040E, 0x0001040F, 0x00010410, 0x00010411, 0x00010412, 0x00010413, 0x00010414, 0x00010415, 0x00010416, 0x00010417,
+            0x00010418, 0x00010419, 0x0001041A, 0x002103C1, 0x0001041B, 0x0001041C, 0x0001041D, 0x0001041E, 0x0001041F, 0x00010420,
+            0x00010013, 0x00010421, 0x00010068, 0x00020422, 0x00020424, 0x0001006B, 0x00020426, 0x00020428, 0x0002042A, 0x0002042C,
+            0x0002042E, 0x00020430, 0x00030432, 0x00410435, 0x00210436, 0x00010437, 0x00410438, 0x00210439, 0x0081043A, 0x0001043B,
+            0x0001043C, 0x0081043D, 0x0001043E, 0x0002043F, 0x00020441, 0x00020443, 0x00020445, 0x00020447, 0x00020449, 0x0003044B,
+            0x0041044E, 0x0021044F, 0x00010450, 0x00410451, 0x00210452, 0x00810453, 0x00010454, 0x00010455, 0x00010456, 0x00810457,
+            0x00010458, 0x00020459, 0x0002045B, 0x0002045D, 0x0002045F, 0x00020461, 0x00030463, 0x00010466, 0x00010467, 0x00010468,
+            0x00020469, 0x0002046B, 0x0001046D, 0x0001046E, 0x0003046F, 0x00010472, 0x00010473, 0x00010474, 0x00010475, 0x00010476,
+            0x00010477, 0x00010478, 0x00010479, 0x0001047A, 0x0001047B, 0x0001047C, 0x0001047D, 0x0001047E, 0x0001047F, 0x00010480,
+            0x00010481, 0x00010482, 0x00010483, 0x00010484, 0x00010485, 0x00010486, 0x00010487, 0x00010488, 0x00010489, 0x0001048A,
+            0x0001048B, 0x0001048C, 0x0001048D, 0x0001048E, 0x0001048F, 0x00010490, 0x00010491, 0x00010492, 0x00010493, 0x00010494,
+            0x00010495, 0x00010496, 0x00010497, 0x00010498, 0x00010499, 0x0002049A, 0x0002049C, 0x0001049E, 0x0002049F, 0x000104A1,
+            0x000104A2, 0x000104A3, 0x000204A4, 0x000104A6, 0x000104A7, 0x000104A8, 0x000104A9, 0x000204AA, 0x000204AC, 0x000204AE,
+            0x000104B0, 0x000104B1, 0x000104B2, 0x000104B3, 0x000104B4, 0x000104B5, 0x000104B6, 0x000104B7, 0x000104B8, 0x200104B9,
+            0x000104BA, 0x000104BB, 0x000104BC, 0x000104BD, 0x000104BE, 0x000104BF, 0x000104C0, 0x000104C1, 0x000104C2, 0x000104C3,
+            0x000104C4, 0x000104C5, 0x000104C6, 0x000104C7, 0x000104C8, 0x000104C9, 0x000104CA, 0x000104CB, 0x000104CC, 0x000104CD,
+            0x000104CE, 0x000104CF, 0x000104D0, 0x000104D1, 0x000104D2, 0x000104D3, 0x000104D4, 0x000104D5, 0x000104D6, 0x000104D7,
+            0x000104D8, 0x200104D9, 0x000104DA, 0x000104DB, 0x000104DC, 0x000104DD, 0x000104DE, 0x000104DF, 0x000104E0, 0x000104E1,
+            0x000104E2, 0x000104E3, 0x000104E4, 0x000104E5, 0x000104E6, 0x000104E7, 0x000104E8, 0x000104E9, 0x000104EA, 0x000104EB,
+            0x000104EC, 0x000104ED, 0x000104EE, 0x000104EF, 0x000104F0, 0x000204F1, 0x000204F3, 0x000104F5, 0x000204F6, 0x000104F8,
+            0x000104F9, 0x000104FA, 0x000204FB, 0x000104FD, 0x000104FE, 0x000104FF, 0x00010500, 0x00020501, 0x00020503, 0x00020505,
+            0x00010507, 0x00010508, 0x00010509, 0x0001050A, 0x0001050B, 0x0001050C, 0x0001050D, 0x0001050E, 0x0001050F, 0x00010510,
+            0x00010511, 0x00010512, 0x00010513, 0x00010514, 0x00010515, 0x00010516, 0x00010517, 0x00010518, 0x00010519, 0x0001051A,
+            0x0001051B, 0x0001051C, 0x0001051D, 0x0002051E, 0x00020520, 0x00010522, 0x00010523, 0x00010524, 0x00010525, 0x00010526,
+            0x00010527, 0x00010528, 0x00010529, 0x0001052A, 0x0001052B, 0x0001052C, 0x0001052D, 0x000103E9, 0x000103EE, 0x000103ED,
+            0x000103E9, 0x00010000, 0x00010000, 0x0001052E, 0x0001052F, 0x00010530, 0x00010531, 0x00010532, 0x00010533, 0x00020534,
+            0x00020536, 0x00010538, 0x00010539, 0x0001053A, 0x0001053B, 0x0001053C, 0x0001053D, 0x0001053E, 0x0001053F, 0x00010540,
+            0x00010541, 0x00010542, 0x00010543, 0x00010544, 0x00010545, 0x00010546, 0x00010547, 0x00010548, 0x00010549, 0x0001054A,
+            0x0001054B, 0x0001054C, 0x0001054D, 0x0001054E, 0x0001054F, 0x00010550, 0x00010551, 0x00010552, 0x00010553, 0x00010554,
+            0x00010555, 0x00010556, 0x00010557, 0x00010558, 0x00010559, 0x0001055A, 0x0001055B, 0x0001055C, 0x0001055D, 0x0001055E,
+            0x0001055F, 0x00010560, 0x00010561, 0x00010562, 0x00010563, 0x00010564, 0x00010565, 0x00010566, 0x00020567, 0x00020569,
+            0x0001056B, 0x0001056C, 0x0001056D, 0x0001056E, 0x0001056F, 0x00010570, 0x00010571, 0x00010572, 0x00010573, 0x00010574,
+            0x00010575, 0x00010576, 0x00010577, 0x00020578, 0x0002057A, 0x0002057C, 0x0002057E, 0x00010580, 0x00010581, 0x00020582,
+            0x00020584, 0x00010586, 0x00010587, 0x00020588, 0x0002058A, 0x0002058C, 0x0002058E, 0x00020590, 0x00020592, 0x00010594,
+            0x00010595, 0x00020596, 0x00020598, 0x0002059A, 0x0002059C, 0x0002059E, 0x000205A0, 0x000105A2, 0x000105A3, 0x000205A4,
+            0x000205A6, 0x000205A8, 0x000205AA, 0x000205AC, 0x000205AE, 0x000205B0, 0x000205B2, 0x000205B4, 0x000205B6, 0x000205B8,
+            0x000205BA, 0x000105BC, 0x000105BD, 0x000205BE, 0x000205C0, 0x000105C2, 0x000105C3, 0x000105C4, 0x000105C5, 0x000105C6,
+            0x000105C7, 0x000105C8, 0x000105C9, 0x000105CA, 0x000105CB, 0x000105CC, 0x000105CD, 0x000105CE, 0x000105CF, 0x000105D0,
+            0x000105D1, 0x000105D2, 0x000105D3, 0x000105D4, 0x000105D5, 0x000105D6, 0x000105D7, 0x000105D8, 0x000105D9, 0x000105DA,
+            0x000105DB, 0x000105DC, 0x000105DD, 0x000105DE, 0x000105DF, 0x000105E0, 0x000105E1, 0x000105E2, 0x000105E3, 0x000105E4,
+            0x000105E5, 0x000105E6, 0x000105E7, 0x000105E8, 0x000105E9, 0x000105EA, 0x000105EB, 0x000105EC, 0x000105ED, 0x000105EE,
+            0x000105EF, 0x000105F0, 0x000105F1, 0x000105F2, 0x000105F3, 0x000105F4, 0x000105F5, 0x000105F6, 0x000105F7, 0x000105F8,
+            0x026105F9, 0x020105FA, 0x000105FB, 0x002105FC, 0x000105FD, 0x000105FE, 0x000105FF, 0x00010600, 0x00010601, 0x00010602,
+            0x02610603, 0x02010604, 0x00020605, 0x00010607, 0x00010608, 0x00010609, 0x0021060A, 0x0001060B, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x0001060C,
+            0x0001060D, 0x0001060E, 0x0001060F, 0x00010610, 0x00010611, 0x00010612, 0x00010613, 0x00010614, 0x00010615, 0x00010615,
+            0x00010616, 0x00010617, 0x00010000, 0x00010618, 0x00010619, 0x0001061A, 0x0001061B, 0x0001061C, 0x0001061D, 0x00010000,
+            0x00010000, 0x0001061E, 0x00010614, 0x0121061F, 0x00010620, 0x00210621, 0x00010622, 0x00010623, 0x00010624, 0x00410625,
+            0x00010626, 0x00010627, 0x00010628, 0x00810629, 0x0004062A, 0x0002062E, 0x00020630, 0x00020632, 0x00210634, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010635, 0x00010636, 0x00010637, 0x00010638, 0x00010639,
+            0x0001063A, 0x0021063B, 0x0021063C, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x0001063D, 0x00010000, 0x0001063E, 0x0001063F, 0x00010640, 0x00410641,
+            0x00210642, 0x00010643, 0x20010644, 0x00010645, 0x00410646, 0x00010647, 0x00210648, 0x00210649, 0x0021064A, 0x0021064B,
+            0x0021064C, 0x0021064D, 0x0021064E, 0x0021064F, 0x00410650, 0x00010000, 0x00010651, 0x00010652, 0x00010653, 0x00010654,
+            0x00010655, 0x00010656, 0x00010657, 0x20010658, 0x00010659, 0x2001065A, 0x0001065B, 0x0001065C, 0x0001065D, 0x0001065E,
+            0x0001065F, 0x00010660, 0x00010661, 0x00010662, 0x00010663, 0x00010664, 0x00010665, 0x00010666, 0x00010667, 0x00010668,
+            0x00010669, 0x0001066A, 0x0001066B, 0x0001066C, 0x0001066D, 0x0001066E, 0x0001066F, 0x01210011, 0x00010670, 0x00210671,
+            0x00010672, 0x00010673, 0x00010674, 0x00010675, 0x00010676, 0x00010677, 0x00010678, 0x00010679, 0x0002067A, 0x0002067C,
+            0x0002067E, 0x00020680, 0x00210682, 0x00010683, 0x00210684, 0x00010685, 0x00010686, 0x00010687, 0x00210688, 0x00210689,
+            0x0001068A, 0x0001068B, 0x0001068C, 0x00A1068D, 0x0041068E, 0x0101068F, 0x00410690, 0x00010691, 0x00010692, 0x00010693,
+            0x00010694, 0x00210695, 0x00210696, 0x00210697, 0x00010698, 0x00010699, 0x0061069A, 0x0021069B, 0x0001069C, 0x0081069D,
+            0x0061069E, 0x0001069F, 0x000106A0, 0x004106A1, 0x000106A2, 0x000106A3, 0x000206A4, 0x000106A6, 0x000206A7, 0x000106A9,
+            0x00E106AA, 0x004106AB, 0x000106AC, 0x002106AD, 0x000106AE, 0x000206AF, 0x000106B1, 0x000106B2, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x000106B3, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x000106B4, 0x000106B5, 0x00010000, 0x00010000, 0x000106B6, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x000106B7, 0x000106B8, 0x01210011, 0x000106B9, 0x000106BA, 0x000106BB, 0x000206BC, 0x000206BE,
+            0x000106C0, 0x000106C1, 0x002106C2, 0x00A106C3, 0x000106C4, 0x006106C5, 0x00010000, 0x000106C6, 0x000106C7, 0x002106C8,
+            0x000206C9, 0x000106CB, 0x000106CC, 0x004106CD, 0x002106CE, 0x000206CF, 0x004106D1, 0x006106D2, 0x000106D3, 0x002106D4,
+            0x000206D5, 0x008106D7, 0x000206D8, 0x000206DA, 0x000206DC, 0x000106DE, 0x000106DF, 0x000106E0, 0x000106E1, 0x000106E2,
+            0x000106E3, 0x000106E4, 0x000106E5, 0x000106E6, 0x000106E7, 0x000106E8, 0x000106E9, 0x000106EA, 0x000106EB, 0x000106EC,
+            0x000106ED, 0x00010000, 0x000103E9, 0x000103EF, 0x00010000, 0x00010000, 0x000103E9, 0x000103EF, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x000106EE, 0x000106EF, 0x000106F0, 0x00A106F1, 0x000106F2, 0x002106F3, 0x002106F4, 0x000106F5,
+            0x000106F6, 0x004106F7, 0x002106F8, 0x000106F9, 0x002106FA, 0x002106FB, 0x004106FC, 0x000106FD, 0x002106FE, 0x000106FF,
+            0x00210700, 0x00010701, 0x00010702, 0x00010703, 0x00210704, 0x00410705, 0x00210706, 0x00210707, 0x00010708, 0x00210709,
+            0x0001070A, 0x0001070B, 0x0041070C, 0x0061070D, 0x0001070E, 0x0041070F, 0x00010710, 0x00210711, 0x00210712, 0x00C10713,
+            0x00010714, 0x00210715, 0x00010716, 0x00010717, 0x00410718, 0x00210719, 0x0021071A, 0x0001071B, 0x0001071C, 0x0141071D,
+            0x0001071E, 0x01210011, 0x03A1071F, 0x00020720, 0x00020722, 0x00020724, 0x00010726, 0x00010727, 0x00010728, 0x00010729,
+            0x0001072A, 0x0001072B, 0x0001072C, 0x0001072D, 0x0001072E, 0x0021072F, 0x00010730, 0x00010731, 0x00010732, 0x00010733,
+            0x00010000, 0x000103EF, 0x00210734, 0x02E10735, 0x00010736, 0x00010737, 0x00210738, 0x00010739, 0x00010739, 0x0001073A,
+            0x0001073A, 0x0001073A, 0x0001073B, 0x0001073B, 0x0001073B, 0x0001073C, 0x0001073C, 0x0001073D, 0x0001073D, 0x0001073E,
+            0x0001073E, 0x0001073E, 0x0001073F, 0x00010740, 0x00010741, 0x01C10742, 0x03010743, 0x000103EF, 0x000103EF, 0x000103EF,
+            0x00010744, 0x01410745, 0x00010746, 0x00010747, 0x00010748, 0x00010749, 0x0001074A, 0x0001074B, 0x0001074C, 0x0001074D,
+            0x0021074E, 0x0001074F, 0x00010750, 0x00010751, 0x00010752, 0x00010753, 0x00010754, 0x00010755, 0x00010756, 0x00010757,
+            0x00010758, 0x00010759, 0x0021075A, 0x0001075B, 0x0001075C, 0x0001075D, 0x0001075E, 0x0001075F, 0x00010760, 0x00010761,
+            0x00210762, 0x00010763, 0x00010764, 0x00010765, 0x00010766, 0x00210767, 0x00010768, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010769, 0x0001076A, 0x0001076B, 0x0001076C, 0x0001076D, 0x0001076E, 0x0001076F,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010770, 0x00010771, 0x00010772, 0x00010000,
+            0x00010773, 0x00010774, 0x00010775, 0x00010776, 0x00010777, 0x00010778, 0x00010779, 0x0001077A, 0x0001077B, 0x0001077C,
+            0x0001077D, 0x0001077E, 0x0001077F, 0x0001077F, 0x00010780, 0x00010781, 0x00410782, 0x00810783, 0x00010784, 0x00610785,
+            0x00C10786, 0x00810787, 0x00610788, 0x00010789, 0x00C1078A, 0x0002078B, 0x0041078D, 0x0041078E, 0x0001078F, 0x00020790,
+            0x00210792, 0x00020793, 0x00810795, 0x00210796, 0x00010797, 0x00010798, 0x00010799, 0x00A1079A, 0x0001079B, 0x0021079C,
+            0x0001079D, 0x0081079E, 0x0001079F, 0x000107A0, 0x000107A1, 0x00010000, 0x00010000, 0x000103DC, 0x000103DD, 0x000107A2,
+            0x002107A3, 0x000207A4, 0x000207A6, 0x000207A8, 0x000207AA, 0x000207AC, 0x000207AE, 0x000207B0, 0x000207B2, 0x000107B4,
+            0x000107B5, 0x002107B6, 0x002107B7, 0x01210011, 0x000107B8, 0x000107B9, 0x000107BA, 0x008107BB, 0x000107BC, 0x000107BD,
+            0x000107BE, 0x000107BF, 0x000107C0, 0x000107C1, 0x000107C2, 0x000107C3, 0x000107C4, 0x0001077F, 0x00010780, 0x00010781,
+            0x00C107C5, 0x000107C6, 0x002107C7, 0x02A107C8, 0x00C107C9, 0x000107CA, 0x006107CB, 0x00010797, 0x00E107CC, 0x200107CD,
+            0x000107CE, 0x004107CF, 0x000207D0, 0x000107D2, 0x000207D3, 0x000207D5, 0x000207D7, 0x000107D9, 0x000107DA, 0x002107DB,
+            0x01210011, 0x000107DC, 0x000107DD, 0x002107DE, 0x00A107DF, 0x000107E0, 0x000107E1, 0x000107E2, 0x000107E3, 0x000107E4,
+            0x0001077F, 0x00010780, 0x00010781, 0x002107E5, 0x002107E6, 0x002107E7, 0x000107E8, 0x000107E9, 0x000107EA, 0x000107EB,
+            0x026107EC, 0x00A107ED, 0x000107EE, 0x000107EF, 0x000207F0, 0x000107F2, 0x000207F3, 0x002107F5, 0x00010797, 0x008107F6,
+            0x002107F7, 0x004107F8, 0x000107F9, 0x000207FA, 0x000207FC, 0x000207FE, 0x00010800, 0x00020801, 0x01210011, 0x00010803,
+            0x00010804, 0x00010805, 0x00010806, 0x00010807, 0x00010808, 0x00010809, 0x0001077F, 0x00010780, 0x00010781, 0x00C1080A,
+            0x0001080B, 0x0001080C, 0x0041080D, 0x0121080E, 0x0161080F, 0x00C10810, 0x00010811, 0x00010812, 0x00810813, 0x00010797,
+            0x00E10814, 0x00010815, 0x00410816, 0x00410817, 0x00010818, 0x00010819, 0x0001081A, 0x0021081B, 0x01210011, 0x0001081C,
+            0x0001081D, 0x0001081E, 0x00010662, 0x00010661, 0x00010663, 0x00010797, 0x00010797, 0x00010797, 0x0001077F, 0x00010780,
+            0x00010781, 0x00C1081F, 0x00010820, 0x00210821, 0x02A10822, 0x00A10823, 0x00010824, 0x00210825, 0x00010826, 0x00610827,
+            0x00010797, 0x00E10828, 0x20010829, 0x0001082A, 0x0041082B, 0x000103E9, 0x0021082C, 0x0002082D, 0x0002082F, 0x00010831,
+            0x00010832, 0x00010833, 0x00210834, 0x01210011, 0x00010835, 0x00010836, 0x00A10837, 0x00010780, 0x00010838, 0x00A10839,
+            0x0041083A, 0x2001083B, 0x0021083C, 0x0001083D, 0x0021083E, 0x0001083F, 0x00210840, 0x00210841, 0x00010842, 0x00010843,
+            0x00010844, 0x00410845, 0x00010846, 0x00010847, 0x00010848, 0x00010849, 0x0001084A, 0x0061084B, 0x0081084C, 0x2001084D,
+            0x2001084E, 0x0001084F, 0x00610850, 0x00010851, 0x00010852, 0x01210011, 0x00410853, 0x00A10854, 0x00010855, 0x00010856,
+            0x0001077F, 0x0001077F, 0x00010780, 0x00010781, 0x00010780, 0x00C10857, 0x00010858, 0x00410859, 0x0101085A, 0x0021085B,
+            0x0161085C, 0x0101085D, 0x0021085E, 0x0081085F, 0x00E10860, 0x20010861, 0x00210862, 0x00610863, 0x00210864, 0x00010865,
+            0x00010866, 0x00010867, 0x00010868, 0x00010869, 0x0021086A, 0x01210011, 0x0001086B, 0x00610011, 0x0041086C, 0x0001086D,
+            0x0001086E, 0x0001077F, 0x00010780, 0x00010781, 0x0001086F, 0x00C10870, 0x00010871, 0x00410872, 0x02C10873, 0x01010874,
+            0x00010875, 0x00810876, 0x00010797, 0x00010877, 0x00010878, 0x20010879, 0x0081087A, 0x2001087B, 0x0021087C, 0x2001087D,
+            0x0041087E, 0x0021087F, 0x00010880, 0x00010881, 0x00010882, 0x00210883, 0x01210011, 0x00210884, 0x00010780, 0x0001077F,
+            0x00010780, 0x00010781, 0x00010885, 0x00610886, 0x00410887, 0x00010888, 0x00410889, 0x03C1088A, 0x0001088B, 0x0001088C,
+            0x0021088D, 0x0081088E, 0x0001088F, 0x00010890, 0x00010890, 0x00010891, 0x00C10892, 0x20010893, 0x20010894, 0x00010895,
+            0x00410896, 0x00010897, 0x00020898, 0x0001089A, 0x0002089B, 0x0002089D, 0x0002089F, 0x000108A1, 0x00C108A2, 0x000108A3,
+            0x000108A4, 0x000108A5, 0x002108A6, 0x01210011, 0x010108A7, 0x000108A8, 0x000208A9, 0x000208AB, 0x00020898, 0x000208AD,
+            0x000208AF, 0x000208B1, 0x0001077F, 0x00010780, 0x00010781, 0x022108B3, 0x02E108B4, 0x010108B5, 0x000108B6, 0x00C108B7,
+            0x000108B8, 0x00A108B9, 0x000108BA, 0x000108BB, 0x200108BC, 0x002108BD, 0x200108BE, 0x002108BF, 0x000108C0, 0x01210011,
+            0x000108C1, 0x000108C2, 0x000108C3, 0x072108C4, 0x000108C5, 0x200108C6, 0x200108C7, 0x200108C8, 0x200108C9, 0x200108CA,
+            0x000108CB, 0x000108CC, 0x000108CD, 0x000108CE, 0x000108CF, 0x000108D0, 0x000108D1, 0x000108D2, 0x200108D3, 0x000108D4,
+            0x000108D5, 0x01210011, 0x002108D6, 0x002108D7, 0x000108D8, 0x006108D9, 0x000108DA, 0x000108DB, 0x000108DC, 0x000108DD,
+            0x028108DE, 0x000108DF, 0x004108E0, 0x000108E1, 0x024108E2, 0x200108E3, 0x200108E4, 0x200108E5, 0x200108E6, 0x200108E7,
+            0x000108E8, 0x000108E9, 0x000108EA, 0x000108EB, 0x000108EC, 0x000108ED, 0x200108EE, 0x01210011, 0x000208EF, 0x000208F1,
+            0x000108F3, 0x000108F4, 0x000308F5, 0x004108F8, 0x00C108F9, 0x000108FA, 0x000108FB, 0x00A108FC, 0x000108FD, 0x000108FE,
+            0x004108FF, 0x00010000, 0x00010000, 0x00A10900, 0x01210011, 0x01010901, 0x00010902, 0x00010903, 0x00010000, 0x00010904,
+            0x00010000, 0x00010905, 0x00010906, 0x00610907, 0x00010000, 0x00010000, 0x00010908, 0x00010909, 0x0001090A, 0x0002090B,
+            0x0001090D, 0x0001090E, 0x0001090F, 0x00010910, 0x00010911, 0x00010912, 0x00010913, 0x00010914, 0x00020915, 0x00010917,
+            0x00010918, 0x00010919, 0x0001091A, 0x0002091B, 0x0001091D, 0x0001091E, 0x0001091F, 0x00010920, 0x00020921, 0x00010923,
+            0x00010924, 0x00010925, 0x00010926, 0x00020927, 0x00010929, 0x0001092A, 0x0001092B, 0x0001092C, 0x0001092D, 0x0001092E,
+            0x0001092F, 0x00010930, 0x00010931, 0x00010932, 0x00010933, 0x00010934, 0x00020935, 0x00020937, 0x00010939, 0x0001093A,
+            0x2001093B, 0x0021093C, 0x0121093D, 0x00010780, 0x00010781, 0x0021093E, 0x00010000, 0x00010000, 0x0001093F, 0x00010940,
+            0x00010000, 0x00010000, 0x00010941, 0x00010942, 0x00210943, 0x00010944, 0x00010945, 0x00010946, 0x00010947, 0x00010948,
+            0x00010949, 0x0001094A, 0x0002094B, 0x0001094D, 0x0001094E, 0x0001094F, 0x00010950, 0x00010951, 0x00010952, 0x00010953,
+            0x00010954, 0x00020955, 0x00010957, 0x00010958, 0x00010959, 0x0001095A, 0x0002095B, 0x0001095D, 0x0001095E, 0x0001095F,
+            0x00010960, 0x00020961, 0x00010963, 0x00010964, 0x00010965, 0x00010966, 0x00020967, 0x00010969, 0x0001096A, 0x0001096B,
+            0x0001096C, 0x0001096D, 0x2001096E, 0x2001096F, 0x00010970, 0x00010971, 0x00010972, 0x00010973, 0x00010974, 0x00020975,
+            0x00020977, 0x00020979, 0x0002097B, 0x00E1097D, 0x00010000, 0x00A1097E, 0x0021097F, 0x00210980, 0x00410981, 0x00610982,
+            0x00210983, 0x00010984, 0x00010985, 0x00010986, 0x00010987, 0x00010988, 0x00010989, 0x0001098A, 0x0001098B, 0x0001098C,
+            0x0001098D, 0x0021098E, 0x0001098F, 0x00010990, 0x00010991, 0x00010992, 0x00410993, 0x00010994, 0x00010995, 0x00210996,
+            0x00010997, 0x00010998, 0x00010999, 0x0001099A, 0x0001099B, 0x0001099C, 0x0001099D, 0x0001099E, 0x0001099F, 0x000109A0,
+            0x006109A1, 0x200109A2, 0x000109A3, 0x006109A4, 0x000109A5, 0x000109A6, 0x000109A7, 0x000109A8, 0x000109A9, 0x000109AA,
+            0x000109AB, 0x000109AC, 0x000109AD, 0x000109AE, 0x000109AF, 0x00010780, 0x000109B0, 0x00010781, 0x002109B1, 0x000109B2,
+            0x000109B3, 0x000109B4, 0x000109B5, 0x000309B6, 0x01210011, 0x002109B9, 0x006109BA, 0x002109BB, 0x006109BC, 0x006109BD,
+            0x000109BE, 0x000109BF, 0x002109C0, 0x000109C1, 0x000109C2, 0x000109C3, 0x000109C4, 0x000109C5, 0x002109C6, 0x000109C7,
+            0x000109C8, 0x002109C9, 0x008109CA, 0x000109CB, 0x002109CC, 0x000109CD, 0x000109CE, 0x002109CF, 0x000109D0, 0x000109D1,
+            0x000109D2, 0x000109D3, 0x000109D4, 0x000109D5, 0x000109D6, 0x000109D7, 0x002109D8, 0x000109D9, 0x000109DA, 0x000109DB,
+            0x000109DC, 0x000109DD, 0x000109DE, 0x000109DF, 0x000109E0, 0x000109E1, 0x000109E2, 0x002109E3, 0x000109E4, 0x002109E5,
+            0x000109E6, 0x000109E7, 0x01210011, 0x002109E8, 0x000109E9, 0x000109EA, 0x002109EB, 0x000109EC, 0x000109ED, 0x000109EE,
+            0x000109EF, 0x000109F0, 0x000109F1, 0x000109F2, 0x000109F3, 0x000109F4, 0x000109F5, 0x000109F6, 0x000109F7, 0x000109F8,
+            0x000109F9, 0x000109FA, 0x000109FB, 0x000109FC, 0x000109FD, 0x000109FE, 0x000109FF, 0x00010A00, 0x00010A01, 0x00010A02,
+            0x00010A03, 0x00010A04, 0x00010A05, 0x00010A06, 0x00010A07, 0x00010A08, 0x00010A09, 0x00010A0A, 0x00010A0B, 0x00010A0C,
+            0x00010A0D, 0x00010A0E, 0x00010A0F, 0x00010A10, 0x00010A11, 0x00010A12, 0x00010A13, 0x00010A14, 0x00010A15, 0x00010A16,
+            0x00010A17, 0x00010A18, 0x00010A19, 0x00010A1A, 0x00010A1B, 0x00010A1C, 0x00010A1D, 0x00010A1E, 0x00010A1F, 0x00010A20,
+            0x00010A21, 0x00010A22, 0x00010A23, 0x00010A24, 0x00010A25, 0x00010A26, 0x00010A27, 0x00010A28, 0x00010A29, 0x00010A2A,
+            0x00010A2B, 0x00010A2C, 0x00010A2D, 0x00010A2E, 0x00010A2F, 0x00010A30, 0x00010A31, 0x00010A32, 0x00010A33, 0x00010A34,
+            0x00010A35, 0x00010A36, 0x00010A37, 0x00010A38, 0x00010A39, 0x00210A3A, 0x00410A3B, 0x00010A3C, 0x00010A3D, 0x00010A3E,
+            0x00210A3F, 0x0BC10A40, 0x09010A41, 0x0AE10A42, 0x01E10A43, 0x01E10A44, 0x01E10A45, 0x00E10A46, 0x00E10A47, 0x01010A48,
+            0x00610A49, 0x00C10A4A, 0x00010A4B, 0x00610A4C, 0x00E10A4D, 0x01E10A4E, 0x00E10A4F, 0x01010A50, 0x00610A51, 0x00E10A52,
+            0x00E10A53, 0x00E10A54, 0x01010A55, 0x00610A56, 0x00C10A57, 0x00010A58, 0x00610A59, 0x01C10A5A, 0x00E10A5B, 0x02E10A5C,
+            0x00E10A5D, 0x00E10A5E, 0x01010A5F, 0x00610A60, 0x00E10A61, 0x00E10A62, 0x00E10A63, 0x00E10A64, 0x00E10A65, 0x01E10A66,
+            0x00E10A67, 0x00410A68, 0x00010A69, 0x00010A6A, 0x00010A6B, 0x00010A6C, 0x00010A6D, 0x00010A6E, 0x00610A6F, 0x00010A70,
+            0x00010A71, 0x0101086C, 0x01410A72, 0x00610A73, 0x00610A74, 0x00610A75, 0x00610A76, 0x01210A77, 0x0AA10A78, 0x00A10A79,
+            0x00010A7A, 0x1FE10A7B, 0x0F410A7C, 0x00010A7D, 0x00010A7E, 0x01E10A7F, 0x00E10A80, 0x02010A81, 0x18A10A82, 0x00010A83,
+            0x00010A84, 0x00010A85, 0x00010A86, 0x00A10A87, 0x01010A88, 0x00010A89, 0x03210A8A, 0x00210A8B, 0x00010A8C, 0x00020A8D,
+            0x00010A8F, 0x00010A90, 0x00020A91, 0x00020A93, 0x00010A95, 0x00020A96, 0x00010A98, 0x00020A99, 0x00010A9B, 0x00010A9C,
+            0x00020A9D, 0x00020A9F, 0x00020AA1, 0x00610AA3, 0x00020AA4, 0x00020AA6, 0x00020AA8, 0x00020AAA, 0x00010AAC, 0x00010AAD,
+            0x00210AAE, 0x00020AAF, 0x00020AB1, 0x00020AB3, 0x00010AB5, 0x00020AB6, 0x00020AB8, 0x00010ABA, 0x00020ABB, 0x00010ABD,
+            0x00020ABE, 0x00010AC0, 0x00020AC1, 0x00610AC3, 0x00020AC4, 0x00020AC6, 0x00020AC8, 0x00020ACA, 0x00010ACC, 0x00020ACD,
+            0x00020ACF, 0x00010AD1, 0x00020AD2, 0x00020AD4, 0x00020AD6, 0x00010AD8, 0x00010AD9, 0x00020ADA, 0x00020ADC, 0x00010ADE,
+            0x00020ADF, 0x00010AE1, 0x00020AE2, 0x00210AE4, 0x00010AE5, 0x00210AE6, 0x00010AE7, 0x00010AE8, 0x00210AE9, 0x00020AEA,
+            0x00020AEC, 0x00020AEE, 0x00020AF0, 0x00410AF2, 0x00020AF3, 0x00040AF5, 0x00020AF9, 0x00010AFB, 0x00010AFC, 0x00010AFD,
+            0x00010AFE, 0x00010AFF, 0x00010B00, 0x00010B01, 0x00010B02, 0x01810B03, 0x00C10B04, 0x02810B05, 0x00210B06, 0x02610B07,
+            0x01810B08, 0x00410B09, 0x00210B0A, 0x04410B0B, 0x02010B0C, 0x00010000, 0x00010000, 0x01E10B0D, 0x00010780, 0x00010781,
+            0x00010B0E, 0x00010B0F, 0x00010B10, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103E9,
+            0x00010B11, 0x00010000, 0x00210B12, 0x00010B13, 0x00010B14, 0x00410B15, 0x00010B16, 0x00010B17, 0x000103E9, 0x01210011,
+            0x01210011, 0x00010B18, 0x00010B19, 0x00010B1A, 0x00010B1B, 0x00210B1C, 0x00210B1D, 0x00010B1E, 0x00010B1F, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x01210011, 0x00010B20, 0x00010B21, 0x00010B22, 0x00010B23, 0x00010B24,
+            0x00010B25, 0x00010B26, 0x00410B27, 0x00010B28, 0x00010B29, 0x00010B2A, 0x00010B2B, 0x00010B2C, 0x00410B2D, 0x00010B2E,
+            0x00010B2F, 0x00010B30, 0x00010B31, 0x00010B32, 0x00010B33, 0x00010B34, 0x00010B35, 0x00010B36, 0x00210B37, 0x00010B38,
+            0x00010B39, 0x00610B3A, 0x00010B3B, 0x00010B3C, 0x00010B3D, 0x00010B3E, 0x00010B3F, 0x00010B40, 0x00010B41, 0x00010B42,
+            0x00010B43, 0x00010B44, 0x00010B45, 0x00010B46, 0x00010B47, 0x00010B48, 0x00010B49, 0x00010B4A, 0x00010B4B, 0x00010B4C,
+            0x00010B4D, 0x00010B4E, 0x00010B4F, 0x00010B50, 0x00010B51, 0x00210B52, 0x00010B53, 0x00010B54, 0x00010B55, 0x00010B56,
+            0x00010B57, 0x00010B58, 0x00010B59, 0x00010B5A, 0x00010B5B, 0x00010B5C, 0x00010B5D, 0x00010B5E, 0x00010B5F, 0x00010B60,
+            0x00010B61, 0x00010B62, 0x00010B63, 0x00010B64, 0x00010B65, 0x00010B66, 0x00010B67, 0x00010B68, 0x00010B69, 0x00010B6A,
+            0x00010B6B, 0x00010B6C, 0x00010B6D, 0x00010B6E, 0x00010B6F, 0x00C10B70, 0x00010B71, 0x00010B72, 0x00010B73, 0x00010B74,
+            0x00010B75, 0x00010B76, 0x00210B77, 0x00210B78, 0x00010B79, 0x00210B7A, 0x00010B7B, 0x00010B7C, 0x00210B7D, 0x00010B7E,
+            0x00010B7F, 0x00010B80, 0x00010B81, 0x00210B82, 0x00010B83, 0x00010B84, 0x00010B85, 0x00010B86, 0x00010B87, 0x00010B88,
+            0x00210B89, 0x00210B8A, 0x00010B8B, 0x00010B8C, 0x00010B8D, 0x08A10B8E, 0x03810B8F, 0x00020B90, 0x00020B92, 0x01610B94,
+            0x01010B95, 0x00010B96, 0x00010B97, 0x00010B98, 0x00010B99, 0x00010B9A, 0x00010B9B, 0x01210011, 0x03A10B9C, 0x00810B9D,
+            0x05610B9E, 0x00810B9F, 0x20010BA0, 0x20010BA1, 0x20010BA2, 0x00210BA3, 0x20010BA4, 0x01C10BA5, 0x01210011, 0x0001086C,
+            0x00020BA6, 0x00030BA8, 0x03E10BAB, 0x03610BAC, 0x00210BAD, 0x05810BAE, 0x00A10BAF, 0x00010BB0, 0x00030BB1, 0x00410BB4,
+            0x00010BB5, 0x00010BB5, 0x00010BB6, 0x00010BB6, 0x00410BB7, 0x00010BB8, 0x00010BB9, 0x00210BBA, 0x00010BBB, 0x00A10BBC,
+            0x00010BBD, 0x00010BBE, 0x00010BBF, 0x00210BC0, 0x00410BC1, 0x00010BC2, 0x00010780, 0x00010BC3, 0x00010BC4, 0x00010BC5,
+            0x00010BC6, 0x00010BC7, 0x00010BC8, 0x00010BC9, 0x00010BCA, 0x00010000, 0x01210011, 0x01210011, 0x00C10BCB, 0x00010BCC,
+            0x00610BCD, 0x00210BCE, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103EF, 0x000103EF, 0x000103EF,
+            0x000103EF, 0x000103EF, 0x000103EF, 0x000103E9, 0x000103E9, 0x000103EF, 0x00010BCF, 0x00010BD0, 0x00010BD1, 0x0001077F,
+            0x0001077F, 0x00010780, 0x00010BD2, 0x00010781, 0x20010BD3, 0x00010BD4, 0x20010BD5, 0x00010BD6, 0x20010BD7, 0x00010BD8,
+            0x20010BD9, 0x00010BDA, 0x20010BDB, 0x00410BDC, 0x20010BDD, 0x00210BDE, 0x01C10BDF, 0x00810BE0, 0x00E10BE1, 0x00410BE2,
+            0x00010BE3, 0x00010797, 0x00810BE4, 0x20010BE5, 0x00010BE6, 0x20010BE7, 0x00010BE8, 0x20010BE9, 0x20010BEA, 0x00210BEB,
+            0x20010BEC, 0x00210BED, 0x00210BEE, 0x00010BEF, 0x00010BF0, 0x00010BF1, 0x00210BF2, 0x01210011, 0x00210BF3, 0x00010BF4,
+            0x00010BF5, 0x00210BF6, 0x00010BF7, 0x01210BF8, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x01010BF9, 0x00010780, 0x00010BFA, 0x00010781, 0x00E10BFB, 0x01A10BFC, 0x00010BFD,
+            0x00010BFE, 0x00010BFF, 0x00010C00, 0x00010C01, 0x00210C02, 0x00010C03, 0x00010C04, 0x00010C05, 0x00010C06, 0x00E10C07,
+            0x00010C08, 0x00010C09, 0x00010C0A, 0x00010C0B, 0x01210011, 0x00010C0C, 0x00010C0D, 0x00010C0E, 0x00010C0F, 0x00010C10,
+            0x00010C11, 0x00010C12, 0x00010C13, 0x00010C14, 0x00010C15, 0x00010C15, 0x00010C16, 0x00010C17, 0x00010C18, 0x00010C19,
+            0x00010C1A, 0x00010C1B, 0x00010C1C, 0x00010C1D, 0x00010C1D, 0x00010C1E, 0x00010C1F, 0x00410C20, 0x00010C21, 0x00010C22,
+            0x00010C23, 0x00010C24, 0x00010C25, 0x00010C26, 0x00010C27, 0x00010C27, 0x00010C28, 0x00010C29, 0x00210C2A, 0x00010C2B,
+            0x00A10C2C, 0x00010797, 0x00010C2D, 0x00010C2E, 0x00210C2F, 0x00010C30, 0x00010C31, 0x00010C32, 0x00010C33, 0x00010C34,
+            0x00610C35, 0x00610C36, 0x01210C37, 0x02010C38, 0x00010C39, 0x00E10C3A, 0x00010C3B, 0x00010C3C, 0x01E10C3D, 0x00010C3E,
+            0x00010797, 0x00210C3F, 0x00410C40, 0x01210011, 0x00410C41, 0x01210011, 0x04610C42, 0x00210C43, 0x00010C44, 0x00010C45,
+            0x00010C46, 0x00010C47, 0x00010C48, 0x00010C48, 0x00010C49, 0x00010C4A, 0x00010C4B, 0x00010C4C, 0x00010C4D, 0x00010C4E,
+            0x00010C4F, 0x00010C50, 0x00010C51, 0x00010C52, 0x00010C53, 0x00010C54, 0x00010C55, 0x00010C56, 0x00010C57, 0x00010C58,
+            0x00010C59, 0x00010C5A, 0x00010C5B, 0x00010C5C, 0x00010C5D, 0x00010C5E, 0x00010C5F, 0x00010C60, 0x00010C61, 0x00010C62,
+            0x00010C63, 0x00010C64, 0x00010C65, 0x00010C66, 0x00010C67, 0x00010C68, 0x00010C69, 0x00010C6A, 0x00010C6B, 0x00010C6C,
+            0x00010C6D, 0x00010C6E, 0x00010C6F, 0x00010C70, 0x00010C71, 0x00210C72, 0x00410C73, 0x00010C74, 0x00210C75, 0x00E10C76,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010C77, 0x00010C78, 0x00010C78, 0x00010C78, 0x00010780,
+            0x00010C78, 0x00010C78, 0x00010C78, 0x00010C78, 0x00010781, 0x00010781, 0x00010000, 0x00210C79, 0x00010000, 0x00010000,
+            0x00010000, 0x00010C78, 0x00010C7A, 0x00210C7B, 0x00010C7C, 0x00010C7D, 0x00210C7E, 0x00010C7F, 0x00010C80, 0x00010C81,
+            0x00010C82, 0x00010C83, 0x00010C84, 0x00010C85, 0x00010C86, 0x00010C87, 0x00010C88, 0x00010C89, 0x00010C8A, 0x00010C8B,
+            0x00010C8C, 0x00010C8D, 0x00210C8E, 0x00010C8F, 0x00010C90, 0x00010C91, 0x00010C92, 0x00010C93, 0x00210C94, 0x00010C95,
+            0x00010C96, 0x00010C97, 0x00010C98, 0x00010C99, 0x00210C9A, 0x00010C9B, 0x00010C9C, 0x00010C9D, 0x00010C9E, 0x00010C9F,
+            0x00010CA0, 0x00010CA1, 0x00030CA2, 0x00010CA5, 0x00010CA6, 0x00010CA7, 0x00010CA8, 0x00010CA9, 0x00010CAA, 0x00010CAB,
+            0x00010CAC, 0x00010CAD, 0x00010CAE, 0x00010CAF, 0x00010CB0, 0x00010CB1, 0x00010CB2, 0x00010CB3, 0x00010CB4, 0x00010CB5,
+            0x00010CB6, 0x00010CB7, 0x00010CB8, 0x00010CB9, 0x00010060, 0x00010CBA, 0x00010CBB, 0x00010CBC, 0x00010CBD, 0x00010CBE,
+            0x00010CBF, 0x00010CC0, 0x00010CC1, 0x00010CC2, 0x00010CC3, 0x00010CC4, 0x00010CC5, 0x00010CC6, 0x00010CC7, 0x0001006E,
+            0x00010CC8, 0x00210CC9, 0x00010CCA, 0x00010CCB, 0x00010CCC, 0x00010CCD, 0x00010CCE, 0x00010CCF, 0x00010CD0, 0x00210CD1,
+            0x00010CD2, 0x00210CD3, 0x00010CD4, 0x00010CD5, 0x00010CD6, 0x00010CD7, 0x00210CD8, 0x00010CD9, 0x00210CDA, 0x00010CDB,
+            0x00010CDC, 0x00010CDD, 0x00010CDE, 0x00010CDF, 0x00010CE0, 0x00010CE1, 0x00010CE2, 0x00010CE3, 0x00010CE4, 0x00010CE5,
+            0x00010CE6, 0x00010CE7, 0x00010CE8, 0x00020CE9, 0x00030CEB, 0x00010CEE, 0x00010CEF, 0x00010CF0, 0x00010CF1, 0x00010CF2,
+            0x00010CF3, 0x00010CF4, 0x00010CF5, 0x00010CF6, 0x00010CF7, 0x00010CF8, 0x00010CF9, 0x00010CFA, 0x00010CFB, 0x00010CFC,
+            0x00010CFD, 0x00010CFE, 0x00010CFF, 0x00010D00, 0x00010D01, 0x00010D02, 0x00010D03, 0x00010D04, 0x00010D05, 0x00010D06,
+            0x00010D07, 0x00010D08, 0x00010D09, 0x00010D0A, 0x00010D0B, 0x00010D0C, 0x00010D0D, 0x00010D0E, 0x00010D0F, 0x00010D10,
+            0x00020D11, 0x00010D13, 0x00010D14, 0x00010D15, 0x00010D16, 0x00010D17, 0x00010D18, 0x00010D19, 0x00010D1A, 0x00010D1B,
+            0x00010D1C, 0x00010D1D, 0x00010D1E, 0x00010D1F, 0x00010D20, 0x00010D21, 0x00010D22, 0x00010D23, 0x00010D24, 0x00010D25,
+            0x00010D26, 0x00010D27, 0x00010D28, 0x00010D29, 0x00010D2A, 0x00010D2B, 0x00010D2C, 0x00010D2D, 0x00010D2E, 0x00010D2F,
+            0x00010D30, 0x00010D31, 0x00010D32, 0x00010D33, 0x000103E9, 0x000103E9, 0x000103EF, 0x000103E9, 0x000103E9, 0x000103E9,
+            0x000103E9, 0x000103E9, 0x000103E9, 0x000103E9, 0x00010413, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103EF,
+            0x000103EF, 0x000103E9, 0x00010D34, 0x00020D35, 0x000300C6, 0x00020D37, 0x00020D39, 0x00020D3B, 0x00020D3D, 0x000200DB,
+            0x00010D3F, 0x00010D40, 0x00010D41, 0x00010D42, 0x00010D43, 0x00010D44, 0x00010D45, 0x00010D46, 0x00010D47, 0x00010D48,
+            0x00010D49, 0x000201F3, 0x00010D4A, 0x00010D4B, 0x00010D4C, 0x00010D4D, 0x00010D4E, 0x00010D4F, 0x00010D50, 0x00020D51,
+            0x00010D53, 0x00010D54, 0x00020D55, 0x00010BD0, 0x00020D57, 0x00020D59, 0x00020D5B, 0x000103E9, 0x000103E9, 0x000103E9,
+            0x000103E9, 0x000103EF, 0x000103E9, 0x000103EF, 0x000103EF, 0x000103E9, 0x000103EF, 0x00020D5D, 0x00020D5F, 0x00020D61,
+            0x00020D63, 0x00020D65, 0x00020D67, 0x00020D69, 0x00020D6B, 0x00030D6D, 0x00030D70, 0x00020D73, 0x00020D75, 0x00020D77,
+            0x00020D79, 0x00020D7B, 0x00020D7D, 0x00020D7F, 0x00020D81, 0x00020D83, 0x00020D85, 0x00030D87, 0x00030D8A, 0x00030D8D,
+            0x00030D90, 0x00020D93, 0x00020D95, 0x00020D97, 0x00020D99, 0x00030D9B, 0x00030D9E, 0x00020DA1, 0x00020DA3, 0x00020DA5,
+            0x00020DA7, 0x00020DA9, 0x00020DAB, 0x00020DAD, 0x00020DAF, 0x00020DB1, 0x00020DB3, 0x00020DB5, 0x00020DB7, 0x00020DB9,
+            0x00020DBB, 0x00020DBD, 0x00020DBF, 0x00030DC1, 0x00030DC4, 0x00020DC7, 0x00020DC9, 0x00020DCB, 0x00020DCD, 0x00020DCF,
+            0x00020DD1, 0x00020DD3, 0x00020DD5, 0x00030DD7, 0x00030DDA, 0x00020DDD, 0x00020DDF, 0x00020DE1, 0x00020DE3, 0x00020DE5,
+            0x00020DE7, 0x00020DE9, 0x00020DEB, 0x00020DED, 0x00020DEF, 0x00020DF1, 0x00020DF3, 0x00020DF5, 0x00020DF7, 0x00020DF9,
+            0x00020DFB, 0x00020DFD, 0x00020DFF, 0x00030E01, 0x00030E04, 0x00030E07, 0x00030E0A, 0x00030E0D, 0x00030E10, 0x00030E13,
+            0x00030E16, 0x00020E19, 0x00020E1B, 0x00020E1D, 0x00020E1F, 0x00020E21, 0x00020E23, 0x00020E25, 0x00020E27, 0x00030E29,
+            0x00030E2C, 0x00020E2F, 0x00020E31, 0x00020E33, 0x00020E35, 0x00020E37, 0x00020E39, 0x00030E3B, 0x00030E3E, 0x00030E41,
+            0x00030E44, 0x00030E47, 0x00030E4A, 0x00020E4D, 0x00020E4F, 0x00020E51, 0x00020E53, 0x00020E55, 0x00020E57, 0x00020E59,
+            0x00020E5B, 0x00020E5D, 0x00020E5F, 0x00020E61, 0x00020E63, 0x00020E65, 0x00020E67, 0x00030E69, 0x00030E6C, 0x00030E6F,
+            0x00030E72, 0x00020E75, 0x00020E77, 0x00020E79, 0x00020E7B, 0x00020E7D, 0x00020E7F, 0x00020E81, 0x00020E83, 0x00020E85,
+            0x00020E87, 0x00020E89, 0x00020E8B, 0x00020E8D, 0x00020E8F, 0x00020E91, 0x00020E93, 0x00020E95, 0x00020E97, 0x00020E99,
+            0x00020E9B, 0x00020E9D, 0x00020E9F, 0x00020EA1, 0x00020EA3, 0x00020EA5, 0x00020EA7, 0x00020EA9, 0x00020EAB, 0x00020EAD,
+            0x00020EAF, 0x00020EB1, 0x00030EB3, 0x00210EB6, 0x00030EB7, 0x00010EBA, 0x00020EBB, 0x00020EBD, 0x00020EBF, 0x00020EC1,
+            0x00030EC3, 0x00030EC6, 0x00030EC9, 0x00030ECC, 0x00030ECF, 0x00030ED2, 0x00030ED5, 0x00030ED8, 0x00030EDB, 0x00030EDE,
+            0x00030EE1, 0x00030EE4, 0x00030EE7, 0x00030EEA, 0x00030EED, 0x00030EF0, 0x00030EF3, 0x00030EF6, 0x00030EF9, 0x00030EFC,
+            0x00020EFF, 0x00020F01, 0x00020F03, 0x00020F05, 0x00020F07, 0x00020F09, 0x00030F0B, 0x00030F0E, 0x00030F11, 0x00030F14,
+            0x00030F17, 0x00030F1A, 0x00030F1D, 0x00030F20, 0x00030F23, 0x00030F26, 0x00020F29, 0x00020F2B, 0x00020F2D, 0x00020F2F,
+            0x00020F31, 0x00020F33, 0x00020F35, 0x00020F37, 0x00030F39, 0x00030F3C, 0x00030F3F, 0x00030F42, 0x00030F45, 0x00030F48,
+            0x00030F4B, 0x00030F4E, 0x00030F51, 0x00030F54, 0x00030F57, 0x00030F5A, 0x00030F5D, 0x00030F60, 0x00030F63, 0x00030F66,
+            0x00030F69, 0x00030F6C, 0x00030F6F, 0x00030F72, 0x00020F75, 0x00020F77, 0x00020F79, 0x00020F7B, 0x00030F7D, 0x00030F80,
+            0x00030F83, 0x00030F86, 0x00030F89, 0x00030F8C, 0x00030F8F, 0x00030F92, 0x00030F95, 0x00030F98, 0x00020F9B, 0x00020F9D,
+            0x00020F9F, 0x00020FA1, 0x00020FA3, 0x00020FA5, 0x00020FA7, 0x00020FA9, 0x00020FAB, 0x00020FAD, 0x00010FAF, 0x00010FB0,
+            0x00010FB1, 0x00010FB2, 0x00020FB3, 0x00020FB5, 0x00030FB7, 0x00030FBA, 0x00030FBD, 0x00030FC0, 0x00030FC3, 0x00030FC6,
+            0x00020FC9, 0x00020FCB, 0x00030FCD, 0x00030FD0, 0x00030FD3, 0x00030FD6, 0x00030FD9, 0x00030FDC, 0x00020FDF, 0x00020FE1,
+            0x00030FE3, 0x00030FE6, 0x00030FE9, 0x00030FEC, 0x00020FEF, 0x00020FF1, 0x00030FF3, 0x00030FF6, 0x00030FF9, 0x00030FFC,
+            0x00020FFF, 0x00021001, 0x00031003, 0x00031006, 0x00031009, 0x0003100C, 0x0003100F, 0x00031012, 0x00021015, 0x00021017,
+            0x00031019, 0x0003101C, 0x0003101F, 0x00031022, 0x00031025, 0x00031028, 0x0002102B, 0x0002102D, 0x0003102F, 0x00031032,
+            0x00031035, 0x00031038, 0x0003103B, 0x0003103E, 0x00021041, 0x00021043, 0x00031045, 0x00031048, 0x0003104B, 0x0003104E,
+            0x00031051, 0x00031054, 0x00021057, 0x00021059, 0x0003105B, 0x0003105E, 0x00031061, 0x00031064, 0x00021067, 0x00021069,
+            0x0003106B, 0x0003106E, 0x00031071, 0x00031074, 0x00021077, 0x00021079, 0x0003107B, 0x0003107E, 0x00031081, 0x00031084,
+            0x00031087, 0x0003108A, 0x0002108D, 0x0003108F, 0x00031092, 0x00031095, 0x00021098, 0x0002109A, 0x0003109C, 0x0003109F,
+            0x000310A2, 0x000310A5, 0x000310A8, 0x000310AB, 0x000210AE, 0x000210B0, 0x000310B2, 0x000310B5, 0x000310B8, 0x000310BB,
+            0x000310BE, 0x000310C1, 0x000210C4, 0x00020443, 0x000210C6, 0x00020445, 0x000210C8, 0x00020447, 0x000210CA, 0x00020449,
+            0x000210CC, 0x0002045D, 0x000210CE, 0x0002045F, 0x000210D0, 0x00020461, 0x000310D2, 0x000310D5, 0x000410D8, 0x000410DC,
+            0x000410E0, 0x000410E4, 0x000410E8, 0x000410EC, 0x000310F0, 0x000310F3, 0x000410F6, 0x000410FA, 0x000410FE, 0x00041102,
+            0x00041106, 0x0004110A, 0x0003110E, 0x00031111, 0x00041114, 0x00041118, 0x0004111C, 0x00041120, 0x00041124, 0x00041128,
+            0x0003112C, 0x0003112F, 0x00041132, 0x00041136, 0x0004113A, 0x0004113E, 0x00041142, 0x00041146, 0x0003114A, 0x0003114D,
+            0x00041150, 0x00041154, 0x00041158, 0x0004115C, 0x00041160, 0x00041164, 0x00031168, 0x0003116B, 0x0004116E, 0x00041172,
+            0x00041176, 0x0004117A, 0x0004117E, 0x00041182, 0x00021186, 0x00021188, 0x0003118A, 0x0002118D, 0x0003118F, 0x00021192,
+            0x00031194, 0x00021197, 0x00021199, 0x0002119B, 0x00020424, 0x0002119D, 0x0001119F, 0x000111A0, 0x0001119F, 0x000111A1,
+            0x000211A2, 0x000311A4, 0x000211A7, 0x000311A9, 0x000211AC, 0x000311AE, 0x000211B1, 0x00020426, 0x000211B3, 0x00020428,
+            0x000211B5, 0x000211B7, 0x000211B9, 0x000211BB, 0x000211BD, 0x000211BF, 0x000311C1, 0x00030432, 0x000211C4, 0x000311C6,
+            0x000211C9, 0x000211CB, 0x000211CD, 0x0002042A, 0x000211CF, 0x000211D1, 0x000211D3, 0x000211D5, 0x000211D7, 0x000311D9,
+            0x0003044B, 0x000211DC, 0x000211DE, 0x000211E0, 0x000311E2, 0x000211E5, 0x000211E7, 0x000211E9, 0x0002042E, 0x000211EB,
+            0x000211ED, 0x00020422, 0x00010036, 0x000311EF, 0x000211F2, 0x000311F4, 0x000211F7, 0x000311F9, 0x000211FC, 0x0002042C,
+            0x000211FE, 0x00020430, 0x00021200, 0x00010068, 0x00011202, 0x00010A89, 0x00010A89, 0x00010A89, 0x00010A89, 0x00010A89,
+            0x00010A89, 0x00010A89, 0x00010056, 0x00010A89, 0x00010A89, 0x00010A89, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00011203, 0x00011204, 0x00611205, 0x00011206, 0x00011207, 0x00611208, 0x00611209, 0x0021120A, 0x0021120B,
+            0x0001120C, 0x0002120D, 0x0003120F, 0x00011212, 0x00211213, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010056, 0x00011214, 0x00011215, 0x00011216, 0x00021217, 0x00031219, 0x0001121C, 0x0002121D, 0x0003121F, 0x00011222,
+            0x00211223, 0x00011224, 0x00021225, 0x00011227, 0x00011228, 0x00011229, 0x0001122A, 0x0021122B, 0x0001122C, 0x0001122D,
+            0x0021122E, 0x0002122F, 0x00021231, 0x00021233, 0x00011235, 0x00011236, 0x00211237, 0x00011238, 0x00011239, 0x0001123A,
+            0x0001123B, 0x0001123C, 0x0001123D, 0x0001123E, 0x0021123F, 0x00041240, 0x00C11244, 0x00010A89, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00011245, 0x00011246, 0x00A11247, 0x00011248, 0x00011249, 0x0001124A, 0x0021124B,
+            0x0001124C, 0x0121124D, 0x0001124E, 0x0001124F, 0x00011250, 0x00211251, 0x00011252, 0x00011253, 0x00011254, 0x00011255,
+            0x00011256, 0x00011257, 0x00011258, 0x00011259, 0x0001125A, 0x0001125B, 0x0001125C, 0x0001125D, 0x0001125E, 0x00E1125F,
+            0x00021260, 0x02011262, 0x00A11263, 0x00011264, 0x00011265, 0x00011266, 0x00011266, 0x00011267, 0x00011268, 0x00011269,
+            0x0001126A, 0x00010400, 0x00010400, 0x00010400, 0x0001126B, 0x0001126C, 0x00010BCF, 0x00010BCF, 0x00010BCF, 0x00010BCF,
+            0x0001126D, 0x00010BCF, 0x00010BCF, 0x00010BCF, 0x00010400, 0x0001126E, 0x0001126F, 0x00011270, 0x00011271, 0x00010400,
+            0x00010400, 0x000103EF, 0x000103EF, 0x000103EF, 0x000103EF, 0x000103E9, 0x00031272, 0x00031275, 0x00011278, 0x00021279,
+            0x0001127B, 0x0003127C, 0x0003127F, 0x00011282, 0x00011283, 0x00021284, 0x00011286, 0x00011287, 0x00011287, 0x00011287,
+            0x00011288, 0x00020147, 0x00011289, 0x00011289, 0x0001128A, 0x0001128B, 0x0001128C, 0x0001128D, 0x0002128E, 0x00211290,
+            0x00011291, 0x00011292, 0x00011293, 0x00011293, 0x00011293, 0x00211294, 0x00021295, 0x00031297, 0x0002129A, 0x0001129C,
+            0x0001129D, 0x0001129E, 0x0001043E, 0x0001129F, 0x0001129D, 0x000112A0, 0x00010021, 0x00020084, 0x000112A1, 0x00011278,
+            0x000112A2, 0x000112A3, 0x000112A4, 0x000112A5, 0x000112A6, 0x000112A7, 0x000112A8, 0x006112A9, 0x000112AA, 0x000112AB,
+            0x000312AC, 0x000112AF, 0x000112B0, 0x000112B1, 0x000112B2, 0x000112B3, 0x006112B4, 0x000112B5, 0x000112B6, 0x000112A3,
+            0x000112AA, 0x000112B7, 0x000112B8, 0x000112B9, 0x000112BA, 0x000312BB, 0x000112BE, 0x000112BF, 0x000312C0, 0x000312C3,
+            0x000412C6, 0x000312CA, 0x000312CD, 0x000312D0, 0x000312D3, 0x000312D6, 0x000312D9, 0x000312DC, 0x000312DF, 0x000312E2,
+            0x000312E5, 0x000312E8, 0x000312EB, 0x000212EE, 0x000112F0, 0x000212F1, 0x000312F3, 0x000212F6, 0x000112F8, 0x000212F9,
+            0x000312FB, 0x000412FE, 0x00021302, 0x00011304, 0x00021305, 0x00031307, 0x0001130A, 0x0001130B, 0x0001130C, 0x0001130D,
+            0x0001040C, 0x0002130E, 0x00031310, 0x00021313, 0x00010415, 0x00021315, 0x00031317, 0x0004131A, 0x0002131E, 0x00010416,
+            0x00021320, 0x00031322, 0x00010D42, 0x0001040F, 0x00010410, 0x00010412, 0x00411325, 0x00011326, 0x00011327, 0x00011328,
+            0x00411329, 0x0003132A, 0x0021132D, 0x0001132E, 0x0001132F, 0x00011330, 0x00C11331, 0x00021332, 0x00021334, 0x02211336,
+            0x00021337, 0x03A11339, 0x0002133A, 0x0002133C, 0x0002133E, 0x06611340, 0x00021341, 0x00611343, 0x00021344, 0x00211346,
+            0x00021347, 0x00011349, 0x0061134A, 0x0001134B, 0x0041134C, 0x00A1134D, 0x0001134E, 0x00C1134F, 0x00021350, 0x00011352,
+            0x00021353, 0x00811355, 0x00021356, 0x00031358, 0x0001135B, 0x0002135C, 0x0003135E, 0x01E11361, 0x00021362, 0x00211364,
+            0x00021365, 0x00211367, 0x00021368, 0x0001136A, 0x0002136B, 0x02A1136D, 0x0002136E, 0x00011370, 0x00021371, 0x01211373,
+            0x00021374, 0x00021376, 0x00021378, 0x0002137A, 0x0002137C, 0x0021137E, 0x0002137F, 0x00021381, 0x00211383, 0x00021384,
+            0x00021386, 0x00A11388, 0x00021389, 0x0002138B, 0x0021138D, 0x0002138E, 0x00021390, 0x00211392, 0x00021393, 0x00021395,
+            0x04211397, 0x00021398, 0x0002139A, 0x0002139C, 0x0002139E, 0x018113A0, 0x044113A1, 0x000213A2, 0x000213A4, 0x000213A6,
+            0x000213A8, 0x00A113AA, 0x000213AB, 0x000213AD, 0x000213AF, 0x000213B1, 0x032113B3, 0x006113B4, 0x038113B5, 0x002113B6,
+            0x1F6113B7, 0x014113B8, 0x010113B9, 0x000213BA, 0x000213BC, 0x000213BE, 0x000213C0, 0x000213C2, 0x000213C4, 0x000213C6,
+            0x000213C8, 0x000213CA, 0x000213CC, 0x000213CE, 0x000313D0, 0x000313D3, 0x000313D6, 0x000313D9, 0x000313DC, 0x000313DF,
+            0x000313E2, 0x000313E5, 0x000313E8, 0x000413EB, 0x000413EF, 0x000413F3, 0x000413F7, 0x000413FB, 0x000413FF, 0x00041403,
+            0x00041407, 0x0004140B, 0x0004140F, 0x00041413, 0x00021417, 0x00021419, 0x0002141B, 0x0002141D, 0x0002141F, 0x00021421,
+            0x00021423, 0x00021425, 0x00021427, 0x00031429, 0x0003142C, 0x0003142F, 0x00031432, 0x00031435, 0x00031438, 0x0003143B,
+            0x0003143E, 0x00031441, 0x00031444, 0x00031447, 0x0003144A, 0x0003144D, 0x00031450, 0x00031453, 0x00031456, 0x00031459,
+            0x0003145C, 0x0003145F, 0x00031462, 0x00031465, 0x00031468, 0x0003146B, 0x0003146E, 0x00031471, 0x00031474, 0x00031477,
+            0x0003147A, 0x0003147D, 0x00031480, 0x00031483, 0x00031486, 0x00031489, 0x0003148C, 0x0003148F, 0x00031492, 0x00031495,
+            0x00011498, 0x00011499, 0x0001149A, 0x0001149B, 0x0001149C, 0x0001149D, 0x0001149E, 0x0001149F, 0x000114A0, 0x000114A1,
+            0x000114A2, 0x000114A3, 0x000114A4, 0x000114A5, 0x000114A6, 0x000114A7, 0x000114A8, 0x000114A9, 0x000114AA, 0x000114AB,
+            0x000114AC, 0x000114AD, 0x000114AE, 0x000114AF, 0x000114B0, 0x000114B1, 0x000114B2, 0x000114B3, 0x000114B4, 0x000114B5,
+            0x000114B6, 0x000114B7, 0x000114B8, 0x000114B9, 0x000114BA, 0x000114BB, 0x000114BC, 0x000114BD, 0x000114BE, 0x000114BF,
+            0x000114C0, 0x000114C1, 0x000114C2, 0x000114C3, 0x000114C4, 0x000114C5, 0x000114C6, 0x000114C7, 0x000114C8, 0x000114C9,
+            0x000114CA, 0x000114CB, 0x000114CC, 0x000213BC, 0x000213BE, 0x000213C0, 0x000213C2, 0x000213C4, 0x000213C6, 0x000213C8,
+            0x000213CA, 0x000213CC, 0x000213CE, 0x010113B9, 0x000213BA, 0x000114CC, 0x1FE114CD, 0x05E114CE, 0x00E114CF, 0x068114D0,
+            0x004114D1, 0x032114D2, 0x00A114D3, 0x0DE114D4, 0x040114D5, 0x08C114D6, 0x01A114D7, 0x010113B9, 0x000213BA, 0x010113B9,
+            0x000213BA, 0x010113B9, 0x000213BA, 0x060114D8, 0x002114D9, 0x03C114DA, 0x012114DB, 0x01E114DC, 0x1FE114DD, 0x104114DE,
+            0x02A114DF, 0x07C114E0, 0x006114E1, 0x03E114E2, 0x002114E3, 0x01A114E4, 0x000414E5, 0x0CC114E9, 0x000314EA, 0x000214ED,
+            0x000314EF, 0x0C8114F2, 0x000214F3, 0x12C114F5, 0x03E114F6, 0x0D0114F7, 0x05C114F8, 0x05C114F9, 0x000114FA, 0x000114FB,
+            0x000114FC, 0x000114FD, 0x000114FE, 0x000114FF, 0x00011500, 0x00011501, 0x00011502, 0x00011503, 0x00011504, 0x00011505,
+            0x00011506, 0x00011507, 0x00011508, 0x00011509, 0x0001150A, 0x0001150B, 0x0001150C, 0x0001150D, 0x0001150E, 0x0001150F,
+            0x00011510, 0x00011511, 0x00011512, 0x00011513, 0x00011514, 0x00011515, 0x00011516, 0x00011517, 0x00011518, 0x00011519,
+            0x0001151A, 0x0001151B, 0x0001151C, 0x0001151D, 0x0001151E, 0x0001151F, 0x00011520, 0x00011521, 0x00011522, 0x00011523,
+            0x00011524, 0x00011525, 0x00011526, 0x00011527, 0x00011528, 0x00011529, 0x0001152A, 0x0001152B, 0x0001152C, 0x0001152D,
+            0x0001152E, 0x0001152F, 0x00011530, 0x00011531, 0x00011532, 0x00011533, 0x00011534, 0x00011535, 0x00011536, 0x00011537,
+            0x00011538, 0x00011539, 0x0001153A, 0x0001153B, 0x0001153C, 0x0001153D, 0x0001153E, 0x0001153F, 0x00011540, 0x00011541,
+            0x00011542, 0x00011543, 0x00011544, 0x00011545, 0x00011546, 0x00011547, 0x00011548, 0x00011549, 0x0001154A, 0x0001154B,
+            0x0001154C, 0x0001154D, 0x0001154E, 0x0001154F, 0x00011550, 0x00011551, 0x00011552, 0x00011553, 0x00011554, 0x00011555,
+            0x00011556, 0x00011557, 0x00011558, 0x00011559, 0x0001155A, 0x0001155B, 0x0001155C, 0x0001155D, 0x0001155E, 0x0001155F,
+            0x00011560, 0x00011561, 0x00011562, 0x00011563, 0x00011564, 0x00011565, 0x00011566, 0x00011567, 0x00011568, 0x00011569,
+            0x0001156A, 0x0001156B, 0x0001156C, 0x0001156D, 0x0001156E, 0x0001156F, 0x00011570, 0x00011571, 0x00011572, 0x00011573,
+            0x00011574, 0x00011575, 0x00011576, 0x00011577, 0x00011578, 0x00011579, 0x0001157A, 0x0001157B, 0x0001157C, 0x0001157D,
+            0x0003157E, 0x00A11581, 0x00011582, 0x00011583, 0x00011584, 0x00011585, 0x000103E9, 0x000103EE, 0x000103ED, 0x00011586,
+            0x00011587, 0x00011588, 0x00211589, 0x0001158A, 0x0001158B, 0x0001158C, 0x0001158D, 0x0001158E, 0x0001158F, 0x00011590,
+            0x00011591, 0x00011592, 0x00011593, 0x00011594, 0x00011595, 0x00011596, 0x00011597, 0x00011598, 0x00011599, 0x0001159A,
+            0x0001159B, 0x0001159C, 0x0001159D, 0x0001159E, 0x0001159F, 0x000115A0, 0x000115A1, 0x000115A2, 0x000115A3, 0x000115A4,
+            0x000115A5, 0x000115A6, 0x000115A7, 0x000115A8, 0x000115A9, 0x000115AA, 0x000115AB, 0x000115AC, 0x000115AD, 0x000115AE,
+            0x000115AF, 0x000115B0, 0x000115B1, 0x000115B2, 0x000115B3, 0x000115B4, 0x000115B5, 0x016115B6, 0x02E115B7, 0x022115B8,
+            0x000115B9, 0x000115BA, 0x000115BB, 0x000115BC, 0x00010000, 0x000115BD, 0x000115BE, 0x000115BF, 0x000115C0, 0x000115C1,
+            0x000115C2, 0x000115C3, 0x000115C4, 0x000115C5, 0x000115C6, 0x000115C7, 0x000115C8, 0x000115C9, 0x000115CA, 0x000115CB,
+            0x000115CC, 0x000115CD, 0x000115CE, 0x000115CF, 0x006115D0, 0x00C115D1, 0x00C115D2, 0x00C115D3, 0x00C115D4, 0x00C115D5,
+            0x00C115D6, 0x00C115D7, 0x00C115D8, 0x000115D9, 0x00010C44, 0x000115DA, 0x00010C45, 0x000115DB, 0x000115DC, 0x000115DD,
+            0x000115DE, 0x000115DF, 0x000115E0, 0x00010C46, 0x000115E1, 0x000115E2, 0x00010C47, 0x00010C48, 0x000115E3, 0x000115E4,
+            0x000115E5, 0x000115E6, 0x000115E7, 0x000115E8, 0x000215E9, 0x000115EB, 0x000115EC, 0x000115ED, 0x00010C4B, 0x00010C4A,
+            0x000115EE, 0x000115EF, 0x000115F0, 0x000115F1, 0x000115F2, 0x002115F3, 0x006115F4, 0x004115F5, 0x002115F6, 0x000115F7,
+            0x002115F8, 0x010115F9, 0x000115FA, 0x000115FB, 0x000115FC, 0x002115FD, 0x002115FE, 0x002115FF, 0x01211600, 0x00611601,
+            0x00011602, 0x00011603, 0x00011604, 0x00011605, 0x00011606, 0x00011607, 0x00011608, 0x00011609, 0x0041160A, 0x0001160B,
+            0x0021160C, 0x0001160D, 0x0001160E, 0x0001160F, 0x00011610, 0x00011611, 0x00011612, 0x00011613, 0x00011614, 0x00811615,
+            0x00011616, 0x00011617, 0x00011618, 0x00011619, 0x0001161A, 0x0021161B, 0x0021161C, 0x0001161D, 0x0003161E, 0x00031621,
+            0x00021624, 0x00021626, 0x00031628, 0x0002162B, 0x0003162D, 0x00031630, 0x00031633, 0x00021636, 0x00031638, 0x0003163B,
+            0x0003163E, 0x00031641, 0x00031644, 0x00021647, 0x00021649, 0x0003164B, 0x0002164E, 0x00021650, 0x00021652, 0x00031654,
+            0x00021657, 0x00031659, 0x0002165C, 0x0002165E, 0x00021660, 0x00031662, 0x00031665, 0x00031668, 0x0002166B, 0x0002166D,
+            0x0002166F, 0x00021671, 0x00021673, 0x00021675, 0x00031677, 0x0002167A, 0x0003167C, 0x0002167F, 0x00031681, 0x00031684,
+            0x00031687, 0x0003168A, 0x0002168D, 0x0003168F, 0x00021692, 0x00021694, 0x00021696, 0x00021698, 0x0003169A, 0x0003169D,
+            0x000316A0, 0x000316A3, 0x000316A6, 0x000216A9, 0x000216AB, 0x000216AD, 0x000316AF, 0x000316B2, 0x000316B5, 0x000216B8,
+            0x000316BA, 0x000316BD, 0x000216C0, 0x000216C2, 0x000216C4, 0x000216C6, 0x000216C8, 0x000216CA, 0x000316CC, 0x000216CF,
+            0x000216D1, 0x000316D3, 0x000216D6, 0x000216D8, 0x000316DA, 0x000316DD, 0x000316E0, 0x000216E3, 0x000216E5, 0x000216E7,
+            0x000216E9, 0x000216EB, 0x000316ED, 0x000216F0, 0x000316F2, 0x000216F5, 0x000216F7, 0x000216F9, 0x000216FB, 0x000216FD,
+            0x000216FF, 0x00031701, 0x00021704, 0x00021706, 0x00031708, 0x0002170B, 0x0003170D, 0x00031710, 0x00021713, 0x00021715,
+            0x00031717, 0x0002171A, 0x0002171C, 0x0002171E, 0x00031720, 0x00021723, 0x00031725, 0x00021728, 0x0003172A, 0x0002172D,
+            0x0003172F, 0x00031732, 0x00021735, 0x00021737, 0x00021739, 0x0002173B, 0x0002173D, 0x0002173F, 0x00021741, 0x00021743,
+            0x00021745, 0x00021747, 0x00021749, 0x0002174B, 0x0002174D, 0x0002174F, 0x00021751, 0x00021753, 0x00021755, 0x00021757,
+            0x00021759, 0x0002175B, 0x0002175D, 0x0002175F, 0x00021761, 0x00021763, 0x00021765, 0x00021767, 0x00021769, 0x0002176B,
+            0x0002176D, 0x0002176F, 0x00021771, 0x00021773, 0x00021775, 0x00021777, 0x00021779, 0x0002177B, 0x0002177D, 0x0002177F,
+            0x00021781, 0x00021783, 0x00021785, 0x00021787, 0x00021789, 0x00021649, 0x0002178B, 0x0002178D, 0x0002178F, 0x00021791,
+            0x00021793, 0x00021795, 0x00021797, 0x00021799, 0x00021650, 0x0002179B, 0x0002179D, 0x0002179F, 0x000217A1, 0x000217A3,
+            0x000217A5, 0x000217A7, 0x000217A9, 0x000217AB, 0x000217AD, 0x000217AF, 0x000217B1, 0x000217B3, 0x000217B5, 0x000217B7,
+            0x000217B9, 0x000217BB, 0x000217BD, 0x000217BF, 0x000217C1, 0x000217C3, 0x000217C5, 0x000217C7, 0x000217C9, 0x000217CB,
+            0x000217CD, 0x000217CF, 0x000217D1, 0x000217D3, 0x000217D5, 0x000217D7, 0x000217D9, 0x000217DB, 0x000217DD, 0x000217DF,
+            0x000217E1, 0x000217E3, 0x000217E5, 0x000217E7, 0x000217E9, 0x000217EB, 0x000217ED, 0x000217EF, 0x000217F1, 0x000217F3,
+            0x000217F5, 0x000217F7, 0x000217F9, 0x000217FB, 0x000217FD, 0x000217FF, 0x00021801, 0x00021803, 0x00021805, 0x00021807,
+            0x00021809, 0x0002180B, 0x0002180D, 0x0002180F, 0x00021811, 0x00021813, 0x00021815, 0x00021817, 0x00021819, 0x0002181B,
+            0x0002181D, 0x0002181F, 0x00021821, 0x00021823, 0x00021825, 0x00021827, 0x00021829, 0x0002182B, 0x0002182D, 0x0002182F,
+            0x00021831, 0x00021833, 0x00021835, 0x00021837, 0x00021839, 0x0002183B, 0x0002183D, 0x0002183F, 0x00021841, 0x00021843,
+            0x00021845, 0x00021847, 0x00021849, 0x0002184B, 0x0002184D, 0x0002184F, 0x00021851, 0x00021853, 0x00021855, 0x00021857,
+            0x000216CA, 0x00021859, 0x0002185B, 0x0002185D, 0x0002185F, 0x00021861, 0x00021863, 0x00021865, 0x00021867, 0x00021869,
+            0x0002186B, 0x0002186D, 0x0002186F, 0x00021871, 0x00021873, 0x00021875, 0x00021877, 0x00021879, 0x0002187B, 0x0002187D,
+            0x000216E5, 0x0002187F, 0x00021881, 0x00021883, 0x00021885, 0x00021887, 0x00021889, 0x0002188B, 0x0002188D, 0x0002188F,
+            0x00021891, 0x00021893, 0x00021895, 0x00021897, 0x00021899, 0x0002189B, 0x000216FF, 0x0002189D, 0x0002189F, 0x000218A1,
+            0x000218A3, 0x000218A5, 0x000218A7, 0x000218A9, 0x000218AB, 0x000218AD, 0x000218AF, 0x000218B1, 0x000218B3, 0x000218B5,
+            0x000218B7, 0x000218B9, 0x000218BB, 0x000218BD, 0x000218BF, 0x000218C1, 0x000218C3, 0x000218C5, 0x000218C7, 0x000218C9,
+            0x000218CB, 0x000218CD, 0x000218CF, 0x000218D1, 0x000218D3, 0x000218D5, 0x000218D7, 0x016118D9, 0x000118DA, 0x000118DB,
+            0x000118DC, 0x000118DD, 0x000118DE, 0x000118DF, 0x000218E0, 0x00010011, 0x012113B6, 0x002118E2, 0x00E118E3, 0x000118E4,
+            0x004118E5, 0x000118E6, 0x0101086C, 0x000118E7, 0x000118E8, 0x000118E9, 0x000118EA, 0x000118EB, 0x000118EC, 0x000118ED,
+            0x000118EE, 0x000218EF, 0x000118F1, 0x000218F2, 0x000118F4, 0x000118F5, 0x000118F6, 0x00021765, 0x000218F7, 0x000218F9,
+            0x000118FB, 0x000218FC, 0x000118FE, 0x002118FF, 0x00011900, 0x00011901, 0x00011902, 0x00011903, 0x00011904, 0x00011905,
+            0x00011906, 0x00011907, 0x00011908, 0x00211909, 0x0002190A, 0x0001190C, 0x0002190D, 0x0001190F, 0x00021910, 0x00011912,
+            0x00021913, 0x00011915, 0x00021916, 0x00011918, 0x00021919, 0x0001191B, 0x0002191C, 0x0001191E, 0x0002191F, 0x00011921,
+            0x00021922, 0x00011924, 0x00021925, 0x00011927, 0x00021928, 0x0001192A, 0x0002192B, 0x0001192D, 0x0001192E, 0x0002192F,
+            0x00011931, 0x00021932, 0x00011934, 0x00021935, 0x00A11937, 0x00021938, 0x0002193A, 0x0001193C, 0x0002193D, 0x0002193F,
+            0x00011941, 0x00021942, 0x00021944, 0x00011946, 0x00021947, 0x00021949, 0x0001194B, 0x0002194C, 0x0002194E, 0x00811950,
+            0x00011951, 0x00011952, 0x00011953, 0x00011954, 0x00011955, 0x00A11956, 0x00011957, 0x00811958, 0x00021959, 0x0001195B,
+            0x0001195C, 0x0001195D, 0x0001195E, 0x0021195F, 0x00011960, 0x00021961, 0x00021963, 0x00011965, 0x00011966, 0x00011967,
+            0x00011968, 0x00011969, 0x0001196A, 0x0001196B, 0x0001196C, 0x0001196D, 0x0001196E, 0x0021196F, 0x00021970, 0x00011972,
+            0x00021973, 0x00011975, 0x00021976, 0x00011978, 0x00021979, 0x0001197B, 0x0002197C, 0x0001197E, 0x0002197F, 0x00011981,
+            0x00021982, 0x00011984, 0x00021985, 0x00011987, 0x00021988, 0x0001198A, 0x0002198B, 0x0001198D, 0x0002198E, 0x00011990,
+            0x00021991, 0x00011993, 0x00011994, 0x00021995, 0x00011997, 0x00021998, 0x0001199A, 0x0002199B, 0x00A1199D, 0x0002199E,
+            0x000219A0, 0x000119A2, 0x000219A3, 0x000219A5, 0x000119A7, 0x000219A8, 0x000219AA, 0x000119AC, 0x000219AD, 0x000219AF,
+            0x000119B1, 0x000219B2, 0x000219B4, 0x008119B6, 0x000119B7, 0x000119B8, 0x000119B9, 0x000119BA, 0x000119BB, 0x00A119BC,
+            0x000119BD, 0x008119BE, 0x000219BF, 0x000119C1, 0x000119C2, 0x000219C3, 0x000219C5, 0x000219C7, 0x000219C9, 0x000119CB,
+            0x002119CC, 0x000219CD, 0x000219CF, 0x004119D1, 0x000119D2, 0x004119D3, 0x004119D4, 0x006119D5, 0x00C119D6, 0x002119D7,
+            0x002119D8, 0x00C119D9, 0x000119DA, 0x006119DB, 0x000119DC, 0x000119DD, 0x000119DE, 0x000119DF, 0x000119E0, 0x000119E1,
+            0x002119E2, 0x000119E3, 0x000119E4, 0x002119E5, 0x004119E6, 0x00A119E7, 0x000119E8, 0x004119E9, 0x000119EA, 0x012119EB,
+            0x028119EC, 0x000119ED, 0x002119EE, 0x002119EF, 0x000119F0, 0x000119F1, 0x000119F2, 0x000119F3, 0x000119F4, 0x000119F5,
+            0x000119F6, 0x000119F7, 0x002119F8, 0x000119F9, 0x002119FA, 0x000119FB, 0x000119FC, 0x008119FD, 0x000119FE, 0x000119FF,
+            0x00011A00, 0x00011A01, 0x00011A02, 0x00211A03, 0x00411A04, 0x00211A05, 0x00011A06, 0x00211A07, 0x00011A08, 0x00011A09,
+            0x00011A0A, 0x00211A0B, 0x00021A0C, 0x00021A0E, 0x00021A10, 0x00021A12, 0x00021A14, 0x00021A16, 0x00021A18, 0x00021A1A,
+            0x00021A1C, 0x00021A1E, 0x00021A20, 0x00021A22, 0x00021A24, 0x00021A26, 0x00021A28, 0x00021A2A, 0x00021A2C, 0x00021A2E,
+            0x00011A30, 0x00021A31, 0x00011A33, 0x00021A34, 0x00021A36, 0x00021A38, 0x00021A3A, 0x00021A3C, 0x00011A3E, 0x00011A3F,
+            0x00021A40, 0x00021A42, 0x00211A44, 0x00011A45, 0x00021A46, 0x00011A48, 0x00011A49, 0x00011A4A, 0x00011A4B, 0x00411A4C,
+            0x00011A4D, 0x00211A4E, 0x00211A4F, 0x04611A50, 0x00011A51, 0x00211A52, 0x00011A53, 0x00011A54, 0x00811A55, 0x00011A56,
+            0x00811A57, 0x00031A58, 0x00031A5B, 0x00031A5E, 0x00031A61, 0x00031A64, 0x00031A67, 0x00031A6A, 0x00031A6D, 0x00031A70,
+            0x00031A73, 0x00031A76, 0x00031A79, 0x00031A7C, 0x00031A7F, 0x00041A82, 0x00041A86, 0x00041A8A, 0x00041A8E, 0x00041A92,
+            0x00041A96, 0x00041A9A, 0x00041A9E, 0x00041AA2, 0x00041AA6, 0x00041AAA, 0x00041AAE, 0x00041AB2, 0x00041AB6, 0x00041ABA,
+            0x00071ABE, 0x00061AC5, 0x00041ACB, 0x00041ACF, 0x00041AD3, 0x00041AD7, 0x00041ADB, 0x00041ADF, 0x00041AE3, 0x00041AE7,
+            0x00041AEB, 0x00041AEF, 0x00041AF3, 0x00041AF7, 0x00041AFB, 0x00041AFF, 0x00041B03, 0x00041B07, 0x00041B0B, 0x00041B0F,
+            0x00041B13, 0x00041B17, 0x00041B1B, 0x00041B1F, 0x00041B23, 0x00041B27, 0x00041B2B, 0x00041B2F, 0x00041B33, 0x00041B37,
+            0x00041B3B, 0x00041B3F, 0x00041B43, 0x00041B47, 0x00041B4B, 0x00041B4F, 0x00041B53, 0x00041B57, 0x00021B5B, 0x00021B5D,
+            0x00021B5F, 0x00021B61, 0x000213BA, 0x000213CE, 0x00021B63, 0x00021B65, 0x00021B67, 0x00021B69, 0x00021B6B, 0x00021B6D,
+            0x00031B6F, 0x00021B72, 0x00021B74, 0x00021B76, 0x00021B78, 0x00021B7A, 0x00021B7C, 0x00021B7E, 0x00021B80, 0x00021B82,
+            0x00021B63, 0x00021B84, 0x00021B86, 0x00021B88, 0x00021B8A, 0x00021B8C, 0x00011B8E, 0x00211B8F, 0x00411B90, 0x00011B91,
+            0x00211B92, 0x00811B93, 0x00021B94, 0x00021B96, 0x00021B98, 0x00021B9A, 0x00021B9C, 0x00021B9E, 0x00021BA0, 0x00021BA2,
+            0x00021BA4, 0x00021BA6, 0x00021BA8, 0x00021BAA, 0x00021BAC, 0x00021BAE, 0x00051BB0, 0x00041BB5, 0x00021BB9, 0x00011BBB,
+            0x00021BBC, 0x00021BBE, 0x00021BC0, 0x00021BC2, 0x00021BC4, 0x00021BC6, 0x00021BC8, 0x00021BCA, 0x00021BCC, 0x00021BCE,
+            0x00021BD0, 0x00021BD2, 0x00021BD4, 0x00021BD6, 0x00021BD8, 0x00021BDA, 0x00021BDC, 0x00021BDE, 0x00021BE0, 0x00021BE2,
+            0x00021BE4, 0x00021BE6, 0x00021BE8, 0x00021BEA, 0x00021BEC, 0x00021BEE, 0x00021BF0, 0x00021BF2, 0x00021BF4, 0x00021BF6,
+            0x00021BF8, 0x00021BFA, 0x00021BFC, 0x00021BFE, 0x00021C00, 0x00021C02, 0x00021C04, 0x00021C06, 0x00021C08, 0x00021C0A,
+            0x00021C0C, 0x00021C0E, 0x00021C10, 0x00021C12, 0x00021C14, 0x00021C16, 0x00021C18, 0x00021C1A, 0x00021C1C, 0x00021C1E,
+            0x00021C20, 0x00021C22, 0x00021C24, 0x00021B65, 0x00021C26, 0x00021C28, 0x00021C2A, 0x00021C2C, 0x00021C2E, 0x00021C30,
+            0x00021C32, 0x00021C34, 0x00021C36, 0x00021B67, 0x00031C38, 0x00031C3B, 0x00031C3E, 0x00031C41, 0x00031C44, 0x00031C47,
+            0x00031C4A, 0x00031C4D, 0x00031C50, 0x00041C53, 0x00041C57, 0x00041C5B, 0x00021C5F, 0x00031C61, 0x00021C64, 0x00031C66,
+            0x00411C69, 0x05611C6A, 0x00041C6B, 0x00051C6F, 0x00041C74, 0x00051C78, 0x00031C7D, 0x00051C80, 0x00031C85, 0x00031C88,
+            0x00061C8B, 0x00041C91, 0x00031C95, 0x00031C98, 0x00031C9B, 0x00041C9E, 0x00041CA2, 0x00041CA6, 0x00041CAA, 0x00041CAE,
+            0x00041CB2, 0x00041CB6, 0x00061CBA, 0x00021CC0, 0x00061CC2, 0x00061CC8, 0x00051CCE, 0x00041CD3, 0x00061CD7, 0x00061CDD,
+            0x00041CE3, 0x00031CE7, 0x00031CEA, 0x00041CED, 0x00041CF1, 0x00051CF5, 0x00051CFA, 0x00031CFF, 0x00031D02, 0x00041D05,
+            0x00031D09, 0x00031D0C, 0x00021D0F, 0x00021D11, 0x00031D13, 0x00031D16, 0x00061D19, 0x00041D1F, 0x00051D23, 0x00061D28,
+            0x00041D2E, 0x00031D32, 0x00031D35, 0x00061D38, 0x00041D3E, 0x00061D42, 0x00031D48, 0x00051D4B, 0x00031D50, 0x00041D53,
+            0x00031D57, 0x00041D5A, 0x00051D5E, 0x00041D63, 0x00051D67, 0x00041D6C, 0x00021D70, 0x00051D72, 0x00031D77, 0x00031D7A,
+            0x00041D7D, 0x00031D81, 0x00031D84, 0x00031D87, 0x00051D8A, 0x00041D8F, 0x00021D93, 0x00061D95, 0x00031D9B, 0x00051D9E,
+            0x00041DA3, 0x00041DA7, 0x00031DAB, 0x00031DAE, 0x00041DB1, 0x00021DB5, 0x00041DB7, 0x00051DBB, 0x00021DC0, 0x00061DC2,
+            0x00031DC8, 0x00031DCB, 0x00031DCE, 0x00031DD1, 0x00031DD4, 0x00031DD7, 0x00031DDA, 0x00031DDD, 0x00031DE0, 0x00031DE3,
+            0x00031DE6, 0x00041DE9, 0x00041DED, 0x00041DF1, 0x00041DF5, 0x00041DF9, 0x00041DFD, 0x00041E01, 0x00041E05, 0x00041E09,
+            0x00041E0D, 0x00041E11, 0x00041E15, 0x00041E19, 0x00041E1D, 0x00041E21, 0x00031E25, 0x00021E28, 0x00021E2A, 0x00031E2C,
+            0x00021E2F, 0x00021E31, 0x00021E33, 0x00031E35, 0x00031E38, 0x00021E3B, 0x00041E3D, 0x00041E41, 0x00041E45, 0x00041E49,
+            0x00081E4D, 0x00021E55, 0x00021E57, 0x00021E59, 0x00021E5B, 0x00021E5D, 0x00021E5F, 0x00021E61, 0x00021E63, 0x00031E65,
+            0x00041E68, 0x00021E6C, 0x00021E6E, 0x00021E70, 0x00021E72, 0x00021E74, 0x00021E76, 0x00021E78, 0x00031E7A, 0x00031E7D,
+            0x00031E80, 0x00031E83, 0x00021E86, 0x00021E88, 0x00021E8A, 0x00021E8C, 0x00021E8E, 0x00021E90, 0x00021E92, 0x00021E94,
+            0x00021E96, 0x00021E98, 0x00031E9A, 0x00031E9D, 0x00021EA0, 0x00031EA2, 0x00031EA5, 0x00031EA8, 0x00021EAB, 0x00031EAD,
+            0x00031EB0, 0x00041EB3, 0x00021EB7, 0x00031EB9, 0x00031EBC, 0x00031EBF, 0x00031EC2, 0x00051EC5, 0x00061ECA, 0x00021ED0,
+            0x00021ED2, 0x00021ED4, 0x00021ED6, 0x00021ED8, 0x00021EDA, 0x00021EDC, 0x00021EDE, 0x00021EE0, 0x00021EE2, 0x00021EE4,
+            0x00021EE6, 0x00021EE8, 0x00021EEA, 0x00021EEC, 0x00021EEE, 0x00021EF0, 0x00021EF2, 0x00041EF4, 0x00021EF8, 0x00021EFA,
+            0x00021EFC, 0x00041EFE, 0x00031F02, 0x00021F05, 0x00021F07, 0x00021F09, 0x00021F0B, 0x00021F0D, 0x00021F0F, 0x00021F11,
+            0x00021F13, 0x00021F15, 0x00021F17, 0x00031F19, 0x00021F1C, 0x00021F1E, 0x00031F20, 0x00031F23, 0x00021F26, 0x00041F28,
+            0x00031F2C, 0x00021F2F, 0x00021F31, 0x00021F33, 0x00021F35, 0x00031F37, 0x00031F3A, 0x00031F3D, 0x00031F40, 0x00031F43,
+            0x00031F46, 0x00031F49, 0x00031F4C, 0x00031F4F, 0x00031F52, 0x00031F55, 0x00041F58, 0x00041F5C, 0x00041F60, 0x00041F64,
+            0x00041F68, 0x00041F6C, 0x00041F70, 0x00041F74, 0x00041F78, 0x00041F7C, 0x00041F80, 0x00041F84, 0x00041F88, 0x00041F8C,
+            0x00041F90, 0x00041F94, 0x00041F98, 0x00041F9C, 0x00041FA0, 0x00041FA4, 0x00041FA8, 0x00041FAC, 0x00031FB0, 0x07E11FB3,
+            0x1FE11FB4, 0x1FE11FB5, 0x1FE11FB6, 0x1FE11FB7, 0x11811FB8, 0x06C11FB9, 0x03211FBA, 0x00011FBB, 0x00011FBC, 0x00011FBD,
+            0x00011FBE, 0x01211FBF, 0x00611FC0, 0x00011FC1, 0x00011FC2, 0x00011FC3, 0x00011FC4, 0x1FE11FC5, 0x01811FC6, 0x00011FC7,
+            0x00011FC8, 0x00011FC9, 0x00011FCA, 0x00011FCB, 0x00011FCC, 0x00021FCD, 0x00021FCF, 0x00021FD1, 0x00021FD3, 0x00021FD5,
+            0x00021FD7, 0x00021FD9, 0x00021FDB, 0x00021FDD, 0x00021FDF, 0x00021FE1, 0x00021FE3, 0x00021FE5, 0x01210011, 0x00011FE7,
+            0x00011FE8, 0x00011FE9, 0x00011FEA, 0x00011FEB, 0x00011FEC, 0x00011FED, 0x00011FEE, 0x00011FEF, 0x00011FF0, 0x00011FF1,
+            0x00011FF2, 0x00011FF3, 0x00011FF4, 0x00011FF5, 0x00011FF6, 0x00011FF7, 0x00011FF8, 0x00011FF9, 0x00011FFA, 0x00011FFB,
+            0x00011FFC, 0x00011FFD, 0x00011FFE, 0x00011FFF, 0x00012000, 0x00012001, 0x00012002, 0x00012003, 0x00012004, 0x00012005,
+            0x00012006, 0x00012007, 0x00012008, 0x00012009, 0x0001200A, 0x0001200B, 0x0001200C, 0x0001200D, 0x0001200E, 0x0001200F,
+            0x00012010, 0x00012011, 0x00010C46, 0x00012011, 0x00010C46, 0x00012011, 0x00010C46, 0x00010C46, 0x00012012, 0x00010000,
+            0x00010000, 0x00010000, 0x00012013, 0x00012014, 0x00012015, 0x00022016, 0x00012018, 0x00010C49, 0x00012019, 0x0001201A,
+            0x0001201B, 0x000103E9, 0x000103E9, 0x0001201C, 0x0001201D, 0x0001201E, 0x0001201F, 0x00012020, 0x00012021, 0x00012022,
+            0x00012023, 0x00012024, 0x00012025, 0x00012026, 0x00012027, 0x00012028, 0x00012029, 0x0001202A, 0x0001202B, 0x0001202C,
+            0x0001202D, 0x0001202E, 0x0001202F, 0x00012030, 0x00012031, 0x00012032, 0x00012033, 0x00012034, 0x00012035, 0x00012011,
+            0x00010C46, 0x00012011, 0x00010C46, 0x00012036, 0x00012037, 0x00012038, 0x00012039, 0x09E1203A, 0x0001203B, 0x0001203C,
+            0x0001203D, 0x0001203E, 0x0001203F, 0x00012040, 0x00012041, 0x00012042, 0x04212043, 0x00012044, 0x00012045, 0x00012046,
+            0x00012047, 0x00012048, 0x00012049, 0x0002204A, 0x0002204C, 0x0001204E, 0x0001204F, 0x00012050, 0x00012051, 0x00012052,
+            0x00012053, 0x00012054, 0x00012055, 0x00022056, 0x00022058, 0x0002205A, 0x00020D37, 0x0002205C, 0x0002205E, 0x00022060,
+            0x00020D39, 0x00032062, 0x00032065, 0x00022068, 0x0002206A, 0x0001206C, 0x0001206D, 0x0001206E, 0x0001206F, 0x00012070,
+            0x00012071, 0x00012072, 0x00012073, 0x00012074, 0x00012075, 0x00012076, 0x00012077, 0x00012078, 0x00012079, 0x0001207A,
+            0x0001207B, 0x0002207C, 0x0002207E, 0x00012080, 0x00012081, 0x00012082, 0x00012083, 0x00012084, 0x00012085, 0x00012086,
+            0x00012087, 0x00012088, 0x00012089, 0x0001208A, 0x0001208B, 0x0001208C, 0x0001208D, 0x0001208E, 0x0001208F, 0x00022090,
+            0x00022092, 0x00012094, 0x00012095, 0x00012096, 0x00012097, 0x00012098, 0x00012099, 0x0001209A, 0x0001209B, 0x0001209C,
+            0x0001209D, 0x0001209E, 0x0001209F, 0x000120A0, 0x000120A1, 0x000120A2, 0x000120A3, 0x000120A4, 0x000120A5, 0x000120A6,
+            0x002120A7, 0x000120A8, 0x000120A9, 0x000220AA, 0x00020D3D, 0x000220AC, 0x000220AE, 0x000220B0, 0x000120B2, 0x000120B3,
+            0x000120B4, 0x000120B5, 0x000220B6, 0x000220B8, 0x000220BA, 0x000201F3, 0x000220BC, 0x000220BE, 0x004120C0, 0x000120C1,
+            0x000120C2, 0x000120C3, 0x000120C4, 0x000120C5, 0x000120C6, 0x000120C7, 0x000120C8, 0x002120C9, 0x000120CA, 0x000120CB,
+            0x000120CC, 0x000120CD, 0x000120CE, 0x000220CF, 0x00020D57, 0x000220D1, 0x00020D59, 0x000220D3, 0x00020D5B, 0x000220D5,
+            0x000220D7, 0x000220D9, 0x000220DB, 0x000220DD, 0x000220DF, 0x000220E1, 0x000220E3, 0x000220E5, 0x000220E7, 0x000120E9,
+            0x000120EA, 0x000120EB, 0x000120EC, 0x000120ED, 0x000120EE, 0x000120EF, 0x000120F0, 0x000120F1, 0x000120F2, 0x000120F3,
+            0x000120F4, 0x000120F5, 0x000120F6, 0x000120F7, 0x000120F8, 0x000120F9, 0x000120FA, 0x000120FB, 0x000120FC, 0x000120FD,
+            0x000120FE, 0x000120FF, 0x00012100, 0x00012101, 0x00012102, 0x00012103, 0x00012104, 0x00012105, 0x00012106, 0x00012107,
+            0x00012108, 0x00012109, 0x0001210A, 0x0002210B, 0x0003210D, 0x00012110, 0x00012111, 0x00012112, 0x00012113, 0x00012114,
+            0x00012115, 0x00C12116, 0x00612117, 0x00010780, 0x03612118, 0x00612119, 0x0001211A, 0x00A1211B, 0x0021211C, 0x0001211D,
+            0x0001211E, 0x00E1211F, 0x01612120, 0x00612121, 0x00012122, 0x00212123, 0x00212124, 0x00012125, 0x00612126, 0x00612127,
+            0x00012128, 0x00012129, 0x0001212A, 0x0061212B, 0x0001212C, 0x0001212D, 0x0021212E, 0x0021212F, 0x00012130, 0x00212131,
+            0x00212132, 0x00010780, 0x00010781, 0x08412133, 0x0001077F, 0x00212134, 0x01210011, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00012135, 0x00012136, 0x00012136, 0x00012136, 0x00012136,
+            0x00012136, 0x00412137, 0x00012138, 0x00012139, 0x0001213A, 0x0001213B, 0x0001213C, 0x01210011, 0x0401213D, 0x0001213E,
+            0x0001213F, 0x00012140, 0x00012141, 0x00012142, 0x04612143, 0x00012144, 0x03812145, 0x0001077F, 0x00010780, 0x00012146,
+            0x00010781, 0x04C12147, 0x00012148, 0x00012149, 0x00A1214A, 0x00010797, 0x0001214B, 0x0001214C, 0x0061214D, 0x0021214E,
+            0x0001214F, 0x00012150, 0x00012151, 0x00012152, 0x00012153, 0x00A12154, 0x00012155, 0x00212156, 0x00612157, 0x00012158,
+            0x01210011, 0x00212159, 0x0001215A, 0x0001215B, 0x0001215C, 0x0001215D, 0x0001215E, 0x0001215F, 0x00012160, 0x00012161,
+            0x00012162, 0x00012163, 0x00012164, 0x00012165, 0x00012166, 0x00012167, 0x00012168, 0x00012169, 0x01210011, 0x0001216A,
+            0x0001216B, 0x0001216C, 0x0001216D, 0x0001216E, 0x0501216F, 0x01212170, 0x00612171, 0x01A12172, 0x01210011, 0x00012173,
+            0x00412174, 0x00012175, 0x00012176, 0x00012177, 0x00012178, 0x00012179, 0x0001217A, 0x0001217B, 0x0001217C, 0x0001217D,
+            0x0001217E, 0x0001217F, 0x00012180, 0x00012181, 0x00012182, 0x00012183, 0x00012184, 0x00012185, 0x00012186, 0x00012187,
+            0x00012188, 0x00412189, 0x0041218A, 0x0001218B, 0x0041218C, 0x0001218D, 0x0001218E, 0x0681218F, 0x20012190, 0x20012191,
+            0x00212192, 0x20012193, 0x00012194, 0x20012195, 0x20012196, 0x00212197, 0x00012198, 0x00012199, 0x0001219A, 0x0001219B,
+            0x0021219C, 0x0001219D, 0x0021219E, 0x0141219F, 0x008121A0, 0x000121A1, 0x000121A2, 0x000121A3, 0x002121A4, 0x000121A5,
+            0x000121A6, 0x00A121A7, 0x00A121A8, 0x00A121A9, 0x00C121AA, 0x00C121AB, 0x000121AC, 0x000121AD, 0x002121AE, 0x000121AF,
+            0x000121B0, 0x000121B1, 0x000121B2, 0x002121B3, 0x000121B4, 0x000121B5, 0x000121B6, 0x000121B7, 0x000121B8, 0x000121B9,
+            0x000121BA, 0x002121BB, 0x002121BC, 0x000121BD, 0x000121BE, 0x002121BF, 0x000121C0, 0x004121C1, 0x000121C2, 0x000121C3,
+            0x000121C4, 0x002121C5, 0x000121C6, 0x004121C7, 0x006121C8, 0x000121C9, 0x000121CA, 0x000121CB, 0x000121CC, 0x000121CD,
+            0x000121CE, 0x002121CF, 0x000121D0, 0x000121D1, 0x000121D2, 0x000121D3, 0x000221D4, 0x000221D6, 0x000121D8, 0x000121D9,
+            0x002121DA, 0x09E121DB, 0x034121DC, 0x00E121DD, 0x00E121DE, 0x000121DF, 0x000121E0, 0x000121E1, 0x01210011, 0x02C121E2,
+            0x060121E3, 0x000221E4, 0x000221E6, 0x000221E8, 0x000221EA, 0x000221EC, 0x000221EE, 0x000221F0, 0x000221F2, 0x000221F2,
+            0x000221F4, 0x000221F6, 0x000221F8, 0x000221FA, 0x000221FC, 0x000221FE, 0x00022200, 0x00022202, 0x00022204, 0x00022206,
+            0x00022208, 0x0002220A, 0x0002220C, 0x0002220E, 0x00022210, 0x00022212, 0x00022214, 0x00022216, 0x00022218, 0x0002221A,
+            0x0002221C, 0x0002221E, 0x00022220, 0x00022222, 0x00022224, 0x00022226, 0x00022228, 0x0002222A, 0x0002222C, 0x0002222E,
+            0x00022230, 0x00022232, 0x00022234, 0x00022236, 0x00022238, 0x0002223A, 0x0002223C, 0x0002223E, 0x00022240, 0x00022242,
+            0x00022244, 0x00022246, 0x00022248, 0x0002224A, 0x0002224C, 0x0002224E, 0x00022250, 0x00022252, 0x00022254, 0x00022256,
+            0x00022258, 0x0002225A, 0x0002225C, 0x0002225E, 0x00022260, 0x00022262, 0x00022264, 0x00022266, 0x00022268, 0x0002226A,
+            0x0002226C, 0x0002226E, 0x00022270, 0x00022272, 0x00022274, 0x00022276, 0x00022278, 0x0002227A, 0x0002227C, 0x0002227E,
+            0x00022280, 0x00022282, 0x00022284, 0x00022286, 0x00022288, 0x0002228A, 0x0002228C, 0x0002228E, 0x00022290, 0x00022292,
+            0x00022294, 0x00022296, 0x00022298, 0x0002220A, 0x0002229A, 0x0002229C, 0x0002229E, 0x000222A0, 0x000222A2, 0x000222A4,
+            0x000222A6, 0x000222A8, 0x000222AA, 0x000222AC, 0x000222AE, 0x000222B0, 0x000222B2, 0x000222B4, 0x000222B6, 0x000222B8,
+            0x000222BA, 0x000222BC, 0x000222BE, 0x000222C0, 0x000222C2, 0x000222C4, 0x000222C6, 0x000222C8, 0x000222CA, 0x000222CC,
+            0x000222CE, 0x000222D0, 0x000222D2, 0x000222D4, 0x000222D6, 0x000222D8, 0x000222DA, 0x000222DC, 0x000222DE, 0x000222E0,
+            0x000222E2, 0x000222E4, 0x000222E6, 0x000222E8, 0x000222EA, 0x000222EC, 0x000222EE, 0x000222F0, 0x000222F2, 0x000222F4,
+            0x000222F6, 0x000222F8, 0x000222FA, 0x000222FC, 0x000222FE, 0x00022300, 0x00022302, 0x00022304, 0x00022306, 0x00022308,
+            0x0002230A, 0x0002230C, 0x0002230E, 0x00022310, 0x00022312, 0x00022314, 0x00022316, 0x00022318, 0x0002231A, 0x0002231C,
+            0x0002231E, 0x00022320, 0x000222BE, 0x00022322, 0x00022324, 0x00022326, 0x00022328, 0x0002232A, 0x0002232C, 0x0002232E,
+            0x00022330, 0x0002229E, 0x00022332, 0x00022334, 0x00022336, 0x00022338, 0x0002233A, 0x0002233C, 0x0002233E, 0x00022340,
+            0x00022342, 0x00022344, 0x00022346, 0x00022348, 0x0002234A, 0x0002234C, 0x0002234E, 0x00022350, 0x00022352, 0x00022354,
+            0x00022356, 0x00022358, 0x0002220A, 0x0002235A, 0x0002235C, 0x0002235E, 0x00022360, 0x00022362, 0x00022364, 0x00022366,
+            0x00022368, 0x0002236A, 0x0002236C, 0x0002236E, 0x00022370, 0x00022372, 0x00022374, 0x00022376, 0x00022378, 0x0002237A,
+            0x0002237C, 0x0002237E, 0x00022380, 0x00022382, 0x00022384, 0x00022386, 0x00022388, 0x0002238A, 0x0002238C, 0x0002238E,
+            0x000222A2, 0x00022390, 0x00022392, 0x00022394, 0x00022396, 0x00022398, 0x0002239A, 0x0002239C, 0x0002239E, 0x000223A0,
+            0x000223A2, 0x000223A4, 0x000223A6, 0x000223A8, 0x000223AA, 0x000223AC, 0x000223AE, 0x000223B0, 0x000223B2, 0x000223B4,
+            0x000223B6, 0x000223B8, 0x000223BA, 0x000223BC, 0x000223BE, 0x000223C0, 0x000223C2, 0x000223C4, 0x000223C6, 0x000223C8,
+            0x000223CA, 0x000223CC, 0x000223CE, 0x000223D0, 0x000223D2, 0x000223D4, 0x000223D6, 0x000223D8, 0x000223DA, 0x000223DC,
+            0x000223DE, 0x000223E0, 0x000223E2, 0x000223E4, 0x000223E6, 0x000223E8, 0x000223EA, 0x000223EC, 0x000223EE, 0x000223F0,
+            0x000223F2, 0x000223F4, 0x000223F6, 0x000223F8, 0x000223FA, 0x000223FC, 0x000223FE, 0x00022400, 0x00022402, 0x00022404,
+            0x00022406, 0x00022408, 0x0002240A, 0x0002240C, 0x0002240E, 0x00022410, 0x00022412, 0x00022414, 0x00022416, 0x00022418,
+            0x0002241A, 0x0002241C, 0x0002241E, 0x00022420, 0x00022422, 0x00022424, 0x00022426, 0x00022428, 0x0002242A, 0x0002242C,
+            0x0002242E, 0x00022430, 0x00022432, 0x00022434, 0x00022436, 0x00022438, 0x0002243A, 0x0002243C, 0x0002243E, 0x00022440,
+            0x00022442, 0x00022444, 0x00022446, 0x00022448, 0x0002244A, 0x0002244C, 0x0002244E, 0x00022450, 0x00022452, 0x00022454,
+            0x00022456, 0x00022458, 0x0002245A, 0x0002245C, 0x0002245E, 0x00022460, 0x00022462, 0x00022464, 0x00022466, 0x00022468,
+            0x0002246A, 0x0002246C, 0x0002246E, 0x00022470, 0x00022472, 0x00022474, 0x00022476, 0x00022478, 0x0002247A, 0x0002247C,
+            0x0002247E, 0x00022480, 0x00022482, 0x00022484, 0x0002230C, 0x00022486, 0x00022488, 0x0002248A, 0x0002248C, 0x0002248E,
+            0x00022490, 0x00022490, 0x00022492, 0x00022494, 0x00022496, 0x00022498, 0x0002249A, 0x0002249C, 0x0002249E, 0x000224A0,
+            0x00022422, 0x000224A2, 0x000224A4, 0x000224A6, 0x000224A8, 0x000224AA, 0x000224AC, 0x000224AE, 0x000224B0, 0x000224B2,
+            0x000224B4, 0x000224B6, 0x000224B8, 0x000224BA, 0x000224BC, 0x00022444, 0x000224BE, 0x000224C0, 0x000224C2, 0x000223F8,
+            0x000224C4, 0x000224C6, 0x000224C8, 0x000224CA, 0x000224CC, 0x000224CE, 0x000224D0, 0x000224D2, 0x000224D4, 0x000224D6,
+            0x000224D8, 0x000224DA, 0x00022456, 0x000224DC, 0x00022458, 0x000224DE, 0x000224E0, 0x000224E2, 0x000224E4, 0x000224E6,
+            0x000223FC, 0x00022234, 0x000224E8, 0x000224EA, 0x000224EC, 0x000222C0, 0x0002236E, 0x000224EE, 0x000224F0, 0x00022466,
+            0x000224F2, 0x00022468, 0x000224F4, 0x000224F6, 0x000224F8, 0x00022404, 0x000224FA, 0x000224FC, 0x000224FE, 0x00022500,
+            0x00022502, 0x00022406, 0x00022504, 0x00022506, 0x00022508, 0x0002250A, 0x0002250C, 0x0002250E, 0x00022484, 0x00022510,
+            0x00022512, 0x0002230C, 0x00022514, 0x0002248C, 0x00022516, 0x00022518, 0x0002251A, 0x0002251C, 0x0002251E, 0x00022496,
+            0x00022520, 0x0002241C, 0x00022522, 0x00022498, 0x0002229A, 0x00022524, 0x0002249A, 0x00022526, 0x0002249E, 0x00022528,
+            0x0002252A, 0x0002252C, 0x0002252E, 0x00022530, 0x000224A2, 0x00022410, 0x00022532, 0x000224A4, 0x00022534, 0x000224A6,
+            0x00022536, 0x000221F2, 0x00022538, 0x0002253A, 0x0002253C, 0x0002253E, 0x00022540, 0x00022542, 0x00022544, 0x00022546,
+            0x00022548, 0x0002254A, 0x0002254C, 0x0002254E, 0x00022550, 0x00022552, 0x00032554, 0x00032557, 0x0003255A, 0x0002255D,
+            0x0002255F, 0x00022561, 0x00022563, 0x00022565, 0x00022567, 0x00022569, 0x0001256B, 0x0003256C, 0x0001256F, 0x00012570,
+            0x00212571, 0x00412572, 0x00012573, 0x00012574, 0x00012575, 0x00022576, 0x00022578, 0x0003257A, 0x0003257D, 0x00022580,
+            0x00022582, 0x00022584, 0x00022586, 0x00022588, 0x0002258A, 0x0002258C, 0x0002258E, 0x00022590, 0x00022592, 0x00022594,
+            0x00022596, 0x00022598, 0x0002259A, 0x0002259C, 0x0002259E, 0x000225A0, 0x000225A2, 0x000225A4, 0x000225A6, 0x000225A8,
+            0x000225AA, 0x000225AC, 0x000225AE, 0x000225B0, 0x000225B2, 0x000225B4, 0x000225B6, 0x000225B8, 0x000125BA, 0x000125BB,
+            0x000125BC, 0x000125BD, 0x000125BE, 0x000125BF, 0x000125C0, 0x000125C1, 0x000125C2, 0x000125C3, 0x000125C4, 0x000125C5,
+            0x000125C6, 0x000125C7, 0x000125C8, 0x000125C9, 0x000125CA, 0x000125CB, 0x000125CC, 0x000125CD, 0x000125CE, 0x000125CF,
+            0x000125D0, 0x000125D1, 0x000125D2, 0x000125D3, 0x000125D4, 0x000125D5, 0x000125D6, 0x000125D7, 0x000125D8, 0x000125D9,
+            0x000125DA, 0x000125DB, 0x000125DC, 0x000125DD, 0x000125DE, 0x000125DF, 0x000125E0, 0x000125E1, 0x000125E2, 0x000125E3,
+            0x000125E4, 0x000125E5, 0x000125E6, 0x000125E7, 0x000125E8, 0x000125E9, 0x000125EA, 0x000125EB, 0x000125EC, 0x000125ED,
+            0x000125EE, 0x000125EF, 0x000125F0, 0x000125F1, 0x000125F2, 0x000125F3, 0x000125F4, 0x000125F5, 0x000125F6, 0x000125F7,
+            0x000125F8, 0x000125F9, 0x000125FA, 0x000125FB, 0x000125FC, 0x000125FD, 0x000125FE, 0x000125FF, 0x00012600, 0x00012601,
+            0x00012602, 0x00012603, 0x00012604, 0x00012605, 0x00012606, 0x00012607, 0x00012608, 0x00012609, 0x0001260A, 0x0001260B,
+            0x0001260C, 0x0001260D, 0x0002260E, 0x00022610, 0x00012612, 0x00012613, 0x00012614, 0x00012615, 0x00012616, 0x00012617,
+            0x00012618, 0x00012619, 0x0001261A, 0x0001261B, 0x0002261C, 0x0002261E, 0x01E12620, 0x00012621, 0x00012622, 0x00012623,
+            0x00012624, 0x00012625, 0x00012626, 0x00012627, 0x00012628, 0x00012629, 0x0001262A, 0x0002262B, 0x0001262D, 0x0001262E,
+            0x0001262F, 0x00012630, 0x00012631, 0x00012632, 0x00012633, 0x00012634, 0x00012635, 0x00012636, 0x00012637, 0x00012638,
+            0x00022639, 0x0002263B, 0x0002263D, 0x0002263F, 0x00022641, 0x00022643, 0x00022645, 0x00022647, 0x00022649, 0x0002264B,
+            0x0002264D, 0x0002264F, 0x00022651, 0x00022653, 0x00022655, 0x00022657, 0x00022659, 0x0002265B, 0x0001265D, 0x0001265E,
+            0x0001265F, 0x00012660, 0x00022661, 0x00022663, 0x00022665, 0x00022657, 0x00022667, 0x00022669, 0x0002266B, 0x0002266D,
+            0x0002266F, 0x00022671, 0x00022673, 0x00022675, 0x00022677, 0x00022679, 0x0002267B, 0x0002267D, 0x0002267F, 0x00022681,
+            0x00022683, 0x00022685, 0x00022687, 0x00022689, 0x0002268B, 0x0002268D, 0x0002268F, 0x00022691, 0x00022693, 0x00022695,
+            0x00022697, 0x00022699, 0x0002269B, 0x0002269D, 0x0002269F, 0x000226A1, 0x000226A3, 0x000226A5, 0x000226A7, 0x000226A9,
+            0x000226AB, 0x000226AD, 0x000226AF, 0x000226B1, 0x000226B3, 0x000226B5, 0x000226B7, 0x000226B9, 0x000226BB, 0x000226BD,
+            0x000226BF, 0x000226C1, 0x000226C3, 0x000226C5, 0x000226C7, 0x000226C9, 0x000226CB, 0x000226CD, 0x000226CF, 0x000226D1,
+            0x000226D3, 0x000226D5, 0x000226D7, 0x000226D9, 0x000226DB, 0x000226DD, 0x000226DF, 0x000226E1, 0x000226E3, 0x000226E5,
+            0x000226E7, 0x000226E9, 0x000226EB, 0x000226ED, 0x000226EF, 0x000226F1, 0x000226F3, 0x000226F5, 0x000226F7, 0x000226F9,
+            0x000226FB, 0x000226FD, 0x000226FF, 0x00022701, 0x00022703, 0x00022705, 0x00022707, 0x00022709, 0x0002270B, 0x0002270D,
+            0x0002270F, 0x00022711, 0x00022713, 0x00022715, 0x00022717, 0x00022719, 0x0002271B, 0x0002271D, 0x0002271F, 0x00022721,
+            0x00022723, 0x00022725, 0x00022727, 0x00022729, 0x0002272B, 0x0002272D, 0x00022659, 0x0002272F, 0x00022731, 0x00022733,
+            0x00022735, 0x00022737, 0x00022739, 0x0002273B, 0x0002273D, 0x0002273F, 0x00022741, 0x00022743, 0x00022745, 0x00022747,
+            0x00022749, 0x0002274B, 0x0002274D, 0x0002274F, 0x00022751, 0x00022753, 0x00022755, 0x00022757, 0x00022759, 0x0002275B,
+            0x0002275D, 0x0002275F, 0x00022761, 0x00022763, 0x00022765, 0x00022767, 0x00022769, 0x0002276B, 0x0002276D, 0x0002276F,
+            0x00022771, 0x00022773, 0x00022775, 0x00022777, 0x00022779, 0x0002277B, 0x0002277D, 0x0002277F, 0x00022781, 0x00022783,
+            0x00022785, 0x00022787, 0x00022789, 0x0002278B, 0x0002278D, 0x0002278F, 0x00022791, 0x00022793, 0x00022795, 0x00022797,
+            0x00022799, 0x0002279B, 0x0002279D, 0x0002279F, 0x000227A1, 0x000227A3, 0x000227A5, 0x000227A7, 0x000227A9, 0x000227AB,
+            0x000227AD, 0x000227AF, 0x000227B1, 0x000227B3, 0x000227B5, 0x000227B7, 0x000227B9, 0x000227BB, 0x000227BD, 0x000227BF,
+            0x000227C1, 0x000227C3, 0x000227C5, 0x000227C7, 0x000227C9, 0x000227CB, 0x000227CD, 0x000227CF, 0x000227D1, 0x000227D3,
+            0x000227D5, 0x000227D7, 0x000227D9, 0x000227DB, 0x000227DD, 0x000227DF, 0x000227E1, 0x000227E3, 0x000227E5, 0x000227E7,
+            0x000227E9, 0x000227EB, 0x000227ED, 0x000227EF, 0x000227F1, 0x000227F3, 0x000227F5, 0x000227F7, 0x000227F9, 0x000227FB,
+            0x000227FD, 0x000227FF, 0x00022801, 0x00022803, 0x00022805, 0x00022807, 0x00022809, 0x0002280B, 0x0002280D, 0x0002280F,
+            0x00022811, 0x00022813, 0x00022815, 0x00022817, 0x00022819, 0x0002281B, 0x0002281D, 0x0002281F, 0x00022821, 0x00022823,
+            0x00022825, 0x00022827, 0x00022829, 0x0002282B, 0x0002282D, 0x0002282F, 0x00022831, 0x00022833, 0x00022835, 0x00022837,
+            0x00022839, 0x0002283B, 0x0002283D, 0x0002283F, 0x00022841, 0x00022843, 0x00022845, 0x00022847, 0x00022849, 0x0002284B,
+            0x0002284D, 0x0002284F, 0x00022851, 0x00022853, 0x00022855, 0x00022857, 0x00022859, 0x0002285B, 0x0002285D, 0x0002285F,
+            0x00022861, 0x00022863, 0x00022865, 0x00022867, 0x00022869, 0x0002286B, 0x0002286D, 0x0002286F, 0x00022871, 0x00022873,
+            0x00022875, 0x00022877, 0x00022879, 0x0002287B, 0x0002287D, 0x0002287F, 0x00022881, 0x00022883, 0x00022885, 0x00022887,
+            0x00022889, 0x0002288B, 0x0002288D, 0x0002288F, 0x00022891, 0x00022893, 0x00022895, 0x00022897, 0x00022899, 0x0002289B,
+            0x0002289D, 0x0002289F, 0x000228A1, 0x000228A3, 0x000228A5, 0x000228A7, 0x000228A9, 0x000228AB, 0x000228AD, 0x000228AF,
+            0x000228B1, 0x000228B3, 0x000228B5, 0x000228B7, 0x000228B9, 0x000228BB, 0x000228BD, 0x000228BF, 0x000228C1, 0x000228C3,
+            0x000228C5, 0x000228C7, 0x000228C9, 0x000228CB, 0x000228CD, 0x000228CF, 0x000228D1, 0x000228D3, 0x000228D5, 0x000228D7,
+            0x002128D9, 0x000328DA, 0x000328DD, 0x000328E0, 0x000328E3, 0x000328E6, 0x000328E9, 0x000328EC, 0x000328EF, 0x000328F2,
+            0x000328F5, 0x000328F8, 0x000328FB, 0x000328FE, 0x00032901, 0x00032904, 0x00032907, 0x0003290A, 0x0003290D, 0x00032910,
+            0x00032913, 0x00032916, 0x00032919, 0x0003291C, 0x0003291F, 0x00032922, 0x00032925, 0x00032928, 0x0003292B, 0x0003292E,
+            0x00032931, 0x00032934, 0x00032937, 0x0003293A, 0x0003293D, 0x00032940, 0x00032943, 0x00032946, 0x00032949, 0x0003294C,
+            0x0003294F, 0x00032952, 0x00032955, 0x00032958, 0x0003295B, 0x0003295E, 0x00032961, 0x00032964, 0x00032967, 0x0003296A,
+            0x0003296D, 0x00032970, 0x00032973, 0x00032976, 0x00032979, 0x0003297C, 0x0003297F, 0x00032982, 0x00032985, 0x00032988,
+            0x0003298B, 0x0003298E, 0x00032991, 0x00032994, 0x00032997, 0x0003299A, 0x0003299D, 0x000329A0, 0x000329A3, 0x000329A6,
+            0x000329A9, 0x000329AC, 0x000329AF, 0x000329B2, 0x000329B5, 0x000329B8, 0x000329BB, 0x000329BE, 0x000329C1, 0x000329C4,
+            0x000329C7, 0x000329CA, 0x000329CD, 0x000329D0, 0x000329D3, 0x000329D6, 0x000329D9, 0x000329DC, 0x000329DF, 0x000329E2,
+            0x000329E5, 0x000329E8, 0x000329EB, 0x000329EE, 0x000329F1, 0x000329F4, 0x000329F7, 0x000329FA, 0x000329FD, 0x00032A00,
+            0x00032A03, 0x00032A06, 0x00032A09, 0x00032A0C, 0x00032A0F, 0x00032A12, 0x00032A15, 0x00032A18, 0x00032A1B, 0x00032A1E,
+            0x00032A21, 0x00032A24, 0x00032A27, 0x00032A2A, 0x00032A2D, 0x00032A30, 0x00032A33, 0x00032A36, 0x00032A39, 0x00032A3C,
+            0x00032A3F, 0x00042A42, 0x00042A46, 0x00042A4A, 0x00042A4E, 0x00042A52, 0x00042A56, 0x00042A5A, 0x00032A5E, 0x00122A61,
+            0x00082A73, 0x00042A7B, 0x00012A7F, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00012A80,
+            0x00012A81, 0x00012A82, 0x00012A83, 0x00012A84, 0x00012A85, 0x00012A86, 0x00212A87, 0x00032A88, 0x00010409, 0x00010000,
+            0x00010408, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x000103EF, 0x00010000, 0x00010408, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x0001052D, 0x00010000, 0x00022A8B, 0x00012A8D, 0x00012A8E, 0x00012A8F, 0x00012A8F, 0x00212A90,
+            0x00212A91, 0x00212A92, 0x00212A93, 0x00212A94, 0x00212A95, 0x00612A96, 0x00212A97, 0x00212A98, 0x00012A99, 0x00012A99,
+            0x00012A99, 0x00212A99, 0x00012A9A, 0x00012A9A, 0x00012A9B, 0x00012A9C, 0x00012A9D, 0x00012A9E, 0x00012A9F, 0x00012AA0,
+            0x00012AA1, 0x00012AA2, 0x00212AA3, 0x00212AA4, 0x00212AA5, 0x00012AA6, 0x00012AA7, 0x00012AA8, 0x00012AA9, 0x00012AAA,
+            0x00012AAB, 0x00012AAC, 0x00012AAD, 0x00012AAE, 0x00012AAF, 0x00012AB0, 0x00012AB1, 0x00012AB2, 0x00012AB3, 0x00012AB4,
+            0x00010000, 0x00012AB5, 0x00012AB6, 0x00012AB7, 0x00012AB8, 0x00012AB9, 0x00012ABA, 0x00012ABB, 0x00012ABC, 0x00012ABD,
+            0x00012ABE, 0x00012ABF, 0x00212AC0, 0x00012AC1, 0x00012AC2, 0x00012AC3, 0x00012AC4, 0x00012AC5, 0x00012AC6, 0x00012AC7,
+            0x00012AC8, 0x00012AC9, 0x00012ACA, 0x00012ACB, 0x00012ACC, 0x00012ACD, 0x00012ACE, 0x00012ACF, 0x00012AD0, 0x00012AD1,
+            0x00012AD2, 0x00012AD3, 0x00012AD4, 0x00012AD5, 0x00012AD6, 0x00012AD7, 0x00012AD8, 0x00012AD9, 0x00012ADA, 0x00012ADB,
+            0x00012ADC, 0x00012ADD, 0x00012ADE, 0x00012ADF, 0x00012AE0, 0x00012AE1, 0x00012AE2, 0x00012AE3, 0x00012AE4, 0x00012AE5,
+            0x00012AE6, 0x00012AE7, 0x00012AE8, 0x00012AE9, 0x00012AEA, 0x00012AEB, 0x00012AEC, 0x00012AED, 0x00012AEE, 0x00012AEF,
+            0x00012AF0, 0x00012AF1, 0x00012AF2, 0x00012AF3, 0x00012AF4, 0x00012AF5, 0x00012AF6, 0x00012AF7, 0x00012AF8, 0x00012AF9,
+            0x00012AFA, 0x00012AFB, 0x00012AFC, 0x00012AFD, 0x00012AFE, 0x00012AFF, 0x00012B00, 0x00012B01, 0x00012B02, 0x00012B03,
+            0x00012B04, 0x00012B05, 0x00012B06, 0x00012B07, 0x00012B08, 0x00012B09, 0x00012B0A, 0x00012B0B, 0x00012B0C, 0x00012B0D,
+            0x00012B0E, 0x00012B0F, 0x00012B10, 0x00012B11, 0x00012B12, 0x00012B13, 0x00012B14, 0x00012B15, 0x00012B16, 0x00012B17,
+            0x00012B18, 0x00012B19, 0x00012B1A, 0x00012B1B, 0x00012B1C, 0x00012B1D, 0x00012B1E, 0x00012B1F, 0x00012B20, 0x00012B21,
+            0x00012B22, 0x00012B23, 0x00012B24, 0x00012B25, 0x00012B26, 0x00012B27, 0x00012B28, 0x00012B29, 0x00012B2A, 0x00012B2B,
+            0x00012B2C, 0x00012B2D, 0x00012B2E, 0x00012B2F, 0x00012B30, 0x00012B31, 0x00012B32, 0x00012B33, 0x00022B34, 0x00022B36,
+            0x00022B38, 0x00022B3A, 0x00022B3C, 0x00022B3E, 0x00022B40, 0x00022B42, 0x00010000, 0x00012B44, 0x00012B45, 0x00012B46,
+            0x00012B47, 0x00012B48, 0x00012B49, 0x00012B4A, 0x00212B4B, 0x00012B4C, 0x00012B4D, 0x00012B4E, 0x00012B4F, 0x00012B50,
+            0x00012B51, 0x01212B52, 0x00012B53, 0x00012B54, 0x00412B55, 0x00012B56, 0x00012B57, 0x00012B58, 0x00012B59, 0x00012B5A,
+            0x00012B5B, 0x00012B5C, 0x00012B5D, 0x00012B5E, 0x00012B5F, 0x00012B60, 0x00012B61, 0x00012B62, 0x00012B63, 0x00012B64,
+            0x00012B65, 0x00012B66, 0x00012B67, 0x00012B68, 0x00012B69, 0x00012B6A, 0x00012B6B, 0x00012B6C, 0x00012B6D, 0x00012B6E,
+            0x00012B6F, 0x00012B70, 0x00012B71, 0x00012B72, 0x00012B73, 0x00012B74, 0x00012B75, 0x00012B76, 0x00012B77, 0x00012B78,
+            0x00012B79, 0x00012B7A, 0x00012B7B, 0x00012B7C, 0x00012B7D, 0x00012B7E, 0x00012B7F, 0x00012B80, 0x00012B81, 0x00012B82,
+            0x00012B83, 0x00012B84, 0x00012B85, 0x00012B86, 0x00012B87, 0x00012B88, 0x00012B89, 0x00012B8A, 0x00012B8B, 0x00012B8C,
+            0x00012B8D, 0x00012B8E, 0x00012B8F, 0x00012B90, 0x00012B91, 0x00012B92, 0x00012B93, 0x00012B94, 0x00012B95, 0x00212B96,
+            0x00012B97, 0x00212B98, 0x00012B99, 0x00012B9A, 0x00012B9B, 0x00412B9C, 0x00212B9D, 0x00412B9E, 0x00012B9F, 0x00012BA0,
+            0x00412BA1, 0x05012BA2, 0x00012BA3, 0x00012BA4, 0x00012BA5, 0x00012BA6, 0x00212BA7, 0x00012BA8, 0x00012BA9, 0x00212BAA,
+            0x00412BAB, 0x00A12BAC, 0x00012BAD, 0x00412BAE, 0x00012BAF, 0x01212BB0, 0x00A12BB1, 0x00A12BB2, 0x00A12BB3, 0x00412BB4,
+            0x00012BB5, 0x00012BB6, 0x00012BB7, 0x00012BB8, 0x00012BB9, 0x00012BBA, 0x00012BBB, 0x00012BBC, 0x00012BBD, 0x00012BBE,
+            0x00012BBF, 0x00012BC0, 0x00012BC1, 0x00012BC2, 0x00010000, 0x00010000, 0x00010000, 0x00012BC3, 0x00012BC4, 0x01612BC5,
+            0x03212BC6, 0x02412BC7, 0x00212BC8, 0x01C12BC9, 0x01A12BCA, 0x0F412BCB, 0x00412BCC, 0x0101086C, 0x04612BCD, 0x01012BCE,
+            0x00212BCF, 0x0001086C, 0x00012BD0, 0x00612BD1, 0x00012BD0, 0x00A12BD2, 0x00012BD0, 0x00E12BD3, 0x0001086C, 0x0001086C,
+            0x0021086C, 0x00012BD4, 0x00012BD4, 0x00012BD4, 0x00012BD0, 0x02412BD5, 0x00012BD0, 0x00812BD6, 0x02012BD7, 0x00010011,
+            0x00012BD8, 0x00412BD9, 0x01812BDA, 0x00012BDB, 0x05812BDC, 0x00012BDD, 0x03812BDE, 0x06012BDF, 0x00010000, 0x0101086C,
+            0x02212BE0, 0x01C12BE1, 0x01E12BE2, 0x00012BE3, 0x0001086C, 0x00012BD0, 0x00212BE4, 0x03A12BE5, 0x04A12BE6, 0x00012BE7,
+            0x00012BE8, 0x00012BE9, 0x00012BEA, 0x00012BEB, 0x03A12BEC, 0x00012BED, 0x04612BEE, 0x00E12BEF, 0x00012BF0, 0x0021086C,
+            0x00412BF1, 0x04E12BF2, 0x0AE12BF3, 0x03A12BF4, 0x01210011, 0x04612BF5, 0x04612BF6, 0x04E12BF7, 0x06612BF8, 0x00012BF9,
+            0x1FE12BFA, 0x06C12BFB, 0x02A12BFC, 0x00E12BFD, 0x00A12BFE, 0x00012BFF, 0x05612C00, 0x00212C01, 0x00012C02, 0x00012C03,
+            0x02A12C04, 0x00012C05, 0x0041086C, 0x00812C06, 0x01812C07, 0x00012C08, 0x01012C09, 0x00212C0A, 0x0081086C, 0x00212C0B,
+            0x00012C0C, 0x00012C0D, 0x00012C0E, 0x00412C0F, 0x00012C10, 0x00812C11, 0x00012C12, 0x00012C13, 0x00012C14, 0x00012C15,
+            0x00012C16, 0x00012C17, 0x00012C18, 0x00012C19, 0x00012C1A, 0x00C12C1B, 0x00012C1C, 0x00212C1D, 0x0061086C, 0x00212C1E,
+            0x00412C1F, 0x02412C20, 0x00212C21, 0x0001086C, 0x00012BD0, 0x00412C22, 0x02A12C23, 0x0001086C, 0x00412C24, 0x00212BD4,
+            0x00012C25, 0x03212C26, 0x00012C27, 0x00022C28, 0x00022C2A, 0x00022C2C, 0x00022C2E, 0x00022C30, 0x00022C32, 0x00022C34,
+            0x00022C36, 0x00022C38, 0x00022C3A, 0x00022C3C, 0x00022C3E, 0x00022C40, 0x00022C42, 0x00022C44, 0x00022C46, 0x00022C48,
+            0x00022C4A, 0x00022C4C, 0x00022C4E, 0x00022C50, 0x00022C52, 0x00022C54, 0x00022C56, 0x00022C58, 0x00022C5A, 0x00022C5C,
+            0x00022C5E, 0x00022C60, 0x00022C62, 0x00212C64, 0x01E12C65, 0x00022C66, 0x00C12C68, 0x00012C69, 0x00012C6A, 0x00212C6B,
+            0x0101086C, 0x00C12C6C, 0x04612C6D, 0x01212C6E, 0x00612C6F, 0x00212C70, 0x00012C71, 0x000103EF, 0x00010780, 0x00010781,
+            0x00012C72, 0x00412C73, 0x00412C74, 0x00212C75, 0x00012C76, 0x02012C77, 0x00812C78, 0x00012C79, 0x00012C7A, 0x00012C7B,
+            0x00012C7C, 0x00012C7D, 0x00012C7E, 0x00012C7F, 0x00012C80, 0x0061086C, 0x00812C81, 0x00A12C82, 0x00212C83, 0x00012C84,
+            0x03812C85, 0x0001086C, 0x00212C86, 0x03812C87, 0x0001086C, 0x00212C88, 0x00E12C89, 0x00022C8A, 0x03612C8C, 0x000103E9,
+            0x000103EF, 0x0001086C, 0x00012BD0, 0x00412C8D, 0x00C12C8E, 0x05A12C8F, 0x00022C90, 0x00C12C92, 0x00012C93, 0x00A12C94,
+            0x02A12C95, 0x0061086C, 0x00612C96, 0x02412C97, 0x0061086C, 0x00612C98, 0x02212C99, 0x00612C9A, 0x0061086C, 0x00412C9B,
+            0x00012C9C, 0x00022C9D, 0x00212C9F, 0x00022CA0, 0x00412CA2, 0x00022CA3, 0x00012CA5, 0x00022CA6, 0x00012CA8, 0x00022CA9,
+            0x00012CAB, 0x00022CAC, 0x00012CAE, 0x00022CAF, 0x00012CB1, 0x00022CB2, 0x00212CB4, 0x00022CB5, 0x00012CB7, 0x00022CB8,
+            0x00012CBA, 0x00022CBB, 0x00012CBD, 0x00022CBE, 0x00012CC0, 0x00022CC1, 0x00012CC3, 0x00022CC4, 0x00812CC6, 0x00022CC7,
+            0x00012CC9, 0x00022CCA, 0x00012CCC, 0x00022CCD, 0x00012CCF, 0x00022CD0, 0x00212CD2, 0x00022CD3, 0x00612CD5, 0x00022CD6,
+            0x00012CD8, 0x00022CD9, 0x00012CDB, 0x00022CDC, 0x00012CDE, 0x00022CDF, 0x00012CE1, 0x00022CE2, 0x00612CE4, 0x00022CE5,
+            0x00012CE7, 0x00022CE8, 0x00012CEA, 0x00022CEB, 0x00012CED, 0x00022CEE, 0x00212CF0, 0x00012CF1, 0x00022CF2, 0x00E12CF4,
+            0x00022CF5, 0x00022CF7, 0x00812CF9, 0x00022CFA, 0x01212CFC, 0x00022CFD, 0x00012CFF, 0x00022D00, 0x00022D02, 0x00412D04,
+            0x00022D05, 0x00C12D07, 0x00022D08, 0x00012D0A, 0x00022D0B, 0x00812D0D, 0x00012D0E, 0x00022D0F, 0x00E12D11, 0x00022D12,
+            0x00022D14, 0x00812D16, 0x00022D17, 0x01212D19, 0x00022D1A, 0x00012D1C, 0x00022D1D, 0x00022D1F, 0x00412D21, 0x00022D22,
+            0x00C12D24, 0x00022D25, 0x00012D27, 0x00022D28, 0x00812D2A, 0x0001086C, 0x00012BD0, 0x00612D2B, 0x00012D2C, 0x03612D2D,
+            0x00812D2E, 0x00212D2F, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103E9, 0x01210011, 0x0101086C, 0x02A12D30, 0x04012D31,
+            0x00E12D32, 0x00012D33, 0x00010664, 0x00010663, 0x00012D34, 0x00012D35, 0x00012D36, 0x00012D37, 0x00012D38, 0x00012D39,
+            0x00012D3A, 0x00212D3B, 0x00012D3C, 0x00E12D3D, 0x00012D3E, 0x00022D3F, 0x00212D41, 0x00022D42, 0x00212D44, 0x00012D45,
+            0x00022D46, 0x00412D48, 0x00012D49, 0x00022D4A, 0x0081086C, 0x00812D4C, 0x00022D4D, 0x02812D4F, 0x00022D50, 0x000103EF,
+            0x000103EF, 0x000103E9, 0x000103E9, 0x000103E9, 0x000103EF, 0x000103E9, 0x000103EF, 0x000103EF, 0x000103EF, 0x000103EF,
+            0x0001086C, 0x00412D52, 0x00812D53, 0x02812D54, 0x0061086C, 0x00412D55, 0x02A12D56, 0x00022D57, 0x0001077F, 0x00010780,
+            0x00010781, 0x00212D59, 0x05C12D5A, 0x02412D5B, 0x00212D5C, 0x00812D5D, 0x0101086C, 0x01412D5E, 0x01210011, 0x00012D5F,
+            0x0001077F, 0x00010780, 0x00010781, 0x02C12D60, 0x00022D61, 0x00012D63, 0x00022D64, 0x01A12D66, 0x00022D67, 0x01A12D69,
+            0x00010797, 0x00212D6A, 0x00010000, 0x00212D6B, 0x00212D6C, 0x00010000, 0x03012D6D, 0x01210011, 0x0001077F, 0x00010780,
+            0x00010781, 0x04012D6E, 0x00412D6F, 0x01212D70, 0x20012D71, 0x20012D72, 0x00212D73, 0x01210011, 0x00012D74, 0x00212D75,
+            0x00012D76, 0x00012D77, 0x00212D78, 0x00012D79, 0x03E12D7A, 0x00412D7B, 0x00010797, 0x00212D7C, 0x00012D7D, 0x0001077F,
+            0x00010780, 0x00010781, 0x05E12D7E, 0x01212D7F, 0x00612D80, 0x00412D81, 0x00012D82, 0x00212D83, 0x00012D84, 0x00012D85,
+            0x000107E4, 0x00010797, 0x00012D86, 0x00012D87, 0x00012D88, 0x00012D89, 0x0001077F, 0x01210011, 0x00012D8A, 0x00012D8B,
+            0x00012D8C, 0x00012D8D, 0x00212D8E, 0x0101086C, 0x01412D8F, 0x02212D90, 0x04012D91, 0x00010780, 0x00012D92, 0x00010797,
+            0x00010661, 0x00212D93, 0x00612D94, 0x00010662, 0x00612D95, 0x00412D96, 0x00012D97, 0x00612D98, 0x01C12D99, 0x00A12D9A,
+            0x00212D9B, 0x00212D9C, 0x00012D9D, 0x05C12D9E, 0x00010780, 0x01012D9F, 0x00010797, 0x00012DA0, 0x01210011, 0x00010780,
+            0x0001077F, 0x00010780, 0x00010781, 0x00C12DA1, 0x00012DA2, 0x00212DA3, 0x02A12DA4, 0x00C12DA5, 0x00212DA6, 0x00812DA7,
+            0x00010797, 0x00010797, 0x00012DA8, 0x00C12DA9, 0x20012DAA, 0x00012DAB, 0x00412DAC, 0x00012DAD, 0x00012DAE, 0x00012DAF,
+            0x00212DB0, 0x00012DB1, 0x00012DB2, 0x00212DB3, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x06812DB4, 0x01A12DB5, 0x0001077F, 0x00010780,
+            0x00010781, 0x00010797, 0x00012DB6, 0x00012DB7, 0x00212DB8, 0x00212DB9, 0x00012DBA, 0x00212DBB, 0x01210011, 0x00012DBC,
+            0x00012DBD, 0x00012DBE, 0x000107E4, 0x00012DBF, 0x00212DC0, 0x05E12DC1, 0x01012DC2, 0x20012DC3, 0x00812DC4, 0x0001077F,
+            0x00010780, 0x00010781, 0x00012DC5, 0x00010797, 0x00212DC6, 0x00012DC7, 0x00012DC8, 0x01210011, 0x06A12DC9, 0x20012DCA,
+            0x20012DCB, 0x00212DCC, 0x0001077F, 0x00010780, 0x00010781, 0x00012DCD, 0x00010797, 0x00012DCE, 0x00212DCF, 0x02612DD0,
+            0x00022DD1, 0x00022DD3, 0x00022DD5, 0x00022DD7, 0x00022DD9, 0x00022DDB, 0x07812DDD, 0x00010780, 0x00010781, 0x00012DDE,
+            0x0001077F, 0x00212DDF, 0x00012DE0, 0x00012DE1, 0x01210011, 0x01812DE2, 0x01212DE3, 0x00212DE4, 0x03412DE5, 0x00012DE6,
+            0x00012DE7, 0x00012DE8, 0x00012DE9, 0x00010780, 0x00010781, 0x01212DEA, 0x00010797, 0x00012DEB, 0x01210011, 0x00812DEC,
+            0x00022DED, 0x01E12DEF, 0x00022DF0, 0x00412DF2, 0x00022DF3, 0x00412DF5, 0x01612DF6, 0x01210011, 0x00212DF7, 0x00212DF8,
+            0x00012DF9, 0x00012DFA, 0x06C12DFB, 0x00010780, 0x00010781, 0x00012DFC, 0x00010797, 0x00012DFD, 0x03E12DFE, 0x03E12DFF,
+            0x01210011, 0x01012E00, 0x00012E01, 0x00C12E02, 0x00012E03, 0x00812E04, 0x00412E05, 0x00212E06, 0x01A12E07, 0x00012E08,
+            0x00012E09, 0x01812E0A, 0x20012E0B, 0x00212E0C, 0x00010780, 0x0001077F, 0x00212E0D, 0x00012E0E, 0x00012E0F, 0x00012E10,
+            0x00012E11, 0x00010797, 0x00012E12, 0x00012E13, 0x00012E14, 0x01210011, 0x00E12E15, 0x04C12E16, 0x00C12E17, 0x00012E18,
+            0x00412E19, 0x00010780, 0x00010781, 0x00012E1A, 0x00012E1B, 0x00012E1C, 0x00012E1D, 0x00012E1E, 0x01412E1F, 0x00012E20,
+            0x04A12E21, 0x00012E22, 0x00010797, 0x00012E23, 0x0001077F, 0x0001077F, 0x0001077F, 0x00010780, 0x00010781, 0x00012E24,
+            0x00612E25, 0x00E12E26, 0x00012E27, 0x00612E28, 0x00012E29, 0x00012E2A, 0x00012E2B, 0x00212E2C, 0x00212E2D, 0x00212E2E,
+            0x04A12E2F, 0x00012E30, 0x00212E31, 0x00212E32, 0x00012E33, 0x00012E34, 0x00012E35, 0x00012E36, 0x00012E37, 0x00012E38,
+            0x00212E39, 0x00012E3A, 0x00212E3B, 0x00012E3C, 0x00012E3D, 0x00012E3E, 0x00010780, 0x00010781, 0x00012E3F, 0x00012E40,
+            0x00412E41, 0x00012E42, 0x00812E43, 0x02812E44, 0x00C12E45, 0x00212E46, 0x00012E47, 0x00812E48, 0x00012E49, 0x00012E4A,
+            0x00012E4B, 0x00012E4C, 0x00012E4D, 0x00012E4E, 0x00012E4F, 0x00012E50, 0x00012E51, 0x00012E52, 0x00012E53, 0x00012E54,
+            0x00012E55, 0x00012E56, 0x00012E57, 0x00012E58, 0x00012E59, 0x00012E5A, 0x00012E5B, 0x00012E5C, 0x00012E5D, 0x01012E5E,
+            0x04812E5F, 0x00E12E60, 0x00612E61, 0x0001077F, 0x00010780, 0x00010781, 0x00012E62, 0x00012E63, 0x00212E64, 0x00412E65,
+            0x01210011, 0x0101086C, 0x01212E66, 0x00212E67, 0x00012E68, 0x00012E69, 0x00012E6A, 0x00012E6B, 0x00012E6C, 0x00012E6D,
+            0x00012E6E, 0x00012E6F, 0x00012E70, 0x00012E71, 0x00012E72, 0x00012E73, 0x00012E74, 0x00012E75, 0x00012E76, 0x00012E77,
+            0x00012E78, 0x00012E79, 0x00012E7A, 0x00012E7B, 0x00012E7C, 0x00012E7D, 0x00212E7E, 0x00012E7F, 0x00012E80, 0x00012E81,
+            0x00012E82, 0x00012E83, 0x00012E84, 0x00012E85, 0x00012E86, 0x00012E87, 0x00012E88, 0x00012E89, 0x00012E8A, 0x00012E8B,
+            0x00012E8C, 0x00012E8D, 0x00012E8E, 0x00012E8F, 0x00012E90, 0x00012E91, 0x00012E92, 0x00012E93, 0x00012E94, 0x00012E95,
+            0x00012E96, 0x00012E97, 0x00012E98, 0x00012E99, 0x00012E9A, 0x00012E9B, 0x00012E9C, 0x00012E9D, 0x00012E9E, 0x00012E9F,
+            0x00012EA0, 0x00A12EA1, 0x00010780, 0x0001077F, 0x00C12EA2, 0x00212EA3, 0x05612EA4, 0x00012EA5, 0x00212EA6, 0x00012EA7,
+            0x00010780, 0x00010781, 0x00010797, 0x0001077F, 0x00212EA8, 0x00012EA9, 0x00012EAA, 0x01210011, 0x00A12EAB, 0x00212EAC,
+            0x04812EAD, 0x00212EAE, 0x00212EAF, 0x00010780, 0x00010781, 0x00012EB0, 0x00012EB1, 0x01210011, 0x02C12EB2, 0x00212EB3,
+            0x00012EB4, 0x02812EB5, 0x00E12EB6, 0x00612EB7, 0x02012EB8, 0x00012EB9, 0x1FE12EBA, 0x1FE12EBB, 0x0C412EBC, 0x0E012EBD,
+            0x00212EBE, 0x18612EBF, 0x00E12BD4, 0x00C12EC0, 0x00A12C1E, 0x0101086C, 0x0081086C, 0x00212BD4, 0x00C12EC0, 0x0041086C,
+            0x00412EC0, 0x00212EC1, 0x0041086C, 0x00412EC0, 0x00012EC0, 0x00212EC0, 0x00012C1E, 0x00012C1E, 0x00012C1E, 0x00211328,
+            0x00012EC2, 0x00212EC2, 0x00212EC3, 0x00012EC4, 0x00012EC4, 0x00012EC4, 0x00812BD4, 0x0061086C, 0x00212C1E, 0x00012BD0,
+            0x00212BD4, 0x0021086C, 0x01C12EC5, 0x00A12C1E, 0x00812EC6, 0x18612EC7, 0x1FE12EC8, 0x1FE12EC9, 0x1FE12ECA, 0x1FE12ECB,
+            0x05C12ECC, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x1FE12ECD, 0x1FE12ECE, 0x08C12ECF, 0x1FE12ED0, 0x1FE12ED1, 0x07012ED2, 0x03C12ED3, 0x01210011, 0x00212ED4, 0x03A12ED5,
+            0x00012ED6, 0x00012ED7, 0x00012ED8, 0x00012ED9, 0x00012EDA, 0x00012EDB, 0x05E12EDC, 0x00012EDD, 0x00012EDE, 0x00012EDF,
+            0x00012EE0, 0x00012EE1, 0x00012EE2, 0x00012EE3, 0x00812EE4, 0x00612EE5, 0x00212EE6, 0x00212EE7, 0x00012EE8, 0x00012EE9,
+            0x01210011, 0x00C12EEA, 0x02812EEB, 0x02412EEC, 0x03E12EED, 0x03E12EEE, 0x01210011, 0x01212EEF, 0x00022EF0, 0x00022EF2,
+            0x00022EF4, 0x00012EF6, 0x00012EF7, 0x00212EF8, 0x00612EF9, 0x00212EFA, 0x00012EFB, 0x00C12EFC, 0x00212EFD, 0x00412EFE,
+            0x00012EFF, 0x02012F00, 0x00012F01, 0x01812F02, 0x00012F03, 0x00A12F04, 0x00812F05, 0x00012F06, 0x00812F07, 0x00012F08,
+            0x00012F09, 0x00012F0A, 0x00012F0B, 0x00012F0C, 0x00012F0D, 0x00012F0E, 0x00612F0F, 0x00812F10, 0x00612F11, 0x00612F12,
+            0x00812F13, 0x00E12F14, 0x00812F15, 0x00212F16, 0x01212F17, 0x00012F18, 0x00012F19, 0x00012F1A, 0x00012F1B, 0x00012F1C,
+            0x00012F1D, 0x00012F1E, 0x00012F1F, 0x00012F20, 0x02012F21, 0x00212F22, 0x00012F23, 0x00012F24, 0x00010000, 0x00012F25,
+            0x00012F26, 0x00012F27, 0x00012F28, 0x01812F29, 0x1FE12F2A, 0x01E12F2B, 0x00412F2C, 0x00612F2D, 0x0D412F2E, 0x01812F2F,
+            0x01012F30, 0x01212F31, 0x00012F32, 0x000103E9, 0x00010400, 0x00012F33, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x1EA12F34, 0x04C12F35, 0x00012F36, 0x01E12F37, 0x04612F38, 0x00022F39, 0x00022F3B, 0x00032F3D, 0x00032F3D, 0x00032F3D,
+            0x00032F3D, 0x00032F3D, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00412F40, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00212F41, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x03A12F42, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x01812F43, 0x00022F44, 0x00022F46, 0x00032F48, 0x00032F4B, 0x00032F48, 0x00032F4B,
+            0x04E12F4E, 0x08212F4F, 0x00010000, 0x00010000, 0x00010000, 0x00012F50, 0x01210011, 0x01212F51, 0x0AC12F52, 0x0101086C,
+            0x01012F53, 0x0081086C, 0x0001086C, 0x00012BD0, 0x00012F54, 0x000112A1, 0x00011278, 0x000112B5, 0x000112A4, 0x000112A5,
+            0x00012F55, 0x00011287, 0x00011289, 0x00012F56, 0x00012F57, 0x0001128A, 0x000112A7, 0x0001128D, 0x00012F58, 0x00011291,
+            0x00011292, 0x00011293, 0x00012F59, 0x00012F5A, 0x00012F5B, 0x00012F5C, 0x00012F5D, 0x00012F5E, 0x00012F5F, 0x0001129D,
+            0x00012F60, 0x00012F61, 0x00012F62, 0x000112B6, 0x000112A3, 0x00012F63, 0x00011286, 0x00011288, 0x000112AA, 0x000112B7,
+            0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66, 0x000112A8, 0x00012F67, 0x00012F68, 0x00012F69, 0x00012F6A, 0x00012F6B,
+            0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71, 0x00012F54, 0x000112A1, 0x00011278, 0x000112B5,
+            0x000112A4, 0x000112A5, 0x00012F55, 0x00011287, 0x00011289, 0x00012F56, 0x00012F57, 0x0001128A, 0x000112A7, 0x0001128D,
+            0x00012F58, 0x00011291, 0x00011292, 0x00011293, 0x00012F59, 0x00012F5A, 0x00012F5B, 0x00012F5C, 0x00012F5D, 0x00012F5E,
+            0x00012F5F, 0x0001129D, 0x00012F60, 0x00012F61, 0x00012F62, 0x000112B6, 0x000112A3, 0x00012F63, 0x00011286, 0x000112AA,
+            0x000112B7, 0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66, 0x000112A8, 0x00012F67, 0x00012F68, 0x00012F69, 0x00012F6A,
+            0x00012F6B, 0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71, 0x00012F54, 0x000112A1, 0x00011278,
+            0x000112B5, 0x000112A4, 0x000112A5, 0x00012F55, 0x00011287, 0x00011289, 0x00012F56, 0x00012F57, 0x0001128A, 0x000112A7,
+            0x0001128D, 0x00012F58, 0x00011291, 0x00011292, 0x00011293, 0x00012F59, 0x00012F5A, 0x00012F5B, 0x00012F5C, 0x00012F5D,
+            0x00012F5E, 0x00012F5F, 0x0001129D, 0x00012F60, 0x00012F61, 0x00012F62, 0x000112B6, 0x000112A3, 0x00012F63, 0x00011286,
+            0x00011288, 0x000112AA, 0x000112B7, 0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66, 0x000112A8, 0x00012F67, 0x00012F68,
+            0x00012F69, 0x00012F6A, 0x00012F6B, 0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71, 0x00012F54,
+            0x00011278, 0x000112B5, 0x00012F55, 0x00012F56, 0x00012F57, 0x0001128D, 0x00012F58, 0x00011291, 0x00011292, 0x00012F59,
+            0x00012F5A, 0x00012F5B, 0x00012F5C, 0x00012F5D, 0x00012F5E, 0x00012F5F, 0x0001129D, 0x00012F60, 0x00012F61, 0x00012F62,
+            0x000112B6, 0x00012F63, 0x00011288, 0x000112AA, 0x000112B7, 0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66, 0x00012F67,
+            0x00012F68, 0x00012F69, 0x00012F6A, 0x00012F6B, 0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71,
+            0x00012F54, 0x000112A1, 0x00011278, 0x000112B5, 0x000112A4, 0x000112A5, 0x00012F55, 0x00011287, 0x00011289, 0x00012F56,
+            0x00012F57, 0x0001128A, 0x000112A7, 0x0001128D, 0x00012F58, 0x00011291, 0x00011292, 0x00011293, 0x00012F59, 0x00012F5A,
+            0x00012F5B, 0x00012F5C, 0x00012F5D, 0x00012F5E, 0x00012F5F, 0x0001129D, 0x00012F60, 0x00012F61, 0x00012F62, 0x000112B6,
+            0x000112A3, 0x00012F63, 0x00011286, 0x00011288, 0x000112AA, 0x000112B7, 0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66,
+            0x000112A8, 0x00012F67, 0x00012F68, 0x00012F69, 0x00012F6A, 0x00012F6B, 0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F,
+            0x00012F70, 0x00012F71, 0x00012F54, 0x000112A1, 0x000112B5, 0x000112A4, 0x000112A5, 0x00012F55, 0x00012F56, 0x00012F57,
+            0x0001128A, 0x000112A7, 0x0001128D, 0x00012F58, 0x00011291, 0x00011292, 0x00012F59, 0x00012F5A, 0x00012F5B, 0x00012F5C,
+            0x00012F5D, 0x00012F5E, 0x00012F5F, 0x00012F60, 0x00012F61, 0x00012F62, 0x000112B6, 0x000112A3, 0x00012F63, 0x00011286,
+            0x00011288, 0x000112AA, 0x000112B7, 0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66, 0x000112A8, 0x00012F67, 0x00012F68,
+            0x00012F69, 0x00012F6A, 0x00012F6B, 0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71, 0x00012F54,
+            0x000112A1, 0x000112B5, 0x000112A4, 0x000112A5, 0x00012F55, 0x00011289, 0x00012F56, 0x00012F57, 0x0001128A, 0x000112A7,
+            0x00012F58, 0x00012F59, 0x00012F5A, 0x00012F5B, 0x00012F5C, 0x00012F5D, 0x00012F5E, 0x00012F5F, 0x00012F60, 0x00012F61,
+            0x00012F62, 0x000112B6, 0x000112A3, 0x00012F63, 0x00011286, 0x00011288, 0x000112AA, 0x000112B7, 0x00012F64, 0x0001128B,
+            0x00012F65, 0x00012F66, 0x000112A8, 0x00012F67, 0x00012F68, 0x00012F69, 0x00012F6A, 0x00012F6B, 0x00012F6C, 0x00012F6D,
+            0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71, 0x00012F54, 0x000112A1, 0x00011278, 0x000112B5, 0x000112A4, 0x000112A5,
+            0x00012F55, 0x00011287, 0x00011289, 0x00012F56, 0x00012F57, 0x0001128A, 0x000112A7, 0x0001128D, 0x00012F58, 0x00011291,
+            0x00011292, 0x00011293, 0x00012F59, 0x00012F5A, 0x00012F5B, 0x00012F5C, 0x00012F5D, 0x00012F5E, 0x00012F5F, 0x0001129D,
+            0x00012F60, 0x00012F61, 0x00012F62, 0x000112B6, 0x000112A3, 0x00012F63, 0x00011286, 0x00011288, 0x000112AA, 0x000112B7,
+            0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66, 0x000112A8, 0x00012F67, 0x00012F68, 0x00012F69, 0x00012F6A, 0x00012F6B,
+            0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71, 0x00012F54, 0x000112A1, 0x00011278, 0x000112B5,
+            0x000112A4, 0x000112A5, 0x00012F55, 0x00011287, 0x00011289, 0x00012F56, 0x00012F57, 0x0001128A, 0x000112A7, 0x0001128D,
+            0x00012F58, 0x00011291, 0x00011292, 0x00011293, 0x00012F59, 0x00012F5A, 0x00012F5B, 0x00012F5C, 0x00012F5D, 0x00012F5E,
+            0x00012F5F, 0x0001129D, 0x00012F60, 0x00012F61, 0x00012F62, 0x000112B6, 0x000112A3, 0x00012F63, 0x00011286, 0x00011288,
+            0x000112AA, 0x000112B7, 0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66, 0x000112A8, 0x00012F67, 0x00012F68, 0x00012F69,
+            0x00012F6A, 0x00012F6B, 0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71, 0x00012F54, 0x000112A1,
+            0x00011278, 0x000112B5, 0x000112A4, 0x000112A5, 0x00012F55, 0x00011287, 0x00011289, 0x00012F56, 0x00012F57, 0x0001128A,
+            0x000112A7, 0x0001128D, 0x00012F58, 0x00011291, 0x00011292, 0x00011293, 0x00012F59, 0x00012F5A, 0x00012F5B, 0x00012F5C,
+            0x00012F5D, 0x00012F5E, 0x00012F5F, 0x0001129D, 0x00012F60, 0x00012F61, 0x00012F62, 0x000112B6, 0x000112A3, 0x00012F63,
+            0x00011286, 0x00011288, 0x000112AA, 0x000112B7, 0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66, 0x000112A8, 0x00012F67,
+            0x00012F68, 0x00012F69, 0x00012F6A, 0x00012F6B, 0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71,
+            0x00012F54, 0x000112A1, 0x00011278, 0x000112B5, 0x000112A4, 0x000112A5, 0x00012F55, 0x00011287, 0x00011289, 0x00012F56,
+            0x00012F57, 0x0001128A, 0x000112A7, 0x0001128D, 0x00012F58, 0x00011291, 0x00011292, 0x00011293, 0x00012F59, 0x00012F5A,
+            0x00012F5B, 0x00012F5C, 0x00012F5D, 0x00012F5E, 0x00012F5F, 0x0001129D, 0x00012F60, 0x00012F61, 0x00012F62, 0x000112B6,
+            0x000112A3, 0x00012F63, 0x00011286, 0x00011288, 0x000112AA, 0x000112B7, 0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66,
+            0x000112A8, 0x00012F67, 0x00012F68, 0x00012F69, 0x00012F6A, 0x00012F6B, 0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F,
+            0x00012F70, 0x00012F71, 0x00012F54, 0x000112A1, 0x00011278, 0x000112B5, 0x000112A4, 0x000112A5, 0x00012F55, 0x00011287,
+            0x00011289, 0x00012F56, 0x00012F57, 0x0001128A, 0x000112A7, 0x0001128D, 0x00012F58, 0x00011291, 0x00011292, 0x00011293,
+            0x00012F59, 0x00012F5A, 0x00012F5B, 0x00012F5C, 0x00012F5D, 0x00012F5E, 0x00012F5F, 0x0001129D, 0x00012F60, 0x00012F61,
+            0x00012F62, 0x000112B6, 0x000112A3, 0x00012F63, 0x00011286, 0x00011288, 0x000112AA, 0x000112B7, 0x00012F64, 0x0001128B,
+            0x00012F65, 0x00012F66, 0x000112A8, 0x00012F67, 0x00012F68, 0x00012F69, 0x00012F6A, 0x00012F6B, 0x00012F6C, 0x00012F6D,
+            0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71, 0x00012F54, 0x000112A1, 0x00011278, 0x000112B5, 0x000112A4, 0x000112A5,
+            0x00012F55, 0x00011287, 0x00011289, 0x00012F56, 0x00012F57, 0x0001128A, 0x000112A7, 0x0001128D, 0x00012F58, 0x00011291,
+            0x00011292, 0x00011293, 0x00012F59, 0x00012F5A, 0x00012F5B, 0x00012F5C, 0x00012F5D, 0x00012F5E, 0x00012F5F, 0x0001129D,
+            0x00012F60, 0x00012F61, 0x00012F62, 0x000112B6, 0x000112A3, 0x00012F63, 0x00011286, 0x00011288, 0x000112AA, 0x000112B7,
+            0x00012F64, 0x0001128B, 0x00012F65, 0x00012F66, 0x000112A8, 0x00012F67, 0x00012F68, 0x00012F69, 0x00012F6A, 0x00012F6B,
+            0x00012F6C, 0x00012F6D, 0x00012F6E, 0x00012F6F, 0x00012F70, 0x00012F71, 0x00012F72, 0x00012F73, 0x00412F74, 0x00212F75,
+            0x00012F76, 0x00412F77, 0x00212F78, 0x00812F79, 0x00012F7A, 0x00012F7B, 0x00012F7C, 0x00812F7D, 0x00012F7E, 0x00012F7F,
+            0x00412F80, 0x00212F81, 0x00012F82, 0x00412F83, 0x00212F84, 0x00812F85, 0x00012F86, 0x00012F87, 0x00012F87, 0x00812F88,
+            0x00012F89, 0x00012F8A, 0x00012F8B, 0x00012F8C, 0x00012F84, 0x00012F8D, 0x00012F86, 0x000112AF, 0x00412F74, 0x00212F75,
+            0x00012F76, 0x00412F77, 0x00212F78, 0x00812F79, 0x00012F7A, 0x00012F7B, 0x00012F7C, 0x00812F7D, 0x00012F7E, 0x00012F7F,
+            0x00412F80, 0x00212F81, 0x00012F82, 0x00412F83, 0x00212F84, 0x00812F85, 0x00012F86, 0x00012F87, 0x00012F87, 0x00812F88,
+            0x00012F89, 0x00012F8A, 0x00012F8B, 0x00012F8C, 0x00012F84, 0x00012F8D, 0x00012F86, 0x000112AF, 0x00412F74, 0x00212F75,
+            0x00012F76, 0x00412F77, 0x00212F78, 0x00812F79, 0x00012F7A, 0x00012F7B, 0x00012F7C, 0x00812F7D, 0x00012F7E, 0x00012F7F,
+            0x00412F80, 0x00212F81, 0x00012F82, 0x00412F83, 0x00212F84, 0x00812F85, 0x00012F86, 0x00012F87, 0x00012F87, 0x00812F88,
+            0x00012F89, 0x00012F8A, 0x00012F8B, 0x00012F8C, 0x00012F84, 0x00012F8D, 0x00012F86, 0x000112AF, 0x00412F74, 0x00212F75,
+            0x00012F76, 0x00412F77, 0x00212F78, 0x00812F79, 0x00012F7A, 0x00012F7B, 0x00012F7C, 0x00812F7D, 0x00012F7E, 0x00012F7F,
+            0x00412F80, 0x00212F81, 0x00012F82, 0x00412F83, 0x00212F84, 0x00812F85, 0x00012F86, 0x00012F87, 0x00012F87, 0x00812F88,
+            0x00012F89, 0x00012F8A, 0x00012F8B, 0x00012F8C, 0x00012F84, 0x00012F8D, 0x00012F86, 0x000112AF, 0x00412F74, 0x00212F75,
+            0x00012F76, 0x00412F77, 0x00212F78, 0x00812F79, 0x00012F7A, 0x00012F7B, 0x00012F7C, 0x00812F7D, 0x00012F7E, 0x00012F7F,
+            0x00412F80, 0x00212F81, 0x00012F82, 0x00412F83, 0x00212F84, 0x00812F85, 0x00012F86, 0x00012F87, 0x00012F87, 0x00812F88,
+            0x00012F89, 0x00012F8A, 0x00012F8B, 0x00012F8C, 0x00012F84, 0x00012F8D, 0x00012F86, 0x000112AF, 0x00012F8E, 0x00012F8F,
+            0x01212F90, 0x01212F90, 0x01212F90, 0x01212F90, 0x01212F90, 0x1FE12F91, 0x1FE12F92, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00612F93, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00E12F94, 0x00010000, 0x01A12F95, 0x00010000, 0x00212F96, 0x00812F97, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00C12F98,
+            0x02012F99, 0x00C12F9A, 0x00212F9B, 0x00812F9C, 0x05812F9D, 0x00012EE1, 0x00012EDD, 0x00012EDF, 0x00012EE0, 0x00012EE2,
+            0x00012EE3, 0x00012EDE, 0x00812F9E, 0x00212F9F, 0x01210011, 0x00012FA0, 0x00012FA1, 0x05612FA2, 0x00012FA3, 0x00012FA4,
+            0x00012FA5, 0x00012FA6, 0x01210011, 0x00012FA7, 0x18812FA8, 0x0101086C, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x04212FA9, 0x04212FAA, 0x00012FAB, 0x00012FAB, 0x00012FAB, 0x00012FAC, 0x00012FAD,
+            0x00012FAE, 0x00012FAF, 0x00012FB0, 0x01210011, 0x00012FB1, 0x00012FB2, 0x0101086C, 0x05012FB3, 0x0101086C, 0x00012FB4,
+            0x00412FB5, 0x00012FB6, 0x00022EF0, 0x00022EF2, 0x00212FB7, 0x0101086C, 0x04612FB8, 0x00012FB9, 0x00022EF2, 0x00022FBA,
+            0x00022FBC, 0x00022FBE, 0x00022FC0, 0x00022FC2, 0x00022FC4, 0x00022FC6, 0x00C12FC8, 0x00012FC9, 0x00012FCA, 0x00012FCB,
+            0x00012FCC, 0x00012FCD, 0x00012FCE, 0x00012FCF, 0x00012FD0, 0x00012FD1, 0x00012FD2, 0x00012FD3, 0x00012FD4, 0x00012FD5,
+            0x00012FD6, 0x00012FD7, 0x00012FD8, 0x00012FD9, 0x00012FDA, 0x00012FDB, 0x00012FDC, 0x00212FDD, 0x00012FDE, 0x00012FDF,
+            0x00012FE0, 0x00012FE1, 0x00012FE2, 0x00012FE3, 0x00012FE4, 0x00012FE5, 0x00012FE6, 0x00012FCA, 0x00012FCB, 0x00012FE7,
+            0x00012FCF, 0x00012FD1, 0x00012FD2, 0x00012FD3, 0x00012FD4, 0x00012FD5, 0x00012FD6, 0x00012FD7, 0x00012FD8, 0x00012FD9,
+            0x00012FDA, 0x00012FDC, 0x00212FDD, 0x00012FDE, 0x00012FE0, 0x00012FE2, 0x00012FCB, 0x00012FCF, 0x00012FD1, 0x00012FD3,
+            0x00012FD5, 0x00012FD6, 0x00012FD7, 0x00012FD9, 0x00012FDA, 0x00012FDC, 0x00012FDE, 0x00012FE0, 0x00012FE2, 0x00012FE4,
+            0x00012FE6, 0x00012FCA, 0x00012FCB, 0x00012FE7, 0x00012FCF, 0x00012FD0, 0x00012FD1, 0x00012FD2, 0x00012FD4, 0x00012FD5,
+            0x00012FD6, 0x00012FD7, 0x00012FD8, 0x00012FD9, 0x00012FDA, 0x00012FDC, 0x00212FDD, 0x00012FDE, 0x00012FE0, 0x00012FE1,
+            0x00012FE2, 0x00012FE3, 0x00012FE5, 0x00012FC9, 0x00012FCA, 0x00012FCB, 0x00012FCC, 0x00012FE7, 0x00012FCD, 0x00012FCE,
+            0x00012FCF, 0x00012FD0, 0x00012FD1, 0x00012FD3, 0x00012FD4, 0x00012FD5, 0x00012FD6, 0x00012FD7, 0x00012FD8, 0x00012FD9,
+            0x00012FDA, 0x00012FDB, 0x00012FDC, 0x00212FDD, 0x00012FDE, 0x00012FDF, 0x00012FE0, 0x00012FE1, 0x00012FE2, 0x00012FCA,
+            0x00012FCB, 0x00012FCC, 0x00012FCD, 0x00012FCE, 0x00012FCF, 0x00012FD0, 0x00012FD1, 0x00012FD3, 0x00012FD4, 0x00012FD5,
+            0x00012FD6, 0x00012FD7, 0x00012FD8, 0x00012FD9, 0x00012FDA, 0x00012FDB, 0x00012FDC, 0x00212FDD, 0x00012FDE, 0x00012FDF,
+            0x00012FE0, 0x00012FE1, 0x00012FE2, 0x00212FE8, 0x05612FE9, 0x0C612FEA, 0x01C12FEB, 0x01C12FEC, 0x01C12FED, 0x04812FEE,
+            0x00022FEF, 0x00022FF1, 0x00022FF3, 0x00022FF5, 0x00022FF7, 0x00022FF9, 0x00022FFB, 0x00022FFD, 0x00022FFF, 0x00023001,
+            0x00023003, 0x000114CC, 0x000114CC, 0x00413005, 0x00033006, 0x00033009, 0x0003300C, 0x0003300F, 0x00033012, 0x00033015,
+            0x00033018, 0x0003301B, 0x0003301E, 0x00033021, 0x00033024, 0x00033027, 0x0003302A, 0x0003302D, 0x00033030, 0x00033033,
+            0x00033036, 0x00033039, 0x0003303C, 0x0003303F, 0x00033042, 0x00033045, 0x00033048, 0x0003304B, 0x0003304E, 0x00033051,
+            0x00033054, 0x0001149A, 0x000114A9, 0x00023057, 0x00023059, 0x0001305B, 0x00010CA1, 0x00010CA5, 0x0001305C, 0x00010CA7,
+            0x00010CA8, 0x0001305D, 0x00010CAA, 0x00010CAB, 0x00010CAC, 0x00010CAD, 0x00010CAE, 0x00010CAF, 0x00010CB0, 0x00010CB1,
+            0x00010CB3, 0x00010CB5, 0x0001305E, 0x00010CB6, 0x0001305F, 0x00010CB7, 0x00010CB8, 0x00011517, 0x00010CB9, 0x00013060,
+            0x00013061, 0x00013062, 0x00023063, 0x00021EE2, 0x00023065, 0x00023067, 0x00033069, 0x0002306C, 0x00011498, 0x00011499,
+            0x0001149A, 0x0001149B, 0x0001149C, 0x0001149D, 0x0001149E, 0x0001149F, 0x000114A0, 0x000114A1, 0x000114A2, 0x000114A3,
+            0x000114A4, 0x000114A5, 0x000114A6, 0x000114A7, 0x000114A8, 0x000114A9, 0x000114AA, 0x000114AB, 0x000114AC, 0x000114AD,
+            0x000114AE, 0x000114AF, 0x000114B0, 0x000114B1, 0x0002306E, 0x00023070, 0x00023072, 0x00413074, 0x00010CA1, 0x00010CA5,
+            0x0001305C, 0x00010CA7, 0x00010CA8, 0x0001305D, 0x00010CAA, 0x00010CAB, 0x00010CAC, 0x00010CAD, 0x00010CAE, 0x00010CAF,
+            0x00010CB0, 0x00010CB1, 0x00010CB3, 0x00010CB5, 0x0001305E, 0x00010CB6, 0x0001305F, 0x00010CB7, 0x00010CB8, 0x00011517,
+            0x00010CB9, 0x00013060, 0x00013061, 0x00013062, 0x00010CB5, 0x00023075, 0x00023077, 0x00023079, 0x0002307B, 0x0002306C,
+            0x0002307D, 0x0002307F, 0x00043081, 0x00043085, 0x00023089, 0x0003308B, 0x0002308E, 0x00023090, 0x00033092, 0x00033095,
+            0x00023098, 0x0002309A, 0x0007309C, 0x000230A3, 0x000230A5, 0x000230A7, 0x000330A9, 0x000330AC, 0x000430AF, 0x000330B3,
+            0x000430B6, 0x000130BA, 0x000230BB, 0x000330BD, 0x000630C0, 0x000830C6, 0x000330CE, 0x000330D1, 0x000330D4, 0x000130D7,
+            0x032130D8, 0x000230D9, 0x000230DB, 0x000130DD, 0x000230DE, 0x000230E0, 0x000230E2, 0x000230E4, 0x000230E6, 0x000230E8,
+            0x000230EA, 0x000230EC, 0x000230EE, 0x000230F0, 0x000230F2, 0x000230F4, 0x000230F6, 0x000230F8, 0x000230FA, 0x000230FC,
+            0x000230FE, 0x00023100, 0x00023102, 0x00023104, 0x00023106, 0x00023108, 0x0002310A, 0x0002310C, 0x0002310E, 0x00023110,
+            0x00023112, 0x00023114, 0x00023116, 0x00023118, 0x0002311A, 0x0002311C, 0x0002311E, 0x00023120, 0x00023122, 0x00023124,
+            0x00023126, 0x00023128, 0x0002312A, 0x0002312C, 0x0002312E, 0x00023130, 0x00023132, 0x00023134, 0x00043136, 0x0004313A,
+            0x0004313E, 0x00043142, 0x00043146, 0x0004314A, 0x0004314E, 0x00043152, 0x00043156, 0x0002315A, 0x0002315C, 0x00A1315E,
+            0x1FE1315F, 0x1FE13160, 0x1FE13161, 0x1AE13162, 0x01813163, 0x01813164, 0x0E613165, 0x0B013166, 0x01613167, 0x01613168,
+            0x06E13169, 0x0121316A, 0x04E1316B, 0x03A1316C, 0x0021316D, 0x0F01316E, 0x0A21316F, 0x06413170, 0x0A613171, 0x01A13172,
+            0x00813173, 0x00413174, 0x00C13175, 0x03013176, 0x00C13177, 0x00413178, 0x00C13179, 0x1241317A, 0x06C1317B, 0x01212F90,
+            0x0002317C, 0x0002317E, 0x00023180, 0x00023182, 0x00023184, 0x00022438, 0x00023186, 0x00023188, 0x0002318A, 0x0002318C,
+            0x0002243A, 0x0002318E, 0x00023190, 0x00023192, 0x0002243C, 0x00023194, 0x00023196, 0x00023198, 0x0002319A, 0x0002319C,
+            0x0002319E, 0x000231A0, 0x000231A2, 0x000231A4, 0x000231A6, 0x000231A8, 0x000231AA, 0x000224B0, 0x000231AC, 0x000231AE,
+            0x000231B0, 0x000231B2, 0x000231B4, 0x000231B6, 0x000231B8, 0x000231BA, 0x000231BC, 0x000224BA, 0x0002243E, 0x00022440,
+            0x000224BC, 0x000231BE, 0x000231C0, 0x000222A6, 0x000231C2, 0x00022442, 0x000231C4, 0x000231C6, 0x000231C8, 0x000231CA,
+            0x000231CA, 0x000231CA, 0x000231CC, 0x000231CE, 0x000231D0, 0x000231D2, 0x000231D4, 0x000231D6, 0x000231D8, 0x000231DA,
+            0x000231DC, 0x000231DE, 0x000231E0, 0x000231E2, 0x000231E4, 0x000231E6, 0x000231E8, 0x000231EA, 0x000231EC, 0x000231EE,
+            0x000231EE, 0x000224C0, 0x000231F0, 0x000231F2, 0x000231F4, 0x000231F6, 0x00022446, 0x000231F8, 0x000231FA, 0x000231FC,
+            0x000223D8, 0x000231FE, 0x00023200, 0x00023202, 0x00023204, 0x00023206, 0x00023208, 0x0002320A, 0x0002320C, 0x0002320E,
+            0x00023210, 0x00023212, 0x00023214, 0x00023216, 0x00023218, 0x0002321A, 0x0002321C, 0x0002321E, 0x00023220, 0x00023222,
+            0x00023224, 0x00023226, 0x00023228, 0x0002322A, 0x0002322C, 0x0002322E, 0x00023230, 0x00023230, 0x00023232, 0x00023234,
+            0x00023236, 0x0002229E, 0x00023238, 0x0002323A, 0x0002323C, 0x0002323E, 0x00023240, 0x00023242, 0x00023244, 0x00023246,
+            0x00022450, 0x00023248, 0x0002324A, 0x0002324C, 0x0002324E, 0x00023250, 0x00023252, 0x00023254, 0x00023256, 0x00023258,
+            0x0002325A, 0x0002325C, 0x0002325E, 0x00023260, 0x00023262, 0x00023264, 0x00023266, 0x00023268, 0x0002326A, 0x0002326C,
+            0x0002326E, 0x00023270, 0x00022232, 0x00023272, 0x00023274, 0x00023276, 0x00023276, 0x00023278, 0x0002327A, 0x0002327A,
+            0x0002327C, 0x0002327E, 0x00023280, 0x00023282, 0x00023284, 0x00023286, 0x00023288, 0x0002328A, 0x0002328C, 0x0002328E,
+            0x00023290, 0x00023292, 0x00023294, 0x00022452, 0x00023296, 0x00023298, 0x0002329A, 0x0002329C, 0x000224D8, 0x0002329C,
+            0x0002329E, 0x00022456, 0x000232A0, 0x000232A2, 0x000232A4, 0x000232A6, 0x00022458, 0x000221FC, 0x000232A8, 0x000232AA,
+            0x000232AC, 0x000232AE, 0x000232B0, 0x000232B2, 0x000232B4, 0x000232B6, 0x000232B8, 0x000232BA, 0x000232BC, 0x000232BE,
+            0x000232C0, 0x000232C2, 0x000232C4, 0x000232C6, 0x000232C8, 0x000232CA, 0x000232CC, 0x000232CE, 0x000232D0, 0x000232D2,
+            0x0002245A, 0x000232D4, 0x000232D6, 0x000232D8, 0x000232DA, 0x000232DC, 0x000232DE, 0x0002245E, 0x000232E0, 0x000232E2,
+            0x000232E4, 0x000232E6, 0x000232E8, 0x000232EA, 0x000232EC, 0x000232EE, 0x00022234, 0x000224E8, 0x000232F0, 0x000232F2,
+            0x000232F4, 0x000232F6, 0x000232F8, 0x000232FA, 0x000232FC, 0x000232FE, 0x00022460, 0x00023300, 0x00023302, 0x00023304,
+            0x00023306, 0x0002253E, 0x00023308, 0x0002330A, 0x0002330C, 0x0002330E, 0x00023310, 0x00023312, 0x00023314, 0x00023316,
+            0x00023318, 0x0002331A, 0x0002331C, 0x0002331E, 0x00023320, 0x000222C0, 0x00023322, 0x00023324, 0x00023326, 0x00023328,
+            0x0002332A, 0x0002332C, 0x0002332E, 0x00023330, 0x00023332, 0x00023334, 0x00023336, 0x00022462, 0x0002236E, 0x00023338,
+            0x0002333A, 0x0002333C, 0x0002333E, 0x00023340, 0x00023342, 0x00023344, 0x00023346, 0x000224F0, 0x00023348, 0x0002334A,
+            0x0002334C, 0x0002334E, 0x00023350, 0x00023352, 0x00023354, 0x00023356, 0x000224F2, 0x00023358, 0x0002335A, 0x0002335C,
+            0x0002335E, 0x00023360, 0x00023362, 0x00023364, 0x00023366, 0x00023368, 0x0002336A, 0x0002336C, 0x0002336E, 0x000224F6,
+            0x00023370, 0x00023372, 0x00023374, 0x00023376, 0x00023378, 0x0002337A, 0x0002337C, 0x0002337E, 0x00023380, 0x00023382,
+            0x00023384, 0x00023384, 0x00023386, 0x00023388, 0x000224FA, 0x0002338A, 0x0002338C, 0x0002338E, 0x00023390, 0x00023392,
+            0x00023394, 0x00023396, 0x000222A4, 0x00023398, 0x0002339A, 0x0002339C, 0x0002339E, 0x000233A0, 0x000233A2, 0x000233A4,
+            0x00022506, 0x000233A6, 0x000233A8, 0x000233AA, 0x000233AC, 0x000233AE, 0x000233B0, 0x000233B0, 0x00022508, 0x00022542,
+            0x000233B2, 0x000233B4, 0x000233B6, 0x000233B8, 0x000233BA, 0x00022258, 0x0002250C, 0x000233BC, 0x000233BE, 0x00022478,
+            0x000233C0, 0x000233C2, 0x0002240E, 0x000233C4, 0x000233C6, 0x00022480, 0x000233C8, 0x000233CA, 0x000233CC, 0x000233CE,
+            0x000233CE, 0x000233D0, 0x000233D2, 0x000233D4, 0x000233D6, 0x000233D8, 0x000233DA, 0x000233DC, 0x000233DE, 0x000233E0,
+            0x000233E2, 0x000233E4, 0x000233E6, 0x000233E8, 0x000233EA, 0x000233EC, 0x000233EE, 0x000233F0, 0x000233F2, 0x000233F4,
+            0x000233F6, 0x000233F8, 0x000233FA, 0x000233FC, 0x000233FE, 0x00023400, 0x00023402, 0x00023404, 0x0002248C, 0x00023406,
+            0x00023408, 0x0002340A, 0x0002340C, 0x0002340E, 0x00023410, 0x00023412, 0x00023414, 0x00023416, 0x00023418, 0x0002341A,
+            0x0002341C, 0x0002341E, 0x00023420, 0x00023422, 0x00023424, 0x00023278, 0x00023426, 0x00023428, 0x0002342A, 0x0002342C,
+            0x0002342E, 0x00023430, 0x00023432, 0x00023434, 0x00023436, 0x00023438, 0x0002343A, 0x0002343C, 0x000222C8, 0x0002343E,
+            0x00023440, 0x00023442, 0x00023444, 0x00023446, 0x00023448, 0x00022492, 0x0002344A, 0x0002344C, 0x0002344E, 0x00023450,
+            0x00023452, 0x00023454, 0x00023456, 0x00023458, 0x0002345A, 0x0002345C, 0x0002345E, 0x00023460, 0x00023462, 0x00023464,
+            0x00023466, 0x00023468, 0x0002346A, 0x0002346C, 0x0002346E, 0x00023470, 0x0002224E, 0x00023472, 0x00023474, 0x00023476,
+            0x00023478, 0x0002347A, 0x0002347C, 0x0002251A, 0x0002347E, 0x00023480, 0x00023482, 0x00023484, 0x00023486, 0x00023488,
+            0x0002348A, 0x0002348C, 0x0002348E, 0x00023490, 0x00023492, 0x00023494, 0x00023496, 0x00023498, 0x0002349A, 0x0002349C,
+            0x0002349E, 0x000234A0, 0x000234A2, 0x000234A4, 0x00022524, 0x00022526, 0x000234A6, 0x000234A8, 0x000234AA, 0x000234AC,
+            0x000234AE, 0x000234B0, 0x000234B2, 0x000234B4, 0x000234B6, 0x000234B8, 0x000234BA, 0x000234BC, 0x000234BE, 0x00022528,
+            0x000234C0, 0x000234C2, 0x000234C4, 0x000234C6, 0x000234C8, 0x000234CA, 0x000234CC, 0x000234CE, 0x000234D0, 0x000234D2,
+            0x000234D4, 0x000234D6, 0x000234D8, 0x000234DA, 0x000234DC, 0x000234DE, 0x000234E0, 0x000234E2, 0x000234E4, 0x000234E6,
+            0x000234E8, 0x000234EA, 0x000234EC, 0x000234EE, 0x000234F0, 0x000234F2, 0x000234F4, 0x000234F6, 0x000234F8, 0x000234FA,
+            0x00022534, 0x00022534, 0x000234FC, 0x000234FE, 0x00023500, 0x00023502, 0x00023504, 0x00023506, 0x00023508, 0x0002350A,
+            0x0002350C, 0x0002350E, 0x00022536, 0x00023510, 0x00023512, 0x00023514, 0x00023516, 0x00023518, 0x0002351A, 0x0002351C,
+            0x0002351E, 0x00023520, 0x00023522, 0x00023524, 0x00023526, 0x00023528, 0x0002352A, 0x0002352C, 0x0002352E, 0x00023530,
+            0x00023532, 0x00023534, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000,
+            0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000, 0x00010000
+        };
+
+        // Contractions, sorted by code points (unused trailing code points are 0).
+        const std::uint32_t _s_ducet_contraction_first[] = {
+            0x004C, 0x004C, 0x006C, 0x006C, 0x0418, 0x0438, 0x0627, 0x0627, 0x0627, 0x0648,
+            0x064A, 0x09C7, 0x09C7, 0x0B47, 0x0B47, 0x0B47, 0x0B92, 0x0BC6, 0x0BC6, 0x0BC7,
+            0x0C46, 0x0CBF, 0x0CC6, 0x0CC6, 0x0CC6, 0x0CC6, 0x0CCA, 0x0D46, 0x0D46, 0x0D47,
+            0x0DD9, 0x0DD9, 0x0DD9, 0x0DD9, 0x0DDC, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40,
+            0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40,
+            0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40,
+            0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40,
+            0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40, 0x0E40,
+            0x0E40, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41,
+            0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41,
+            0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41,
+            0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41,
+            0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E41, 0x0E42, 0x0E42, 0x0E42,
+            0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42,
+            0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42,
+            0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42,
+            0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42, 0x0E42,
+            0x0E42, 0x0E42, 0x0E42, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43,
+            0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43,
+            0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43,
+            0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43,
+            0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E43, 0x0E44,
+            0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44,
+            0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44,
+            0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44,
+            0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44,
+            0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E44, 0x0E4D, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0,
+            0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0,
+            0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0,
+            0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0,
+            0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0, 0x0EC0,
+            0x0EC0, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1,
+            0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1,
+            0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1,
+            0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1,
+            0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC1, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2,
+            0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2,
+            0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2,
+            0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2,
+            0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2, 0x0EC2,
+            0x0EC2, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3,
+            0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3,
+            0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3,
+            0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3,
+            0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC3, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4,
+            0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4,
+            0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4,
+            0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4,
+            0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4, 0x0EC4,
+            0x0EC4, 0x0ECD, 0x0F71, 0x0F71, 0x0F71, 0x0FB2, 0x0FB2, 0x0FB2, 0x0FB3, 0x0FB3,
+            0x0FB3, 0x1025, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5,
+            0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5,
+            0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5,
+            0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5,
+            0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B5, 0x19B6, 0x19B6, 0x19B6, 0x19B6,
+            0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6,
+            0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6,
+            0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6,
+            0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6, 0x19B6,
+            0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7,
+            0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7,
+            0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7,
+            0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19B7,
+            0x19B7, 0x19B7, 0x19B7, 0x19B7, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA,
+            0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA,
+            0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA,
+            0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA,
+            0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x19BA, 0x1B05, 0x1B07,
+            0x1B09, 0x1B0B, 0x1B0D, 0x1B11, 0x1B3A, 0x1B3C, 0x1B3E, 0x1B3F, 0x1B42, 0xAAB5,
+            0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5,
+            0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5,
+            0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5,
+            0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5,
+            0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB5, 0xAAB6, 0xAAB6, 0xAAB6,
+            0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6,
+            0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6,
+            0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6,
+            0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6,
+            0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB6, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9,
+            0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9,
+            0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9,
+            0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9,
+            0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9, 0xAAB9,
+            0xAAB9, 0xAAB9, 0xAAB9, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB,
+            0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB,
+            0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB,
+            0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB,
+            0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB, 0xAABB,
+            0xAABB, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC,
+            0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC,
+            0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC,
+            0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC,
+            0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0xAABC, 0x11131,
+            0x11132, 0x11347, 0x11347, 0x114B9, 0x114B9, 0x114B9, 0x115B8, 0x115B9, 0x11935
+        };
+
+        const std::uint32_t _s_ducet_contraction_second[] = {
+            0x00B7, 0x0387, 0x00B7, 0x0387, 0x0306, 0x0306, 0x0653, 0x0654, 0x0655, 0x0654,
+            0x0654, 0x09BE, 0x09D7, 0x0B3E, 0x0B56, 0x0B57, 0x0BD7, 0x0BBE, 0x0BD7, 0x0BBE,
+            0x0C56, 0x0CD5, 0x0CC2, 0x0CC2, 0x0CD5, 0x0CD6, 0x0CD5, 0x0D3E, 0x0D57, 0x0D3E,
+            0x0DCA, 0x0DCF, 0x0DCF, 0x0DDF, 0x0DCA, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05,
+            0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F,
+            0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19,
+            0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F, 0x0E20, 0x0E21, 0x0E22, 0x0E23,
+            0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D,
+            0x0E2E, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09,
+            0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F, 0x0E10, 0x0E11, 0x0E12, 0x0E13,
+            0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D,
+            0x0E1E, 0x0E1F, 0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27,
+            0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E01, 0x0E02, 0x0E03,
+            0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D,
+            0x0E0E, 0x0E0F, 0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17,
+            0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F, 0x0E20, 0x0E21,
+            0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B,
+            0x0E2C, 0x0E2D, 0x0E2E, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07,
+            0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F, 0x0E10, 0x0E11,
+            0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B,
+            0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F, 0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25,
+            0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E01,
+            0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B,
+            0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F, 0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15,
+            0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F,
+            0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29,
+            0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E32, 0x0E81, 0x0E82, 0x0E84, 0x0E86,
+            0x0E87, 0x0E88, 0x0E89, 0x0E8A, 0x0E8C, 0x0E8D, 0x0E8E, 0x0E8F, 0x0E90, 0x0E91,
+            0x0E92, 0x0E93, 0x0E94, 0x0E95, 0x0E96, 0x0E97, 0x0E98, 0x0E99, 0x0E9A, 0x0E9B,
+            0x0E9C, 0x0E9D, 0x0E9E, 0x0E9F, 0x0EA0, 0x0EA1, 0x0EA2, 0x0EA3, 0x0EA5, 0x0EA7,
+            0x0EA8, 0x0EA9, 0x0EAA, 0x0EAB, 0x0EAC, 0x0EAD, 0x0EAE, 0x0EDC, 0x0EDD, 0x0EDE,
+            0x0EDF, 0x0E81, 0x0E82, 0x0E84, 0x0E86, 0x0E87, 0x0E88, 0x0E89, 0x0E8A, 0x0E8C,
+            0x0E8D, 0x0E8E, 0x0E8F, 0x0E90, 0x0E91, 0x0E92, 0x0E93, 0x0E94, 0x0E95, 0x0E96,
+            0x0E97, 0x0E98, 0x0E99, 0x0E9A, 0x0E9B, 0x0E9C, 0x0E9D, 0x0E9E, 0x0E9F, 0x0EA0,
+            0x0EA1, 0x0EA2, 0x0EA3, 0x0EA5, 0x0EA7, 0x0EA8, 0x0EA9, 0x0EAA, 0x0EAB, 0x0EAC,
+            0x0EAD, 0x0EAE, 0x0EDC, 0x0EDD, 0x0EDE, 0x0EDF, 0x0E81, 0x0E82, 0x0E84, 0x0E86,
+            0x0E87, 0x0E88, 0x0E89, 0x0E8A, 0x0E8C, 0x0E8D, 0x0E8E, 0x0E8F, 0x0E90, 0x0E91,
+            0x0E92, 0x0E93, 0x0E94, 0x0E95, 0x0E96, 0x0E97, 0x0E98, 0x0E99, 0x0E9A, 0x0E9B,
+            0x0E9C, 0x0E9D, 0x0E9E, 0x0E9F, 0x0EA0, 0x0EA1, 0x0EA2, 0x0EA3, 0x0EA5, 0x0EA7,
+            0x0EA8, 0x0EA9, 0x0EAA, 0x0EAB, 0x0EAC, 0x0EAD, 0x0EAE, 0x0EDC, 0x0EDD, 0x0EDE,
+            0x0EDF, 0x0E81, 0x0E82, 0x0E84, 0x0E86, 0x0E87, 0x0E88, 0x0E89, 0x0E8A, 0x0E8C,
+            0x0E8D, 0x0E8E, 0x0E8F, 0x0E90, 0x0E91, 0x0E92, 0x0E93, 0x0E94, 0x0E95, 0x0E96,
+            0x0E97, 0x0E98, 0x0E99, 0x0E9A, 0x0E9B, 0x0E9C, 0x0E9D, 0x0E9E, 0x0E9F, 0x0EA0,
+            0x0EA1, 0x0EA2, 0x0EA3, 0x0EA5, 0x0EA7, 0x0EA8, 0x0EA9, 0x0EAA, 0x0EAB, 0x0EAC,
+            0x0EAD, 0x0EAE, 0x0EDC, 0x0EDD, 0x0EDE, 0x0EDF, 0x0E81, 0x0E82, 0x0E84, 0x0E86,
+            0x0E87, 0x0E88, 0x0E89, 0x0E8A, 0x0E8C, 0x0E8D, 0x0E8E, 0x0E8F, 0x0E90, 0x0E91,
+            0x0E92, 0x0E93, 0x0E94, 0x0E95, 0x0E96, 0x0E97, 0x0E98, 0x0E99, 0x0E9A, 0x0E9B,
+            0x0E9C, 0x0E9D, 0x0E9E, 0x0E9F, 0x0EA0, 0x0EA1, 0x0EA2, 0x0EA3, 0x0EA5, 0x0EA7,
+            0x0EA8, 0x0EA9, 0x0EAA, 0x0EAB, 0x0EAC, 0x0EAD, 0x0EAE, 0x0EDC, 0x0EDD, 0x0EDE,
+            0x0EDF, 0x0EB2, 0x0F72, 0x0F74, 0x0F80, 0x0F71, 0x0F80, 0x0F81, 0x0F71, 0x0F80,
+            0x0F81, 0x102E, 0x1980, 0x1981, 0x1982, 0x1983, 0x1984, 0x1985, 0x1986, 0x1987,
+            0x1988, 0x1989, 0x198A, 0x198B, 0x198C, 0x198D, 0x198E, 0x198F, 0x1990, 0x1991,
+            0x1992, 0x1993, 0x1994, 0x1995, 0x1996, 0x1997, 0x1998, 0x1999, 0x199A, 0x199B,
+            0x199C, 0x199D, 0x199E, 0x199F, 0x19A0, 0x19A1, 0x19A2, 0x19A3, 0x19A4, 0x19A5,
+            0x19A6, 0x19A7, 0x19A8, 0x19A9, 0x19AA, 0x19AB, 0x1980, 0x1981, 0x1982, 0x1983,
+            0x1984, 0x1985, 0x1986, 0x1987, 0x1988, 0x1989, 0x198A, 0x198B, 0x198C, 0x198D,
+            0x198E, 0x198F, 0x1990, 0x1991, 0x1992, 0x1993, 0x1994, 0x1995, 0x1996, 0x1997,
+            0x1998, 0x1999, 0x199A, 0x199B, 0x199C, 0x199D, 0x199E, 0x199F, 0x19A0, 0x19A1,
+            0x19A2, 0x19A3, 0x19A4, 0x19A5, 0x19A6, 0x19A7, 0x19A8, 0x19A9, 0x19AA, 0x19AB,
+            0x1980, 0x1981, 0x1982, 0x1983, 0x1984, 0x1985, 0x1986, 0x1987, 0x1988, 0x1989,
+            0x198A, 0x198B, 0x198C, 0x198D, 0x198E, 0x198F, 0x1990, 0x1991, 0x1992, 0x1993,
+            0x1994, 0x1995, 0x1996, 0x1997, 0x1998, 0x1999, 0x199A, 0x199B, 0x199C, 0x199D,
+            0x199E, 0x199F, 0x19A0, 0x19A1, 0x19A2, 0x19A3, 0x19A4, 0x19A5, 0x19A6, 0x19A7,
+            0x19A8, 0x19A9, 0x19AA, 0x19AB, 0x1980, 0x1981, 0x1982, 0x1983, 0x1984, 0x1985,
+            0x1986, 0x1987, 0x1988, 0x1989, 0x198A, 0x198B, 0x198C, 0x198D, 0x198E, 0x198F,
+            0x1990, 0x1991, 0x1992, 0x1993, 0x1994, 0x1995, 0x1996, 0x1997, 0x1998, 0x1999,
+            0x199A, 0x199B, 0x199C, 0x199D, 0x199E, 0x199F, 0x19A0, 0x19A1, 0x19A2, 0x19A3,
+            0x19A4, 0x19A5, 0x19A6, 0x19A7, 0x19A8, 0x19A9, 0x19AA, 0x19AB, 0x1B35, 0x1B35,
+            0x1B35, 0x1B35, 0x1B35, 0x1B35, 0x1B35, 0x1B35, 0x1B35, 0x1B35, 0x1B35, 0xAA80,
+            0xAA81, 0xAA82, 0xAA83, 0xAA84, 0xAA85, 0xAA86, 0xAA87, 0xAA88, 0xAA89, 0xAA8A,
+            0xAA8B, 0xAA8C, 0xAA8D, 0xAA8E, 0xAA8F, 0xAA90, 0xAA91, 0xAA92, 0xAA93, 0xAA94,
+            0xAA95, 0xAA96, 0xAA97, 0xAA98, 0xAA99, 0xAA9A, 0xAA9B, 0xAA9C, 0xAA9D, 0xAA9E,
+            0xAA9F, 0xAAA0, 0xAAA1, 0xAAA2, 0xAAA3, 0xAAA4, 0xAAA5, 0xAAA6, 0xAAA7, 0xAAA8,
+            0xAAA9, 0xAAAA, 0xAAAB, 0xAAAC, 0xAAAD, 0xAAAE, 0xAAAF, 0xAA80, 0xAA81, 0xAA82,
+            0xAA83, 0xAA84, 0xAA85, 0xAA86, 0xAA87, 0xAA88, 0xAA89, 0xAA8A, 0xAA8B, 0xAA8C,
+            0xAA8D, 0xAA8E, 0xAA8F, 0xAA90, 0xAA91, 0xAA92, 0xAA93, 0xAA94, 0xAA95, 0xAA96,
+            0xAA97, 0xAA98, 0xAA99, 0xAA9A, 0xAA9B, 0xAA9C, 0xAA9D, 0xAA9E, 0xAA9F, 0xAAA0,
+            0xAAA1, 0xAAA2, 0xAAA3, 0xAAA4, 0xAAA5, 0xAAA6, 0xAAA7, 0xAAA8, 0xAAA9, 0xAAAA,
+            0xAAAB, 0xAAAC, 0xAAAD, 0xAAAE, 0xAAAF, 0xAA80, 0xAA81, 0xAA82, 0xAA83, 0xAA84,
+            0xAA85, 0xAA86, 0xAA87, 0xAA88, 0xAA89, 0xAA8A, 0xAA8B, 0xAA8C, 0xAA8D, 0xAA8E,
+            0xAA8F, 0xAA90, 0xAA91, 0xAA92, 0xAA93, 0xAA94, 0xAA95, 0xAA96, 0xAA97, 0xAA98,
+            0xAA99, 0xAA9A, 0xAA9B, 0xAA9C, 0xAA9D, 0xAA9E, 0xAA9F, 0xAAA0, 0xAAA1, 0xAAA2,
+            0xAAA3, 0xAAA4, 0xAAA5, 0xAAA6, 0xAAA7, 0xAAA8, 0xAAA9, 0xAAAA, 0xAAAB, 0xAAAC,
+            0xAAAD, 0xAAAE, 0xAAAF, 0xAA80, 0xAA81, 0xAA82, 0xAA83, 0xAA84, 0xAA85, 0xAA86,
+            0xAA87, 0xAA88, 0xAA89, 0xAA8A, 0xAA8B, 0xAA8C, 0xAA8D, 0xAA8E, 0xAA8F, 0xAA90,
+            0xAA91, 0xAA92, 0xAA93, 0xAA94, 0xAA95, 0xAA96, 0xAA97, 0xAA98, 0xAA99, 0xAA9A,
+            0xAA9B, 0xAA9C, 0xAA9D, 0xAA9E, 0xAA9F, 0xAAA0, 0xAAA1, 0xAAA2, 0xAAA3, 0xAAA4,
+            0xAAA5, 0xAAA6, 0xAAA7, 0xAAA8, 0xAAA9, 0xAAAA, 0xAAAB, 0xAAAC, 0xAAAD, 0xAAAE,
+            0xAAAF, 0xAA80, 0xAA81, 0xAA82, 0xAA83, 0xAA84, 0xAA85, 0xAA86, 0xAA87, 0xAA88,
+            0xAA89, 0xAA8A, 0xAA8B, 0xAA8C, 0xAA8D, 0xAA8E, 0xAA8F, 0xAA90, 0xAA91, 0xAA92,
+            0xAA93, 0xAA94, 0xAA95, 0xAA96, 0xAA97, 0xAA98, 0xAA99, 0xAA9A, 0xAA9B, 0xAA9C,
+            0xAA9D, 0xAA9E, 0xAA9F, 0xAAA0, 0xAAA1, 0xAAA2, 0xAAA3, 0xAAA4, 0xAAA5, 0xAAA6,
+            0xAAA7, 0xAAA8, 0xAAA9, 0xAAAA, 0xAAAB, 0xAAAC, 0xAAAD, 0xAAAE, 0xAAAF, 0x11127,
+            0x11127, 0x1133E, 0x11357, 0x114B0, 0x114BA, 0x114BD, 0x115AF, 0x115AF, 0x11930
+        };
+
+        const std::uint32_t _s_ducet_contraction_third[] = {
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0CD5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0DCA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F80, 0x0000, 0x0000, 0x0F80, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+            0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+        };
+
+        const std::uint32_t _s_ducet_contraction_info[] = {
+            0x00020175, 0x00020175, 0x00020177, 0x00020177, 0x000104BA, 0x000104DA, 0x00013536, 0x00013537, 0x00013538, 0x00010642,
+            0x00010643, 0x000107CF, 0x00013539, 0x0001082B, 0x0001082A, 0x0001353A, 0x0001353B, 0x00010850, 0x0001353C, 0x0001353D,
+            0x0001353E, 0x0001087A, 0x0001087D, 0x0001087E, 0x0001087C, 0x0001353F, 0x0001087E, 0x00010896, 0x00013540, 0x00013541,
+            0x000108BD, 0x000108BE, 0x000108BF, 0x00013542, 0x000108BF, 0x00023543, 0x00023545, 0x00023547, 0x00023549, 0x0002354B,
+            0x0002354D, 0x0002354F, 0x00023551, 0x00023553, 0x00023555, 0x00023557, 0x00023559, 0x0002355B, 0x0002355D, 0x0002355F,
+            0x00023561, 0x00023563, 0x00023565, 0x00023567, 0x00023569, 0x0002356B, 0x0002356D, 0x0002356F, 0x00023571, 0x00023573,
+            0x00023575, 0x00023577, 0x00023579, 0x0002357B, 0x0002357D, 0x0002357F, 0x00023581, 0x00023583, 0x00023585, 0x00023587,
+            0x00023589, 0x0002358B, 0x0002358D, 0x0002358F, 0x00023591, 0x00023593, 0x00023595, 0x00023597, 0x00023599, 0x0002359B,
+            0x0002359D, 0x0002359F, 0x000235A1, 0x000235A3, 0x000235A5, 0x000235A7, 0x000235A9, 0x000235AB, 0x000235AD, 0x000235AF,
+            0x000235B1, 0x000235B3, 0x000235B5, 0x000235B7, 0x000235B9, 0x000235BB, 0x000235BD, 0x000235BF, 0x000235C1, 0x000235C3,
+            0x000235C5, 0x000235C7, 0x000235C9, 0x000235CB, 0x000235CD, 0x000235CF, 0x000235D1, 0x000235D3, 0x000235D5, 0x000235D7,
+            0x000235D9, 0x000235DB, 0x000235DD, 0x000235DF, 0x000235E1, 0x000235E3, 0x000235E5, 0x000235E7, 0x000235E9, 0x000235EB,
+            0x000235ED, 0x000235EF, 0x000235F1, 0x000235F3, 0x000235F5, 0x000235F7, 0x000235F9, 0x000235FB, 0x000235FD, 0x000235FF,
+            0x00023601, 0x00023603, 0x00023605, 0x00023607, 0x00023609, 0x0002360B, 0x0002360D, 0x0002360F, 0x00023611, 0x00023613,
+            0x00023615, 0x00023617, 0x00023619, 0x0002361B, 0x0002361D, 0x0002361F, 0x00023621, 0x00023623, 0x00023625, 0x00023627,
+            0x00023629, 0x0002362B, 0x0002362D, 0x0002362F, 0x00023631, 0x00023633, 0x00023635, 0x00023637, 0x00023639, 0x0002363B,
+            0x0002363D, 0x0002363F, 0x00023641, 0x00023643, 0x00023645, 0x00023647, 0x00023649, 0x0002364B, 0x0002364D, 0x0002364F,
+            0x00023651, 0x00023653, 0x00023655, 0x00023657, 0x00023659, 0x0002365B, 0x0002365D, 0x0002365F, 0x00023661, 0x00023663,
+            0x00023665, 0x00023667, 0x00023669, 0x0002366B, 0x0002366D, 0x0002366F, 0x00023671, 0x00023673, 0x00023675, 0x00023677,
+            0x00023679, 0x0002367B, 0x0002367D, 0x0002367F, 0x00023681, 0x00023683, 0x00023685, 0x00023687, 0x00023689, 0x0002368B,
+            0x0002368D, 0x0002368F, 0x00023691, 0x00023693, 0x00023695, 0x00023697, 0x00023699, 0x0002369B, 0x0002369D, 0x0002369F,
+            0x000236A1, 0x000236A3, 0x000236A5, 0x000236A7, 0x000236A9, 0x000236AB, 0x000236AD, 0x000236AF, 0x000236B1, 0x000236B3,
+            0x000236B5, 0x000236B7, 0x000236B9, 0x000236BB, 0x000236BD, 0x000236BF, 0x000236C1, 0x000236C3, 0x000236C5, 0x000236C7,
+            0x000236C9, 0x000236CB, 0x000236CD, 0x000236CF, 0x000236D1, 0x000236D3, 0x000236D5, 0x000236D7, 0x000236D9, 0x000236DB,
+            0x000236DD, 0x000236DF, 0x000236E1, 0x000236E3, 0x000236E5, 0x000236E7, 0x000236E9, 0x000236EB, 0x000236ED, 0x000236EF,
+            0x000236F1, 0x000236F3, 0x000236F5, 0x000236F7, 0x000236F9, 0x000236FB, 0x000236FD, 0x000236FF, 0x00023701, 0x00023703,
+            0x00023705, 0x00023707, 0x00023709, 0x0002370B, 0x0002370D, 0x0001370F, 0x00023710, 0x00023712, 0x00023714, 0x00023716,
+            0x00023718, 0x0002371A, 0x0002371C, 0x0002371E, 0x00023720, 0x00023722, 0x00023724, 0x00023726, 0x00023728, 0x0002372A,
+            0x0002372C, 0x0002372E, 0x00023730, 0x00023732, 0x00023734, 0x00023736, 0x00023738, 0x0002373A, 0x0002373C, 0x0002373E,
+            0x00023740, 0x00023742, 0x00023744, 0x00023746, 0x00023748, 0x0002374A, 0x0002374C, 0x0002374E, 0x00023750, 0x00023752,
+            0x00023754, 0x00023756, 0x00023758, 0x0002375A, 0x0002375C, 0x0002375E, 0x00023760, 0x00033762, 0x00033765, 0x00023768,
+            0x0002376A, 0x0002376C, 0x0002376E, 0x00023770, 0x00023772, 0x00023774, 0x00023776, 0x00023778, 0x0002377A, 0x0002377C,
+            0x0002377E, 0x00023780, 0x00023782, 0x00023784, 0x00023786, 0x00023788, 0x0002378A, 0x0002378C, 0x0002378E, 0x00023790,
+            0x00023792, 0x00023794, 0x00023796, 0x00023798, 0x0002379A, 0x0002379C, 0x0002379E, 0x000237A0, 0x000237A2, 0x000237A4,
+            0x000237A6, 0x000237A8, 0x000237AA, 0x000237AC, 0x000237AE, 0x000237B0, 0x000237B2, 0x000237B4, 0x000237B6, 0x000237B8,
+            0x000237BA, 0x000237BC, 0x000337BE, 0x000337C1, 0x000237C4, 0x000237C6, 0x000237C8, 0x000237CA, 0x000237CC, 0x000237CE,
+            0x000237D0, 0x000237D2, 0x000237D4, 0x000237D6, 0x000237D8, 0x000237DA, 0x000237DC, 0x000237DE, 0x000237E0, 0x000237E2,
+            0x000237E4, 0x000237E6, 0x000237E8, 0x000237EA, 0x000237EC, 0x000237EE, 0x000237F0, 0x000237F2, 0x000237F4, 0x000237F6,
+            0x000237F8, 0x000237FA, 0x000237FC, 0x000237FE, 0x00023800, 0x00023802, 0x00023804, 0x00023806, 0x00023808, 0x0002380A,
+            0x0002380C, 0x0002380E, 0x00023810, 0x00023812, 0x00023814, 0x00023816, 0x00023818, 0x0003381A, 0x0003381D, 0x00023820,
+            0x00023822, 0x00023824, 0x00023826, 0x00023828, 0x0002382A, 0x0002382C, 0x0002382E, 0x00023830, 0x00023832, 0x00023834,
+            0x00023836, 0x00023838, 0x0002383A, 0x0002383C, 0x0002383E, 0x00023840, 0x00023842, 0x00023844, 0x00023846, 0x00023848,
+            0x0002384A, 0x0002384C, 0x0002384E, 0x00023850, 0x00023852, 0x00023854, 0x00023856, 0x00023858, 0x0002385A, 0x0002385C,
+            0x0002385E, 0x00023860, 0x00023862, 0x00023864, 0x00023866, 0x00023868, 0x0002386A, 0x0002386C, 0x0002386E, 0x00023870,
+            0x00023872, 0x00023874, 0x00033876, 0x00033879, 0x0002387C, 0x0002387E, 0x00023880, 0x00023882, 0x00023884, 0x00023886,
+            0x00023888, 0x0002388A, 0x0002388C, 0x0002388E, 0x00023890, 0x00023892, 0x00023894, 0x00023896, 0x00023898, 0x0002389A,
+            0x0002389C, 0x0002389E, 0x000238A0, 0x000238A2, 0x000238A4, 0x000238A6, 0x000238A8, 0x000238AA, 0x000238AC, 0x000238AE,
+            0x000238B0, 0x000238B2, 0x000238B4, 0x000238B6, 0x000238B8, 0x000238BA, 0x000238BC, 0x000238BE, 0x000238C0, 0x000238C2,
+            0x000238C4, 0x000238C6, 0x000238C8, 0x000238CA, 0x000238CC, 0x000238CE, 0x000238D0, 0x000338D2, 0x000338D5, 0x000238D8,
+            0x000238DA, 0x000138DC, 0x000138DD, 0x000138DE, 0x000138DF, 0x000138E0, 0x000138E1, 0x000138E0, 0x000138E2, 0x000138E3,
+            0x000138E2, 0x000109A3, 0x000238E4, 0x000238E6, 0x000238E8, 0x000238EA, 0x000238EC, 0x000238EE, 0x000238F0, 0x000238F2,
+            0x000238F4, 0x000238F6, 0x000238F8, 0x000238FA, 0x000238FC, 0x000238FE, 0x00023900, 0x00023902, 0x00023904, 0x00023906,
+            0x00023908, 0x0002390A, 0x0002390C, 0x0002390E, 0x00023910, 0x00023912, 0x00023914, 0x00023916, 0x00023918, 0x0002391A,
+            0x0002391C, 0x0002391E, 0x00023920, 0x00023922, 0x00023924, 0x00023926, 0x00023928, 0x0002392A, 0x0002392C, 0x0002392E,
+            0x00023930, 0x00023932, 0x00023934, 0x00023936, 0x00023938, 0x0002393A, 0x0002393C, 0x0002393E, 0x00023940, 0x00023942,
+            0x00023944, 0x00023946, 0x00023948, 0x0002394A, 0x0002394C, 0x0002394E, 0x00023950, 0x00023952, 0x00023954, 0x00023956,
+            0x00023958, 0x0002395A, 0x0002395C, 0x0002395E, 0x00023960, 0x00023962, 0x00023964, 0x00023966, 0x00023968, 0x0002396A,
+            0x0002396C, 0x0002396E, 0x00023970, 0x00023972, 0x00023974, 0x00023976, 0x00023978, 0x0002397A, 0x0002397C, 0x0002397E,
+            0x00023980, 0x00023982, 0x00023984, 0x00023986, 0x00023988, 0x0002398A, 0x0002398C, 0x0002398E, 0x00023990, 0x00023992,
+            0x00023994, 0x00023996, 0x00023998, 0x0002399A, 0x0002399C, 0x0002399E, 0x000239A0, 0x000239A2, 0x000239A4, 0x000239A6,
+            0x000239A8, 0x000239AA, 0x000239AC, 0x000239AE, 0x000239B0, 0x000239B2, 0x000239B4, 0x000239B6, 0x000239B8, 0x000239BA,
+            0x000239BC, 0x000239BE, 0x000239C0, 0x000239C2, 0x000239C4, 0x000239C6, 0x000239C8, 0x000239CA, 0x000239CC, 0x000239CE,
+            0x000239D0, 0x000239D2, 0x000239D4, 0x000239D6, 0x000239D8, 0x000239DA, 0x000239DC, 0x000239DE, 0x000239E0, 0x000239E2,
+            0x000239E4, 0x000239E6, 0x000239E8, 0x000239EA, 0x000239EC, 0x000239EE, 0x000239F0, 0x000239F2, 0x000239F4, 0x000239F6,
+            0x000239F8, 0x000239FA, 0x000239FC, 0x000239FE, 0x00023A00, 0x00023A02, 0x00023A04, 0x00023A06, 0x00023A08, 0x00023A0A,
+            0x00023A0C, 0x00023A0E, 0x00023A10, 0x00023A12, 0x00023A14, 0x00023A16, 0x00023A18, 0x00023A1A, 0x00023A1C, 0x00023A1E,
+            0x00023A20, 0x00023A22, 0x00023A24, 0x00023A26, 0x00023A28, 0x00023A2A, 0x00023A2C, 0x00023A2E, 0x00023A30, 0x00023A32,
+            0x00023A34, 0x00023A36, 0x00023A38, 0x00023A3A, 0x00023A3C, 0x00023A3E, 0x00023A40, 0x00023A42, 0x00010BD4, 0x00010BD6,
+            0x00010BD8, 0x00010BDA, 0x00010BDC, 0x00010BDE, 0x00010BE6, 0x00010BE8, 0x00010BEB, 0x00013A44, 0x00010BED, 0x00023A45,
+            0x00023A47, 0x00023A49, 0x00023A4B, 0x00023A4D, 0x00023A4F, 0x00023A51, 0x00023A53, 0x00023A55, 0x00023A57, 0x00023A59,
+            0x00023A5B, 0x00023A5D, 0x00023A5F, 0x00023A61, 0x00023A63, 0x00023A65, 0x00023A67, 0x00023A69, 0x00023A6B, 0x00023A6D,
+            0x00023A6F, 0x00023A71, 0x00023A73, 0x00023A75, 0x00023A77, 0x00023A79, 0x00023A7B, 0x00023A7D, 0x00023A7F, 0x00023A81,
+            0x00023A83, 0x00023A85, 0x00023A87, 0x00023A89, 0x00023A8B, 0x00023A8D, 0x00023A8F, 0x00023A91, 0x00023A93, 0x00023A95,
+            0x00023A97, 0x00023A99, 0x00023A9B, 0x00023A9D, 0x00023A9F, 0x00023AA1, 0x00023AA3, 0x00023AA5, 0x00023AA7, 0x00023AA9,
+            0x00023AAB, 0x00023AAD, 0x00023AAF, 0x00023AB1, 0x00023AB3, 0x00023AB5, 0x00023AB7, 0x00023AB9, 0x00023ABB, 0x00023ABD,
+            0x00023ABF, 0x00023AC1, 0x00023AC3, 0x00023AC5, 0x00023AC7, 0x00023AC9, 0x00023ACB, 0x00023ACD, 0x00023ACF, 0x00023AD1,
+            0x00023AD3, 0x00023AD5, 0x00023AD7, 0x00023AD9, 0x00023ADB, 0x00023ADD, 0x00023ADF, 0x00023AE1, 0x00023AE3, 0x00023AE5,
+            0x00023AE7, 0x00023AE9, 0x00023AEB, 0x00023AED, 0x00023AEF, 0x00023AF1, 0x00023AF3, 0x00023AF5, 0x00023AF7, 0x00023AF9,
+            0x00023AFB, 0x00023AFD, 0x00023AFF, 0x00023B01, 0x00023B03, 0x00023B05, 0x00023B07, 0x00023B09, 0x00023B0B, 0x00023B0D,
+            0x00023B0F, 0x00023B11, 0x00023B13, 0x00023B15, 0x00023B17, 0x00023B19, 0x00023B1B, 0x00023B1D, 0x00023B1F, 0x00023B21,
+            0x00023B23, 0x00023B25, 0x00023B27, 0x00023B29, 0x00023B2B, 0x00023B2D, 0x00023B2F, 0x00023B31, 0x00023B33, 0x00023B35,
+            0x00023B37, 0x00023B39, 0x00023B3B, 0x00023B3D, 0x00023B3F, 0x00023B41, 0x00023B43, 0x00023B45, 0x00023B47, 0x00023B49,
+            0x00023B4B, 0x00023B4D, 0x00023B4F, 0x00023B51, 0x00023B53, 0x00023B55, 0x00023B57, 0x00023B59, 0x00023B5B, 0x00023B5D,
+            0x00023B5F, 0x00023B61, 0x00023B63, 0x00023B65, 0x00023B67, 0x00023B69, 0x00023B6B, 0x00023B6D, 0x00023B6F, 0x00023B71,
+            0x00023B73, 0x00023B75, 0x00023B77, 0x00023B79, 0x00023B7B, 0x00023B7D, 0x00023B7F, 0x00023B81, 0x00023B83, 0x00023B85,
+            0x00023B87, 0x00023B89, 0x00023B8B, 0x00023B8D, 0x00023B8F, 0x00023B91, 0x00023B93, 0x00023B95, 0x00023B97, 0x00023B99,
+            0x00023B9B, 0x00023B9D, 0x00023B9F, 0x00023BA1, 0x00023BA3, 0x00023BA5, 0x00023BA7, 0x00023BA9, 0x00023BAB, 0x00023BAD,
+            0x00023BAF, 0x00023BB1, 0x00023BB3, 0x00023BB5, 0x00023BB7, 0x00023BB9, 0x00023BBB, 0x00023BBD, 0x00023BBF, 0x00023BC1,
+            0x00023BC3, 0x00023BC5, 0x00023BC7, 0x00023BC9, 0x00023BCB, 0x00023BCD, 0x00023BCF, 0x00023BD1, 0x00023BD3, 0x00023BD5,
+            0x00023BD7, 0x00023BD9, 0x00023BDB, 0x00023BDD, 0x00023BDF, 0x00023BE1, 0x00023BE3, 0x00023BE5, 0x00023BE7, 0x00023BE9,
+            0x00023BEB, 0x00023BED, 0x00023BEF, 0x00023BF1, 0x00023BF3, 0x00023BF5, 0x00023BF7, 0x00023BF9, 0x00023BFB, 0x00023BFD,
+            0x00023BFF, 0x00023C01, 0x00023C03, 0x00023C05, 0x00023C07, 0x00023C09, 0x00023C0B, 0x00023C0D, 0x00023C0F, 0x00023C11,
+            0x00023C13, 0x00023C15, 0x00023C17, 0x00023C19, 0x00023C1B, 0x00023C1D, 0x00023C1F, 0x00023C21, 0x00023C23, 0x00013C25,
+            0x00013C26, 0x00012DAC, 0x00013C27, 0x00013C28, 0x00013C29, 0x00013C2A, 0x00012DCC, 0x00013C2B, 0x00013C2C
+        };
+
+        // Ranges with explicit implicit weight bases (first, last, base).
+        const std::uint32_t _s_ducet_implicit_ranges[] = {
+            0x17000, 0x18AFF, 0xFB00, 0x18D00, 0x18D8F, 0xFB00, 0x1B170, 0x1B2FF, 0xFB01, 0x18B00,
+            0x18CFF, 0xFB02
+        };
+
+        // Unified_Ideograph (inversion list: even indices start a range, odd indices end it)
+        const std::uint32_t _s_unified_ideograph_ranges[] = {
+            0x3400, 0x4DC0, 0x4E00, 0xA000, 0xFA0E, 0xFA10, 0xFA11, 0xFA12, 0xFA13, 0xFA15,
+            0xFA1F, 0xFA20, 0xFA21, 0xFA22, 0xFA23, 0xFA25, 0xFA27, 0xFA2A, 0x20000, 0x2A6E0,
+            0x2A700, 0x2B739, 0x2B740, 0x2B81E, 0x2B820, 0x2CEA2, 0x2CEB0, 0x2EBE1, 0x30000, 0x3134B
+        };
+
+    } // namespace // ImplementationDetail
+    /// @endinternal
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_DUCET_TABLES_HPP)
@@ -0,0 +1,430 @@
+#if !defined(UNISTRINGXX_ENCODING_DETECTION_HPP)
+#define UNISTRINGXX_ENCODING_DETECTION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "codec.hpp"
+#include "codec_registry.hpp"
+#include "common.hpp"
+#include "uchar.hpp"
+
+namespace unistringxx
+{
+    ///
+    /// The kind of encoding of an encoding_guess: legacy encodings are the codecs of the registry (see find_codec()).
+    ///
+    enum class encoding_scheme
+    {
+        utf8,
+        utf16,
+        utf32,
+        legacy
+    };
+
+    ///
+    /// A guess of detect_encoding().
+    ///
+    struct encoding_guess
+    {
+        /// "UTF-8", "UTF-16BE", "UTF-16LE", "UTF-32BE", "UTF-32LE", or the name of a codec of the registry.
+        const char* name;
+        encoding_scheme scheme;
+        /// The byte order of UTF-16 and UTF-32 (unknown otherwise).
+        byte_order order;
+        /// From 1 (barely plausible) to 100 (certain, given by a byte order mark).
+        unsigned int confidence;
+        /// The number of octets of the byte order mark at the start of the input (0 if there is none).
+        std::size_t bom_size;
+    };
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        const std::size_t _s_max_encoding_guesses = 8;
+        // How much of the input detect_encoding() looks at by default.
+        const std::size_t _s_default_detection_size = 64 * 1024;
+        // The CJK decoders are run on the input in chunks of this size, into a buffer on the stack.
+        const std::size_t _s_detection_chunk_size = 256;
+
+        // Some of the most frequent Chinese characters, in their simplified and traditional forms (sorted).
+        const std::uint16_t _s_frequent_hanzi[] = {
+            0x4E00, 0x4E0A, 0x4E0B, 0x4E0D, 0x4E2A, 0x4E2D, 0x4E3A, 0x4E3B, 0x4E48, 0x4E4B, 0x4E5F, 0x4E86,
+            0x4E8B, 0x4E8E, 0x4E9B, 0x4EBA, 0x4ECE, 0x4ED6, 0x4EE5, 0x4EEC, 0x4F1A, 0x4F46, 0x4F5C, 0x4F60,
+            0x4F86, 0x500B, 0x5011, 0x5176, 0x51FA, 0x5206, 0x5230, 0x524D, 0x52A8, 0x52D5, 0x53BB, 0x53D1,
+            0x53EA, 0x53EF, 0x540C, 0x540E, 0x548C, 0x56E0, 0x56FD, 0x570B, 0x5728, 0x5730, 0x591A, 0x5927,
+            0x5929, 0x5979, 0x597D, 0x5982, 0x5B50, 0x5B66, 0x5B78, 0x5B9A, 0x5B9E, 0x5BB6, 0x5BE6, 0x5BF9,
+            0x5C0D, 0x5C0F, 0x5C31, 0x5E74, 0x5F00, 0x5F53, 0x5F8C, 0x5F97, 0x5F9E, 0x5FC3, 0x60F3, 0x6210,
+            0x6211, 0x6240, 0x65B9, 0x65F6, 0x662F, 0x6642, 0x6703, 0x6709, 0x672C, 0x6765, 0x6837, 0x6A23,
+            0x6C92, 0x6CA1, 0x6CD5, 0x70BA, 0x7136, 0x73B0, 0x73FE, 0x7406, 0x751F, 0x7528, 0x7576, 0x767C,
+            0x7684, 0x770B, 0x7740, 0x79CD, 0x7A2E, 0x7D93, 0x7ECF, 0x800C, 0x80FD, 0x81EA, 0x884C, 0x88E1,
+            0x8981, 0x8AAA, 0x8BF4, 0x8D77, 0x8FC7, 0x8FD8, 0x8FD9, 0x8FDB, 0x9032, 0x904E, 0x9053, 0x9084,
+            0x90A3, 0x90E8, 0x90FD, 0x91CC, 0x958B, 0x9762, 0x9EBC
+        };
+
+        // What the scan of the input found.
+        struct detection_statistics
+        {
+            std::size_t size;
+            // Whether the scanned prefix stops before the end of the input (a sequence cut at its end is not an error).
+            bool is_prefix;
+            std::size_t high_octets;
+            // The ASCII letters, and the high octets that follow another high octet (which make up the words of a
+            // non-Latin script in a single-byte encoding).
+            std::size_t ascii_letters;
+            std::size_t high_runs;
+            // The zero octets at each position modulo 4.
+            std::size_t zeros[4];
+            bool is_utf8;
+            std::size_t utf8_sequences;
+        };
+
+        // Finds the first octet of [first, last) that does not start a valid UTF-8 sequence, skipping the ASCII 16
+        // octets at a time. Returns last if they are all valid.
+        inline const std::uint8_t* find_invalid_utf8(
+            const std::uint8_t* first, const std::uint8_t* last, std::size_t& sequence_count
+        ) noexcept
+        {
+            while (first != last) {
+                if (((last - first) >= 16) && is_ascii_block(first)) {
+                    first += 16;
+                    continue;
+                }
+                if (*first < 0x80) {
+                    ++first;
+                    continue;
+                }
+                std::uint32_t code_point = 0;
+                const std::size_t sequence_size = decode_utf8(first, last, code_point);
+                if (sequence_size == 0)
+                    break;
+                first += sequence_size;
+                sequence_count++;
+            }
+            return (first);
+        }
+
+        // Counts the zero octets of [first, last) at each position modulo 4 (first being at position 0).
+        inline void count_zero_octets(const std::uint8_t* first, const std::uint8_t* last, std::size_t* zeros) noexcept
+        {
+            std::size_t position = 0;
+#if (UNISTRINGXX_HAS_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            for (; (last - first) >= 16; first += 16) {
+                std::uint32_t mask = static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), zero))
+                );
+                for (; mask != 0; mask &= (mask - 1))
+                    zeros[count_trailing_zeros(mask) % 4]++;
+            }
+#endif // (UNISTRINGXX_HAS_SSE2)
+            for (; first != last; ++first, ++position) {
+                if (*first == 0)
+                    zeros[position % 4]++;
+            }
+            return;
+        }
+
+        inline bool is_ascii_letter(std::uint8_t octet) noexcept
+        { return (((octet | 0x20) >= 'a') && ((octet | 0x20) <= 'z')); }
+
+        inline detection_statistics scan_for_detection(
+            const std::uint8_t* first, std::size_t size, bool is_prefix
+        ) noexcept
+        {
+            detection_statistics statistics = {size, is_prefix, 0, 0, 0, {0, 0, 0, 0}, false, 0};
+            const std::uint8_t* last = first + size;
+            count_zero_octets(first, last, statistics.zeros);
+            const std::uint8_t* invalid = find_invalid_utf8(first, last, statistics.utf8_sequences);
+            // A sequence cut at the end of the prefix is fine.
+            const std::size_t remaining = static_cast<std::size_t>(last - invalid);
+            statistics.is_utf8 = (
+                (invalid == last) || (is_prefix && (remaining < 4) && (utf8_sequence_size(*invalid) > remaining))
+            );
+            bool is_previous_high = false;
+            for (const std::uint8_t* octet = first; octet != last; ++octet) {
+                const bool is_high = (*octet >= 0x80);
+                if (is_high) {
+                    statistics.high_octets++;
+                    statistics.high_runs += (is_previous_high ? 1 : 0);
+                }
+                else {
+                    statistics.ascii_letters += (is_ascii_letter(*octet) ? 1 : 0);
+                }
+                is_previous_high = is_high;
+            }
+            return (statistics);
+        }
+
+        // Scores how much a decoded code point looks like Japanese (kana above all) or Chinese (frequent characters
+        // above all) text, from 0 to 3.
+        inline unsigned int score_cjk_code_point(std::uint32_t code_point, bool is_japanese) noexcept
+        {
+            const bool is_kana = ((code_point >= 0x3041) && (code_point <= 0x30FF));
+            const bool is_ideograph = ((code_point >= 0x4E00) && (code_point <= 0x9FFF));
+            const bool is_punctuation = (
+                ((code_point >= 0x3000) && (code_point <= 0x303F)) ||
+                ((code_point >= 0xFF01) && (code_point <= 0xFF5E))
+            );
+            if (is_japanese)
+                return (is_kana ? 2 : ((is_ideograph || is_punctuation) ? 1 : 0));
+            if (is_ideograph) {
+                const std::uint16_t* hanzi_end = (
+                    _s_frequent_hanzi + (sizeof (_s_frequent_hanzi) / sizeof (_s_frequent_hanzi[0]))
+                );
+                const bool is_frequent = std::binary_search(
+                    _s_frequent_hanzi, hanzi_end, static_cast<std::uint16_t>(code_point)
+                );
+                return (is_frequent ? 3 : 1);
+            }
+            return (is_punctuation ? 1 : 0);
+        }
+
+        // Decodes [first, first + size) with a CJK codec, without keeping the output. Returns the confidence that the
+        // input is in this encoding (0 if it has errors).
+        inline unsigned int detect_cjk_codec(
+            const codec_descriptor& descriptor, const std::uint8_t* first, std::size_t size, bool is_prefix
+        ) noexcept
+        {
+            const bool is_japanese = (
+                (descriptor.family == codec_family::shift_jis) || (descriptor.family == codec_family::euc_jp)
+            );
+            std::uint8_t state[_s_cjk_state_size] = {};
+            uchar_t out[_s_detection_chunk_size + _s_cjk_state_size];
+            std::size_t decoded_count = 0;
+            std::size_t error_count = 0;
+            std::size_t score = 0;
+            for (std::size_t offset = 0; offset < size; offset += _s_detection_chunk_size) {
+                const std::uint8_t* chunk = first + offset;
+                std::size_t count = 0;
+                bool is_decoded = true;
+                const std::size_t chunk_size = std::min(_s_detection_chunk_size, size - offset);
+                decode_with_codec(
+                    descriptor, state, codec_error_policy::replace, chunk, chunk + chunk_size, out, count, is_decoded
+                );
+                for (std::size_t ctr = 0; ctr < count; ctr++) {
+                    const std::uint32_t code_point = static_cast<std::uint32_t>(out[ctr].code_point());
+                    if (code_point < 0x80)
+                        continue;
+                    if (code_point == _s_replacement_character) {
+                        error_count++;
+                        continue;
+                    }
+                    decoded_count++;
+                    score += score_cjk_code_point(code_point, is_japanese);
+                }
+                // Legacy text has almost no errors: give up early on anything else.
+                if (error_count > 1)
+                    return (0);
+            }
+            // The input ends in the middle of a sequence.
+            if (!is_prefix && (state[0] != 0))
+                error_count++;
+            if ((decoded_count == 0) || ((error_count * 50) > decoded_count))
+                return (0);
+            // 30 for random characters, up to 90 for a fair share of kana or of the most frequent characters.
+            const std::size_t confidence = 30 + ((score * 30) / decoded_count) - (error_count * 10);
+            return (static_cast<unsigned int>(std::min<std::size_t>(confidence, 90)));
+        }
+
+        // Whether the zero octets are laid out like UTF-32 text (in the given byte order): the two high octets of
+        // each unit are zero for the code points of the BMP.
+        inline unsigned int detect_utf32(const detection_statistics& statistics, bool is_big_endian) noexcept
+        {
+            const std::size_t units = statistics.size / 4;
+            const std::size_t high_zeros = is_big_endian ? statistics.zeros[0] : statistics.zeros[3];
+            const std::size_t next_zeros = is_big_endian ? statistics.zeros[1] : statistics.zeros[2];
+            if ((units == 0) || ((high_zeros * 10) < (units * 9)) || ((next_zeros * 10) < (units * 9)))
+                return (0);
+            return (90);
+        }
+
+        // Whether the zero octets are laid out like UTF-16 text (in the given byte order): the high octet of ASCII
+        // and Latin code units is zero.
+        inline unsigned int detect_utf16(
+            const detection_statistics& statistics, const std::uint8_t* data, bool is_big_endian
+        ) noexcept
+        {
+            const std::size_t units = statistics.size / 2;
+            const std::size_t high_zeros = is_big_endian ?
+                (statistics.zeros[0] + statistics.zeros[2]) : (statistics.zeros[1] + statistics.zeros[3]);
+            const std::size_t low_zeros = is_big_endian ?
+                (statistics.zeros[1] + statistics.zeros[3]) : (statistics.zeros[0] + statistics.zeros[2]);
+            if ((units == 0) || ((high_zeros * 10) < (units * 3)) || ((low_zeros * 10) > units))
+                return (0);
+            // The surrogates must be paired (a high surrogate cut at the end of the prefix is fine).
+            bool is_high_surrogate = false;
+            for (std::size_t ctr = 0; ctr < units; ctr++) {
+                const std::uint32_t unit = read_unit16(data + (ctr * 2), is_big_endian);
+                const bool is_surrogate = ((unit >= 0xD800) && (unit <= 0xDFFF));
+                if (is_high_surrogate != (is_surrogate && (unit >= 0xDC00)))
+                    return (0);
+                is_high_surrogate = (is_surrogate && (unit < 0xDC00));
+            }
+            if (is_high_surrogate && !statistics.is_prefix)
+                return (0);
+            // Mostly ASCII text has a zero high octet in every other unit or more.
+            return (static_cast<unsigned int>(std::min<std::size_t>(60 + ((high_zeros * 30) / units), 90)));
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// The guesses of detect_encoding(), from the most to the least likely.
+    ///
+    class encoding_guesses
+    {
+    public:
+        typedef const encoding_guess* const_iterator;
+
+        encoding_guesses(void) noexcept :
+            _guesses{}, _size{0}
+        { return; }
+
+        std::size_t size(void) const noexcept
+        { return (_size); }
+
+        bool empty(void) const noexcept
+        { return (_size == 0); }
+
+        const encoding_guess& operator [] (std::size_t index) const noexcept
+        { return (_guesses[index]); }
+
+        const_iterator begin(void) const noexcept
+        { return (_guesses); }
+
+        const_iterator end(void) const noexcept
+        { return (_guesses + _size); }
+
+        ///
+        /// Gets the most likely guess. Call this only if the guesses are not empty.
+        ///
+        const encoding_guess& best(void) const noexcept
+        { return (_guesses[0]); }
+
+        ///
+        /// Adds a guess, keeping the guesses sorted by decreasing confidence (a guess with the same confidence as
+        /// another one comes after it). The least likely guess is dropped when there are too many.
+        ///
+        void add(const encoding_guess& guess) noexcept
+        {
+            if ((_size == _s_max_encoding_guesses) && (_guesses[_size - 1].confidence >= guess.confidence))
+                return;
+            std::size_t position = std::min(_size, _s_max_encoding_guesses - 1);
+            for (; (position > 0) && (_guesses[position - 1].confidence < guess.confidence); position--)
+                _guesses[position] = _guesses[position - 1];
+            _guesses[position] = guess;
+            _size = std::min(_size + 1, _s_max_encoding_guesses);
+            return;
+        }
+
+    private:
+        encoding_guess _guesses[_s_max_encoding_guesses];
+        std::size_t _size;
+    }; // class encoding_guesses
+
+    ///
+    /// Guesses the encoding of [data, data + size) from at most its first max_size octets, without allocating or
+    /// throwing. A byte order mark is taken as certain. Otherwise the guesses come from the layout of the zero octets
+    /// (UTF-16 and UTF-32), UTF-8 validation, trial decoding with the CJK codecs scored on the characters they give,
+    /// and the distribution of the high octets (windows-1252 for Latin text, windows-1251 for words made of high
+    /// octets). Text that is all ASCII is UTF-8 with full confidence. The guesses are empty only for an empty input.
+    ///
+    inline encoding_guesses detect_encoding(
+        const void* data, std::size_t size, std::size_t max_size = _s_default_detection_size
+    ) noexcept
+    {
+        encoding_guesses guesses;
+        const std::uint8_t* first = static_cast<const std::uint8_t*>(data);
+        const bool is_prefix = (size > max_size);
+        size = std::min(size, max_size);
+        if (size == 0)
+            return (guesses);
+
+        // The byte order marks, UTF-32LE first since its mark starts like the one of UTF-16LE.
+        if ((size >= 4) && (first[0] == 0xFF) && (first[1] == 0xFE) && (first[2] == 0) && (first[3] == 0)) {
+            guesses.add({"UTF-32LE", encoding_scheme::utf32, byte_order::little_endian, 100, 4});
+            guesses.add({"UTF-16LE", encoding_scheme::utf16, byte_order::little_endian, 50, 2});
+            return (guesses);
+        }
+        if ((size >= 4) && (first[0] == 0) && (first[1] == 0) && (first[2] == 0xFE) && (first[3] == 0xFF)) {
+            guesses.add({"UTF-32BE", encoding_scheme::utf32, byte_order::big_endian, 100, 4});
+            return (guesses);
+        }
+        if ((size >= 3) && (first[0] == 0xEF) && (first[1] == 0xBB) && (first[2] == 0xBF)) {
+            guesses.add({"UTF-8", encoding_scheme::utf8, byte_order::unknown, 100, 3});
+            return (guesses);
+        }
+        if ((size >= 2) && (first[0] == 0xFE) && (first[1] == 0xFF)) {
+            guesses.add({"UTF-16BE", encoding_scheme::utf16, byte_order::big_endian, 100, 2});
+            return (guesses);
+        }
+        if ((size >= 2) && (first[0] == 0xFF) && (first[1] == 0xFE)) {
+            guesses.add({"UTF-16LE", encoding_scheme::utf16, byte_order::little_endian, 100, 2});
+            return (guesses);
+        }
+
+        const detection_statistics statistics = scan_for_detection(first, size, is_prefix);
+        const std::size_t zero_count = (
+            statistics.zeros[0] + statistics.zeros[1] + statistics.zeros[2] + statistics.zeros[3]
+        );
+        if (zero_count != 0) {
+            // UTF-32 also looks like UTF-16 with many zero units, so it is tried first.
+            const unsigned int utf32_big_endian = detect_utf32(statistics, true);
+            const unsigned int utf32_little_endian = detect_utf32(statistics, false);
+            if (utf32_big_endian != 0)
+                guesses.add({"UTF-32BE", encoding_scheme::utf32, byte_order::big_endian, utf32_big_endian, 0});
+            if (utf32_little_endian != 0)
+                guesses.add({"UTF-32LE", encoding_scheme::utf32, byte_order::little_endian, utf32_little_endian, 0});
+            if (!guesses.empty())
+                return (guesses);
+            const unsigned int utf16_big_endian = detect_utf16(statistics, first, true);
+            const unsigned int utf16_little_endian = detect_utf16(statistics, first, false);
+            if (utf16_big_endian != 0)
+                guesses.add({"UTF-16BE", encoding_scheme::utf16, byte_order::big_endian, utf16_big_endian, 0});
+            if (utf16_little_endian != 0)
+                guesses.add({"UTF-16LE", encoding_scheme::utf16, byte_order::little_endian, utf16_little_endian, 0});
+            if (!guesses.empty())
+                return (guesses);
+        }
+
+        if (statistics.high_octets == 0) {
+            // Binary data with zero octets is valid UTF-8 too, but not text.
+            guesses.add({"UTF-8", encoding_scheme::utf8, byte_order::unknown, (zero_count == 0) ? 100u : 50u, 0});
+            return (guesses);
+        }
+        if (statistics.is_utf8) {
+            // Legacy text is unlikely to be valid UTF-8 by chance, less so with every sequence.
+            const std::size_t confidence = std::min<std::size_t>(80 + (statistics.utf8_sequences * 5), 99);
+            guesses.add(
+                {"UTF-8", encoding_scheme::utf8, byte_order::unknown, static_cast<unsigned int>(confidence), 0}
+            );
+        }
+
+        // The CJK codecs of the registry (GBK is left out: GB18030 decodes it the same).
+        unsigned int best_cjk_confidence = 0;
+        for (std::size_t index = 0; index < _s_codec_count; index++) {
+            const codec_descriptor& descriptor = _s_codecs[index];
+            if ((descriptor.family == codec_family::single_byte) || (descriptor.family == codec_family::gbk))
+                continue;
+            unsigned int confidence = detect_cjk_codec(descriptor, first, size, is_prefix);
+            if (confidence == 0)
+                continue;
+            confidence = statistics.is_utf8 ? (confidence / 4) : confidence;
+            best_cjk_confidence = std::max(best_cjk_confidence, confidence);
+            guesses.add({descriptor.name, encoding_scheme::legacy, byte_order::unknown, confidence, 0});
+        }
+
+        // The single-byte encodings decode anything, so they come last. Words made of high octets are not Latin.
+        const unsigned int confidence = (statistics.is_utf8 || (best_cjk_confidence >= 50)) ? 10 : 40;
+        const bool is_latin = ((statistics.high_runs * 2) < (statistics.ascii_letters + statistics.high_octets));
+        const char* const likely_name = is_latin ? "windows-1252" : "windows-1251";
+        const char* const other_name = is_latin ? "windows-1251" : "windows-1252";
+        guesses.add({likely_name, encoding_scheme::legacy, byte_order::unknown, confidence, 0});
+        guesses.add({other_name, encoding_scheme::legacy, byte_order::unknown, confidence / 2, 0});
+        return (guesses);
+    }
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_ENCODING_DETECTION_HPP)
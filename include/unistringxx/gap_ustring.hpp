@@ -0,0 +1,548 @@
+#if !defined(UNISTRINGXX_GAP_USTRING_HPP)
+#define UNISTRINGXX_GAP_USTRING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    ///
+    /// A text stored as a gap buffer: the code points before and after a cursor are kept at the two ends of one
+    /// buffer, with the free space (the gap) between them. Inserting or erasing at the gap is O(1) (amortized), and the
+    /// gap only moves when an edit happens elsewhere, at a cost proportional to the distance moved. This makes editing
+    /// at a cursor (e.g. typing) O(1) per code point instead of O(n) for ustring, as long as the edits are local.
+    ///
+    /// The insert and erase functions have the same signatures as ustring's. view() moves the gap to the end to
+    /// provide a contiguous ustring_view (e.g. for searching with the ustring_view functions).
+    ///
+    template<typename allocatorT>
+    class generic_gap_ustring
+    {
+    public:
+        typedef std::vector<uchar_t_traits::char_type, allocatorT> impl_type;
+
+        typedef uchar_t_traits traits_type;
+        typedef typename traits_type::char_type char_type;
+        typedef char_type value_type;
+        typedef typename impl_type::allocator_type allocator_type;
+        typedef typename impl_type::size_type size_type;
+        typedef typename impl_type::difference_type difference_type;
+        typedef char_type& reference;
+        typedef const char_type& const_reference;
+
+    private:
+        // Iterators are positions in the text (not in the buffer), so they are invalidated by any edit, like ustring
+        // iterators.
+        template<typename ownerT, typename referenceT>
+        class gap_iterator
+        {
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef uchar_t value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef typename std::remove_reference<referenceT>::type* pointer;
+            typedef referenceT reference;
+
+            gap_iterator(void) noexcept :
+                _owner{nullptr}, _index{0}
+            { return; }
+
+            gap_iterator(ownerT* owner, size_type index) noexcept :
+                _owner{owner}, _index{index}
+            { return; }
+
+            // Allows converting an iterator to a const_iterator.
+            template<typename otherOwnerT, typename otherReferenceT>
+            gap_iterator(const gap_iterator<otherOwnerT, otherReferenceT>& other) noexcept :
+                _owner{other._owner}, _index{other._index}
+            { return; }
+
+            reference operator*(void) const
+            { return ((*_owner)[_index]); }
+
+            pointer operator->(void) const
+            { return (&((*_owner)[_index])); }
+
+            reference operator[](difference_type offset) const
+            { return ((*_owner)[static_cast<size_type>(static_cast<difference_type>(_index) + offset)]); }
+
+            gap_iterator& operator++(void) noexcept
+            {
+                _index++;
+                return (*this);
+            }
+
+            gap_iterator operator++(int) noexcept
+            {
+                gap_iterator result{*this};
+                _index++;
+                return (result);
+            }
+
+            gap_iterator& operator--(void) noexcept
+            {
+                _index--;
+                return (*this);
+            }
+
+            gap_iterator operator--(int) noexcept
+            {
+                gap_iterator result{*this};
+                _index--;
+                return (result);
+            }
+
+            gap_iterator& operator+=(difference_type offset) noexcept
+            {
+                _index = static_cast<size_type>(static_cast<difference_type>(_index) + offset);
+                return (*this);
+            }
+
+            gap_iterator& operator-=(difference_type offset) noexcept
+            {
+                _index = static_cast<size_type>(static_cast<difference_type>(_index) - offset);
+                return (*this);
+            }
+
+            friend gap_iterator operator+(gap_iterator itr, difference_type offset) noexcept
+            { return (itr += offset); }
+
+            friend gap_iterator operator+(difference_type offset, gap_iterator itr) noexcept
+            { return (itr += offset); }
+
+            friend gap_iterator operator-(gap_iterator itr, difference_type offset) noexcept
+            { return (itr -= offset); }
+
+            friend difference_type operator-(const gap_iterator& left, const gap_iterator& right) noexcept
+            { return (static_cast<difference_type>(left._index) - static_cast<difference_type>(right._index)); }
+
+            friend bool operator==(const gap_iterator& left, const gap_iterator& right) noexcept
+            { return (left._index == right._index); }
+
+            friend bool operator!=(const gap_iterator& left, const gap_iterator& right) noexcept
+            { return (left._index != right._index); }
+
+            friend bool operator<(const gap_iterator& left, const gap_iterator& right) noexcept
+            { return (left._index < right._index); }
+
+            friend bool operator<=(const gap_iterator& left, const gap_iterator& right) noexcept
+            { return (left._index <= right._index); }
+
+            friend bool operator>(const gap_iterator& left, const gap_iterator& right) noexcept
+            { return (left._index > right._index); }
+
+            friend bool operator>=(const gap_iterator& left, const gap_iterator& right) noexcept
+            { return (left._index >= right._index); }
+
+        private:
+            template<typename otherOwnerT, typename otherReferenceT>
+            friend class gap_iterator;
+            friend class generic_gap_ustring;
+
+            ownerT* _owner;
+            size_type _index;
+        }; // class gap_iterator
+
+    public:
+        typedef gap_iterator<generic_gap_ustring, reference> iterator;
+        typedef gap_iterator<const generic_gap_ustring, const_reference> const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+        generic_gap_ustring(void) :
+            generic_gap_ustring{allocatorT()}
+        { return; }
+
+        explicit generic_gap_ustring(const allocator_type& alloc) :
+            _impl{alloc}, _gap_start{0}, _gap_end{0}
+        { return; }
+
+        explicit generic_gap_ustring(ustring_view text, const allocator_type& alloc = allocator_type()) :
+            _impl{text.begin(), text.end(), alloc}, _gap_start{text.size()}, _gap_end{text.size()}
+        { return; }
+
+        allocator_type get_allocator(void) const
+        { return (_impl.get_allocator()); }
+
+        // UNISTRINGXX_GAP_USTRING_ITERATORS
+
+        iterator begin(void) noexcept
+        { return (iterator{this, 0}); }
+
+        const_iterator begin(void) const noexcept
+        { return (const_iterator{this, 0}); }
+
+        const_iterator cbegin(void) const noexcept
+        { return (const_iterator{this, 0}); }
+
+        iterator end(void) noexcept
+        { return (iterator{this, this->size()}); }
+
+        const_iterator end(void) const noexcept
+        { return (const_iterator{this, this->size()}); }
+
+        const_iterator cend(void) const noexcept
+        { return (const_iterator{this, this->size()}); }
+
+        reverse_iterator rbegin(void) noexcept
+        { return (reverse_iterator{this->end()}); }
+
+        const_reverse_iterator rbegin(void) const noexcept
+        { return (const_reverse_iterator{this->end()}); }
+
+        reverse_iterator rend(void) noexcept
+        { return (reverse_iterator{this->begin()}); }
+
+        const_reverse_iterator rend(void) const noexcept
+        { return (const_reverse_iterator{this->begin()}); }
+
+        // UNISTRINGXX_GAP_USTRING_SIZES
+
+        size_type size(void) const noexcept
+        { return (_impl.size() - (_gap_end - _gap_start)); }
+
+        size_type length(void) const noexcept
+        { return (this->size()); }
+
+        bool empty(void) const noexcept
+        { return (this->size() == 0); }
+
+        size_type capacity(void) const noexcept
+        { return (_impl.size()); }
+
+        ///
+        /// Gets the position of the gap (i.e. of the last edit), where editing is O(1).
+        ///
+        size_type gap_position(void) const noexcept
+        { return (_gap_start); }
+
+        void reserve(size_type new_capacity)
+        {
+            if (new_capacity > this->capacity())
+                this->grow(new_capacity - this->size());
+            return;
+        }
+
+        // UNISTRINGXX_GAP_USTRING_ELEMENT_ACCESS
+
+        reference operator[](size_type index)
+        { return (_impl[(index < _gap_start) ? index : (index + (_gap_end - _gap_start))]); }
+
+        const_reference operator[](size_type index) const
+        { return (_impl[(index < _gap_start) ? index : (index + (_gap_end - _gap_start))]); }
+
+        reference at(size_type index)
+        {
+            this->check_access(index);
+            return ((*this)[index]);
+        }
+
+        const_reference at(size_type index) const
+        {
+            this->check_access(index);
+            return ((*this)[index]);
+        }
+
+        // UNISTRINGXX_GAP_USTRING_OPERATIONS
+
+        void clear(void) noexcept
+        {
+            _gap_start = 0;
+            _gap_end = _impl.size();
+            return;
+        }
+
+        generic_gap_ustring& insert(size_type index, size_type count, char_type ch)
+        {
+            this->prepare_insert(this->check_index(index), count);
+            std::fill_n(_impl.begin() + _gap_start, count, ch);
+            _gap_start += count;
+            return (*this);
+        }
+
+        generic_gap_ustring& insert(size_type index, ustring_view text)
+        {
+            if (this->is_aliased(text)) {
+                // The gap moves (or the buffer is reallocated) before the text is copied.
+                const impl_type copy(text.begin(), text.end(), _impl.get_allocator());
+                return (this->insert(index, ustring_view{copy.data(), copy.size()}));
+            }
+            this->prepare_insert(this->check_index(index), text.size());
+            std::copy(text.begin(), text.end(), _impl.begin() + _gap_start);
+            _gap_start += text.size();
+            return (*this);
+        }
+
+        iterator insert(const_iterator pos, char_type ch)
+        {
+            this->insert(pos._index, 1, ch);
+            return (iterator{this, pos._index});
+        }
+
+        iterator insert(const_iterator pos, size_type count, char_type ch)
+        {
+            this->insert(pos._index, count, ch);
+            return (iterator{this, pos._index});
+        }
+
+        ///
+        /// Inserts the code points of [first, last), which must not be iterators into this text.
+        ///
+        template<
+            typename inputIterT,
+            typename = typename std::enable_if<!std::is_integral<inputIterT>::value>::type
+        >
+        iterator insert(const_iterator pos, inputIterT first, inputIterT last)
+        {
+            this->insert_range(
+                this->check_index(pos._index), first, last,
+                typename std::iterator_traits<inputIterT>::iterator_category{}
+            );
+            return (iterator{this, pos._index});
+        }
+
+        iterator insert(const_iterator pos, std::initializer_list<char_type> init_list)
+        {
+            this->insert(pos._index, ustring_view{init_list.begin(), init_list.size()});
+            return (iterator{this, pos._index});
+        }
+
+        generic_gap_ustring& erase(size_type index = 0, size_type count = npos)
+        {
+            index = this->check_index(index);
+            count = std::min(count, this->size() - index);
+            if ((index + count) == _gap_start) {
+                // Backspace: no need to move the gap.
+                _gap_start = index;
+                return (*this);
+            }
+            this->move_gap(index);
+            _gap_end += count;
+            return (*this);
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            this->erase(pos._index, 1);
+            return (iterator{this, pos._index});
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            this->erase(first._index, static_cast<size_type>(last - first));
+            return (iterator{this, first._index});
+        }
+
+        generic_gap_ustring& replace(size_type index, size_type count, ustring_view text)
+        {
+            if (this->is_aliased(text)) {
+                // The erased code points may be part of the text.
+                const impl_type copy(text.begin(), text.end(), _impl.get_allocator());
+                return (this->replace(index, count, ustring_view{copy.data(), copy.size()}));
+            }
+            this->erase(index, count);
+            return (this->insert(index, text));
+        }
+
+        void push_back(char_type ch)
+        {
+            this->insert(this->size(), 1, ch);
+            return;
+        }
+
+        void pop_back(void)
+        {
+            this->erase(this->size() - 1, 1);
+            return;
+        }
+
+        generic_gap_ustring& append(ustring_view text)
+        { return (this->insert(this->size(), text)); }
+
+        ///
+        /// Gets the text as a contiguous view, by moving the gap to the end. The view is invalidated by any edit.
+        ///
+        ustring_view view(void)
+        {
+            this->move_gap(this->size());
+            return (ustring_view{_impl.data(), this->size()});
+        }
+
+        ///
+        /// Copies the text to a ustring (without moving the gap).
+        ///
+        generic_ustring<allocatorT> to_ustring(void) const
+        {
+            generic_ustring<allocatorT> result{this->get_allocator()};
+            result.reserve(this->size() + 1);
+            result.append(_impl.begin(), _impl.begin() + _gap_start);
+            result.append(_impl.begin() + _gap_end, _impl.end());
+            return (result);
+        }
+
+        size_type find(ustring_view str, size_type index = 0) const
+        {
+            if ((index > this->size()) || (str.size() > (this->size() - index)))
+                return (npos);
+            const const_iterator result = std::search(this->begin() + index, this->end(), str.begin(), str.end());
+            if ((result == this->end()) && !str.empty())
+                return (npos);
+            return (static_cast<size_type>(result - this->begin()));
+        }
+
+        void swap(generic_gap_ustring& other)
+        {
+            if (std::allocator_traits<allocator_type>::propagate_on_container_swap::value ||
+                (this->get_allocator() == other.get_allocator())) {
+                _impl.swap(other._impl);
+            }
+            else {
+                // The buffers cannot be exchanged (std::vector::swap is undefined for them): each text keeps its
+                // allocator and gets a copy of the other buffer (with its gap).
+                impl_type other_buffer{other._impl, this->get_allocator()};
+                other._impl.assign(_impl.cbegin(), _impl.cend());
+                _impl.swap(other_buffer);
+            }
+            std::swap(_gap_start, other._gap_start);
+            std::swap(_gap_end, other._gap_end);
+            return;
+        }
+
+        friend bool operator==(const generic_gap_ustring& left, ustring_view right)
+        { return ((left.size() == right.size()) && std::equal(right.begin(), right.end(), left.begin())); }
+
+        friend bool operator==(ustring_view left, const generic_gap_ustring& right)
+        { return (right == left); }
+
+        friend bool operator!=(const generic_gap_ustring& left, ustring_view right)
+        { return (!(left == right)); }
+
+        friend bool operator!=(ustring_view left, const generic_gap_ustring& right)
+        { return (!(right == left)); }
+
+    private:
+        // The buffer, of which [_gap_start, _gap_end) is the gap.
+        impl_type _impl;
+        size_type _gap_start;
+        size_type _gap_end;
+
+        static const size_type _s_minimum_gap = 64;
+
+        void check_access(size_type index) const
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index >= this->size())
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+            (void) index;
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            return;
+        }
+
+        size_type check_index(size_type index) const
+        {
+            if (index > this->size()) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                return (this->size());
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            return (index);
+        }
+
+        // Checks whether the text points into the buffer (e.g. a view() of this text).
+        bool is_aliased(ustring_view text) const noexcept
+        {
+            const std::less<const char_type*> less{};
+            const char_type* const first = _impl.data();
+            return (!text.empty() && !less(text.data(), first) && less(text.data(), first + _impl.size()));
+        }
+
+        // Note: The size is not known up front, so the code points are read into a temporary first.
+        template<typename inputIterT>
+        void insert_range(size_type index, inputIterT first, inputIterT last, std::input_iterator_tag)
+        {
+            const impl_type text(first, last, _impl.get_allocator());
+            this->prepare_insert(index, text.size());
+            std::copy(text.begin(), text.end(), _impl.begin() + _gap_start);
+            _gap_start += text.size();
+            return;
+        }
+
+        // The code points are copied straight into the gap.
+        template<typename forwardIterT>
+        void insert_range(size_type index, forwardIterT first, forwardIterT last, std::forward_iterator_tag)
+        {
+            const size_type count = static_cast<size_type>(std::distance(first, last));
+            this->prepare_insert(index, count);
+            std::copy(first, last, _impl.begin() + _gap_start);
+            _gap_start += count;
+            return;
+        }
+
+        // Moves the gap so that it starts at index, moving only the code points between the old and new positions.
+        void move_gap(size_type index)
+        {
+            if (index < _gap_start) {
+                const size_type distance = _gap_start - index;
+                std::copy_backward(_impl.begin() + index, _impl.begin() + _gap_start, _impl.begin() + _gap_end);
+                _gap_start = index;
+                _gap_end -= distance;
+            }
+            else if (index > _gap_start) {
+                const size_type distance = index - _gap_start;
+                std::copy(_impl.begin() + _gap_end, _impl.begin() + _gap_end + distance, _impl.begin() + _gap_start);
+                _gap_start = index;
+                _gap_end += distance;
+            }
+            return;
+        }
+
+        // Moves the gap to index and makes sure that it can hold count code points.
+        void prepare_insert(size_type index, size_type count)
+        {
+            this->move_gap(index);
+            if ((_gap_end - _gap_start) < count)
+                this->grow(count);
+            return;
+        }
+
+        // Reallocates the buffer (at least doubling it) so that the gap can hold count code points.
+        void grow(size_type count)
+        {
+            const size_type size = this->size();
+            const size_type new_capacity = std::max(_impl.size() * 2, size + count + _s_minimum_gap);
+            impl_type new_impl(new_capacity, char_type::null_char(), _impl.get_allocator());
+            const size_type suffix_size = _impl.size() - _gap_end;
+            std::copy(_impl.begin(), _impl.begin() + _gap_start, new_impl.begin());
+            std::copy(_impl.begin() + _gap_end, _impl.end(), new_impl.end() - suffix_size);
+            _impl.swap(new_impl);
+            _gap_end = new_capacity - suffix_size;
+            return;
+        }
+    }; // class generic_gap_ustring
+
+    template<typename allocatorT>
+    constexpr typename generic_gap_ustring<allocatorT>::size_type generic_gap_ustring<allocatorT>::npos;
+
+    typedef generic_gap_ustring<std::allocator<uchar_t_traits::char_type>> gap_ustring;
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_GAP_USTRING_HPP)
@@ -0,0 +1,366 @@
+#if !defined(UNISTRINGXX_HASH_HPP)
+#define UNISTRINGXX_HASH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif // defined(_MSC_VER) && defined(_M_X64)
+
+#include "common.hpp"
+#include "uchar.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // The hash function follows wyhash (final version 4 by Wang Yi, public domain): 64-bit multiply-mix over 8-byte
+        // unaligned loads, 48 bytes per iteration for long inputs.
+        const std::uint64_t _s_hash_secret[4] = {
+            0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL, 0x4B33A62ED433D4A3ULL, 0x4D5A2DA51DE1AA47ULL
+        };
+
+        // 64x64 -> 128-bit multiplication. left receives the low half and right the high half.
+        inline void hash_multiply(std::uint64_t& left, std::uint64_t& right)
+        {
+#if defined(__SIZEOF_INT128__)
+            __extension__ typedef unsigned __int128 uint128_type;
+            const uint128_type product = static_cast<uint128_type>(left) * right;
+            left = static_cast<std::uint64_t>(product);
+            right = static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            left = _umul128(left, right, &right);
+#else
+            const std::uint64_t left_high = left >> 32;
+            const std::uint64_t left_low = left & 0xFFFFFFFFULL;
+            const std::uint64_t right_high = right >> 32;
+            const std::uint64_t right_low = right & 0xFFFFFFFFULL;
+            const std::uint64_t high_high = left_high * right_high;
+            const std::uint64_t high_low = left_high * right_low;
+            const std::uint64_t low_high = left_low * right_high;
+            const std::uint64_t low_low = left_low * right_low;
+            const std::uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFFULL) + (low_high & 0xFFFFFFFFULL);
+            left = (low_low & 0xFFFFFFFFULL) | (middle << 32);
+            right = high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+#endif
+            return;
+        }
+
+        inline std::uint64_t hash_mix(std::uint64_t left, std::uint64_t right)
+        {
+            hash_multiply(left, right);
+            return (left ^ right);
+        }
+
+        // Unaligned loads in native byte order. Hash values are only meant to be compared within the same platform.
+        inline std::uint64_t hash_read64(const std::uint8_t* ptr)
+        {
+            std::uint64_t result = 0;
+            std::memcpy(&result, ptr, sizeof (result));
+            return (result);
+        }
+
+        inline std::uint64_t hash_read32(const std::uint8_t* ptr)
+        {
+            std::uint32_t result = 0;
+            std::memcpy(&result, ptr, sizeof (result));
+            return (result);
+        }
+
+        inline std::uint64_t hash_read_small(const std::uint8_t* ptr, std::size_t size)
+        {
+            return (
+                (static_cast<std::uint64_t>(ptr[0]) << 16) | (static_cast<std::uint64_t>(ptr[size >> 1]) << 8) |
+                ptr[size - 1]
+            );
+        }
+
+        inline std::uint64_t hash_bytes(const void* data, std::size_t size, std::uint64_t seed)
+        {
+            const std::uint8_t* ptr = static_cast<const std::uint8_t*>(data);
+            seed ^= hash_mix(seed ^ _s_hash_secret[0], _s_hash_secret[1]);
+
+            std::uint64_t first = 0;
+            std::uint64_t second = 0;
+            if (size <= 16) {
+                if (size >= 4) {
+                    const std::size_t offset = (size >> 3) << 2;
+                    first = (hash_read32(ptr) << 32) | hash_read32(ptr + offset);
+                    second = (hash_read32(ptr + size - 4) << 32) | hash_read32(ptr + size - 4 - offset);
+                }
+                else if (size > 0) {
+                    first = hash_read_small(ptr, size);
+                }
+            }
+            else {
+                std::size_t remaining = size;
+                if (remaining > 48) {
+                    std::uint64_t seed1 = seed;
+                    std::uint64_t seed2 = seed;
+                    do {
+                        seed = hash_mix(hash_read64(ptr) ^ _s_hash_secret[1], hash_read64(ptr + 8) ^ seed);
+                        seed1 = hash_mix(hash_read64(ptr + 16) ^ _s_hash_secret[2], hash_read64(ptr + 24) ^ seed1);
+                        seed2 = hash_mix(hash_read64(ptr + 32) ^ _s_hash_secret[3], hash_read64(ptr + 40) ^ seed2);
+                        ptr += 48;
+                        remaining -= 48;
+                    } while (remaining > 48);
+                    seed ^= seed1 ^ seed2;
+                }
+                while (remaining > 16) {
+                    seed = hash_mix(hash_read64(ptr) ^ _s_hash_secret[1], hash_read64(ptr + 8) ^ seed);
+                    ptr += 16;
+                    remaining -= 16;
+                }
+                first = hash_read64(ptr + remaining - 16);
+                second = hash_read64(ptr + remaining - 8);
+            }
+
+            first ^= _s_hash_secret[1];
+            second ^= seed;
+            hash_multiply(first, second);
+            return (hash_mix(first ^ _s_hash_secret[0] ^ size, second ^ _s_hash_secret[1]));
+        }
+
+        // Computes hash_bytes() over data given in pieces of any size, the total size being known in advance. The
+        // blocks are mixed as they fill up, and the last 16 bytes are kept for the final mix.
+        class hash_bytes_stream
+        {
+        public:
+            hash_bytes_stream(std::size_t size, std::uint64_t seed) noexcept :
+                _size{size}, _offset{0}, _processed{0}, _buffered{0},
+                _block_count{(size > 48) ? ((size - 1) / 48) : 0}, _block_index{0}, _initial_seed{seed},
+                _seed{seed ^ hash_mix(seed ^ _s_hash_secret[0], _s_hash_secret[1])}, _seed1{_seed}, _seed2{_seed},
+                _buffer{}, _tail{}
+            { return; }
+
+            void update(const std::uint8_t* data, std::size_t size) noexcept
+            {
+                // The last 16 bytes (or the whole input if it is not longer).
+                const std::size_t tail_start = (_size > 16) ? (_size - 16) : 0;
+                if ((_offset + size) > tail_start) {
+                    const std::size_t skipped = (_offset < tail_start) ? (tail_start - _offset) : 0;
+                    std::memcpy(_tail + (_offset + skipped - tail_start), data + skipped, size - skipped);
+                }
+                _offset += size;
+                if (_size <= 16)
+                    return;
+
+                while (size > 0) {
+                    const std::size_t block_size = (_block_index < _block_count) ? 48 : 16;
+                    const std::size_t count = std::min(block_size - _buffered, size);
+                    std::memcpy(_buffer + _buffered, data, count);
+                    _buffered += count;
+                    data += count;
+                    size -= count;
+                    // Like hash_bytes(), a block is only mixed if more bytes follow it.
+                    if ((_buffered < block_size) || ((_processed + block_size) >= _size))
+                        continue;
+                    _seed = hash_mix(hash_read64(_buffer) ^ _s_hash_secret[1], hash_read64(_buffer + 8) ^ _seed);
+                    if (block_size == 48) {
+                        _seed1 = hash_mix(
+                            hash_read64(_buffer + 16) ^ _s_hash_secret[2], hash_read64(_buffer + 24) ^ _seed1
+                        );
+                        _seed2 = hash_mix(
+                            hash_read64(_buffer + 32) ^ _s_hash_secret[3], hash_read64(_buffer + 40) ^ _seed2
+                        );
+                        if (++_block_index == _block_count)
+                            _seed ^= _seed1 ^ _seed2;
+                    }
+                    _processed += block_size;
+                    _buffered = 0;
+                }
+                return;
+            }
+
+            // Gets the hash value, once the whole input has been given.
+            std::uint64_t digest(void) const noexcept
+            {
+                if (_size <= 16)
+                    return (hash_bytes(_tail, _size, _initial_seed));
+                std::uint64_t first = hash_read64(_tail) ^ _s_hash_secret[1];
+                std::uint64_t second = hash_read64(_tail + 8) ^ _seed;
+                hash_multiply(first, second);
+                return (hash_mix(first ^ _s_hash_secret[0] ^ _size, second ^ _s_hash_secret[1]));
+            }
+
+        private:
+            std::size_t _size;
+            std::size_t _offset;
+            std::size_t _processed;
+            std::size_t _buffered;
+            std::size_t _block_count;
+            std::size_t _block_index;
+            std::uint64_t _initial_seed;
+            std::uint64_t _seed;
+            std::uint64_t _seed1;
+            std::uint64_t _seed2;
+            std::uint8_t _buffer[48];
+            std::uint8_t _tail[16];
+        }; // class hash_bytes_stream
+
+        // The number of code points that hash_code_points() decodes at a time from an iterator range.
+        const std::size_t _s_hash_chunk_size = 64;
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Hashes a sequence of code points. The code point storage is hashed directly (no transcoding), so every
+    /// container of contiguous code points (generic_ustring, generic_ustring_view, std::vector<uchar_t>) with the
+    /// same content has the same hash value.
+    /// @param data The code points to hash.
+    /// @param count The number of code points.
+    /// @param seed A value that selects a different hash function (e.g. a per-process random seed to defend against
+    ///     collision attacks).
+    ///
+    inline std::uint64_t hash_code_points(const uchar_t* data, std::size_t count, std::uint64_t seed = 0)
+    { return (hash_bytes(data, count * sizeof (uchar_t), seed)); }
+
+    ///
+    /// Hashes the code points of an iterator range (e.g. of a rope or of the UTF ranges of utf_ranges.hpp), with the
+    /// same value as hash_code_points() over the same code points in contiguous storage. The range is traversed twice:
+    /// once to count the code points, then to hash them.
+    ///
+    template<typename forwardIteratorT>
+    inline std::uint64_t hash_code_points(forwardIteratorT first, forwardIteratorT last, std::uint64_t seed = 0)
+    {
+        const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+        hash_bytes_stream stream{count * sizeof (uchar_t), seed};
+        uchar_t buffer[_s_hash_chunk_size];
+        std::size_t buffered = 0;
+        for (; first != last; ++first) {
+            buffer[buffered++] = *first;
+            if (buffered == _s_hash_chunk_size) {
+                stream.update(reinterpret_cast<const std::uint8_t*>(buffer), sizeof (buffer));
+                buffered = 0;
+            }
+        }
+        stream.update(reinterpret_cast<const std::uint8_t*>(buffer), buffered * sizeof (uchar_t));
+        return (stream.digest());
+    }
+
+    ///
+    /// Computes a hash value from several values, e.g. the fields of a composite key. Each update is hashed on its
+    /// own and chained to the previous state, so the result depends on the values and on how they are split between
+    /// updates (e.g. ("ab", "c") and ("a", "bc") hash differently).
+    ///
+    class hasher
+    {
+    public:
+        explicit hasher(std::uint64_t seed = 0) noexcept :
+            _state{seed}
+        { return; }
+
+        ///
+        /// Hashes a sequence of code points.
+        ///
+        hasher& update(const uchar_t* data, std::size_t count) noexcept
+        {
+            _state = hash_code_points(data, count, _state);
+            return (*this);
+        }
+
+        ///
+        /// Hashes the code points of an iterator range, like the same code points in contiguous storage.
+        ///
+        template<typename forwardIteratorT>
+        hasher& update(forwardIteratorT first, forwardIteratorT last)
+        {
+            _state = hash_code_points(first, last, _state);
+            return (*this);
+        }
+
+        ///
+        /// Hashes a text: any object with data() and size() members over contiguous code points (e.g.
+        /// generic_ustring, generic_ustring_view).
+        ///
+        template<typename textT>
+        auto update(const textT& text) noexcept -> decltype(
+            static_cast<const uchar_t*>(text.data()), static_cast<std::size_t>(text.size()), std::declval<hasher&>()
+        )
+        { return (this->update(static_cast<const uchar_t*>(text.data()), static_cast<std::size_t>(text.size()))); }
+
+        ///
+        /// Hashes an integer or enumeration value (as its object representation).
+        ///
+        template<typename valueT>
+        typename std::enable_if<std::is_integral<valueT>::value || std::is_enum<valueT>::value, hasher&>::type
+        update(valueT value) noexcept
+        {
+            _state = hash_bytes(&value, sizeof (value), _state);
+            return (*this);
+        }
+
+        ///
+        /// Hashes a floating point value. Values that compare equal hash equally (-0.0 and 0.0 in particular), and
+        /// only the bits of the value are hashed (not the padding of e.g. the x87 long double). A float, a double and
+        /// a long double with the same value hash equally.
+        ///
+        template<typename valueT>
+        typename std::enable_if<std::is_floating_point<valueT>::value, hasher&>::type
+        update(valueT value) noexcept
+        {
+            if (value == valueT{0})
+                value = valueT{0};
+            const bool is_double = (std::numeric_limits<valueT>::digits <= std::numeric_limits<double>::digits) ||
+                !std::isfinite(value) || (
+                    (std::fabs(value) <= std::numeric_limits<double>::max()) &&
+                    (static_cast<valueT>(static_cast<double>(value)) == value)
+                );
+            if (is_double) {
+                // The conversion is exact (NaN payloads are dropped: NaN never compares equal anyway).
+                const double actual_value = std::isnan(value) ?
+                    std::numeric_limits<double>::quiet_NaN() : static_cast<double>(value);
+                std::uint64_t bits = 0;
+                static_assert(sizeof (bits) == sizeof (actual_value), "double is expected to be 64 bits.");
+                std::memcpy(&bits, &actual_value, sizeof (bits));
+                _state = hash_bytes(&bits, sizeof (bits), _state);
+                return (*this);
+            }
+
+            // Other values of wider types are hashed as their sign, exponent and mantissa (in 32-bit chunks).
+            std::uint64_t words[2 + ((std::numeric_limits<valueT>::digits + 31) / 32)] = {};
+            int exponent = 0;
+            valueT mantissa = std::frexp(std::fabs(value), &exponent);
+            words[0] = std::signbit(value) ? 1 : 0;
+            words[1] = static_cast<std::uint64_t>(static_cast<std::int64_t>(exponent));
+            for (std::size_t index = 2; (index < (sizeof (words) / sizeof (words[0]))) && (mantissa != 0); index++) {
+                mantissa = std::ldexp(mantissa, 32);
+                const valueT chunk = std::floor(mantissa);
+                words[index] = static_cast<std::uint64_t>(chunk);
+                mantissa -= chunk;
+            }
+            _state = hash_bytes(words, sizeof (words), _state);
+            return (*this);
+        }
+
+        ///
+        /// Hashes raw bytes.
+        ///
+        hasher& update_bytes(const void* data, std::size_t size) noexcept
+        {
+            _state = hash_bytes(data, size, _state);
+            return (*this);
+        }
+
+        ///
+        /// Gets the hash value of everything hashed so far. The hasher may still be updated afterwards.
+        ///
+        std::uint64_t digest(void) const noexcept
+        { return (_state); }
+
+    private:
+        std::uint64_t _state;
+    }; // class hasher
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_HASH_HPP)
@@ -0,0 +1,380 @@
+#if !defined(UNISTRINGXX_INTERN_HPP)
+#define UNISTRINGXX_INTERN_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // defined(_MSC_VER)
+
+#include "common.hpp"
+#include "hash.hpp"
+#include "uchar.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        inline unsigned int floor_log2(std::uint32_t value)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return (31u - static_cast<unsigned int>(__builtin_clz(value)));
+#elif defined(_MSC_VER)
+            unsigned long result = 0;
+            _BitScanReverse(&result, value);
+            return (static_cast<unsigned int>(result));
+#else
+            unsigned int result = 0;
+            while ((value >>= 1) != 0)
+                result++;
+            return (result);
+#endif
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// A small integer that identifies a text interned in an intern_pool. Handles of the same pool are equal if and
+    /// only if their texts are equal. They are numbered from 0 in the order the texts were first interned.
+    ///
+    class intern_handle
+    {
+    public:
+        static const std::uint32_t invalid_value = 0xFFFFFFFF;
+
+        ///
+        /// Creates an invalid handle (that does not identify any text).
+        ///
+        intern_handle(void) noexcept :
+            _value{invalid_value}
+        { return; }
+
+        explicit intern_handle(std::uint32_t value) noexcept :
+            _value{value}
+        { return; }
+
+        std::uint32_t value(void) const noexcept
+        { return (_value); }
+
+        bool is_valid(void) const noexcept
+        { return (_value != invalid_value); }
+
+        friend bool operator==(intern_handle left, intern_handle right) noexcept
+        { return (left._value == right._value); }
+
+        friend bool operator!=(intern_handle left, intern_handle right) noexcept
+        { return (left._value != right._value); }
+
+        // Note: This orders the handles by interning order, not their texts.
+        friend bool operator<(intern_handle left, intern_handle right) noexcept
+        { return (left._value < right._value); }
+
+    private:
+        std::uint32_t _value;
+    }; // class intern_handle
+
+    ///
+    /// A pool of unique, immutable texts (an atom table). Each distinct text is stored once and identified by an
+    /// intern_handle, so repeated texts (e.g. field names, tags) cost a handle instead of a string, and comparing them
+    /// is an integer comparison. The stored texts never move and are only freed with the pool: the views returned by
+    /// text() stay valid for the lifetime of the pool, and views of the same text share the same data.
+    ///
+    /// The pool is thread safe. Lookups (find(), text(), and intern() of a text already in the pool) do not lock;
+    /// adding a text locks a mutex.
+    ///
+    class intern_pool
+    {
+    public:
+        intern_pool(void) :
+            _table{nullptr},
+            _count{0},
+            _text_block{nullptr},
+            _text_block_space{0}
+        {
+            for (std::atomic<entry*>& chunk : _chunks)
+                chunk.store(nullptr, std::memory_order_relaxed);
+            std::unique_ptr<slot_table> table{new slot_table{_s_initial_capacity}};
+            _table.store(table.get(), std::memory_order_release);
+            _tables.push_back(std::move(table));
+            return;
+        }
+
+        intern_pool(const intern_pool&) = delete;
+        intern_pool& operator=(const intern_pool&) = delete;
+
+        ~intern_pool(void)
+        {
+            for (std::atomic<entry*>& chunk : _chunks)
+                delete[] chunk.load(std::memory_order_relaxed);
+            return;
+        }
+
+        ///
+        /// Gets the handle of a text, adding the text to the pool if it is not in it yet.
+        ///
+        intern_handle intern(ustring_view text)
+        {
+            const std::uint64_t hash = hash_code_points(text.data(), text.size());
+            const intern_handle result = this->find_internal(text, hash);
+            if (result.is_valid())
+                return (result);
+            std::lock_guard<std::mutex> lock{_mutex};
+            return (this->insert_internal(text, hash));
+        }
+
+        ///
+        /// Interns a sequence of texts, writing their handles to result. The texts are hashed and looked up without
+        /// locking, then the new texts are added under a single lock.
+        /// @param first, last The texts to intern. The elements must be convertible to ustring_view (e.g. ustring).
+        /// @param result The beginning of the destination range for the handles.
+        /// @return The end of the destination range.
+        ///
+        template<typename inputIterT, typename outputIterT>
+        outputIterT intern(inputIterT first, inputIterT last, outputIterT result)
+        {
+            std::vector<lookup> lookups;
+            bool has_missing = false;
+            for (; first != last; ++first) {
+                const ustring_view text{*first};
+                const std::uint64_t hash = hash_code_points(text.data(), text.size());
+                const intern_handle handle = this->find_internal(text, hash);
+                has_missing = (has_missing || !handle.is_valid());
+                lookups.push_back(lookup{text, hash, handle});
+            }
+            if (has_missing) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                for (lookup& item : lookups) {
+                    if (!item.handle.is_valid())
+                        item.handle = this->insert_internal(item.text, item.hash);
+                }
+            }
+            for (const lookup& item : lookups) {
+                *result = item.handle;
+                ++result;
+            }
+            return (result);
+        }
+
+        ///
+        /// Gets the handle of a text without adding it to the pool.
+        /// @return The handle, or an invalid handle if the text is not in the pool.
+        ///
+        intern_handle find(ustring_view text) const noexcept
+        { return (this->find_internal(text, hash_code_points(text.data(), text.size()))); }
+
+        ///
+        /// Gets the text of a handle. The view stays valid for the lifetime of the pool, and its data() is the same
+        /// for every view of the same handle.
+        /// @param handle A valid handle from this pool.
+        ///
+        ustring_view text(intern_handle handle) const noexcept
+        {
+            const entry& item = this->entry_at(handle.value());
+            return (ustring_view{item.data, item.size});
+        }
+
+        ///
+        /// Gets the number of distinct texts in the pool.
+        ///
+        std::size_t size(void) const noexcept
+        { return (_count.load(std::memory_order_acquire)); }
+
+    private:
+        // Entries are stored in chunks of 64, 128, 256... entries that never move, so that readers can access them
+        // while the writer adds entries.
+        static const std::uint32_t _s_first_chunk_size = 64;
+        static const std::size_t _s_chunk_count = 26;
+        static const std::size_t _s_initial_capacity = 256;
+        static const std::size_t _s_text_block_size = 16384;
+
+        struct entry
+        {
+            const uchar_t* data;
+            std::size_t size;
+            std::uint64_t hash;
+        };
+
+        // An open addressing hash table (linear probing, at most half full). Each slot holds the high half of the hash
+        // (to skip most mismatches without reading the entry) and the handle + 1 (0 for an empty slot), so that a slot
+        // is published with a single atomic store.
+        struct slot_table
+        {
+            explicit slot_table(std::size_t capacity) :
+                mask{capacity - 1},
+                slots{new std::atomic<std::uint64_t>[capacity]}
+            {
+                for (std::size_t ctr = 0; ctr < capacity; ctr++)
+                    slots[ctr].store(0, std::memory_order_relaxed);
+                return;
+            }
+
+            std::size_t mask;
+            std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+        };
+
+        struct lookup
+        {
+            ustring_view text;
+            std::uint64_t hash;
+            intern_handle handle;
+        };
+
+        std::atomic<slot_table*> _table;
+        std::atomic<std::size_t> _count;
+        std::atomic<entry*> _chunks[_s_chunk_count];
+
+        // Only accessed with the mutex locked.
+        std::mutex _mutex;
+        // Tables replaced by a larger one are kept until the pool is destroyed, because readers may still use them.
+        std::vector<std::unique_ptr<slot_table>> _tables;
+        std::vector<std::unique_ptr<uchar_t[]>> _text_blocks;
+        uchar_t* _text_block;
+        std::size_t _text_block_space;
+
+        static std::uint64_t make_slot(std::uint64_t hash, std::uint32_t value) noexcept
+        { return ((hash & 0xFFFFFFFF00000000ULL) | (static_cast<std::uint64_t>(value) + 1)); }
+
+        const entry& entry_at(std::uint32_t value) const noexcept
+        {
+            const unsigned int chunk = floor_log2((value / _s_first_chunk_size) + 1);
+            const std::uint32_t offset = value - (_s_first_chunk_size * ((std::uint32_t{1} << chunk) - 1));
+            return (_chunks[chunk].load(std::memory_order_acquire)[offset]);
+        }
+
+        intern_handle find_internal(ustring_view text, std::uint64_t hash) const noexcept
+        {
+            const slot_table* table = _table.load(std::memory_order_acquire);
+            std::size_t index = static_cast<std::size_t>(hash) & table->mask;
+            for (;;) {
+                const std::uint64_t slot = table->slots[index].load(std::memory_order_acquire);
+                if (slot == 0)
+                    return (intern_handle{});
+                if ((slot >> 32) == (hash >> 32)) {
+                    const std::uint32_t value = static_cast<std::uint32_t>(slot) - 1;
+                    const entry& item = this->entry_at(value);
+                    if ((item.size == text.size()) && code_points_equal(item.data, text.data(), text.size()))
+                        return (intern_handle{value});
+                }
+                index = (index + 1) & table->mask;
+            }
+        }
+
+        // Requires the mutex to be locked.
+        intern_handle insert_internal(ustring_view text, std::uint64_t hash)
+        {
+            // Another thread (or an earlier text of the same batch) may have added the text since the lookup.
+            const intern_handle existing = this->find_internal(text, hash);
+            if (existing.is_valid())
+                return (existing);
+
+            const std::size_t count = _count.load(std::memory_order_relaxed);
+            const std::size_t max_count = (_s_first_chunk_size * ((std::size_t{1} << _s_chunk_count) - 1));
+            if (count >= max_count) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::length_error, "The intern pool is full.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                return (intern_handle{});
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            const std::uint32_t value = static_cast<std::uint32_t>(count);
+
+            // Publish the entry before the slot that refers to it.
+            const unsigned int chunk = floor_log2((value / _s_first_chunk_size) + 1);
+            const std::uint32_t offset = value - (_s_first_chunk_size * ((std::uint32_t{1} << chunk) - 1));
+            if (offset == 0)
+                _chunks[chunk].store(new entry[_s_first_chunk_size << chunk], std::memory_order_release);
+            entry& item = _chunks[chunk].load(std::memory_order_relaxed)[offset];
+            item.data = this->store_text(text);
+            item.size = text.size();
+            item.hash = hash;
+            _count.store(count + 1, std::memory_order_release);
+
+            slot_table& table = *_table.load(std::memory_order_relaxed);
+            if (((count + 1) * 2) > (table.mask + 1))
+                this->grow_table();
+            else
+                this->insert_slot(table, hash, value);
+            return (intern_handle{value});
+        }
+
+        // Requires the mutex to be locked.
+        static void insert_slot(slot_table& table, std::uint64_t hash, std::uint32_t value)
+        {
+            std::size_t index = static_cast<std::size_t>(hash) & table.mask;
+            while (table.slots[index].load(std::memory_order_relaxed) != 0)
+                index = (index + 1) & table.mask;
+            table.slots[index].store(make_slot(hash, value), std::memory_order_release);
+            return;
+        }
+
+        // Requires the mutex to be locked. Builds a table twice as large with every entry (including the one just
+        // added) and publishes it.
+        void grow_table(void)
+        {
+            const slot_table& old_table = *_table.load(std::memory_order_relaxed);
+            std::unique_ptr<slot_table> table{new slot_table{(old_table.mask + 1) * 2}};
+            const std::size_t count = _count.load(std::memory_order_relaxed);
+            for (std::size_t ctr = 0; ctr < count; ctr++) {
+                const std::uint32_t value = static_cast<std::uint32_t>(ctr);
+                this->insert_slot(*table, this->entry_at(value).hash, value);
+            }
+            _table.store(table.get(), std::memory_order_release);
+            _tables.push_back(std::move(table));
+            return;
+        }
+
+        // Requires the mutex to be locked. Copies a text (with a null terminator) to the text blocks.
+        const uchar_t* store_text(ustring_view text)
+        {
+            const std::size_t size = text.size() + 1;
+            uchar_t* result = nullptr;
+            if (size > (_s_text_block_size / 4)) {
+                // Large texts get their own block.
+                _text_blocks.push_back(std::unique_ptr<uchar_t[]>{new uchar_t[size]});
+                result = _text_blocks.back().get();
+            }
+            else {
+                if (size > _text_block_space) {
+                    _text_blocks.push_back(std::unique_ptr<uchar_t[]>{new uchar_t[_s_text_block_size]});
+                    _text_block = _text_blocks.back().get();
+                    _text_block_space = _s_text_block_size;
+                }
+                result = _text_block;
+                _text_block += size;
+                _text_block_space -= size;
+            }
+            std::copy(text.begin(), text.end(), result);
+            result[text.size()] = uchar_t::null_char();
+            return (result);
+        }
+    }; // class intern_pool
+
+} // namespace unistringxx
+
+namespace std
+{
+    // specialization of std::hash
+    template<>
+    struct hash<unistringxx::intern_handle>
+    {
+        typedef std::size_t result_type;
+        typedef unistringxx::intern_handle argument_type;
+
+        result_type operator()(argument_type key) const noexcept
+        { return (std::hash<std::uint32_t>{}(key.value())); }
+    };
+} // namespace std
+
+#endif // !defined(UNISTRINGXX_INTERN_HPP)
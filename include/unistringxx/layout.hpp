@@ -0,0 +1,765 @@
+#if !defined(UNISTRINGXX_LAYOUT_HPP)
+#define UNISTRINGXX_LAYOUT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "uproperties.hpp"
+#include "ustring.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // Resolves the classes that UAX #14 rule LB1 leaves to the implementation (AI, SG, XX -> AL, SA -> CM or AL,
+        // CJ -> NS).
+        inline line_break_class resolve_line_break_class(uchar_t ch)
+        {
+            typedef line_break_class lb;
+            const line_break_class cls = get_line_break_class(ch);
+            switch (cls) {
+                case lb::ambiguous:
+                case lb::surrogate:
+                case lb::unknown:
+                    return (lb::alphabetic);
+                case lb::complex_context: {
+                    const general_category gc = get_general_category(ch);
+                    const bool is_mark = (gc == general_category::nonspacing_mark) ||
+                        (gc == general_category::spacing_mark);
+                    return (is_mark ? lb::combining_mark : lb::alphabetic);
+                }
+                case lb::conditional_japanese_starter:
+                    return (lb::nonstarter);
+                default:
+                    return (cls);
+            }
+        }
+
+        inline bool is_line_terminator(line_break_class cls)
+        {
+            typedef line_break_class lb;
+            return ((cls == lb::mandatory_break) || (cls == lb::carriage_return) ||
+                (cls == lb::line_feed) || (cls == lb::next_line));
+        }
+
+        inline bool is_alphabetic_class(line_break_class cls)
+        { return ((cls == line_break_class::alphabetic) || (cls == line_break_class::hebrew_letter)); }
+
+        inline bool is_hangul_class(line_break_class cls)
+        {
+            typedef line_break_class lb;
+            return ((cls == lb::jl) || (cls == lb::jv) || (cls == lb::jt) || (cls == lb::h2) || (cls == lb::h3));
+        }
+
+        inline bool is_east_asian_fwh(uchar_t ch)
+        {
+            const east_asian_width eaw = get_east_asian_width(ch);
+            return ((eaw == east_asian_width::fullwidth) || (eaw == east_asian_width::wide) ||
+                (eaw == east_asian_width::halfwidth));
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Iterates over the extended grapheme cluster boundaries of a text as defined by UAX #29 (i.e. the boundaries of
+    /// user-perceived characters such as a base character with its combining marks, a Hangul syllable, an emoji ZWJ
+    /// sequence or a flag). The boundaries are reported in increasing order as the position (in code points) where a
+    /// cluster ends; the last boundary is the end of the text.
+    ///
+    class grapheme_breaker
+    {
+    public:
+        typedef ustring_view::size_type size_type;
+
+        explicit grapheme_breaker(ustring_view text) :
+            _text{text}, _index{0}, _position{0},
+            _prev{grapheme_cluster_break::other}, _ri_count{0}, _in_pictographic{false}, _after_pictographic_zwj{false}
+        { return; }
+
+        // The breaker keeps a view of the text, so it cannot be given a temporary string.
+        template<typename allocatorT>
+        explicit grapheme_breaker(generic_ustring<allocatorT>&&) = delete;
+
+        ///
+        /// Advances to the next grapheme cluster boundary.
+        /// @returns false if there are no more boundaries.
+        ///
+        bool next(void)
+        {
+            if (_index == 0) {
+                if (_text.empty())
+                    return (false);
+                this->advance(get_grapheme_cluster_break(_text[0]));
+                _index = 1;
+            }
+
+            while (_index < _text.size()) {
+                const grapheme_cluster_break gcb = get_grapheme_cluster_break(_text[_index]);
+                const bool is_boundary = this->is_boundary(gcb);
+                this->advance(gcb);
+                _index++;
+                if (is_boundary) {
+                    _position = _index - 1;
+                    return (true);
+                }
+            }
+
+            if (_index == _text.size()) {
+                // GB2: Break at the end of text.
+                _position = _index++;
+                return (true);
+            }
+            return (false);
+        }
+
+        ///
+        /// The position of the current boundary (i.e. the index of the first code point of the next cluster).
+        ///
+        size_type position(void) const noexcept
+        { return (_position); }
+
+    private:
+        ustring_view _text;
+        size_type _index;
+        size_type _position;
+
+        grapheme_cluster_break _prev;
+        // Number of consecutive regional indicators ending at the previous code point.
+        size_type _ri_count;
+        // Whether the previous code points match ExtPict Extend*.
+        bool _in_pictographic;
+        // Whether the previous code points match ExtPict Extend* ZWJ.
+        bool _after_pictographic_zwj;
+
+        void advance(grapheme_cluster_break gcb)
+        {
+            typedef grapheme_cluster_break gb;
+            _after_pictographic_zwj = _in_pictographic && (gcb == gb::zwj);
+            _in_pictographic = (gcb == gb::extended_pictographic) || (_in_pictographic && (gcb == gb::extend));
+            _ri_count = (gcb == gb::regional_indicator) ? (_ri_count + 1) : 0;
+            _prev = gcb;
+            return;
+        }
+
+        bool is_boundary(grapheme_cluster_break cur) const
+        {
+            typedef grapheme_cluster_break gb;
+            const grapheme_cluster_break prev = _prev;
+
+            // GB3: Do not break between a CR and LF.
+            if ((prev == gb::carriage_return) && (cur == gb::line_feed))
+                return (false);
+            // GB4, GB5: Otherwise, break before and after controls.
+            if ((prev == gb::control) || (prev == gb::carriage_return) || (prev == gb::line_feed))
+                return (true);
+            if ((cur == gb::control) || (cur == gb::carriage_return) || (cur == gb::line_feed))
+                return (true);
+            // GB6, GB7, GB8: Do not break Hangul syllable sequences.
+            if ((prev == gb::l) && ((cur == gb::l) || (cur == gb::v) || (cur == gb::lv) || (cur == gb::lvt)))
+                return (false);
+            if (((prev == gb::lv) || (prev == gb::v)) && ((cur == gb::v) || (cur == gb::t)))
+                return (false);
+            if (((prev == gb::lvt) || (prev == gb::t)) && (cur == gb::t))
+                return (false);
+            // GB9, GB9a, GB9b: Do not break before extending characters, ZWJ or spacing marks, or after prepend
+            // characters.
+            if ((cur == gb::extend) || (cur == gb::zwj) || (cur == gb::spacing_mark) || (prev == gb::prepend))
+                return (false);
+            // GB11: Do not break within emoji ZWJ sequences.
+            if (_after_pictographic_zwj && (cur == gb::extended_pictographic))
+                return (false);
+            // GB12, GB13: Do not break within emoji flag sequences.
+            if ((prev == gb::regional_indicator) && (cur == gb::regional_indicator) && ((_ri_count % 2) == 1))
+                return (false);
+            // GB999: Otherwise, break everywhere.
+            return (true);
+        }
+    }; // class grapheme_breaker
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        inline bool is_printable_ascii(uchar_t ch)
+        { return ((ch.code_point() >= 0x20) && (ch.code_point() < 0x7F)); }
+
+        // Gets the number of columns of a single grapheme cluster. The cluster is as wide as its code points, except
+        // that code points joined by a ZWJ are rendered as a single glyph, and VARIATION SELECTOR-16 requests the
+        // (wide) emoji presentation of a pictograph.
+        inline std::size_t grapheme_columns(
+            ustring_view::const_iterator first, ustring_view::const_iterator last, int ambiguous_width
+        )
+        {
+            const bool is_pictographic = is_extended_pictographic(*first);
+            std::size_t result = 0;
+            bool after_zwj = false;
+            for (; first != last; ++first) {
+                const std::int_least32_t cp = first->code_point();
+                if (is_pictographic && (cp == 0xFE0F))
+                    result = std::max(result, static_cast<std::size_t>(2));
+                if (!after_zwj)
+                    result += static_cast<std::size_t>(column_width(*first, ambiguous_width));
+                after_zwj = (cp == 0x200D);
+            }
+            return (result);
+        }
+
+        // Measures the text by grapheme clusters, stopping before the first cluster that would make the width exceed
+        // the limit. Returns the number of code points measured; the number of columns is stored in 'columns'.
+        inline ustring_view::size_type measure_columns(
+            ustring_view text, std::size_t limit, int ambiguous_width, std::size_t& columns
+        )
+        {
+            typedef ustring_view::size_type size_type;
+            columns = 0;
+
+            // Fast path: printable ASCII followed by printable ASCII is always a single column cluster.
+            size_type index = 0;
+            while ((index < text.size()) && is_printable_ascii(text[index]) &&
+                (((index + 1) == text.size()) || is_printable_ascii(text[index + 1]))) {
+                if (columns == limit)
+                    return (index);
+                columns++;
+                index++;
+            }
+            if (index == text.size())
+                return (index);
+
+            const ustring_view rest = text.substr(index);
+            grapheme_breaker breaker{rest};
+            size_type cluster_start = 0;
+            while (breaker.next()) {
+                const std::size_t cluster_columns = grapheme_columns(
+                    rest.cbegin() + cluster_start, rest.cbegin() + breaker.position(), ambiguous_width
+                );
+                if ((limit - columns) < cluster_columns)
+                    break;
+                columns += cluster_columns;
+                cluster_start = breaker.position();
+            }
+            return (index + cluster_start);
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Iterates over the line break opportunities of a text as defined by the Unicode Line Breaking Algorithm
+    /// (UAX #14). The break opportunities are reported in increasing order as positions (in code points) before which
+    /// a line may (or, for mandatory breaks, must) be broken. The end of a non-empty text is always reported as a
+    /// mandatory break.
+    ///
+    /// The pair rules LB25 (numbers) are implemented using the simplified pair form described by UAX #14.
+    ///
+    class line_breaker
+    {
+    public:
+        typedef ustring_view::size_type size_type;
+
+        explicit line_breaker(ustring_view text) :
+            _text{text}, _index{0}, _position{0}, _mandatory{false},
+            _prev_raw{line_break_class::unknown}, _prev{line_break_class::unknown},
+            _prev_prev{line_break_class::unknown}, _before_spaces{line_break_class::unknown},
+            _ri_count{0}, _prev_is_fwh{false}, _prev_is_unassigned_pictographic{false}
+        { return; }
+
+        // The breaker keeps a view of the text, so it cannot be given a temporary string.
+        template<typename allocatorT>
+        explicit line_breaker(generic_ustring<allocatorT>&&) = delete;
+
+        ///
+        /// Advances to the next break opportunity.
+        /// @returns false if there are no more break opportunities.
+        ///
+        bool next(void)
+        {
+            if (_index == 0) {
+                if (_text.empty())
+                    return (false);
+                this->start(_text[0]);
+                _index = 1;
+            }
+
+            while (_index < _text.size()) {
+                const uchar_t ch = _text[_index];
+                const line_break_class cls = resolve_line_break_class(ch);
+                const int decision = this->decide(ch, cls);
+                this->advance(ch, cls);
+                _index++;
+                if (decision != _s_no_break) {
+                    _position = _index - 1;
+                    _mandatory = (decision == _s_mandatory_break);
+                    return (true);
+                }
+            }
+
+            if (_index == _text.size()) {
+                // LB3: Always break at the end of text.
+                _position = _index++;
+                _mandatory = true;
+                return (true);
+            }
+            return (false);
+        }
+
+        ///
+        /// The position of the current break opportunity (i.e. the index of the code point after the break).
+        ///
+        size_type position(void) const noexcept
+        { return (_position); }
+
+        ///
+        /// Whether the current break opportunity is a mandatory break (after a line terminator or at the end of text).
+        ///
+        bool is_mandatory(void) const noexcept
+        { return (_mandatory); }
+
+    private:
+        static const int _s_no_break = 0;
+        static const int _s_allowed_break = 1;
+        static const int _s_mandatory_break = 2;
+
+        ustring_view _text;
+        size_type _index;
+        size_type _position;
+        bool _mandatory;
+
+        // Class of the previous code point as resolved by LB1 (before LB9/LB10).
+        line_break_class _prev_raw;
+        // Class of the previous code point after LB9 (X CM* -> X) and LB10 (CM -> AL) are applied.
+        line_break_class _prev;
+        // The class (after LB9/LB10) preceding _prev.
+        line_break_class _prev_prev;
+        // If _prev is SP, the class that precedes the run of spaces.
+        line_break_class _before_spaces;
+        // Number of consecutive regional indicators ending at the previous code point.
+        size_type _ri_count;
+        // Properties of the code point _prev was taken from.
+        bool _prev_is_fwh;
+        bool _prev_is_unassigned_pictographic;
+
+        void start(uchar_t ch)
+        {
+            typedef line_break_class lb;
+            line_break_class cls = resolve_line_break_class(ch);
+            _prev_raw = cls;
+            // LB10: A combining mark at the start of text is treated as AL.
+            if ((cls == lb::combining_mark) || (cls == lb::zwj))
+                cls = lb::alphabetic;
+            _prev = cls;
+            _prev_prev = lb::unknown;
+            _before_spaces = lb::unknown;
+            _ri_count = (cls == lb::regional_indicator) ? 1 : 0;
+            this->set_prev_properties(ch);
+            return;
+        }
+
+        void set_prev_properties(uchar_t ch)
+        {
+            _prev_is_fwh = is_east_asian_fwh(ch);
+            _prev_is_unassigned_pictographic = is_extended_pictographic(ch) &&
+                (get_general_category(ch) == general_category::unassigned);
+            return;
+        }
+
+        bool is_absorbed(line_break_class cls) const
+        {
+            typedef line_break_class lb;
+            // LB9: Do not break a combining character sequence; treat it as if it has the line breaking class of the
+            // base character in all of the following rules.
+            return (((cls == lb::combining_mark) || (cls == lb::zwj)) &&
+                !is_line_terminator(_prev_raw) && (_prev_raw != lb::space) && (_prev_raw != lb::zwspace));
+        }
+
+        void advance(uchar_t ch, line_break_class cls)
+        {
+            typedef line_break_class lb;
+            const bool absorbed = this->is_absorbed(cls);
+            _prev_raw = cls;
+            if (absorbed)
+                return;
+
+            // LB10: Treat any remaining combining mark or ZWJ as AL.
+            if ((cls == lb::combining_mark) || (cls == lb::zwj))
+                cls = lb::alphabetic;
+
+            if ((cls == lb::space) && (_prev != lb::space))
+                _before_spaces = _prev;
+            _prev_prev = _prev;
+            _prev = cls;
+            _ri_count = (cls == lb::regional_indicator) ? (_ri_count + 1) : 0;
+            this->set_prev_properties(ch);
+            return;
+        }
+
+        int decide(uchar_t ch, line_break_class cls) const
+        {
+            typedef line_break_class lb;
+
+            // LB4, LB5: Always break after hard line breaks, but treat CR LF as a single line break.
+            if ((_prev_raw == lb::carriage_return) && (cls == lb::line_feed))
+                return (_s_no_break);
+            if (is_line_terminator(_prev_raw))
+                return (_s_mandatory_break);
+            // LB6: Do not break before hard line breaks.
+            if (is_line_terminator(cls))
+                return (_s_no_break);
+            // LB7: Do not break before spaces or zero width space.
+            if ((cls == lb::space) || (cls == lb::zwspace))
+                return (_s_no_break);
+            // LB8: Break before any character following a zero-width space, even if one or more spaces intervene.
+            if ((_prev == lb::zwspace) || ((_prev == lb::space) && (_before_spaces == lb::zwspace)))
+                return (_s_allowed_break);
+            // LB8a: Do not break after a zero width joiner.
+            if (_prev_raw == lb::zwj)
+                return (_s_no_break);
+            // LB9
+            if (this->is_absorbed(cls))
+                return (_s_no_break);
+            // LB10
+            const line_break_class cur = ((cls == lb::combining_mark) || (cls == lb::zwj)) ? lb::alphabetic : cls;
+            const line_break_class prev = _prev;
+            const line_break_class base = (prev == lb::space) ? _before_spaces : prev;
+
+            // LB11: Do not break before or after Word joiner and related characters.
+            if ((cur == lb::word_joiner) || (prev == lb::word_joiner))
+                return (_s_no_break);
+            // LB12: Do not break after NBSP and related characters.
+            if (prev == lb::glue)
+                return (_s_no_break);
+            // LB12a: Do not break before NBSP and related characters, except after spaces and hyphens.
+            if ((cur == lb::glue) && (prev != lb::space) && (prev != lb::break_after) && (prev != lb::hyphen))
+                return (_s_no_break);
+            // LB13: Do not break before ']' or '!' or ';' or '/', even after spaces.
+            if ((cur == lb::close_punctuation) || (cur == lb::close_parenthesis) || (cur == lb::exclamation) ||
+                (cur == lb::infix_numeric) || (cur == lb::break_symbols))
+                return (_s_no_break);
+            // LB14: Do not break after '[', even after spaces.
+            if (base == lb::open_punctuation)
+                return (_s_no_break);
+            // LB15: Do not break within '"[', even with intervening spaces.
+            if ((base == lb::quotation) && (cur == lb::open_punctuation))
+                return (_s_no_break);
+            // LB16: Do not break between closing punctuation and a nonstarter, even with intervening spaces.
+            if (((base == lb::close_punctuation) || (base == lb::close_parenthesis)) && (cur == lb::nonstarter))
+                return (_s_no_break);
+            // LB17: Do not break within '——', even with intervening spaces.
+            if ((base == lb::break_both) && (cur == lb::break_both))
+                return (_s_no_break);
+            // LB18: Break after spaces.
+            if (prev == lb::space)
+                return (_s_allowed_break);
+            // LB19: Do not break before or after quotation marks.
+            if ((cur == lb::quotation) || (prev == lb::quotation))
+                return (_s_no_break);
+            // LB20: Break before and after unresolved CB.
+            if ((cur == lb::contingent_break) || (prev == lb::contingent_break))
+                return (_s_allowed_break);
+            // LB21: Do not break before hyphen-minus, other hyphens, fixed-width spaces, small kana, and other
+            // non-starters, or after acute accents.
+            if ((cur == lb::break_after) || (cur == lb::hyphen) || (cur == lb::nonstarter) ||
+                (prev == lb::break_before))
+                return (_s_no_break);
+            // LB21a: Don't break after Hebrew + Hyphen.
+            if ((_prev_prev == lb::hebrew_letter) && ((prev == lb::hyphen) || (prev == lb::break_after)))
+                return (_s_no_break);
+            // LB21b: Don't break between Solidus and Hebrew letters.
+            if ((prev == lb::break_symbols) && (cur == lb::hebrew_letter))
+                return (_s_no_break);
+            // LB22: Do not break before ellipses.
+            if (cur == lb::inseparable)
+                return (_s_no_break);
+            // LB23: Do not break between digits and letters.
+            if ((is_alphabetic_class(prev) && (cur == lb::numeric)) ||
+                ((prev == lb::numeric) && is_alphabetic_class(cur)))
+                return (_s_no_break);
+            // LB23a: Do not break between numeric prefixes and ideographs, or between ideographs and numeric
+            // postfixes.
+            const bool is_ideographic_cur = (cur == lb::ideographic) || (cur == lb::e_base) || (cur == lb::e_modifier);
+            const bool is_ideographic_prev = (prev == lb::ideographic) || (prev == lb::e_base) ||
+                (prev == lb::e_modifier);
+            if (((prev == lb::prefix_numeric) && is_ideographic_cur) ||
+                (is_ideographic_prev && (cur == lb::postfix_numeric)))
+                return (_s_no_break);
+            // LB24: Do not break between numeric prefix/postfix and letters, or between letters and prefix/postfix.
+            const bool is_affix_prev = (prev == lb::prefix_numeric) || (prev == lb::postfix_numeric);
+            const bool is_affix_cur = (cur == lb::prefix_numeric) || (cur == lb::postfix_numeric);
+            if ((is_affix_prev && is_alphabetic_class(cur)) || (is_alphabetic_class(prev) && is_affix_cur))
+                return (_s_no_break);
+            // LB25: Do not break between the following pairs of classes relevant to numbers.
+            if (cur == lb::postfix_numeric || cur == lb::prefix_numeric) {
+                if ((prev == lb::close_punctuation) || (prev == lb::close_parenthesis) || (prev == lb::numeric))
+                    return (_s_no_break);
+            }
+            if ((prev == lb::postfix_numeric) || (prev == lb::prefix_numeric)) {
+                if ((cur == lb::open_punctuation) || (cur == lb::numeric))
+                    return (_s_no_break);
+            }
+            if ((cur == lb::numeric) && ((prev == lb::hyphen) || (prev == lb::infix_numeric) ||
+                (prev == lb::numeric) || (prev == lb::break_symbols)))
+                return (_s_no_break);
+            // LB26: Do not break a Korean syllable.
+            if ((prev == lb::jl) && ((cur == lb::jl) || (cur == lb::jv) || (cur == lb::h2) || (cur == lb::h3)))
+                return (_s_no_break);
+            if (((prev == lb::jv) || (prev == lb::h2)) && ((cur == lb::jv) || (cur == lb::jt)))
+                return (_s_no_break);
+            if (((prev == lb::jt) || (prev == lb::h3)) && (cur == lb::jt))
+                return (_s_no_break);
+            // LB27: Treat a Korean Syllable Block the same as ID.
+            if ((is_hangul_class(prev) && (cur == lb::postfix_numeric)) ||
+                ((prev == lb::prefix_numeric) && is_hangul_class(cur)))
+                return (_s_no_break);
+            // LB28: Do not break between alphabetics.
+            if (is_alphabetic_class(prev) && is_alphabetic_class(cur))
+                return (_s_no_break);
+            // LB29: Do not break between numeric punctuation and alphabetics.
+            if ((prev == lb::infix_numeric) && is_alphabetic_class(cur))
+                return (_s_no_break);
+            // LB30: Do not break between letters, numbers, or ordinary symbols and (non-East-Asian) opening or closing
+            // parentheses.
+            if ((is_alphabetic_class(prev) || (prev == lb::numeric)) && (cur == lb::open_punctuation) &&
+                !is_east_asian_fwh(ch))
+                return (_s_no_break);
+            if ((prev == lb::close_parenthesis) && !_prev_is_fwh &&
+                (is_alphabetic_class(cur) || (cur == lb::numeric)))
+                return (_s_no_break);
+            // LB30a: Break between two regional indicator symbols if and only if there are an even number of regional
+            // indicators preceding the position of the break.
+            if ((prev == lb::regional_indicator) && (cur == lb::regional_indicator) && ((_ri_count % 2) == 1))
+                return (_s_no_break);
+            // LB30b: Do not break between an emoji base (or potential emoji) and an emoji modifier.
+            if ((cur == lb::e_modifier) && ((prev == lb::e_base) || _prev_is_unassigned_pictographic))
+                return (_s_no_break);
+            // LB31: Break everywhere else.
+            return (_s_allowed_break);
+        }
+    }; // class line_breaker
+
+    ///
+    /// Gets all line break opportunities of a text.
+    /// @param text The text to analyze.
+    /// @returns The positions of the break opportunities (see line_breaker).
+    ///
+    inline std::vector<ustring_view::size_type> line_break_positions(ustring_view text)
+    {
+        std::vector<ustring_view::size_type> result;
+        line_breaker breaker{text};
+        while (breaker.next())
+            result.push_back(breaker.position());
+        return (result);
+    }
+
+    ///
+    /// Wraps a text into lines that fit a number of terminal columns. Lines are broken at the line break
+    /// opportunities of UAX #14 and at every mandatory break, and the width of each line is measured with
+    /// display_width (i.e. East Asian Wide/Fullwidth characters take two columns). A word that does not fit in an
+    /// empty line is broken between grapheme clusters.
+    /// @param text The text to wrap.
+    /// @param width The maximum number of columns of a line. A line may only exceed this if a single grapheme
+    ///     cluster is wider than the width.
+    /// @param ambiguous_width The width of East Asian Ambiguous characters.
+    /// @returns Views into the text for each line. Line terminators and trailing spaces are not part of the lines.
+    ///
+    inline std::vector<ustring_view> wrap(ustring_view text, std::size_t width, int ambiguous_width = 1)
+    {
+        typedef ustring_view::size_type size_type;
+        typedef ustring_view::const_iterator const_iterator;
+
+        std::vector<ustring_view> result;
+        const const_iterator text_begin = text.cbegin();
+        const std::size_t unlimited = std::numeric_limits<std::size_t>::max();
+
+        // Gets a view of [first, last) without trailing line terminators and spaces.
+        auto make_line = [] (const_iterator first, const_iterator last) -> ustring_view {
+            while (last != first) {
+                const line_break_class cls = get_line_break_class(*(last - 1));
+                if (!is_line_terminator(cls) && (cls != line_break_class::space))
+                    break;
+                --last;
+            }
+            return (ustring_view{first, static_cast<size_type>(last - first)});
+        };
+
+        auto columns_of = [unlimited, ambiguous_width] (ustring_view str) -> std::size_t {
+            std::size_t columns = 0;
+            measure_columns(str, unlimited, ambiguous_width, columns);
+            return (columns);
+        };
+
+        const_iterator line_start = text_begin;
+        const_iterator segment_start = text_begin;
+        std::size_t line_columns = 0;
+
+        line_breaker breaker{text};
+        while (breaker.next()) {
+            const const_iterator segment_end = text_begin + breaker.position();
+            const ustring_view segment_visible = make_line(segment_start, segment_end);
+            const std::size_t segment_columns = columns_of(segment_visible);
+
+            if ((segment_start != line_start) && ((line_columns + segment_columns) > width)) {
+                result.push_back(make_line(line_start, segment_start));
+                line_start = segment_start;
+                line_columns = 0;
+            }
+
+            if ((line_start == segment_start) && (segment_columns > width)) {
+                // Emergency breaks for a segment that does not fit in a line on its own.
+                ustring_view rest = segment_visible;
+                std::size_t rest_columns = segment_columns;
+                while (rest_columns > width) {
+                    std::size_t chunk_columns = 0;
+                    size_type chunk_size = measure_columns(rest, width, ambiguous_width, chunk_columns);
+                    if (chunk_size == 0) {
+                        // A single grapheme cluster wider than a line takes a line on its own.
+                        grapheme_breaker cluster{rest};
+                        cluster.next();
+                        chunk_size = cluster.position();
+                        chunk_columns = grapheme_columns(rest.cbegin(), rest.cbegin() + chunk_size, ambiguous_width);
+                    }
+                    if (chunk_size == rest.size())
+                        break;
+                    result.push_back(rest.substr(0, chunk_size));
+                    rest.remove_prefix(chunk_size);
+                    rest_columns -= chunk_columns;
+                }
+                line_start = rest.cbegin();
+                line_columns = columns_of(ustring_view{line_start, static_cast<size_type>(segment_end - line_start)});
+            }
+            else {
+                line_columns += columns_of(
+                    ustring_view{segment_start, static_cast<size_type>(segment_end - segment_start)}
+                );
+            }
+            segment_start = segment_end;
+
+            if (breaker.is_mandatory()) {
+                result.push_back(make_line(line_start, segment_end));
+                line_start = segment_end;
+                line_columns = 0;
+            }
+        }
+        return (result);
+    }
+
+    // The lines are views of the text, so it cannot be a temporary string.
+    template<typename allocatorT>
+    std::vector<ustring_view> wrap(generic_ustring<allocatorT>&&, std::size_t, int = 1) = delete;
+
+    ///
+    /// Tag type to assert that a text consists of printable ASCII (U+0020 to U+007E) only, in which case every code
+    /// point is a grapheme cluster that takes one column and the width functions run in constant time.
+    ///
+    struct ascii_only_t
+    {
+    };
+
+    constexpr ascii_only_t ascii_only{};
+
+    ///
+    /// Gets the number of terminal columns a text occupies. The text is measured by grapheme cluster: combining marks
+    /// and other zero width characters take no columns, East Asian Wide/Fullwidth characters (CJK, emoji) take two
+    /// columns, and emoji ZWJ sequences are measured as a single glyph.
+    /// @param text The text to measure.
+    /// @param ambiguous_width The width of East Asian Ambiguous characters.
+    ///
+    inline std::size_t display_width(ustring_view text, int ambiguous_width = 1)
+    {
+        std::size_t columns = 0;
+        measure_columns(text, std::numeric_limits<std::size_t>::max(), ambiguous_width, columns);
+        return (columns);
+    }
+
+    ///
+    /// Gets the number of terminal columns a text known to be printable ASCII occupies, in constant time.
+    ///
+    inline std::size_t display_width(ustring_view text, ascii_only_t)
+    { return (text.size()); }
+
+    ///
+    /// Gets the longest prefix of a text that fits in a number of columns without splitting a grapheme cluster.
+    /// @param text The text to truncate.
+    /// @param width The maximum number of columns.
+    /// @param ambiguous_width The width of East Asian Ambiguous characters.
+    /// @returns A view of the prefix.
+    ///
+    inline ustring_view truncate_view_to_width(ustring_view text, std::size_t width, int ambiguous_width = 1)
+    {
+        std::size_t columns = 0;
+        return (text.substr(0, measure_columns(text, width, ambiguous_width, columns)));
+    }
+
+    ///
+    /// Gets the longest prefix of a text known to be printable ASCII that fits in a number of columns, in constant
+    /// time.
+    ///
+    inline ustring_view truncate_view_to_width(ustring_view text, std::size_t width, ascii_only_t)
+    { return (text.substr(0, std::min(width, text.size()))); }
+
+    // The prefix is a view of the text, so it cannot be a temporary string.
+    template<typename allocatorT>
+    ustring_view truncate_view_to_width(generic_ustring<allocatorT>&&, std::size_t, int = 1) = delete;
+
+    template<typename allocatorT>
+    ustring_view truncate_view_to_width(generic_ustring<allocatorT>&&, std::size_t, ascii_only_t) = delete;
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        inline ustring concatenate(ustring_view first, ustring_view second)
+        {
+            ustring result(first.size() + second.size(), uchar_t::null_char());
+            std::copy(second.cbegin(), second.cend(), std::copy(first.cbegin(), first.cend(), result.begin()));
+            return (result);
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Truncates a text to a number of columns without splitting grapheme clusters. If the text does not fit, it is
+    /// cut so that the remaining prefix followed by the ellipsis fits.
+    /// @param text The text to truncate.
+    /// @param width The maximum number of columns of the result.
+    /// @param ellipsis The text to append when the text is truncated (e.g. U+2026 HORIZONTAL ELLIPSIS). It is
+    ///     omitted if it does not fit on its own.
+    /// @param ambiguous_width The width of East Asian Ambiguous characters.
+    ///
+    inline ustring truncate_to_width(
+        ustring_view text, std::size_t width, ustring_view ellipsis, int ambiguous_width = 1
+    )
+    {
+        std::size_t columns = 0;
+        const ustring_view::size_type fit_size = measure_columns(text, width, ambiguous_width, columns);
+        if (fit_size == text.size())
+            return (concatenate(text, ustring_view{}));
+
+        const std::size_t ellipsis_columns = display_width(ellipsis, ambiguous_width);
+        if (ellipsis_columns > width)
+            return (concatenate(text.substr(0, fit_size), ustring_view{}));
+
+        const ustring_view prefix = truncate_view_to_width(
+            text.substr(0, fit_size), width - ellipsis_columns, ambiguous_width
+        );
+        return (concatenate(prefix, ellipsis));
+    }
+
+    ///
+    /// Truncates a text known to be printable ASCII to a number of columns. The prefix is found in constant time.
+    ///
+    inline ustring truncate_to_width(ustring_view text, std::size_t width, ustring_view ellipsis, ascii_only_t)
+    {
+        if (text.size() <= width)
+            return (concatenate(text, ustring_view{}));
+
+        const std::size_t ellipsis_columns = display_width(ellipsis);
+        if (ellipsis_columns > width)
+            return (concatenate(text.substr(0, width), ustring_view{}));
+        return (concatenate(text.substr(0, width - ellipsis_columns), ellipsis));
+    }
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_LAYOUT_HPP)
@@ -0,0 +1,299 @@
+#if !defined(UNISTRINGXX_LINE_READER_HPP)
+#define UNISTRINGXX_LINE_READER_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#if defined(_WIN32)
+#include <io.h>
+#else // defined(_WIN32)
+#include <unistd.h>
+#endif // defined(_WIN32)
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        const std::size_t _s_line_reader_buffer_size = 1 << 20;
+        // The buffer is aligned to a page, which suits both the SIMD scans and the kernel copies.
+        const std::size_t _s_line_reader_buffer_alignment = 4096;
+
+        // Finds the first occurrence of an octet (like std::memchr), 16 octets at a time with SSE2.
+        inline const char* find_octet(const char* first, const char* last, char value)
+        {
+#if (UNISTRINGXX_HAS_SSE2)
+            const __m128i pattern = _mm_set1_epi8(value);
+            for (; (last - first) >= 16; first += 16) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                const std::uint32_t mask = static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern))
+                );
+                if (mask != 0)
+                    return (first + count_trailing_zeros(mask));
+            }
+#endif // (UNISTRINGXX_HAS_SSE2)
+            for (; first != last; ++first) {
+                if (*first == value)
+                    return (first);
+            }
+            return (nullptr);
+        }
+
+#if defined(_WIN32)
+        inline int open_for_reading(const char* path)
+        { return (::_open(path, _O_RDONLY | _O_BINARY)); }
+
+        inline long read_octets(int descriptor, char* buffer, std::size_t size)
+        {
+            const unsigned int count = static_cast<unsigned int>(std::min<std::size_t>(size, 1 << 30));
+            return (static_cast<long>(::_read(descriptor, buffer, count)));
+        }
+
+        inline void close_descriptor(int descriptor)
+        {
+            ::_close(descriptor);
+            return;
+        }
+#else // defined(_WIN32)
+        inline int open_for_reading(const char* path)
+        { return (::open(path, O_RDONLY)); }
+
+        inline long read_octets(int descriptor, char* buffer, std::size_t size)
+        {
+            ssize_t result = 0;
+            do {
+                result = ::read(descriptor, buffer, size);
+            } while ((result < 0) && (errno == EINTR));
+            return (static_cast<long>(result));
+        }
+
+        inline void close_descriptor(int descriptor)
+        {
+            ::close(descriptor);
+            return;
+        }
+#endif // defined(_WIN32)
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Reads the lines of a UTF-8 file (or of any readable file descriptor, e.g. a pipe) with large buffered reads.
+    /// The line breaks are found with SIMD scans and the lines are either returned as views of the UTF-8 octets in the
+    /// read buffer or decoded straight into a reused generic_ustring (with an ASCII fast path), so there is no
+    /// per-line allocation in either case. Lines end with "\n" or "\r\n" (which are not part of the line); the last
+    /// line may have no line break.
+    ///
+    /// Note: Decoding is several times slower than the octet views (each code point takes 3 octets), so only decode
+    /// the lines that are kept.
+    ///
+    class line_reader
+    {
+    public:
+        ///
+        /// Opens a file. Throws std::runtime_error if the file cannot be opened (or, without exceptions, is_open() is
+        /// false).
+        ///
+        explicit line_reader(const char* path, std::size_t buffer_size = _s_line_reader_buffer_size) :
+            line_reader{open_for_reading(path), true, buffer_size}
+        {
+            if (_descriptor < 0) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::runtime_error, "Unable to open the file.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            return;
+        }
+
+        ///
+        /// Reads from a file descriptor, which is not closed by the reader.
+        ///
+        explicit line_reader(int descriptor, std::size_t buffer_size = _s_line_reader_buffer_size) :
+            line_reader{descriptor, false, buffer_size}
+        { return; }
+
+        line_reader(const line_reader&) = delete;
+        line_reader& operator=(const line_reader&) = delete;
+
+        bool is_open(void) const noexcept
+        { return (_descriptor >= 0); }
+
+        ///
+        /// Gets the next line as UTF-8 octets (without validation). The octets are in the read buffer, and are only
+        /// valid until the next read.
+        /// @returns false at the end of the input.
+        ///
+        bool read_line(const char*& data, std::size_t& size)
+        {
+            std::size_t scanned = _begin;
+            for (;;) {
+                const char* newline = find_octet(_buffer + scanned, _buffer + _end, '\n');
+                if (newline != nullptr) {
+                    const std::size_t line_end = static_cast<std::size_t>(newline - _buffer);
+                    this->set_line(data, size, line_end);
+                    _begin = line_end + 1;
+                    if ((size > 0) && (data[size - 1] == '\r'))
+                        size--;
+                    return (true);
+                }
+                if (_is_end) {
+                    if (_begin == _end)
+                        return (false);
+                    this->set_line(data, size, _end);
+                    _begin = _end;
+                    return (true);
+                }
+                scanned = _end - _begin;
+                this->fill();
+            }
+        }
+
+        ///
+        /// Decodes the next line into line (whose buffer is reused). Throws std::range_error on invalid UTF-8 (or,
+        /// without exceptions, stores uchar::invalid_value for each invalid sequence).
+        /// @returns false at the end of the input.
+        ///
+        template<typename allocatorT>
+        bool read_line(generic_ustring<allocatorT>& line)
+        {
+            const char* data = nullptr;
+            std::size_t size = 0;
+            if (!this->read_line(data, size))
+                return (false);
+
+            // A line has at most as many code points as octets: decode into place, then trim. The storage of line is
+            // reused, so resizing only initializes the code points beyond the previous line, and trimming never
+            // reallocates.
+            line.resize(size);
+            uchar_t* out = (size > 0) ? &line[0] : nullptr;
+            const std::uint8_t* first = reinterpret_cast<const std::uint8_t*>(data);
+            const std::uint8_t* last = first + size;
+            std::size_t count = 0;
+            for (;;) {
+                first = decode_utf8_run(first, last, out, count);
+                if (first == last)
+                    break;
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::range_error, "Invalid octets detected while decoding UTF-8.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                out[count++] = uchar_t{uchar_t::invalid_value};
+                ++first;
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            line.resize(count);
+            return (true);
+        }
+
+        ///
+        /// Gets the offset in octets, from the start of the input, of the last line read.
+        ///
+        std::uint64_t line_offset(void) const noexcept
+        { return (_line_offset); }
+
+        ///
+        /// Gets the number of the last line read (starting at 1).
+        ///
+        std::uint64_t line_number(void) const noexcept
+        { return (_line_number); }
+
+    private:
+        // Closes the descriptor of the reader if it owns it, also when the construction fails after it was opened.
+        struct descriptor_owner
+        {
+            int descriptor;
+
+            ~descriptor_owner(void)
+            {
+                if (descriptor >= 0)
+                    close_descriptor(descriptor);
+                return;
+            }
+        };
+
+        int _descriptor;
+        descriptor_owner _owner;
+        bool _is_end;
+        std::vector<char> _storage;
+        // The aligned start of _storage, of which [_begin, _end) is read but not returned yet.
+        char* _buffer;
+        std::size_t _capacity;
+        std::size_t _begin;
+        std::size_t _end;
+        // The offset of _buffer[0] in the input.
+        std::uint64_t _buffer_offset;
+        std::uint64_t _line_offset;
+        std::uint64_t _line_number;
+
+        line_reader(int descriptor, bool is_owner, std::size_t buffer_size) :
+            _descriptor{descriptor}, _owner{is_owner ? descriptor : -1}, _is_end{descriptor < 0}, _storage{},
+            _buffer{nullptr}, _capacity{0}, _begin{0}, _end{0}, _buffer_offset{0}, _line_offset{0}, _line_number{0}
+        {
+            this->allocate_buffer(std::max<std::size_t>(buffer_size, 16));
+            return;
+        }
+
+        void allocate_buffer(std::size_t capacity)
+        {
+            std::vector<char> storage(capacity + _s_line_reader_buffer_alignment);
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(storage.data());
+            const std::uintptr_t mask = static_cast<std::uintptr_t>(_s_line_reader_buffer_alignment - 1);
+            char* buffer = storage.data() + (((address + mask) & ~mask) - address);
+            if (_end > _begin)
+                std::memcpy(buffer, _buffer + _begin, _end - _begin);
+            _storage.swap(storage);
+            _buffer = buffer;
+            _capacity = capacity;
+            return;
+        }
+
+        // Moves the pending octets to the front of the buffer (growing it when a line fills it), then reads more.
+        void fill(void)
+        {
+            const std::size_t pending = _end - _begin;
+            if (pending == _capacity)
+                this->allocate_buffer(_capacity * 2);
+            else if (_begin > 0)
+                std::memmove(_buffer, _buffer + _begin, pending);
+            _buffer_offset += _begin;
+            _begin = 0;
+            _end = pending;
+
+            const long result = read_octets(_descriptor, _buffer + _end, _capacity - _end);
+            if (result < 0) {
+                _is_end = true;
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::runtime_error, "Unable to read from the file.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            else if (result == 0) {
+                _is_end = true;
+            }
+            else {
+                _end += static_cast<std::size_t>(result);
+            }
+            return;
+        }
+
+        void set_line(const char*& data, std::size_t& size, std::size_t line_end) noexcept
+        {
+            data = _buffer + _begin;
+            size = line_end - _begin;
+            _line_offset = _buffer_offset + _begin;
+            _line_number++;
+            return;
+        }
+    }; // class line_reader
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_LINE_READER_HPP)
@@ -0,0 +1,651 @@
+#if !defined(UNISTRINGXX_MAPPED_USTRING_HPP)
+#define UNISTRINGXX_MAPPED_USTRING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+#include "ustring_view.hpp"
+#include "utf_validation.hpp"
+
+#if defined(_WIN32)
+// Keeps windows.h from defining the min and max macros, which break std::min and std::max.
+#if !defined(NOMINMAX)
+    #define NOMINMAX
+    #define UNISTRINGXX_DEFINED_NOMINMAX
+#endif // !defined(NOMINMAX)
+#if !defined(WIN32_LEAN_AND_MEAN)
+    #define WIN32_LEAN_AND_MEAN
+    #define UNISTRINGXX_DEFINED_WIN32_LEAN_AND_MEAN
+#endif // !defined(WIN32_LEAN_AND_MEAN)
+#include <windows.h>
+#if defined(UNISTRINGXX_DEFINED_NOMINMAX)
+    #undef NOMINMAX
+    #undef UNISTRINGXX_DEFINED_NOMINMAX
+#endif // defined(UNISTRINGXX_DEFINED_NOMINMAX)
+#if defined(UNISTRINGXX_DEFINED_WIN32_LEAN_AND_MEAN)
+    #undef WIN32_LEAN_AND_MEAN
+    #undef UNISTRINGXX_DEFINED_WIN32_LEAN_AND_MEAN
+#endif // defined(UNISTRINGXX_DEFINED_WIN32_LEAN_AND_MEAN)
+#else // defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // defined(_WIN32)
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // The UTF-8 text is indexed (and decoded) in pages of about this many octets.
+        const std::size_t _s_mapped_page_size = 1 << 16;
+        // The number of decoded pages kept at a time.
+        const std::size_t _s_mapped_cache_page_count = 8;
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// The encodings of the files read by mapped_ustring. UTF-24 and UTF-32 are packed little endian code points (3
+    /// and 4 octets each), UTF-24 being the layout of uchar in memory.
+    ///
+    enum class mapped_encoding
+    {
+        utf8,
+        utf24,
+        utf32
+    };
+
+    ///
+    /// A read-only text backed by a memory-mapped file, for large dictionaries and corpora that are searched but never
+    /// modified. The file is not copied: the resident memory is the part of the file in the page cache of the OS,
+    /// plus a few decoded pages.
+    ///
+    /// UTF-24 and UTF-32 files are read in place (a code unit that is not a Unicode scalar value reads as
+    /// uchar::invalid_value). A UTF-8 file is validated and indexed once when it is opened (a code point count for
+    /// every page of 64 KiB), and its pages are decoded on demand into a small cache of recently used pages. find()
+    /// does not decode at all: the needle is encoded to the encoding of the file and searched in the mapped octets.
+    ///
+    /// The elements are returned by value. Reading through a const object updates the page cache, so, like a stream,
+    /// a mapped_ustring must not be read from several threads at once (but each thread can map the same file).
+    ///
+    /// The search functions return ustring_view::npos when there is no match.
+    ///
+    class mapped_ustring
+    {
+    public:
+        typedef uchar_t_traits traits_type;
+        typedef uchar_t char_type;
+        typedef char_type value_type;
+        typedef char_type reference;
+        typedef char_type const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+    private:
+        class mapped_iterator
+        {
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef uchar_t value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const uchar_t* pointer;
+            typedef uchar_t reference;
+
+            mapped_iterator(void) noexcept :
+                _owner{nullptr}, _index{0}
+            { return; }
+
+            mapped_iterator(const mapped_ustring* owner, size_type index) noexcept :
+                _owner{owner}, _index{index}
+            { return; }
+
+            reference operator*(void) const
+            { return ((*_owner)[_index]); }
+
+            reference operator[](difference_type offset) const
+            { return ((*_owner)[static_cast<size_type>(static_cast<difference_type>(_index) + offset)]); }
+
+            mapped_iterator& operator++(void) noexcept
+            {
+                _index++;
+                return (*this);
+            }
+
+            mapped_iterator operator++(int) noexcept
+            {
+                mapped_iterator result{*this};
+                _index++;
+                return (result);
+            }
+
+            mapped_iterator& operator--(void) noexcept
+            {
+                _index--;
+                return (*this);
+            }
+
+            mapped_iterator operator--(int) noexcept
+            {
+                mapped_iterator result{*this};
+                _index--;
+                return (result);
+            }
+
+            mapped_iterator& operator+=(difference_type offset) noexcept
+            {
+                _index = static_cast<size_type>(static_cast<difference_type>(_index) + offset);
+                return (*this);
+            }
+
+            mapped_iterator& operator-=(difference_type offset) noexcept
+            {
+                _index = static_cast<size_type>(static_cast<difference_type>(_index) - offset);
+                return (*this);
+            }
+
+            friend mapped_iterator operator+(mapped_iterator itr, difference_type offset) noexcept
+            { return (itr += offset); }
+
+            friend mapped_iterator operator+(difference_type offset, mapped_iterator itr) noexcept
+            { return (itr += offset); }
+
+            friend mapped_iterator operator-(mapped_iterator itr, difference_type offset) noexcept
+            { return (itr -= offset); }
+
+            friend difference_type operator-(const mapped_iterator& left, const mapped_iterator& right) noexcept
+            { return (static_cast<difference_type>(left._index) - static_cast<difference_type>(right._index)); }
+
+            friend bool operator==(const mapped_iterator& left, const mapped_iterator& right) noexcept
+            { return (left._index == right._index); }
+
+            friend bool operator!=(const mapped_iterator& left, const mapped_iterator& right) noexcept
+            { return (left._index != right._index); }
+
+            friend bool operator<(const mapped_iterator& left, const mapped_iterator& right) noexcept
+            { return (left._index < right._index); }
+
+            friend bool operator<=(const mapped_iterator& left, const mapped_iterator& right) noexcept
+            { return (left._index <= right._index); }
+
+            friend bool operator>(const mapped_iterator& left, const mapped_iterator& right) noexcept
+            { return (left._index > right._index); }
+
+            friend bool operator>=(const mapped_iterator& left, const mapped_iterator& right) noexcept
+            { return (left._index >= right._index); }
+
+        private:
+            const mapped_ustring* _owner;
+            size_type _index;
+        }; // class mapped_iterator
+
+    public:
+        typedef mapped_iterator iterator;
+        typedef mapped_iterator const_iterator;
+        typedef std::reverse_iterator<const_iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        mapped_ustring(void) noexcept :
+            _data{nullptr}, _octet_count{0}, _encoding{mapped_encoding::utf8}, _size{0}, _page_offsets{},
+            _page_starts{}, _cache{}, _cache_clock{0}, _last_cache_index{0}
+        { return; }
+
+        ///
+        /// Maps a file. Throws std::runtime_error if the file cannot be mapped, and std::range_error if a UTF-8 file
+        /// is not valid UTF-8 or if the size of a UTF-24 or UTF-32 file is not a multiple of its code unit size (or,
+        /// without exceptions, the object is empty).
+        ///
+        explicit mapped_ustring(const char* path, mapped_encoding encoding = mapped_encoding::utf8) :
+            mapped_ustring{}
+        {
+            _encoding = encoding;
+            if (!this->map(path)) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::runtime_error, "Unable to map the file.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                return;
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            if (!this->build_index()) {
+                this->unmap();
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::range_error, "Invalid octets detected in the mapped file.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            return;
+        }
+
+        mapped_ustring(const mapped_ustring&) = delete;
+        mapped_ustring& operator=(const mapped_ustring&) = delete;
+
+        mapped_ustring(mapped_ustring&& other) noexcept :
+            mapped_ustring{}
+        {
+            this->swap(other);
+            return;
+        }
+
+        mapped_ustring& operator=(mapped_ustring&& other) noexcept
+        {
+            mapped_ustring{std::move(other)}.swap(*this);
+            return (*this);
+        }
+
+        ~mapped_ustring(void)
+        {
+            this->unmap();
+            return;
+        }
+
+        mapped_encoding encoding(void) const noexcept
+        { return (_encoding); }
+
+        ///
+        /// Gets the mapped octets of the file.
+        ///
+        const std::uint8_t* octets(void) const noexcept
+        { return (_data); }
+
+        size_type octet_count(void) const noexcept
+        { return (_octet_count); }
+
+        // UNISTRINGXX_MAPPED_USTRING_ITERATORS
+
+        const_iterator begin(void) const noexcept
+        { return (const_iterator{this, 0}); }
+
+        const_iterator cbegin(void) const noexcept
+        { return (const_iterator{this, 0}); }
+
+        const_iterator end(void) const noexcept
+        { return (const_iterator{this, _size}); }
+
+        const_iterator cend(void) const noexcept
+        { return (const_iterator{this, _size}); }
+
+        const_reverse_iterator rbegin(void) const noexcept
+        { return (const_reverse_iterator{this->cend()}); }
+
+        const_reverse_iterator crbegin(void) const noexcept
+        { return (const_reverse_iterator{this->cend()}); }
+
+        const_reverse_iterator rend(void) const noexcept
+        { return (const_reverse_iterator{this->cbegin()}); }
+
+        const_reverse_iterator crend(void) const noexcept
+        { return (const_reverse_iterator{this->cbegin()}); }
+
+        // UNISTRINGXX_MAPPED_USTRING_SIZES
+
+        size_type size(void) const noexcept
+        { return (_size); }
+
+        size_type length(void) const noexcept
+        { return (_size); }
+
+        bool empty(void) const noexcept
+        { return (_size == 0); }
+
+        // UNISTRINGXX_MAPPED_USTRING_ELEMENT_ACCESS
+
+        const_reference operator[](size_type index) const
+        {
+            if (_encoding == mapped_encoding::utf8) {
+                const decoded_page& page = this->get_page(index);
+                return (page.code_points[index - _page_starts[page.page]]);
+            }
+            const size_type width = this->code_unit_size();
+            const std::uint8_t* data = _data + (index * width);
+            std::uint32_t value = data[0] | (data[1] << 8) | (data[2] << 16);
+            if (width == 4)
+                value |= static_cast<std::uint32_t>(data[3]) << 24;
+            return (
+                is_scalar_value(value) ? char_type{static_cast<char_type::int_type>(value)} :
+                char_type{char_type::invalid_value}
+            );
+        }
+
+        const_reference at(size_type index) const
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index >= this->size())
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            return ((*this)[index]);
+        }
+
+        const_reference front(void) const
+        { return ((*this)[0]); }
+
+        const_reference back(void) const
+        { return ((*this)[_size - 1]); }
+
+        // UNISTRINGXX_MAPPED_USTRING_OPERATIONS
+
+        ///
+        /// Copies a part of the text to a ustring.
+        ///
+        ustring substr(size_type index = 0, size_type count = ustring_view::npos) const
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index > this->size())
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index > this->size())
+                return (ustring{});
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            count = (count < (this->size() - index)) ? count : (this->size() - index);
+            ustring result(count, char_type::null_char());
+            for (size_type ctr = 0; ctr < count; ctr++)
+                result[ctr] = (*this)[index + ctr];
+            return (result);
+        }
+
+        ustring to_ustring(void) const
+        { return (this->substr()); }
+
+        int compare(ustring_view str) const
+        {
+            const size_type count = (_size < str.size()) ? _size : str.size();
+            for (size_type ctr = 0; ctr < count; ctr++) {
+                const char_type ch = (*this)[ctr];
+                if (ch != str[ctr])
+                    return ((ch < str[ctr]) ? -1 : 1);
+            }
+            if (_size == str.size())
+                return (0);
+            return ((_size < str.size()) ? -1 : 1);
+        }
+
+        ///
+        /// Finds a text, from index. The text is encoded once and searched in the mapped octets.
+        ///
+        size_type find(ustring_view str, size_type index = 0) const
+        {
+            if (index > _size)
+                return (ustring_view::npos);
+            if (str.empty())
+                return (index);
+
+            std::vector<std::uint8_t> needle;
+            if (!this->encode(str, needle))
+                return (ustring_view::npos);
+            const size_type width = this->code_unit_size();
+            const std::uint8_t* first = _data + this->get_octet_offset(index);
+            const std::uint8_t* last = _data + _octet_count;
+            while (static_cast<size_type>(last - first) >= needle.size()) {
+                const size_type count = static_cast<size_type>(last - first) - needle.size() + 1;
+                const void* found = std::memchr(first, needle[0], count);
+                if (found == nullptr)
+                    break;
+                first = static_cast<const std::uint8_t*>(found);
+                const size_type offset = static_cast<size_type>(first - _data);
+                // A UTF-8 match always starts on a code point. A match across two UTF-24 or UTF-32 code units does not
+                // count.
+                if (((offset % width) == 0) && (std::memcmp(first, needle.data(), needle.size()) == 0))
+                    return (this->get_index(offset));
+                ++first;
+            }
+            return (ustring_view::npos);
+        }
+
+        size_type find(char_type ch, size_type index = 0) const
+        { return (this->find(ustring_view{&ch, 1}, index)); }
+
+        void swap(mapped_ustring& other) noexcept
+        {
+            std::swap(_data, other._data);
+            std::swap(_octet_count, other._octet_count);
+            std::swap(_encoding, other._encoding);
+            std::swap(_size, other._size);
+            _page_offsets.swap(other._page_offsets);
+            _page_starts.swap(other._page_starts);
+            _cache.swap(other._cache);
+            std::swap(_cache_clock, other._cache_clock);
+            std::swap(_last_cache_index, other._last_cache_index);
+            return;
+        }
+
+        friend bool operator==(const mapped_ustring& left, ustring_view right)
+        { return ((left.size() == right.size()) && (left.compare(right) == 0)); }
+
+        friend bool operator==(ustring_view left, const mapped_ustring& right)
+        { return (right == left); }
+
+        friend bool operator!=(const mapped_ustring& left, ustring_view right)
+        { return (!(left == right)); }
+
+        friend bool operator!=(ustring_view left, const mapped_ustring& right)
+        { return (!(right == left)); }
+
+    private:
+        struct decoded_page
+        {
+            size_type page;
+            std::uint64_t last_use;
+            std::vector<char_type> code_points;
+        };
+
+        const std::uint8_t* _data;
+        size_type _octet_count;
+        mapped_encoding _encoding;
+        size_type _size;
+        // For UTF-8: the offset of each page in the file, and the index of its first code point (with _size at the
+        // end).
+        std::vector<size_type> _page_offsets;
+        std::vector<size_type> _page_starts;
+        mutable std::vector<decoded_page> _cache;
+        mutable std::uint64_t _cache_clock;
+        mutable size_type _last_cache_index;
+
+        size_type code_unit_size(void) const noexcept
+        {
+            if (_encoding == mapped_encoding::utf32)
+                return (4);
+            return ((_encoding == mapped_encoding::utf24) ? 3 : 1);
+        }
+
+        bool map(const char* path)
+        {
+#if defined(_WIN32)
+            HANDLE file = ::CreateFileA(
+                path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+            );
+            if (file == INVALID_HANDLE_VALUE)
+                return (false);
+            LARGE_INTEGER file_size;
+            bool is_mapped = (::GetFileSizeEx(file, &file_size) != 0) &&
+                (static_cast<unsigned long long>(file_size.QuadPart) <= static_cast<size_type>(-1));
+            if (is_mapped && (file_size.QuadPart > 0)) {
+                // The view keeps the mapping alive, so both handles can be closed.
+                HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                is_mapped = (mapping != nullptr);
+                if (is_mapped) {
+                    _data = static_cast<const std::uint8_t*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                    _octet_count = static_cast<size_type>(file_size.QuadPart);
+                    is_mapped = (_data != nullptr);
+                    ::CloseHandle(mapping);
+                }
+            }
+            ::CloseHandle(file);
+            return (is_mapped);
+#else // defined(_WIN32)
+            const int descriptor = ::open(path, O_RDONLY);
+            if (descriptor < 0)
+                return (false);
+            struct stat status;
+            bool is_mapped = (::fstat(descriptor, &status) == 0) &&
+                (static_cast<unsigned long long>(status.st_size) <= static_cast<size_type>(-1));
+            if (is_mapped && (status.st_size > 0)) {
+                // The mapping stays valid after the file is closed.
+                const size_type size = static_cast<size_type>(status.st_size);
+                void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                is_mapped = (data != MAP_FAILED);
+                if (is_mapped) {
+                    _data = static_cast<const std::uint8_t*>(data);
+                    _octet_count = size;
+                }
+            }
+            ::close(descriptor);
+            return (is_mapped);
+#endif // defined(_WIN32)
+        }
+
+        void unmap(void) noexcept
+        {
+            if (_data != nullptr) {
+#if defined(_WIN32)
+                ::UnmapViewOfFile(_data);
+#else // defined(_WIN32)
+                ::munmap(const_cast<std::uint8_t*>(_data), _octet_count);
+#endif // defined(_WIN32)
+            }
+            _data = nullptr;
+            _octet_count = 0;
+            _size = 0;
+            _page_offsets.clear();
+            _page_starts.clear();
+            _cache.clear();
+            return;
+        }
+
+        // Counts the code points (and, for UTF-8, validates the text and records the pages).
+        bool build_index(void)
+        {
+            if (_encoding != mapped_encoding::utf8) {
+                _size = _octet_count / this->code_unit_size();
+                return ((_octet_count % this->code_unit_size()) == 0);
+            }
+
+            if (validate_utf8(_data, _octet_count) != _octet_count)
+                return (false);
+            const std::uint8_t* first = _data;
+            const std::uint8_t* last = _data + _octet_count;
+            size_type count = 0;
+            while (first != last) {
+                _page_offsets.push_back(static_cast<size_type>(first - _data));
+                _page_starts.push_back(count);
+                // A new page starts on the first code point after the nominal page size.
+                const std::uint8_t* page_end =
+                    first + (std::min)(_s_mapped_page_size, static_cast<size_type>(last - first));
+                while ((page_end != last) && ((*page_end & 0xC0) == 0x80))
+                    ++page_end;
+                count += count_code_points_utf8(first, static_cast<std::size_t>(page_end - first));
+                first = page_end;
+            }
+            _page_starts.push_back(count);
+            _size = count;
+            return (true);
+        }
+
+        size_type get_page_number(size_type index) const
+        {
+            return (static_cast<size_type>(
+                std::upper_bound(_page_starts.begin(), _page_starts.end() - 1, index) - _page_starts.begin() - 1
+            ));
+        }
+
+        // Gets the decoded page that holds the code point at index, decoding it in place of the least recently used
+        // page if it is not cached.
+        const decoded_page& get_page(size_type index) const
+        {
+            if (_last_cache_index < _cache.size()) {
+                const decoded_page& last_page = _cache[_last_cache_index];
+                if ((index >= _page_starts[last_page.page]) && (index < _page_starts[last_page.page + 1]))
+                    return (last_page);
+            }
+
+            const size_type page_number = this->get_page_number(index);
+            _cache_clock++;
+            size_type victim = 0;
+            for (size_type ctr = 0; ctr < _cache.size(); ctr++) {
+                if (_cache[ctr].page == page_number) {
+                    _cache[ctr].last_use = _cache_clock;
+                    _last_cache_index = ctr;
+                    return (_cache[ctr]);
+                }
+                if (_cache[ctr].last_use < _cache[victim].last_use)
+                    victim = ctr;
+            }
+            if (_cache.size() < _s_mapped_cache_page_count) {
+                victim = _cache.size();
+                _cache.push_back(decoded_page{});
+            }
+
+            decoded_page& page = _cache[victim];
+            page.page = page_number;
+            page.last_use = _cache_clock;
+            page.code_points.resize(_page_starts[page_number + 1] - _page_starts[page_number]);
+            const std::uint8_t* first = _data + _page_offsets[page_number];
+            const std::uint8_t* last = _data + _octet_count;
+            for (char_type& ch : page.code_points) {
+                // Note: The text was validated when it was indexed.
+                std::uint32_t code_point = 0;
+                first += decode_utf8(first, last, code_point);
+                ch = char_type{static_cast<char_type::int_type>(code_point)};
+            }
+            _last_cache_index = victim;
+            return (page);
+        }
+
+        size_type get_octet_offset(size_type index) const
+        {
+            if (_encoding != mapped_encoding::utf8)
+                return (index * this->code_unit_size());
+            if (index == _size)
+                return (_octet_count);
+            const size_type page_number = this->get_page_number(index);
+            const std::uint8_t* data = _data + _page_offsets[page_number];
+            for (size_type count = index - _page_starts[page_number]; count > 0; count--)
+                data += utf8_sequence_size(*data);
+            return (static_cast<size_type>(data - _data));
+        }
+
+        size_type get_index(size_type offset) const
+        {
+            if (_encoding != mapped_encoding::utf8)
+                return (offset / this->code_unit_size());
+            const size_type page_number = static_cast<size_type>(
+                std::upper_bound(_page_offsets.begin(), _page_offsets.end(), offset) - _page_offsets.begin() - 1
+            );
+            size_type result = _page_starts[page_number];
+            for (size_type ctr = _page_offsets[page_number]; ctr < offset; ctr++) {
+                if ((_data[ctr] & 0xC0) != 0x80)
+                    result++;
+            }
+            return (result);
+        }
+
+        // Encodes a text to the encoding of the file. Returns false if the text has invalid code points (which are
+        // never found).
+        bool encode(ustring_view str, std::vector<std::uint8_t>& octets) const
+        {
+            octets.reserve(str.size() * ((_encoding == mapped_encoding::utf8) ? _s_utf8_max_sequence_size : 4));
+            for (char_type ch : str) {
+                if (!ch.is_valid())
+                    return (false);
+                const std::uint32_t code_point = static_cast<std::uint32_t>(ch.code_point());
+                if (_encoding == mapped_encoding::utf8) {
+                    std::uint8_t sequence[_s_utf8_max_sequence_size];
+                    octets.insert(octets.end(), sequence, sequence + encode_utf8(code_point, sequence));
+                    continue;
+                }
+                for (size_type ctr = 0; ctr < this->code_unit_size(); ctr++)
+                    octets.push_back(static_cast<std::uint8_t>(code_point >> (ctr * 8)));
+            }
+            return (true);
+        }
+    }; // class mapped_ustring
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_MAPPED_USTRING_HPP)
@@ -0,0 +1,394 @@
+#if !defined(UNISTRINGXX_NUMERIC_HPP)
+#define UNISTRINGXX_NUMERIC_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "uproperties.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    ///
+    /// The result of from_chars.
+    ///  - ptr: Points to the first code point that is not part of the parsed number (or to the first code point of the
+    ///    input if it does not start with a number).
+    ///  - ec: std::errc() on success, std::errc::invalid_argument if the input does not start with a number, or
+    ///    std::errc::result_out_of_range if the number does not fit in the value type. The value is not modified on
+    ///    errors.
+    ///
+    struct from_chars_result
+    {
+        const uchar_t* ptr;
+        std::errc ec;
+    };
+
+    ///
+    /// The code points accepted as decimal digits by from_chars.
+    ///  - ascii: U+0030 to U+0039 only.
+    ///  - unicode: Any decimal digit (General_Category Nd), e.g. Arabic-Indic, Devanagari or fullwidth digits. Digits
+    ///    of different scripts may be mixed.
+    /// Digits above 9 (for bases greater than 10) are always the ASCII letters.
+    ///
+    enum class digit_set : std::uint8_t
+    {
+        ascii = 0,
+        unicode
+    };
+
+    ///
+    /// The floating point syntaxes accepted by from_chars.
+    ///  - scientific: An exponent is required.
+    ///  - fixed: An exponent is not allowed.
+    ///  - general: An exponent is optional.
+    ///
+    enum class chars_format : std::uint8_t
+    {
+        scientific = 1,
+        fixed = 2,
+        general = 3
+    };
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // Gets the value of a digit in bases up to 36, or a value not less than 36 if the code point is not a digit.
+        inline unsigned int get_digit_value(uchar_t ch, digit_set digits)
+        {
+            const std::uint32_t cp = static_cast<std::uint32_t>(ch.code_point());
+            if ((cp >= 0x30) && (cp <= 0x39))
+                return (cp - 0x30);
+            if ((cp >= 0x61) && (cp <= 0x7A))
+                return (cp - 0x61 + 10);
+            if ((cp >= 0x41) && (cp <= 0x5A))
+                return (cp - 0x41 + 10);
+            if ((cp >= 0x80) && (digits == digit_set::unicode)) {
+                const int value = get_decimal_digit_value(ch);
+                if (value >= 0)
+                    return (static_cast<unsigned int>(value));
+            }
+            return (36);
+        }
+
+        inline bool is_ascii_code_point(uchar_t ch, char value)
+        { return (ch.code_point() == static_cast<std::int_least32_t>(value)); }
+
+        // Matches an ASCII keyword case-insensitively. Returns the end of the match, or first if there is none.
+        inline const uchar_t* match_ascii_keyword(const uchar_t* first, const uchar_t* last, const char* keyword)
+        {
+            const uchar_t* itr = first;
+            for (; *keyword != '\0'; ++itr, ++keyword) {
+                if (itr == last)
+                    return (first);
+                std::int_least32_t cp = itr->code_point();
+                if ((cp >= 0x41) && (cp <= 0x5A))
+                    cp += 0x20;
+                if (cp != static_cast<std::int_least32_t>(*keyword))
+                    return (first);
+            }
+            return (itr);
+        }
+
+        template<typename floatT>
+        struct float_parse_traits;
+
+        // Decimal numbers whose significand and power of ten are both exact in the floating point type are converted
+        // with a single (correctly rounded) multiplication or division.
+        template<>
+        struct float_parse_traits<float>
+        {
+            static constexpr std::uint64_t max_exact_significand = static_cast<std::uint64_t>(1) << 24;
+            static constexpr int max_exact_exponent = 10;
+
+            static float parse(const char* str, char** end)
+            { return (std::strtof(str, end)); }
+        };
+
+        template<>
+        struct float_parse_traits<double>
+        {
+            static constexpr std::uint64_t max_exact_significand = static_cast<std::uint64_t>(1) << 53;
+            static constexpr int max_exact_exponent = 22;
+
+            static double parse(const char* str, char** end)
+            { return (std::strtod(str, end)); }
+        };
+
+        template<>
+        struct float_parse_traits<long double>
+        {
+            // The precision of long double is platform dependent, so it is always parsed with the C library.
+            static constexpr std::uint64_t max_exact_significand = 0;
+            static constexpr int max_exact_exponent = 0;
+
+            static long double parse(const char* str, char** end)
+            { return (std::strtold(str, end)); }
+        };
+
+        const double _s_exact_powers_of_ten[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18,
+            1e19, 1e20, 1e21, 1e22
+        };
+
+        template<typename floatT>
+        inline from_chars_result from_chars_float(
+            const uchar_t* first, const uchar_t* last, floatT& value, chars_format format, digit_set digits
+        )
+        {
+            const uchar_t* itr = first;
+            const bool is_negative = (itr != last) && is_ascii_code_point(*itr, '-');
+            if (is_negative)
+                ++itr;
+
+            // Infinity and NaN.
+            const uchar_t* keyword_end = match_ascii_keyword(itr, last, "inf");
+            if (keyword_end != itr) {
+                const uchar_t* long_keyword_end = match_ascii_keyword(keyword_end, last, "inity");
+                value = is_negative ? -std::numeric_limits<floatT>::infinity() : std::numeric_limits<floatT>::infinity();
+                return (from_chars_result{long_keyword_end, std::errc()});
+            }
+            keyword_end = match_ascii_keyword(itr, last, "nan");
+            if (keyword_end != itr) {
+                // Optional n-char-sequence: "(" [A-Za-z0-9_]* ")"
+                if ((keyword_end != last) && is_ascii_code_point(*keyword_end, '(')) {
+                    const uchar_t* sequence_itr = keyword_end + 1;
+                    while ((sequence_itr != last) &&
+                        ((get_digit_value(*sequence_itr, digit_set::ascii) < 36) ||
+                        is_ascii_code_point(*sequence_itr, '_')))
+                        ++sequence_itr;
+                    if ((sequence_itr != last) && is_ascii_code_point(*sequence_itr, ')'))
+                        keyword_end = sequence_itr + 1;
+                }
+                value = is_negative ? -std::numeric_limits<floatT>::quiet_NaN() :
+                    std::numeric_limits<floatT>::quiet_NaN();
+                return (from_chars_result{keyword_end, std::errc()});
+            }
+
+            // Significand: digits [. digits]. Only the first 19 significant digits are accumulated; the exponent is
+            // that of the last accumulated digit.
+            const std::size_t max_significand_digits = 19;
+            const uchar_t* significand_first = itr;
+            std::uint64_t significand = 0;
+            std::size_t significant_digit_count = 0;
+            std::size_t digit_count = 0;
+            long exponent = 0;
+            bool seen_point = false;
+            for (; itr != last; ++itr) {
+                if (!seen_point && is_ascii_code_point(*itr, '.')) {
+                    seen_point = true;
+                    continue;
+                }
+                const unsigned int digit = get_digit_value(*itr, digits);
+                if (digit >= 10)
+                    break;
+                digit_count++;
+                if ((significant_digit_count == 0) && (digit == 0)) {
+                    // Leading zeros are not significant.
+                    if (seen_point)
+                        exponent--;
+                    continue;
+                }
+                if (significant_digit_count < max_significand_digits) {
+                    significand = (significand * 10) + digit;
+                    if (seen_point)
+                        exponent--;
+                }
+                else if (!seen_point) {
+                    exponent++;
+                }
+                significant_digit_count++;
+            }
+            if (digit_count == 0)
+                return (from_chars_result{first, std::errc::invalid_argument});
+            const uchar_t* significand_last = itr;
+
+            // Exponent: (e|E) [+|-] digits
+            const uchar_t* exponent_itr = itr;
+            long explicit_exponent = 0;
+            bool has_exponent = false;
+            if ((format != chars_format::fixed) && (exponent_itr != last) &&
+                (is_ascii_code_point(*exponent_itr, 'e') || is_ascii_code_point(*exponent_itr, 'E'))) {
+                ++exponent_itr;
+                bool is_exponent_negative = false;
+                if ((exponent_itr != last) &&
+                    (is_ascii_code_point(*exponent_itr, '+') || is_ascii_code_point(*exponent_itr, '-'))) {
+                    is_exponent_negative = is_ascii_code_point(*exponent_itr, '-');
+                    ++exponent_itr;
+                }
+                for (; exponent_itr != last; ++exponent_itr) {
+                    const unsigned int digit = get_digit_value(*exponent_itr, digits);
+                    if (digit >= 10)
+                        break;
+                    has_exponent = true;
+                    // Saturate; such exponents overflow or underflow anyway.
+                    if (explicit_exponent < 100000)
+                        explicit_exponent = (explicit_exponent * 10) + static_cast<long>(digit);
+                }
+                if (is_exponent_negative)
+                    explicit_exponent = -explicit_exponent;
+            }
+            if (!has_exponent && (format == chars_format::scientific))
+                return (from_chars_result{first, std::errc::invalid_argument});
+            if (has_exponent)
+                itr = exponent_itr;
+            else
+                explicit_exponent = 0;
+
+            if (significant_digit_count == 0) {
+                value = is_negative ? -static_cast<floatT>(0) : static_cast<floatT>(0);
+                return (from_chars_result{itr, std::errc()});
+            }
+
+            // Fast path (Clinger): the significand and the power of ten are both exact, so the result of a single
+            // multiplication or division is correctly rounded.
+            typedef float_parse_traits<floatT> traits;
+            const long total_exponent = exponent + explicit_exponent;
+            if ((significant_digit_count <= max_significand_digits) && (significand <= traits::max_exact_significand) &&
+                (total_exponent >= -traits::max_exact_exponent) && (total_exponent <= traits::max_exact_exponent)) {
+                const floatT power = static_cast<floatT>(
+                    _s_exact_powers_of_ten[(total_exponent < 0) ? -total_exponent : total_exponent]
+                );
+                floatT result = static_cast<floatT>(significand);
+                result = (total_exponent < 0) ? (result / power) : (result * power);
+                value = is_negative ? -result : result;
+                return (from_chars_result{itr, std::errc()});
+            }
+
+            // Slow path: all the significant digits are given to the C library as an integer with an exponent, which
+            // is the same in every locale.
+            std::string number;
+            number.reserve(significant_digit_count + 24);
+            number.push_back(is_negative ? '-' : '+');
+            for (const uchar_t* digit_itr = significand_first; digit_itr != significand_last; ++digit_itr) {
+                const unsigned int digit = get_digit_value(*digit_itr, digits);
+                if ((digit < 10) && ((digit != 0) || (number.size() > 1)))
+                    number.push_back(static_cast<char>('0' + digit));
+            }
+            const std::size_t accumulated_digit_count = std::min(significant_digit_count, max_significand_digits);
+            number.push_back('e');
+            number.append(std::to_string(
+                total_exponent - static_cast<long>(significant_digit_count - accumulated_digit_count)
+            ));
+
+            const int saved_errno = errno;
+            errno = 0;
+            char* end = nullptr;
+            const floatT result = traits::parse(number.c_str(), &end);
+            const bool is_out_of_range = (errno == ERANGE) && ((result == 0) ||
+                (result == std::numeric_limits<floatT>::infinity()) ||
+                (result == -std::numeric_limits<floatT>::infinity()));
+            errno = saved_errno;
+            // Subnormal results are reported with ERANGE by some C libraries, but they are representable.
+            if (is_out_of_range)
+                return (from_chars_result{itr, std::errc::result_out_of_range});
+            value = result;
+            return (from_chars_result{itr, std::errc()});
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Parses an integer from a sequence of code points without any conversion or allocation. Same as
+    /// std::from_chars: there is no leading whitespace, '+' sign or base prefix (e.g. "0x"), and a '-' sign is only
+    /// accepted for signed types.
+    /// @param first, last The code points to parse.
+    /// @param value Receives the parsed value.
+    /// @param base The base (2 to 36). Digits above 9 are the ASCII letters (case insensitive).
+    /// @param digits The decimal digits to accept.
+    ///
+    template<typename integerT>
+    inline typename std::enable_if<
+        std::is_integral<integerT>::value && !std::is_same<integerT, bool>::value, from_chars_result
+    >::type from_chars(
+        const uchar_t* first, const uchar_t* last, integerT& value, int base = 10,
+        digit_set digits = digit_set::ascii
+    )
+    {
+        typedef typename std::make_unsigned<integerT>::type unsigned_type;
+
+        if ((base < 2) || (base > 36))
+            return (from_chars_result{first, std::errc::invalid_argument});
+
+        const uchar_t* itr = first;
+        const bool is_negative = std::is_signed<integerT>::value && (itr != last) && is_ascii_code_point(*itr, '-');
+        if (is_negative)
+            ++itr;
+
+        // The magnitude of the most negative value is one more than the maximum.
+        const unsigned_type limit = static_cast<unsigned_type>(std::numeric_limits<integerT>::max()) +
+            (is_negative ? 1 : 0);
+        const unsigned_type unsigned_base = static_cast<unsigned_type>(base);
+        const uchar_t* digits_first = itr;
+        unsigned_type result = 0;
+        bool is_out_of_range = false;
+        for (; itr != last; ++itr) {
+            const unsigned int digit = get_digit_value(*itr, digits);
+            if (digit >= static_cast<unsigned int>(base))
+                break;
+            if (is_out_of_range)
+                continue;
+            if ((result > (limit / unsigned_base)) || ((result * unsigned_base) > (limit - digit)))
+                is_out_of_range = true;
+            else
+                result = static_cast<unsigned_type>((result * unsigned_base) + digit);
+        }
+
+        if (itr == digits_first)
+            return (from_chars_result{first, std::errc::invalid_argument});
+        if (is_out_of_range)
+            return (from_chars_result{itr, std::errc::result_out_of_range});
+
+        value = is_negative ?
+            static_cast<integerT>(static_cast<unsigned_type>(0) - result) : static_cast<integerT>(result);
+        return (from_chars_result{itr, std::errc()});
+    }
+
+    ///
+    /// Parses a floating point number from a sequence of code points. Same as std::from_chars: there is no leading
+    /// whitespace or '+' sign; "inf", "infinity" and "nan" are accepted (case insensitive). The decimal point is
+    /// always '.', regardless of the current locale. The result is correctly rounded.
+    /// @param first, last The code points to parse.
+    /// @param value Receives the parsed value.
+    /// @param format The accepted syntax.
+    /// @param digits The decimal digits to accept.
+    ///
+    template<typename floatT>
+    inline typename std::enable_if<std::is_floating_point<floatT>::value, from_chars_result>::type from_chars(
+        const uchar_t* first, const uchar_t* last, floatT& value, chars_format format = chars_format::general,
+        digit_set digits = digit_set::ascii
+    )
+    { return (from_chars_float(first, last, value, format, digits)); }
+
+    ///
+    /// Parses an integer from the beginning of a text. See from_chars(const uchar_t*, const uchar_t*, integerT&, int,
+    /// digit_set).
+    ///
+    template<typename integerT>
+    inline typename std::enable_if<
+        std::is_integral<integerT>::value && !std::is_same<integerT, bool>::value, from_chars_result
+    >::type from_chars(ustring_view text, integerT& value, int base = 10, digit_set digits = digit_set::ascii)
+    { return (from_chars(text.cbegin(), text.cend(), value, base, digits)); }
+
+    ///
+    /// Parses a floating point number from the beginning of a text. See from_chars(const uchar_t*, const uchar_t*,
+    /// floatT&, chars_format, digit_set).
+    ///
+    template<typename floatT>
+    inline typename std::enable_if<std::is_floating_point<floatT>::value, from_chars_result>::type from_chars(
+        ustring_view text, floatT& value, chars_format format = chars_format::general,
+        digit_set digits = digit_set::ascii
+    )
+    { return (from_chars_float(text.cbegin(), text.cend(), value, format, digits)); }
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_NUMERIC_HPP)
@@ -0,0 +1,244 @@
+#if !defined(UNISTRINGXX_POOL_ALLOCATOR_HPP)
+#define UNISTRINGXX_POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // The size classes are the powers of 2 from 32 to 4096 bytes (i.e. strings of up to about 1365 code points).
+        const std::size_t _s_pool_minimum_size_shift = 5;
+        const std::size_t _s_pool_size_class_count = 8;
+        const std::size_t _s_pool_maximum_size =
+            std::size_t{1} << (_s_pool_minimum_size_shift + _s_pool_size_class_count - 1);
+        // The number of free blocks kept per size class and thread. Blocks beyond this go back to the heap, which
+        // bounds the memory held by a thread that only frees (e.g. the consumer in a producer/consumer setup).
+        const std::size_t _s_pool_cache_limit = 256;
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Thread-local free lists of buffers, by size class. Freed buffers are kept in the free list of the freeing thread
+    /// and reused by the next allocation of the same size class on that thread, so creating and destroying short-lived
+    /// strings in a loop does not go to the heap. Buffers are plain ::operator new memory, so a buffer allocated on one
+    /// thread can be freed on another (it then joins the free list of that thread). The cached buffers are given back
+    /// to the heap when their thread exits.
+    ///
+    class buffer_pool
+    {
+    public:
+        struct statistics
+        {
+            /// The number of allocations served from a free list.
+            std::size_t hits;
+            /// The number of allocations served by the heap (including those larger than the largest size class).
+            std::size_t misses;
+        };
+
+        static void* allocate(std::size_t size)
+        {
+            thread_cache* cache = get_cache();
+            const std::size_t size_class = get_size_class(size);
+            if ((size_class < _s_pool_size_class_count) && (cache != nullptr)) {
+                free_block* block = cache->free_lists[size_class];
+                if (block != nullptr) {
+                    cache->free_lists[size_class] = block->next;
+                    cache->free_counts[size_class]--;
+                    cache->counters.hits++;
+                    return (block);
+                }
+            }
+            if (cache != nullptr)
+                cache->counters.misses++;
+            return (::operator new(get_block_size(size, size_class)));
+        }
+
+        static void deallocate(void* pointer, std::size_t size) noexcept
+        {
+            thread_cache* cache = get_cache();
+            const std::size_t size_class = get_size_class(size);
+            if ((size_class < _s_pool_size_class_count) && (cache != nullptr) &&
+                (cache->free_counts[size_class] < _s_pool_cache_limit)) {
+                free_block* block = static_cast<free_block*>(pointer);
+                block->next = cache->free_lists[size_class];
+                cache->free_lists[size_class] = block;
+                cache->free_counts[size_class]++;
+                return;
+            }
+            ::operator delete(pointer);
+            return;
+        }
+
+        ///
+        /// Gets the counters of the calling thread.
+        ///
+        static statistics thread_statistics(void) noexcept
+        {
+            thread_cache* cache = get_cache();
+            return ((cache == nullptr) ? statistics{0, 0} : cache->counters);
+        }
+
+        static void reset_thread_statistics(void) noexcept
+        {
+            thread_cache* cache = get_cache();
+            if (cache != nullptr)
+                cache->counters = statistics{0, 0};
+            return;
+        }
+
+        ///
+        /// Gives the free buffers of the calling thread back to the heap.
+        ///
+        static void trim(void) noexcept
+        {
+            thread_cache* cache = get_cache();
+            if (cache != nullptr)
+                cache->trim();
+            return;
+        }
+
+    private:
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        struct thread_cache
+        {
+            free_block* free_lists[_s_pool_size_class_count];
+            std::size_t free_counts[_s_pool_size_class_count];
+            statistics counters;
+
+            thread_cache(void) noexcept :
+                free_lists{}, free_counts{}, counters{0, 0}
+            { return; }
+
+            ~thread_cache(void)
+            {
+                this->trim();
+                is_destroyed() = true;
+                return;
+            }
+
+            void trim(void) noexcept
+            {
+                for (std::size_t ctr = 0; ctr < _s_pool_size_class_count; ctr++) {
+                    while (free_lists[ctr] != nullptr) {
+                        free_block* next = free_lists[ctr]->next;
+                        ::operator delete(static_cast<void*>(free_lists[ctr]));
+                        free_lists[ctr] = next;
+                    }
+                    free_counts[ctr] = 0;
+                }
+                return;
+            }
+        };
+
+        // Set when the cache of the thread is destroyed (at thread exit), after which buffers freed by other thread
+        // local destructors go straight to the heap. It is trivially destructible, so it is valid until the end.
+        static bool& is_destroyed(void) noexcept
+        {
+            static thread_local bool result = false;
+            return (result);
+        }
+
+        static thread_cache* get_cache(void) noexcept
+        {
+            if (is_destroyed())
+                return (nullptr);
+            static thread_local thread_cache result;
+            return (&result);
+        }
+
+        static std::size_t get_size_class(std::size_t size) noexcept
+        {
+            if (size > _s_pool_maximum_size)
+                return (_s_pool_size_class_count);
+            std::size_t result = 0;
+            while ((std::size_t{1} << (_s_pool_minimum_size_shift + result)) < size)
+                result++;
+            return (result);
+        }
+
+        static std::size_t get_block_size(std::size_t size, std::size_t size_class) noexcept
+        {
+            if (size_class < _s_pool_size_class_count)
+                return (std::size_t{1} << (_s_pool_minimum_size_shift + size_class));
+            return (size);
+        }
+    }; // class buffer_pool
+
+    ///
+    /// A stateless allocator that allocates from buffer_pool. All instances are equal, so strings using it can be
+    /// moved, swapped and freed across threads freely.
+    ///
+    template<typename valueT>
+    class pool_allocator
+    {
+    public:
+        typedef valueT value_type;
+        typedef valueT* pointer;
+        typedef const valueT* const_pointer;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        typedef std::true_type propagate_on_container_move_assignment;
+        typedef std::true_type is_always_equal;
+
+        template<typename otherT>
+        struct rebind
+        {
+            typedef pool_allocator<otherT> other;
+        };
+
+        pool_allocator(void) noexcept
+        { return; }
+
+        template<typename otherT>
+        pool_allocator(const pool_allocator<otherT>&) noexcept
+        { return; }
+
+        valueT* allocate(size_type count)
+        {
+            static_assert(alignof (valueT) <= alignof (std::max_align_t), "Over-aligned types are not supported.");
+            if (count > (std::numeric_limits<size_type>::max() / sizeof (valueT))) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::length_error, "The 'count' argument would have exceeded the addressable size.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                std::abort();
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            return (static_cast<valueT*>(buffer_pool::allocate(count * sizeof (valueT))));
+        }
+
+        void deallocate(valueT* pointer, size_type count) noexcept
+        {
+            buffer_pool::deallocate(pointer, count * sizeof (valueT));
+            return;
+        }
+
+        template<typename otherT>
+        friend bool operator==(const pool_allocator&, const pool_allocator<otherT>&) noexcept
+        { return (true); }
+
+        template<typename otherT>
+        friend bool operator!=(const pool_allocator&, const pool_allocator<otherT>&) noexcept
+        { return (false); }
+    }; // class pool_allocator
+
+    typedef generic_ustring<pool_allocator<uchar_t_traits::char_type>> pool_ustring;
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_POOL_ALLOCATOR_HPP)
@@ -0,0 +1,548 @@
+#if !defined(UNISTRINGXX_ROPE_HPP)
+#define UNISTRINGXX_ROPE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // Leaves hold at most this many code points. Adjacent leaves are merged when they fit in one.
+        const std::size_t _s_rope_leaf_size = 1024;
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// A text stored as a balanced tree (AVL) of chunks of up to 1024 code points, for large texts that are edited
+    /// often (e.g. documents). insert, erase, replace, split and concatenation are O(log n) (plus the size of a chunk)
+    /// instead of O(n) for ustring, and indexing is O(log n).
+    ///
+    /// The nodes are immutable and shared, so copying a rope is O(1) and copies are independent snapshots (e.g. for an
+    /// undo history). Modifying a rope only rebuilds the O(log n) nodes on the path to the change. A rope can be read
+    /// from several threads, but (like other containers) not modified concurrently.
+    ///
+    class rope
+    {
+    private:
+        // Nodes are immutable once built, so that ropes can share them (snapshots are a pointer copy).
+        struct node
+        {
+            typedef std::shared_ptr<const node> pointer;
+
+            std::size_t size;
+            unsigned int height;
+            pointer left;
+            pointer right;
+            std::vector<uchar_t> text;
+
+            bool is_leaf(void) const noexcept
+            { return (height == 0); }
+        };
+
+        typedef node::pointer node_pointer;
+
+    public:
+        typedef uchar_t_traits traits_type;
+        typedef uchar_t char_type;
+        typedef char_type value_type;
+        typedef const char_type& reference;
+        typedef const char_type& const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        ///
+        /// A random access iterator over the code points of a rope. Moving to the next code point is O(1) within a
+        /// chunk, and O(log n) to the next chunk. Iterators are invalidated when the rope is modified (but iterators of
+        /// a copy of the rope stay valid).
+        ///
+        class const_iterator
+        {
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef uchar_t value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const uchar_t* pointer;
+            typedef const uchar_t& reference;
+
+            const_iterator(void) noexcept :
+                _root{nullptr}, _index{0}, _leaf_data{nullptr}, _leaf_start{0}, _leaf_end{0}
+            { return; }
+
+            reference operator*(void) const
+            {
+                if ((_index < _leaf_start) || (_index >= _leaf_end)) {
+                    const node* leaf = find_leaf(_root, _index, _leaf_start);
+                    _leaf_data = leaf->text.data();
+                    _leaf_end = _leaf_start + leaf->size;
+                }
+                return (_leaf_data[_index - _leaf_start]);
+            }
+
+            pointer operator->(void) const
+            { return (&(**this)); }
+
+            reference operator[](difference_type offset) const
+            { return (*((*this) + offset)); }
+
+            const_iterator& operator++(void) noexcept
+            {
+                _index++;
+                return (*this);
+            }
+
+            const_iterator operator++(int) noexcept
+            {
+                const_iterator result{*this};
+                _index++;
+                return (result);
+            }
+
+            const_iterator& operator--(void) noexcept
+            {
+                _index--;
+                return (*this);
+            }
+
+            const_iterator operator--(int) noexcept
+            {
+                const_iterator result{*this};
+                _index--;
+                return (result);
+            }
+
+            const_iterator& operator+=(difference_type offset) noexcept
+            {
+                _index = static_cast<size_type>(static_cast<difference_type>(_index) + offset);
+                return (*this);
+            }
+
+            const_iterator& operator-=(difference_type offset) noexcept
+            {
+                _index = static_cast<size_type>(static_cast<difference_type>(_index) - offset);
+                return (*this);
+            }
+
+            friend const_iterator operator+(const_iterator itr, difference_type offset) noexcept
+            { return (itr += offset); }
+
+            friend const_iterator operator+(difference_type offset, const_iterator itr) noexcept
+            { return (itr += offset); }
+
+            friend const_iterator operator-(const_iterator itr, difference_type offset) noexcept
+            { return (itr -= offset); }
+
+            friend difference_type operator-(const const_iterator& left, const const_iterator& right) noexcept
+            { return (static_cast<difference_type>(left._index) - static_cast<difference_type>(right._index)); }
+
+            friend bool operator==(const const_iterator& left, const const_iterator& right) noexcept
+            { return (left._index == right._index); }
+
+            friend bool operator!=(const const_iterator& left, const const_iterator& right) noexcept
+            { return (left._index != right._index); }
+
+            friend bool operator<(const const_iterator& left, const const_iterator& right) noexcept
+            { return (left._index < right._index); }
+
+            friend bool operator<=(const const_iterator& left, const const_iterator& right) noexcept
+            { return (left._index <= right._index); }
+
+            friend bool operator>(const const_iterator& left, const const_iterator& right) noexcept
+            { return (left._index > right._index); }
+
+            friend bool operator>=(const const_iterator& left, const const_iterator& right) noexcept
+            { return (left._index >= right._index); }
+
+        private:
+            friend class rope;
+
+            const_iterator(const node* root, size_type index) noexcept :
+                _root{root}, _index{index}, _leaf_data{nullptr}, _leaf_start{0}, _leaf_end{0}
+            { return; }
+
+            const node* _root;
+            size_type _index;
+            // The chunk that contains the last code point read.
+            mutable const uchar_t* _leaf_data;
+            mutable size_type _leaf_start;
+            mutable size_type _leaf_end;
+        }; // class const_iterator
+
+        typedef const_iterator iterator;
+        typedef std::reverse_iterator<const_iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        rope(void) noexcept :
+            _root{}
+        { return; }
+
+        explicit rope(ustring_view text) :
+            _root{build(text.data(), text.data() + text.size())}
+        { return; }
+
+        // UNISTRINGXX_ROPE_ITERATORS
+
+        const_iterator begin(void) const noexcept
+        { return (const_iterator{_root.get(), 0}); }
+
+        const_iterator cbegin(void) const noexcept
+        { return (this->begin()); }
+
+        const_iterator end(void) const noexcept
+        { return (const_iterator{_root.get(), this->size()}); }
+
+        const_iterator cend(void) const noexcept
+        { return (this->end()); }
+
+        const_reverse_iterator rbegin(void) const noexcept
+        { return (const_reverse_iterator{this->end()}); }
+
+        const_reverse_iterator rend(void) const noexcept
+        { return (const_reverse_iterator{this->begin()}); }
+
+        // UNISTRINGXX_ROPE_SIZES
+
+        size_type size(void) const noexcept
+        { return ((_root == nullptr) ? 0 : _root->size); }
+
+        size_type length(void) const noexcept
+        { return (this->size()); }
+
+        bool empty(void) const noexcept
+        { return (_root == nullptr); }
+
+        // UNISTRINGXX_ROPE_ELEMENT_ACCESS
+
+        const_reference operator[](size_type index) const
+        {
+            size_type leaf_start = 0;
+            const node* leaf = find_leaf(_root.get(), index, leaf_start);
+            return (leaf->text[index - leaf_start]);
+        }
+
+        const_reference at(size_type index) const
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index >= this->size())
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            return ((*this)[index]);
+        }
+
+        // UNISTRINGXX_ROPE_OPERATIONS
+
+        void clear(void) noexcept
+        {
+            _root.reset();
+            return;
+        }
+
+        rope& append(ustring_view text)
+        {
+            _root = join(_root, build(text.data(), text.data() + text.size()));
+            return (*this);
+        }
+
+        rope& append(const rope& other)
+        {
+            _root = join(_root, other._root);
+            return (*this);
+        }
+
+        rope& insert(size_type index, ustring_view text)
+        { return (this->insert(index, rope{text})); }
+
+        rope& insert(size_type index, const rope& other)
+        {
+            index = this->check_index(index);
+            std::pair<node_pointer, node_pointer> parts = split_node(_root, index);
+            _root = join(join(parts.first, other._root), parts.second);
+            return (*this);
+        }
+
+        rope& erase(size_type index = 0, size_type count = ustring_view::npos)
+        {
+            index = this->check_index(index);
+            count = std::min(count, this->size() - index);
+            std::pair<node_pointer, node_pointer> head = split_node(_root, index);
+            std::pair<node_pointer, node_pointer> tail = split_node(head.second, count);
+            _root = join(head.first, tail.second);
+            return (*this);
+        }
+
+        rope& replace(size_type index, size_type count, ustring_view text)
+        {
+            index = this->check_index(index);
+            count = std::min(count, this->size() - index);
+            std::pair<node_pointer, node_pointer> head = split_node(_root, index);
+            std::pair<node_pointer, node_pointer> tail = split_node(head.second, count);
+            _root = join(
+                join(head.first, build(text.data(), text.data() + text.size())), tail.second
+            );
+            return (*this);
+        }
+
+        ///
+        /// Gets a part of the rope in O(log n). The result shares its nodes with this rope.
+        ///
+        rope substr(size_type index = 0, size_type count = ustring_view::npos) const
+        {
+            index = this->check_index(index);
+            count = std::min(count, this->size() - index);
+            rope result;
+            result._root = split_node(split_node(_root, index).second, count).first;
+            return (result);
+        }
+
+        ///
+        /// Splits the rope in O(log n) into [0, index) and [index, size()).
+        ///
+        std::pair<rope, rope> split(size_type index) const
+        {
+            index = this->check_index(index);
+            std::pair<node_pointer, node_pointer> parts = split_node(_root, index);
+            std::pair<rope, rope> result;
+            result.first._root = std::move(parts.first);
+            result.second._root = std::move(parts.second);
+            return (result);
+        }
+
+        ///
+        /// Calls function with a ustring_view of each chunk, in order. This is the fastest way to read a rope (e.g. to
+        /// hash it or write it out).
+        ///
+        template<typename functionT>
+        void for_each_chunk(functionT function) const
+        {
+            for_each_leaf(_root.get(), function);
+            return;
+        }
+
+        ustring to_ustring(void) const
+        {
+            ustring result;
+            result.reserve(this->size() + 1);
+            this->for_each_chunk([&result](ustring_view chunk) { result.append(chunk.begin(), chunk.end()); });
+            return (result);
+        }
+
+        size_type find(ustring_view str, size_type index = 0) const
+        {
+            if ((index > this->size()) || (str.size() > (this->size() - index)))
+                return (ustring_view::npos);
+            const const_iterator result = std::search(this->begin() + index, this->end(), str.begin(), str.end());
+            if ((result == this->end()) && !str.empty())
+                return (ustring_view::npos);
+            return (static_cast<size_type>(result - this->begin()));
+        }
+
+        void swap(rope& other) noexcept
+        {
+            _root.swap(other._root);
+            return;
+        }
+
+        friend rope operator+(const rope& left, const rope& right)
+        {
+            rope result{left};
+            result.append(right);
+            return (result);
+        }
+
+        friend bool operator==(const rope& left, const rope& right)
+        {
+            return (
+                (left._root == right._root) ||
+                ((left.size() == right.size()) && std::equal(left.begin(), left.end(), right.begin()))
+            );
+        }
+
+        friend bool operator!=(const rope& left, const rope& right)
+        { return (!(left == right)); }
+
+        friend bool operator==(const rope& left, ustring_view right)
+        { return ((left.size() == right.size()) && std::equal(right.begin(), right.end(), left.begin())); }
+
+        friend bool operator==(ustring_view left, const rope& right)
+        { return (right == left); }
+
+        friend bool operator!=(const rope& left, ustring_view right)
+        { return (!(left == right)); }
+
+        friend bool operator!=(ustring_view left, const rope& right)
+        { return (!(right == left)); }
+
+        friend bool operator<(const rope& left, const rope& right)
+        { return (std::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end())); }
+
+#if (UNISTRINGXX_TEST)
+        unsigned int get_height(void) const
+        { return (node_height(_root)); }
+#endif // (UNISTRINGXX_TEST)
+
+    private:
+        node_pointer _root;
+
+        static unsigned int node_height(const node_pointer& tree) noexcept
+        { return ((tree == nullptr) ? 0 : tree->height); }
+
+        static node_pointer make_leaf(const uchar_t* first, const uchar_t* last)
+        {
+            if (first == last)
+                return (nullptr);
+            std::shared_ptr<node> result = std::make_shared<node>();
+            result->size = static_cast<std::size_t>(last - first);
+            result->height = 0;
+            result->text.assign(first, last);
+            return (result);
+        }
+
+        static node_pointer make_node(node_pointer left, node_pointer right)
+        {
+            std::shared_ptr<node> result = std::make_shared<node>();
+            result->size = left->size + right->size;
+            result->height = std::max(left->height, right->height) + 1;
+            result->left = std::move(left);
+            result->right = std::move(right);
+            return (result);
+        }
+
+        // Builds a node from subtrees whose heights differ by at most 2, with AVL rotations.
+        static node_pointer balance(node_pointer left, node_pointer right)
+        {
+            const unsigned int left_height = left->height;
+            const unsigned int right_height = right->height;
+            if (left_height > (right_height + 1)) {
+                if (node_height(left->left) >= node_height(left->right))
+                    return (make_node(left->left, make_node(left->right, std::move(right))));
+                const node_pointer& middle = left->right;
+                return (make_node(make_node(left->left, middle->left), make_node(middle->right, std::move(right))));
+            }
+            if (right_height > (left_height + 1)) {
+                if (node_height(right->right) >= node_height(right->left))
+                    return (make_node(make_node(std::move(left), right->left), right->right));
+                const node_pointer& middle = right->left;
+                return (make_node(make_node(std::move(left), middle->left), make_node(middle->right, right->right)));
+            }
+            return (make_node(std::move(left), std::move(right)));
+        }
+
+        // Concatenates two trees in O(|height difference| + 1), descending the taller tree's inner edge.
+        static node_pointer join(const node_pointer& left, const node_pointer& right)
+        {
+            if (left == nullptr)
+                return (right);
+            if (right == nullptr)
+                return (left);
+            if (left->height > (right->height + 1))
+                return (balance(left->left, join(left->right, right)));
+            if (right->height > (left->height + 1))
+                return (balance(join(left, right->left), right->right));
+            if (left->is_leaf() && right->is_leaf() && ((left->size + right->size) <= _s_rope_leaf_size)) {
+                std::shared_ptr<node> result = std::make_shared<node>();
+                result->size = left->size + right->size;
+                result->height = 0;
+                result->text.reserve(result->size);
+                result->text.insert(result->text.end(), left->text.begin(), left->text.end());
+                result->text.insert(result->text.end(), right->text.begin(), right->text.end());
+                return (result);
+            }
+            return (balance(left, right));
+        }
+
+        // Splits a tree into [0, index) and [index, size) in O(log n).
+        static std::pair<node_pointer, node_pointer> split_node(const node_pointer& tree, std::size_t index)
+        {
+            if (index == 0)
+                return (std::make_pair(node_pointer{}, tree));
+            if (index >= tree->size)
+                return (std::make_pair(tree, node_pointer{}));
+            if (tree->is_leaf()) {
+                const uchar_t* data = tree->text.data();
+                return (std::make_pair(make_leaf(data, data + index), make_leaf(data + index, data + tree->size)));
+            }
+            const std::size_t left_size = tree->left->size;
+            if (index <= left_size) {
+                std::pair<node_pointer, node_pointer> parts = split_node(tree->left, index);
+                return (std::make_pair(std::move(parts.first), join(parts.second, tree->right)));
+            }
+            std::pair<node_pointer, node_pointer> parts = split_node(tree->right, index - left_size);
+            return (std::make_pair(join(tree->left, parts.first), std::move(parts.second)));
+        }
+
+        // Builds a balanced tree of leaves from a text.
+        static node_pointer build(const uchar_t* first, const uchar_t* last)
+        {
+            const std::size_t size = static_cast<std::size_t>(last - first);
+            if (size <= _s_rope_leaf_size)
+                return (make_leaf(first, last));
+            // Split on a leaf boundary so that the leaves are full.
+            const std::size_t leaf_count = (size + _s_rope_leaf_size - 1) / _s_rope_leaf_size;
+            const std::size_t middle = (leaf_count / 2) * _s_rope_leaf_size;
+            return (make_node(build(first, first + middle), build(first + middle, last)));
+        }
+
+        // Finds the leaf that contains index. leaf_start receives the index of the leaf's first code point.
+        static const node* find_leaf(const node* tree, std::size_t index, std::size_t& leaf_start)
+        {
+            leaf_start = 0;
+            while (!tree->is_leaf()) {
+                if (index < tree->left->size) {
+                    tree = tree->left.get();
+                }
+                else {
+                    index -= tree->left->size;
+                    leaf_start += tree->left->size;
+                    tree = tree->right.get();
+                }
+            }
+            return (tree);
+        }
+
+        template<typename functionT>
+        static void for_each_leaf(const node* tree, functionT& function)
+        {
+            if (tree == nullptr)
+                return;
+            if (tree->is_leaf()) {
+                function(ustring_view{tree->text.data(), tree->text.size()});
+                return;
+            }
+            for_each_leaf(tree->left.get(), function);
+            for_each_leaf(tree->right.get(), function);
+            return;
+        }
+
+        size_type check_index(size_type index) const
+        {
+            if (index > this->size()) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                return (this->size());
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            return (index);
+        }
+    }; // class rope
+
+    inline void swap(rope& left, rope& right) noexcept
+    {
+        left.swap(right);
+        return;
+    }
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_ROPE_HPP)
@@ -0,0 +1,592 @@
+#if !defined(UNISTRINGXX_SERIALIZATION_HPP)
+#define UNISTRINGXX_SERIALIZATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    ///
+    /// The width of the code points written by serialize() and serialize_table():
+    ///  * narrowest: the narrowest width (1, 2 or 3 octets) that fits all of them, for the smallest records.
+    ///  * native: the width of uchar in memory (3 octets, unless UNISTRINGXX_TEST is set), so that
+    ///    serialized_ustring_view::get_view() loads the text without copying it.
+    ///
+    enum class serialized_width
+    {
+        narrowest,
+        native
+    };
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // The layout of the serialized data (all the integers are little endian):
+        //  * header (8 octets): "USX", the kind ('S' for a string, 'T' for a table), the version, the width of the code
+        //    points (1, 2 or 3 octets, or 4 for the native width of test builds), and 2 reserved octets (0).
+        //  * string: the number of code points (32 bits), followed by the code points.
+        //  * table: the number of strings N (32 bits), N + 1 offsets (32 bits, in code points, the first one being 0)
+        //    and the code points of all the strings.
+        // Each record is padded (with 0) to a multiple of 4 octets, so records can be concatenated and their integers
+        // stay aligned.
+        const std::uint8_t _s_serialized_magic[] = {'U', 'S', 'X'};
+        const std::uint8_t _s_serialized_string_kind = 'S';
+        const std::uint8_t _s_serialized_table_kind = 'T';
+        const std::uint8_t _s_serialized_version = 1;
+        const std::size_t _s_serialized_header_size = 8;
+        const std::size_t _s_serialized_alignment = 4;
+
+        inline std::uint32_t read_little_endian(const std::uint8_t* data, std::size_t width) noexcept
+        {
+            std::uint32_t result = 0;
+            for (std::size_t ctr = 0; ctr < width; ctr++)
+                result |= static_cast<std::uint32_t>(data[ctr]) << (ctr * 8);
+            return (result);
+        }
+
+        inline void write_little_endian(std::vector<std::uint8_t>& out, std::uint32_t value, std::size_t width)
+        {
+            for (std::size_t ctr = 0; ctr < width; ctr++)
+                out.push_back(static_cast<std::uint8_t>(value >> (ctr * 8)));
+            return;
+        }
+
+        // Gets the value stored for a code point (an invalid code point keeps its low 24 bits, like uint24_t).
+        inline std::uint32_t get_serialized_value(uchar_t ch) noexcept
+        { return (static_cast<std::uint32_t>(ch.code_point()) & 0xFFFFFF); }
+
+        inline std::size_t get_serialized_width(const uchar_t* data, std::size_t size, serialized_width mode) noexcept
+        {
+            if (mode == serialized_width::native)
+                return (sizeof (uchar_t));
+            std::uint32_t maximum = 0;
+            for (std::size_t ctr = 0; ctr < size; ctr++)
+                maximum |= get_serialized_value(data[ctr]);
+            if (maximum <= 0xFF)
+                return (1);
+            return ((maximum <= 0xFFFF) ? 2 : 3);
+        }
+
+        inline std::uint32_t get_serialized_count(std::size_t count)
+        {
+            if (static_cast<std::uint64_t>(count) > 0xFFFFFFFF) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::length_error, "The text is too large to be serialized.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                std::abort();
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            return (static_cast<std::uint32_t>(count));
+        }
+
+        inline void write_serialized_header(std::vector<std::uint8_t>& out, std::uint8_t kind, std::size_t width)
+        {
+            out.insert(out.end(), std::begin(_s_serialized_magic), std::end(_s_serialized_magic));
+            out.push_back(kind);
+            out.push_back(_s_serialized_version);
+            out.push_back(static_cast<std::uint8_t>(width));
+            out.push_back(0);
+            out.push_back(0);
+            return;
+        }
+
+        // Checks whether the code points of a record are stored like uchar in memory.
+        inline bool is_native_serialized_width(std::size_t width) noexcept
+        { return ((width == sizeof (uchar_t)) && ((sizeof (uchar_t) == 3) || !UNISTRINGXX_IS_BIG_ENDIAN)); }
+
+        inline void write_serialized_code_points(
+            std::vector<std::uint8_t>& out, const uchar_t* data, std::size_t size, std::size_t width
+        )
+        {
+            if (is_native_serialized_width(width)) {
+                const std::uint8_t* octets = reinterpret_cast<const std::uint8_t*>(data);
+                out.insert(out.end(), octets, octets + (size * sizeof (uchar_t)));
+                return;
+            }
+            for (std::size_t ctr = 0; ctr < size; ctr++)
+                write_little_endian(out, get_serialized_value(data[ctr]), width);
+            return;
+        }
+
+        inline void write_serialized_padding(std::vector<std::uint8_t>& out, std::size_t record_start)
+        {
+            while (((out.size() - record_start) % _s_serialized_alignment) != 0)
+                out.push_back(0);
+            return;
+        }
+
+        // Checks the header and the fixed part of a record (the header and a 32-bit count), and gets the width.
+        inline bool read_serialized_header(
+            const std::uint8_t* data, std::size_t size, std::uint8_t kind, std::size_t& width, std::uint32_t& count
+        ) noexcept
+        {
+            if ((data == nullptr) || (size < (_s_serialized_header_size + 4)))
+                return (false);
+            if (
+                (data[0] != _s_serialized_magic[0]) || (data[1] != _s_serialized_magic[1]) ||
+                (data[2] != _s_serialized_magic[2]) || (data[3] != kind) || (data[4] != _s_serialized_version) ||
+                (data[5] < 1) || (data[5] > 4) || (data[6] != 0) || (data[7] != 0)
+            )
+                return (false);
+            width = data[5];
+            count = read_little_endian(data + _s_serialized_header_size, 4);
+            return (true);
+        }
+
+        // Gets the size of a record from the size of its content, or 0 if it does not fit in the available octets.
+        inline std::size_t get_serialized_record_size(std::uint64_t content_size, std::size_t available) noexcept
+        {
+            const std::uint64_t mask = _s_serialized_alignment - 1;
+            const std::uint64_t record_size = (content_size + mask) & ~mask;
+            return ((record_size <= available) ? static_cast<std::size_t>(record_size) : 0);
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Appends a string to out in the binary format of unistringxx: a versioned, length-prefixed record that stores
+    /// the code points with the width given by mode, and that is loaded by serialized_ustring_view without copying.
+    /// Throws std::length_error if the string has 2^32 code points or more.
+    /// @returns The size of the record.
+    ///
+    inline std::size_t serialize(
+        ustring_view str, std::vector<std::uint8_t>& out, serialized_width mode = serialized_width::narrowest
+    )
+    {
+        const std::size_t record_start = out.size();
+        const std::uint32_t count = get_serialized_count(str.size());
+        const std::size_t width = get_serialized_width(str.data(), str.size(), mode);
+        out.reserve(record_start + _s_serialized_header_size + 4 + (str.size() * width) + _s_serialized_alignment);
+        write_serialized_header(out, _s_serialized_string_kind, width);
+        write_little_endian(out, count, 4);
+        write_serialized_code_points(out, str.data(), str.size(), width);
+        write_serialized_padding(out, record_start);
+        return (out.size() - record_start);
+    }
+
+    ///
+    /// Appends a table of strings (each element of [first, last) must convert to ustring_view) to out, with an array
+    /// of offsets to access any string in constant time. All the code points share the width given by mode. Throws
+    /// std::length_error if the table has 2^32 code points or more in total.
+    /// @returns The size of the record.
+    ///
+    template<typename forwardIterT>
+    inline std::size_t serialize_table(
+        forwardIterT first, forwardIterT last, std::vector<std::uint8_t>& out,
+        serialized_width mode = serialized_width::narrowest
+    )
+    {
+        std::size_t count = 0;
+        std::size_t total_size = 0;
+        std::size_t width = get_serialized_width(nullptr, 0, mode);
+        for (forwardIterT itr = first; itr != last; ++itr) {
+            const ustring_view str{*itr};
+            const std::size_t str_width = get_serialized_width(str.data(), str.size(), mode);
+            width = (str_width > width) ? str_width : width;
+            total_size += str.size();
+            count++;
+        }
+        get_serialized_count(total_size);
+
+        const std::size_t record_start = out.size();
+        out.reserve(
+            record_start + _s_serialized_header_size + ((count + 2) * 4) + (total_size * width) +
+            _s_serialized_alignment
+        );
+        write_serialized_header(out, _s_serialized_table_kind, width);
+        write_little_endian(out, get_serialized_count(count), 4);
+        std::uint32_t offset = 0;
+        write_little_endian(out, offset, 4);
+        for (forwardIterT itr = first; itr != last; ++itr) {
+            offset += static_cast<std::uint32_t>(ustring_view{*itr}.size());
+            write_little_endian(out, offset, 4);
+        }
+        for (forwardIterT itr = first; itr != last; ++itr) {
+            const ustring_view str{*itr};
+            write_serialized_code_points(out, str.data(), str.size(), width);
+        }
+        write_serialized_padding(out, record_start);
+        return (out.size() - record_start);
+    }
+
+    ///
+    /// A read-only view of a string serialized by serialize(), over the serialized octets (e.g. a buffer received from
+    /// the network, or a mapped file), which must outlive the view. The code points are read in place and returned by
+    /// value.
+    ///
+    class serialized_ustring_view
+    {
+    public:
+        typedef uchar_t char_type;
+        typedef char_type value_type;
+        typedef char_type reference;
+        typedef char_type const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+    private:
+        class serialized_iterator
+        {
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef uchar_t value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const uchar_t* pointer;
+            typedef uchar_t reference;
+
+            serialized_iterator(void) noexcept :
+                _data{nullptr}, _width{1}
+            { return; }
+
+            serialized_iterator(const std::uint8_t* data, size_type width) noexcept :
+                _data{data}, _width{width}
+            { return; }
+
+            reference operator*(void) const noexcept
+            { return (uchar_t{static_cast<uchar_t::int_type>(read_little_endian(_data, _width))}); }
+
+            reference operator[](difference_type offset) const noexcept
+            { return (*(*this + offset)); }
+
+            serialized_iterator& operator++(void) noexcept
+            {
+                _data += _width;
+                return (*this);
+            }
+
+            serialized_iterator operator++(int) noexcept
+            {
+                serialized_iterator result{*this};
+                _data += _width;
+                return (result);
+            }
+
+            serialized_iterator& operator--(void) noexcept
+            {
+                _data -= _width;
+                return (*this);
+            }
+
+            serialized_iterator operator--(int) noexcept
+            {
+                serialized_iterator result{*this};
+                _data -= _width;
+                return (result);
+            }
+
+            serialized_iterator& operator+=(difference_type offset) noexcept
+            {
+                _data += offset * static_cast<difference_type>(_width);
+                return (*this);
+            }
+
+            serialized_iterator& operator-=(difference_type offset) noexcept
+            {
+                _data -= offset * static_cast<difference_type>(_width);
+                return (*this);
+            }
+
+            friend serialized_iterator operator+(serialized_iterator itr, difference_type offset) noexcept
+            { return (itr += offset); }
+
+            friend serialized_iterator operator+(difference_type offset, serialized_iterator itr) noexcept
+            { return (itr += offset); }
+
+            friend serialized_iterator operator-(serialized_iterator itr, difference_type offset) noexcept
+            { return (itr -= offset); }
+
+            friend difference_type operator-(const serialized_iterator& left, const serialized_iterator& right) noexcept
+            { return ((left._data - right._data) / static_cast<difference_type>(left._width)); }
+
+            friend bool operator==(const serialized_iterator& left, const serialized_iterator& right) noexcept
+            { return (left._data == right._data); }
+
+            friend bool operator!=(const serialized_iterator& left, const serialized_iterator& right) noexcept
+            { return (left._data != right._data); }
+
+            friend bool operator<(const serialized_iterator& left, const serialized_iterator& right) noexcept
+            { return (left._data < right._data); }
+
+            friend bool operator<=(const serialized_iterator& left, const serialized_iterator& right) noexcept
+            { return (left._data <= right._data); }
+
+            friend bool operator>(const serialized_iterator& left, const serialized_iterator& right) noexcept
+            { return (left._data > right._data); }
+
+            friend bool operator>=(const serialized_iterator& left, const serialized_iterator& right) noexcept
+            { return (left._data >= right._data); }
+
+        private:
+            const std::uint8_t* _data;
+            size_type _width;
+        }; // class serialized_iterator
+
+    public:
+        typedef serialized_iterator iterator;
+        typedef serialized_iterator const_iterator;
+        typedef std::reverse_iterator<const_iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        serialized_ustring_view(void) noexcept :
+            _data{nullptr}, _size{0}, _width{1}, _record_size{0}
+        { return; }
+
+        ///
+        /// Loads the string record at the start of [data, data + size). Every field is checked against the available
+        /// octets, so truncated or corrupted input throws std::range_error (or, without exceptions, gives an empty
+        /// view whose record_size() is 0).
+        ///
+        serialized_ustring_view(const void* data, size_type size) :
+            serialized_ustring_view{}
+        {
+            const std::uint8_t* octets = static_cast<const std::uint8_t*>(data);
+            std::uint32_t count = 0;
+            size_type width = 1;
+            size_type record_size = 0;
+            if (read_serialized_header(octets, size, _s_serialized_string_kind, width, count)) {
+                const std::uint64_t content_size = _s_serialized_header_size + 4 + (std::uint64_t{count} * width);
+                record_size = get_serialized_record_size(content_size, size);
+            }
+            if (record_size == 0) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::range_error, "The serialized data is invalid or truncated.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                return;
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            _data = octets + _s_serialized_header_size + 4;
+            _size = count;
+            _width = width;
+            _record_size = record_size;
+            return;
+        }
+
+        ///
+        /// Gets the number of octets of the record (including its padding), i.e. the offset of the next record.
+        ///
+        size_type record_size(void) const noexcept
+        { return (_record_size); }
+
+        ///
+        /// Gets the number of octets of each code point (1, 2 or 3, or 4 for the native width of test builds).
+        ///
+        size_type width(void) const noexcept
+        { return (_width); }
+
+        ///
+        /// Gets the text as a ustring_view, without copying it, when the code points are stored like uchar in memory
+        /// (i.e. the record was written with serialized_width::native). The text may have invalid code points.
+        /// @returns false (and leaves view unchanged) when the width of the record differs.
+        ///
+        bool get_view(ustring_view& view) const noexcept
+        {
+            if (!is_native_serialized_width(_width))
+                return (false);
+            view = ustring_view{reinterpret_cast<const uchar_t*>(_data), _size};
+            return (true);
+        }
+
+        ustring to_ustring(void) const
+        {
+            ustring result(_size, uchar_t::null_char());
+            for (size_type ctr = 0; ctr < _size; ctr++)
+                result[ctr] = (*this)[ctr];
+            return (result);
+        }
+
+        // UNISTRINGXX_SERIALIZED_USTRING_VIEW_ITERATORS
+
+        const_iterator begin(void) const noexcept
+        { return (const_iterator{_data, _width}); }
+
+        const_iterator cbegin(void) const noexcept
+        { return (const_iterator{_data, _width}); }
+
+        const_iterator end(void) const noexcept
+        { return (const_iterator{_data + (_size * _width), _width}); }
+
+        const_iterator cend(void) const noexcept
+        { return (this->end()); }
+
+        const_reverse_iterator rbegin(void) const noexcept
+        { return (const_reverse_iterator{this->cend()}); }
+
+        const_reverse_iterator crbegin(void) const noexcept
+        { return (const_reverse_iterator{this->cend()}); }
+
+        const_reverse_iterator rend(void) const noexcept
+        { return (const_reverse_iterator{this->cbegin()}); }
+
+        const_reverse_iterator crend(void) const noexcept
+        { return (const_reverse_iterator{this->cbegin()}); }
+
+        // UNISTRINGXX_SERIALIZED_USTRING_VIEW_SIZES
+
+        size_type size(void) const noexcept
+        { return (_size); }
+
+        size_type length(void) const noexcept
+        { return (_size); }
+
+        bool empty(void) const noexcept
+        { return (_size == 0); }
+
+        // UNISTRINGXX_SERIALIZED_USTRING_VIEW_ELEMENT_ACCESS
+
+        const_reference operator[](size_type index) const noexcept
+        { return (uchar_t{static_cast<uchar_t::int_type>(read_little_endian(_data + (index * _width), _width))}); }
+
+        const_reference at(size_type index) const
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index >= this->size())
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            return ((*this)[index]);
+        }
+
+        // UNISTRINGXX_SERIALIZED_USTRING_VIEW_OPERATIONS
+
+        int compare(ustring_view str) const noexcept
+        {
+            const size_type count = (_size < str.size()) ? _size : str.size();
+            for (size_type ctr = 0; ctr < count; ctr++) {
+                const char_type ch = (*this)[ctr];
+                if (ch != str[ctr])
+                    return ((ch < str[ctr]) ? -1 : 1);
+            }
+            if (_size == str.size())
+                return (0);
+            return ((_size < str.size()) ? -1 : 1);
+        }
+
+        friend bool operator==(const serialized_ustring_view& left, ustring_view right) noexcept
+        { return ((left.size() == right.size()) && (left.compare(right) == 0)); }
+
+        friend bool operator==(ustring_view left, const serialized_ustring_view& right) noexcept
+        { return (right == left); }
+
+        friend bool operator!=(const serialized_ustring_view& left, ustring_view right) noexcept
+        { return (!(left == right)); }
+
+        friend bool operator!=(ustring_view left, const serialized_ustring_view& right) noexcept
+        { return (!(right == left)); }
+
+    private:
+        friend class serialized_table_view;
+
+        const std::uint8_t* _data;
+        size_type _size;
+        size_type _width;
+        size_type _record_size;
+    }; // class serialized_ustring_view
+
+    ///
+    /// A read-only view of a table serialized by serialize_table(), over the serialized octets, which must outlive the
+    /// view. The strings are accessed in constant time through the offsets array of the table.
+    ///
+    class serialized_table_view
+    {
+    public:
+        typedef serialized_ustring_view value_type;
+        typedef std::size_t size_type;
+
+        serialized_table_view(void) noexcept :
+            _offsets{nullptr}, _data{nullptr}, _size{0}, _width{1}, _record_size{0}
+        { return; }
+
+        ///
+        /// Loads the table record at the start of [data, data + size). The offsets must start at 0, never decrease and
+        /// stay within the record, so truncated or corrupted input throws std::range_error (or, without exceptions,
+        /// gives an empty view whose record_size() is 0).
+        ///
+        serialized_table_view(const void* data, size_type size) :
+            serialized_table_view{}
+        {
+            const std::uint8_t* octets = static_cast<const std::uint8_t*>(data);
+            std::uint32_t count = 0;
+            size_type width = 1;
+            size_type record_size = 0;
+            if (read_serialized_header(octets, size, _s_serialized_table_kind, width, count)) {
+                const std::uint64_t offsets_end = _s_serialized_header_size + 4 + ((std::uint64_t{count} + 1) * 4);
+                if (offsets_end <= size) {
+                    const std::uint8_t* offsets = octets + _s_serialized_header_size + 4;
+                    std::uint32_t previous = 0;
+                    bool is_valid = (read_little_endian(offsets, 4) == 0);
+                    for (size_type ctr = 1; is_valid && (ctr <= count); ctr++) {
+                        const std::uint32_t offset = read_little_endian(offsets + (ctr * 4), 4);
+                        is_valid = (offset >= previous);
+                        previous = offset;
+                    }
+                    if (is_valid)
+                        record_size = get_serialized_record_size(offsets_end + (std::uint64_t{previous} * width), size);
+                }
+            }
+            if (record_size == 0) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::range_error, "The serialized data is invalid or truncated.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                return;
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            _offsets = octets + _s_serialized_header_size + 4;
+            _data = _offsets + ((size_type{count} + 1) * 4);
+            _size = count;
+            _width = width;
+            _record_size = record_size;
+            return;
+        }
+
+        size_type record_size(void) const noexcept
+        { return (_record_size); }
+
+        size_type width(void) const noexcept
+        { return (_width); }
+
+        size_type size(void) const noexcept
+        { return (_size); }
+
+        bool empty(void) const noexcept
+        { return (_size == 0); }
+
+        value_type operator[](size_type index) const noexcept
+        {
+            const size_type first = read_little_endian(_offsets + (index * 4), 4);
+            const size_type last = read_little_endian(_offsets + ((index + 1) * 4), 4);
+            value_type result;
+            result._data = _data + (first * _width);
+            result._size = last - first;
+            result._width = _width;
+            return (result);
+        }
+
+        value_type at(size_type index) const
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index >= this->size())
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            return ((*this)[index]);
+        }
+
+    private:
+        const std::uint8_t* _offsets;
+        const std::uint8_t* _data;
+        size_type _size;
+        size_type _width;
+        size_type _record_size;
+    }; // class serialized_table_view
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_SERIALIZATION_HPP)
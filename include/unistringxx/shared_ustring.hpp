@@ -0,0 +1,357 @@
+#if !defined(UNISTRINGXX_SHARED_USTRING_HPP)
+#define UNISTRINGXX_SHARED_USTRING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "common.hpp"
+#include "hash.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    ///
+    /// An immutable text with shared ownership. Copies share the same buffer (an atomic reference count, like
+    /// std::shared_ptr), and substr() returns a slice of the same buffer, so copying and slicing are O(1) and never
+    /// allocate. The text is never modified after construction, so shared_ustring objects can be handed to other
+    /// threads freely (but, like std::shared_ptr, a single shared_ustring object must not be modified concurrently).
+    /// Use mutable_copy() to get a ustring to modify.
+    ///
+    /// A slice keeps the whole buffer alive. Use compact() when a small slice outlives a large text.
+    ///
+    /// The search functions return ustring_view::npos when there is no match.
+    ///
+    class shared_ustring
+    {
+    public:
+        typedef uchar_t_traits traits_type;
+        typedef uchar_t char_type;
+        typedef char_type value_type;
+
+        typedef const char_type* pointer;
+        typedef const char_type* const_pointer;
+        typedef const char_type& reference;
+        typedef const char_type& const_reference;
+
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const char_type* iterator;
+        typedef const char_type* const_iterator;
+        typedef std::reverse_iterator<const_iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        shared_ustring(void) noexcept :
+            _block{nullptr}, _data{nullptr}, _size{0}
+        { return; }
+
+        ///
+        /// Copies a text into a new shared buffer.
+        ///
+        explicit shared_ustring(ustring_view text) :
+            shared_ustring{ustring{text.data(), text.size()}}
+        { return; }
+
+        ///
+        /// Takes the buffer of a ustring (without copying the text).
+        ///
+        explicit shared_ustring(ustring&& str) :
+            shared_ustring{}
+        {
+            if (str.empty())
+                return;
+            _block = new shared_block{};
+            _block->text.swap(str);
+            _data = _block->text.data();
+            _size = _block->text.size();
+            return;
+        }
+
+        shared_ustring(const shared_ustring& other) noexcept :
+            _block{other._block}, _data{other._data}, _size{other._size}
+        {
+            if (_block != nullptr)
+                _block->reference_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        shared_ustring(shared_ustring&& other) noexcept :
+            _block{other._block}, _data{other._data}, _size{other._size}
+        {
+            other._block = nullptr;
+            other._data = nullptr;
+            other._size = 0;
+            return;
+        }
+
+        ~shared_ustring(void)
+        {
+            this->release();
+            return;
+        }
+
+        shared_ustring& operator=(const shared_ustring& other) noexcept
+        {
+            shared_ustring{other}.swap(*this);
+            return (*this);
+        }
+
+        shared_ustring& operator=(shared_ustring&& other) noexcept
+        {
+            shared_ustring{std::move(other)}.swap(*this);
+            return (*this);
+        }
+
+        operator ustring_view(void) const noexcept
+        { return (ustring_view{_data, _size}); }
+
+        ustring_view view(void) const noexcept
+        { return (ustring_view{_data, _size}); }
+
+        ///
+        /// Copies the text to a ustring.
+        ///
+        ustring mutable_copy(void) const &
+        { return (ustring{_data, _size}); }
+
+        ///
+        /// Gets the text as a ustring. If this object is the only owner of its buffer, the buffer is taken over instead
+        /// of copied (copy-on-write). This object is empty afterwards.
+        ///
+        ustring mutable_copy(void) &&
+        {
+            ustring result;
+            if ((_block == nullptr) || (_block->reference_count.load(std::memory_order_acquire) != 1)) {
+                ustring{_data, _size}.swap(result);
+                this->release();
+                return (result);
+            }
+
+            ustring& text = _block->text;
+            if ((_data != text.data()) || (_size != text.size())) {
+                // A slice: only keep the sliced part.
+                const size_type index = static_cast<size_type>(_data - text.data());
+                text.erase(index + _size);
+                text.erase(0, index);
+            }
+            result.swap(text);
+            this->release();
+            return (result);
+        }
+
+        ///
+        /// Copies a slice to its own buffer (so that it no longer keeps a larger buffer alive).
+        ///
+        void compact(void)
+        {
+            if ((_block != nullptr) && ((_data != _block->text.data()) || (_size != _block->text.size())))
+                shared_ustring{this->view()}.swap(*this);
+            return;
+        }
+
+        ///
+        /// Gets the number of shared_ustring objects that share this buffer (0 for an empty default constructed
+        /// object).
+        ///
+        long use_count(void) const noexcept
+        {
+            return (
+                (_block == nullptr) ? 0 : static_cast<long>(_block->reference_count.load(std::memory_order_relaxed))
+            );
+        }
+
+        // UNISTRINGXX_SHARED_USTRING_ITERATORS
+
+        const_iterator begin(void) const noexcept
+        { return (_data); }
+
+        const_iterator cbegin(void) const noexcept
+        { return (_data); }
+
+        const_iterator end(void) const noexcept
+        { return (_data + _size); }
+
+        const_iterator cend(void) const noexcept
+        { return (_data + _size); }
+
+        const_reverse_iterator rbegin(void) const noexcept
+        { return (const_reverse_iterator{this->cend()}); }
+
+        const_reverse_iterator crbegin(void) const noexcept
+        { return (const_reverse_iterator{this->cend()}); }
+
+        const_reverse_iterator rend(void) const noexcept
+        { return (const_reverse_iterator{this->cbegin()}); }
+
+        const_reverse_iterator crend(void) const noexcept
+        { return (const_reverse_iterator{this->cbegin()}); }
+
+        // UNISTRINGXX_SHARED_USTRING_SIZES
+
+        size_type size(void) const noexcept
+        { return (_size); }
+
+        size_type length(void) const noexcept
+        { return (_size); }
+
+        bool empty(void) const noexcept
+        { return (_size == 0); }
+
+        // UNISTRINGXX_SHARED_USTRING_ELEMENT_ACCESS
+
+        const_reference operator[](size_type index) const
+        { return (_data[index]); }
+
+        const_reference at(size_type index) const
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index >= this->size())
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            return (_data[index]);
+        }
+
+        const_reference front(void) const
+        { return (_data[0]); }
+
+        const_reference back(void) const
+        { return (_data[_size - 1]); }
+
+        // Note: Slices are not null terminated, so there is no c_str().
+        const_pointer data(void) const noexcept
+        { return (_data); }
+
+        // UNISTRINGXX_SHARED_USTRING_OPERATIONS
+
+        ///
+        /// Gets a slice that shares this buffer.
+        ///
+        shared_ustring substr(size_type index = 0, size_type count = ustring_view::npos) const
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index > this->size())
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index > this->size())
+                return (shared_ustring{});
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            shared_ustring result{*this};
+            result._data += index;
+            result._size = std::min(count, this->size() - index);
+            return (result);
+        }
+
+        int compare(ustring_view str) const noexcept
+        { return (this->view().compare(str)); }
+
+        size_type find(ustring_view str, size_type index = 0) const noexcept
+        { return (this->view().find(str, index)); }
+
+        size_type find(char_type ch, size_type index = 0) const noexcept
+        { return (this->view().find(ch, index)); }
+
+        size_type rfind(ustring_view str, size_type index = ustring_view::npos) const noexcept
+        { return (this->view().rfind(str, index)); }
+
+        size_type rfind(char_type ch, size_type index = ustring_view::npos) const noexcept
+        { return (this->view().rfind(ch, index)); }
+
+        void swap(shared_ustring& other) noexcept
+        {
+            std::swap(_block, other._block);
+            std::swap(_data, other._data);
+            std::swap(_size, other._size);
+            return;
+        }
+
+        friend bool operator==(const shared_ustring& left, const shared_ustring& right) noexcept
+        {
+            // Copies of the same text compare without reading it.
+            return (
+                (left._size == right._size) &&
+                ((left._data == right._data) || code_points_equal(left._data, right._data, left._size))
+            );
+        }
+
+        friend bool operator!=(const shared_ustring& left, const shared_ustring& right) noexcept
+        { return (!(left == right)); }
+
+        friend bool operator<(const shared_ustring& left, const shared_ustring& right) noexcept
+        { return (left.compare(right) < 0); }
+
+        friend bool operator<=(const shared_ustring& left, const shared_ustring& right) noexcept
+        { return (left.compare(right) <= 0); }
+
+        friend bool operator>(const shared_ustring& left, const shared_ustring& right) noexcept
+        { return (left.compare(right) > 0); }
+
+        friend bool operator>=(const shared_ustring& left, const shared_ustring& right) noexcept
+        { return (left.compare(right) >= 0); }
+
+        friend bool operator==(const shared_ustring& left, ustring_view right) noexcept
+        { return (left.view() == right); }
+
+        friend bool operator==(ustring_view left, const shared_ustring& right) noexcept
+        { return (left == right.view()); }
+
+        friend bool operator!=(const shared_ustring& left, ustring_view right) noexcept
+        { return (left.view() != right); }
+
+        friend bool operator!=(ustring_view left, const shared_ustring& right) noexcept
+        { return (left != right.view()); }
+
+    private:
+        struct shared_block
+        {
+            shared_block(void) :
+                reference_count{1}, text{}
+            { return; }
+
+            std::atomic<std::size_t> reference_count;
+            ustring text;
+        };
+
+        shared_block* _block;
+        const char_type* _data;
+        size_type _size;
+
+        void release(void) noexcept
+        {
+            if ((_block != nullptr) && (_block->reference_count.fetch_sub(1, std::memory_order_acq_rel) == 1))
+                delete _block;
+            _block = nullptr;
+            _data = nullptr;
+            _size = 0;
+            return;
+        }
+    }; // class shared_ustring
+
+    inline void swap(shared_ustring& left, shared_ustring& right) noexcept
+    {
+        left.swap(right);
+        return;
+    }
+
+} // namespace unistringxx
+
+namespace std
+{
+    // specialization of std::hash
+    template<>
+    struct hash<unistringxx::shared_ustring>
+    {
+        typedef std::size_t result_type;
+        typedef unistringxx::shared_ustring argument_type;
+
+        result_type operator()(const argument_type& key) const noexcept
+        { return (static_cast<result_type>(unistringxx::hash_code_points(key.data(), key.size()))); }
+    };
+} // namespace std
+
+#endif // !defined(UNISTRINGXX_SHARED_USTRING_HPP)
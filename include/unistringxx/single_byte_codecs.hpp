@@ -0,0 +1,94 @@
+#if !defined(UNISTRINGXX_SINGLE_BYTE_CODECS_HPP)
+#define UNISTRINGXX_SINGLE_BYTE_CODECS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "codec.hpp"
+#include "common.hpp"
+#include "single_byte_tables.hpp"
+#include "uchar.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // The character sets of single_byte_tables.hpp all map 0x00..0x7F to ASCII. Their tables hold the upper half:
+        // the code point of each octet 0x80..0xFF (0 if the octet is not defined), and the reverse mapping sorted by
+        // code point.
+        struct single_byte_charset
+        {
+            const std::uint16_t* decode_table;
+            const std::uint16_t* encode_code_points;
+            const std::uint8_t* encode_octets;
+            std::size_t encode_size;
+        };
+
+        // Widens 16 ASCII octets to code points.
+        inline void widen_ascii_block(const std::uint8_t* data, uchar_t* out) noexcept
+        {
+#if (UNISTRINGXX_HAS_SSE2)
+            store_ascii_block(out, data);
+#else // (UNISTRINGXX_HAS_SSE2)
+            for (std::size_t ctr = 0; ctr < 16; ctr++)
+                out[ctr] = uchar_t{static_cast<uchar_t::int_type>(data[ctr])};
+#endif // (UNISTRINGXX_HAS_SSE2)
+            return;
+        }
+
+        // Decodes [first, last) into out[count...]. Returns the first octet that is not decoded (last, or the error if
+        // is_decoded is set to false).
+        inline const std::uint8_t* decode_single_byte(
+            const single_byte_charset& charset, codec_error_policy policy, const std::uint8_t* first,
+            const std::uint8_t* last, uchar_t* out, std::size_t& count, bool& is_decoded
+        )
+        {
+            while (first != last) {
+                if (((last - first) >= 16) && is_ascii_block(first)) {
+                    widen_ascii_block(first, out + count);
+                    first += 16;
+                    count += 16;
+                    continue;
+                }
+                const std::uint8_t octet = *first;
+                const std::uint32_t code_point = (octet < 0x80) ? octet : charset.decode_table[octet - 0x80];
+                if ((code_point != 0) || (octet == 0)) {
+                    out[count++] = uchar_t{static_cast<uchar_t::int_type>(code_point)};
+                }
+                else if (!put_decode_error(policy, out, count)) {
+                    is_decoded = false;
+                    break;
+                }
+                ++first;
+            }
+            return (first);
+        }
+
+        // Writes the octet of a valid code point to out. Returns 1, or 0 if the character set does not have it.
+        inline std::size_t encode_single_byte(
+            const single_byte_charset& charset, std::uint32_t code_point, std::uint8_t* out
+        ) noexcept
+        {
+            if (code_point < 0x80) {
+                out[0] = static_cast<std::uint8_t>(code_point);
+                return (1);
+            }
+            if ((code_point > 0xFFFF) || (charset.encode_size == 0))
+                return (0);
+            const std::uint16_t* code_points_end = charset.encode_code_points + charset.encode_size;
+            const std::uint16_t* found = std::lower_bound(
+                charset.encode_code_points, code_points_end, static_cast<std::uint16_t>(code_point)
+            );
+            if ((found == code_points_end) || (*found != code_point))
+                return (0);
+            out[0] = charset.encode_octets[found - charset.encode_code_points];
+            return (1);
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_SINGLE_BYTE_CODECS_HPP)
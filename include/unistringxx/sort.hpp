@@ -0,0 +1,298 @@
+#if !defined(UNISTRINGXX_SORT_HPP)
+#define UNISTRINGXX_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // Ranges up to this size are finished with an insertion sort.
+        const std::size_t _s_string_sort_insertion_threshold = 16;
+        // Partitions smaller than this are never handed to another thread.
+        const std::size_t _s_string_sort_parallel_threshold = 1 << 14;
+
+        // Each entry caches the next three code points of its text (a "superchar") at the current depth, so
+        // partitioning does not touch the texts. Each code point is stored as code point + 1 in 21 bits, and 0 marks
+        // the end of the text, so shorter texts sort first. Values above U+10FFFF (e.g. uchar::invalid_value) do not
+        // fit: they are all stored as the reserved value below, the rest of the key is left 0, and texts with equal
+        // keys holding it are compared from the start of the key.
+        const std::size_t _s_string_sort_key_code_points = 3;
+        const unsigned int _s_string_sort_key_bits = 21;
+        const std::uint64_t _s_string_sort_key_mask = (std::uint64_t{1} << _s_string_sort_key_bits) - 1;
+        const std::uint64_t _s_string_sort_key_out_of_range = _s_string_sort_key_mask;
+
+        struct string_sort_entry
+        {
+            std::uint64_t key;
+            const uchar_t* data;
+            std::size_t size;
+            std::size_t index;
+        };
+
+        inline void string_sort_load_keys(string_sort_entry* entries, std::size_t count, std::size_t depth)
+        {
+            std::size_t ctr = 0;
+            for (ctr = 0; ctr < count; ctr++) {
+                string_sort_entry& entry = entries[ctr];
+                std::uint64_t key = 0;
+                std::size_t key_size = std::min(entry.size, depth + _s_string_sort_key_code_points);
+                std::size_t itr = 0;
+                for (itr = depth; itr < (depth + _s_string_sort_key_code_points); itr++) {
+                    key <<= _s_string_sort_key_bits;
+                    if (itr < key_size) {
+                        const std::uint32_t code_point = static_cast<std::uint32_t>(entry.data[itr].code_point());
+                        if (code_point > 0x10FFFF) {
+                            key |= _s_string_sort_key_out_of_range;
+                            key_size = itr + 1;
+                        }
+                        else {
+                            key |= static_cast<std::uint64_t>(code_point) + 1;
+                        }
+                    }
+                }
+                entry.key = key;
+            }
+            return;
+        }
+
+        // Checks whether the key holds a code point above U+10FFFF (i.e. texts with equal keys may still differ
+        // within it).
+        inline bool string_sort_key_is_out_of_range(std::uint64_t key)
+        {
+            std::size_t ctr = 0;
+            for (ctr = 0; ctr < _s_string_sort_key_code_points; ctr++) {
+                const std::uint64_t field = (key >> (ctr * _s_string_sort_key_bits)) & _s_string_sort_key_mask;
+                if (field == _s_string_sort_key_out_of_range)
+                    return (true);
+            }
+            return (false);
+        }
+
+        // Checks whether the texts with this key end within it (i.e. texts with equal keys are equal).
+        inline bool string_sort_key_is_last(std::uint64_t key)
+        { return (((key & _s_string_sort_key_mask) == 0) && !string_sort_key_is_out_of_range(key)); }
+
+        // Compares two texts that are known to be equal up to depth and whose keys are loaded at depth.
+        inline bool string_sort_less(
+            const string_sort_entry& left, const string_sort_entry& right, std::size_t depth, bool stable
+        )
+        {
+            if (left.key != right.key)
+                return (left.key < right.key);
+            if (!string_sort_key_is_last(left.key)) {
+                if (!string_sort_key_is_out_of_range(left.key))
+                    depth += _s_string_sort_key_code_points;
+                const std::size_t compare_count = std::min(left.size, right.size) - depth;
+                const int result = uchar_traits::compare(left.data + depth, right.data + depth, compare_count);
+                if (result != 0)
+                    return (result < 0);
+                if (left.size != right.size)
+                    return (left.size < right.size);
+            }
+            return (stable && (left.index < right.index));
+        }
+
+        inline void string_sort_insertion(string_sort_entry* entries, std::size_t count, std::size_t depth, bool stable)
+        {
+            std::size_t ctr = 0;
+            for (ctr = 1; ctr < count; ctr++) {
+                const string_sort_entry entry = entries[ctr];
+                std::size_t itr = ctr;
+                for (; (itr > 0) && string_sort_less(entry, entries[itr - 1], depth, stable); itr--)
+                    entries[itr] = entries[itr - 1];
+                entries[itr] = entry;
+            }
+            return;
+        }
+
+        // Gets the length of the common prefix of texts that are known to be equal up to depth.
+        inline std::size_t string_sort_common_prefix(
+            const string_sort_entry* entries, std::size_t count, std::size_t depth
+        )
+        {
+            const string_sort_entry& first = entries[0];
+            std::size_t result = first.size;
+            std::size_t ctr = 0;
+            for (ctr = 1; (ctr < count) && (result > depth); ctr++) {
+                const std::size_t compare_count = std::min(result, entries[ctr].size) - depth;
+                const std::size_t offset = find_first_mismatch(
+                    reinterpret_cast<const std::uint8_t*>(first.data + depth),
+                    reinterpret_cast<const std::uint8_t*>(entries[ctr].data + depth), compare_count * sizeof (uchar_t)
+                );
+                result = depth + (offset / sizeof (uchar_t));
+            }
+            return (result);
+        }
+
+        inline std::uint64_t string_sort_median(std::uint64_t first, std::uint64_t second, std::uint64_t third)
+        {
+            if (first < second)
+                return ((second < third) ? second : ((first < third) ? third : first));
+            return ((first < third) ? first : ((second < third) ? third : second));
+        }
+
+        inline void string_sort_by_index(string_sort_entry* entries, std::size_t count)
+        {
+            std::sort(
+                entries, entries + count,
+                [](const string_sort_entry& left, const string_sort_entry& right) { return (left.index < right.index); }
+            );
+            return;
+        }
+
+        // Multikey quicksort (Bentley and Sedgewick, "Fast Algorithms for Sorting and Searching Strings") over the
+        // cached keys: a three-way partition on the key, recursing into the smaller and larger parts and iterating
+        // into the equal part with the keys reloaded one superchar deeper. The code points before depth are never
+        // compared again. The keys must be loaded at depth. thread_count is the number of threads this call may use
+        // (including the calling one).
+        inline void string_sort_multikey(
+            string_sort_entry* entries, std::size_t count, std::size_t depth, bool stable, std::size_t thread_count
+        )
+        {
+            while (count > _s_string_sort_insertion_threshold) {
+                const std::uint64_t pivot = string_sort_median(
+                    entries[0].key, entries[count / 2].key, entries[count - 1].key
+                );
+
+                // Dijkstra's partition: [0, less) < pivot, [less, itr) == pivot, [greater, count) > pivot.
+                std::size_t less = 0;
+                std::size_t itr = 0;
+                std::size_t greater = count;
+                while (itr < greater) {
+                    const std::uint64_t key = entries[itr].key;
+                    if (key < pivot)
+                        std::swap(entries[less++], entries[itr++]);
+                    else if (key > pivot)
+                        std::swap(entries[itr], entries[--greater]);
+                    else
+                        itr++;
+                }
+
+                std::future<void> lower;
+                if ((thread_count > 1) && (less >= _s_string_sort_parallel_threshold)) {
+                    const std::size_t other_thread_count = thread_count / 2;
+                    lower = std::async(
+                        std::launch::async, string_sort_multikey, entries, less, depth, stable, other_thread_count
+                    );
+                    thread_count -= other_thread_count;
+                }
+                else {
+                    string_sort_multikey(entries, less, depth, stable, thread_count);
+                }
+                string_sort_multikey(entries + greater, count - greater, depth, stable, thread_count);
+
+                const bool is_unsplit = ((less == 0) && (greater == count));
+                entries += less;
+                count = greater - less;
+                if (string_sort_key_is_last(pivot)) {
+                    // The texts in the equal part end within the key: they are all equal.
+                    if (stable)
+                        string_sort_by_index(entries, count);
+                    count = 0;
+                }
+                else if (string_sort_key_is_out_of_range(pivot)) {
+                    // The keys do not tell the texts in the equal part apart: they are compared in full.
+                    std::sort(
+                        entries, entries + count,
+                        [depth, stable](const string_sort_entry& left, const string_sort_entry& right)
+                        { return (string_sort_less(left, right, depth, stable)); }
+                    );
+                    count = 0;
+                }
+                else {
+                    depth += _s_string_sort_key_code_points;
+                    // When no text was split off, the texts likely share a long prefix (e.g. paths): skip it in one
+                    // pass instead of one superchar at a time.
+                    if (is_unsplit)
+                        depth = std::max(depth, string_sort_common_prefix(entries, count, depth));
+                    string_sort_load_keys(entries, count, depth);
+                }
+                if (lower.valid()) {
+                    string_sort_multikey(entries, count, depth, stable, thread_count);
+                    lower.get();
+                    return;
+                }
+            }
+            string_sort_insertion(entries, count, depth, stable);
+            return;
+        }
+
+        template<typename randomIterT>
+        void string_sort_internal(randomIterT first, randomIterT last, bool stable, std::size_t thread_count)
+        {
+            const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+            if (count < 2)
+                return;
+            if (thread_count == 0)
+                thread_count = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+            std::vector<string_sort_entry> entries(count);
+            for (std::size_t ctr = 0; ctr < count; ctr++) {
+                const ustring_view view{first[ctr]};
+                entries[ctr].data = view.data();
+                entries[ctr].size = view.size();
+                entries[ctr].index = ctr;
+            }
+            string_sort_load_keys(entries.data(), count, 0);
+            string_sort_multikey(entries.data(), count, 0, stable, thread_count);
+
+            // Moves the elements into place by following the cycles of the permutation, with at most one swap per element.
+            for (std::size_t ctr = 0; ctr < count; ctr++) {
+                std::size_t itr = ctr;
+                while (entries[itr].index != ctr) {
+                    const std::size_t source = entries[itr].index;
+                    std::iter_swap(first + itr, first + source);
+                    entries[itr].index = itr;
+                    itr = source;
+                }
+                entries[itr].index = itr;
+            }
+            return;
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Sorts a sequence of texts in code point order (the order of operator<). This is a multikey quicksort over
+    /// cached keys of three code points: each code point is read about once per level of partitioning instead of
+    /// once per comparison, so it is faster than std::sort for large sequences, especially when the texts share long
+    /// prefixes. The elements are only swapped, never copied. The sort is not stable; equal texts are in an unspecified
+    /// order.
+    /// @param first, last The range to sort. Its elements must be convertible to ustring_view (e.g. ustring).
+    /// @param thread_count The maximum number of threads to use. 1 sorts in the calling thread only, 0 uses
+    ///     std::thread::hardware_concurrency() threads.
+    ///
+    template<typename randomIterT>
+    void string_sort(randomIterT first, randomIterT last, std::size_t thread_count = 1)
+    {
+        string_sort_internal(first, last, false, thread_count);
+        return;
+    }
+
+    ///
+    /// Sorts a sequence of texts in code point order, keeping equal texts in their original order.
+    /// @see string_sort
+    ///
+    template<typename randomIterT>
+    void stable_string_sort(randomIterT first, randomIterT last, std::size_t thread_count = 1)
+    {
+        string_sort_internal(first, last, true, thread_count);
+        return;
+    }
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_SORT_HPP)
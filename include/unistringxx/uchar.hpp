@@ -3,6 +3,7 @@
 #define UNISTRINGXX_UCHAR_HPP
 
 #include <cstdint>
+#include <cstring>
 #include <ios>
 #include <iterator>
 #include <functional>
@@ -14,6 +15,13 @@
 #include "core.hpp"
 #include "utils.hpp"
 
+#if (UNISTRINGXX_HAS_SSE2)
+#include <emmintrin.h>
+#endif // (UNISTRINGXX_HAS_SSE2)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // defined(_MSC_VER)
+
 namespace unistringxx
 {
     // For convenience
@@ -353,6 +361,228 @@ namespace unistringxx
         }
     } // namespace operators
 
+    static_assert(sizeof (uchar) == sizeof (uchar::impl_type), "uchar must not have padding.");
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        inline unsigned int count_trailing_zeros(std::uint32_t value)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return (static_cast<unsigned int>(__builtin_ctz(value)));
+#elif defined(_MSC_VER)
+            unsigned long result = 0;
+            _BitScanForward(&result, value);
+            return (static_cast<unsigned int>(result));
+#else
+            unsigned int result = 0;
+            for (; (value & 1) == 0; value >>= 1)
+                result++;
+            return (result);
+#endif
+        }
+
+        // Finds the offset of the first byte that differs between two buffers, or size if they are equal. Compares 16
+        // bytes at a time with SSE2, otherwise 8 bytes at a time.
+        inline std::size_t find_first_mismatch(const std::uint8_t* left, const std::uint8_t* right, std::size_t size)
+        {
+            std::size_t offset = 0;
+#if (UNISTRINGXX_HAS_SSE2)
+            for (; (offset + 16) <= size; offset += 16) {
+                const __m128i left_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left + offset));
+                const __m128i right_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + offset));
+                const std::uint32_t mismatch_mask =
+                    static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(left_block, right_block))) ^ 0xFFFF;
+                if (mismatch_mask != 0)
+                    return (offset + count_trailing_zeros(mismatch_mask));
+            }
+#endif // (UNISTRINGXX_HAS_SSE2)
+            for (; (offset + 8) <= size; offset += 8) {
+                std::uint64_t left_block = 0;
+                std::uint64_t right_block = 0;
+                std::memcpy(&left_block, left + offset, sizeof (left_block));
+                std::memcpy(&right_block, right + offset, sizeof (right_block));
+                if (left_block != right_block)
+                    break;
+            }
+            for (; offset < size; offset++) {
+                if (left[offset] != right[offset])
+                    return (offset);
+            }
+            return (size);
+        }
+
+        // Checks whether two sequences of code points are equal. Each code point has a single representation (without
+        // padding), so the storage is compared directly.
+        inline bool code_points_equal(const uchar* left, const uchar* right, std::size_t count)
+        { return ((count == 0) || (std::memcmp(left, right, count * sizeof (uchar)) == 0)); }
+
+        // The largest number of octets of a UTF-8 sequence.
+        const std::size_t _s_utf8_max_sequence_size = 4;
+
+        // Gets the number of octets of a UTF-8 sequence from its first octet, or 0 if it cannot start a sequence.
+        inline std::size_t utf8_sequence_size(std::uint8_t lead)
+        {
+            if (lead < 0x80)
+                return (1);
+            if (lead < 0xC2)
+                return (0);
+            if (lead < 0xE0)
+                return (2);
+            if (lead < 0xF0)
+                return (3);
+            return ((lead < 0xF5) ? 4 : 0);
+        }
+
+        // Decodes one UTF-8 sequence from [first, last) (RFC 3629: no overlong forms, surrogates or values above
+        // U+10FFFF). Returns the number of octets read, or 0 if the sequence is invalid or truncated.
+        inline std::size_t decode_utf8(const std::uint8_t* first, const std::uint8_t* last, std::uint32_t& code_point)
+        {
+            const std::size_t size = utf8_sequence_size(*first);
+            if ((size == 0) || (static_cast<std::size_t>(last - first) < size))
+                return (0);
+            if (size == 1) {
+                code_point = *first;
+                return (1);
+            }
+            std::uint32_t value = *first & (0x7F >> size);
+            for (std::size_t ctr = 1; ctr < size; ctr++) {
+                if ((first[ctr] & 0xC0) != 0x80)
+                    return (0);
+                value = (value << 6) | (first[ctr] & 0x3F);
+            }
+            static const std::uint32_t minimum_values[] = {0, 0, 0x80, 0x800, 0x10000};
+            if ((value < minimum_values[size]) || (value > 0x10FFFF) || ((value >= 0xD800) && (value <= 0xDFFF)))
+                return (0);
+            code_point = value;
+            return (size);
+        }
+
+        // Checks whether 16 octets are all ASCII.
+        inline bool is_ascii_block(const std::uint8_t* data)
+        {
+#if (UNISTRINGXX_HAS_SSE2)
+            return (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))) == 0);
+#else // (UNISTRINGXX_HAS_SSE2)
+            std::uint64_t low = 0;
+            std::uint64_t high = 0;
+            std::memcpy(&low, data, sizeof (low));
+            std::memcpy(&high, data + sizeof (low), sizeof (high));
+            return (((low | high) & 0x8080808080808080ULL) == 0);
+#endif // (UNISTRINGXX_HAS_SSE2)
+        }
+
+#if (UNISTRINGXX_HAS_SSE2)
+        // Stores 4 code points, given in 32-bit lanes, in their storage.
+        inline void store_code_points(uchar* out, __m128i code_points)
+        {
+#if !(UNISTRINGXX_TEST)
+            // uint24_t: 3 octets each, least significant first. The code points are below 0x1000000, so the octets
+            // of each lane are moved down by the lane number, into the unused octets of the lanes before it.
+            static_assert(sizeof (uchar) == 3, "Code points are stored in 3 octets.");
+            const __m128i packed = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_and_si128(code_points, _mm_setr_epi32(-1, 0, 0, 0)),
+                    _mm_srli_si128(_mm_and_si128(code_points, _mm_setr_epi32(0, -1, 0, 0)), 1)
+                ),
+                _mm_or_si128(
+                    _mm_srli_si128(_mm_and_si128(code_points, _mm_setr_epi32(0, 0, -1, 0)), 2),
+                    _mm_srli_si128(_mm_and_si128(code_points, _mm_setr_epi32(0, 0, 0, -1)), 3)
+                )
+            );
+            // Exactly 12 octets are written.
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), packed);
+            const std::int32_t last = _mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+            std::memcpy(reinterpret_cast<std::uint8_t*>(out) + 8, &last, sizeof (last));
+#else // !(UNISTRINGXX_TEST)
+            static_assert(sizeof (uchar) == 4, "Code points are stored in 4 octets.");
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), code_points);
+#endif // !(UNISTRINGXX_TEST)
+            return;
+        }
+
+        // Stores 16 ASCII octets as code points.
+        inline void store_ascii_block(uchar* out, const std::uint8_t* data)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i octets = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            const __m128i low = _mm_unpacklo_epi8(octets, zero);
+            const __m128i high = _mm_unpackhi_epi8(octets, zero);
+            store_code_points(out, _mm_unpacklo_epi16(low, zero));
+            store_code_points(out + 4, _mm_unpackhi_epi16(low, zero));
+            store_code_points(out + 8, _mm_unpacklo_epi16(high, zero));
+            store_code_points(out + 12, _mm_unpackhi_epi16(high, zero));
+            return;
+        }
+#endif // (UNISTRINGXX_HAS_SSE2)
+
+        // Decodes UTF-8 octets into out until the end of [first, last) or the first sequence that is invalid or
+        // truncated (e.g. split at the end of a buffer), with a fast path for ASCII blocks. Adds the number of code
+        // points written (at most one per octet) to count, and returns the octet where decoding stopped.
+        inline const std::uint8_t* decode_utf8_run(
+            const std::uint8_t* first, const std::uint8_t* last, uchar* out, std::size_t& count
+        )
+        {
+            std::size_t written = count;
+            while (first != last) {
+                if (((last - first) >= 16) && is_ascii_block(first)) {
+#if (UNISTRINGXX_HAS_SSE2)
+                    store_ascii_block(out + written, first);
+#else // (UNISTRINGXX_HAS_SSE2)
+                    for (std::size_t ctr = 0; ctr < 16; ctr++)
+                        out[written + ctr] = uchar{static_cast<uchar::int_type>(first[ctr])};
+#endif // (UNISTRINGXX_HAS_SSE2)
+                    first += 16;
+                    written += 16;
+                    continue;
+                }
+                if (*first < 0x80) {
+                    out[written++] = uchar{static_cast<uchar::int_type>(*first)};
+                    ++first;
+                    continue;
+                }
+                std::uint32_t code_point = 0;
+                const std::size_t sequence_size = decode_utf8(first, last, code_point);
+                if (sequence_size == 0)
+                    break;
+                out[written++] = uchar{static_cast<uchar::int_type>(code_point)};
+                first += sequence_size;
+            }
+            count = written;
+            return (first);
+        }
+
+        // Checks whether a value is a Unicode scalar value (a code point that is not a surrogate).
+        inline bool is_scalar_value(std::uint32_t value)
+        { return ((value <= 0x10FFFF) && ((value < 0xD800) || (value > 0xDFFF))); }
+
+        // Encodes a valid code point as UTF-8. Returns the number of octets written (at most 4).
+        inline std::size_t encode_utf8(std::uint32_t code_point, std::uint8_t* out)
+        {
+            if (code_point < 0x80) {
+                out[0] = static_cast<std::uint8_t>(code_point);
+                return (1);
+            }
+            if (code_point < 0x800) {
+                out[0] = static_cast<std::uint8_t>(0xC0 | (code_point >> 6));
+                out[1] = static_cast<std::uint8_t>(0x80 | (code_point & 0x3F));
+                return (2);
+            }
+            if (code_point < 0x10000) {
+                out[0] = static_cast<std::uint8_t>(0xE0 | (code_point >> 12));
+                out[1] = static_cast<std::uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+                out[2] = static_cast<std::uint8_t>(0x80 | (code_point & 0x3F));
+                return (3);
+            }
+            out[0] = static_cast<std::uint8_t>(0xF0 | (code_point >> 18));
+            out[1] = static_cast<std::uint8_t>(0x80 | ((code_point >> 12) & 0x3F));
+            out[2] = static_cast<std::uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+            out[3] = static_cast<std::uint8_t>(0x80 | (code_point & 0x3F));
+            return (4);
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
     struct uchar_traits
     {
         typedef uchar_t char_type;
@@ -397,13 +627,16 @@ namespace unistringxx
 
         static int compare(const char_type* ch_str_a, const char_type* ch_str_b, std::size_t count)
         {
-            std::size_t itr = 0;
-            for (itr = 0; itr < count; itr++) {
-                int result = (*(ch_str_a + itr)).code_point() - (*(ch_str_b + itr)).code_point();
-                if (result != 0)
-                    return (result);
-            }
-            return (0);
+            // The storage is not in code point order (e.g. it is little endian), so the bytes are only used to find
+            // the first code point that differs.
+            const std::size_t size = count * sizeof (char_type);
+            const std::size_t offset = find_first_mismatch(
+                reinterpret_cast<const std::uint8_t*>(ch_str_a), reinterpret_cast<const std::uint8_t*>(ch_str_b), size
+            );
+            if (offset == size)
+                return (0);
+            const std::size_t itr = offset / sizeof (char_type);
+            return ((*(ch_str_a + itr)).code_point() - (*(ch_str_b + itr)).code_point());
         }
 
         static std::size_t length(const char_type* ch_str)
@@ -0,0 +1,283 @@
+#if !defined(UNISTRINGXX_UPROPERTIES_HPP)
+#define UNISTRINGXX_UPROPERTIES_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "uproperties_tables.hpp"
+
+namespace unistringxx
+{
+    ///
+    /// Unicode General_Category property values.
+    ///
+    enum class general_category : std::uint8_t
+    {
+        unassigned = 0, // Cn
+        uppercase_letter, // Lu
+        lowercase_letter, // Ll
+        titlecase_letter, // Lt
+        modifier_letter, // Lm
+        other_letter, // Lo
+        nonspacing_mark, // Mn
+        spacing_mark, // Mc
+        enclosing_mark, // Me
+        decimal_number, // Nd
+        letter_number, // Nl
+        other_number, // No
+        connector_punctuation, // Pc
+        dash_punctuation, // Pd
+        open_punctuation, // Ps
+        close_punctuation, // Pe
+        initial_punctuation, // Pi
+        final_punctuation, // Pf
+        other_punctuation, // Po
+        math_symbol, // Sm
+        currency_symbol, // Sc
+        modifier_symbol, // Sk
+        other_symbol, // So
+        space_separator, // Zs
+        line_separator, // Zl
+        paragraph_separator, // Zp
+        control, // Cc
+        format, // Cf
+        surrogate, // Cs
+        private_use // Co
+    };
+
+    ///
+    /// Unicode East_Asian_Width property values (UAX #11).
+    ///
+    enum class east_asian_width : std::uint8_t
+    {
+        neutral = 0, // N
+        ambiguous, // A
+        halfwidth, // H
+        wide, // W
+        fullwidth, // F
+        narrow // Na
+    };
+
+    ///
+    /// Unicode Line_Break property values (UAX #14).
+    ///
+    enum class line_break_class : std::uint8_t
+    {
+        unknown = 0, // XX
+        mandatory_break, // BK
+        carriage_return, // CR
+        line_feed, // LF
+        next_line, // NL
+        space, // SP
+        zwspace, // ZW
+        combining_mark, // CM
+        zwj, // ZWJ
+        word_joiner, // WJ
+        glue, // GL
+        break_after, // BA
+        break_before, // BB
+        break_both, // B2
+        hyphen, // HY
+        contingent_break, // CB
+        close_punctuation, // CL
+        close_parenthesis, // CP
+        exclamation, // EX
+        inseparable, // IN
+        nonstarter, // NS
+        open_punctuation, // OP
+        quotation, // QU
+        infix_numeric, // IS
+        numeric, // NU
+        postfix_numeric, // PO
+        prefix_numeric, // PR
+        break_symbols, // SY
+        ambiguous, // AI
+        alphabetic, // AL
+        conditional_japanese_starter, // CJ
+        e_base, // EB
+        e_modifier, // EM
+        h2, // H2
+        h3, // H3
+        hebrew_letter, // HL
+        ideographic, // ID
+        jl, // JL
+        jv, // JV
+        jt, // JT
+        regional_indicator, // RI
+        complex_context, // SA
+        surrogate // SG
+    };
+
+    ///
+    /// Unicode Grapheme_Cluster_Break property values (UAX #29). Code points that have the Extended_Pictographic
+    /// property (and no other Grapheme_Cluster_Break value) are reported as extended_pictographic.
+    ///
+    enum class grapheme_cluster_break : std::uint8_t
+    {
+        other = 0, // XX
+        carriage_return, // CR
+        line_feed, // LF
+        control, // CN
+        extend, // EX
+        zwj, // ZWJ
+        regional_indicator, // RI
+        prepend, // PP
+        spacing_mark, // SM
+        l, // L
+        v, // V
+        t, // T
+        lv, // LV
+        lvt, // LVT
+        extended_pictographic // ExtPict
+    };
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        const std::uint32_t _s_max_code_point = 0x10FFFF;
+
+        // Looks up a code point in an inversion map (sorted range starts with a parallel value array). The first range
+        // start is always 0, so the upper bound is never the beginning of the array.
+        template<std::size_t N>
+        inline std::uint8_t lookup_property(
+            const std::uint32_t (&starts)[N], const std::uint8_t (&values)[N], std::uint32_t code_point
+        )
+        {
+            const std::uint32_t* itr = std::upper_bound(std::begin(starts), std::end(starts), code_point);
+            return (values[(itr - std::begin(starts)) - 1]);
+        }
+
+        // Looks up a code point in an inversion list. A code point is in the set if the number of range boundaries
+        // less than or equal to it is odd.
+        template<std::size_t N>
+        inline bool lookup_property(const std::uint32_t (&ranges)[N], std::uint32_t code_point)
+        {
+            const std::uint32_t* itr = std::upper_bound(std::begin(ranges), std::end(ranges), code_point);
+            return (((itr - std::begin(ranges)) % 2) == 1);
+        }
+
+        inline std::uint32_t property_code_point(uchar_t ch)
+        {
+            // Invalid values (e.g. uchar::invalid_value) are looked up as the last code point, which is unassigned.
+            return (std::min(static_cast<std::uint32_t>(ch.code_point()), _s_max_code_point));
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Gets the General_Category property of a code point.
+    ///
+    inline general_category get_general_category(uchar_t ch)
+    {
+        return (static_cast<general_category>(
+            lookup_property(_s_general_category_starts, _s_general_category_values, property_code_point(ch))
+        ));
+    }
+
+    ///
+    /// Gets the East_Asian_Width property of a code point.
+    ///
+    inline east_asian_width get_east_asian_width(uchar_t ch)
+    {
+        return (static_cast<east_asian_width>(
+            lookup_property(_s_east_asian_width_starts, _s_east_asian_width_values, property_code_point(ch))
+        ));
+    }
+
+    ///
+    /// Gets the (unresolved) Line_Break property of a code point.
+    ///
+    inline line_break_class get_line_break_class(uchar_t ch)
+    {
+        return (static_cast<line_break_class>(
+            lookup_property(_s_line_break_starts, _s_line_break_values, property_code_point(ch))
+        ));
+    }
+
+    ///
+    /// Gets the Grapheme_Cluster_Break property of a code point.
+    ///
+    inline grapheme_cluster_break get_grapheme_cluster_break(uchar_t ch)
+    {
+        return (static_cast<grapheme_cluster_break>(
+            lookup_property(
+                _s_grapheme_cluster_break_starts, _s_grapheme_cluster_break_values, property_code_point(ch)
+            )
+        ));
+    }
+
+    ///
+    /// Checks whether a code point has the Extended_Pictographic property.
+    ///
+    inline bool is_extended_pictographic(uchar_t ch)
+    { return (lookup_property(_s_extended_pictographic_ranges, property_code_point(ch))); }
+
+    ///
+    /// Gets the value of a decimal digit (General_Category Nd) of any script.
+    /// @returns The digit value (0 to 9), or -1 if the code point is not a decimal digit.
+    ///
+    inline int get_decimal_digit_value(uchar_t ch)
+    {
+        const std::uint32_t cp = property_code_point(ch);
+        const std::uint32_t* itr = std::upper_bound(
+            std::begin(_s_decimal_digit_zeros), std::end(_s_decimal_digit_zeros), cp
+        );
+        if (itr == std::begin(_s_decimal_digit_zeros))
+            return (-1);
+        // Digits are encoded in complete runs from zero to nine.
+        const std::uint32_t value = cp - *(itr - 1);
+        return ((value < 10) ? static_cast<int>(value) : -1);
+    }
+
+    ///
+    /// Gets the number of terminal columns a code point occupies when rendered on its own.
+    /// @param ch The code point to measure.
+    /// @param ambiguous_width The width to use for East Asian Ambiguous characters (1 in western contexts, 2 in East
+    ///     Asian legacy contexts).
+    /// @returns 0 for controls, non-spacing/enclosing marks, format characters and conjoining Hangul vowels/trailing
+    ///     consonants; 2 for East Asian Wide and Fullwidth characters (which includes CJK and emoji presentation
+    ///     characters); 1 for everything else.
+    ///
+    inline int column_width(uchar_t ch, int ambiguous_width = 1)
+    {
+        const std::uint32_t cp = property_code_point(ch);
+
+        // Fast path for printable ASCII.
+        if ((cp >= 0x20) && (cp < 0x7F))
+            return (1);
+
+        // Conjoining Hangul medial vowels and final consonants are rendered as part of the preceding syllable.
+        if (((cp >= 0x1160) && (cp <= 0x11FF)) || ((cp >= 0xD7B0) && (cp <= 0xD7FF)))
+            return (0);
+
+        switch (get_general_category(ch)) {
+            case general_category::control:
+            case general_category::nonspacing_mark:
+            case general_category::enclosing_mark:
+                return (0);
+            case general_category::format:
+                // SOFT HYPHEN is rendered as a hyphen by terminals.
+                return ((cp == 0x00AD) ? 1 : 0);
+            default:
+                break;
+        }
+
+        switch (get_east_asian_width(ch)) {
+            case east_asian_width::wide:
+            case east_asian_width::fullwidth:
+                return (2);
+            case east_asian_width::ambiguous:
+                return (ambiguous_width);
+            default:
+                break;
+        }
+        return (1);
+    }
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_UPROPERTIES_HPP)
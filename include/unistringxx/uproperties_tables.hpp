@@ -0,0 +1,1714 @@
+// This file is generated by tools/gen_uproperties.pl from the Unicode Character Database version
+// 14.0.0. Do not edit.
+#if !defined(UNISTRINGXX_UPROPERTIES_TABLES_HPP)
+#define UNISTRINGXX_UPROPERTIES_TABLES_HPP
+
+#include <cstdint>
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // General_Category
+        const std::uint32_t _s_general_category_starts[] = {
+            0x0000, 0x0020, 0x0021, 0x0024, 0x0025, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E,
+            0x0030, 0x003A, 0x003C, 0x003F, 0x0041, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061,
+            0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x00A0, 0x00A1, 0x00A2, 0x00A6, 0x00A7, 0x00A8, 0x00A9,
+            0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B4, 0x00B5, 0x00B6,
+            0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BF, 0x00C0, 0x00D7, 0x00D8, 0x00DF, 0x00F7, 0x00F8,
+            0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B,
+            0x010C, 0x010D, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117,
+            0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x0120, 0x0121, 0x0122, 0x0123,
+            0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A, 0x012B, 0x012C, 0x012D, 0x012E, 0x012F,
+            0x0130, 0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0139, 0x013A, 0x013B, 0x013C,
+            0x013D, 0x013E, 0x013F, 0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148,
+            0x014A, 0x014B, 0x014C, 0x014D, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154, 0x0155,
+            0x0156, 0x0157, 0x0158, 0x0159, 0x015A, 0x015B, 0x015C, 0x015D, 0x015E, 0x015F, 0x0160, 0x0161,
+            0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0168, 0x0169, 0x016A, 0x016B, 0x016C, 0x016D,
+            0x016E, 0x016F, 0x0170, 0x0171, 0x0172, 0x0173, 0x0174, 0x0175, 0x0176, 0x0177, 0x0178, 0x017A,
+            0x017B, 0x017C, 0x017D, 0x017E, 0x0181, 0x0183, 0x0184, 0x0185, 0x0186, 0x0188, 0x0189, 0x018C,
+            0x018E, 0x0192, 0x0193, 0x0195, 0x0196, 0x0199, 0x019C, 0x019E, 0x019F, 0x01A1, 0x01A2, 0x01A3,
+            0x01A4, 0x01A5, 0x01A6, 0x01A8, 0x01A9, 0x01AA, 0x01AC, 0x01AD, 0x01AE, 0x01B0, 0x01B1, 0x01B4,
+            0x01B5, 0x01B6, 0x01B7, 0x01B9, 0x01BB, 0x01BC, 0x01BD, 0x01C0, 0x01C4, 0x01C5, 0x01C6, 0x01C7,
+            0x01C8, 0x01C9, 0x01CA, 0x01CB, 0x01CC, 0x01CD, 0x01CE, 0x01CF, 0x01D0, 0x01D1, 0x01D2, 0x01D3,
+            0x01D4, 0x01D5, 0x01D6, 0x01D7, 0x01D8, 0x01D9, 0x01DA, 0x01DB, 0x01DC, 0x01DE, 0x01DF, 0x01E0,
+            0x01E1, 0x01E2, 0x01E3, 0x01E4, 0x01E5, 0x01E6, 0x01E7, 0x01E8, 0x01E9, 0x01EA, 0x01EB, 0x01EC,
+            0x01ED, 0x01EE, 0x01EF, 0x01F1, 0x01F2, 0x01F3, 0x01F4, 0x01F5, 0x01F6, 0x01F9, 0x01FA, 0x01FB,
+            0x01FC, 0x01FD, 0x01FE, 0x01FF, 0x0200, 0x0201, 0x0202, 0x0203, 0x0204, 0x0205, 0x0206, 0x0207,
+            0x0208, 0x0209, 0x020A, 0x020B, 0x020C, 0x020D, 0x020E, 0x020F, 0x0210, 0x0211, 0x0212, 0x0213,
+            0x0214, 0x0215, 0x0216, 0x0217, 0x0218, 0x0219, 0x021A, 0x021B, 0x021C, 0x021D, 0x021E, 0x021F,
+            0x0220, 0x0221, 0x0222, 0x0223, 0x0224, 0x0225, 0x0226, 0x0227, 0x0228, 0x0229, 0x022A, 0x022B,
+            0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0233, 0x023A, 0x023C, 0x023D, 0x023F,
+            0x0241, 0x0242, 0x0243, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F,
+            0x0294, 0x0295, 0x02B0, 0x02C2, 0x02C6, 0x02D2, 0x02E0, 0x02E5, 0x02EC, 0x02ED, 0x02EE, 0x02EF,
+            0x0300, 0x0370, 0x0371, 0x0372, 0x0373, 0x0374, 0x0375, 0x0376, 0x0377, 0x0378, 0x037A, 0x037B,
+            0x037E, 0x037F, 0x0380, 0x0384, 0x0386, 0x0387, 0x0388, 0x038B, 0x038C, 0x038D, 0x038E, 0x0390,
+            0x0391, 0x03A2, 0x03A3, 0x03AC, 0x03CF, 0x03D0, 0x03D2, 0x03D5, 0x03D8, 0x03D9, 0x03DA, 0x03DB,
+            0x03DC, 0x03DD, 0x03DE, 0x03DF, 0x03E0, 0x03E1, 0x03E2, 0x03E3, 0x03E4, 0x03E5, 0x03E6, 0x03E7,
+            0x03E8, 0x03E9, 0x03EA, 0x03EB, 0x03EC, 0x03ED, 0x03EE, 0x03EF, 0x03F4, 0x03F5, 0x03F6, 0x03F7,
+            0x03F8, 0x03F9, 0x03FB, 0x03FD, 0x0430, 0x0460, 0x0461, 0x0462, 0x0463, 0x0464, 0x0465, 0x0466,
+            0x0467, 0x0468, 0x0469, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0470, 0x0471, 0x0472,
+            0x0473, 0x0474, 0x0475, 0x0476, 0x0477, 0x0478, 0x0479, 0x047A, 0x047B, 0x047C, 0x047D, 0x047E,
+            0x047F, 0x0480, 0x0481, 0x0482, 0x0483, 0x0488, 0x048A, 0x048B, 0x048C, 0x048D, 0x048E, 0x048F,
+            0x0490, 0x0491, 0x0492, 0x0493, 0x0494, 0x0495, 0x0496, 0x0497, 0x0498, 0x0499, 0x049A, 0x049B,
+            0x049C, 0x049D, 0x049E, 0x049F, 0x04A0, 0x04A1, 0x04A2, 0x04A3, 0x04A4, 0x04A5, 0x04A6, 0x04A7,
+            0x04A8, 0x04A9, 0x04AA, 0x04AB, 0x04AC, 0x04AD, 0x04AE, 0x04AF, 0x04B0, 0x04B1, 0x04B2, 0x04B3,
+            0x04B4, 0x04B5, 0x04B6, 0x04B7, 0x04B8, 0x04B9, 0x04BA, 0x04BB, 0x04BC, 0x04BD, 0x04BE, 0x04BF,
+            0x04C0, 0x04C2, 0x04C3, 0x04C4, 0x04C5, 0x04C6, 0x04C7, 0x04C8, 0x04C9, 0x04CA, 0x04CB, 0x04CC,
+            0x04CD, 0x04CE, 0x04D0, 0x04D1, 0x04D2, 0x04D3, 0x04D4, 0x04D5, 0x04D6, 0x04D7, 0x04D8, 0x04D9,
+            0x04DA, 0x04DB, 0x04DC, 0x04DD, 0x04DE, 0x04DF, 0x04E0, 0x04E1, 0x04E2, 0x04E3, 0x04E4, 0x04E5,
+            0x04E6, 0x04E7, 0x04E8, 0x04E9, 0x04EA, 0x04EB, 0x04EC, 0x04ED, 0x04EE, 0x04EF, 0x04F0, 0x04F1,
+            0x04F2, 0x04F3, 0x04F4, 0x04F5, 0x04F6, 0x04F7, 0x04F8, 0x04F9, 0x04FA, 0x04FB, 0x04FC, 0x04FD,
+            0x04FE, 0x04FF, 0x0500, 0x0501, 0x0502, 0x0503, 0x0504, 0x0505, 0x0506, 0x0507, 0x0508, 0x0509,
+            0x050A, 0x050B, 0x050C, 0x050D, 0x050E, 0x050F, 0x0510, 0x0511, 0x0512, 0x0513, 0x0514, 0x0515,
+            0x0516, 0x0517, 0x0518, 0x0519, 0x051A, 0x051B, 0x051C, 0x051D, 0x051E, 0x051F, 0x0520, 0x0521,
+            0x0522, 0x0523, 0x0524, 0x0525, 0x0526, 0x0527, 0x0528, 0x0529, 0x052A, 0x052B, 0x052C, 0x052D,
+            0x052E, 0x052F, 0x0530, 0x0531, 0x0557, 0x0559, 0x055A, 0x0560, 0x0589, 0x058A, 0x058B, 0x058D,
+            0x058F, 0x0590, 0x0591, 0x05BE, 0x05BF, 0x05C0, 0x05C1, 0x05C3, 0x05C4, 0x05C6, 0x05C7, 0x05C8,
+            0x05D0, 0x05EB, 0x05EF, 0x05F3, 0x05F5, 0x0600, 0x0606, 0x0609, 0x060B, 0x060C, 0x060E, 0x0610,
+            0x061B, 0x061C, 0x061D, 0x0620, 0x0640, 0x0641, 0x064B, 0x0660, 0x066A, 0x066E, 0x0670, 0x0671,
+            0x06D4, 0x06D5, 0x06D6, 0x06DD, 0x06DE, 0x06DF, 0x06E5, 0x06E7, 0x06E9, 0x06EA, 0x06EE, 0x06F0,
+            0x06FA, 0x06FD, 0x06FF, 0x0700, 0x070E, 0x070F, 0x0710, 0x0711, 0x0712, 0x0730, 0x074B, 0x074D,
+            0x07A6, 0x07B1, 0x07B2, 0x07C0, 0x07CA, 0x07EB, 0x07F4, 0x07F6, 0x07F7, 0x07FA, 0x07FB, 0x07FD,
+            0x07FE, 0x0800, 0x0816, 0x081A, 0x081B, 0x0824, 0x0825, 0x0828, 0x0829, 0x082E, 0x0830, 0x083F,
+            0x0840, 0x0859, 0x085C, 0x085E, 0x085F, 0x0860, 0x086B, 0x0870, 0x0888, 0x0889, 0x088F, 0x0890,
+            0x0892, 0x0898, 0x08A0, 0x08C9, 0x08CA, 0x08E2, 0x08E3, 0x0903, 0x0904, 0x093A, 0x093B, 0x093C,
+            0x093D, 0x093E, 0x0941, 0x0949, 0x094D, 0x094E, 0x0950, 0x0951, 0x0958, 0x0962, 0x0964, 0x0966,
+            0x0970, 0x0971, 0x0972, 0x0981, 0x0982, 0x0984, 0x0985, 0x098D, 0x098F, 0x0991, 0x0993, 0x09A9,
+            0x09AA, 0x09B1, 0x09B2, 0x09B3, 0x09B6, 0x09BA, 0x09BC, 0x09BD, 0x09BE, 0x09C1, 0x09C5, 0x09C7,
+            0x09C9, 0x09CB, 0x09CD, 0x09CE, 0x09CF, 0x09D7, 0x09D8, 0x09DC, 0x09DE, 0x09DF, 0x09E2, 0x09E4,
+            0x09E6, 0x09F0, 0x09F2, 0x09F4, 0x09FA, 0x09FB, 0x09FC, 0x09FD, 0x09FE, 0x09FF, 0x0A01, 0x0A03,
+            0x0A04, 0x0A05, 0x0A0B, 0x0A0F, 0x0A11, 0x0A13, 0x0A29, 0x0A2A, 0x0A31, 0x0A32, 0x0A34, 0x0A35,
+            0x0A37, 0x0A38, 0x0A3A, 0x0A3C, 0x0A3D, 0x0A3E, 0x0A41, 0x0A43, 0x0A47, 0x0A49, 0x0A4B, 0x0A4E,
+            0x0A51, 0x0A52, 0x0A59, 0x0A5D, 0x0A5E, 0x0A5F, 0x0A66, 0x0A70, 0x0A72, 0x0A75, 0x0A76, 0x0A77,
+            0x0A81, 0x0A83, 0x0A84, 0x0A85, 0x0A8E, 0x0A8F, 0x0A92, 0x0A93, 0x0AA9, 0x0AAA, 0x0AB1, 0x0AB2,
+            0x0AB4, 0x0AB5, 0x0ABA, 0x0ABC, 0x0ABD, 0x0ABE, 0x0AC1, 0x0AC6, 0x0AC7, 0x0AC9, 0x0ACA, 0x0ACB,
+            0x0ACD, 0x0ACE, 0x0AD0, 0x0AD1, 0x0AE0, 0x0AE2, 0x0AE4, 0x0AE6, 0x0AF0, 0x0AF1, 0x0AF2, 0x0AF9,
+            0x0AFA, 0x0B00, 0x0B01, 0x0B02, 0x0B04, 0x0B05, 0x0B0D, 0x0B0F, 0x0B11, 0x0B13, 0x0B29, 0x0B2A,
+            0x0B31, 0x0B32, 0x0B34, 0x0B35, 0x0B3A, 0x0B3C, 0x0B3D, 0x0B3E, 0x0B3F, 0x0B40, 0x0B41, 0x0B45,
+            0x0B47, 0x0B49, 0x0B4B, 0x0B4D, 0x0B4E, 0x0B55, 0x0B57, 0x0B58, 0x0B5C, 0x0B5E, 0x0B5F, 0x0B62,
+            0x0B64, 0x0B66, 0x0B70, 0x0B71, 0x0B72, 0x0B78, 0x0B82, 0x0B83, 0x0B84, 0x0B85, 0x0B8B, 0x0B8E,
+            0x0B91, 0x0B92, 0x0B96, 0x0B99, 0x0B9B, 0x0B9C, 0x0B9D, 0x0B9E, 0x0BA0, 0x0BA3, 0x0BA5, 0x0BA8,
+            0x0BAB, 0x0BAE, 0x0BBA, 0x0BBE, 0x0BC0, 0x0BC1, 0x0BC3, 0x0BC6, 0x0BC9, 0x0BCA, 0x0BCD, 0x0BCE,
+            0x0BD0, 0x0BD1, 0x0BD7, 0x0BD8, 0x0BE6, 0x0BF0, 0x0BF3, 0x0BF9, 0x0BFA, 0x0BFB, 0x0C00, 0x0C01,
+            0x0C04, 0x0C05, 0x0C0D, 0x0C0E, 0x0C11, 0x0C12, 0x0C29, 0x0C2A, 0x0C3A, 0x0C3C, 0x0C3D, 0x0C3E,
+            0x0C41, 0x0C45, 0x0C46, 0x0C49, 0x0C4A, 0x0C4E, 0x0C55, 0x0C57, 0x0C58, 0x0C5B, 0x0C5D, 0x0C5E,
+            0x0C60, 0x0C62, 0x0C64, 0x0C66, 0x0C70, 0x0C77, 0x0C78, 0x0C7F, 0x0C80, 0x0C81, 0x0C82, 0x0C84,
+            0x0C85, 0x0C8D, 0x0C8E, 0x0C91, 0x0C92, 0x0CA9, 0x0CAA, 0x0CB4, 0x0CB5, 0x0CBA, 0x0CBC, 0x0CBD,
+            0x0CBE, 0x0CBF, 0x0CC0, 0x0CC5, 0x0CC6, 0x0CC7, 0x0CC9, 0x0CCA, 0x0CCC, 0x0CCE, 0x0CD5, 0x0CD7,
+            0x0CDD, 0x0CDF, 0x0CE0, 0x0CE2, 0x0CE4, 0x0CE6, 0x0CF0, 0x0CF1, 0x0CF3, 0x0D00, 0x0D02, 0x0D04,
+            0x0D0D, 0x0D0E, 0x0D11, 0x0D12, 0x0D3B, 0x0D3D, 0x0D3E, 0x0D41, 0x0D45, 0x0D46, 0x0D49, 0x0D4A,
+            0x0D4D, 0x0D4E, 0x0D4F, 0x0D50, 0x0D54, 0x0D57, 0x0D58, 0x0D5F, 0x0D62, 0x0D64, 0x0D66, 0x0D70,
+            0x0D79, 0x0D7A, 0x0D80, 0x0D81, 0x0D82, 0x0D84, 0x0D85, 0x0D97, 0x0D9A, 0x0DB2, 0x0DB3, 0x0DBC,
+            0x0DBD, 0x0DBE, 0x0DC0, 0x0DC7, 0x0DCA, 0x0DCB, 0x0DCF, 0x0DD2, 0x0DD5, 0x0DD6, 0x0DD7, 0x0DD8,
+            0x0DE0, 0x0DE6, 0x0DF0, 0x0DF2, 0x0DF4, 0x0DF5, 0x0E01, 0x0E31, 0x0E32, 0x0E34, 0x0E3B, 0x0E3F,
+            0x0E40, 0x0E46, 0x0E47, 0x0E4F, 0x0E50, 0x0E5A, 0x0E5C, 0x0E81, 0x0E83, 0x0E84, 0x0E85, 0x0E86,
+            0x0E8B, 0x0E8C, 0x0EA4, 0x0EA5, 0x0EA6, 0x0EA7, 0x0EB1, 0x0EB2, 0x0EB4, 0x0EBD, 0x0EBE, 0x0EC0,
+            0x0EC5, 0x0EC6, 0x0EC7, 0x0EC8, 0x0ECE, 0x0ED0, 0x0EDA, 0x0EDC, 0x0EE0, 0x0F00, 0x0F01, 0x0F04,
+            0x0F13, 0x0F14, 0x0F15, 0x0F18, 0x0F1A, 0x0F20, 0x0F2A, 0x0F34, 0x0F35, 0x0F36, 0x0F37, 0x0F38,
+            0x0F39, 0x0F3A, 0x0F3B, 0x0F3C, 0x0F3D, 0x0F3E, 0x0F40, 0x0F48, 0x0F49, 0x0F6D, 0x0F71, 0x0F7F,
+            0x0F80, 0x0F85, 0x0F86, 0x0F88, 0x0F8D, 0x0F98, 0x0F99, 0x0FBD, 0x0FBE, 0x0FC6, 0x0FC7, 0x0FCD,
+            0x0FCE, 0x0FD0, 0x0FD5, 0x0FD9, 0x0FDB, 0x1000, 0x102B, 0x102D, 0x1031, 0x1032, 0x1038, 0x1039,
+            0x103B, 0x103D, 0x103F, 0x1040, 0x104A, 0x1050, 0x1056, 0x1058, 0x105A, 0x105E, 0x1061, 0x1062,
+            0x1065, 0x1067, 0x106E, 0x1071, 0x1075, 0x1082, 0x1083, 0x1085, 0x1087, 0x108D, 0x108E, 0x108F,
+            0x1090, 0x109A, 0x109D, 0x109E, 0x10A0, 0x10C6, 0x10C7, 0x10C8, 0x10CD, 0x10CE, 0x10D0, 0x10FB,
+            0x10FC, 0x10FD, 0x1100, 0x1249, 0x124A, 0x124E, 0x1250, 0x1257, 0x1258, 0x1259, 0x125A, 0x125E,
+            0x1260, 0x1289, 0x128A, 0x128E, 0x1290, 0x12B1, 0x12B2, 0x12B6, 0x12B8, 0x12BF, 0x12C0, 0x12C1,
+            0x12C2, 0x12C6, 0x12C8, 0x12D7, 0x12D8, 0x1311, 0x1312, 0x1316, 0x1318, 0x135B, 0x135D, 0x1360,
+            0x1369, 0x137D, 0x1380, 0x1390, 0x139A, 0x13A0, 0x13F6, 0x13F8, 0x13FE, 0x1400, 0x1401, 0x166D,
+            0x166E, 0x166F, 0x1680, 0x1681, 0x169B, 0x169C, 0x169D, 0x16A0, 0x16EB, 0x16EE, 0x16F1, 0x16F9,
+            0x1700, 0x1712, 0x1715, 0x1716, 0x171F, 0x1732, 0x1734, 0x1735, 0x1737, 0x1740, 0x1752, 0x1754,
+            0x1760, 0x176D, 0x176E, 0x1771, 0x1772, 0x1774, 0x1780, 0x17B4, 0x17B6, 0x17B7, 0x17BE, 0x17C6,
+            0x17C7, 0x17C9, 0x17D4, 0x17D7, 0x17D8, 0x17DB, 0x17DC, 0x17DD, 0x17DE, 0x17E0, 0x17EA, 0x17F0,
+            0x17FA, 0x1800, 0x1806, 0x1807, 0x180B, 0x180E, 0x180F, 0x1810, 0x181A, 0x1820, 0x1843, 0x1844,
+            0x1879, 0x1880, 0x1885, 0x1887, 0x18A9, 0x18AA, 0x18AB, 0x18B0, 0x18F6, 0x1900, 0x191F, 0x1920,
+            0x1923, 0x1927, 0x1929, 0x192C, 0x1930, 0x1932, 0x1933, 0x1939, 0x193C, 0x1940, 0x1941, 0x1944,
+            0x1946, 0x1950, 0x196E, 0x1970, 0x1975, 0x1980, 0x19AC, 0x19B0, 0x19CA, 0x19D0, 0x19DA, 0x19DB,
+            0x19DE, 0x1A00, 0x1A17, 0x1A19, 0x1A1B, 0x1A1C, 0x1A1E, 0x1A20, 0x1A55, 0x1A56, 0x1A57, 0x1A58,
+            0x1A5F, 0x1A60, 0x1A61, 0x1A62, 0x1A63, 0x1A65, 0x1A6D, 0x1A73, 0x1A7D, 0x1A7F, 0x1A80, 0x1A8A,
+            0x1A90, 0x1A9A, 0x1AA0, 0x1AA7, 0x1AA8, 0x1AAE, 0x1AB0, 0x1ABE, 0x1ABF, 0x1ACF, 0x1B00, 0x1B04,
+            0x1B05, 0x1B34, 0x1B35, 0x1B36, 0x1B3B, 0x1B3C, 0x1B3D, 0x1B42, 0x1B43, 0x1B45, 0x1B4D, 0x1B50,
+            0x1B5A, 0x1B61, 0x1B6B, 0x1B74, 0x1B7D, 0x1B7F, 0x1B80, 0x1B82, 0x1B83, 0x1BA1, 0x1BA2, 0x1BA6,
+            0x1BA8, 0x1BAA, 0x1BAB, 0x1BAE, 0x1BB0, 0x1BBA, 0x1BE6, 0x1BE7, 0x1BE8, 0x1BEA, 0x1BED, 0x1BEE,
+            0x1BEF, 0x1BF2, 0x1BF4, 0x1BFC, 0x1C00, 0x1C24, 0x1C2C, 0x1C34, 0x1C36, 0x1C38, 0x1C3B, 0x1C40,
+            0x1C4A, 0x1C4D, 0x1C50, 0x1C5A, 0x1C78, 0x1C7E, 0x1C80, 0x1C89, 0x1C90, 0x1CBB, 0x1CBD, 0x1CC0,
+            0x1CC8, 0x1CD0, 0x1CD3, 0x1CD4, 0x1CE1, 0x1CE2, 0x1CE9, 0x1CED, 0x1CEE, 0x1CF4, 0x1CF5, 0x1CF7,
+            0x1CF8, 0x1CFA, 0x1CFB, 0x1D00, 0x1D2C, 0x1D6B, 0x1D78, 0x1D79, 0x1D9B, 0x1DC0, 0x1E00, 0x1E01,
+            0x1E02, 0x1E03, 0x1E04, 0x1E05, 0x1E06, 0x1E07, 0x1E08, 0x1E09, 0x1E0A, 0x1E0B, 0x1E0C, 0x1E0D,
+            0x1E0E, 0x1E0F, 0x1E10, 0x1E11, 0x1E12, 0x1E13, 0x1E14, 0x1E15, 0x1E16, 0x1E17, 0x1E18, 0x1E19,
+            0x1E1A, 0x1E1B, 0x1E1C, 0x1E1D, 0x1E1E, 0x1E1F, 0x1E20, 0x1E21, 0x1E22, 0x1E23, 0x1E24, 0x1E25,
+            0x1E26, 0x1E27, 0x1E28, 0x1E29, 0x1E2A, 0x1E2B, 0x1E2C, 0x1E2D, 0x1E2E, 0x1E2F, 0x1E30, 0x1E31,
+            0x1E32, 0x1E33, 0x1E34, 0x1E35, 0x1E36, 0x1E37, 0x1E38, 0x1E39, 0x1E3A, 0x1E3B, 0x1E3C, 0x1E3D,
+            0x1E3E, 0x1E3F, 0x1E40, 0x1E41, 0x1E42, 0x1E43, 0x1E44, 0x1E45, 0x1E46, 0x1E47, 0x1E48, 0x1E49,
+            0x1E4A, 0x1E4B, 0x1E4C, 0x1E4D, 0x1E4E, 0x1E4F, 0x1E50, 0x1E51, 0x1E52, 0x1E53, 0x1E54, 0x1E55,
+            0x1E56, 0x1E57, 0x1E58, 0x1E59, 0x1E5A, 0x1E5B, 0x1E5C, 0x1E5D, 0x1E5E, 0x1E5F, 0x1E60, 0x1E61,
+            0x1E62, 0x1E63, 0x1E64, 0x1E65, 0x1E66, 0x1E67, 0x1E68, 0x1E69, 0x1E6A, 0x1E6B, 0x1E6C, 0x1E6D,
+            0x1E6E, 0x1E6F, 0x1E70, 0x1E71, 0x1E72, 0x1E73, 0x1E74, 0x1E75, 0x1E76, 0x1E77, 0x1E78, 0x1E79,
+            0x1E7A, 0x1E7B, 0x1E7C, 0x1E7D, 0x1E7E, 0x1E7F, 0x1E80, 0x1E81, 0x1E82, 0x1E83, 0x1E84, 0x1E85,
+            0x1E86, 0x1E87, 0x1E88, 0x1E89, 0x1E8A, 0x1E8B, 0x1E8C, 0x1E8D, 0x1E8E, 0x1E8F, 0x1E90, 0x1E91,
+            0x1E92, 0x1E93, 0x1E94, 0x1E95, 0x1E9E, 0x1E9F, 0x1EA0, 0x1EA1, 0x1EA2, 0x1EA3, 0x1EA4, 0x1EA5,
+            0x1EA6, 0x1EA7, 0x1EA8, 0x1EA9, 0x1EAA, 0x1EAB, 0x1EAC, 0x1EAD, 0x1EAE, 0x1EAF, 0x1EB0, 0x1EB1,
+            0x1EB2, 0x1EB3, 0x1EB4, 0x1EB5, 0x1EB6, 0x1EB7, 0x1EB8, 0x1EB9, 0x1EBA, 0x1EBB, 0x1EBC, 0x1EBD,
+            0x1EBE, 0x1EBF, 0x1EC0, 0x1EC1, 0x1EC2, 0x1EC3, 0x1EC4, 0x1EC5, 0x1EC6, 0x1EC7, 0x1EC8, 0x1EC9,
+            0x1ECA, 0x1ECB, 0x1ECC, 0x1ECD, 0x1ECE, 0x1ECF, 0x1ED0, 0x1ED1, 0x1ED2, 0x1ED3, 0x1ED4, 0x1ED5,
+            0x1ED6, 0x1ED7, 0x1ED8, 0x1ED9, 0x1EDA, 0x1EDB, 0x1EDC, 0x1EDD, 0x1EDE, 0x1EDF, 0x1EE0, 0x1EE1,
+            0x1EE2, 0x1EE3, 0x1EE4, 0x1EE5, 0x1EE6, 0x1EE7, 0x1EE8, 0x1EE9, 0x1EEA, 0x1EEB, 0x1EEC, 0x1EED,
+            0x1EEE, 0x1EEF, 0x1EF0, 0x1EF1, 0x1EF2, 0x1EF3, 0x1EF4, 0x1EF5, 0x1EF6, 0x1EF7, 0x1EF8, 0x1EF9,
+            0x1EFA, 0x1EFB, 0x1EFC, 0x1EFD, 0x1EFE, 0x1EFF, 0x1F08, 0x1F10, 0x1F16, 0x1F18, 0x1F1E, 0x1F20,
+            0x1F28, 0x1F30, 0x1F38, 0x1F40, 0x1F46, 0x1F48, 0x1F4E, 0x1F50, 0x1F58, 0x1F59, 0x1F5A, 0x1F5B,
+            0x1F5C, 0x1F5D, 0x1F5E, 0x1F5F, 0x1F60, 0x1F68, 0x1F70, 0x1F7E, 0x1F80, 0x1F88, 0x1F90, 0x1F98,
+            0x1FA0, 0x1FA8, 0x1FB0, 0x1FB5, 0x1FB6, 0x1FB8, 0x1FBC, 0x1FBD, 0x1FBE, 0x1FBF, 0x1FC2, 0x1FC5,
+            0x1FC6, 0x1FC8, 0x1FCC, 0x1FCD, 0x1FD0, 0x1FD4, 0x1FD6, 0x1FD8, 0x1FDC, 0x1FDD, 0x1FE0, 0x1FE8,
+            0x1FED, 0x1FF0, 0x1FF2, 0x1FF5, 0x1FF6, 0x1FF8, 0x1FFC, 0x1FFD, 0x1FFF, 0x2000, 0x200B, 0x2010,
+            0x2016, 0x2018, 0x2019, 0x201A, 0x201B, 0x201D, 0x201E, 0x201F, 0x2020, 0x2028, 0x2029, 0x202A,
+            0x202F, 0x2030, 0x2039, 0x203A, 0x203B, 0x203F, 0x2041, 0x2044, 0x2045, 0x2046, 0x2047, 0x2052,
+            0x2053, 0x2054, 0x2055, 0x205F, 0x2060, 0x2065, 0x2066, 0x2070, 0x2071, 0x2072, 0x2074, 0x207A,
+            0x207D, 0x207E, 0x207F, 0x2080, 0x208A, 0x208D, 0x208E, 0x208F, 0x2090, 0x209D, 0x20A0, 0x20C1,
+            0x20D0, 0x20DD, 0x20E1, 0x20E2, 0x20E5, 0x20F1, 0x2100, 0x2102, 0x2103, 0x2107, 0x2108, 0x210A,
+            0x210B, 0x210E, 0x2110, 0x2113, 0x2114, 0x2115, 0x2116, 0x2118, 0x2119, 0x211E, 0x2124, 0x2125,
+            0x2126, 0x2127, 0x2128, 0x2129, 0x212A, 0x212E, 0x212F, 0x2130, 0x2134, 0x2135, 0x2139, 0x213A,
+            0x213C, 0x213E, 0x2140, 0x2145, 0x2146, 0x214A, 0x214B, 0x214C, 0x214E, 0x214F, 0x2150, 0x2160,
+            0x2183, 0x2184, 0x2185, 0x2189, 0x218A, 0x218C, 0x2190, 0x2195, 0x219A, 0x219C, 0x21A0, 0x21A1,
+            0x21A3, 0x21A4, 0x21A6, 0x21A7, 0x21AE, 0x21AF, 0x21CE, 0x21D0, 0x21D2, 0x21D3, 0x21D4, 0x21D5,
+            0x21F4, 0x2300, 0x2308, 0x2309, 0x230A, 0x230B, 0x230C, 0x2320, 0x2322, 0x2329, 0x232A, 0x232B,
+            0x237C, 0x237D, 0x239B, 0x23B4, 0x23DC, 0x23E2, 0x2427, 0x2440, 0x244B, 0x2460, 0x249C, 0x24EA,
+            0x2500, 0x25B7, 0x25B8, 0x25C1, 0x25C2, 0x25F8, 0x2600, 0x266F, 0x2670, 0x2768, 0x2769, 0x276A,
+            0x276B, 0x276C, 0x276D, 0x276E, 0x276F, 0x2770, 0x2771, 0x2772, 0x2773, 0x2774, 0x2775, 0x2776,
+            0x2794, 0x27C0, 0x27C5, 0x27C6, 0x27C7, 0x27E6, 0x27E7, 0x27E8, 0x27E9, 0x27EA, 0x27EB, 0x27EC,
+            0x27ED, 0x27EE, 0x27EF, 0x27F0, 0x2800, 0x2900, 0x2983, 0x2984, 0x2985, 0x2986, 0x2987, 0x2988,
+            0x2989, 0x298A, 0x298B, 0x298C, 0x298D, 0x298E, 0x298F, 0x2990, 0x2991, 0x2992, 0x2993, 0x2994,
+            0x2995, 0x2996, 0x2997, 0x2998, 0x2999, 0x29D8, 0x29D9, 0x29DA, 0x29DB, 0x29DC, 0x29FC, 0x29FD,
+            0x29FE, 0x2B00, 0x2B30, 0x2B45, 0x2B47, 0x2B4D, 0x2B74, 0x2B76, 0x2B96, 0x2B97, 0x2C00, 0x2C30,
+            0x2C60, 0x2C61, 0x2C62, 0x2C65, 0x2C67, 0x2C68, 0x2C69, 0x2C6A, 0x2C6B, 0x2C6C, 0x2C6D, 0x2C71,
+            0x2C72, 0x2C73, 0x2C75, 0x2C76, 0x2C7C, 0x2C7E, 0x2C81, 0x2C82, 0x2C83, 0x2C84, 0x2C85, 0x2C86,
+            0x2C87, 0x2C88, 0x2C89, 0x2C8A, 0x2C8B, 0x2C8C, 0x2C8D, 0x2C8E, 0x2C8F, 0x2C90, 0x2C91, 0x2C92,
+            0x2C93, 0x2C94, 0x2C95, 0x2C96, 0x2C97, 0x2C98, 0x2C99, 0x2C9A, 0x2C9B, 0x2C9C, 0x2C9D, 0x2C9E,
+            0x2C9F, 0x2CA0, 0x2CA1, 0x2CA2, 0x2CA3, 0x2CA4, 0x2CA5, 0x2CA6, 0x2CA7, 0x2CA8, 0x2CA9, 0x2CAA,
+            0x2CAB, 0x2CAC, 0x2CAD, 0x2CAE, 0x2CAF, 0x2CB0, 0x2CB1, 0x2CB2, 0x2CB3, 0x2CB4, 0x2CB5, 0x2CB6,
+            0x2CB7, 0x2CB8, 0x2CB9, 0x2CBA, 0x2CBB, 0x2CBC, 0x2CBD, 0x2CBE, 0x2CBF, 0x2CC0, 0x2CC1, 0x2CC2,
+            0x2CC3, 0x2CC4, 0x2CC5, 0x2CC6, 0x2CC7, 0x2CC8, 0x2CC9, 0x2CCA, 0x2CCB, 0x2CCC, 0x2CCD, 0x2CCE,
+            0x2CCF, 0x2CD0, 0x2CD1, 0x2CD2, 0x2CD3, 0x2CD4, 0x2CD5, 0x2CD6, 0x2CD7, 0x2CD8, 0x2CD9, 0x2CDA,
+            0x2CDB, 0x2CDC, 0x2CDD, 0x2CDE, 0x2CDF, 0x2CE0, 0x2CE1, 0x2CE2, 0x2CE3, 0x2CE5, 0x2CEB, 0x2CEC,
+            0x2CED, 0x2CEE, 0x2CEF, 0x2CF2, 0x2CF3, 0x2CF4, 0x2CF9, 0x2CFD, 0x2CFE, 0x2D00, 0x2D26, 0x2D27,
+            0x2D28, 0x2D2D, 0x2D2E, 0x2D30, 0x2D68, 0x2D6F, 0x2D70, 0x2D71, 0x2D7F, 0x2D80, 0x2D97, 0x2DA0,
+            0x2DA7, 0x2DA8, 0x2DAF, 0x2DB0, 0x2DB7, 0x2DB8, 0x2DBF, 0x2DC0, 0x2DC7, 0x2DC8, 0x2DCF, 0x2DD0,
+            0x2DD7, 0x2DD8, 0x2DDF, 0x2DE0, 0x2E00, 0x2E02, 0x2E03, 0x2E04, 0x2E05, 0x2E06, 0x2E09, 0x2E0A,
+            0x2E0B, 0x2E0C, 0x2E0D, 0x2E0E, 0x2E17, 0x2E18, 0x2E1A, 0x2E1B, 0x2E1C, 0x2E1D, 0x2E1E, 0x2E20,
+            0x2E21, 0x2E22, 0x2E23, 0x2E24, 0x2E25, 0x2E26, 0x2E27, 0x2E28, 0x2E29, 0x2E2A, 0x2E2F, 0x2E30,
+            0x2E3A, 0x2E3C, 0x2E40, 0x2E41, 0x2E42, 0x2E43, 0x2E50, 0x2E52, 0x2E55, 0x2E56, 0x2E57, 0x2E58,
+            0x2E59, 0x2E5A, 0x2E5B, 0x2E5C, 0x2E5D, 0x2E5E, 0x2E80, 0x2E9A, 0x2E9B, 0x2EF4, 0x2F00, 0x2FD6,
+            0x2FF0, 0x2FFC, 0x3000, 0x3001, 0x3004, 0x3005, 0x3006, 0x3007, 0x3008, 0x3009, 0x300A, 0x300B,
+            0x300C, 0x300D, 0x300E, 0x300F, 0x3010, 0x3011, 0x3012, 0x3014, 0x3015, 0x3016, 0x3017, 0x3018,
+            0x3019, 0x301A, 0x301B, 0x301C, 0x301D, 0x301E, 0x3020, 0x3021, 0x302A, 0x302E, 0x3030, 0x3031,
+            0x3036, 0x3038, 0x303B, 0x303C, 0x303D, 0x303E, 0x3040, 0x3041, 0x3097, 0x3099, 0x309B, 0x309D,
+            0x309F, 0x30A0, 0x30A1, 0x30FB, 0x30FC, 0x30FF, 0x3100, 0x3105, 0x3130, 0x3131, 0x318F, 0x3190,
+            0x3192, 0x3196, 0x31A0, 0x31C0, 0x31E4, 0x31F0, 0x3200, 0x321F, 0x3220, 0x322A, 0x3248, 0x3250,
+            0x3251, 0x3260, 0x3280, 0x328A, 0x32B1, 0x32C0, 0x3400, 0x4DC0, 0x4E00, 0xA015, 0xA016, 0xA48D,
+            0xA490, 0xA4C7, 0xA4D0, 0xA4F8, 0xA4FE, 0xA500, 0xA60C, 0xA60D, 0xA610, 0xA620, 0xA62A, 0xA62C,
+            0xA640, 0xA641, 0xA642, 0xA643, 0xA644, 0xA645, 0xA646, 0xA647, 0xA648, 0xA649, 0xA64A, 0xA64B,
+            0xA64C, 0xA64D, 0xA64E, 0xA64F, 0xA650, 0xA651, 0xA652, 0xA653, 0xA654, 0xA655, 0xA656, 0xA657,
+            0xA658, 0xA659, 0xA65A, 0xA65B, 0xA65C, 0xA65D, 0xA65E, 0xA65F, 0xA660, 0xA661, 0xA662, 0xA663,
+            0xA664, 0xA665, 0xA666, 0xA667, 0xA668, 0xA669, 0xA66A, 0xA66B, 0xA66C, 0xA66D, 0xA66E, 0xA66F,
+            0xA670, 0xA673, 0xA674, 0xA67E, 0xA67F, 0xA680, 0xA681, 0xA682, 0xA683, 0xA684, 0xA685, 0xA686,
+            0xA687, 0xA688, 0xA689, 0xA68A, 0xA68B, 0xA68C, 0xA68D, 0xA68E, 0xA68F, 0xA690, 0xA691, 0xA692,
+            0xA693, 0xA694, 0xA695, 0xA696, 0xA697, 0xA698, 0xA699, 0xA69A, 0xA69B, 0xA69C, 0xA69E, 0xA6A0,
+            0xA6E6, 0xA6F0, 0xA6F2, 0xA6F8, 0xA700, 0xA717, 0xA720, 0xA722, 0xA723, 0xA724, 0xA725, 0xA726,
+            0xA727, 0xA728, 0xA729, 0xA72A, 0xA72B, 0xA72C, 0xA72D, 0xA72E, 0xA72F, 0xA732, 0xA733, 0xA734,
+            0xA735, 0xA736, 0xA737, 0xA738, 0xA739, 0xA73A, 0xA73B, 0xA73C, 0xA73D, 0xA73E, 0xA73F, 0xA740,
+            0xA741, 0xA742, 0xA743, 0xA744, 0xA745, 0xA746, 0xA747, 0xA748, 0xA749, 0xA74A, 0xA74B, 0xA74C,
+            0xA74D, 0xA74E, 0xA74F, 0xA750, 0xA751, 0xA752, 0xA753, 0xA754, 0xA755, 0xA756, 0xA757, 0xA758,
+            0xA759, 0xA75A, 0xA75B, 0xA75C, 0xA75D, 0xA75E, 0xA75F, 0xA760, 0xA761, 0xA762, 0xA763, 0xA764,
+            0xA765, 0xA766, 0xA767, 0xA768, 0xA769, 0xA76A, 0xA76B, 0xA76C, 0xA76D, 0xA76E, 0xA76F, 0xA770,
+            0xA771, 0xA779, 0xA77A, 0xA77B, 0xA77C, 0xA77D, 0xA77F, 0xA780, 0xA781, 0xA782, 0xA783, 0xA784,
+            0xA785, 0xA786, 0xA787, 0xA788, 0xA789, 0xA78B, 0xA78C, 0xA78D, 0xA78E, 0xA78F, 0xA790, 0xA791,
+            0xA792, 0xA793, 0xA796, 0xA797, 0xA798, 0xA799, 0xA79A, 0xA79B, 0xA79C, 0xA79D, 0xA79E, 0xA79F,
+            0xA7A0, 0xA7A1, 0xA7A2, 0xA7A3, 0xA7A4, 0xA7A5, 0xA7A6, 0xA7A7, 0xA7A8, 0xA7A9, 0xA7AA, 0xA7AF,
+            0xA7B0, 0xA7B5, 0xA7B6, 0xA7B7, 0xA7B8, 0xA7B9, 0xA7BA, 0xA7BB, 0xA7BC, 0xA7BD, 0xA7BE, 0xA7BF,
+            0xA7C0, 0xA7C1, 0xA7C2, 0xA7C3, 0xA7C4, 0xA7C8, 0xA7C9, 0xA7CA, 0xA7CB, 0xA7D0, 0xA7D1, 0xA7D2,
+            0xA7D3, 0xA7D4, 0xA7D5, 0xA7D6, 0xA7D7, 0xA7D8, 0xA7D9, 0xA7DA, 0xA7F2, 0xA7F5, 0xA7F6, 0xA7F7,
+            0xA7F8, 0xA7FA, 0xA7FB, 0xA802, 0xA803, 0xA806, 0xA807, 0xA80B, 0xA80C, 0xA823, 0xA825, 0xA827,
+            0xA828, 0xA82C, 0xA82D, 0xA830, 0xA836, 0xA838, 0xA839, 0xA83A, 0xA840, 0xA874, 0xA878, 0xA880,
+            0xA882, 0xA8B4, 0xA8C4, 0xA8C6, 0xA8CE, 0xA8D0, 0xA8DA, 0xA8E0, 0xA8F2, 0xA8F8, 0xA8FB, 0xA8FC,
+            0xA8FD, 0xA8FF, 0xA900, 0xA90A, 0xA926, 0xA92E, 0xA930, 0xA947, 0xA952, 0xA954, 0xA95F, 0xA960,
+            0xA97D, 0xA980, 0xA983, 0xA984, 0xA9B3, 0xA9B4, 0xA9B6, 0xA9BA, 0xA9BC, 0xA9BE, 0xA9C1, 0xA9CE,
+            0xA9CF, 0xA9D0, 0xA9DA, 0xA9DE, 0xA9E0, 0xA9E5, 0xA9E6, 0xA9E7, 0xA9F0, 0xA9FA, 0xA9FF, 0xAA00,
+            0xAA29, 0xAA2F, 0xAA31, 0xAA33, 0xAA35, 0xAA37, 0xAA40, 0xAA43, 0xAA44, 0xAA4C, 0xAA4D, 0xAA4E,
+            0xAA50, 0xAA5A, 0xAA5C, 0xAA60, 0xAA70, 0xAA71, 0xAA77, 0xAA7A, 0xAA7B, 0xAA7C, 0xAA7D, 0xAA7E,
+            0xAAB0, 0xAAB1, 0xAAB2, 0xAAB5, 0xAAB7, 0xAAB9, 0xAABE, 0xAAC0, 0xAAC1, 0xAAC2, 0xAAC3, 0xAADB,
+            0xAADD, 0xAADE, 0xAAE0, 0xAAEB, 0xAAEC, 0xAAEE, 0xAAF0, 0xAAF2, 0xAAF3, 0xAAF5, 0xAAF6, 0xAAF7,
+            0xAB01, 0xAB07, 0xAB09, 0xAB0F, 0xAB11, 0xAB17, 0xAB20, 0xAB27, 0xAB28, 0xAB2F, 0xAB30, 0xAB5B,
+            0xAB5C, 0xAB60, 0xAB69, 0xAB6A, 0xAB6C, 0xAB70, 0xABC0, 0xABE3, 0xABE5, 0xABE6, 0xABE8, 0xABE9,
+            0xABEB, 0xABEC, 0xABED, 0xABEE, 0xABF0, 0xABFA, 0xAC00, 0xD7A4, 0xD7B0, 0xD7C7, 0xD7CB, 0xD7FC,
+            0xD800, 0xE000, 0xF900, 0xFA6E, 0xFA70, 0xFADA, 0xFB00, 0xFB07, 0xFB13, 0xFB18, 0xFB1D, 0xFB1E,
+            0xFB1F, 0xFB29, 0xFB2A, 0xFB37, 0xFB38, 0xFB3D, 0xFB3E, 0xFB3F, 0xFB40, 0xFB42, 0xFB43, 0xFB45,
+            0xFB46, 0xFBB2, 0xFBC3, 0xFBD3, 0xFD3E, 0xFD3F, 0xFD40, 0xFD50, 0xFD90, 0xFD92, 0xFDC8, 0xFDCF,
+            0xFDD0, 0xFDF0, 0xFDFC, 0xFDFD, 0xFE00, 0xFE10, 0xFE17, 0xFE18, 0xFE19, 0xFE1A, 0xFE20, 0xFE30,
+            0xFE31, 0xFE33, 0xFE35, 0xFE36, 0xFE37, 0xFE38, 0xFE39, 0xFE3A, 0xFE3B, 0xFE3C, 0xFE3D, 0xFE3E,
+            0xFE3F, 0xFE40, 0xFE41, 0xFE42, 0xFE43, 0xFE44, 0xFE45, 0xFE47, 0xFE48, 0xFE49, 0xFE4D, 0xFE50,
+            0xFE53, 0xFE54, 0xFE58, 0xFE59, 0xFE5A, 0xFE5B, 0xFE5C, 0xFE5D, 0xFE5E, 0xFE5F, 0xFE62, 0xFE63,
+            0xFE64, 0xFE67, 0xFE68, 0xFE69, 0xFE6A, 0xFE6C, 0xFE70, 0xFE75, 0xFE76, 0xFEFD, 0xFEFF, 0xFF00,
+            0xFF01, 0xFF04, 0xFF05, 0xFF08, 0xFF09, 0xFF0A, 0xFF0B, 0xFF0C, 0xFF0D, 0xFF0E, 0xFF10, 0xFF1A,
+            0xFF1C, 0xFF1F, 0xFF21, 0xFF3B, 0xFF3C, 0xFF3D, 0xFF3E, 0xFF3F, 0xFF40, 0xFF41, 0xFF5B, 0xFF5C,
+            0xFF5D, 0xFF5E, 0xFF5F, 0xFF60, 0xFF61, 0xFF62, 0xFF63, 0xFF64, 0xFF66, 0xFF70, 0xFF71, 0xFF9E,
+            0xFFA0, 0xFFBF, 0xFFC2, 0xFFC8, 0xFFCA, 0xFFD0, 0xFFD2, 0xFFD8, 0xFFDA, 0xFFDD, 0xFFE0, 0xFFE2,
+            0xFFE3, 0xFFE4, 0xFFE5, 0xFFE7, 0xFFE8, 0xFFE9, 0xFFED, 0xFFEF, 0xFFF9, 0xFFFC, 0xFFFE, 0x10000,
+            0x1000C, 0x1000D, 0x10027, 0x10028, 0x1003B, 0x1003C, 0x1003E, 0x1003F, 0x1004E, 0x10050, 0x1005E, 0x10080,
+            0x100FB, 0x10100, 0x10103, 0x10107, 0x10134, 0x10137, 0x10140, 0x10175, 0x10179, 0x1018A, 0x1018C, 0x1018F,
+            0x10190, 0x1019D, 0x101A0, 0x101A1, 0x101D0, 0x101FD, 0x101FE, 0x10280, 0x1029D, 0x102A0, 0x102D1, 0x102E0,
+            0x102E1, 0x102FC, 0x10300, 0x10320, 0x10324, 0x1032D, 0x10341, 0x10342, 0x1034A, 0x1034B, 0x10350, 0x10376,
+            0x1037B, 0x10380, 0x1039E, 0x1039F, 0x103A0, 0x103C4, 0x103C8, 0x103D0, 0x103D1, 0x103D6, 0x10400, 0x10428,
+            0x10450, 0x1049E, 0x104A0, 0x104AA, 0x104B0, 0x104D4, 0x104D8, 0x104FC, 0x10500, 0x10528, 0x10530, 0x10564,
+            0x1056F, 0x10570, 0x1057B, 0x1057C, 0x1058B, 0x1058C, 0x10593, 0x10594, 0x10596, 0x10597, 0x105A2, 0x105A3,
+            0x105B2, 0x105B3, 0x105BA, 0x105BB, 0x105BD, 0x10600, 0x10737, 0x10740, 0x10756, 0x10760, 0x10768, 0x10780,
+            0x10786, 0x10787, 0x107B1, 0x107B2, 0x107BB, 0x10800, 0x10806, 0x10808, 0x10809, 0x1080A, 0x10836, 0x10837,
+            0x10839, 0x1083C, 0x1083D, 0x1083F, 0x10856, 0x10857, 0x10858, 0x10860, 0x10877, 0x10879, 0x10880, 0x1089F,
+            0x108A7, 0x108B0, 0x108E0, 0x108F3, 0x108F4, 0x108F6, 0x108FB, 0x10900, 0x10916, 0x1091C, 0x1091F, 0x10920,
+            0x1093A, 0x1093F, 0x10940, 0x10980, 0x109B8, 0x109BC, 0x109BE, 0x109C0, 0x109D0, 0x109D2, 0x10A00, 0x10A01,
+            0x10A04, 0x10A05, 0x10A07, 0x10A0C, 0x10A10, 0x10A14, 0x10A15, 0x10A18, 0x10A19, 0x10A36, 0x10A38, 0x10A3B,
+            0x10A3F, 0x10A40, 0x10A49, 0x10A50, 0x10A59, 0x10A60, 0x10A7D, 0x10A7F, 0x10A80, 0x10A9D, 0x10AA0, 0x10AC0,
+            0x10AC8, 0x10AC9, 0x10AE5, 0x10AE7, 0x10AEB, 0x10AF0, 0x10AF7, 0x10B00, 0x10B36, 0x10B39, 0x10B40, 0x10B56,
+            0x10B58, 0x10B60, 0x10B73, 0x10B78, 0x10B80, 0x10B92, 0x10B99, 0x10B9D, 0x10BA9, 0x10BB0, 0x10C00, 0x10C49,
+            0x10C80, 0x10CB3, 0x10CC0, 0x10CF3, 0x10CFA, 0x10D00, 0x10D24, 0x10D28, 0x10D30, 0x10D3A, 0x10E60, 0x10E7F,
+            0x10E80, 0x10EAA, 0x10EAB, 0x10EAD, 0x10EAE, 0x10EB0, 0x10EB2, 0x10F00, 0x10F1D, 0x10F27, 0x10F28, 0x10F30,
+            0x10F46, 0x10F51, 0x10F55, 0x10F5A, 0x10F70, 0x10F82, 0x10F86, 0x10F8A, 0x10FB0, 0x10FC5, 0x10FCC, 0x10FE0,
+            0x10FF7, 0x11000, 0x11001, 0x11002, 0x11003, 0x11038, 0x11047, 0x1104E, 0x11052, 0x11066, 0x11070, 0x11071,
+            0x11073, 0x11075, 0x11076, 0x1107F, 0x11082, 0x11083, 0x110B0, 0x110B3, 0x110B7, 0x110B9, 0x110BB, 0x110BD,
+            0x110BE, 0x110C2, 0x110C3, 0x110CD, 0x110CE, 0x110D0, 0x110E9, 0x110F0, 0x110FA, 0x11100, 0x11103, 0x11127,
+            0x1112C, 0x1112D, 0x11135, 0x11136, 0x11140, 0x11144, 0x11145, 0x11147, 0x11148, 0x11150, 0x11173, 0x11174,
+            0x11176, 0x11177, 0x11180, 0x11182, 0x11183, 0x111B3, 0x111B6, 0x111BF, 0x111C1, 0x111C5, 0x111C9, 0x111CD,
+            0x111CE, 0x111CF, 0x111D0, 0x111DA, 0x111DB, 0x111DC, 0x111DD, 0x111E0, 0x111E1, 0x111F5, 0x11200, 0x11212,
+            0x11213, 0x1122C, 0x1122F, 0x11232, 0x11234, 0x11235, 0x11236, 0x11238, 0x1123E, 0x1123F, 0x11280, 0x11287,
+            0x11288, 0x11289, 0x1128A, 0x1128E, 0x1128F, 0x1129E, 0x1129F, 0x112A9, 0x112AA, 0x112B0, 0x112DF, 0x112E0,
+            0x112E3, 0x112EB, 0x112F0, 0x112FA, 0x11300, 0x11302, 0x11304, 0x11305, 0x1130D, 0x1130F, 0x11311, 0x11313,
+            0x11329, 0x1132A, 0x11331, 0x11332, 0x11334, 0x11335, 0x1133A, 0x1133B, 0x1133D, 0x1133E, 0x11340, 0x11341,
+            0x11345, 0x11347, 0x11349, 0x1134B, 0x1134E, 0x11350, 0x11351, 0x11357, 0x11358, 0x1135D, 0x11362, 0x11364,
+            0x11366, 0x1136D, 0x11370, 0x11375, 0x11400, 0x11435, 0x11438, 0x11440, 0x11442, 0x11445, 0x11446, 0x11447,
+            0x1144B, 0x11450, 0x1145A, 0x1145C, 0x1145D, 0x1145E, 0x1145F, 0x11462, 0x11480, 0x114B0, 0x114B3, 0x114B9,
+            0x114BA, 0x114BB, 0x114BF, 0x114C1, 0x114C2, 0x114C4, 0x114C6, 0x114C7, 0x114C8, 0x114D0, 0x114DA, 0x11580,
+            0x115AF, 0x115B2, 0x115B6, 0x115B8, 0x115BC, 0x115BE, 0x115BF, 0x115C1, 0x115D8, 0x115DC, 0x115DE, 0x11600,
+            0x11630, 0x11633, 0x1163B, 0x1163D, 0x1163E, 0x1163F, 0x11641, 0x11644, 0x11645, 0x11650, 0x1165A, 0x11660,
+            0x1166D, 0x11680, 0x116AB, 0x116AC, 0x116AD, 0x116AE, 0x116B0, 0x116B6, 0x116B7, 0x116B8, 0x116B9, 0x116BA,
+            0x116C0, 0x116CA, 0x11700, 0x1171B, 0x1171D, 0x11720, 0x11722, 0x11726, 0x11727, 0x1172C, 0x11730, 0x1173A,
+            0x1173C, 0x1173F, 0x11740, 0x11747, 0x11800, 0x1182C, 0x1182F, 0x11838, 0x11839, 0x1183B, 0x1183C, 0x118A0,
+            0x118C0, 0x118E0, 0x118EA, 0x118F3, 0x118FF, 0x11907, 0x11909, 0x1190A, 0x1190C, 0x11914, 0x11915, 0x11917,
+            0x11918, 0x11930, 0x11936, 0x11937, 0x11939, 0x1193B, 0x1193D, 0x1193E, 0x1193F, 0x11940, 0x11941, 0x11942,
+            0x11943, 0x11944, 0x11947, 0x11950, 0x1195A, 0x119A0, 0x119A8, 0x119AA, 0x119D1, 0x119D4, 0x119D8, 0x119DA,
+            0x119DC, 0x119E0, 0x119E1, 0x119E2, 0x119E3, 0x119E4, 0x119E5, 0x11A00, 0x11A01, 0x11A0B, 0x11A33, 0x11A39,
+            0x11A3A, 0x11A3B, 0x11A3F, 0x11A47, 0x11A48, 0x11A50, 0x11A51, 0x11A57, 0x11A59, 0x11A5C, 0x11A8A, 0x11A97,
+            0x11A98, 0x11A9A, 0x11A9D, 0x11A9E, 0x11AA3, 0x11AB0, 0x11AF9, 0x11C00, 0x11C09, 0x11C0A, 0x11C2F, 0x11C30,
+            0x11C37, 0x11C38, 0x11C3E, 0x11C3F, 0x11C40, 0x11C41, 0x11C46, 0x11C50, 0x11C5A, 0x11C6D, 0x11C70, 0x11C72,
+            0x11C90, 0x11C92, 0x11CA8, 0x11CA9, 0x11CAA, 0x11CB1, 0x11CB2, 0x11CB4, 0x11CB5, 0x11CB7, 0x11D00, 0x11D07,
+            0x11D08, 0x11D0A, 0x11D0B, 0x11D31, 0x11D37, 0x11D3A, 0x11D3B, 0x11D3C, 0x11D3E, 0x11D3F, 0x11D46, 0x11D47,
+            0x11D48, 0x11D50, 0x11D5A, 0x11D60, 0x11D66, 0x11D67, 0x11D69, 0x11D6A, 0x11D8A, 0x11D8F, 0x11D90, 0x11D92,
+            0x11D93, 0x11D95, 0x11D96, 0x11D97, 0x11D98, 0x11D99, 0x11DA0, 0x11DAA, 0x11EE0, 0x11EF3, 0x11EF5, 0x11EF7,
+            0x11EF9, 0x11FB0, 0x11FB1, 0x11FC0, 0x11FD5, 0x11FDD, 0x11FE1, 0x11FF2, 0x11FFF, 0x12000, 0x1239A, 0x12400,
+            0x1246F, 0x12470, 0x12475, 0x12480, 0x12544, 0x12F90, 0x12FF1, 0x12FF3, 0x13000, 0x1342F, 0x13430, 0x13439,
+            0x14400, 0x14647, 0x16800, 0x16A39, 0x16A40, 0x16A5F, 0x16A60, 0x16A6A, 0x16A6E, 0x16A70, 0x16ABF, 0x16AC0,
+            0x16ACA, 0x16AD0, 0x16AEE, 0x16AF0, 0x16AF5, 0x16AF6, 0x16B00, 0x16B30, 0x16B37, 0x16B3C, 0x16B40, 0x16B44,
+            0x16B45, 0x16B46, 0x16B50, 0x16B5A, 0x16B5B, 0x16B62, 0x16B63, 0x16B78, 0x16B7D, 0x16B90, 0x16E40, 0x16E60,
+            0x16E80, 0x16E97, 0x16E9B, 0x16F00, 0x16F4B, 0x16F4F, 0x16F50, 0x16F51, 0x16F88, 0x16F8F, 0x16F93, 0x16FA0,
+            0x16FE0, 0x16FE2, 0x16FE3, 0x16FE4, 0x16FE5, 0x16FF0, 0x16FF2, 0x17000, 0x187F8, 0x18800, 0x18CD6, 0x18D00,
+            0x18D09, 0x1AFF0, 0x1AFF4, 0x1AFF5, 0x1AFFC, 0x1AFFD, 0x1AFFF, 0x1B000, 0x1B123, 0x1B150, 0x1B153, 0x1B164,
+            0x1B168, 0x1B170, 0x1B2FC, 0x1BC00, 0x1BC6B, 0x1BC70, 0x1BC7D, 0x1BC80, 0x1BC89, 0x1BC90, 0x1BC9A, 0x1BC9C,
+            0x1BC9D, 0x1BC9F, 0x1BCA0, 0x1BCA4, 0x1CF00, 0x1CF2E, 0x1CF30, 0x1CF47, 0x1CF50, 0x1CFC4, 0x1D000, 0x1D0F6,
+            0x1D100, 0x1D127, 0x1D129, 0x1D165, 0x1D167, 0x1D16A, 0x1D16D, 0x1D173, 0x1D17B, 0x1D183, 0x1D185, 0x1D18C,
+            0x1D1AA, 0x1D1AE, 0x1D1EB, 0x1D200, 0x1D242, 0x1D245, 0x1D246, 0x1D2E0, 0x1D2F4, 0x1D300, 0x1D357, 0x1D360,
+            0x1D379, 0x1D400, 0x1D41A, 0x1D434, 0x1D44E, 0x1D455, 0x1D456, 0x1D468, 0x1D482, 0x1D49C, 0x1D49D, 0x1D49E,
+            0x1D4A0, 0x1D4A2, 0x1D4A3, 0x1D4A5, 0x1D4A7, 0x1D4A9, 0x1D4AD, 0x1D4AE, 0x1D4B6, 0x1D4BA, 0x1D4BB, 0x1D4BC,
+            0x1D4BD, 0x1D4C4, 0x1D4C5, 0x1D4D0, 0x1D4EA, 0x1D504, 0x1D506, 0x1D507, 0x1D50B, 0x1D50D, 0x1D515, 0x1D516,
+            0x1D51D, 0x1D51E, 0x1D538, 0x1D53A, 0x1D53B, 0x1D53F, 0x1D540, 0x1D545, 0x1D546, 0x1D547, 0x1D54A, 0x1D551,
+            0x1D552, 0x1D56C, 0x1D586, 0x1D5A0, 0x1D5BA, 0x1D5D4, 0x1D5EE, 0x1D608, 0x1D622, 0x1D63C, 0x1D656, 0x1D670,
+            0x1D68A, 0x1D6A6, 0x1D6A8, 0x1D6C1, 0x1D6C2, 0x1D6DB, 0x1D6DC, 0x1D6E2, 0x1D6FB, 0x1D6FC, 0x1D715, 0x1D716,
+            0x1D71C, 0x1D735, 0x1D736, 0x1D74F, 0x1D750, 0x1D756, 0x1D76F, 0x1D770, 0x1D789, 0x1D78A, 0x1D790, 0x1D7A9,
+            0x1D7AA, 0x1D7C3, 0x1D7C4, 0x1D7CA, 0x1D7CB, 0x1D7CC, 0x1D7CE, 0x1D800, 0x1DA00, 0x1DA37, 0x1DA3B, 0x1DA6D,
+            0x1DA75, 0x1DA76, 0x1DA84, 0x1DA85, 0x1DA87, 0x1DA8C, 0x1DA9B, 0x1DAA0, 0x1DAA1, 0x1DAB0, 0x1DF00, 0x1DF0A,
+            0x1DF0B, 0x1DF1F, 0x1E000, 0x1E007, 0x1E008, 0x1E019, 0x1E01B, 0x1E022, 0x1E023, 0x1E025, 0x1E026, 0x1E02B,
+            0x1E100, 0x1E12D, 0x1E130, 0x1E137, 0x1E13E, 0x1E140, 0x1E14A, 0x1E14E, 0x1E14F, 0x1E150, 0x1E290, 0x1E2AE,
+            0x1E2AF, 0x1E2C0, 0x1E2EC, 0x1E2F0, 0x1E2FA, 0x1E2FF, 0x1E300, 0x1E7E0, 0x1E7E7, 0x1E7E8, 0x1E7EC, 0x1E7ED,
+            0x1E7EF, 0x1E7F0, 0x1E7FF, 0x1E800, 0x1E8C5, 0x1E8C7, 0x1E8D0, 0x1E8D7, 0x1E900, 0x1E922, 0x1E944, 0x1E94B,
+            0x1E94C, 0x1E950, 0x1E95A, 0x1E95E, 0x1E960, 0x1EC71, 0x1ECAC, 0x1ECAD, 0x1ECB0, 0x1ECB1, 0x1ECB5, 0x1ED01,
+            0x1ED2E, 0x1ED2F, 0x1ED3E, 0x1EE00, 0x1EE04, 0x1EE05, 0x1EE20, 0x1EE21, 0x1EE23, 0x1EE24, 0x1EE25, 0x1EE27,
+            0x1EE28, 0x1EE29, 0x1EE33, 0x1EE34, 0x1EE38, 0x1EE39, 0x1EE3A, 0x1EE3B, 0x1EE3C, 0x1EE42, 0x1EE43, 0x1EE47,
+            0x1EE48, 0x1EE49, 0x1EE4A, 0x1EE4B, 0x1EE4C, 0x1EE4D, 0x1EE50, 0x1EE51, 0x1EE53, 0x1EE54, 0x1EE55, 0x1EE57,
+            0x1EE58, 0x1EE59, 0x1EE5A, 0x1EE5B, 0x1EE5C, 0x1EE5D, 0x1EE5E, 0x1EE5F, 0x1EE60, 0x1EE61, 0x1EE63, 0x1EE64,
+            0x1EE65, 0x1EE67, 0x1EE6B, 0x1EE6C, 0x1EE73, 0x1EE74, 0x1EE78, 0x1EE79, 0x1EE7D, 0x1EE7E, 0x1EE7F, 0x1EE80,
+            0x1EE8A, 0x1EE8B, 0x1EE9C, 0x1EEA1, 0x1EEA4, 0x1EEA5, 0x1EEAA, 0x1EEAB, 0x1EEBC, 0x1EEF0, 0x1EEF2, 0x1F000,
+            0x1F02C, 0x1F030, 0x1F094, 0x1F0A0, 0x1F0AF, 0x1F0B1, 0x1F0C0, 0x1F0C1, 0x1F0D0, 0x1F0D1, 0x1F0F6, 0x1F100,
+            0x1F10D, 0x1F1AE, 0x1F1E6, 0x1F203, 0x1F210, 0x1F23C, 0x1F240, 0x1F249, 0x1F250, 0x1F252, 0x1F260, 0x1F266,
+            0x1F300, 0x1F3FB, 0x1F400, 0x1F6D8, 0x1F6DD, 0x1F6ED, 0x1F6F0, 0x1F6FD, 0x1F700, 0x1F774, 0x1F780, 0x1F7D9,
+            0x1F7E0, 0x1F7EC, 0x1F7F0, 0x1F7F1, 0x1F800, 0x1F80C, 0x1F810, 0x1F848, 0x1F850, 0x1F85A, 0x1F860, 0x1F888,
+            0x1F890, 0x1F8AE, 0x1F8B0, 0x1F8B2, 0x1F900, 0x1FA54, 0x1FA60, 0x1FA6E, 0x1FA70, 0x1FA75, 0x1FA78, 0x1FA7D,
+            0x1FA80, 0x1FA87, 0x1FA90, 0x1FAAD, 0x1FAB0, 0x1FABB, 0x1FAC0, 0x1FAC6, 0x1FAD0, 0x1FADA, 0x1FAE0, 0x1FAE8,
+            0x1FAF0, 0x1FAF7, 0x1FB00, 0x1FB93, 0x1FB94, 0x1FBCB, 0x1FBF0, 0x1FBFA, 0x20000, 0x2A6E0, 0x2A700, 0x2B739,
+            0x2B740, 0x2B81E, 0x2B820, 0x2CEA2, 0x2CEB0, 0x2EBE1, 0x2F800, 0x2FA1E, 0x30000, 0x3134B, 0xE0001, 0xE0002,
+            0xE0020, 0xE0080, 0xE0100, 0xE01F0, 0xF0000, 0xFFFFE, 0x100000, 0x10FFFE
+        };
+
+        const std::uint8_t _s_general_category_values[] = {
+            26, 23, 18, 20, 18, 14, 15, 18, 19, 18, 13, 18,
+            9, 18, 19, 18, 1, 14, 18, 15, 21, 12, 21, 2,
+            14, 19, 15, 19, 26, 23, 18, 20, 22, 18, 21, 22,
+            5, 16, 19, 27, 22, 21, 22, 19, 11, 21, 2, 18,
+            21, 11, 5, 17, 11, 18, 1, 19, 1, 2, 19, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 5, 1, 2, 5, 1, 3, 2, 1,
+            3, 2, 1, 3, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 3, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            5, 2, 4, 21, 4, 21, 4, 21, 4, 21, 4, 21,
+            6, 1, 2, 1, 2, 4, 21, 1, 2, 0, 4, 2,
+            18, 1, 0, 21, 1, 18, 1, 0, 1, 0, 1, 2,
+            1, 0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 19, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 22, 6, 8, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 0, 1, 0, 4, 18, 2, 18, 13, 0, 22,
+            20, 0, 6, 13, 6, 18, 6, 18, 6, 18, 6, 0,
+            5, 0, 5, 18, 0, 27, 19, 18, 20, 18, 22, 6,
+            18, 27, 18, 5, 4, 5, 6, 9, 18, 5, 6, 5,
+            18, 5, 6, 27, 22, 6, 4, 6, 22, 6, 5, 9,
+            5, 22, 5, 18, 0, 27, 5, 6, 5, 6, 0, 5,
+            6, 5, 0, 9, 5, 6, 4, 22, 18, 4, 0, 6,
+            20, 5, 6, 4, 6, 4, 6, 4, 6, 0, 18, 0,
+            5, 6, 0, 18, 0, 5, 0, 5, 21, 5, 0, 27,
+            0, 6, 5, 4, 6, 27, 6, 7, 5, 6, 7, 6,
+            5, 7, 6, 7, 6, 7, 5, 6, 5, 6, 18, 9,
+            18, 4, 5, 6, 7, 0, 5, 0, 5, 0, 5, 0,
+            5, 0, 5, 0, 5, 0, 6, 5, 7, 6, 0, 7,
+            0, 7, 6, 5, 0, 7, 0, 5, 0, 5, 6, 0,
+            9, 5, 20, 11, 22, 20, 5, 18, 6, 0, 6, 7,
+            0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 6, 0, 7, 6, 0, 6, 0, 6, 0,
+            6, 0, 5, 0, 5, 0, 9, 6, 5, 6, 18, 0,
+            6, 7, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 6, 5, 7, 6, 0, 6, 7, 0, 7,
+            6, 0, 5, 0, 5, 6, 0, 9, 18, 20, 0, 5,
+            6, 0, 6, 7, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 6, 5, 7, 6, 7, 6, 0,
+            7, 0, 7, 6, 0, 6, 7, 0, 5, 0, 5, 6,
+            0, 9, 22, 5, 11, 0, 6, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 7, 6, 7, 0, 7, 0, 7, 6, 0,
+            5, 0, 7, 0, 9, 11, 22, 20, 22, 0, 6, 7,
+            6, 5, 0, 5, 0, 5, 0, 5, 0, 6, 5, 6,
+            7, 0, 6, 0, 6, 0, 6, 0, 5, 0, 5, 0,
+            5, 6, 0, 9, 0, 18, 11, 22, 5, 6, 7, 18,
+            5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 6, 5,
+            7, 6, 7, 0, 6, 7, 0, 7, 6, 0, 7, 0,
+            5, 0, 5, 6, 0, 9, 0, 5, 0, 6, 7, 5,
+            0, 5, 0, 5, 6, 5, 7, 6, 0, 7, 0, 7,
+            6, 5, 22, 0, 5, 7, 11, 5, 6, 0, 9, 11,
+            22, 5, 0, 6, 7, 0, 5, 0, 5, 0, 5, 0,
+            5, 0, 5, 0, 6, 0, 7, 6, 0, 6, 0, 7,
+            0, 9, 0, 7, 18, 0, 5, 6, 5, 6, 0, 20,
+            5, 4, 6, 18, 9, 18, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 5, 6, 5, 6, 5, 0, 5,
+            0, 4, 0, 6, 0, 9, 0, 5, 0, 5, 22, 18,
+            22, 18, 22, 6, 22, 9, 11, 22, 6, 22, 6, 22,
+            6, 14, 15, 14, 15, 7, 5, 0, 5, 0, 6, 7,
+            6, 18, 6, 5, 6, 0, 6, 0, 22, 6, 22, 0,
+            22, 18, 22, 18, 0, 5, 7, 6, 7, 6, 7, 6,
+            7, 6, 5, 9, 18, 5, 7, 6, 5, 6, 5, 7,
+            5, 7, 5, 6, 5, 6, 7, 6, 7, 6, 5, 7,
+            9, 7, 6, 22, 1, 0, 1, 0, 1, 0, 2, 18,
+            4, 2, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+            5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+            5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 6, 18,
+            11, 0, 5, 22, 0, 1, 0, 2, 0, 13, 5, 22,
+            18, 5, 23, 5, 14, 15, 0, 5, 18, 10, 5, 0,
+            5, 6, 7, 0, 5, 6, 7, 18, 0, 5, 6, 0,
+            5, 0, 5, 0, 6, 0, 5, 6, 7, 6, 7, 6,
+            7, 6, 18, 4, 18, 20, 5, 6, 0, 9, 0, 11,
+            0, 18, 13, 18, 6, 27, 6, 9, 0, 5, 4, 5,
+            0, 5, 6, 5, 6, 5, 0, 5, 0, 5, 0, 6,
+            7, 6, 7, 0, 7, 6, 7, 6, 0, 22, 0, 18,
+            9, 5, 0, 5, 0, 5, 0, 5, 0, 9, 11, 0,
+            22, 5, 6, 7, 6, 0, 18, 5, 7, 6, 7, 6,
+            0, 6, 7, 6, 7, 6, 7, 6, 0, 6, 9, 0,
+            9, 0, 18, 4, 18, 0, 6, 8, 6, 0, 6, 7,
+            5, 6, 7, 6, 7, 6, 7, 6, 7, 5, 0, 9,
+            18, 22, 6, 22, 18, 0, 6, 7, 5, 7, 6, 7,
+            6, 7, 6, 5, 9, 5, 6, 7, 6, 7, 6, 7,
+            6, 7, 0, 18, 5, 7, 6, 7, 6, 0, 18, 9,
+            0, 5, 9, 5, 4, 18, 2, 0, 1, 0, 1, 18,
+            0, 6, 18, 6, 7, 6, 5, 6, 5, 6, 5, 7,
+            6, 5, 0, 2, 4, 2, 4, 2, 4, 6, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 0, 1, 0, 2,
+            1, 2, 1, 2, 0, 1, 0, 2, 0, 1, 0, 1,
+            0, 1, 0, 1, 2, 1, 2, 0, 2, 3, 2, 3,
+            2, 3, 2, 0, 2, 1, 3, 21, 2, 21, 2, 0,
+            2, 1, 3, 21, 2, 0, 2, 1, 0, 21, 2, 1,
+            21, 0, 2, 0, 2, 1, 3, 21, 0, 23, 27, 13,
+            18, 16, 17, 14, 16, 17, 14, 16, 18, 24, 25, 27,
+            23, 18, 16, 17, 18, 12, 18, 19, 14, 15, 18, 19,
+            18, 12, 18, 23, 27, 0, 27, 11, 4, 0, 11, 19,
+            14, 15, 4, 11, 19, 14, 15, 0, 4, 0, 20, 0,
+            6, 8, 6, 8, 6, 0, 22, 1, 22, 1, 22, 2,
+            1, 2, 1, 2, 22, 1, 22, 19, 1, 22, 1, 22,
+            1, 22, 1, 22, 1, 22, 2, 1, 2, 5, 2, 22,
+            2, 1, 19, 1, 2, 22, 19, 22, 2, 22, 11, 10,
+            1, 2, 10, 11, 22, 0, 19, 22, 19, 22, 19, 22,
+            19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22,
+            19, 22, 14, 15, 14, 15, 22, 19, 22, 14, 15, 22,
+            19, 22, 19, 22, 19, 22, 0, 22, 0, 11, 22, 11,
+            22, 19, 22, 19, 22, 19, 22, 19, 22, 14, 15, 14,
+            15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 11,
+            22, 19, 14, 15, 19, 14, 15, 14, 15, 14, 15, 14,
+            15, 14, 15, 19, 22, 19, 14, 15, 14, 15, 14, 15,
+            14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+            14, 15, 14, 15, 19, 14, 15, 14, 15, 19, 14, 15,
+            19, 22, 19, 22, 19, 22, 0, 22, 0, 22, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 4, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 22, 1, 2,
+            1, 2, 6, 1, 2, 0, 18, 11, 18, 2, 0, 2,
+            0, 2, 0, 5, 0, 4, 18, 0, 6, 5, 0, 5,
+            0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 6, 18, 16, 17, 16, 17, 18, 16, 17,
+            18, 16, 17, 18, 13, 18, 13, 18, 16, 17, 18, 16,
+            17, 14, 15, 14, 15, 14, 15, 14, 15, 18, 4, 18,
+            13, 18, 13, 18, 14, 18, 22, 18, 14, 15, 14, 15,
+            14, 15, 14, 15, 13, 0, 22, 0, 22, 0, 22, 0,
+            22, 0, 23, 18, 22, 4, 5, 10, 14, 15, 14, 15,
+            14, 15, 14, 15, 14, 15, 22, 14, 15, 14, 15, 14,
+            15, 14, 15, 13, 14, 15, 22, 10, 6, 7, 13, 4,
+            22, 10, 4, 5, 18, 22, 0, 5, 0, 6, 21, 4,
+            5, 13, 5, 18, 4, 5, 0, 5, 0, 5, 0, 22,
+            11, 22, 5, 22, 0, 5, 22, 0, 11, 22, 11, 22,
+            11, 22, 11, 22, 11, 22, 5, 22, 5, 4, 5, 0,
+            22, 0, 5, 4, 18, 5, 4, 18, 5, 9, 5, 0,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 5, 6,
+            8, 18, 6, 18, 4, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 4, 6, 5,
+            10, 6, 18, 0, 21, 4, 21, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 4,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 1, 2, 4, 21, 1, 2, 1, 2, 5, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            1, 2, 1, 2, 1, 2, 1, 2, 0, 1, 2, 0,
+            2, 0, 2, 1, 2, 1, 2, 0, 4, 1, 2, 5,
+            4, 2, 5, 6, 5, 6, 5, 6, 5, 7, 6, 7,
+            22, 6, 0, 11, 22, 20, 22, 0, 5, 18, 0, 7,
+            5, 7, 6, 0, 18, 9, 0, 6, 5, 18, 5, 18,
+            5, 6, 9, 5, 6, 18, 5, 6, 7, 0, 18, 5,
+            0, 6, 7, 5, 6, 7, 6, 7, 6, 7, 18, 0,
+            4, 9, 0, 18, 5, 6, 4, 5, 9, 5, 0, 5,
+            6, 7, 6, 7, 6, 0, 5, 6, 5, 6, 7, 0,
+            9, 0, 18, 5, 4, 5, 22, 5, 7, 6, 7, 5,
+            6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 0, 5,
+            4, 18, 5, 7, 6, 7, 18, 5, 4, 7, 6, 0,
+            5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 2, 21,
+            4, 2, 4, 21, 0, 2, 5, 7, 6, 7, 6, 7,
+            18, 7, 6, 0, 9, 0, 5, 0, 5, 0, 5, 0,
+            28, 29, 5, 0, 5, 0, 2, 0, 2, 0, 5, 6,
+            5, 19, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+            5, 21, 0, 5, 15, 14, 22, 5, 0, 5, 0, 22,
+            0, 5, 20, 22, 6, 18, 14, 15, 18, 0, 6, 18,
+            13, 12, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+            14, 15, 14, 15, 14, 15, 18, 14, 15, 18, 12, 18,
+            0, 18, 13, 14, 15, 14, 15, 14, 15, 18, 19, 13,
+            19, 0, 18, 20, 18, 0, 5, 0, 5, 0, 27, 0,
+            18, 20, 18, 14, 15, 18, 19, 18, 13, 18, 9, 18,
+            19, 18, 1, 14, 18, 15, 21, 12, 21, 2, 14, 19,
+            15, 19, 14, 15, 18, 14, 15, 18, 5, 4, 5, 4,
+            5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 20, 19,
+            21, 22, 20, 0, 22, 19, 22, 0, 27, 22, 0, 5,
+            0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 18, 0, 11, 0, 22, 10, 11, 22, 11, 22, 0,
+            22, 0, 22, 0, 22, 6, 0, 5, 0, 5, 0, 6,
+            11, 0, 5, 11, 0, 5, 10, 5, 10, 0, 5, 6,
+            0, 5, 0, 18, 5, 0, 5, 18, 10, 0, 1, 2,
+            5, 0, 9, 0, 1, 0, 2, 0, 5, 0, 5, 0,
+            18, 1, 0, 1, 0, 1, 0, 1, 0, 2, 0, 2,
+            0, 2, 0, 2, 0, 5, 0, 5, 0, 5, 0, 4,
+            0, 4, 0, 4, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 18, 11, 5, 22, 11, 5, 0,
+            11, 0, 5, 0, 5, 0, 11, 5, 11, 0, 18, 5,
+            0, 18, 0, 5, 0, 11, 5, 11, 0, 11, 5, 6,
+            0, 6, 0, 6, 5, 0, 5, 0, 5, 0, 6, 0,
+            6, 11, 0, 18, 0, 5, 11, 18, 5, 11, 0, 5,
+            22, 5, 6, 0, 11, 18, 0, 5, 0, 18, 5, 0,
+            11, 5, 0, 11, 5, 0, 18, 0, 11, 0, 5, 0,
+            1, 0, 2, 0, 11, 5, 6, 0, 9, 0, 11, 0,
+            5, 0, 6, 13, 0, 5, 0, 5, 11, 5, 0, 5,
+            6, 11, 18, 0, 5, 6, 18, 0, 5, 11, 0, 5,
+            0, 7, 6, 7, 5, 6, 18, 0, 11, 9, 6, 5,
+            6, 5, 0, 6, 7, 5, 7, 6, 7, 6, 18, 27,
+            18, 6, 0, 27, 0, 5, 0, 9, 0, 6, 5, 6,
+            7, 6, 0, 9, 18, 5, 7, 5, 0, 5, 6, 18,
+            5, 0, 6, 7, 5, 7, 6, 7, 5, 18, 6, 18,
+            7, 6, 9, 5, 18, 5, 18, 0, 11, 0, 5, 0,
+            5, 7, 6, 7, 6, 7, 6, 18, 6, 0, 5, 0,
+            5, 0, 5, 0, 5, 0, 5, 18, 0, 5, 6, 7,
+            6, 0, 9, 0, 6, 7, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 5, 0, 6, 5, 7, 6, 7,
+            0, 7, 0, 7, 0, 5, 0, 7, 0, 5, 7, 0,
+            6, 0, 6, 0, 5, 7, 6, 7, 6, 7, 6, 5,
+            18, 9, 18, 0, 18, 6, 5, 0, 5, 7, 6, 7,
+            6, 7, 6, 7, 6, 5, 18, 5, 0, 9, 0, 5,
+            7, 6, 0, 7, 6, 7, 6, 18, 5, 6, 0, 5,
+            7, 6, 7, 6, 7, 6, 18, 5, 0, 9, 0, 18,
+            0, 5, 6, 7, 6, 7, 6, 7, 6, 5, 18, 0,
+            9, 0, 5, 0, 6, 7, 6, 7, 6, 0, 9, 11,
+            18, 22, 5, 0, 5, 7, 6, 7, 6, 18, 0, 1,
+            2, 9, 11, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+            5, 7, 0, 7, 0, 6, 7, 6, 5, 7, 5, 7,
+            6, 18, 0, 9, 0, 5, 0, 5, 7, 6, 0, 6,
+            7, 6, 5, 18, 5, 7, 0, 5, 6, 5, 6, 7,
+            5, 6, 18, 6, 0, 5, 6, 7, 6, 5, 6, 7,
+            6, 18, 5, 18, 0, 5, 0, 5, 0, 5, 7, 6,
+            0, 6, 7, 6, 5, 18, 0, 9, 11, 0, 18, 5,
+            0, 6, 0, 7, 6, 7, 6, 7, 6, 0, 5, 0,
+            5, 0, 5, 6, 0, 6, 0, 6, 0, 6, 5, 6,
+            0, 9, 0, 5, 0, 5, 0, 5, 7, 0, 6, 0,
+            7, 6, 7, 6, 5, 0, 9, 0, 5, 6, 7, 18,
+            0, 5, 0, 11, 22, 20, 22, 0, 18, 5, 0, 10,
+            0, 18, 0, 5, 0, 5, 18, 0, 5, 0, 27, 0,
+            5, 0, 5, 0, 5, 0, 9, 0, 18, 5, 0, 9,
+            0, 5, 0, 6, 18, 0, 5, 6, 18, 22, 4, 18,
+            22, 0, 9, 0, 11, 0, 5, 0, 5, 0, 1, 2,
+            11, 18, 0, 5, 0, 6, 5, 7, 0, 6, 4, 0,
+            4, 18, 4, 6, 0, 7, 0, 5, 0, 5, 0, 5,
+            0, 4, 0, 4, 0, 4, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 22,
+            6, 18, 27, 0, 6, 0, 6, 0, 22, 0, 22, 0,
+            22, 0, 22, 7, 6, 22, 7, 27, 6, 22, 6, 22,
+            6, 22, 0, 22, 6, 22, 0, 11, 0, 22, 0, 11,
+            0, 1, 2, 1, 2, 0, 2, 1, 2, 1, 0, 1,
+            0, 1, 0, 1, 0, 1, 0, 1, 2, 0, 2, 0,
+            2, 0, 2, 1, 2, 1, 0, 1, 0, 1, 0, 1,
+            0, 2, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+            2, 0, 1, 19, 2, 19, 2, 1, 19, 2, 19, 2,
+            1, 19, 2, 19, 2, 1, 19, 2, 19, 2, 1, 19,
+            2, 19, 2, 1, 2, 0, 9, 22, 6, 22, 6, 22,
+            6, 22, 6, 22, 18, 0, 6, 0, 6, 0, 2, 5,
+            2, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0,
+            5, 0, 6, 4, 0, 9, 0, 5, 22, 0, 5, 6,
+            0, 5, 6, 9, 0, 20, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 11, 6, 0, 1, 2, 6, 4,
+            0, 9, 0, 18, 0, 11, 22, 11, 20, 11, 0, 11,
+            22, 11, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+            0, 5, 0, 5, 0, 5, 0, 5, 0, 19, 0, 22,
+            0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 11,
+            22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0,
+            22, 21, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0,
+            22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0,
+            22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0,
+            22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0,
+            22, 0, 22, 0, 22, 0, 9, 0, 5, 0, 5, 0,
+            5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 27, 0,
+            27, 0, 6, 0, 29, 0, 29, 0
+        };
+
+        // East_Asian_Width
+        const std::uint32_t _s_east_asian_width_starts[] = {
+            0x0000, 0x0020, 0x007F, 0x00A1, 0x00A2, 0x00A4, 0x00A5, 0x00A7, 0x00A9, 0x00AA, 0x00AB, 0x00AC,
+            0x00AD, 0x00AF, 0x00B0, 0x00B5, 0x00B6, 0x00BB, 0x00BC, 0x00C0, 0x00C6, 0x00C7, 0x00D0, 0x00D1,
+            0x00D7, 0x00D9, 0x00DE, 0x00E2, 0x00E6, 0x00E7, 0x00E8, 0x00EB, 0x00EC, 0x00EE, 0x00F0, 0x00F1,
+            0x00F2, 0x00F4, 0x00F7, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0101, 0x0102, 0x0111, 0x0112,
+            0x0113, 0x0114, 0x011B, 0x011C, 0x0126, 0x0128, 0x012B, 0x012C, 0x0131, 0x0134, 0x0138, 0x0139,
+            0x013F, 0x0143, 0x0144, 0x0145, 0x0148, 0x014C, 0x014D, 0x014E, 0x0152, 0x0154, 0x0166, 0x0168,
+            0x016B, 0x016C, 0x01CE, 0x01CF, 0x01D0, 0x01D1, 0x01D2, 0x01D3, 0x01D4, 0x01D5, 0x01D6, 0x01D7,
+            0x01D8, 0x01D9, 0x01DA, 0x01DB, 0x01DC, 0x01DD, 0x0251, 0x0252, 0x0261, 0x0262, 0x02C4, 0x02C5,
+            0x02C7, 0x02C8, 0x02C9, 0x02CC, 0x02CD, 0x02CE, 0x02D0, 0x02D1, 0x02D8, 0x02DC, 0x02DD, 0x02DE,
+            0x02DF, 0x02E0, 0x0300, 0x0370, 0x0391, 0x03A2, 0x03A3, 0x03AA, 0x03B1, 0x03C2, 0x03C3, 0x03CA,
+            0x0401, 0x0402, 0x0410, 0x0450, 0x0451, 0x0452, 0x1100, 0x1160, 0x2010, 0x2011, 0x2013, 0x2017,
+            0x2018, 0x201A, 0x201C, 0x201E, 0x2020, 0x2023, 0x2024, 0x2028, 0x2030, 0x2031, 0x2032, 0x2034,
+            0x2035, 0x2036, 0x203B, 0x203C, 0x203E, 0x203F, 0x2074, 0x2075, 0x207F, 0x2080, 0x2081, 0x2085,
+            0x20A9, 0x20AA, 0x20AC, 0x20AD, 0x2103, 0x2104, 0x2105, 0x2106, 0x2109, 0x210A, 0x2113, 0x2114,
+            0x2116, 0x2117, 0x2121, 0x2123, 0x2126, 0x2127, 0x212B, 0x212C, 0x2153, 0x2155, 0x215B, 0x215F,
+            0x2160, 0x216C, 0x2170, 0x217A, 0x2189, 0x218A, 0x2190, 0x219A, 0x21B8, 0x21BA, 0x21D2, 0x21D3,
+            0x21D4, 0x21D5, 0x21E7, 0x21E8, 0x2200, 0x2201, 0x2202, 0x2204, 0x2207, 0x2209, 0x220B, 0x220C,
+            0x220F, 0x2210, 0x2211, 0x2212, 0x2215, 0x2216, 0x221A, 0x221B, 0x221D, 0x2221, 0x2223, 0x2224,
+            0x2225, 0x2226, 0x2227, 0x222D, 0x222E, 0x222F, 0x2234, 0x2238, 0x223C, 0x223E, 0x2248, 0x2249,
+            0x224C, 0x224D, 0x2252, 0x2253, 0x2260, 0x2262, 0x2264, 0x2268, 0x226A, 0x226C, 0x226E, 0x2270,
+            0x2282, 0x2284, 0x2286, 0x2288, 0x2295, 0x2296, 0x2299, 0x229A, 0x22A5, 0x22A6, 0x22BF, 0x22C0,
+            0x2312, 0x2313, 0x231A, 0x231C, 0x2329, 0x232B, 0x23E9, 0x23ED, 0x23F0, 0x23F1, 0x23F3, 0x23F4,
+            0x2460, 0x24EA, 0x24EB, 0x254C, 0x2550, 0x2574, 0x2580, 0x2590, 0x2592, 0x2596, 0x25A0, 0x25A2,
+            0x25A3, 0x25AA, 0x25B2, 0x25B4, 0x25B6, 0x25B8, 0x25BC, 0x25BE, 0x25C0, 0x25C2, 0x25C6, 0x25C9,
+            0x25CB, 0x25CC, 0x25CE, 0x25D2, 0x25E2, 0x25E6, 0x25EF, 0x25F0, 0x25FD, 0x25FF, 0x2605, 0x2607,
+            0x2609, 0x260A, 0x260E, 0x2610, 0x2614, 0x2616, 0x261C, 0x261D, 0x261E, 0x261F, 0x2640, 0x2641,
+            0x2642, 0x2643, 0x2648, 0x2654, 0x2660, 0x2662, 0x2663, 0x2666, 0x2667, 0x266B, 0x266C, 0x266E,
+            0x266F, 0x2670, 0x267F, 0x2680, 0x2693, 0x2694, 0x269E, 0x26A0, 0x26A1, 0x26A2, 0x26AA, 0x26AC,
+            0x26BD, 0x26BF, 0x26C0, 0x26C4, 0x26C6, 0x26CE, 0x26CF, 0x26D4, 0x26D5, 0x26E2, 0x26E3, 0x26E4,
+            0x26E8, 0x26EA, 0x26EB, 0x26F2, 0x26F4, 0x26F5, 0x26F6, 0x26FA, 0x26FB, 0x26FD, 0x26FE, 0x2700,
+            0x2705, 0x2706, 0x270A, 0x270C, 0x2728, 0x2729, 0x273D, 0x273E, 0x274C, 0x274D, 0x274E, 0x274F,
+            0x2753, 0x2756, 0x2757, 0x2758, 0x2776, 0x2780, 0x2795, 0x2798, 0x27B0, 0x27B1, 0x27BF, 0x27C0,
+            0x27E6, 0x27EE, 0x2985, 0x2987, 0x2B1B, 0x2B1D, 0x2B50, 0x2B51, 0x2B55, 0x2B56, 0x2B5A, 0x2E80,
+            0x2E9A, 0x2E9B, 0x2EF4, 0x2F00, 0x2FD6, 0x2FF0, 0x2FFC, 0x3000, 0x3001, 0x303F, 0x3041, 0x3097,
+            0x3099, 0x3100, 0x3105, 0x3130, 0x3131, 0x318F, 0x3190, 0x31E4, 0x31F0, 0x321F, 0x3220, 0x3248,
+            0x3250, 0x4DC0, 0x4E00, 0xA48D, 0xA490, 0xA4C7, 0xA960, 0xA97D, 0xAC00, 0xD7A4, 0xE000, 0xF900,
+            0xFB00, 0xFE00, 0xFE10, 0xFE1A, 0xFE30, 0xFE53, 0xFE54, 0xFE67, 0xFE68, 0xFE6C, 0xFF01, 0xFF61,
+            0xFFBF, 0xFFC2, 0xFFC8, 0xFFCA, 0xFFD0, 0xFFD2, 0xFFD8, 0xFFDA, 0xFFDD, 0xFFE0, 0xFFE7, 0xFFE8,
+            0xFFEF, 0xFFFD, 0xFFFE, 0x16FE0, 0x16FE5, 0x16FF0, 0x16FF2, 0x17000, 0x187F8, 0x18800, 0x18CD6, 0x18D00,
+            0x18D09, 0x1AFF0, 0x1AFF4, 0x1AFF5, 0x1AFFC, 0x1AFFD, 0x1AFFF, 0x1B000, 0x1B123, 0x1B150, 0x1B153, 0x1B164,
+            0x1B168, 0x1B170, 0x1B2FC, 0x1F004, 0x1F005, 0x1F0CF, 0x1F0D0, 0x1F100, 0x1F10B, 0x1F110, 0x1F12E, 0x1F130,
+            0x1F16A, 0x1F170, 0x1F18E, 0x1F18F, 0x1F191, 0x1F19B, 0x1F1AD, 0x1F200, 0x1F203, 0x1F210, 0x1F23C, 0x1F240,
+            0x1F249, 0x1F250, 0x1F252, 0x1F260, 0x1F266, 0x1F300, 0x1F321, 0x1F32D, 0x1F336, 0x1F337, 0x1F37D, 0x1F37E,
+            0x1F394, 0x1F3A0, 0x1F3CB, 0x1F3CF, 0x1F3D4, 0x1F3E0, 0x1F3F1, 0x1F3F4, 0x1F3F5, 0x1F3F8, 0x1F43F, 0x1F440,
+            0x1F441, 0x1F442, 0x1F4FD, 0x1F4FF, 0x1F53E, 0x1F54B, 0x1F54F, 0x1F550, 0x1F568, 0x1F57A, 0x1F57B, 0x1F595,
+            0x1F597, 0x1F5A4, 0x1F5A5, 0x1F5FB, 0x1F650, 0x1F680, 0x1F6C6, 0x1F6CC, 0x1F6CD, 0x1F6D0, 0x1F6D3, 0x1F6D5,
+            0x1F6D8, 0x1F6DD, 0x1F6E0, 0x1F6EB, 0x1F6ED, 0x1F6F4, 0x1F6FD, 0x1F7E0, 0x1F7EC, 0x1F7F0, 0x1F7F1, 0x1F90C,
+            0x1F93B, 0x1F93C, 0x1F946, 0x1F947, 0x1FA00, 0x1FA70, 0x1FA75, 0x1FA78, 0x1FA7D, 0x1FA80, 0x1FA87, 0x1FA90,
+            0x1FAAD, 0x1FAB0, 0x1FABB, 0x1FAC0, 0x1FAC6, 0x1FAD0, 0x1FADA, 0x1FAE0, 0x1FAE8, 0x1FAF0, 0x1FAF7, 0x20000,
+            0x2FFFE, 0x30000, 0x3FFFE, 0xE0100, 0xE01F0, 0xF0000, 0xFFFFE, 0x100000, 0x10FFFE
+        };
+
+        const std::uint8_t _s_east_asian_width_values[] = {
+            0, 5, 0, 1, 5, 1, 5, 1, 0, 1, 0, 5,
+            1, 5, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 3, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 1, 0, 1, 0, 1, 0, 3, 0, 1, 0,
+            1, 0, 1, 0, 3, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 3, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+            1, 0, 3, 0, 3, 0, 1, 0, 3, 0, 3, 0,
+            3, 1, 0, 3, 1, 3, 1, 3, 1, 0, 1, 0,
+            1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 0,
+            3, 0, 3, 0, 3, 0, 1, 0, 3, 0, 3, 0,
+            3, 0, 3, 0, 1, 0, 3, 0, 3, 0, 3, 0,
+            5, 0, 5, 0, 3, 0, 3, 0, 3, 1, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 4, 3, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 1,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 1, 3,
+            0, 1, 3, 0, 3, 0, 3, 0, 3, 0, 4, 2,
+            0, 2, 0, 2, 0, 2, 0, 2, 0, 4, 0, 2,
+            0, 1, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 1, 0, 1, 0, 1,
+            0, 1, 3, 1, 3, 1, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 1, 0, 1, 0, 1, 0
+        };
+
+        // Line_Break
+        const std::uint32_t _s_line_break_starts[] = {
+            0x0000, 0x0009, 0x000A, 0x000B, 0x000D, 0x000E, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025,
+            0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x003A,
+            0x003C, 0x003F, 0x0040, 0x005B, 0x005C, 0x005D, 0x005E, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+            0x0085, 0x0086, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A6, 0x00A7, 0x00A9, 0x00AA, 0x00AB, 0x00AC,
+            0x00AD, 0x00AE, 0x00B0, 0x00B1, 0x00B2, 0x00B4, 0x00B5, 0x00B6, 0x00BB, 0x00BC, 0x00BF, 0x00C0,
+            0x00D7, 0x00D8, 0x00F7, 0x00F8, 0x02C7, 0x02C8, 0x02C9, 0x02CC, 0x02CD, 0x02CE, 0x02D0, 0x02D1,
+            0x02D8, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0, 0x0300, 0x034F, 0x0350, 0x035C, 0x0363, 0x0370,
+            0x0378, 0x037A, 0x037E, 0x037F, 0x0380, 0x0384, 0x038B, 0x038C, 0x038D, 0x038E, 0x03A2, 0x03A3,
+            0x0483, 0x048A, 0x0530, 0x0531, 0x0557, 0x0559, 0x0589, 0x058A, 0x058B, 0x058D, 0x058F, 0x0590,
+            0x0591, 0x05BE, 0x05BF, 0x05C0, 0x05C1, 0x05C3, 0x05C4, 0x05C6, 0x05C7, 0x05C8, 0x05D0, 0x05EB,
+            0x05EF, 0x05F3, 0x05F5, 0x0600, 0x0609, 0x060C, 0x060E, 0x0610, 0x061B, 0x061C, 0x061D, 0x0620,
+            0x064B, 0x0660, 0x066A, 0x066B, 0x066D, 0x0670, 0x0671, 0x06D4, 0x06D5, 0x06D6, 0x06DD, 0x06DF,
+            0x06E5, 0x06E7, 0x06E9, 0x06EA, 0x06EE, 0x06F0, 0x06FA, 0x070E, 0x070F, 0x0711, 0x0712, 0x0730,
+            0x074B, 0x074D, 0x07A6, 0x07B1, 0x07B2, 0x07C0, 0x07CA, 0x07EB, 0x07F4, 0x07F8, 0x07F9, 0x07FA,
+            0x07FB, 0x07FD, 0x07FE, 0x0800, 0x0816, 0x081A, 0x081B, 0x0824, 0x0825, 0x0828, 0x0829, 0x082E,
+            0x0830, 0x083F, 0x0840, 0x0859, 0x085C, 0x085E, 0x085F, 0x0860, 0x086B, 0x0870, 0x088F, 0x0890,
+            0x0892, 0x0898, 0x08A0, 0x08CA, 0x08E2, 0x08E3, 0x0904, 0x093A, 0x093D, 0x093E, 0x0950, 0x0951,
+            0x0958, 0x0962, 0x0964, 0x0966, 0x0970, 0x0981, 0x0984, 0x0985, 0x098D, 0x098F, 0x0991, 0x0993,
+            0x09A9, 0x09AA, 0x09B1, 0x09B2, 0x09B3, 0x09B6, 0x09BA, 0x09BC, 0x09BD, 0x09BE, 0x09C5, 0x09C7,
+            0x09C9, 0x09CB, 0x09CE, 0x09CF, 0x09D7, 0x09D8, 0x09DC, 0x09DE, 0x09DF, 0x09E2, 0x09E4, 0x09E6,
+            0x09F0, 0x09F2, 0x09F4, 0x09F9, 0x09FA, 0x09FB, 0x09FC, 0x09FE, 0x09FF, 0x0A01, 0x0A04, 0x0A05,
+            0x0A0B, 0x0A0F, 0x0A11, 0x0A13, 0x0A29, 0x0A2A, 0x0A31, 0x0A32, 0x0A34, 0x0A35, 0x0A37, 0x0A38,
+            0x0A3A, 0x0A3C, 0x0A3D, 0x0A3E, 0x0A43, 0x0A47, 0x0A49, 0x0A4B, 0x0A4E, 0x0A51, 0x0A52, 0x0A59,
+            0x0A5D, 0x0A5E, 0x0A5F, 0x0A66, 0x0A70, 0x0A72, 0x0A75, 0x0A76, 0x0A77, 0x0A81, 0x0A84, 0x0A85,
+            0x0A8E, 0x0A8F, 0x0A92, 0x0A93, 0x0AA9, 0x0AAA, 0x0AB1, 0x0AB2, 0x0AB4, 0x0AB5, 0x0ABA, 0x0ABC,
+            0x0ABD, 0x0ABE, 0x0AC6, 0x0AC7, 0x0ACA, 0x0ACB, 0x0ACE, 0x0AD0, 0x0AD1, 0x0AE0, 0x0AE2, 0x0AE4,
+            0x0AE6, 0x0AF0, 0x0AF1, 0x0AF2, 0x0AF9, 0x0AFA, 0x0B00, 0x0B01, 0x0B04, 0x0B05, 0x0B0D, 0x0B0F,
+            0x0B11, 0x0B13, 0x0B29, 0x0B2A, 0x0B31, 0x0B32, 0x0B34, 0x0B35, 0x0B3A, 0x0B3C, 0x0B3D, 0x0B3E,
+            0x0B45, 0x0B47, 0x0B49, 0x0B4B, 0x0B4E, 0x0B55, 0x0B58, 0x0B5C, 0x0B5E, 0x0B5F, 0x0B62, 0x0B64,
+            0x0B66, 0x0B70, 0x0B78, 0x0B82, 0x0B83, 0x0B84, 0x0B85, 0x0B8B, 0x0B8E, 0x0B91, 0x0B92, 0x0B96,
+            0x0B99, 0x0B9B, 0x0B9C, 0x0B9D, 0x0B9E, 0x0BA0, 0x0BA3, 0x0BA5, 0x0BA8, 0x0BAB, 0x0BAE, 0x0BBA,
+            0x0BBE, 0x0BC3, 0x0BC6, 0x0BC9, 0x0BCA, 0x0BCE, 0x0BD0, 0x0BD1, 0x0BD7, 0x0BD8, 0x0BE6, 0x0BF0,
+            0x0BF9, 0x0BFA, 0x0BFB, 0x0C00, 0x0C05, 0x0C0D, 0x0C0E, 0x0C11, 0x0C12, 0x0C29, 0x0C2A, 0x0C3A,
+            0x0C3C, 0x0C3D, 0x0C3E, 0x0C45, 0x0C46, 0x0C49, 0x0C4A, 0x0C4E, 0x0C55, 0x0C57, 0x0C58, 0x0C5B,
+            0x0C5D, 0x0C5E, 0x0C60, 0x0C62, 0x0C64, 0x0C66, 0x0C70, 0x0C77, 0x0C78, 0x0C81, 0x0C84, 0x0C85,
+            0x0C8D, 0x0C8E, 0x0C91, 0x0C92, 0x0CA9, 0x0CAA, 0x0CB4, 0x0CB5, 0x0CBA, 0x0CBC, 0x0CBD, 0x0CBE,
+            0x0CC5, 0x0CC6, 0x0CC9, 0x0CCA, 0x0CCE, 0x0CD5, 0x0CD7, 0x0CDD, 0x0CDF, 0x0CE0, 0x0CE2, 0x0CE4,
+            0x0CE6, 0x0CF0, 0x0CF1, 0x0CF3, 0x0D00, 0x0D04, 0x0D0D, 0x0D0E, 0x0D11, 0x0D12, 0x0D3B, 0x0D3D,
+            0x0D3E, 0x0D45, 0x0D46, 0x0D49, 0x0D4A, 0x0D4E, 0x0D50, 0x0D54, 0x0D57, 0x0D58, 0x0D62, 0x0D64,
+            0x0D66, 0x0D70, 0x0D79, 0x0D7A, 0x0D80, 0x0D81, 0x0D84, 0x0D85, 0x0D97, 0x0D9A, 0x0DB2, 0x0DB3,
+            0x0DBC, 0x0DBD, 0x0DBE, 0x0DC0, 0x0DC7, 0x0DCA, 0x0DCB, 0x0DCF, 0x0DD5, 0x0DD6, 0x0DD7, 0x0DD8,
+            0x0DE0, 0x0DE6, 0x0DF0, 0x0DF2, 0x0DF4, 0x0DF5, 0x0E01, 0x0E3B, 0x0E3F, 0x0E40, 0x0E4F, 0x0E50,
+            0x0E5A, 0x0E5C, 0x0E81, 0x0E83, 0x0E84, 0x0E85, 0x0E86, 0x0E8B, 0x0E8C, 0x0EA4, 0x0EA5, 0x0EA6,
+            0x0EA7, 0x0EBE, 0x0EC0, 0x0EC5, 0x0EC6, 0x0EC7, 0x0EC8, 0x0ECE, 0x0ED0, 0x0EDA, 0x0EDC, 0x0EE0,
+            0x0F00, 0x0F01, 0x0F05, 0x0F06, 0x0F08, 0x0F09, 0x0F0B, 0x0F0C, 0x0F0D, 0x0F12, 0x0F13, 0x0F14,
+            0x0F15, 0x0F18, 0x0F1A, 0x0F20, 0x0F2A, 0x0F34, 0x0F35, 0x0F36, 0x0F37, 0x0F38, 0x0F39, 0x0F3A,
+            0x0F3B, 0x0F3C, 0x0F3D, 0x0F3E, 0x0F40, 0x0F48, 0x0F49, 0x0F6D, 0x0F71, 0x0F7F, 0x0F80, 0x0F85,
+            0x0F86, 0x0F88, 0x0F8D, 0x0F98, 0x0F99, 0x0FBD, 0x0FBE, 0x0FC0, 0x0FC6, 0x0FC7, 0x0FCD, 0x0FCE,
+            0x0FD0, 0x0FD2, 0x0FD3, 0x0FD4, 0x0FD9, 0x0FDB, 0x1000, 0x1040, 0x104A, 0x104C, 0x1050, 0x1090,
+            0x109A, 0x10A0, 0x10C6, 0x10C7, 0x10C8, 0x10CD, 0x10CE, 0x10D0, 0x1100, 0x1160, 0x11A8, 0x1200,
+            0x1249, 0x124A, 0x124E, 0x1250, 0x1257, 0x1258, 0x1259, 0x125A, 0x125E, 0x1260, 0x1289, 0x128A,
+            0x128E, 0x1290, 0x12B1, 0x12B2, 0x12B6, 0x12B8, 0x12BF, 0x12C0, 0x12C1, 0x12C2, 0x12C6, 0x12C8,
+            0x12D7, 0x12D8, 0x1311, 0x1312, 0x1316, 0x1318, 0x135B, 0x135D, 0x1360, 0x1361, 0x1362, 0x137D,
+            0x1380, 0x139A, 0x13A0, 0x13F6, 0x13F8, 0x13FE, 0x1400, 0x1401, 0x1680, 0x1681, 0x169B, 0x169C,
+            0x169D, 0x16A0, 0x16EB, 0x16EE, 0x16F9, 0x1700, 0x1712, 0x1716, 0x171F, 0x1732, 0x1735, 0x1737,
+            0x1740, 0x1752, 0x1754, 0x1760, 0x176D, 0x176E, 0x1771, 0x1772, 0x1774, 0x1780, 0x17D4, 0x17D6,
+            0x17D7, 0x17D8, 0x17D9, 0x17DA, 0x17DB, 0x17DC, 0x17DE, 0x17E0, 0x17EA, 0x17F0, 0x17FA, 0x1800,
+            0x1802, 0x1804, 0x1806, 0x1807, 0x1808, 0x180A, 0x180B, 0x180E, 0x180F, 0x1810, 0x181A, 0x1820,
+            0x1879, 0x1880, 0x1885, 0x1887, 0x18A9, 0x18AA, 0x18AB, 0x18B0, 0x18F6, 0x1900, 0x191F, 0x1920,
+            0x192C, 0x1930, 0x193C, 0x1940, 0x1941, 0x1944, 0x1946, 0x1950, 0x196E, 0x1970, 0x1975, 0x1980,
+            0x19AC, 0x19B0, 0x19CA, 0x19D0, 0x19DA, 0x19DB, 0x19DE, 0x19E0, 0x1A17, 0x1A1C, 0x1A1E, 0x1A20,
+            0x1A5F, 0x1A60, 0x1A7D, 0x1A7F, 0x1A80, 0x1A8A, 0x1A90, 0x1A9A, 0x1AA0, 0x1AAE, 0x1AB0, 0x1ACF,
+            0x1B00, 0x1B05, 0x1B34, 0x1B45, 0x1B4D, 0x1B50, 0x1B5A, 0x1B5C, 0x1B5D, 0x1B61, 0x1B6B, 0x1B74,
+            0x1B7D, 0x1B7F, 0x1B80, 0x1B83, 0x1BA1, 0x1BAE, 0x1BB0, 0x1BBA, 0x1BE6, 0x1BF4, 0x1BFC, 0x1C24,
+            0x1C38, 0x1C3B, 0x1C40, 0x1C4A, 0x1C4D, 0x1C50, 0x1C5A, 0x1C7E, 0x1C80, 0x1C89, 0x1C90, 0x1CBB,
+            0x1CBD, 0x1CC8, 0x1CD0, 0x1CD3, 0x1CD4, 0x1CE9, 0x1CED, 0x1CEE, 0x1CF4, 0x1CF5, 0x1CF7, 0x1CFA,
+            0x1CFB, 0x1D00, 0x1DC0, 0x1E00, 0x1F16, 0x1F18, 0x1F1E, 0x1F20, 0x1F46, 0x1F48, 0x1F4E, 0x1F50,
+            0x1F58, 0x1F59, 0x1F5A, 0x1F5B, 0x1F5C, 0x1F5D, 0x1F5E, 0x1F5F, 0x1F7E, 0x1F80, 0x1FB5, 0x1FB6,
+            0x1FC5, 0x1FC6, 0x1FD4, 0x1FD6, 0x1FDC, 0x1FDD, 0x1FF0, 0x1FF2, 0x1FF5, 0x1FF6, 0x1FFD, 0x1FFE,
+            0x1FFF, 0x2000, 0x2007, 0x2008, 0x200B, 0x200C, 0x200D, 0x200E, 0x2010, 0x2011, 0x2012, 0x2014,
+            0x2015, 0x2017, 0x2018, 0x201A, 0x201B, 0x201E, 0x201F, 0x2020, 0x2022, 0x2024, 0x2027, 0x2028,
+            0x202A, 0x202F, 0x2030, 0x2038, 0x2039, 0x203B, 0x203C, 0x203E, 0x2044, 0x2045, 0x2046, 0x2047,
+            0x204A, 0x2056, 0x2057, 0x2058, 0x205C, 0x205D, 0x2060, 0x2061, 0x2065, 0x2066, 0x2070, 0x2072,
+            0x2074, 0x2075, 0x207D, 0x207E, 0x207F, 0x2080, 0x2081, 0x2085, 0x208D, 0x208E, 0x208F, 0x2090,
+            0x209D, 0x20A0, 0x20A7, 0x20A8, 0x20B6, 0x20B7, 0x20BB, 0x20BC, 0x20BE, 0x20BF, 0x20C0, 0x20C1,
+            0x20D0, 0x20F1, 0x2100, 0x2103, 0x2104, 0x2105, 0x2106, 0x2109, 0x210A, 0x2113, 0x2114, 0x2116,
+            0x2117, 0x2121, 0x2123, 0x212B, 0x212C, 0x2154, 0x2156, 0x215B, 0x215C, 0x215E, 0x215F, 0x2160,
+            0x216C, 0x2170, 0x217A, 0x2189, 0x218A, 0x218C, 0x2190, 0x219A, 0x21D2, 0x21D3, 0x21D4, 0x21D5,
+            0x2200, 0x2201, 0x2202, 0x2204, 0x2207, 0x2209, 0x220B, 0x220C, 0x220F, 0x2210, 0x2211, 0x2212,
+            0x2214, 0x2215, 0x2216, 0x221A, 0x221B, 0x221D, 0x2221, 0x2223, 0x2224, 0x2225, 0x2226, 0x2227,
+            0x222D, 0x222E, 0x222F, 0x2234, 0x2238, 0x223C, 0x223E, 0x2248, 0x2249, 0x224C, 0x224D, 0x2252,
+            0x2253, 0x2260, 0x2262, 0x2264, 0x2268, 0x226A, 0x226C, 0x226E, 0x2270, 0x2282, 0x2284, 0x2286,
+            0x2288, 0x2295, 0x2296, 0x2299, 0x229A, 0x22A5, 0x22A6, 0x22BF, 0x22C0, 0x22EF, 0x22F0, 0x2308,
+            0x2309, 0x230A, 0x230B, 0x230C, 0x2312, 0x2313, 0x231A, 0x231C, 0x2329, 0x232A, 0x232B, 0x23F0,
+            0x23F4, 0x2427, 0x2440, 0x244B, 0x2460, 0x24FF, 0x2500, 0x254C, 0x2550, 0x2575, 0x2580, 0x2590,
+            0x2592, 0x2596, 0x25A0, 0x25A2, 0x25A3, 0x25AA, 0x25B2, 0x25B4, 0x25B6, 0x25B8, 0x25BC, 0x25BE,
+            0x25C0, 0x25C2, 0x25C6, 0x25C9, 0x25CB, 0x25CC, 0x25CE, 0x25D2, 0x25E2, 0x25E6, 0x25EF, 0x25F0,
+            0x2600, 0x2604, 0x2605, 0x2607, 0x2609, 0x260A, 0x260E, 0x2610, 0x2614, 0x2616, 0x2618, 0x2619,
+            0x261A, 0x261D, 0x261E, 0x2620, 0x2639, 0x263C, 0x2640, 0x2641, 0x2642, 0x2643, 0x2660, 0x2662,
+            0x2663, 0x2666, 0x2667, 0x2668, 0x2669, 0x266B, 0x266C, 0x266E, 0x266F, 0x2670, 0x267F, 0x2680,
+            0x269E, 0x26A0, 0x26BD, 0x26C9, 0x26CD, 0x26CE, 0x26CF, 0x26D2, 0x26D3, 0x26D5, 0x26D8, 0x26DA,
+            0x26DC, 0x26DD, 0x26DF, 0x26E2, 0x26E3, 0x26E4, 0x26E8, 0x26EA, 0x26EB, 0x26F1, 0x26F6, 0x26F7,
+            0x26F9, 0x26FA, 0x26FB, 0x26FD, 0x2705, 0x2708, 0x270A, 0x270E, 0x2757, 0x2758, 0x275B, 0x2761,
+            0x2762, 0x2764, 0x2765, 0x2768, 0x2769, 0x276A, 0x276B, 0x276C, 0x276D, 0x276E, 0x276F, 0x2770,
+            0x2771, 0x2772, 0x2773, 0x2774, 0x2775, 0x2776, 0x2794, 0x27C5, 0x27C6, 0x27C7, 0x27E6, 0x27E7,
+            0x27E8, 0x27E9, 0x27EA, 0x27EB, 0x27EC, 0x27ED, 0x27EE, 0x27EF, 0x27F0, 0x2983, 0x2984, 0x2985,
+            0x2986, 0x2987, 0x2988, 0x2989, 0x298A, 0x298B, 0x298C, 0x298D, 0x298E, 0x298F, 0x2990, 0x2991,
+            0x2992, 0x2993, 0x2994, 0x2995, 0x2996, 0x2997, 0x2998, 0x2999, 0x29D8, 0x29D9, 0x29DA, 0x29DB,
+            0x29DC, 0x29FC, 0x29FD, 0x29FE, 0x2B55, 0x2B5A, 0x2B74, 0x2B76, 0x2B96, 0x2B97, 0x2CEF, 0x2CF2,
+            0x2CF4, 0x2CF9, 0x2CFA, 0x2CFD, 0x2CFE, 0x2CFF, 0x2D00, 0x2D26, 0x2D27, 0x2D28, 0x2D2D, 0x2D2E,
+            0x2D30, 0x2D68, 0x2D6F, 0x2D70, 0x2D71, 0x2D7F, 0x2D80, 0x2D97, 0x2DA0, 0x2DA7, 0x2DA8, 0x2DAF,
+            0x2DB0, 0x2DB7, 0x2DB8, 0x2DBF, 0x2DC0, 0x2DC7, 0x2DC8, 0x2DCF, 0x2DD0, 0x2DD7, 0x2DD8, 0x2DDF,
+            0x2DE0, 0x2E00, 0x2E0E, 0x2E16, 0x2E17, 0x2E18, 0x2E19, 0x2E1A, 0x2E1C, 0x2E1E, 0x2E20, 0x2E22,
+            0x2E23, 0x2E24, 0x2E25, 0x2E26, 0x2E27, 0x2E28, 0x2E29, 0x2E2A, 0x2E2E, 0x2E2F, 0x2E30, 0x2E32,
+            0x2E33, 0x2E35, 0x2E3A, 0x2E3C, 0x2E3F, 0x2E40, 0x2E42, 0x2E43, 0x2E4B, 0x2E4C, 0x2E4D, 0x2E4E,
+            0x2E50, 0x2E53, 0x2E55, 0x2E56, 0x2E57, 0x2E58, 0x2E59, 0x2E5A, 0x2E5B, 0x2E5C, 0x2E5D, 0x2E5E,
+            0x2E80, 0x2E9A, 0x2E9B, 0x2EF4, 0x2F00, 0x2FD6, 0x2FF0, 0x2FFC, 0x3000, 0x3001, 0x3003, 0x3005,
+            0x3006, 0x3008, 0x3009, 0x300A, 0x300B, 0x300C, 0x300D, 0x300E, 0x300F, 0x3010, 0x3011, 0x3012,
+            0x3014, 0x3015, 0x3016, 0x3017, 0x3018, 0x3019, 0x301A, 0x301B, 0x301C, 0x301D, 0x301E, 0x3020,
+            0x302A, 0x3030, 0x3035, 0x3036, 0x303B, 0x303D, 0x3040, 0x3041, 0x3042, 0x3043, 0x3044, 0x3045,
+            0x3046, 0x3047, 0x3048, 0x3049, 0x304A, 0x3063, 0x3064, 0x3083, 0x3084, 0x3085, 0x3086, 0x3087,
+            0x3088, 0x308E, 0x308F, 0x3095, 0x3097, 0x3099, 0x309B, 0x309F, 0x30A0, 0x30A1, 0x30A2, 0x30A3,
+            0x30A4, 0x30A5, 0x30A6, 0x30A7, 0x30A8, 0x30A9, 0x30AA, 0x30C3, 0x30C4, 0x30E3, 0x30E4, 0x30E5,
+            0x30E6, 0x30E7, 0x30E8, 0x30EE, 0x30EF, 0x30F5, 0x30F7, 0x30FB, 0x30FC, 0x30FD, 0x30FF, 0x3100,
+            0x3105, 0x3130, 0x3131, 0x318F, 0x3190, 0x31E4, 0x31F0, 0x3200, 0x321F, 0x3220, 0x3248, 0x3250,
+            0x4DC0, 0x4E00, 0xA015, 0xA016, 0xA48D, 0xA490, 0xA4C7, 0xA4D0, 0xA4FE, 0xA500, 0xA60D, 0xA60E,
+            0xA60F, 0xA610, 0xA620, 0xA62A, 0xA62C, 0xA640, 0xA66F, 0xA673, 0xA674, 0xA67E, 0xA69E, 0xA6A0,
+            0xA6F0, 0xA6F2, 0xA6F3, 0xA6F8, 0xA700, 0xA7CB, 0xA7D0, 0xA7D2, 0xA7D3, 0xA7D4, 0xA7D5, 0xA7DA,
+            0xA7F2, 0xA802, 0xA803, 0xA806, 0xA807, 0xA80B, 0xA80C, 0xA823, 0xA828, 0xA82C, 0xA82D, 0xA830,
+            0xA838, 0xA839, 0xA83A, 0xA840, 0xA874, 0xA876, 0xA878, 0xA880, 0xA882, 0xA8B4, 0xA8C6, 0xA8CE,
+            0xA8D0, 0xA8DA, 0xA8E0, 0xA8F2, 0xA8FC, 0xA8FD, 0xA8FF, 0xA900, 0xA90A, 0xA926, 0xA92E, 0xA930,
+            0xA947, 0xA954, 0xA95F, 0xA960, 0xA97D, 0xA980, 0xA984, 0xA9B3, 0xA9C1, 0xA9C7, 0xA9CA, 0xA9CE,
+            0xA9CF, 0xA9D0, 0xA9DA, 0xA9DE, 0xA9E0, 0xA9F0, 0xA9FA, 0xA9FF, 0xAA00, 0xAA29, 0xAA37, 0xAA40,
+            0xAA43, 0xAA44, 0xAA4C, 0xAA4E, 0xAA50, 0xAA5A, 0xAA5C, 0xAA5D, 0xAA60, 0xAAC3, 0xAADB, 0xAAE0,
+            0xAAEB, 0xAAF0, 0xAAF2, 0xAAF5, 0xAAF7, 0xAB01, 0xAB07, 0xAB09, 0xAB0F, 0xAB11, 0xAB17, 0xAB20,
+            0xAB27, 0xAB28, 0xAB2F, 0xAB30, 0xAB6C, 0xAB70, 0xABE3, 0xABEB, 0xABEC, 0xABEE, 0xABF0, 0xABFA,
+            0xAC00, 0xAC01, 0xAC1C, 0xAC1D, 0xAC38, 0xAC39, 0xAC54, 0xAC55, 0xAC70, 0xAC71, 0xAC8C, 0xAC8D,
+            0xACA8, 0xACA9, 0xACC4, 0xACC5, 0xACE0, 0xACE1, 0xACFC, 0xACFD, 0xAD18, 0xAD19, 0xAD34, 0xAD35,
+            0xAD50, 0xAD51, 0xAD6C, 0xAD6D, 0xAD88, 0xAD89, 0xADA4, 0xADA5, 0xADC0, 0xADC1, 0xADDC, 0xADDD,
+            0xADF8, 0xADF9, 0xAE14, 0xAE15, 0xAE30, 0xAE31, 0xAE4C, 0xAE4D, 0xAE68, 0xAE69, 0xAE84, 0xAE85,
+            0xAEA0, 0xAEA1, 0xAEBC, 0xAEBD, 0xAED8, 0xAED9, 0xAEF4, 0xAEF5, 0xAF10, 0xAF11, 0xAF2C, 0xAF2D,
+            0xAF48, 0xAF49, 0xAF64, 0xAF65, 0xAF80, 0xAF81, 0xAF9C, 0xAF9D, 0xAFB8, 0xAFB9, 0xAFD4, 0xAFD5,
+            0xAFF0, 0xAFF1, 0xB00C, 0xB00D, 0xB028, 0xB029, 0xB044, 0xB045, 0xB060, 0xB061, 0xB07C, 0xB07D,
+            0xB098, 0xB099, 0xB0B4, 0xB0B5, 0xB0D0, 0xB0D1, 0xB0EC, 0xB0ED, 0xB108, 0xB109, 0xB124, 0xB125,
+            0xB140, 0xB141, 0xB15C, 0xB15D, 0xB178, 0xB179, 0xB194, 0xB195, 0xB1B0, 0xB1B1, 0xB1CC, 0xB1CD,
+            0xB1E8, 0xB1E9, 0xB204, 0xB205, 0xB220, 0xB221, 0xB23C, 0xB23D, 0xB258, 0xB259, 0xB274, 0xB275,
+            0xB290, 0xB291, 0xB2AC, 0xB2AD, 0xB2C8, 0xB2C9, 0xB2E4, 0xB2E5, 0xB300, 0xB301, 0xB31C, 0xB31D,
+            0xB338, 0xB339, 0xB354, 0xB355, 0xB370, 0xB371, 0xB38C, 0xB38D, 0xB3A8, 0xB3A9, 0xB3C4, 0xB3C5,
+            0xB3E0, 0xB3E1, 0xB3FC, 0xB3FD, 0xB418, 0xB419, 0xB434, 0xB435, 0xB450, 0xB451, 0xB46C, 0xB46D,
+            0xB488, 0xB489, 0xB4A4, 0xB4A5, 0xB4C0, 0xB4C1, 0xB4DC, 0xB4DD, 0xB4F8, 0xB4F9, 0xB514, 0xB515,
+            0xB530, 0xB531, 0xB54C, 0xB54D, 0xB568, 0xB569, 0xB584, 0xB585, 0xB5A0, 0xB5A1, 0xB5BC, 0xB5BD,
+            0xB5D8, 0xB5D9, 0xB5F4, 0xB5F5, 0xB610, 0xB611, 0xB62C, 0xB62D, 0xB648, 0xB649, 0xB664, 0xB665,
+            0xB680, 0xB681, 0xB69C, 0xB69D, 0xB6B8, 0xB6B9, 0xB6D4, 0xB6D5, 0xB6F0, 0xB6F1, 0xB70C, 0xB70D,
+            0xB728, 0xB729, 0xB744, 0xB745, 0xB760, 0xB761, 0xB77C, 0xB77D, 0xB798, 0xB799, 0xB7B4, 0xB7B5,
+            0xB7D0, 0xB7D1, 0xB7EC, 0xB7ED, 0xB808, 0xB809, 0xB824, 0xB825, 0xB840, 0xB841, 0xB85C, 0xB85D,
+            0xB878, 0xB879, 0xB894, 0xB895, 0xB8B0, 0xB8B1, 0xB8CC, 0xB8CD, 0xB8E8, 0xB8E9, 0xB904, 0xB905,
+            0xB920, 0xB921, 0xB93C, 0xB93D, 0xB958, 0xB959, 0xB974, 0xB975, 0xB990, 0xB991, 0xB9AC, 0xB9AD,
+            0xB9C8, 0xB9C9, 0xB9E4, 0xB9E5, 0xBA00, 0xBA01, 0xBA1C, 0xBA1D, 0xBA38, 0xBA39, 0xBA54, 0xBA55,
+            0xBA70, 0xBA71, 0xBA8C, 0xBA8D, 0xBAA8, 0xBAA9, 0xBAC4, 0xBAC5, 0xBAE0, 0xBAE1, 0xBAFC, 0xBAFD,
+            0xBB18, 0xBB19, 0xBB34, 0xBB35, 0xBB50, 0xBB51, 0xBB6C, 0xBB6D, 0xBB88, 0xBB89, 0xBBA4, 0xBBA5,
+            0xBBC0, 0xBBC1, 0xBBDC, 0xBBDD, 0xBBF8, 0xBBF9, 0xBC14, 0xBC15, 0xBC30, 0xBC31, 0xBC4C, 0xBC4D,
+            0xBC68, 0xBC69, 0xBC84, 0xBC85, 0xBCA0, 0xBCA1, 0xBCBC, 0xBCBD, 0xBCD8, 0xBCD9, 0xBCF4, 0xBCF5,
+            0xBD10, 0xBD11, 0xBD2C, 0xBD2D, 0xBD48, 0xBD49, 0xBD64, 0xBD65, 0xBD80, 0xBD81, 0xBD9C, 0xBD9D,
+            0xBDB8, 0xBDB9, 0xBDD4, 0xBDD5, 0xBDF0, 0xBDF1, 0xBE0C, 0xBE0D, 0xBE28, 0xBE29, 0xBE44, 0xBE45,
+            0xBE60, 0xBE61, 0xBE7C, 0xBE7D, 0xBE98, 0xBE99, 0xBEB4, 0xBEB5, 0xBED0, 0xBED1, 0xBEEC, 0xBEED,
+            0xBF08, 0xBF09, 0xBF24, 0xBF25, 0xBF40, 0xBF41, 0xBF5C, 0xBF5D, 0xBF78, 0xBF79, 0xBF94, 0xBF95,
+            0xBFB0, 0xBFB1, 0xBFCC, 0xBFCD, 0xBFE8, 0xBFE9, 0xC004, 0xC005, 0xC020, 0xC021, 0xC03C, 0xC03D,
+            0xC058, 0xC059, 0xC074, 0xC075, 0xC090, 0xC091, 0xC0AC, 0xC0AD, 0xC0C8, 0xC0C9, 0xC0E4, 0xC0E5,
+            0xC100, 0xC101, 0xC11C, 0xC11D, 0xC138, 0xC139, 0xC154, 0xC155, 0xC170, 0xC171, 0xC18C, 0xC18D,
+            0xC1A8, 0xC1A9, 0xC1C4, 0xC1C5, 0xC1E0, 0xC1E1, 0xC1FC, 0xC1FD, 0xC218, 0xC219, 0xC234, 0xC235,
+            0xC250, 0xC251, 0xC26C, 0xC26D, 0xC288, 0xC289, 0xC2A4, 0xC2A5, 0xC2C0, 0xC2C1, 0xC2DC, 0xC2DD,
+            0xC2F8, 0xC2F9, 0xC314, 0xC315, 0xC330, 0xC331, 0xC34C, 0xC34D, 0xC368, 0xC369, 0xC384, 0xC385,
+            0xC3A0, 0xC3A1, 0xC3BC, 0xC3BD, 0xC3D8, 0xC3D9, 0xC3F4, 0xC3F5, 0xC410, 0xC411, 0xC42C, 0xC42D,
+            0xC448, 0xC449, 0xC464, 0xC465, 0xC480, 0xC481, 0xC49C, 0xC49D, 0xC4B8, 0xC4B9, 0xC4D4, 0xC4D5,
+            0xC4F0, 0xC4F1, 0xC50C, 0xC50D, 0xC528, 0xC529, 0xC544, 0xC545, 0xC560, 0xC561, 0xC57C, 0xC57D,
+            0xC598, 0xC599, 0xC5B4, 0xC5B5, 0xC5D0, 0xC5D1, 0xC5EC, 0xC5ED, 0xC608, 0xC609, 0xC624, 0xC625,
+            0xC640, 0xC641, 0xC65C, 0xC65D, 0xC678, 0xC679, 0xC694, 0xC695, 0xC6B0, 0xC6B1, 0xC6CC, 0xC6CD,
+            0xC6E8, 0xC6E9, 0xC704, 0xC705, 0xC720, 0xC721, 0xC73C, 0xC73D, 0xC758, 0xC759, 0xC774, 0xC775,
+            0xC790, 0xC791, 0xC7AC, 0xC7AD, 0xC7C8, 0xC7C9, 0xC7E4, 0xC7E5, 0xC800, 0xC801, 0xC81C, 0xC81D,
+            0xC838, 0xC839, 0xC854, 0xC855, 0xC870, 0xC871, 0xC88C, 0xC88D, 0xC8A8, 0xC8A9, 0xC8C4, 0xC8C5,
+            0xC8E0, 0xC8E1, 0xC8FC, 0xC8FD, 0xC918, 0xC919, 0xC934, 0xC935, 0xC950, 0xC951, 0xC96C, 0xC96D,
+            0xC988, 0xC989, 0xC9A4, 0xC9A5, 0xC9C0, 0xC9C1, 0xC9DC, 0xC9DD, 0xC9F8, 0xC9F9, 0xCA14, 0xCA15,
+            0xCA30, 0xCA31, 0xCA4C, 0xCA4D, 0xCA68, 0xCA69, 0xCA84, 0xCA85, 0xCAA0, 0xCAA1, 0xCABC, 0xCABD,
+            0xCAD8, 0xCAD9, 0xCAF4, 0xCAF5, 0xCB10, 0xCB11, 0xCB2C, 0xCB2D, 0xCB48, 0xCB49, 0xCB64, 0xCB65,
+            0xCB80, 0xCB81, 0xCB9C, 0xCB9D, 0xCBB8, 0xCBB9, 0xCBD4, 0xCBD5, 0xCBF0, 0xCBF1, 0xCC0C, 0xCC0D,
+            0xCC28, 0xCC29, 0xCC44, 0xCC45, 0xCC60, 0xCC61, 0xCC7C, 0xCC7D, 0xCC98, 0xCC99, 0xCCB4, 0xCCB5,
+            0xCCD0, 0xCCD1, 0xCCEC, 0xCCED, 0xCD08, 0xCD09, 0xCD24, 0xCD25, 0xCD40, 0xCD41, 0xCD5C, 0xCD5D,
+            0xCD78, 0xCD79, 0xCD94, 0xCD95, 0xCDB0, 0xCDB1, 0xCDCC, 0xCDCD, 0xCDE8, 0xCDE9, 0xCE04, 0xCE05,
+            0xCE20, 0xCE21, 0xCE3C, 0xCE3D, 0xCE58, 0xCE59, 0xCE74, 0xCE75, 0xCE90, 0xCE91, 0xCEAC, 0xCEAD,
+            0xCEC8, 0xCEC9, 0xCEE4, 0xCEE5, 0xCF00, 0xCF01, 0xCF1C, 0xCF1D, 0xCF38, 0xCF39, 0xCF54, 0xCF55,
+            0xCF70, 0xCF71, 0xCF8C, 0xCF8D, 0xCFA8, 0xCFA9, 0xCFC4, 0xCFC5, 0xCFE0, 0xCFE1, 0xCFFC, 0xCFFD,
+            0xD018, 0xD019, 0xD034, 0xD035, 0xD050, 0xD051, 0xD06C, 0xD06D, 0xD088, 0xD089, 0xD0A4, 0xD0A5,
+            0xD0C0, 0xD0C1, 0xD0DC, 0xD0DD, 0xD0F8, 0xD0F9, 0xD114, 0xD115, 0xD130, 0xD131, 0xD14C, 0xD14D,
+            0xD168, 0xD169, 0xD184, 0xD185, 0xD1A0, 0xD1A1, 0xD1BC, 0xD1BD, 0xD1D8, 0xD1D9, 0xD1F4, 0xD1F5,
+            0xD210, 0xD211, 0xD22C, 0xD22D, 0xD248, 0xD249, 0xD264, 0xD265, 0xD280, 0xD281, 0xD29C, 0xD29D,
+            0xD2B8, 0xD2B9, 0xD2D4, 0xD2D5, 0xD2F0, 0xD2F1, 0xD30C, 0xD30D, 0xD328, 0xD329, 0xD344, 0xD345,
+            0xD360, 0xD361, 0xD37C, 0xD37D, 0xD398, 0xD399, 0xD3B4, 0xD3B5, 0xD3D0, 0xD3D1, 0xD3EC, 0xD3ED,
+            0xD408, 0xD409, 0xD424, 0xD425, 0xD440, 0xD441, 0xD45C, 0xD45D, 0xD478, 0xD479, 0xD494, 0xD495,
+            0xD4B0, 0xD4B1, 0xD4CC, 0xD4CD, 0xD4E8, 0xD4E9, 0xD504, 0xD505, 0xD520, 0xD521, 0xD53C, 0xD53D,
+            0xD558, 0xD559, 0xD574, 0xD575, 0xD590, 0xD591, 0xD5AC, 0xD5AD, 0xD5C8, 0xD5C9, 0xD5E4, 0xD5E5,
+            0xD600, 0xD601, 0xD61C, 0xD61D, 0xD638, 0xD639, 0xD654, 0xD655, 0xD670, 0xD671, 0xD68C, 0xD68D,
+            0xD6A8, 0xD6A9, 0xD6C4, 0xD6C5, 0xD6E0, 0xD6E1, 0xD6FC, 0xD6FD, 0xD718, 0xD719, 0xD734, 0xD735,
+            0xD750, 0xD751, 0xD76C, 0xD76D, 0xD788, 0xD789, 0xD7A4, 0xD7B0, 0xD7C7, 0xD7CB, 0xD7FC, 0xD800,
+            0xE000, 0xF900, 0xFB00, 0xFB07, 0xFB13, 0xFB18, 0xFB1D, 0xFB1E, 0xFB1F, 0xFB29, 0xFB2A, 0xFB37,
+            0xFB38, 0xFB3D, 0xFB3E, 0xFB3F, 0xFB40, 0xFB42, 0xFB43, 0xFB45, 0xFB46, 0xFB50, 0xFBC3, 0xFBD3,
+            0xFD3E, 0xFD3F, 0xFD40, 0xFD90, 0xFD92, 0xFDC8, 0xFDCF, 0xFDD0, 0xFDF0, 0xFDFC, 0xFDFD, 0xFE00,
+            0xFE10, 0xFE11, 0xFE13, 0xFE15, 0xFE17, 0xFE18, 0xFE19, 0xFE1A, 0xFE20, 0xFE30, 0xFE35, 0xFE36,
+            0xFE37, 0xFE38, 0xFE39, 0xFE3A, 0xFE3B, 0xFE3C, 0xFE3D, 0xFE3E, 0xFE3F, 0xFE40, 0xFE41, 0xFE42,
+            0xFE43, 0xFE44, 0xFE45, 0xFE47, 0xFE48, 0xFE49, 0xFE50, 0xFE51, 0xFE52, 0xFE53, 0xFE54, 0xFE56,
+            0xFE58, 0xFE59, 0xFE5A, 0xFE5B, 0xFE5C, 0xFE5D, 0xFE5E, 0xFE5F, 0xFE67, 0xFE68, 0xFE69, 0xFE6A,
+            0xFE6B, 0xFE6C, 0xFE70, 0xFE75, 0xFE76, 0xFEFD, 0xFEFF, 0xFF00, 0xFF01, 0xFF02, 0xFF04, 0xFF05,
+            0xFF06, 0xFF08, 0xFF09, 0xFF0A, 0xFF0C, 0xFF0D, 0xFF0E, 0xFF0F, 0xFF1A, 0xFF1C, 0xFF1F, 0xFF20,
+            0xFF3B, 0xFF3C, 0xFF3D, 0xFF3E, 0xFF5B, 0xFF5C, 0xFF5D, 0xFF5E, 0xFF5F, 0xFF60, 0xFF62, 0xFF63,
+            0xFF65, 0xFF66, 0xFF67, 0xFF71, 0xFF9E, 0xFFA0, 0xFFBF, 0xFFC2, 0xFFC8, 0xFFCA, 0xFFD0, 0xFFD2,
+            0xFFD8, 0xFFDA, 0xFFDD, 0xFFE0, 0xFFE1, 0xFFE2, 0xFFE5, 0xFFE7, 0xFFE8, 0xFFEF, 0xFFF9, 0xFFFC,
+            0xFFFD, 0xFFFE, 0x10000, 0x1000C, 0x1000D, 0x10027, 0x10028, 0x1003B, 0x1003C, 0x1003E, 0x1003F, 0x1004E,
+            0x10050, 0x1005E, 0x10080, 0x100FB, 0x10100, 0x10103, 0x10107, 0x10134, 0x10137, 0x1018F, 0x10190, 0x1019D,
+            0x101A0, 0x101A1, 0x101D0, 0x101FD, 0x101FE, 0x10280, 0x1029D, 0x102A0, 0x102D1, 0x102E0, 0x102E1, 0x102FC,
+            0x10300, 0x10324, 0x1032D, 0x1034B, 0x10350, 0x10376, 0x1037B, 0x10380, 0x1039E, 0x1039F, 0x103A0, 0x103C4,
+            0x103C8, 0x103D0, 0x103D1, 0x103D6, 0x10400, 0x1049E, 0x104A0, 0x104AA, 0x104B0, 0x104D4, 0x104D8, 0x104FC,
+            0x10500, 0x10528, 0x10530, 0x10564, 0x1056F, 0x1057B, 0x1057C, 0x1058B, 0x1058C, 0x10593, 0x10594, 0x10596,
+            0x10597, 0x105A2, 0x105A3, 0x105B2, 0x105B3, 0x105BA, 0x105BB, 0x105BD, 0x10600, 0x10737, 0x10740, 0x10756,
+            0x10760, 0x10768, 0x10780, 0x10786, 0x10787, 0x107B1, 0x107B2, 0x107BB, 0x10800, 0x10806, 0x10808, 0x10809,
+            0x1080A, 0x10836, 0x10837, 0x10839, 0x1083C, 0x1083D, 0x1083F, 0x10856, 0x10857, 0x10858, 0x1089F, 0x108A7,
+            0x108B0, 0x108E0, 0x108F3, 0x108F4, 0x108F6, 0x108FB, 0x1091C, 0x1091F, 0x10920, 0x1093A, 0x1093F, 0x10940,
+            0x10980, 0x109B8, 0x109BC, 0x109D0, 0x109D2, 0x10A01, 0x10A04, 0x10A05, 0x10A07, 0x10A0C, 0x10A10, 0x10A14,
+            0x10A15, 0x10A18, 0x10A19, 0x10A36, 0x10A38, 0x10A3B, 0x10A3F, 0x10A40, 0x10A49, 0x10A50, 0x10A58, 0x10A59,
+            0x10A60, 0x10AA0, 0x10AC0, 0x10AE5, 0x10AE7, 0x10AEB, 0x10AF0, 0x10AF6, 0x10AF7, 0x10B00, 0x10B36, 0x10B39,
+            0x10B40, 0x10B56, 0x10B58, 0x10B73, 0x10B78, 0x10B92, 0x10B99, 0x10B9D, 0x10BA9, 0x10BB0, 0x10C00, 0x10C49,
+            0x10C80, 0x10CB3, 0x10CC0, 0x10CF3, 0x10CFA, 0x10D24, 0x10D28, 0x10D30, 0x10D3A, 0x10E60, 0x10E7F, 0x10E80,
+            0x10EAA, 0x10EAB, 0x10EAD, 0x10EAE, 0x10EB0, 0x10EB2, 0x10F00, 0x10F28, 0x10F30, 0x10F46, 0x10F51, 0x10F5A,
+            0x10F70, 0x10F82, 0x10F86, 0x10F8A, 0x10FB0, 0x10FCC, 0x10FE0, 0x10FF7, 0x11000, 0x11003, 0x11038, 0x11047,
+            0x11049, 0x1104E, 0x11052, 0x11066, 0x11070, 0x11071, 0x11073, 0x11075, 0x11076, 0x1107F, 0x11083, 0x110B0,
+            0x110BB, 0x110BE, 0x110C2, 0x110C3, 0x110CD, 0x110CE, 0x110D0, 0x110E9, 0x110F0, 0x110FA, 0x11100, 0x11103,
+            0x11127, 0x11135, 0x11136, 0x11140, 0x11144, 0x11145, 0x11147, 0x11148, 0x11150, 0x11173, 0x11174, 0x11175,
+            0x11176, 0x11177, 0x11180, 0x11183, 0x111B3, 0x111C1, 0x111C5, 0x111C7, 0x111C8, 0x111C9, 0x111CD, 0x111CE,
+            0x111D0, 0x111DA, 0x111DB, 0x111DC, 0x111DD, 0x111E0, 0x111E1, 0x111F5, 0x11200, 0x11212, 0x11213, 0x1122C,
+            0x11238, 0x1123A, 0x1123B, 0x1123D, 0x1123E, 0x1123F, 0x11280, 0x11287, 0x11288, 0x11289, 0x1128A, 0x1128E,
+            0x1128F, 0x1129E, 0x1129F, 0x112A9, 0x112AA, 0x112B0, 0x112DF, 0x112EB, 0x112F0, 0x112FA, 0x11300, 0x11304,
+            0x11305, 0x1130D, 0x1130F, 0x11311, 0x11313, 0x11329, 0x1132A, 0x11331, 0x11332, 0x11334, 0x11335, 0x1133A,
+            0x1133B, 0x1133D, 0x1133E, 0x11345, 0x11347, 0x11349, 0x1134B, 0x1134E, 0x11350, 0x11351, 0x11357, 0x11358,
+            0x1135D, 0x11362, 0x11364, 0x11366, 0x1136D, 0x11370, 0x11375, 0x11400, 0x11435, 0x11447, 0x1144B, 0x1144F,
+            0x11450, 0x1145A, 0x1145C, 0x1145D, 0x1145E, 0x1145F, 0x11462, 0x11480, 0x114B0, 0x114C4, 0x114C8, 0x114D0,
+            0x114DA, 0x11580, 0x115AF, 0x115B6, 0x115B8, 0x115C1, 0x115C2, 0x115C4, 0x115C6, 0x115C9, 0x115D8, 0x115DC,
+            0x115DE, 0x11600, 0x11630, 0x11641, 0x11643, 0x11645, 0x11650, 0x1165A, 0x11660, 0x1166D, 0x11680, 0x116AB,
+            0x116B8, 0x116BA, 0x116C0, 0x116CA, 0x11700, 0x1171B, 0x1171D, 0x1172C, 0x11730, 0x1173A, 0x1173C, 0x1173F,
+            0x11747, 0x11800, 0x1182C, 0x1183B, 0x1183C, 0x118A0, 0x118E0, 0x118EA, 0x118F3, 0x118FF, 0x11907, 0x11909,
+            0x1190A, 0x1190C, 0x11914, 0x11915, 0x11917, 0x11918, 0x11930, 0x11936, 0x11937, 0x11939, 0x1193B, 0x1193F,
+            0x11940, 0x11941, 0x11942, 0x11944, 0x11947, 0x11950, 0x1195A, 0x119A0, 0x119A8, 0x119AA, 0x119D1, 0x119D8,
+            0x119DA, 0x119E1, 0x119E2, 0x119E3, 0x119E4, 0x119E5, 0x11A00, 0x11A01, 0x11A0B, 0x11A33, 0x11A3A, 0x11A3B,
+            0x11A3F, 0x11A40, 0x11A41, 0x11A45, 0x11A46, 0x11A47, 0x11A48, 0x11A50, 0x11A51, 0x11A5C, 0x11A8A, 0x11A9A,
+            0x11A9D, 0x11A9E, 0x11AA1, 0x11AA3, 0x11AB0, 0x11AF9, 0x11C00, 0x11C09, 0x11C0A, 0x11C2F, 0x11C37, 0x11C38,
+            0x11C40, 0x11C41, 0x11C46, 0x11C50, 0x11C5A, 0x11C6D, 0x11C70, 0x11C71, 0x11C72, 0x11C90, 0x11C92, 0x11CA8,
+            0x11CA9, 0x11CB7, 0x11D00, 0x11D07, 0x11D08, 0x11D0A, 0x11D0B, 0x11D31, 0x11D37, 0x11D3A, 0x11D3B, 0x11D3C,
+            0x11D3E, 0x11D3F, 0x11D46, 0x11D47, 0x11D48, 0x11D50, 0x11D5A, 0x11D60, 0x11D66, 0x11D67, 0x11D69, 0x11D6A,
+            0x11D8A, 0x11D8F, 0x11D90, 0x11D92, 0x11D93, 0x11D98, 0x11D99, 0x11DA0, 0x11DAA, 0x11EE0, 0x11EF3, 0x11EF7,
+            0x11EF9, 0x11FB0, 0x11FB1, 0x11FC0, 0x11FDD, 0x11FE1, 0x11FF2, 0x11FFF, 0x12000, 0x1239A, 0x12400, 0x1246F,
+            0x12470, 0x12475, 0x12480, 0x12544, 0x12F90, 0x12FF3, 0x13000, 0x13258, 0x1325B, 0x1325E, 0x13282, 0x13283,
+            0x13286, 0x13287, 0x13288, 0x13289, 0x1328A, 0x13379, 0x1337A, 0x1337C, 0x1342F, 0x13430, 0x13437, 0x13438,
+            0x13439, 0x14400, 0x145CE, 0x145CF, 0x145D0, 0x14647, 0x16800, 0x16A39, 0x16A40, 0x16A5F, 0x16A60, 0x16A6A,
+            0x16A6E, 0x16A70, 0x16ABF, 0x16AC0, 0x16ACA, 0x16AD0, 0x16AEE, 0x16AF0, 0x16AF5, 0x16AF6, 0x16B00, 0x16B30,
+            0x16B37, 0x16B3A, 0x16B44, 0x16B45, 0x16B46, 0x16B50, 0x16B5A, 0x16B5B, 0x16B62, 0x16B63, 0x16B78, 0x16B7D,
+            0x16B90, 0x16E40, 0x16E97, 0x16E99, 0x16E9B, 0x16F00, 0x16F4B, 0x16F4F, 0x16F50, 0x16F51, 0x16F88, 0x16F8F,
+            0x16F93, 0x16FA0, 0x16FE0, 0x16FE4, 0x16FE5, 0x16FF0, 0x16FF2, 0x17000, 0x187F8, 0x18800, 0x18B00, 0x18CD6,
+            0x18D00, 0x18D09, 0x1AFF0, 0x1AFF4, 0x1AFF5, 0x1AFFC, 0x1AFFD, 0x1AFFF, 0x1B000, 0x1B123, 0x1B150, 0x1B153,
+            0x1B164, 0x1B168, 0x1B170, 0x1B2FC, 0x1BC00, 0x1BC6B, 0x1BC70, 0x1BC7D, 0x1BC80, 0x1BC89, 0x1BC90, 0x1BC9A,
+            0x1BC9C, 0x1BC9D, 0x1BC9F, 0x1BCA0, 0x1BCA4, 0x1CF00, 0x1CF2E, 0x1CF30, 0x1CF47, 0x1CF50, 0x1CFC4, 0x1D000,
+            0x1D0F6, 0x1D100, 0x1D127, 0x1D129, 0x1D165, 0x1D16A, 0x1D16D, 0x1D183, 0x1D185, 0x1D18C, 0x1D1AA, 0x1D1AE,
+            0x1D1EB, 0x1D200, 0x1D242, 0x1D245, 0x1D246, 0x1D2E0, 0x1D2F4, 0x1D300, 0x1D357, 0x1D360, 0x1D379, 0x1D400,
+            0x1D455, 0x1D456, 0x1D49D, 0x1D49E, 0x1D4A0, 0x1D4A2, 0x1D4A3, 0x1D4A5, 0x1D4A7, 0x1D4A9, 0x1D4AD, 0x1D4AE,
+            0x1D4BA, 0x1D4BB, 0x1D4BC, 0x1D4BD, 0x1D4C4, 0x1D4C5, 0x1D506, 0x1D507, 0x1D50B, 0x1D50D, 0x1D515, 0x1D516,
+            0x1D51D, 0x1D51E, 0x1D53A, 0x1D53B, 0x1D53F, 0x1D540, 0x1D545, 0x1D546, 0x1D547, 0x1D54A, 0x1D551, 0x1D552,
+            0x1D6A6, 0x1D6A8, 0x1D7CC, 0x1D7CE, 0x1D800, 0x1DA00, 0x1DA37, 0x1DA3B, 0x1DA6D, 0x1DA75, 0x1DA76, 0x1DA84,
+            0x1DA85, 0x1DA87, 0x1DA8B, 0x1DA8C, 0x1DA9B, 0x1DAA0, 0x1DAA1, 0x1DAB0, 0x1DF00, 0x1DF1F, 0x1E000, 0x1E007,
+            0x1E008, 0x1E019, 0x1E01B, 0x1E022, 0x1E023, 0x1E025, 0x1E026, 0x1E02B, 0x1E100, 0x1E12D, 0x1E130, 0x1E137,
+            0x1E13E, 0x1E140, 0x1E14A, 0x1E14E, 0x1E150, 0x1E290, 0x1E2AE, 0x1E2AF, 0x1E2C0, 0x1E2EC, 0x1E2F0, 0x1E2FA,
+            0x1E2FF, 0x1E300, 0x1E7E0, 0x1E7E7, 0x1E7E8, 0x1E7EC, 0x1E7ED, 0x1E7EF, 0x1E7F0, 0x1E7FF, 0x1E800, 0x1E8C5,
+            0x1E8C7, 0x1E8D0, 0x1E8D7, 0x1E900, 0x1E944, 0x1E94B, 0x1E94C, 0x1E950, 0x1E95A, 0x1E95E, 0x1E960, 0x1EC71,
+            0x1ECAC, 0x1ECAD, 0x1ECB0, 0x1ECB1, 0x1ECB5, 0x1ED01, 0x1ED3E, 0x1EE00, 0x1EE04, 0x1EE05, 0x1EE20, 0x1EE21,
+            0x1EE23, 0x1EE24, 0x1EE25, 0x1EE27, 0x1EE28, 0x1EE29, 0x1EE33, 0x1EE34, 0x1EE38, 0x1EE39, 0x1EE3A, 0x1EE3B,
+            0x1EE3C, 0x1EE42, 0x1EE43, 0x1EE47, 0x1EE48, 0x1EE49, 0x1EE4A, 0x1EE4B, 0x1EE4C, 0x1EE4D, 0x1EE50, 0x1EE51,
+            0x1EE53, 0x1EE54, 0x1EE55, 0x1EE57, 0x1EE58, 0x1EE59, 0x1EE5A, 0x1EE5B, 0x1EE5C, 0x1EE5D, 0x1EE5E, 0x1EE5F,
+            0x1EE60, 0x1EE61, 0x1EE63, 0x1EE64, 0x1EE65, 0x1EE67, 0x1EE6B, 0x1EE6C, 0x1EE73, 0x1EE74, 0x1EE78, 0x1EE79,
+            0x1EE7D, 0x1EE7E, 0x1EE7F, 0x1EE80, 0x1EE8A, 0x1EE8B, 0x1EE9C, 0x1EEA1, 0x1EEA4, 0x1EEA5, 0x1EEAA, 0x1EEAB,
+            0x1EEBC, 0x1EEF0, 0x1EEF2, 0x1F000, 0x1F100, 0x1F10D, 0x1F110, 0x1F12E, 0x1F130, 0x1F16A, 0x1F16D, 0x1F170,
+            0x1F1AD, 0x1F1E6, 0x1F200, 0x1F385, 0x1F386, 0x1F39C, 0x1F39E, 0x1F3B5, 0x1F3B7, 0x1F3BC, 0x1F3BD, 0x1F3C2,
+            0x1F3C5, 0x1F3C7, 0x1F3C8, 0x1F3CA, 0x1F3CD, 0x1F3FB, 0x1F400, 0x1F442, 0x1F444, 0x1F446, 0x1F451, 0x1F466,
+            0x1F479, 0x1F47C, 0x1F47D, 0x1F481, 0x1F484, 0x1F485, 0x1F488, 0x1F48F, 0x1F490, 0x1F491, 0x1F492, 0x1F4A0,
+            0x1F4A1, 0x1F4A2, 0x1F4A3, 0x1F4A4, 0x1F4A5, 0x1F4AA, 0x1F4AB, 0x1F4AF, 0x1F4B0, 0x1F4B1, 0x1F4B3, 0x1F500,
+            0x1F507, 0x1F517, 0x1F525, 0x1F532, 0x1F54A, 0x1F574, 0x1F576, 0x1F57A, 0x1F57B, 0x1F590, 0x1F591, 0x1F595,
+            0x1F597, 0x1F5D4, 0x1F5DC, 0x1F5F4, 0x1F5FA, 0x1F645, 0x1F648, 0x1F64B, 0x1F650, 0x1F676, 0x1F679, 0x1F67C,
+            0x1F680, 0x1F6A3, 0x1F6A4, 0x1F6B4, 0x1F6B7, 0x1F6C0, 0x1F6C1, 0x1F6CC, 0x1F6CD, 0x1F700, 0x1F774, 0x1F780,
+            0x1F7D5, 0x1F800, 0x1F80C, 0x1F810, 0x1F848, 0x1F850, 0x1F85A, 0x1F860, 0x1F888, 0x1F890, 0x1F8AE, 0x1F900,
+            0x1F90C, 0x1F90D, 0x1F90F, 0x1F910, 0x1F918, 0x1F920, 0x1F926, 0x1F927, 0x1F930, 0x1F93A, 0x1F93C, 0x1F93F,
+            0x1F977, 0x1F978, 0x1F9B5, 0x1F9B7, 0x1F9B8, 0x1F9BA, 0x1F9BB, 0x1F9BC, 0x1F9CD, 0x1F9D0, 0x1F9D1, 0x1F9DE,
+            0x1FA00, 0x1FA54, 0x1FAC3, 0x1FAC6, 0x1FAF0, 0x1FAF7, 0x1FB00, 0x1FB93, 0x1FB94, 0x1FBCB, 0x1FBF0, 0x1FBFA,
+            0x1FC00, 0x1FFFE, 0x20000, 0x2FFFE, 0x30000, 0x3FFFE, 0xE0001, 0xE0002, 0xE0020, 0xE0080, 0xE0100, 0xE01F0
+        };
+
+        const std::uint8_t _s_line_break_values[] = {
+            7, 11, 3, 1, 2, 7, 5, 18, 22, 29, 26, 25,
+            29, 22, 21, 17, 29, 26, 23, 14, 23, 27, 24, 23,
+            29, 18, 29, 21, 26, 17, 29, 21, 11, 16, 29, 7,
+            4, 7, 10, 21, 25, 26, 29, 28, 29, 28, 22, 29,
+            11, 29, 25, 26, 28, 12, 29, 28, 22, 28, 21, 29,
+            28, 29, 28, 29, 28, 12, 28, 12, 28, 29, 28, 29,
+            28, 29, 28, 29, 12, 29, 7, 10, 7, 10, 7, 29,
+            0, 29, 23, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            7, 29, 0, 29, 0, 29, 23, 11, 0, 29, 26, 0,
+            7, 11, 7, 29, 7, 29, 7, 18, 7, 0, 35, 0,
+            35, 29, 0, 29, 25, 23, 29, 7, 18, 7, 18, 29,
+            7, 24, 25, 24, 29, 7, 29, 18, 29, 7, 29, 7,
+            29, 7, 29, 7, 29, 24, 29, 0, 29, 7, 29, 7,
+            0, 29, 7, 29, 0, 24, 29, 7, 29, 23, 18, 29,
+            0, 7, 26, 29, 7, 29, 7, 29, 7, 29, 7, 0,
+            29, 0, 29, 7, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 7, 29, 7, 29, 7, 29, 7, 29, 7, 29, 7,
+            29, 7, 11, 24, 29, 7, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 7, 29, 7, 0, 7,
+            0, 7, 29, 0, 7, 0, 29, 0, 29, 7, 0, 24,
+            29, 25, 29, 25, 29, 26, 29, 7, 0, 7, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 7, 0, 7, 0, 7, 0, 7, 0, 7, 0, 29,
+            0, 29, 0, 24, 7, 29, 7, 29, 0, 7, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 7,
+            29, 7, 0, 7, 0, 7, 0, 29, 0, 29, 7, 0,
+            24, 29, 26, 0, 29, 7, 0, 7, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 7, 29, 7,
+            0, 7, 0, 7, 0, 7, 0, 29, 0, 29, 7, 0,
+            24, 29, 0, 7, 29, 0, 29, 0, 29, 0, 29, 0,
+            29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            7, 0, 7, 0, 7, 0, 29, 0, 7, 0, 24, 29,
+            26, 29, 0, 7, 29, 0, 29, 0, 29, 0, 29, 0,
+            7, 29, 7, 0, 7, 0, 7, 0, 7, 0, 29, 0,
+            29, 0, 29, 7, 0, 24, 0, 12, 29, 7, 12, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 7, 29, 7,
+            0, 7, 0, 7, 0, 7, 0, 29, 0, 29, 7, 0,
+            24, 0, 29, 0, 7, 29, 0, 29, 0, 29, 7, 29,
+            7, 0, 7, 0, 7, 29, 0, 29, 7, 29, 7, 0,
+            24, 29, 25, 29, 0, 7, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 7, 0, 7, 0, 7, 0, 7,
+            0, 24, 0, 7, 29, 0, 41, 0, 26, 41, 29, 24,
+            11, 0, 41, 0, 41, 0, 41, 0, 41, 0, 41, 0,
+            41, 0, 41, 0, 41, 0, 41, 0, 24, 0, 41, 0,
+            29, 12, 29, 12, 10, 12, 11, 10, 18, 10, 29, 18,
+            29, 7, 29, 24, 29, 11, 7, 29, 7, 29, 7, 21,
+            16, 21, 16, 7, 29, 0, 29, 0, 7, 11, 7, 11,
+            7, 29, 7, 0, 7, 0, 11, 29, 7, 29, 0, 29,
+            12, 11, 12, 29, 10, 0, 41, 24, 11, 29, 41, 24,
+            41, 29, 0, 29, 0, 29, 0, 29, 37, 38, 39, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 7, 29, 11, 29, 0,
+            29, 0, 29, 0, 29, 0, 11, 29, 11, 29, 21, 16,
+            0, 29, 11, 29, 0, 29, 7, 0, 29, 7, 11, 0,
+            29, 7, 0, 29, 0, 29, 0, 7, 0, 41, 11, 20,
+            41, 11, 29, 11, 26, 41, 0, 24, 0, 29, 0, 29,
+            18, 11, 12, 29, 18, 29, 7, 10, 7, 24, 0, 29,
+            0, 29, 7, 29, 7, 29, 0, 29, 0, 29, 0, 7,
+            0, 7, 0, 29, 0, 18, 24, 41, 0, 41, 0, 41,
+            0, 41, 0, 24, 41, 0, 41, 29, 7, 0, 29, 41,
+            0, 41, 0, 7, 24, 0, 24, 0, 41, 0, 7, 0,
+            7, 29, 7, 29, 0, 24, 11, 29, 11, 29, 7, 29,
+            11, 0, 7, 29, 7, 29, 24, 29, 7, 0, 29, 7,
+            0, 11, 24, 0, 29, 24, 29, 11, 29, 0, 29, 0,
+            29, 0, 7, 29, 7, 29, 7, 29, 7, 29, 7, 29,
+            0, 29, 7, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 12, 29,
+            0, 11, 10, 11, 6, 7, 8, 7, 11, 10, 11, 13,
+            28, 29, 22, 21, 22, 21, 22, 28, 29, 19, 11, 1,
+            7, 10, 25, 29, 22, 28, 20, 29, 23, 21, 16, 20,
+            29, 11, 29, 11, 29, 11, 9, 29, 0, 7, 29, 0,
+            28, 29, 21, 16, 28, 29, 28, 29, 21, 16, 0, 29,
+            0, 26, 25, 26, 25, 26, 25, 26, 25, 26, 25, 26,
+            7, 0, 29, 25, 29, 28, 29, 25, 29, 28, 29, 26,
+            29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28,
+            29, 28, 29, 28, 29, 0, 28, 29, 28, 29, 28, 29,
+            28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 26,
+            29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28,
+            29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28,
+            29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28,
+            29, 28, 29, 28, 29, 28, 29, 28, 29, 19, 29, 21,
+            16, 21, 16, 29, 28, 29, 36, 29, 21, 16, 29, 36,
+            29, 0, 29, 0, 28, 29, 28, 29, 28, 29, 28, 29,
+            28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+            28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+            36, 29, 28, 29, 28, 29, 28, 29, 36, 28, 36, 29,
+            36, 31, 36, 29, 36, 29, 28, 29, 28, 29, 28, 29,
+            28, 29, 28, 36, 28, 29, 28, 29, 28, 29, 36, 29,
+            28, 29, 36, 28, 36, 29, 36, 28, 36, 28, 36, 28,
+            36, 28, 36, 29, 28, 29, 28, 36, 28, 36, 28, 36,
+            31, 36, 28, 36, 29, 36, 31, 29, 28, 29, 22, 29,
+            18, 36, 29, 21, 16, 21, 16, 21, 16, 21, 16, 21,
+            16, 21, 16, 21, 16, 28, 29, 21, 16, 29, 21, 16,
+            21, 16, 21, 16, 21, 16, 21, 16, 29, 21, 16, 21,
+            16, 21, 16, 21, 16, 21, 16, 21, 16, 21, 16, 21,
+            16, 21, 16, 21, 16, 21, 16, 29, 21, 16, 21, 16,
+            29, 21, 16, 29, 28, 29, 0, 29, 0, 29, 7, 29,
+            0, 18, 11, 29, 18, 11, 29, 0, 29, 0, 29, 0,
+            29, 0, 29, 11, 0, 7, 29, 0, 29, 0, 29, 0,
+            29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            7, 22, 11, 29, 11, 21, 11, 29, 22, 29, 22, 21,
+            16, 21, 16, 21, 16, 21, 16, 11, 18, 29, 11, 29,
+            11, 29, 13, 11, 29, 11, 21, 11, 29, 11, 29, 11,
+            29, 18, 21, 16, 21, 16, 21, 16, 21, 16, 11, 0,
+            36, 0, 36, 0, 36, 0, 36, 0, 11, 16, 36, 20,
+            36, 21, 16, 21, 16, 21, 16, 21, 16, 21, 16, 36,
+            21, 16, 21, 16, 21, 16, 21, 16, 20, 21, 16, 36,
+            7, 36, 7, 36, 20, 36, 0, 30, 36, 30, 36, 30,
+            36, 30, 36, 30, 36, 30, 36, 30, 36, 30, 36, 30,
+            36, 30, 36, 30, 0, 7, 20, 36, 20, 30, 36, 30,
+            36, 30, 36, 30, 36, 30, 36, 30, 36, 30, 36, 30,
+            36, 30, 36, 30, 36, 30, 36, 20, 30, 20, 36, 0,
+            36, 0, 36, 0, 36, 0, 30, 36, 0, 36, 28, 36,
+            29, 36, 20, 36, 0, 36, 0, 29, 11, 29, 11, 18,
+            11, 29, 24, 29, 0, 29, 7, 29, 7, 29, 7, 29,
+            7, 29, 11, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            29, 7, 29, 7, 29, 7, 29, 7, 29, 7, 0, 29,
+            25, 29, 0, 29, 12, 18, 0, 7, 29, 7, 0, 11,
+            24, 0, 7, 29, 12, 29, 7, 24, 29, 7, 11, 29,
+            7, 0, 29, 37, 0, 7, 29, 7, 29, 11, 29, 0,
+            29, 24, 0, 29, 41, 24, 41, 0, 29, 7, 0, 29,
+            7, 29, 7, 0, 24, 0, 29, 11, 41, 0, 41, 29,
+            7, 11, 29, 7, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 7, 11, 7, 0, 24, 0,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+            33, 34, 33, 34, 33, 34, 0, 38, 0, 39, 0, 42,
+            0, 36, 29, 0, 29, 0, 35, 7, 35, 29, 35, 0,
+            35, 0, 35, 0, 35, 0, 35, 0, 35, 29, 0, 29,
+            16, 21, 29, 0, 29, 0, 29, 0, 29, 25, 29, 7,
+            23, 16, 23, 18, 21, 16, 19, 0, 7, 36, 21, 16,
+            21, 16, 21, 16, 21, 16, 21, 16, 21, 16, 21, 16,
+            21, 16, 36, 21, 16, 36, 16, 36, 16, 0, 20, 18,
+            36, 21, 16, 21, 16, 21, 16, 36, 0, 36, 26, 25,
+            36, 0, 29, 0, 29, 0, 9, 0, 18, 36, 26, 25,
+            36, 21, 16, 36, 16, 36, 16, 36, 20, 36, 18, 36,
+            21, 36, 16, 36, 21, 36, 16, 36, 21, 16, 21, 16,
+            20, 36, 30, 36, 20, 36, 0, 36, 0, 36, 0, 36,
+            0, 36, 0, 25, 26, 36, 26, 0, 29, 0, 7, 15,
+            28, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            29, 0, 29, 0, 11, 0, 29, 0, 29, 0, 29, 0,
+            29, 0, 29, 7, 0, 29, 0, 29, 0, 7, 29, 0,
+            29, 0, 29, 0, 29, 7, 0, 29, 0, 11, 29, 0,
+            29, 11, 29, 0, 29, 0, 24, 0, 29, 0, 29, 0,
+            29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            29, 0, 29, 0, 29, 0, 29, 0, 11, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 11, 29, 0, 29, 0,
+            29, 0, 29, 0, 29, 7, 0, 7, 0, 7, 29, 0,
+            29, 0, 29, 0, 7, 0, 7, 29, 0, 11, 29, 0,
+            29, 0, 29, 7, 0, 29, 11, 19, 0, 29, 0, 11,
+            29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            29, 0, 29, 0, 29, 7, 0, 24, 0, 29, 0, 29,
+            0, 7, 11, 0, 29, 0, 29, 0, 29, 7, 29, 0,
+            29, 7, 29, 0, 29, 0, 29, 0, 7, 29, 7, 11,
+            29, 0, 29, 24, 7, 29, 7, 29, 0, 7, 29, 7,
+            29, 11, 7, 0, 29, 0, 29, 0, 24, 0, 7, 29,
+            7, 0, 24, 11, 29, 7, 29, 0, 29, 7, 29, 12,
+            29, 0, 7, 29, 7, 29, 11, 29, 11, 7, 29, 7,
+            24, 29, 12, 29, 11, 0, 29, 0, 29, 0, 29, 7,
+            11, 29, 11, 29, 7, 0, 29, 0, 29, 0, 29, 0,
+            29, 0, 29, 11, 0, 29, 7, 0, 24, 0, 7, 0,
+            29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            7, 29, 7, 0, 7, 0, 7, 0, 29, 0, 7, 0,
+            29, 7, 0, 7, 0, 7, 0, 29, 7, 29, 11, 29,
+            24, 11, 0, 29, 7, 29, 0, 29, 7, 29, 0, 24,
+            0, 29, 7, 0, 7, 12, 11, 18, 29, 11, 29, 7,
+            0, 29, 7, 11, 29, 0, 24, 0, 12, 0, 29, 7,
+            29, 0, 24, 0, 41, 0, 41, 0, 24, 41, 11, 41,
+            0, 29, 7, 29, 0, 29, 24, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 7, 0, 7, 0, 7, 29,
+            7, 29, 7, 11, 0, 24, 0, 29, 0, 29, 7, 0,
+            7, 29, 12, 29, 7, 0, 29, 7, 29, 7, 29, 7,
+            12, 29, 11, 12, 29, 7, 0, 29, 7, 29, 7, 11,
+            29, 12, 11, 0, 29, 0, 29, 0, 29, 7, 0, 7,
+            29, 11, 0, 24, 29, 0, 12, 18, 29, 0, 7, 0,
+            7, 0, 29, 0, 29, 0, 29, 7, 0, 7, 0, 7,
+            0, 7, 29, 7, 0, 24, 0, 29, 0, 29, 0, 29,
+            7, 0, 7, 0, 7, 29, 0, 24, 0, 29, 7, 29,
+            0, 29, 0, 29, 25, 29, 0, 11, 29, 0, 29, 0,
+            11, 0, 29, 0, 29, 0, 29, 21, 16, 29, 16, 29,
+            21, 16, 21, 16, 29, 21, 16, 29, 0, 10, 21, 16,
+            0, 29, 21, 16, 29, 0, 29, 0, 29, 0, 24, 0,
+            11, 29, 0, 24, 0, 29, 0, 7, 11, 0, 29, 7,
+            11, 29, 11, 29, 0, 24, 0, 29, 0, 29, 0, 29,
+            0, 29, 11, 29, 0, 29, 0, 7, 29, 7, 0, 7,
+            29, 0, 20, 10, 0, 7, 0, 36, 0, 36, 29, 0,
+            36, 0, 29, 0, 29, 0, 29, 0, 36, 0, 30, 0,
+            30, 0, 36, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            29, 7, 11, 7, 0, 7, 0, 7, 0, 29, 0, 29,
+            0, 29, 0, 29, 7, 29, 7, 29, 7, 29, 7, 29,
+            0, 29, 7, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 24, 29, 7, 29, 7, 29, 7, 29, 7,
+            29, 11, 29, 0, 7, 0, 7, 0, 29, 0, 7, 0,
+            7, 0, 7, 0, 7, 0, 7, 0, 29, 0, 7, 29,
+            0, 24, 0, 29, 0, 29, 7, 0, 29, 7, 24, 0,
+            26, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0,
+            29, 7, 0, 29, 7, 29, 0, 24, 0, 21, 0, 29,
+            25, 29, 25, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 29, 0, 29, 0, 29, 0, 29, 0, 29,
+            0, 29, 0, 36, 28, 36, 28, 29, 28, 29, 36, 28,
+            36, 40, 36, 31, 36, 29, 36, 29, 36, 29, 36, 31,
+            36, 31, 36, 31, 36, 32, 36, 31, 36, 31, 36, 31,
+            36, 31, 36, 31, 36, 31, 36, 31, 36, 31, 36, 29,
+            36, 29, 36, 29, 36, 31, 36, 29, 36, 29, 36, 29,
+            36, 29, 36, 29, 36, 31, 36, 31, 36, 31, 36, 31,
+            36, 29, 36, 29, 36, 31, 36, 31, 29, 22, 20, 29,
+            36, 31, 36, 31, 36, 31, 36, 31, 36, 29, 36, 29,
+            36, 29, 36, 29, 36, 29, 36, 29, 36, 29, 36, 29,
+            31, 36, 31, 36, 31, 36, 31, 36, 31, 36, 31, 36,
+            31, 36, 31, 36, 31, 36, 31, 36, 31, 36, 31, 36,
+            29, 36, 31, 36, 31, 36, 29, 0, 29, 0, 24, 0,
+            36, 0, 36, 0, 36, 0, 7, 0, 7, 0, 7, 0
+        };
+
+        // Grapheme_Cluster_Break
+        const std::uint32_t _s_grapheme_cluster_break_starts[] = {
+            0x0000, 0x000A, 0x000B, 0x000D, 0x000E, 0x0020, 0x007F, 0x00A0, 0x00A9, 0x00AA, 0x00AD, 0x00AE,
+            0x00AF, 0x0300, 0x0370, 0x0483, 0x048A, 0x0591, 0x05BE, 0x05BF, 0x05C0, 0x05C1, 0x05C3, 0x05C4,
+            0x05C6, 0x05C7, 0x05C8, 0x0600, 0x0606, 0x0610, 0x061B, 0x061C, 0x061D, 0x064B, 0x0660, 0x0670,
+            0x0671, 0x06D6, 0x06DD, 0x06DE, 0x06DF, 0x06E5, 0x06E7, 0x06E9, 0x06EA, 0x06EE, 0x070F, 0x0710,
+            0x0711, 0x0712, 0x0730, 0x074B, 0x07A6, 0x07B1, 0x07EB, 0x07F4, 0x07FD, 0x07FE, 0x0816, 0x081A,
+            0x081B, 0x0824, 0x0825, 0x0828, 0x0829, 0x082E, 0x0859, 0x085C, 0x0890, 0x0892, 0x0898, 0x08A0,
+            0x08CA, 0x08E2, 0x08E3, 0x0903, 0x0904, 0x093A, 0x093B, 0x093C, 0x093D, 0x093E, 0x0941, 0x0949,
+            0x094D, 0x094E, 0x0950, 0x0951, 0x0958, 0x0962, 0x0964, 0x0981, 0x0982, 0x0984, 0x09BC, 0x09BD,
+            0x09BE, 0x09BF, 0x09C1, 0x09C5, 0x09C7, 0x09C9, 0x09CB, 0x09CD, 0x09CE, 0x09D7, 0x09D8, 0x09E2,
+            0x09E4, 0x09FE, 0x09FF, 0x0A01, 0x0A03, 0x0A04, 0x0A3C, 0x0A3D, 0x0A3E, 0x0A41, 0x0A43, 0x0A47,
+            0x0A49, 0x0A4B, 0x0A4E, 0x0A51, 0x0A52, 0x0A70, 0x0A72, 0x0A75, 0x0A76, 0x0A81, 0x0A83, 0x0A84,
+            0x0ABC, 0x0ABD, 0x0ABE, 0x0AC1, 0x0AC6, 0x0AC7, 0x0AC9, 0x0ACA, 0x0ACB, 0x0ACD, 0x0ACE, 0x0AE2,
+            0x0AE4, 0x0AFA, 0x0B00, 0x0B01, 0x0B02, 0x0B04, 0x0B3C, 0x0B3D, 0x0B3E, 0x0B40, 0x0B41, 0x0B45,
+            0x0B47, 0x0B49, 0x0B4B, 0x0B4D, 0x0B4E, 0x0B55, 0x0B58, 0x0B62, 0x0B64, 0x0B82, 0x0B83, 0x0BBE,
+            0x0BBF, 0x0BC0, 0x0BC1, 0x0BC3, 0x0BC6, 0x0BC9, 0x0BCA, 0x0BCD, 0x0BCE, 0x0BD7, 0x0BD8, 0x0C00,
+            0x0C01, 0x0C04, 0x0C05, 0x0C3C, 0x0C3D, 0x0C3E, 0x0C41, 0x0C45, 0x0C46, 0x0C49, 0x0C4A, 0x0C4E,
+            0x0C55, 0x0C57, 0x0C62, 0x0C64, 0x0C81, 0x0C82, 0x0C84, 0x0CBC, 0x0CBD, 0x0CBE, 0x0CBF, 0x0CC0,
+            0x0CC2, 0x0CC3, 0x0CC5, 0x0CC6, 0x0CC7, 0x0CC9, 0x0CCA, 0x0CCC, 0x0CCE, 0x0CD5, 0x0CD7, 0x0CE2,
+            0x0CE4, 0x0D00, 0x0D02, 0x0D04, 0x0D3B, 0x0D3D, 0x0D3E, 0x0D3F, 0x0D41, 0x0D45, 0x0D46, 0x0D49,
+            0x0D4A, 0x0D4D, 0x0D4E, 0x0D4F, 0x0D57, 0x0D58, 0x0D62, 0x0D64, 0x0D81, 0x0D82, 0x0D84, 0x0DCA,
+            0x0DCB, 0x0DCF, 0x0DD0, 0x0DD2, 0x0DD5, 0x0DD6, 0x0DD7, 0x0DD8, 0x0DDF, 0x0DE0, 0x0DF2, 0x0DF4,
+            0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E3B, 0x0E47, 0x0E4F, 0x0EB1, 0x0EB2, 0x0EB3, 0x0EB4, 0x0EBD,
+            0x0EC8, 0x0ECE, 0x0F18, 0x0F1A, 0x0F35, 0x0F36, 0x0F37, 0x0F38, 0x0F39, 0x0F3A, 0x0F3E, 0x0F40,
+            0x0F71, 0x0F7F, 0x0F80, 0x0F85, 0x0F86, 0x0F88, 0x0F8D, 0x0F98, 0x0F99, 0x0FBD, 0x0FC6, 0x0FC7,
+            0x102D, 0x1031, 0x1032, 0x1038, 0x1039, 0x103B, 0x103D, 0x103F, 0x1056, 0x1058, 0x105A, 0x105E,
+            0x1061, 0x1071, 0x1075, 0x1082, 0x1083, 0x1084, 0x1085, 0x1087, 0x108D, 0x108E, 0x109D, 0x109E,
+            0x1100, 0x1160, 0x11A8, 0x1200, 0x135D, 0x1360, 0x1712, 0x1715, 0x1716, 0x1732, 0x1734, 0x1735,
+            0x1752, 0x1754, 0x1772, 0x1774, 0x17B4, 0x17B6, 0x17B7, 0x17BE, 0x17C6, 0x17C7, 0x17C9, 0x17D4,
+            0x17DD, 0x17DE, 0x180B, 0x180E, 0x180F, 0x1810, 0x1885, 0x1887, 0x18A9, 0x18AA, 0x1920, 0x1923,
+            0x1927, 0x1929, 0x192C, 0x1930, 0x1932, 0x1933, 0x1939, 0x193C, 0x1A17, 0x1A19, 0x1A1B, 0x1A1C,
+            0x1A55, 0x1A56, 0x1A57, 0x1A58, 0x1A5F, 0x1A60, 0x1A61, 0x1A62, 0x1A63, 0x1A65, 0x1A6D, 0x1A73,
+            0x1A7D, 0x1A7F, 0x1A80, 0x1AB0, 0x1ACF, 0x1B00, 0x1B04, 0x1B05, 0x1B34, 0x1B3B, 0x1B3C, 0x1B3D,
+            0x1B42, 0x1B43, 0x1B45, 0x1B6B, 0x1B74, 0x1B80, 0x1B82, 0x1B83, 0x1BA1, 0x1BA2, 0x1BA6, 0x1BA8,
+            0x1BAA, 0x1BAB, 0x1BAE, 0x1BE6, 0x1BE7, 0x1BE8, 0x1BEA, 0x1BED, 0x1BEE, 0x1BEF, 0x1BF2, 0x1BF4,
+            0x1C24, 0x1C2C, 0x1C34, 0x1C36, 0x1C38, 0x1CD0, 0x1CD3, 0x1CD4, 0x1CE1, 0x1CE2, 0x1CE9, 0x1CED,
+            0x1CEE, 0x1CF4, 0x1CF5, 0x1CF7, 0x1CF8, 0x1CFA, 0x1DC0, 0x1E00, 0x200B, 0x200C, 0x200D, 0x200E,
+            0x2010, 0x2028, 0x202F, 0x203C, 0x203D, 0x2049, 0x204A, 0x2060, 0x2070, 0x20D0, 0x20F1, 0x2122,
+            0x2123, 0x2139, 0x213A, 0x2194, 0x219A, 0x21A9, 0x21AB, 0x231A, 0x231C, 0x2328, 0x2329, 0x2388,
+            0x2389, 0x23CF, 0x23D0, 0x23E9, 0x23F4, 0x23F8, 0x23FB, 0x24C2, 0x24C3, 0x25AA, 0x25AC, 0x25B6,
+            0x25B7, 0x25C0, 0x25C1, 0x25FB, 0x25FF, 0x2600, 0x2606, 0x2607, 0x2613, 0x2614, 0x2686, 0x2690,
+            0x2706, 0x2708, 0x2713, 0x2714, 0x2715, 0x2716, 0x2717, 0x271D, 0x271E, 0x2721, 0x2722, 0x2728,
+            0x2729, 0x2733, 0x2735, 0x2744, 0x2745, 0x2747, 0x2748, 0x274C, 0x274D, 0x274E, 0x274F, 0x2753,
+            0x2756, 0x2757, 0x2758, 0x2763, 0x2768, 0x2795, 0x2798, 0x27A1, 0x27A2, 0x27B0, 0x27B1, 0x27BF,
+            0x27C0, 0x2934, 0x2936, 0x2B05, 0x2B08, 0x2B1B, 0x2B1D, 0x2B50, 0x2B51, 0x2B55, 0x2B56, 0x2CEF,
+            0x2CF2, 0x2D7F, 0x2D80, 0x2DE0, 0x2E00, 0x302A, 0x3030, 0x3031, 0x303D, 0x303E, 0x3099, 0x309B,
+            0x3297, 0x3298, 0x3299, 0x329A, 0xA66F, 0xA673, 0xA674, 0xA67E, 0xA69E, 0xA6A0, 0xA6F0, 0xA6F2,
+            0xA802, 0xA803, 0xA806, 0xA807, 0xA80B, 0xA80C, 0xA823, 0xA825, 0xA827, 0xA828, 0xA82C, 0xA82D,
+            0xA880, 0xA882, 0xA8B4, 0xA8C4, 0xA8C6, 0xA8E0, 0xA8F2, 0xA8FF, 0xA900, 0xA926, 0xA92E, 0xA947,
+            0xA952, 0xA954, 0xA960, 0xA97D, 0xA980, 0xA983, 0xA984, 0xA9B3, 0xA9B4, 0xA9B6, 0xA9BA, 0xA9BC,
+            0xA9BE, 0xA9C1, 0xA9E5, 0xA9E6, 0xAA29, 0xAA2F, 0xAA31, 0xAA33, 0xAA35, 0xAA37, 0xAA43, 0xAA44,
+            0xAA4C, 0xAA4D, 0xAA4E, 0xAA7C, 0xAA7D, 0xAAB0, 0xAAB1, 0xAAB2, 0xAAB5, 0xAAB7, 0xAAB9, 0xAABE,
+            0xAAC0, 0xAAC1, 0xAAC2, 0xAAEB, 0xAAEC, 0xAAEE, 0xAAF0, 0xAAF5, 0xAAF6, 0xAAF7, 0xABE3, 0xABE5,
+            0xABE6, 0xABE8, 0xABE9, 0xABEB, 0xABEC, 0xABED, 0xABEE, 0xAC00, 0xAC01, 0xAC1C, 0xAC1D, 0xAC38,
+            0xAC39, 0xAC54, 0xAC55, 0xAC70, 0xAC71, 0xAC8C, 0xAC8D, 0xACA8, 0xACA9, 0xACC4, 0xACC5, 0xACE0,
+            0xACE1, 0xACFC, 0xACFD, 0xAD18, 0xAD19, 0xAD34, 0xAD35, 0xAD50, 0xAD51, 0xAD6C, 0xAD6D, 0xAD88,
+            0xAD89, 0xADA4, 0xADA5, 0xADC0, 0xADC1, 0xADDC, 0xADDD, 0xADF8, 0xADF9, 0xAE14, 0xAE15, 0xAE30,
+            0xAE31, 0xAE4C, 0xAE4D, 0xAE68, 0xAE69, 0xAE84, 0xAE85, 0xAEA0, 0xAEA1, 0xAEBC, 0xAEBD, 0xAED8,
+            0xAED9, 0xAEF4, 0xAEF5, 0xAF10, 0xAF11, 0xAF2C, 0xAF2D, 0xAF48, 0xAF49, 0xAF64, 0xAF65, 0xAF80,
+            0xAF81, 0xAF9C, 0xAF9D, 0xAFB8, 0xAFB9, 0xAFD4, 0xAFD5, 0xAFF0, 0xAFF1, 0xB00C, 0xB00D, 0xB028,
+            0xB029, 0xB044, 0xB045, 0xB060, 0xB061, 0xB07C, 0xB07D, 0xB098, 0xB099, 0xB0B4, 0xB0B5, 0xB0D0,
+            0xB0D1, 0xB0EC, 0xB0ED, 0xB108, 0xB109, 0xB124, 0xB125, 0xB140, 0xB141, 0xB15C, 0xB15D, 0xB178,
+            0xB179, 0xB194, 0xB195, 0xB1B0, 0xB1B1, 0xB1CC, 0xB1CD, 0xB1E8, 0xB1E9, 0xB204, 0xB205, 0xB220,
+            0xB221, 0xB23C, 0xB23D, 0xB258, 0xB259, 0xB274, 0xB275, 0xB290, 0xB291, 0xB2AC, 0xB2AD, 0xB2C8,
+            0xB2C9, 0xB2E4, 0xB2E5, 0xB300, 0xB301, 0xB31C, 0xB31D, 0xB338, 0xB339, 0xB354, 0xB355, 0xB370,
+            0xB371, 0xB38C, 0xB38D, 0xB3A8, 0xB3A9, 0xB3C4, 0xB3C5, 0xB3E0, 0xB3E1, 0xB3FC, 0xB3FD, 0xB418,
+            0xB419, 0xB434, 0xB435, 0xB450, 0xB451, 0xB46C, 0xB46D, 0xB488, 0xB489, 0xB4A4, 0xB4A5, 0xB4C0,
+            0xB4C1, 0xB4DC, 0xB4DD, 0xB4F8, 0xB4F9, 0xB514, 0xB515, 0xB530, 0xB531, 0xB54C, 0xB54D, 0xB568,
+            0xB569, 0xB584, 0xB585, 0xB5A0, 0xB5A1, 0xB5BC, 0xB5BD, 0xB5D8, 0xB5D9, 0xB5F4, 0xB5F5, 0xB610,
+            0xB611, 0xB62C, 0xB62D, 0xB648, 0xB649, 0xB664, 0xB665, 0xB680, 0xB681, 0xB69C, 0xB69D, 0xB6B8,
+            0xB6B9, 0xB6D4, 0xB6D5, 0xB6F0, 0xB6F1, 0xB70C, 0xB70D, 0xB728, 0xB729, 0xB744, 0xB745, 0xB760,
+            0xB761, 0xB77C, 0xB77D, 0xB798, 0xB799, 0xB7B4, 0xB7B5, 0xB7D0, 0xB7D1, 0xB7EC, 0xB7ED, 0xB808,
+            0xB809, 0xB824, 0xB825, 0xB840, 0xB841, 0xB85C, 0xB85D, 0xB878, 0xB879, 0xB894, 0xB895, 0xB8B0,
+            0xB8B1, 0xB8CC, 0xB8CD, 0xB8E8, 0xB8E9, 0xB904, 0xB905, 0xB920, 0xB921, 0xB93C, 0xB93D, 0xB958,
+            0xB959, 0xB974, 0xB975, 0xB990, 0xB991, 0xB9AC, 0xB9AD, 0xB9C8, 0xB9C9, 0xB9E4, 0xB9E5, 0xBA00,
+            0xBA01, 0xBA1C, 0xBA1D, 0xBA38, 0xBA39, 0xBA54, 0xBA55, 0xBA70, 0xBA71, 0xBA8C, 0xBA8D, 0xBAA8,
+            0xBAA9, 0xBAC4, 0xBAC5, 0xBAE0, 0xBAE1, 0xBAFC, 0xBAFD, 0xBB18, 0xBB19, 0xBB34, 0xBB35, 0xBB50,
+            0xBB51, 0xBB6C, 0xBB6D, 0xBB88, 0xBB89, 0xBBA4, 0xBBA5, 0xBBC0, 0xBBC1, 0xBBDC, 0xBBDD, 0xBBF8,
+            0xBBF9, 0xBC14, 0xBC15, 0xBC30, 0xBC31, 0xBC4C, 0xBC4D, 0xBC68, 0xBC69, 0xBC84, 0xBC85, 0xBCA0,
+            0xBCA1, 0xBCBC, 0xBCBD, 0xBCD8, 0xBCD9, 0xBCF4, 0xBCF5, 0xBD10, 0xBD11, 0xBD2C, 0xBD2D, 0xBD48,
+            0xBD49, 0xBD64, 0xBD65, 0xBD80, 0xBD81, 0xBD9C, 0xBD9D, 0xBDB8, 0xBDB9, 0xBDD4, 0xBDD5, 0xBDF0,
+            0xBDF1, 0xBE0C, 0xBE0D, 0xBE28, 0xBE29, 0xBE44, 0xBE45, 0xBE60, 0xBE61, 0xBE7C, 0xBE7D, 0xBE98,
+            0xBE99, 0xBEB4, 0xBEB5, 0xBED0, 0xBED1, 0xBEEC, 0xBEED, 0xBF08, 0xBF09, 0xBF24, 0xBF25, 0xBF40,
+            0xBF41, 0xBF5C, 0xBF5D, 0xBF78, 0xBF79, 0xBF94, 0xBF95, 0xBFB0, 0xBFB1, 0xBFCC, 0xBFCD, 0xBFE8,
+            0xBFE9, 0xC004, 0xC005, 0xC020, 0xC021, 0xC03C, 0xC03D, 0xC058, 0xC059, 0xC074, 0xC075, 0xC090,
+            0xC091, 0xC0AC, 0xC0AD, 0xC0C8, 0xC0C9, 0xC0E4, 0xC0E5, 0xC100, 0xC101, 0xC11C, 0xC11D, 0xC138,
+            0xC139, 0xC154, 0xC155, 0xC170, 0xC171, 0xC18C, 0xC18D, 0xC1A8, 0xC1A9, 0xC1C4, 0xC1C5, 0xC1E0,
+            0xC1E1, 0xC1FC, 0xC1FD, 0xC218, 0xC219, 0xC234, 0xC235, 0xC250, 0xC251, 0xC26C, 0xC26D, 0xC288,
+            0xC289, 0xC2A4, 0xC2A5, 0xC2C0, 0xC2C1, 0xC2DC, 0xC2DD, 0xC2F8, 0xC2F9, 0xC314, 0xC315, 0xC330,
+            0xC331, 0xC34C, 0xC34D, 0xC368, 0xC369, 0xC384, 0xC385, 0xC3A0, 0xC3A1, 0xC3BC, 0xC3BD, 0xC3D8,
+            0xC3D9, 0xC3F4, 0xC3F5, 0xC410, 0xC411, 0xC42C, 0xC42D, 0xC448, 0xC449, 0xC464, 0xC465, 0xC480,
+            0xC481, 0xC49C, 0xC49D, 0xC4B8, 0xC4B9, 0xC4D4, 0xC4D5, 0xC4F0, 0xC4F1, 0xC50C, 0xC50D, 0xC528,
+            0xC529, 0xC544, 0xC545, 0xC560, 0xC561, 0xC57C, 0xC57D, 0xC598, 0xC599, 0xC5B4, 0xC5B5, 0xC5D0,
+            0xC5D1, 0xC5EC, 0xC5ED, 0xC608, 0xC609, 0xC624, 0xC625, 0xC640, 0xC641, 0xC65C, 0xC65D, 0xC678,
+            0xC679, 0xC694, 0xC695, 0xC6B0, 0xC6B1, 0xC6CC, 0xC6CD, 0xC6E8, 0xC6E9, 0xC704, 0xC705, 0xC720,
+            0xC721, 0xC73C, 0xC73D, 0xC758, 0xC759, 0xC774, 0xC775, 0xC790, 0xC791, 0xC7AC, 0xC7AD, 0xC7C8,
+            0xC7C9, 0xC7E4, 0xC7E5, 0xC800, 0xC801, 0xC81C, 0xC81D, 0xC838, 0xC839, 0xC854, 0xC855, 0xC870,
+            0xC871, 0xC88C, 0xC88D, 0xC8A8, 0xC8A9, 0xC8C4, 0xC8C5, 0xC8E0, 0xC8E1, 0xC8FC, 0xC8FD, 0xC918,
+            0xC919, 0xC934, 0xC935, 0xC950, 0xC951, 0xC96C, 0xC96D, 0xC988, 0xC989, 0xC9A4, 0xC9A5, 0xC9C0,
+            0xC9C1, 0xC9DC, 0xC9DD, 0xC9F8, 0xC9F9, 0xCA14, 0xCA15, 0xCA30, 0xCA31, 0xCA4C, 0xCA4D, 0xCA68,
+            0xCA69, 0xCA84, 0xCA85, 0xCAA0, 0xCAA1, 0xCABC, 0xCABD, 0xCAD8, 0xCAD9, 0xCAF4, 0xCAF5, 0xCB10,
+            0xCB11, 0xCB2C, 0xCB2D, 0xCB48, 0xCB49, 0xCB64, 0xCB65, 0xCB80, 0xCB81, 0xCB9C, 0xCB9D, 0xCBB8,
+            0xCBB9, 0xCBD4, 0xCBD5, 0xCBF0, 0xCBF1, 0xCC0C, 0xCC0D, 0xCC28, 0xCC29, 0xCC44, 0xCC45, 0xCC60,
+            0xCC61, 0xCC7C, 0xCC7D, 0xCC98, 0xCC99, 0xCCB4, 0xCCB5, 0xCCD0, 0xCCD1, 0xCCEC, 0xCCED, 0xCD08,
+            0xCD09, 0xCD24, 0xCD25, 0xCD40, 0xCD41, 0xCD5C, 0xCD5D, 0xCD78, 0xCD79, 0xCD94, 0xCD95, 0xCDB0,
+            0xCDB1, 0xCDCC, 0xCDCD, 0xCDE8, 0xCDE9, 0xCE04, 0xCE05, 0xCE20, 0xCE21, 0xCE3C, 0xCE3D, 0xCE58,
+            0xCE59, 0xCE74, 0xCE75, 0xCE90, 0xCE91, 0xCEAC, 0xCEAD, 0xCEC8, 0xCEC9, 0xCEE4, 0xCEE5, 0xCF00,
+            0xCF01, 0xCF1C, 0xCF1D, 0xCF38, 0xCF39, 0xCF54, 0xCF55, 0xCF70, 0xCF71, 0xCF8C, 0xCF8D, 0xCFA8,
+            0xCFA9, 0xCFC4, 0xCFC5, 0xCFE0, 0xCFE1, 0xCFFC, 0xCFFD, 0xD018, 0xD019, 0xD034, 0xD035, 0xD050,
+            0xD051, 0xD06C, 0xD06D, 0xD088, 0xD089, 0xD0A4, 0xD0A5, 0xD0C0, 0xD0C1, 0xD0DC, 0xD0DD, 0xD0F8,
+            0xD0F9, 0xD114, 0xD115, 0xD130, 0xD131, 0xD14C, 0xD14D, 0xD168, 0xD169, 0xD184, 0xD185, 0xD1A0,
+            0xD1A1, 0xD1BC, 0xD1BD, 0xD1D8, 0xD1D9, 0xD1F4, 0xD1F5, 0xD210, 0xD211, 0xD22C, 0xD22D, 0xD248,
+            0xD249, 0xD264, 0xD265, 0xD280, 0xD281, 0xD29C, 0xD29D, 0xD2B8, 0xD2B9, 0xD2D4, 0xD2D5, 0xD2F0,
+            0xD2F1, 0xD30C, 0xD30D, 0xD328, 0xD329, 0xD344, 0xD345, 0xD360, 0xD361, 0xD37C, 0xD37D, 0xD398,
+            0xD399, 0xD3B4, 0xD3B5, 0xD3D0, 0xD3D1, 0xD3EC, 0xD3ED, 0xD408, 0xD409, 0xD424, 0xD425, 0xD440,
+            0xD441, 0xD45C, 0xD45D, 0xD478, 0xD479, 0xD494, 0xD495, 0xD4B0, 0xD4B1, 0xD4CC, 0xD4CD, 0xD4E8,
+            0xD4E9, 0xD504, 0xD505, 0xD520, 0xD521, 0xD53C, 0xD53D, 0xD558, 0xD559, 0xD574, 0xD575, 0xD590,
+            0xD591, 0xD5AC, 0xD5AD, 0xD5C8, 0xD5C9, 0xD5E4, 0xD5E5, 0xD600, 0xD601, 0xD61C, 0xD61D, 0xD638,
+            0xD639, 0xD654, 0xD655, 0xD670, 0xD671, 0xD68C, 0xD68D, 0xD6A8, 0xD6A9, 0xD6C4, 0xD6C5, 0xD6E0,
+            0xD6E1, 0xD6FC, 0xD6FD, 0xD718, 0xD719, 0xD734, 0xD735, 0xD750, 0xD751, 0xD76C, 0xD76D, 0xD788,
+            0xD789, 0xD7A4, 0xD7B0, 0xD7C7, 0xD7CB, 0xD7FC, 0xFB1E, 0xFB1F, 0xFE00, 0xFE10, 0xFE20, 0xFE30,
+            0xFEFF, 0xFF00, 0xFF9E, 0xFFA0, 0xFFF0, 0xFFFC, 0x101FD, 0x101FE, 0x102E0, 0x102E1, 0x10376, 0x1037B,
+            0x10A01, 0x10A04, 0x10A05, 0x10A07, 0x10A0C, 0x10A10, 0x10A38, 0x10A3B, 0x10A3F, 0x10A40, 0x10AE5, 0x10AE7,
+            0x10D24, 0x10D28, 0x10EAB, 0x10EAD, 0x10F46, 0x10F51, 0x10F82, 0x10F86, 0x11000, 0x11001, 0x11002, 0x11003,
+            0x11038, 0x11047, 0x11070, 0x11071, 0x11073, 0x11075, 0x1107F, 0x11082, 0x11083, 0x110B0, 0x110B3, 0x110B7,
+            0x110B9, 0x110BB, 0x110BD, 0x110BE, 0x110C2, 0x110C3, 0x110CD, 0x110CE, 0x11100, 0x11103, 0x11127, 0x1112C,
+            0x1112D, 0x11135, 0x11145, 0x11147, 0x11173, 0x11174, 0x11180, 0x11182, 0x11183, 0x111B3, 0x111B6, 0x111BF,
+            0x111C1, 0x111C2, 0x111C4, 0x111C9, 0x111CD, 0x111CE, 0x111CF, 0x111D0, 0x1122C, 0x1122F, 0x11232, 0x11234,
+            0x11235, 0x11236, 0x11238, 0x1123E, 0x1123F, 0x112DF, 0x112E0, 0x112E3, 0x112EB, 0x11300, 0x11302, 0x11304,
+            0x1133B, 0x1133D, 0x1133E, 0x1133F, 0x11340, 0x11341, 0x11345, 0x11347, 0x11349, 0x1134B, 0x1134E, 0x11357,
+            0x11358, 0x11362, 0x11364, 0x11366, 0x1136D, 0x11370, 0x11375, 0x11435, 0x11438, 0x11440, 0x11442, 0x11445,
+            0x11446, 0x11447, 0x1145E, 0x1145F, 0x114B0, 0x114B1, 0x114B3, 0x114B9, 0x114BA, 0x114BB, 0x114BD, 0x114BE,
+            0x114BF, 0x114C1, 0x114C2, 0x114C4, 0x115AF, 0x115B0, 0x115B2, 0x115B6, 0x115B8, 0x115BC, 0x115BE, 0x115BF,
+            0x115C1, 0x115DC, 0x115DE, 0x11630, 0x11633, 0x1163B, 0x1163D, 0x1163E, 0x1163F, 0x11641, 0x116AB, 0x116AC,
+            0x116AD, 0x116AE, 0x116B0, 0x116B6, 0x116B7, 0x116B8, 0x1171D, 0x11720, 0x11722, 0x11726, 0x11727, 0x1172C,
+            0x1182C, 0x1182F, 0x11838, 0x11839, 0x1183B, 0x11930, 0x11931, 0x11936, 0x11937, 0x11939, 0x1193B, 0x1193D,
+            0x1193E, 0x1193F, 0x11940, 0x11941, 0x11942, 0x11943, 0x11944, 0x119D1, 0x119D4, 0x119D8, 0x119DA, 0x119DC,
+            0x119E0, 0x119E1, 0x119E4, 0x119E5, 0x11A01, 0x11A0B, 0x11A33, 0x11A39, 0x11A3A, 0x11A3B, 0x11A3F, 0x11A47,
+            0x11A48, 0x11A51, 0x11A57, 0x11A59, 0x11A5C, 0x11A84, 0x11A8A, 0x11A97, 0x11A98, 0x11A9A, 0x11C2F, 0x11C30,
+            0x11C37, 0x11C38, 0x11C3E, 0x11C3F, 0x11C40, 0x11C92, 0x11CA8, 0x11CA9, 0x11CAA, 0x11CB1, 0x11CB2, 0x11CB4,
+            0x11CB5, 0x11CB7, 0x11D31, 0x11D37, 0x11D3A, 0x11D3B, 0x11D3C, 0x11D3E, 0x11D3F, 0x11D46, 0x11D47, 0x11D48,
+            0x11D8A, 0x11D8F, 0x11D90, 0x11D92, 0x11D93, 0x11D95, 0x11D96, 0x11D97, 0x11D98, 0x11EF3, 0x11EF5, 0x11EF7,
+            0x13430, 0x13439, 0x16AF0, 0x16AF5, 0x16B30, 0x16B37, 0x16F4F, 0x16F50, 0x16F51, 0x16F88, 0x16F8F, 0x16F93,
+            0x16FE4, 0x16FE5, 0x16FF0, 0x16FF2, 0x1BC9D, 0x1BC9F, 0x1BCA0, 0x1BCA4, 0x1CF00, 0x1CF2E, 0x1CF30, 0x1CF47,
+            0x1D165, 0x1D166, 0x1D167, 0x1D16A, 0x1D16D, 0x1D16E, 0x1D173, 0x1D17B, 0x1D183, 0x1D185, 0x1D18C, 0x1D1AA,
+            0x1D1AE, 0x1D242, 0x1D245, 0x1DA00, 0x1DA37, 0x1DA3B, 0x1DA6D, 0x1DA75, 0x1DA76, 0x1DA84, 0x1DA85, 0x1DA9B,
+            0x1DAA0, 0x1DAA1, 0x1DAB0, 0x1E000, 0x1E007, 0x1E008, 0x1E019, 0x1E01B, 0x1E022, 0x1E023, 0x1E025, 0x1E026,
+            0x1E02B, 0x1E130, 0x1E137, 0x1E2AE, 0x1E2AF, 0x1E2EC, 0x1E2F0, 0x1E8D0, 0x1E8D7, 0x1E944, 0x1E94B, 0x1F000,
+            0x1F100, 0x1F10D, 0x1F110, 0x1F12F, 0x1F130, 0x1F16C, 0x1F172, 0x1F17E, 0x1F180, 0x1F18E, 0x1F18F, 0x1F191,
+            0x1F19B, 0x1F1AD, 0x1F1E6, 0x1F200, 0x1F201, 0x1F210, 0x1F21A, 0x1F21B, 0x1F22F, 0x1F230, 0x1F232, 0x1F23B,
+            0x1F23C, 0x1F240, 0x1F249, 0x1F3FB, 0x1F400, 0x1F53E, 0x1F546, 0x1F650, 0x1F680, 0x1F700, 0x1F774, 0x1F780,
+            0x1F7D5, 0x1F800, 0x1F80C, 0x1F810, 0x1F848, 0x1F850, 0x1F85A, 0x1F860, 0x1F888, 0x1F890, 0x1F8AE, 0x1F900,
+            0x1F90C, 0x1F93B, 0x1F93C, 0x1F946, 0x1F947, 0x1FB00, 0x1FC00, 0x1FFFE, 0xE0000, 0xE0020, 0xE0080, 0xE0100,
+            0xE01F0, 0xE1000
+        };
+
+        const std::uint8_t _s_grapheme_cluster_break_values[] = {
+            3, 2, 3, 1, 3, 0, 3, 0, 14, 0, 3, 14,
+            0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+            0, 4, 0, 7, 0, 4, 0, 3, 0, 4, 0, 4,
+            0, 4, 7, 0, 4, 0, 4, 0, 4, 0, 7, 0,
+            4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+            4, 0, 4, 0, 4, 0, 4, 0, 7, 0, 4, 0,
+            4, 7, 4, 8, 0, 4, 8, 4, 0, 8, 4, 8,
+            4, 8, 0, 4, 0, 4, 0, 4, 8, 0, 4, 0,
+            4, 8, 4, 0, 8, 0, 8, 4, 0, 4, 0, 4,
+            0, 4, 0, 4, 8, 0, 4, 0, 8, 4, 0, 4,
+            0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 8, 0,
+            4, 0, 8, 4, 0, 4, 8, 0, 8, 4, 0, 4,
+            0, 4, 0, 4, 8, 0, 4, 0, 4, 8, 4, 0,
+            8, 0, 8, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+            8, 4, 8, 0, 8, 0, 8, 4, 0, 4, 0, 4,
+            8, 4, 0, 4, 0, 4, 8, 0, 4, 0, 4, 0,
+            4, 0, 4, 0, 4, 8, 0, 4, 0, 8, 4, 8,
+            4, 8, 0, 4, 8, 0, 8, 4, 0, 4, 0, 4,
+            0, 4, 8, 0, 4, 0, 4, 8, 4, 0, 8, 0,
+            8, 4, 7, 0, 4, 0, 4, 0, 4, 8, 0, 4,
+            0, 4, 8, 4, 0, 4, 0, 8, 4, 0, 8, 0,
+            4, 0, 8, 4, 0, 4, 0, 4, 0, 8, 4, 0,
+            4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 8, 0,
+            4, 8, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+            4, 8, 4, 0, 4, 8, 4, 0, 8, 4, 0, 4,
+            0, 4, 0, 4, 0, 8, 4, 0, 4, 0, 4, 0,
+            9, 10, 11, 0, 4, 0, 4, 8, 0, 4, 8, 0,
+            4, 0, 4, 0, 4, 8, 4, 8, 4, 8, 4, 0,
+            4, 0, 4, 3, 4, 0, 4, 0, 4, 0, 4, 8,
+            4, 8, 0, 8, 4, 8, 4, 0, 4, 8, 4, 0,
+            8, 4, 8, 4, 0, 4, 0, 4, 0, 4, 8, 4,
+            0, 4, 0, 4, 0, 4, 8, 0, 4, 8, 4, 8,
+            4, 8, 0, 4, 0, 4, 8, 0, 8, 4, 8, 4,
+            8, 4, 0, 4, 8, 4, 8, 4, 8, 4, 8, 0,
+            8, 4, 8, 4, 0, 4, 0, 4, 8, 4, 0, 4,
+            0, 4, 0, 8, 4, 0, 4, 0, 3, 4, 5, 3,
+            0, 3, 0, 14, 0, 14, 0, 3, 0, 4, 0, 14,
+            0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+            0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+            0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+            0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+            0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+            0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+            0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 4,
+            0, 4, 0, 4, 0, 4, 14, 0, 14, 0, 4, 0,
+            14, 0, 14, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+            4, 0, 4, 0, 4, 0, 8, 4, 8, 0, 4, 0,
+            8, 0, 8, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+            8, 0, 9, 0, 4, 8, 0, 4, 8, 4, 8, 4,
+            8, 0, 4, 0, 4, 8, 4, 8, 4, 0, 4, 0,
+            4, 8, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+            0, 4, 0, 8, 4, 8, 0, 8, 4, 0, 8, 4,
+            8, 4, 8, 0, 8, 4, 0, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+            13, 0, 10, 0, 11, 0, 4, 0, 4, 0, 4, 0,
+            3, 0, 4, 0, 3, 0, 4, 0, 4, 0, 4, 0,
+            4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+            4, 0, 4, 0, 4, 0, 4, 0, 8, 4, 8, 0,
+            4, 0, 4, 0, 4, 0, 4, 8, 0, 8, 4, 8,
+            4, 0, 7, 0, 4, 0, 7, 0, 4, 0, 4, 8,
+            4, 0, 8, 0, 4, 0, 4, 8, 0, 8, 4, 8,
+            0, 7, 0, 4, 0, 8, 4, 0, 8, 4, 8, 4,
+            8, 4, 0, 4, 0, 4, 8, 4, 0, 4, 8, 0,
+            4, 0, 4, 8, 4, 8, 0, 8, 0, 8, 0, 4,
+            0, 8, 0, 4, 0, 4, 0, 8, 4, 8, 4, 8,
+            4, 0, 4, 0, 4, 8, 4, 8, 4, 8, 4, 8,
+            4, 8, 4, 0, 4, 8, 4, 0, 8, 4, 8, 4,
+            0, 4, 0, 8, 4, 8, 4, 8, 4, 0, 4, 8,
+            4, 8, 4, 8, 4, 0, 4, 0, 4, 8, 4, 0,
+            8, 4, 8, 4, 0, 4, 8, 0, 8, 0, 4, 8,
+            4, 7, 8, 7, 8, 4, 0, 8, 4, 0, 4, 8,
+            4, 0, 8, 0, 4, 0, 4, 8, 7, 4, 0, 4,
+            0, 4, 8, 4, 0, 7, 4, 8, 4, 0, 8, 4,
+            0, 4, 8, 4, 0, 4, 0, 8, 4, 8, 4, 8,
+            4, 0, 4, 0, 4, 0, 4, 0, 4, 7, 4, 0,
+            8, 0, 4, 0, 8, 4, 8, 4, 0, 4, 8, 0,
+            3, 0, 4, 0, 4, 0, 4, 0, 8, 0, 4, 0,
+            4, 0, 8, 0, 4, 0, 3, 0, 4, 0, 4, 0,
+            4, 8, 4, 0, 8, 4, 3, 4, 0, 4, 0, 4,
+            0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+            0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+            0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 14,
+            0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+            0, 14, 6, 0, 14, 0, 14, 0, 14, 0, 14, 0,
+            14, 0, 14, 4, 14, 0, 14, 0, 14, 0, 14, 0,
+            14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0,
+            14, 0, 14, 0, 14, 0, 14, 0, 3, 4, 3, 4,
+            3, 0
+        };
+
+        // Extended_Pictographic (inversion list: even indices start a range, odd indices end it)
+        const std::uint32_t _s_extended_pictographic_ranges[] = {
+            0x00A9, 0x00AA, 0x00AE, 0x00AF, 0x203C, 0x203D, 0x2049, 0x204A, 0x2122, 0x2123, 0x2139, 0x213A,
+            0x2194, 0x219A, 0x21A9, 0x21AB, 0x231A, 0x231C, 0x2328, 0x2329, 0x2388, 0x2389, 0x23CF, 0x23D0,
+            0x23E9, 0x23F4, 0x23F8, 0x23FB, 0x24C2, 0x24C3, 0x25AA, 0x25AC, 0x25B6, 0x25B7, 0x25C0, 0x25C1,
+            0x25FB, 0x25FF, 0x2600, 0x2606, 0x2607, 0x2613, 0x2614, 0x2686, 0x2690, 0x2706, 0x2708, 0x2713,
+            0x2714, 0x2715, 0x2716, 0x2717, 0x271D, 0x271E, 0x2721, 0x2722, 0x2728, 0x2729, 0x2733, 0x2735,
+            0x2744, 0x2745, 0x2747, 0x2748, 0x274C, 0x274D, 0x274E, 0x274F, 0x2753, 0x2756, 0x2757, 0x2758,
+            0x2763, 0x2768, 0x2795, 0x2798, 0x27A1, 0x27A2, 0x27B0, 0x27B1, 0x27BF, 0x27C0, 0x2934, 0x2936,
+            0x2B05, 0x2B08, 0x2B1B, 0x2B1D, 0x2B50, 0x2B51, 0x2B55, 0x2B56, 0x3030, 0x3031, 0x303D, 0x303E,
+            0x3297, 0x3298, 0x3299, 0x329A, 0x1F000, 0x1F100, 0x1F10D, 0x1F110, 0x1F12F, 0x1F130, 0x1F16C, 0x1F172,
+            0x1F17E, 0x1F180, 0x1F18E, 0x1F18F, 0x1F191, 0x1F19B, 0x1F1AD, 0x1F1E6, 0x1F201, 0x1F210, 0x1F21A, 0x1F21B,
+            0x1F22F, 0x1F230, 0x1F232, 0x1F23B, 0x1F23C, 0x1F240, 0x1F249, 0x1F3FB, 0x1F400, 0x1F53E, 0x1F546, 0x1F650,
+            0x1F680, 0x1F700, 0x1F774, 0x1F780, 0x1F7D5, 0x1F800, 0x1F80C, 0x1F810, 0x1F848, 0x1F850, 0x1F85A, 0x1F860,
+            0x1F888, 0x1F890, 0x1F8AE, 0x1F900, 0x1F90C, 0x1F93B, 0x1F93C, 0x1F946, 0x1F947, 0x1FB00, 0x1FC00, 0x1FFFE
+        };
+
+        // General_Category=Nd (zero digits)
+        const std::uint32_t _s_decimal_digit_zeros[] = {
+            0x0030, 0x0660, 0x06F0, 0x07C0, 0x0966, 0x09E6, 0x0A66, 0x0AE6, 0x0B66, 0x0BE6, 0x0C66, 0x0CE6,
+            0x0D66, 0x0DE6, 0x0E50, 0x0ED0, 0x0F20, 0x1040, 0x1090, 0x17E0, 0x1810, 0x1946, 0x19D0, 0x1A80,
+            0x1A90, 0x1B50, 0x1BB0, 0x1C40, 0x1C50, 0xA620, 0xA8D0, 0xA900, 0xA9D0, 0xA9F0, 0xAA50, 0xABF0,
+            0xFF10, 0x104A0, 0x10D30, 0x11066, 0x110F0, 0x11136, 0x111D0, 0x112F0, 0x11450, 0x114D0, 0x11650, 0x116C0,
+            0x11730, 0x118E0, 0x11950, 0x11C50, 0x11D50, 0x11DA0, 0x16A60, 0x16AC0, 0x16B50, 0x1D7CE, 0x1D7D8, 0x1D7E2,
+            0x1D7EC, 0x1D7F6, 0x1E140, 0x1E2F0, 0x1E950, 0x1FBF0
+        };
+
+    } // namespace // ImplementationDetail
+    /// @endinternal
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_UPROPERTIES_TABLES_HPP)
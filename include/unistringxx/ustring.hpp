@@ -2,18 +2,213 @@
 #define UNISTRINGXX_USTRING_HPP
 
 #include <algorithm>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
+#include "common.hpp"
+#include "hash.hpp"
 #include "uchar.hpp"
+#include "utf_validation.hpp"
 #include "utils.hpp"
 
+#if (UNISTRINGXX_HAS_PMR)
+#include <memory_resource>
+#endif // (UNISTRINGXX_HAS_PMR)
+
 namespace unistringxx
 {
-    // TODO: test propagating allocators...
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // Large enough for any integer and for the shortest representation of any floating point number.
+        const std::size_t _s_number_buffer_size = 64;
+
+        const char _s_decimal_digit_pairs[] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+        inline std::size_t count_decimal_digits(unsigned long long value)
+        {
+            std::size_t result = 1;
+            for (; value >= 10000; value /= 10000)
+                result += 4;
+            if (value >= 1000)
+                return (result + 3);
+            if (value >= 100)
+                return (result + 2);
+            return ((value >= 10) ? (result + 1) : result);
+        }
+
+        // Writes the decimal digits of a value two at a time, backwards from last.
+        inline void format_decimal_digits(char* last, unsigned long long value)
+        {
+            while (value >= 100) {
+                const std::size_t index = static_cast<std::size_t>(value % 100) * 2;
+                value /= 100;
+                *--last = _s_decimal_digit_pairs[index + 1];
+                *--last = _s_decimal_digit_pairs[index];
+            }
+            if (value >= 10) {
+                const std::size_t index = static_cast<std::size_t>(value) * 2;
+                *--last = _s_decimal_digit_pairs[index + 1];
+                *--last = _s_decimal_digit_pairs[index];
+            }
+            else {
+                *--last = static_cast<char>('0' + value);
+            }
+            return;
+        }
+
+        template<typename integerT>
+        inline bool is_negative_number(integerT value, std::true_type)
+        { return (value < 0); }
+
+        template<typename integerT>
+        inline bool is_negative_number(integerT, std::false_type)
+        { return (false); }
+
+        // Formats an integer as ASCII into a buffer of _s_number_buffer_size characters. Returns the end of the
+        // output.
+        template<typename integerT>
+        inline typename std::enable_if<std::is_integral<integerT>::value, char*>::type format_number_ascii(
+            char* buffer, integerT value
+        )
+        {
+            const bool is_negative = is_negative_number(value, std::is_signed<integerT>{});
+            // The magnitude of the most negative value does not fit in the signed type.
+            const unsigned long long magnitude = is_negative ?
+                (0ULL - static_cast<unsigned long long>(value)) : static_cast<unsigned long long>(value);
+            if (is_negative)
+                *buffer++ = '-';
+            char* last = buffer + count_decimal_digits(magnitude);
+            format_decimal_digits(last, magnitude);
+            return (last);
+        }
+
+        template<typename floatT>
+        struct float_format_traits;
+
+        // max_exact_integer: Integers below it have at most digits10 digits and are exact in the type.
+        template<>
+        struct float_format_traits<float>
+        {
+            static constexpr float max_exact_integer = 1e6f;
+
+            static int format(char* buffer, std::size_t size, int precision, float value)
+            { return (std::snprintf(buffer, size, "%.*g", precision, static_cast<double>(value))); }
+
+            static float parse(const char* str)
+            { return (std::strtof(str, nullptr)); }
+        };
+
+        template<>
+        struct float_format_traits<double>
+        {
+            static constexpr double max_exact_integer = 1e15;
+
+            static int format(char* buffer, std::size_t size, int precision, double value)
+            { return (std::snprintf(buffer, size, "%.*g", precision, value)); }
+
+            static double parse(const char* str)
+            { return (std::strtod(str, nullptr)); }
+        };
+
+        template<>
+        struct float_format_traits<long double>
+        {
+            static constexpr long double max_exact_integer = (std::numeric_limits<long double>::digits10 >= 18) ?
+                1e18L : 1e15L;
+
+            static int format(char* buffer, std::size_t size, int precision, long double value)
+            { return (std::snprintf(buffer, size, "%.*Lg", precision, value)); }
+
+            static long double parse(const char* str)
+            { return (std::strtold(str, nullptr)); }
+        };
+
+        inline char* copy_ascii(char* buffer, const char* str)
+        {
+            const std::size_t length = std::strlen(str);
+            std::memcpy(buffer, str, length);
+            return (buffer + length);
+        }
+
+        // Formats a floating point number as ASCII into a buffer of _s_number_buffer_size characters, with the
+        // fewest significant digits that parse back to the same value (e.g. 0.1, 1e+100, 3.4028235e+38 for
+        // FLT_MAX). The syntax is that of printf's %g, except that the decimal point is always '.'. Returns the end
+        // of the output.
+        template<typename floatT>
+        inline typename std::enable_if<std::is_floating_point<floatT>::value, char*>::type format_number_ascii(
+            char* buffer, floatT value
+        )
+        {
+            if (std::isnan(value))
+                return (copy_ascii(buffer, std::signbit(value) ? "-nan" : "nan"));
+            if (std::isinf(value))
+                return (copy_ascii(buffer, std::signbit(value) ? "-inf" : "inf"));
+
+            // Integers with at most digits10 digits are printed as such by %g, without an exponent.
+            typedef float_format_traits<floatT> traits;
+            if ((value > -traits::max_exact_integer) && (value < traits::max_exact_integer) &&
+                (value == std::trunc(value))) {
+                if (std::signbit(value))
+                    *buffer++ = '-';
+                return (format_number_ascii(buffer, static_cast<unsigned long long>(std::fabs(value))));
+            }
+
+            // The shortest representation has at most max_digits10 digits. If it has at most digits10 digits, %g with
+            // digits10 digits yields it, because such a value is much closer to it than to any other number with
+            // digits10 digits (and %g removes the trailing zeros). Subnormal numbers have fewer significant bits, so all
+            // the precisions are tried.
+            const bool is_subnormal = (std::fpclassify(value) == FP_SUBNORMAL);
+            int size = 0;
+            for (int precision = is_subnormal ? 1 : std::numeric_limits<floatT>::digits10; ; precision++) {
+                size = traits::format(buffer, _s_number_buffer_size, precision, value);
+                if ((precision >= std::numeric_limits<floatT>::max_digits10) || (traits::parse(buffer) == value))
+                    break;
+            }
+
+            // Replace the decimal point of the current locale.
+            const char* decimal_point = std::localeconv()->decimal_point;
+            const std::size_t decimal_point_size = std::strlen(decimal_point);
+            char* last = buffer + size;
+            if ((decimal_point_size > 0) && ((decimal_point_size != 1) || (decimal_point[0] != '.'))) {
+                char* point = std::strstr(buffer, decimal_point);
+                if (point != nullptr) {
+                    *point = '.';
+                    std::memmove(
+                        point + 1, point + decimal_point_size,
+                        static_cast<std::size_t>(last - (point + decimal_point_size))
+                    );
+                    last -= decimal_point_size - 1;
+                }
+            }
+            return (last);
+        }
+
+        // Gets the number of octets that from_u8string consumes for a sequence starting with this octet (the number of
+        // leading 1 bits, at most 4, or 1 for ASCII and stray continuation octets).
+        inline std::size_t utf8_sequence_step(char8_t ch)
+        {
+            std::size_t result = 0;
+            for (std::size_t bit_num = 0x07; (bit_num != 0) && is_bit_set(ch, bit_num); bit_num--)
+                result++;
+            return (std::max<std::size_t>(std::min<std::size_t>(result, 4), 1));
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
     // Notes:
     // Implementation Design Pattern : Many of the fuctions are forwarding calls to other versions of the functions. In
     // essence, keep in mind that, unless there is a useful default implementation, all overloaded functions must end up
@@ -23,6 +218,10 @@ namespace unistringxx
     // overloaded functions must end up calling that function (whether that useful default implementation is the
     // iterator version or not). Constructors are exempted from this requirement. Some functions may also be exempt from
     // this requirement if it makes sense.
+    // Allocators: Every function that creates a generic_ustring (including temporaries and the factory functions) uses
+    // the allocator of this object (or the one passed as argument), and the propagate_on_container_* traits of the
+    // allocator are honored by assignment and swap (through std::vector and swap()). Copies use
+    // select_on_container_copy_construction.
     template<typename allocatorT>
     class generic_ustring
     {
@@ -42,6 +241,7 @@ namespace unistringxx
         typedef typename impl_type::const_pointer const_pointer;
 
         typedef typename impl_type::allocator_type allocator_type;
+        typedef std::allocator_traits<allocator_type> allocator_traits_type;
         typedef typename impl_type::size_type size_type;
         typedef typename impl_type::difference_type difference_type;
         typedef typename impl_type::iterator iterator;
@@ -60,58 +260,66 @@ namespace unistringxx
         { return; }
 
         generic_ustring(const generic_ustring& other) noexcept :
-            generic_ustring{other, other.get_allocator()}
+            generic_ustring{other, allocator_traits_type::select_on_container_copy_construction(other.get_allocator())}
         { return; }
 
         generic_ustring(const generic_ustring& other, const allocator_type& alloc) :
             _impl{other._impl, alloc}
         { return; }
 
+        // Note: The buffer is taken over, and other is left without a buffer (not even the null terminator), which is a
+        // valid empty string: moving never allocates.
         generic_ustring(generic_ustring&& other) noexcept :
-            generic_ustring{other, other.get_allocator()}
+            _impl{std::move(other._impl)}
         { return; }
 
         generic_ustring(generic_ustring&& other, const allocator_type& alloc) :
-            _impl{other._impl, alloc}
-        { return; }
+            _impl{std::move(other._impl), alloc}
+        {
+            // With unequal allocators, the code points are moved one by one and other is left in an unspecified state.
+            other.clear();
+            return;
+        }
 
         generic_ustring(
             const generic_ustring& other,
             size_type index,
             size_type count = generic_ustring::npos,
             const allocator_type& alloc = allocator_type()
-        )
+        ) :
+            _impl{alloc}
         {
             if (index > other.size()) {
 #if (UNISTRINGXX_WITH_EXCEPTIONS)
                 UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
 #else // (UNISTRINGXX_WITH_EXCEPTIONS)
-                _impl = impl_type{1, char_type::null_char(), alloc};
+                _impl.assign(1, char_type::null_char());
                 return;
 #endif // (UNISTRINGXX_WITH_EXCEPTIONS)
             }
 
             const size_type actual_count = std::min(count, other.size() - index);
 
-            _impl = impl_type{actual_count + 1, char_type::null_char(), alloc};
+            _impl.assign(actual_count + 1, char_type::null_char());
             if (actual_count > 0)
                 std::copy_n(other._impl.cbegin() + index, actual_count, _impl.begin());
             return;
         }
 
-        generic_ustring(const char_type* cstr, size_type count, const allocator_type& alloc = allocator_type())
+        generic_ustring(const char_type* cstr, size_type count, const allocator_type& alloc = allocator_type()) :
+            _impl{alloc}
         {
             if (count > _impl.max_size()) {
 #if (UNISTRINGXX_WITH_EXCEPTIONS)
                 UNISTRINGXX_THROW(std::length_error, "The 'count' argument would have exceeded max_size().");
 #else // (UNISTRINGXX_WITH_EXCEPTIONS)
-                _impl = impl_type{1, char_type::null_char(), alloc};
+                _impl.assign(1, char_type::null_char());
                 return;
 #endif // (UNISTRINGXX_WITH_EXCEPTIONS)
             }
 
             // note if cstr does not have at least count char_type elements, then it is an undefined behavior.
-            _impl = impl_type{count + 1, char_type::null_char(), alloc};
+            _impl.assign(count + 1, char_type::null_char());
             if (count > 0)
                 traits_type::copy(_impl.data(), cstr, count);
             return;
@@ -129,22 +337,22 @@ namespace unistringxx
             return;
         }
 
-        template<typename inputIterT>
+        template<
+            typename inputIterT,
+            typename = typename std::enable_if<!std::is_integral<inputIterT>::value>::type
+        >
         generic_ustring(inputIterT first, inputIterT last, const allocator_type& alloc = allocator_type()) :
-            _impl{first, last, alloc}
+            _impl{alloc}
         {
-            _impl.push_back(char_type::null_char());
-            _impl.shrink_to_fit();
+            this->construct_from_range(
+                first, last, typename std::iterator_traits<inputIterT>::iterator_category{}
+            );
             return;
         }
 
         generic_ustring(std::initializer_list<char_type> init_list, const allocator_type& alloc = allocator_type()) :
-            _impl{init_list, alloc}
-        { 
-            _impl.push_back(char_type::null_char());
-            _impl.shrink_to_fit();
-            return;
-        }
+            generic_ustring{init_list.begin(), init_list.end(), alloc}
+        { return; }
 
         ~generic_ustring(void) = default;
 
@@ -154,7 +362,7 @@ namespace unistringxx
         { return (_impl.get_allocator()); }
 
         const_pointer data(void) const noexcept
-        { return (_impl.data()); }
+        { return (_impl.empty() ? &null_terminator() : _impl.data()); }
 
         const_pointer c_str(void) const noexcept
         { return (this->data()); }
@@ -167,9 +375,10 @@ namespace unistringxx
         int compare(const generic_ustring& str) const noexcept
         {
             const size_type compare_count = std::min(this->size(), str.size());
-            // Note: The compare_count + 1 is done so that we compare the null characters. This provides the
-            // needed comparison if compare returns 0 on two strings differing on length.
-            return (traits_type::compare(this->c_str(), str.c_str(), compare_count + 1));
+            const int result = traits_type::compare(this->data(), str.data(), compare_count);
+            if (result != 0)
+                return (result);
+            return ((this->size() == str.size()) ? 0 : ((this->size() < str.size()) ? -1 : 1));
         }
 
         int compare(size_type index, size_type count, const generic_ustring& str) const
@@ -182,19 +391,27 @@ namespace unistringxx
         { return (this->substr(index1, count1).compare(str.substr(index2, count2))); }
 
         int compare(const char_type* cstr) const noexcept
-        { return (this->compare(generic_ustring{cstr})); }
+        { return (compare_with_cstr(this->data(), this->size(), cstr)); }
 
         int compare(size_type index, size_type count, const char_type* cstr) const
         { return (this->substr(index, count).compare(cstr)); }
 
         int compare(size_type index, size_type count, const char_type* cstr, size_type cstr_count) const
-        { return (this->substr(index, count).compare(generic_ustring{cstr, cstr_count})); }
+        { return (this->substr(index, count).compare(generic_ustring{cstr, cstr_count, this->get_allocator()})); }
 
         // UNISTRINGXX_UNISTRING_ASSIGNMENT_OPERATIONS
 
         generic_ustring& operator=(const generic_ustring& str) = default;
 
-        generic_ustring& operator=(generic_ustring&& str) /*noexcept*/ = default;
+        generic_ustring& operator=(generic_ustring&& str) /*noexcept*/
+        {
+            if (this != &str) {
+                _impl = std::move(str._impl);
+                // Leaves str as a valid empty string, without allocating (see the move constructor).
+                str.clear();
+            }
+            return (*this);
+        }
 
         generic_ustring& operator=(const char_type* cstr)
         {
@@ -260,7 +477,7 @@ namespace unistringxx
         generic_ustring& assign(inputIterT first, inputIterT last)
         {
             // calls generic_ustring::assign(const generic_ustring&)
-            return (this->assign(generic_ustring{first, last}));
+            return (this->assign(generic_ustring{first, last, this->get_allocator()}));
         }
 
         generic_ustring& assign(std::initializer_list<char_type> init_list)
@@ -280,29 +497,29 @@ namespace unistringxx
         const_iterator cbegin(void) const noexcept
         { return (_impl.cbegin()); }
 
-        // Note: The operator-- is needed to hide the null pointer.
+        // Note: The offset is needed to hide the null pointer (a moved-from string has none).
         iterator end(void) noexcept
-        { return (--_impl.end()); }
+        { return (_impl.end() - this->terminator_size()); }
 
-        // Note: The operator-- is needed to hide the null pointer.
+        // Note: The offset is needed to hide the null pointer (a moved-from string has none).
         const_iterator end(void) const noexcept
-        { return (--_impl.end()); }
+        { return (_impl.end() - this->terminator_size()); }
 
-        // Note: The operator-- is needed to hide the null pointer.
+        // Note: The offset is needed to hide the null pointer (a moved-from string has none).
         const_iterator cend(void) const noexcept
-        { return (--_impl.cend()); }
+        { return (_impl.cend() - this->terminator_size()); }
 
-        // Note: The operator++ is needed to hide the null pointer.
+        // Note: The offset is needed to hide the null pointer (a moved-from string has none).
         reverse_iterator rbegin(void) noexcept
-        { return (++_impl.rbegin()); }
+        { return (_impl.rbegin() + this->terminator_size()); }
 
-        // Note: The operator++ is needed to hide the null pointer.
+        // Note: The offset is needed to hide the null pointer (a moved-from string has none).
         const_reverse_iterator rbegin(void) const noexcept
-        { return (++_impl.rbegin()); }
+        { return (_impl.rbegin() + this->terminator_size()); }
 
-        // Note: The operator++ is needed to hide the null pointer.
+        // Note: The offset is needed to hide the null pointer (a moved-from string has none).
         const_reverse_iterator crbegin(void) const noexcept
-        { return (++_impl.crbegin()); }
+        { return (_impl.crbegin() + this->terminator_size()); }
 
         reverse_iterator rend(void) noexcept
         { return (_impl.rend()); }
@@ -320,7 +537,7 @@ namespace unistringxx
             // This does not work because a string can contain null characters anywhere in it.
             // traits_type::length counts the number of characters until the 1st null character.
             // return (traits_type::length(this->data()));
-            return (_impl.size() - 1); // Don't count the null character.
+            return (_impl.size() - this->terminator_size()); // Don't count the null character.
         }
 
         size_type length(void) const noexcept
@@ -336,12 +553,14 @@ namespace unistringxx
             }
 
             if (count < this->size()) {
-                // calls generic_ustring::operator=(generic_ustring&&)
-                (*this) = std::move(generic_ustring{*this, 0, count, this->get_allocator()});
+                // Shrinking never reallocates: the null terminator is moved to the new end.
+                _impl[count] = char_type::null_char();
+                _impl.resize(count + 1);
             }
             else {
                 // Note: null character is at the end of _impl. "this->cend()" returns the pos of this
                 // null character.
+                this->terminate();
                 _impl.insert(this->cend(), (count - this->size()), ch);
             }
             return;
@@ -368,10 +587,13 @@ namespace unistringxx
             return;
         }
 
+        // Note: This keeps the buffer (and never allocates).
         void clear(void) noexcept
         {
-            _impl.clear();
-            _impl.push_back(char_type::null_char());
+            if (!_impl.empty()) {
+                _impl.front() = char_type::null_char();
+                _impl.erase(_impl.begin() + 1, _impl.end());
+            }
             return;
         }
 
@@ -387,12 +609,12 @@ namespace unistringxx
 
         // If index == size(), then this returns the null character as per standards.
         const_reference operator[](size_type index) const
-        { return (_impl.operator[](index)); }
+        { return (_impl.empty() ? null_terminator() : _impl.operator[](index)); }
 
         // If index == size(), then this returns the null character as per standards.
         // Modifying the returned reference to null character, however, is an undefined behavior.
         reference operator[](size_type index)
-        { return (_impl.operator[](index)); }
+        { return (_impl.empty() ? null_terminator() : _impl.operator[](index)); }
 
         const_reference at(size_type index) const
         { 
@@ -416,16 +638,16 @@ namespace unistringxx
 
         // TODO: Deal with (empty() == true) situations.
         const char_type& front(void) const
-        { return (_impl.front()); }
+        { return (this->operator[](0)); }
 
         // TODO: Deal with (empty() == true) situations.
         char_type& front(void)
-        { return (_impl.front()); }
+        { return (this->operator[](0)); }
 
         const char_type& back(void) const
         {
             if (this->empty())
-                return (_impl.back());
+                return (this->operator[](0));
             // return (_impl.at(_impl.size() - 2));
             return (this->operator[](this->size() - 1));
         }
@@ -433,7 +655,7 @@ namespace unistringxx
         char_type& back(void)
         {
             if (this->empty())
-                return (_impl.back());
+                return (this->operator[](0));
             // return (_impl.at(_impl.size() - 2));
             return (this->operator[](this->size() - 1));
         }
@@ -503,6 +725,12 @@ namespace unistringxx
         template<typename inputIterT>
         iterator insert(const_iterator pos, inputIterT first, inputIterT last)
         {
+            if (_impl.empty()) {
+                // A moved-from string (pos can only be cend()): the null terminator is added after the text.
+                _impl.assign(first, last);
+                _impl.push_back(char_type::null_char());
+                return (_impl.begin());
+            }
             // Prevent inserting after the null character.
             const_iterator actual_pos = std::min(pos, this->cend());
             return (_impl.insert(actual_pos, first, last));
@@ -589,6 +817,24 @@ namespace unistringxx
             return (this->append(init_list.begin(), init_list.end()));
         }
 
+        ///
+        /// Appends the decimal representation of a number, without creating any temporary string. Integers are
+        /// formatted as by std::to_string. Floating point numbers are formatted with the fewest significant digits that
+        /// parse back to the same value, in the syntax of printf's %g (e.g. "0.1", "-2.5e-07", "1e+100", "inf") with
+        /// '.' as the decimal point; integral values with up to digits10 digits are written in full (e.g. "123000").
+        ///
+        template<typename numberT>
+        typename std::enable_if<
+            std::is_arithmetic<numberT>::value && !std::is_same<numberT, bool>::value, generic_ustring&
+        >::type append_number(numberT value)
+        {
+            char buffer[_s_number_buffer_size];
+            const char* last = format_number_ascii(buffer, value);
+            this->terminate();
+            _impl.insert(std::prev(_impl.end()), static_cast<const char*>(buffer), last);
+            return (*this);
+        }
+
         void push_back(char_type ch)
         {
             // Keep in mind the null character in _impl.
@@ -777,7 +1023,17 @@ namespace unistringxx
 
         void swap(generic_ustring& other)
         {
-            _impl.swap(other._impl);
+            if (allocator_traits_type::propagate_on_container_swap::value ||
+                (this->get_allocator() == other.get_allocator())) {
+                _impl.swap(other._impl);
+                return;
+            }
+
+            // The buffers cannot be exchanged (std::vector::swap is undefined for them): each string keeps its
+            // allocator and gets a copy of the other text.
+            impl_type other_text{other._impl, this->get_allocator()};
+            other._impl.assign(_impl.cbegin(), _impl.cend());
+            _impl.swap(other_text);
             return;
         }
 
@@ -1018,30 +1274,41 @@ namespace unistringxx
 
         std::string to_u8string(size_type index = 0, size_type count = npos) const
         {
-            return (
-                (*this).template to_stringT<std::string>(
-                    index, count,
-                    [] (std::string& dest, const char_type& uc) -> void {
-                        auto vec = uc.to_utf8();
-                        dest.append(vec.begin(), vec.end());
-                        return;
-                    }
-                )
-            );
+            const char_type* first = this->data();
+            const size_type size = this->get_encode_range(index, count, first);
+            // The octets are counted first, so that the result is allocated once (the invalid code points are
+            // dropped).
+            std::string result(utf8_length_of(first, size), '\0');
+            std::uint8_t* out = reinterpret_cast<std::uint8_t*>(&result[0]);
+            for (size_type ctr = 0; ctr < size; ctr++) {
+                const std::uint32_t code_point = static_cast<std::uint32_t>(first[ctr].code_point());
+                if (is_scalar_value(code_point))
+                    out += encode_utf8(code_point, out);
+            }
+            return (result);
         }
 
         std::u16string to_u16string(size_type index = 0, size_type count = npos) const
         {
-            return (
-                this->to_stringT<std::u16string>(
-                    index, count,
-                    [] (std::u16string& dest, const char_type& uc) -> void {
-                        auto vec = uc.to_utf16();
-                        dest.append(vec.begin(), vec.end());
-                        return;
-                    }
-                )
-            );
+            const char_type* first = this->data();
+            const size_type size = this->get_encode_range(index, count, first);
+            // The code units are counted first, so that the result is allocated once (the invalid code points are
+            // dropped).
+            std::u16string result(utf16_length_of(first, size), u'\0');
+            char16_t* out = &result[0];
+            for (size_type ctr = 0; ctr < size; ctr++) {
+                const std::uint32_t code_point = static_cast<std::uint32_t>(first[ctr].code_point());
+                if (!is_scalar_value(code_point))
+                    continue;
+                if (code_point < 0x10000) {
+                    *out++ = static_cast<char16_t>(code_point);
+                }
+                else {
+                    *out++ = static_cast<char16_t>(0xD800 + ((code_point - 0x10000) >> 10));
+                    *out++ = static_cast<char16_t>(0xDC00 + ((code_point - 0x10000) & 0x3FF));
+                }
+            }
+            return (result);
         }
 
         std::u32string to_u32string(size_type index = 0, size_type count = npos) const
@@ -1057,100 +1324,168 @@ namespace unistringxx
             );
         }
 
+        static generic_ustring from_u8string(const std::string& str, const allocator_type& alloc)
+        { return (from_u8string(str, 0, std::string::npos, alloc)); }
+
         static generic_ustring from_u8string(
             const std::string& str,
-            std::string::size_type index = 0, std::string::size_type count = std::string::npos
+            std::string::size_type index = 0, std::string::size_type count = std::string::npos,
+            const allocator_type& alloc = allocator_type()
         )
         {
-            const std::string actual_str = str.substr(index, count);
-            generic_ustring result;
-            for (std::string::size_type ctr = 0; ctr < actual_str.size(); ctr++) {
+            if (index > str.size()) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                index = str.size();
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            const char* first = str.data() + index;
+            const std::size_t size = std::min(count, str.size() - index);
+
+            // The code points are counted first, so that the result is allocated once: the valid prefix without
+            // decoding it, and the rest (from the first invalid sequence) the way it is decoded below.
+            const std::size_t valid_size = validate_utf8(first, size);
+            size_type code_point_count = count_code_points_utf8(first, valid_size);
+            for (std::size_t ctr = valid_size; ctr < size; ctr += utf8_sequence_step(static_cast<char8_t>(first[ctr])))
+                code_point_count++;
+
+            generic_ustring result{code_point_count, char_type::null_char(), alloc};
+            const std::uint8_t* octets = reinterpret_cast<const std::uint8_t*>(first);
+            size_type itr = 0;
+            for (std::size_t ctr = 0; ctr < valid_size;) {
+                if (((valid_size - ctr) >= 16) && is_ascii_block(octets + ctr)) {
+                    for (std::size_t offset = 0; offset < 16; offset++)
+                        result._impl[itr + offset] = traits_type::to_char_type(octets[ctr + offset]);
+                    ctr += 16;
+                    itr += 16;
+                    continue;
+                }
+                std::uint32_t code_point = 0;
+                ctr += decode_utf8(octets + ctr, octets + valid_size, code_point);
+                result._impl[itr++] = char_type{static_cast<typename char_type::int_type>(code_point)};
+            }
+            for (std::size_t ctr = valid_size; ctr < size; itr++) {
                 // determine how much octets needed to pass to from_utf8 function
-                const char8_t& ch = static_cast<char8_t>(actual_str[ctr]);
+                const char8_t ch = static_cast<char8_t>(first[ctr]);
+                const std::size_t num_seq = utf8_sequence_step(ch);
                 if (is_bit_set(ch, 0x07)) {
-                    std::size_t num_seq = 0;
-                    std::size_t bit_num = 0x07;
-                    while ((bit_num != 0) && (is_bit_set(ch, bit_num))) {
-                        num_seq++;
-                        bit_num--;
-                    }
-                    result.push_back(
-                        char_type::from_utf8(
-                            ch,
-                            num_seq > 1 ? actual_str[++ctr] : '\0',
-                            num_seq > 2 ? actual_str[++ctr] : '\0',
-                            num_seq > 3 ? actual_str[++ctr] : '\0'
-                        )
-                    );
+                    // Note: A truncated sequence at the end reads null octets (which from_utf8 rejects).
+                    const char8_t ch1 = ((num_seq > 1) && ((ctr + 1) < size)) ? first[ctr + 1] : '\0';
+                    const char8_t ch2 = ((num_seq > 2) && ((ctr + 2) < size)) ? first[ctr + 2] : '\0';
+                    const char8_t ch3 = ((num_seq > 3) && ((ctr + 3) < size)) ? first[ctr + 3] : '\0';
+                    result._impl[itr] = char_type::from_utf8(ch, ch1, ch2, ch3);
                 }
                 else {
-                    result.push_back(char_type::from_utf8(ch));
+                    result._impl[itr] = char_type::from_utf8(ch);
                 }
+                ctr += num_seq;
             }
             return (result);
         }
 
+        static generic_ustring from_u16string(const std::u16string& str, const allocator_type& alloc)
+        { return (from_u16string(str, 0, std::u16string::npos, alloc)); }
+
         static generic_ustring from_u16string(
             const std::u16string& str,
-            std::u16string::size_type index = 0, std::u16string::size_type count = std::u16string::npos
+            std::u16string::size_type index = 0, std::u16string::size_type count = std::u16string::npos,
+            const allocator_type& alloc = allocator_type()
         )
         {
-            const std::u16string actual_str = str.substr(index, count);
-            generic_ustring result;
-            for (std::u16string::size_type ctr = 0; ctr < actual_str.size(); ctr++) {
-                const auto& ch = actual_str[ctr];
-                if (ch >= 0xD800 && ch <= 0xDBFF) {
+            if (index > str.size()) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                index = str.size();
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            const char16_t* first = str.data() + index;
+            const std::size_t size = std::min(count, str.size() - index);
+
+            // The code points are counted first (a high surrogate takes two code units), so that the result is
+            // allocated once: the valid prefix without decoding it, and the rest the way it is decoded below.
+            const std::size_t valid_size = validate_utf16(first, size);
+            size_type code_point_count = count_code_points_utf16(first, valid_size);
+            for (std::size_t ctr = valid_size; ctr < size; ctr += (is_high_surrogate(first[ctr]) ? 2 : 1))
+                code_point_count++;
+
+            generic_ustring result{code_point_count, char_type::null_char(), alloc};
+            size_type itr = 0;
+            for (std::size_t ctr = 0; ctr < valid_size; ctr++, itr++) {
+                std::uint32_t code_point = first[ctr];
+                if (is_high_surrogate(first[ctr])) {
                     ctr++;
-                    const auto& ch2 = actual_str[ctr];
-                    result.push_back(char_type::from_utf16(ch, ch2));
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (first[ctr] - 0xDC00);
+                }
+                result._impl[itr] = char_type{static_cast<typename char_type::int_type>(code_point)};
+            }
+            for (std::size_t ctr = valid_size; ctr < size; ctr++, itr++) {
+                const char16_t ch = first[ctr];
+                if (is_high_surrogate(ch)) {
+                    ctr++;
+                    // Note: A truncated surrogate pair at the end reads a null code unit (which from_utf16 rejects).
+                    const char16_t ch2 = (ctr < size) ? first[ctr] : u'\0';
+                    result._impl[itr] = char_type::from_utf16(ch, ch2);
                 }
                 else {
-                    result.push_back(char_type::from_utf16(ch));
+                    result._impl[itr] = char_type::from_utf16(ch);
                 }
             }
             return (result);
         }
 
+        static generic_ustring from_u32string(const std::u32string& str, const allocator_type& alloc)
+        { return (from_u32string(str, 0, std::u32string::npos, alloc)); }
+
         static generic_ustring from_u32string(
             const std::u32string& str,
-            std::u32string::size_type index = 0, std::u32string::size_type count = std::u32string::npos
+            std::u32string::size_type index = 0, std::u32string::size_type count = std::u32string::npos,
+            const allocator_type& alloc = allocator_type()
         )
         {
-            const std::u32string actual_str = str.substr(index, count);
-            generic_ustring result;
-            for (const auto& ch : actual_str) {
-                result.push_back(char_type::from_utf32(ch));
+            if (index > str.size()) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                index = str.size();
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
             }
+            const char32_t* first = str.data() + index;
+            const std::size_t size = std::min(count, str.size() - index);
+
+            generic_ustring result{size, char_type::null_char(), alloc};
+            for (std::size_t ctr = 0; ctr < size; ctr++)
+                result._impl[ctr] = char_type::from_utf32(first[ctr]);
             return (result);
         }
 
         // Note: Because these are a template friend functions, the compiler will generate a free functions that
         // are specialized (i.e. these are not member functions).
         friend bool operator==(const generic_ustring& left, const generic_ustring& right)
-        { return (left._impl == right._impl); }
+        {
+            return (
+                (left.size() == right.size()) && code_points_equal(left.data(), right.data(), left.size())
+            );
+        }
 
         friend bool operator!=(const generic_ustring& left, const generic_ustring& right)
-        { return (left._impl != right._impl); }
+        { return (!(left == right)); }
 
         friend bool operator<(const generic_ustring& left, const generic_ustring& right)
-        { return (left._impl < right._impl); }
+        { return (left.compare(right) < 0); }
 
         friend bool operator<=(const generic_ustring& left, const generic_ustring& right)
-        { return (left._impl <= right._impl); }
+        { return (left.compare(right) <= 0); }
 
         friend bool operator>(const generic_ustring& left, const generic_ustring& right)
-        { return (left._impl > right._impl); }
+        { return (left.compare(right) > 0); }
 
         friend bool operator>=(const generic_ustring& left, const generic_ustring& right)
-        { return (left._impl >= right._impl); }
+        { return (left.compare(right) >= 0); }
 
         friend bool operator==(const char_type* cstr, const generic_ustring& str)
-        {
-            if (str.size() == 0 && !cstr[0].is_null())
-                return (false);
-            auto compare_count = std::min(traits_type::length(cstr), str.size());
-            return (traits_type::compare(cstr, str.c_str(), compare_count) == 0);
-        }
+        { return (compare_with_cstr(str.data(), str.size(), cstr) == 0); }
 
         friend bool operator==(const generic_ustring& str, const char_type* cstr)
         { return (cstr == str); }
@@ -1162,23 +1497,13 @@ namespace unistringxx
         { return (cstr != str); }
 
         friend bool operator<(const char_type* cstr, const generic_ustring& str)
-        {
-            if (str.size() == 0 && !cstr[0].is_null())
-                return (false);
-            auto compare_count = std::min(traits_type::length(cstr), str.size());
-            return (traits_type::compare(cstr, str.c_str(), compare_count) < 0);
-        }
+        { return (compare_with_cstr(str.data(), str.size(), cstr) > 0); }
 
         friend bool operator<(const generic_ustring& str, const char_type* cstr)
         { return (cstr > str); }
 
         friend bool operator>(const char_type* cstr, const generic_ustring& str)
-        {
-            if (str.size() == 0 && !cstr[0].is_null())
-                return (true);
-            auto compare_count = std::min(traits_type::length(cstr), str.size());
-            return (traits_type::compare(cstr, str.c_str(), compare_count) > 0);
-        }
+        { return (compare_with_cstr(str.data(), str.size(), cstr) < 0); }
 
         friend bool operator>(const generic_ustring& str, const char_type* cstr)
         { return (cstr < str); }
@@ -1201,11 +1526,82 @@ namespace unistringxx
 #endif // (UNISTRINGXX_TEST)
 
     private:
+        // Holds the code points followed by the null terminator, or nothing at all for a moved-from string.
         impl_type _impl;
 
+        // The null terminator of the strings without a buffer. It is never modified.
+        static char_type& null_terminator(void) noexcept
+        {
+            static char_type s_null_char{char_type::null_char()};
+            return (s_null_char);
+        }
+
+        // 1 if _impl ends with the null terminator, 0 for a moved-from string.
+        size_type terminator_size(void) const noexcept
+        { return (static_cast<size_type>(!_impl.empty())); }
+
+        // Gives a moved-from string its null terminator back, before modifying _impl directly.
+        void terminate(void)
+        {
+            if (_impl.empty())
+                _impl.push_back(char_type::null_char());
+            return;
+        }
+
+        // Compares a string with a null-terminated string in a single pass (without computing the length of the
+        // null-terminated string first).
+        static int compare_with_cstr(const char_type* data, size_type size, const char_type* cstr) noexcept
+        {
+            size_type itr = 0;
+            for (itr = 0; itr < size; itr++) {
+                if (cstr[itr].is_null())
+                    return (1);
+                if (data[itr] != cstr[itr])
+                    return (data[itr].code_point() - cstr[itr].code_point());
+            }
+            return (cstr[size].is_null() ? 0 : -1);
+        }
+
         size_type _actual_size(void) const
         { return (_impl.size()); }
 
+        static bool is_high_surrogate(char16_t ch) noexcept
+        { return ((ch >= 0xD800) && (ch <= 0xDBFF)); }
+
+        // Note: The size is not known up front, so the buffer grows as the elements are read.
+        template<typename inputIterT>
+        void construct_from_range(inputIterT first, inputIterT last, std::input_iterator_tag)
+        {
+            _impl.assign(first, last);
+            _impl.push_back(char_type::null_char());
+            return;
+        }
+
+        // A single allocation of the exact size (including the null terminator).
+        template<typename forwardIterT>
+        void construct_from_range(forwardIterT first, forwardIterT last, std::forward_iterator_tag)
+        {
+            _impl.reserve(static_cast<size_type>(std::distance(first, last)) + 1);
+            _impl.assign(first, last);
+            _impl.push_back(char_type::null_char());
+            return;
+        }
+
+        // Moves first to index and returns the number of code points from there that the to_u*string functions
+        // encode (like substr, without copying them).
+        size_type get_encode_range(size_type index, size_type count, const char_type*& first) const
+        {
+            if (index > this->size()) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                index = this->size();
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            first += index;
+            return (std::min(count, this->size() - index));
+        }
+
         template<class stringT>
         stringT to_stringT(
             size_type index, size_type count,
@@ -1222,6 +1618,13 @@ namespace unistringxx
 
     typedef generic_ustring<std::allocator<uchar_t_traits::char_type>> ustring;
 
+#if (UNISTRINGXX_HAS_PMR)
+    namespace pmr
+    {
+        typedef generic_ustring<std::pmr::polymorphic_allocator<uchar_t_traits::char_type>> ustring;
+    } // namespace pmr
+#endif // (UNISTRINGXX_HAS_PMR)
+
     namespace operators
     {
         // Literal operators.
@@ -1275,12 +1678,70 @@ namespace unistringxx
     inline long double stold(const generic_ustring<allocatorT>& str, std::size_t* index = nullptr)
     { return (std::stold(str.to_u8string(), index)); }
 
+    ///
+    /// Gets the number of octets of str.to_u8string(), without encoding it.
+    ///
+    template<typename allocatorT>
+    inline std::size_t utf8_length_of(const generic_ustring<allocatorT>& str) noexcept
+    { return (utf8_length_of(str.data(), str.size())); }
+
+    ///
+    /// Gets the number of code units of str.to_u16string(), without encoding it.
+    ///
+    template<typename allocatorT>
+    inline std::size_t utf16_length_of(const generic_ustring<allocatorT>& str) noexcept
+    { return (utf16_length_of(str.data(), str.size())); }
+
+    ///
+    /// Writes the decimal representation of a number as code points to an output iterator (e.g. a back insert
+    /// iterator of any container of code points). The format is the same as generic_ustring::append_number.
+    /// @returns The iterator past the last written code point.
+    ///
+    template<typename outputIterT, typename numberT>
+    inline typename std::enable_if<
+        std::is_arithmetic<numberT>::value && !std::is_same<numberT, bool>::value, outputIterT
+    >::type format_number(outputIterT out, numberT value)
+    {
+        char buffer[_s_number_buffer_size];
+        const char* last = format_number_ascii(buffer, value);
+        for (const char* itr = buffer; itr != last; ++itr, ++out)
+            *out = uchar_t{static_cast<uchar_t::int_type>(*itr)};
+        return (out);
+    }
+
+    /// @internal
     namespace // ImplementationDetail
     {
-        template<typename T>
-        inline ustring to_ustring_internal(T value)
-        { return (ustring::from_u8string(std::to_string(value))); }
-    } // ImplementationDetail
+        inline ustring ascii_to_ustring(const char* first, const char* last)
+        {
+            // A single allocation of the exact size.
+            ustring result(static_cast<ustring::size_type>(last - first), uchar_t::null_char());
+            std::copy(first, last, result.begin());
+            return (result);
+        }
+
+        template<typename integerT>
+        inline ustring to_ustring_internal(integerT value)
+        {
+            char buffer[_s_number_buffer_size];
+            return (ascii_to_ustring(buffer, format_number_ascii(buffer, value)));
+        }
+
+        // Same as std::to_string, i.e. printf's %f in the current locale, without the intermediate std::string.
+        template<typename floatT>
+        inline ustring to_ustring_fixed(floatT value, const char* format)
+        {
+            char buffer[_s_number_buffer_size];
+            const int size = std::snprintf(buffer, sizeof (buffer), format, value);
+            if ((size >= 0) && (static_cast<std::size_t>(size) < sizeof (buffer)))
+                return (ascii_to_ustring(buffer, buffer + size));
+
+            std::vector<char> large_buffer(static_cast<std::size_t>(size) + 1);
+            std::snprintf(large_buffer.data(), large_buffer.size(), format, value);
+            return (ascii_to_ustring(large_buffer.data(), large_buffer.data() + size));
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
 
     inline ustring to_ustring(int value)
     { return (to_ustring_internal(value)); }
@@ -1301,28 +1762,28 @@ namespace unistringxx
     { return (to_ustring_internal(value)); }
 
     inline ustring to_ustring(float value)
-    { return (to_ustring_internal(value)); }
+    { return (to_ustring_fixed(static_cast<double>(value), "%f")); }
 
     inline ustring to_ustring(double value)
-    { return (to_ustring_internal(value)); }
+    { return (to_ustring_fixed(value, "%f")); }
 
     inline ustring to_ustring(long double value)
-    { return (to_ustring_internal(value)); }
+    { return (to_ustring_fixed(value, "%Lf")); }
 
 } // namespace unistringxx
 
 namespace std
 {
     // specialization of std::hash
-    template <>
-    struct hash<unistringxx::ustring>
+    // The code points are hashed directly, with the same result as std::hash<unistringxx::generic_ustring_view>.
+    template<typename allocatorT>
+    struct hash<unistringxx::generic_ustring<allocatorT>>
     {
         typedef std::size_t result_type;
-        result_type operator()(const unistringxx::ustring& key) const
-        {
-            std::hash<std::string> hash_function;
-            return (hash_function(key.to_u8string()));
-        }
+        typedef unistringxx::generic_ustring<allocatorT> argument_type;
+
+        result_type operator()(const argument_type& key) const noexcept
+        { return (static_cast<result_type>(unistringxx::hash_code_points(key.data(), key.size()))); }
     };
 
     // specialization of std::swap
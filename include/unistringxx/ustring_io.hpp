@@ -0,0 +1,356 @@
+#if !defined(UNISTRINGXX_USTRING_IO_HPP)
+#define UNISTRINGXX_USTRING_IO_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // The number of code points (or octets) buffered on the stack between two transfers to the stream buffer.
+        const std::size_t _s_stream_buffer_size = 256;
+
+        // The White_Space property.
+        inline bool is_white_space(std::uint32_t code_point)
+        {
+            if (code_point < 0x80)
+                return ((code_point == 0x20) || ((code_point >= 0x09) && (code_point <= 0x0D)));
+            return (
+                (code_point == 0x85) || (code_point == 0xA0) || (code_point == 0x1680) ||
+                ((code_point >= 0x2000) && (code_point <= 0x200A)) || (code_point == 0x2028) ||
+                (code_point == 0x2029) || (code_point == 0x202F) || (code_point == 0x205F) || (code_point == 0x3000)
+            );
+        }
+
+        enum class stream_read_result
+        {
+            code_point,
+            end_of_stream,
+            invalid
+        };
+
+        // Reads one UTF-8 encoded code point from a stream buffer. The continuation octets are only consumed when they
+        // are valid, so an invalid or truncated sequence never swallows the next code point. The stream buffer refills
+        // itself as needed, so sequences split between two reads of the underlying device are decoded normally.
+        inline stream_read_result read_utf8(std::streambuf& buffer, std::uint32_t& code_point)
+        {
+            typedef std::char_traits<char> char_traits;
+
+            char_traits::int_type next = buffer.sgetc();
+            if (char_traits::eq_int_type(next, char_traits::eof()))
+                return (stream_read_result::end_of_stream);
+            std::uint8_t octets[_s_utf8_max_sequence_size];
+            octets[0] = static_cast<std::uint8_t>(char_traits::to_char_type(next));
+            buffer.sbumpc();
+
+            const std::size_t size = utf8_sequence_size(octets[0]);
+            std::size_t count = 1;
+            for (; count < size; count++) {
+                next = buffer.sgetc();
+                if (char_traits::eq_int_type(next, char_traits::eof()))
+                    break;
+                octets[count] = static_cast<std::uint8_t>(char_traits::to_char_type(next));
+                if ((octets[count] & 0xC0) != 0x80)
+                    break;
+                buffer.sbumpc();
+            }
+            if (decode_utf8(octets, octets + count, code_point) == 0)
+                return (stream_read_result::invalid);
+            return (stream_read_result::code_point);
+        }
+
+        inline bool write_fill(std::ostream& os, std::size_t count)
+        {
+            const char fill = os.fill();
+            for (; count > 0; count--) {
+                if (std::char_traits<char>::eq_int_type(os.rdbuf()->sputc(fill), std::char_traits<char>::eof()))
+                    return (false);
+            }
+            return (true);
+        }
+
+        inline bool write_octets(std::streambuf& buffer, const std::uint8_t* octets, std::size_t count)
+        {
+            const std::streamsize size = static_cast<std::streamsize>(count);
+            return (buffer.sputn(reinterpret_cast<const char*>(octets), size) == size);
+        }
+
+        inline bool write_utf8(std::streambuf& buffer, const uchar_t* data, std::size_t size)
+        {
+            std::uint8_t octets[_s_stream_buffer_size + _s_utf8_max_sequence_size];
+            std::size_t count = 0;
+            for (std::size_t ctr = 0; ctr < size; ctr++) {
+                // Note: Invalid code points are skipped, like to_u8string does.
+                if (!data[ctr].is_valid())
+                    continue;
+                count += encode_utf8(static_cast<std::uint32_t>(data[ctr].code_point()), octets + count);
+                if (count >= _s_stream_buffer_size) {
+                    if (!write_octets(buffer, octets, count))
+                        return (false);
+                    count = 0;
+                }
+            }
+            return ((count == 0) || write_octets(buffer, octets, count));
+        }
+
+        // Writes code points as UTF-8, padded to the width of the stream (counted in code points) like std::string.
+        inline std::ostream& write_code_points(std::ostream& os, const uchar_t* data, std::size_t size)
+        {
+            const std::ostream::sentry sentry{os};
+            if (!sentry)
+                return (os);
+
+            const std::size_t width = (os.width() > 0) ? static_cast<std::size_t>(os.width()) : 0;
+            const std::size_t padding = (width > size) ? (width - size) : 0;
+            const bool is_left = ((os.flags() & std::ios_base::adjustfield) == std::ios_base::left);
+            const bool is_written = (
+                (is_left || write_fill(os, padding)) && write_utf8(*os.rdbuf(), data, size) &&
+                (!is_left || write_fill(os, padding))
+            );
+            os.width(0);
+            if (!is_written)
+                os.setstate(std::ios_base::badbit);
+            return (os);
+        }
+
+        // Gives access to the get area of a stream buffer (which is protected), so that the octets can be decoded in
+        // place instead of one sgetc()/sbumpc() call at a time. The member pointers are taken through this class,
+        // which is allowed, but they are only applied to std::streambuf objects.
+        struct get_area_access : public std::streambuf
+        {
+            static const std::uint8_t* begin(std::streambuf& buffer)
+            { return (reinterpret_cast<const std::uint8_t*>((buffer.*(&get_area_access::gptr))())); }
+
+            static const std::uint8_t* end(std::streambuf& buffer)
+            { return (reinterpret_cast<const std::uint8_t*>((buffer.*(&get_area_access::egptr))())); }
+
+            static void consume(std::streambuf& buffer, std::size_t count)
+            {
+                (buffer.*(&get_area_access::gbump))(static_cast<int>(count));
+                return;
+            }
+        };
+
+        // Decodes [first, last) and appends the code points to str, through a buffer on the stack (one insertion per
+        // block, which copies the code points without initializing the storage first). Returns the octet where
+        // decoding stopped (see decode_utf8_run).
+        template<typename allocatorT>
+        inline const std::uint8_t* append_utf8(
+            generic_ustring<allocatorT>& str, const std::uint8_t* first, const std::uint8_t* last
+        )
+        {
+            uchar_t code_points[_s_stream_buffer_size];
+            while (first != last) {
+                const std::size_t size = std::min(static_cast<std::size_t>(last - first), _s_stream_buffer_size);
+                std::size_t count = 0;
+                const std::uint8_t* stop = decode_utf8_run(first, first + size, code_points, count);
+                str.append(code_points, code_points + count);
+                // A sequence split at the end of the block is decoded with the next block.
+                if (stop == first)
+                    break;
+                first = stop;
+            }
+            return (first);
+        }
+
+        // Appends the buffered code points to str, with a single insertion for the whole buffer.
+        template<typename allocatorT>
+        inline void flush_code_points(generic_ustring<allocatorT>& str, const uchar_t* buffer, std::size_t& count)
+        {
+            str.append(buffer, buffer + count);
+            count = 0;
+            return;
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Writes a string as UTF-8. The code points are encoded to a buffer on the stack and written to the stream buffer
+    /// in blocks (without an intermediate std::string). The width of the stream is counted in code points.
+    ///
+    template<typename allocatorT>
+    inline std::ostream& operator<<(std::ostream& os, const generic_ustring<allocatorT>& str)
+    { return (write_code_points(os, str.data(), str.size())); }
+
+    template<typename traitsT>
+    inline std::ostream& operator<<(std::ostream& os, generic_ustring_view<traitsT> str)
+    { return (write_code_points(os, str.data(), str.size())); }
+
+    ///
+    /// Reads a UTF-8 encoded word (like std::string, up to the next white space, and at most width() code points if
+    /// it is set). Leading white space is skipped when skipws is set. White space is the Unicode White_Space property:
+    /// an ASCII white space that ends the word stays in the stream, but a non-ASCII one (which takes several octets)
+    /// is consumed. An invalid UTF-8 sequence sets failbit.
+    ///
+    template<typename allocatorT>
+    inline std::istream& operator>>(std::istream& is, generic_ustring<allocatorT>& str)
+    {
+        const std::istream::sentry sentry{is};
+        if (!sentry)
+            return (is);
+
+        typedef std::char_traits<char> char_traits;
+        std::ios_base::iostate state = std::ios_base::goodbit;
+        const bool is_skipping = ((is.flags() & std::ios_base::skipws) != 0);
+        const std::size_t limit = (is.width() > 0) ? static_cast<std::size_t>(is.width()) : str.max_size();
+        std::streambuf& buffer = *is.rdbuf();
+        uchar_t code_points[_s_stream_buffer_size];
+        std::size_t count = 0;
+        std::size_t extracted = 0;
+
+        str.clear();
+        while (extracted < limit) {
+            const char_traits::int_type next = buffer.sgetc();
+            if (!char_traits::eq_int_type(next, char_traits::eof())) {
+                const char ch = char_traits::to_char_type(next);
+                if (((static_cast<unsigned char>(ch) & 0x80) == 0) && is_white_space(static_cast<std::uint32_t>(ch))) {
+                    if ((extracted > 0) || !is_skipping)
+                        break;
+                    buffer.sbumpc();
+                    continue;
+                }
+            }
+
+            std::uint32_t code_point = 0;
+            const stream_read_result result = read_utf8(buffer, code_point);
+            if (result == stream_read_result::end_of_stream) {
+                state |= std::ios_base::eofbit;
+                break;
+            }
+            if (result == stream_read_result::invalid) {
+                state |= std::ios_base::failbit;
+                break;
+            }
+            if (is_white_space(code_point)) {
+                if ((extracted > 0) || !is_skipping)
+                    break;
+                continue;
+            }
+            code_points[count++] = uchar_t{static_cast<uchar_t::int_type>(code_point)};
+            extracted++;
+            if (count == _s_stream_buffer_size)
+                flush_code_points(str, code_points, count);
+        }
+        flush_code_points(str, code_points, count);
+
+        is.width(0);
+        if (extracted == 0)
+            state |= std::ios_base::failbit;
+        is.setstate(state);
+        return (is);
+    }
+
+    ///
+    /// Reads UTF-8 encoded code points up to (and without) delim, which is extracted. Sets eofbit when the end of the
+    /// stream is reached first, and failbit when nothing is extracted or an invalid UTF-8 sequence is read. The octets
+    /// are decoded in bulk straight from the get area of the stream buffer: the delimiter is found with memchr, and
+    /// only the sequences split at the end of the get area (or invalid ones) are read one octet at a time.
+    ///
+    template<typename allocatorT>
+    inline std::istream& getline(std::istream& is, generic_ustring<allocatorT>& str, uchar_t delim)
+    {
+        const std::istream::sentry sentry{is, true};
+        if (!sentry)
+            return (is);
+
+        typedef std::char_traits<char> char_traits;
+        std::ios_base::iostate state = std::ios_base::goodbit;
+        std::streambuf& buffer = *is.rdbuf();
+        const std::uint32_t delim_code_point = static_cast<std::uint32_t>(delim.code_point());
+        // The first octet of the delimiter (or of the sequences that may be the delimiter). An invalid delimiter never
+        // matches.
+        const bool is_delim_valid = is_scalar_value(delim_code_point);
+        std::uint8_t delim_octets[_s_utf8_max_sequence_size];
+        if (is_delim_valid)
+            encode_utf8(delim_code_point, delim_octets);
+        bool is_extracted = false;
+
+        str.clear();
+        for (;;) {
+            const std::uint8_t* first = get_area_access::begin(buffer);
+            const std::uint8_t* last = get_area_access::end(buffer);
+            if (first == last) {
+                // Refills the get area (or reaches the end of the stream).
+                if (char_traits::eq_int_type(buffer.sgetc(), char_traits::eof())) {
+                    state |= std::ios_base::eofbit;
+                    break;
+                }
+                // Stream buffers without a get area (unbuffered ones, or stdio_sync_filebuf) leave it empty: their code
+                // points are read one octet at a time below.
+                if (get_area_access::begin(buffer) != get_area_access::end(buffer))
+                    continue;
+            }
+
+            std::uint32_t code_point = 0;
+            std::size_t sequence_size = 0;
+            if (first != last) {
+                const std::size_t available = static_cast<std::size_t>(last - first);
+                const std::uint8_t* candidate = is_delim_valid ?
+                    static_cast<const std::uint8_t*>(std::memchr(first, delim_octets[0], available)) : nullptr;
+                const std::uint8_t* segment_last = (candidate != nullptr) ? candidate : last;
+                if (static_cast<std::size_t>(segment_last - first) > (str.max_size() - str.size())) {
+                    state |= std::ios_base::failbit;
+                    break;
+                }
+                const std::uint8_t* stop = append_utf8(str, first, segment_last);
+                get_area_access::consume(buffer, static_cast<std::size_t>(stop - first));
+                is_extracted = is_extracted || (stop != first);
+                if (stop == last)
+                    continue;
+
+                // The delimiter candidate, a sequence split at the end of the get area, or an invalid sequence. Only
+                // the last two are read through the stream buffer functions.
+                sequence_size = decode_utf8(stop, last, code_point);
+            }
+            if (sequence_size > 0) {
+                get_area_access::consume(buffer, sequence_size);
+            }
+            else {
+                const stream_read_result result = read_utf8(buffer, code_point);
+                if (result == stream_read_result::end_of_stream) {
+                    state |= std::ios_base::eofbit;
+                    break;
+                }
+                if (result == stream_read_result::invalid) {
+                    state |= std::ios_base::failbit;
+                    break;
+                }
+            }
+            is_extracted = true;
+            if (code_point == delim_code_point)
+                break;
+            if (str.size() == str.max_size()) {
+                state |= std::ios_base::failbit;
+                break;
+            }
+            str.push_back(uchar_t{static_cast<uchar_t::int_type>(code_point)});
+        }
+
+        if (!is_extracted)
+            state |= std::ios_base::failbit;
+        is.setstate(state);
+        return (is);
+    }
+
+    template<typename allocatorT>
+    inline std::istream& getline(std::istream& is, generic_ustring<allocatorT>& str)
+    { return (getline(is, str, uchar_t{'\n'})); }
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_USTRING_IO_HPP)
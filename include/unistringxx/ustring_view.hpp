@@ -0,0 +1,364 @@
+#if !defined(UNISTRINGXX_USTRING_VIEW_HPP)
+#define UNISTRINGXX_USTRING_VIEW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "hash.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+#include "utils.hpp"
+
+namespace unistringxx
+{
+    ///
+    /// A non-owning, read-only reference to a contiguous sequence of Unicode code points (e.g. a whole or a part of a
+    /// generic_ustring). Views are cheap to copy and never allocate. The referenced storage must outlive the view.
+    ///
+    template<typename traitsT>
+    class generic_ustring_view
+    {
+    public:
+        typedef traitsT traits_type;
+        typedef typename traits_type::char_type char_type;
+        typedef char_type value_type;
+
+        typedef const char_type* pointer;
+        typedef const char_type* const_pointer;
+        typedef const char_type& reference;
+        typedef const char_type& const_reference;
+
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const char_type* iterator;
+        typedef const char_type* const_iterator;
+        typedef std::reverse_iterator<const_iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+        generic_ustring_view(void) noexcept :
+            _data{nullptr}, _size{0}
+        { return; }
+
+        generic_ustring_view(const char_type* cstr, size_type count) noexcept :
+            _data{cstr}, _size{count}
+        { return; }
+
+        generic_ustring_view(const char_type* cstr) :
+            generic_ustring_view{cstr, traits_type::length(cstr)}
+        { return; }
+
+        template<typename allocatorT>
+        generic_ustring_view(const generic_ustring<allocatorT>& str) noexcept :
+            generic_ustring_view{str.data(), str.size()}
+        { return; }
+
+        generic_ustring_view(const generic_ustring_view& other) noexcept = default;
+
+        generic_ustring_view& operator=(const generic_ustring_view& other) noexcept = default;
+
+        template<typename allocatorT>
+        explicit operator generic_ustring<allocatorT>(void) const
+        { return (generic_ustring<allocatorT>{this->cbegin(), this->cend()}); }
+
+        // UNISTRINGXX_USTRING_VIEW_ITERATORS
+
+        const_iterator begin(void) const noexcept
+        { return (_data); }
+
+        const_iterator cbegin(void) const noexcept
+        { return (_data); }
+
+        const_iterator end(void) const noexcept
+        { return (_data + _size); }
+
+        const_iterator cend(void) const noexcept
+        { return (_data + _size); }
+
+        const_reverse_iterator rbegin(void) const noexcept
+        { return (const_reverse_iterator{this->cend()}); }
+
+        const_reverse_iterator crbegin(void) const noexcept
+        { return (const_reverse_iterator{this->cend()}); }
+
+        const_reverse_iterator rend(void) const noexcept
+        { return (const_reverse_iterator{this->cbegin()}); }
+
+        const_reverse_iterator crend(void) const noexcept
+        { return (const_reverse_iterator{this->cbegin()}); }
+
+        // UNISTRINGXX_USTRING_VIEW_SIZES
+
+        size_type size(void) const noexcept
+        { return (_size); }
+
+        size_type length(void) const noexcept
+        { return (_size); }
+
+        size_type max_size(void) const noexcept
+        { return (std::numeric_limits<size_type>::max() / sizeof (char_type)); }
+
+        bool empty(void) const noexcept
+        { return (_size == 0); }
+
+        // UNISTRINGXX_USTRING_VIEW_ELEMENT_ACCESS
+
+        const_reference operator[](size_type index) const
+        { return (_data[index]); }
+
+        const_reference at(size_type index) const
+        {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+            if (index >= this->size())
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            return (_data[index]);
+        }
+
+        const_reference front(void) const
+        { return (_data[0]); }
+
+        const_reference back(void) const
+        { return (_data[_size - 1]); }
+
+        const_pointer data(void) const noexcept
+        { return (_data); }
+
+        // UNISTRINGXX_USTRING_VIEW_MODIFIERS
+
+        void remove_prefix(size_type count)
+        {
+            const size_type actual_count = std::min(count, _size);
+            _data += actual_count;
+            _size -= actual_count;
+            return;
+        }
+
+        void remove_suffix(size_type count)
+        {
+            _size -= std::min(count, _size);
+            return;
+        }
+
+        void swap(generic_ustring_view& other) noexcept
+        {
+            std::swap(_data, other._data);
+            std::swap(_size, other._size);
+            return;
+        }
+
+        // UNISTRINGXX_USTRING_VIEW_OPERATIONS
+
+        generic_ustring_view substr(size_type index = 0, size_type count = npos) const
+        {
+            if (index > this->size()) {
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+                UNISTRINGXX_THROW(std::out_of_range, "The 'index' argument is out of range.");
+#else // (UNISTRINGXX_WITH_EXCEPTIONS)
+                return (generic_ustring_view{});
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+            }
+            return (generic_ustring_view{_data + index, std::min(count, this->size() - index)});
+        }
+
+        int compare(generic_ustring_view str) const noexcept
+        {
+            const size_type compare_count = std::min(this->size(), str.size());
+            const int result = (compare_count == 0) ? 0 : traits_type::compare(this->data(), str.data(), compare_count);
+            if (result != 0)
+                return (result);
+            return ((this->size() == str.size()) ? 0 : ((this->size() < str.size()) ? -1 : 1));
+        }
+
+        size_type find(generic_ustring_view str, size_type index = 0) const noexcept
+        {
+            if ((index > this->size()) || (str.size() > (this->size() - index)))
+                return (npos);
+
+            const_iterator result = std::search(this->cbegin() + index, this->cend(), str.cbegin(), str.cend());
+            if ((result == this->cend()) && !str.empty())
+                return (npos);
+            return (static_cast<size_type>(result - this->cbegin()));
+        }
+
+        size_type find(char_type ch, size_type index = 0) const noexcept
+        {
+            if (index >= this->size())
+                return (npos);
+
+            const char_type* result = traits_type::find(_data + index, this->size() - index, ch);
+            return ((result == nullptr) ? npos : static_cast<size_type>(result - _data));
+        }
+
+        size_type rfind(generic_ustring_view str, size_type index = npos) const noexcept
+        {
+            if (str.size() > this->size())
+                return (npos);
+
+            const size_type start_index = std::min(index, this->size() - str.size());
+            for (size_type ctr = start_index + 1; ctr > 0; ctr--) {
+                if (std::equal(str.cbegin(), str.cend(), this->cbegin() + (ctr - 1)))
+                    return (ctr - 1);
+            }
+            return (npos);
+        }
+
+        size_type rfind(char_type ch, size_type index = npos) const noexcept
+        {
+            if (this->empty())
+                return (npos);
+
+            for (size_type ctr = std::min(index, this->size() - 1) + 1; ctr > 0; ctr--) {
+                if (traits_type::eq(_data[ctr - 1], ch))
+                    return (ctr - 1);
+            }
+            return (npos);
+        }
+
+        // Note: Same as generic_ustring, these are non-member friends so that either side may be implicitly converted
+        // from a generic_ustring.
+        friend bool operator==(generic_ustring_view left, generic_ustring_view right) noexcept
+        {
+            return (
+                (left.size() == right.size()) && code_points_equal(left.data(), right.data(), left.size())
+            );
+        }
+
+        friend bool operator!=(generic_ustring_view left, generic_ustring_view right) noexcept
+        { return (!(left == right)); }
+
+        friend bool operator<(generic_ustring_view left, generic_ustring_view right) noexcept
+        { return (left.compare(right) < 0); }
+
+        friend bool operator<=(generic_ustring_view left, generic_ustring_view right) noexcept
+        { return (left.compare(right) <= 0); }
+
+        friend bool operator>(generic_ustring_view left, generic_ustring_view right) noexcept
+        { return (left.compare(right) > 0); }
+
+        friend bool operator>=(generic_ustring_view left, generic_ustring_view right) noexcept
+        { return (left.compare(right) >= 0); }
+
+    private:
+        const char_type* _data;
+        size_type _size;
+    }; // class generic_ustring_view
+
+    template<typename traitsT>
+    constexpr typename generic_ustring_view<traitsT>::size_type generic_ustring_view<traitsT>::npos;
+
+    typedef generic_ustring_view<uchar_t_traits> ustring_view;
+
+    ///
+    /// Gets the number of octets of the UTF-8 encoding of a view (see generic_ustring::to_u8string()).
+    ///
+    inline std::size_t utf8_length_of(ustring_view str) noexcept
+    { return (utf8_length_of(str.data(), str.size())); }
+
+    ///
+    /// Gets the number of code units of the UTF-16 encoding of a view (see generic_ustring::to_u16string()).
+    ///
+    inline std::size_t utf16_length_of(ustring_view str) noexcept
+    { return (utf16_length_of(str.data(), str.size())); }
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        template<typename rangeT>
+        using range_iterator = decltype(std::declval<const rangeT&>().begin());
+
+        // Whether a type is a range of code points that is not contiguous (one that does not convert to ustring_view,
+        // e.g. a rope or a UTF range of utf_ranges.hpp).
+        template<typename rangeT, typename = void>
+        struct is_code_point_range :
+            public std::false_type
+        { };
+
+        template<typename rangeT>
+        struct is_code_point_range<
+            rangeT,
+            typename std::enable_if<
+                std::is_same<typename std::iterator_traits<range_iterator<rangeT>>::value_type, uchar_t>::value
+            >::type
+        > :
+            public std::integral_constant<bool, !std::is_convertible<const rangeT&, ustring_view>::value>
+        { };
+
+        template<typename rangeT>
+        inline bool range_equals(ustring_view text, const rangeT& range)
+        {
+            auto itr = range.begin();
+            const auto end = range.end();
+            for (uchar_t ch : text) {
+                if ((itr == end) || !(*itr == ch))
+                    return (false);
+                ++itr;
+            }
+            return (itr == end);
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Transparent hash function object for texts: accepts any generic_ustring or ustring_view with consistent
+    /// results, so that containers that support heterogeneous lookup (e.g. C++20 std::unordered_map) can find
+    /// generic_ustring keys by view without creating a temporary string. Ranges of code points that are not
+    /// contiguous (e.g. a utf8_range over an encoded buffer) hash the same as their code points.
+    ///
+    struct ustring_hash
+    {
+        typedef void is_transparent;
+
+        std::size_t operator()(ustring_view text) const noexcept
+        { return (static_cast<std::size_t>(hash_code_points(text.data(), text.size()))); }
+
+        template<typename rangeT>
+        typename std::enable_if<is_code_point_range<rangeT>::value, std::size_t>::type
+        operator()(const rangeT& range) const
+        { return (static_cast<std::size_t>(hash_code_points(range.begin(), range.end()))); }
+    };
+
+    ///
+    /// Transparent equality function object for texts, to be used with ustring_hash.
+    ///
+    struct ustring_equal_to
+    {
+        typedef void is_transparent;
+
+        bool operator()(ustring_view left, ustring_view right) const noexcept
+        { return (left == right); }
+
+        template<typename rangeT>
+        typename std::enable_if<is_code_point_range<rangeT>::value, bool>::type
+        operator()(ustring_view left, const rangeT& right) const
+        { return (range_equals(left, right)); }
+
+        template<typename rangeT>
+        typename std::enable_if<is_code_point_range<rangeT>::value, bool>::type
+        operator()(const rangeT& left, ustring_view right) const
+        { return (range_equals(right, left)); }
+    };
+
+} // namespace unistringxx
+
+namespace std
+{
+    // specialization of std::hash
+    template<typename traitsT>
+    struct hash<unistringxx::generic_ustring_view<traitsT>>
+    {
+        typedef std::size_t result_type;
+        typedef unistringxx::generic_ustring_view<traitsT> argument_type;
+
+        result_type operator()(argument_type key) const noexcept
+        { return (static_cast<result_type>(unistringxx::hash_code_points(key.data(), key.size()))); }
+    };
+} // namespace std
+
+#endif // !defined(UNISTRINGXX_USTRING_VIEW_HPP)
@@ -0,0 +1,387 @@
+#if !defined(UNISTRINGXX_UTF_CODECS_HPP)
+#define UNISTRINGXX_UTF_CODECS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "codec.hpp"
+#include "common.hpp"
+#include "uchar.hpp"
+#include "ustring.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    ///
+    /// A streaming decoder of UTF-16 (unitSizeT is 2) or UTF-32 (unitSizeT is 4) octets in either byte order. The
+    /// input can be given in chunks of any size: a code unit or a surrogate pair split between two chunks is kept
+    /// until the next one. A byte order mark at the start of the stream is removed (when the byte order is unknown,
+    /// it also gives the byte order). Use the utf16_decoder and utf32_decoder type definitions.
+    ///
+    template<std::size_t unitSizeT>
+    class basic_utf_decoder
+    {
+        static_assert((unitSizeT == 2) || (unitSizeT == 4), "UTF decoders read 16-bit or 32-bit code units.");
+
+    public:
+        explicit basic_utf_decoder(
+            byte_order order = byte_order::unknown, codec_error_policy policy = codec_error_policy::strict
+        ) noexcept :
+            _initial_order{order}, _order{order}, _policy{policy}, _is_started{false}, _pending{}, _pending_size{0}
+        { return; }
+
+        ///
+        /// Gets the byte order of the stream (which is known once the first code unit is decoded).
+        ///
+        byte_order order(void) const noexcept
+        { return (_order); }
+
+        codec_error_policy error_policy(void) const noexcept
+        { return (_policy); }
+
+        ///
+        /// Decodes the next chunk of the stream, appending the code points to str.
+        ///
+        template<typename allocatorT>
+        void decode(const void* data, std::size_t size, generic_ustring<allocatorT>& str)
+        {
+            const std::uint8_t* first = static_cast<const std::uint8_t*>(data);
+            const std::uint8_t* last = first + size;
+            // Each code unit gives at most one code point.
+            const std::size_t maximum_count = (_pending_size + size) / unitSizeT;
+            uchar_t* out = begin_decode(str, maximum_count);
+            std::size_t count = 0;
+            bool is_decoded = true;
+
+            if ((_pending_size > 0) && (first != last)) {
+                // Complete the pending code unit (or surrogate pair) with the start of this chunk.
+                std::uint8_t buffer[2 * _s_pending_capacity];
+                const std::size_t pending_size = _pending_size;
+                const std::size_t copy_size = std::min(size, sizeof (buffer) - pending_size);
+                std::memcpy(buffer, _pending, pending_size);
+                std::memcpy(buffer + pending_size, first, copy_size);
+                const std::uint8_t* stop = this->decode_units(
+                    buffer, buffer + pending_size + copy_size, out, count, is_decoded
+                );
+                const std::size_t consumed = static_cast<std::size_t>(stop - buffer);
+                if (!is_decoded) {
+                    // The error is reported below.
+                }
+                else if (consumed < pending_size) {
+                    // Still incomplete: the whole chunk was too short, and what is left is shorter than a surrogate
+                    // pair.
+                    _pending_size = pending_size + copy_size - consumed;
+                    std::memcpy(_pending, stop, _pending_size);
+                    first = last;
+                }
+                else {
+                    first += consumed - pending_size;
+                    _pending_size = 0;
+                }
+            }
+            if (is_decoded && (_pending_size == 0)) {
+                const std::uint8_t* stop = this->decode_units(first, last, out, count, is_decoded);
+                _pending_size = static_cast<std::size_t>(last - stop);
+                std::memcpy(_pending, stop, is_decoded ? _pending_size : 0);
+            }
+
+            end_decode(str, maximum_count, count);
+            if (!is_decoded) {
+                this->reset();
+                throw_decode_error();
+            }
+            return;
+        }
+
+        ///
+        /// Ends the stream: an incomplete code unit (or surrogate pair) at the end is an error. The decoder is then
+        /// ready for a new stream.
+        ///
+        template<typename allocatorT>
+        void finish(generic_ustring<allocatorT>& str)
+        {
+            const bool is_truncated = (_pending_size > 0);
+            this->reset();
+            if (!is_truncated)
+                return;
+            uchar_t* out = begin_decode(str, 1);
+            std::size_t count = 0;
+            const bool is_decoded = put_decode_error(_policy, out, count);
+            end_decode(str, 1, count);
+            if (!is_decoded)
+                throw_decode_error();
+            return;
+        }
+
+        void reset(void) noexcept
+        {
+            _order = _initial_order;
+            _is_started = false;
+            _pending_size = 0;
+            return;
+        }
+
+    private:
+        // A surrogate pair is the longest sequence.
+        static const std::size_t _s_pending_capacity = 4;
+
+        byte_order _initial_order;
+        byte_order _order;
+        codec_error_policy _policy;
+        bool _is_started;
+        std::uint8_t _pending[_s_pending_capacity];
+        std::size_t _pending_size;
+
+        // Removes the byte order mark at the start of the stream, if any. Returns the first octet of the text, or
+        // nullptr if there are not enough octets to tell.
+        const std::uint8_t* start(const std::uint8_t* first, const std::uint8_t* last) noexcept
+        {
+            if (static_cast<std::size_t>(last - first) < unitSizeT)
+                return (nullptr);
+            _is_started = true;
+            byte_order bom_order = byte_order::unknown;
+            if ((unitSizeT == 2) ? (read_unit16(first, true) == 0xFEFF) : (read_unit32(first, true) == 0xFEFF))
+                bom_order = byte_order::big_endian;
+            else if ((unitSizeT == 2) ? (read_unit16(first, false) == 0xFEFF) : (read_unit32(first, false) == 0xFEFF))
+                bom_order = byte_order::little_endian;
+
+            if (_order == byte_order::unknown)
+                _order = (bom_order == byte_order::unknown) ? byte_order::big_endian : bom_order;
+            else if (bom_order != _order)
+                return (first);
+            return ((bom_order == byte_order::unknown) ? first : (first + unitSizeT));
+        }
+
+        // Decodes the complete code units of [first, last). Returns the first octet that is not decoded (the start of
+        // an incomplete code unit or surrogate pair, or the error if is_decoded is set to false).
+        const std::uint8_t* decode_units(
+            const std::uint8_t* first, const std::uint8_t* last, uchar_t* out, std::size_t& count, bool& is_decoded
+        )
+        {
+            if (!_is_started) {
+                const std::uint8_t* text = this->start(first, last);
+                if (text == nullptr)
+                    return (first);
+                first = text;
+            }
+            if (unitSizeT == 2)
+                return (this->decode_utf16(first, last, out, count, is_decoded));
+            return (this->decode_utf32(first, last, out, count, is_decoded));
+        }
+
+        const std::uint8_t* decode_utf16(
+            const std::uint8_t* first, const std::uint8_t* last, uchar_t* out, std::size_t& count, bool& is_decoded
+        )
+        {
+            const bool is_big_endian = (_order == byte_order::big_endian);
+            while ((last - first) >= 2) {
+#if (UNISTRINGXX_HAS_SSE2)
+                // 8 code units without surrogates at a time.
+                if ((last - first) >= 16) {
+                    const __m128i units = load_units16(first, is_big_endian);
+                    const __m128i surrogates = _mm_cmpeq_epi16(
+                        _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xF800))),
+                        _mm_set1_epi16(static_cast<short>(0xD800))
+                    );
+                    if (_mm_movemask_epi8(surrogates) == 0) {
+                        std::uint16_t values[8];
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(values), units);
+                        for (std::size_t ctr = 0; ctr < 8; ctr++)
+                            out[count + ctr] = uchar_t{static_cast<uchar_t::int_type>(values[ctr])};
+                        count += 8;
+                        first += 16;
+                        continue;
+                    }
+                }
+#endif // (UNISTRINGXX_HAS_SSE2)
+                const std::uint32_t unit = read_unit16(first, is_big_endian);
+                if ((unit < 0xD800) || (unit > 0xDFFF)) {
+                    out[count++] = uchar_t{static_cast<uchar_t::int_type>(unit)};
+                    first += 2;
+                    continue;
+                }
+                if (unit <= 0xDBFF) {
+                    if ((last - first) < 4)
+                        break;
+                    const std::uint32_t low_unit = read_unit16(first + 2, is_big_endian);
+                    if ((low_unit >= 0xDC00) && (low_unit <= 0xDFFF)) {
+                        const std::uint32_t code_point = 0x10000 + ((unit - 0xD800) << 10) + (low_unit - 0xDC00);
+                        out[count++] = uchar_t{static_cast<uchar_t::int_type>(code_point)};
+                        first += 4;
+                        continue;
+                    }
+                }
+                // An unpaired surrogate (the code unit after it is decoded normally).
+                if (!put_decode_error(_policy, out, count)) {
+                    is_decoded = false;
+                    break;
+                }
+                first += 2;
+            }
+            return (first);
+        }
+
+        const std::uint8_t* decode_utf32(
+            const std::uint8_t* first, const std::uint8_t* last, uchar_t* out, std::size_t& count, bool& is_decoded
+        )
+        {
+            const bool is_big_endian = (_order == byte_order::big_endian);
+            while ((last - first) >= 4) {
+#if (UNISTRINGXX_HAS_SSE2)
+                // 4 scalar values at a time (the comparisons are signed, so the values must not be negative).
+                if ((last - first) >= 16) {
+                    const __m128i units = load_units32(first, is_big_endian);
+                    const __m128i below_surrogates = _mm_and_si128(
+                        _mm_cmpgt_epi32(units, _mm_set1_epi32(-1)), _mm_cmplt_epi32(units, _mm_set1_epi32(0xD800))
+                    );
+                    const __m128i above_surrogates = _mm_and_si128(
+                        _mm_cmpgt_epi32(units, _mm_set1_epi32(0xDFFF)), _mm_cmplt_epi32(units, _mm_set1_epi32(0x110000))
+                    );
+                    if (_mm_movemask_epi8(_mm_or_si128(below_surrogates, above_surrogates)) == 0xFFFF) {
+                        std::uint32_t values[4];
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(values), units);
+                        for (std::size_t ctr = 0; ctr < 4; ctr++)
+                            out[count + ctr] = uchar_t{static_cast<uchar_t::int_type>(values[ctr])};
+                        count += 4;
+                        first += 16;
+                        continue;
+                    }
+                }
+#endif // (UNISTRINGXX_HAS_SSE2)
+                const std::uint32_t unit = read_unit32(first, is_big_endian);
+                if (is_scalar_value(unit)) {
+                    out[count++] = uchar_t{static_cast<uchar_t::int_type>(unit)};
+                }
+                else if (!put_decode_error(_policy, out, count)) {
+                    is_decoded = false;
+                    break;
+                }
+                first += 4;
+            }
+            return (first);
+        }
+    }; // class basic_utf_decoder
+
+    typedef basic_utf_decoder<2> utf16_decoder;
+    typedef basic_utf_decoder<4> utf32_decoder;
+
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // Encodes the code points of str as UTF-16 (unit_size 2) or UTF-32 (unit_size 4), after a byte order mark if
+        // requested.
+        inline void encode_utf(
+            ustring_view str, std::vector<std::uint8_t>& out, std::size_t unit_size, byte_order order, bool with_bom,
+            codec_error_policy policy
+        )
+        {
+            const bool is_big_endian = (order != byte_order::little_endian);
+            const std::size_t start = out.size();
+            // At most 4 octets per code point in both encodings.
+            out.resize(start + ((str.size() + (with_bom ? 1 : 0)) * 4));
+            std::uint8_t* data = out.data() + start;
+            std::size_t size = 0;
+            if (with_bom) {
+                if (unit_size == 2)
+                    write_unit16(data, _s_byte_order_mark, is_big_endian);
+                else
+                    write_unit32(data, _s_byte_order_mark, is_big_endian);
+                size = unit_size;
+            }
+
+            bool is_encoded = true;
+            for (uchar_t ch : str) {
+                std::uint32_t code_point = static_cast<std::uint32_t>(ch.code_point());
+                if (!ch.is_valid()) {
+                    if (is_encode_error_fatal(policy)) {
+                        is_encoded = false;
+                        break;
+                    }
+                    if (policy != codec_error_policy::replace)
+                        continue;
+                    code_point = _s_replacement_character;
+                }
+                if (unit_size == 4) {
+                    write_unit32(data + size, code_point, is_big_endian);
+                    size += 4;
+                }
+                else if (code_point < 0x10000) {
+                    write_unit16(data + size, code_point, is_big_endian);
+                    size += 2;
+                }
+                else {
+                    write_unit16(data + size, 0xD800 + ((code_point - 0x10000) >> 10), is_big_endian);
+                    write_unit16(data + size + 2, 0xDC00 + ((code_point - 0x10000) & 0x3FF), is_big_endian);
+                    size += 4;
+                }
+            }
+            out.resize(start + size);
+            if (!is_encoded)
+                throw_encode_error();
+            return;
+        }
+
+        template<typename decoderT>
+        inline ustring decode_all(const void* data, std::size_t size, byte_order order, codec_error_policy policy)
+        {
+            ustring result;
+            decoderT decoder{order, policy};
+            decoder.decode(data, size, result);
+            decoder.finish(result);
+            return (result);
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Decodes UTF-16 octets in the given byte order (or, if it is unknown, in the byte order of the byte order mark,
+    /// big endian by default). A byte order mark at the start is removed.
+    ///
+    inline ustring decode_utf16(
+        const void* data, std::size_t size, byte_order order = byte_order::unknown,
+        codec_error_policy policy = codec_error_policy::strict
+    )
+    { return (decode_all<utf16_decoder>(data, size, order, policy)); }
+
+    ///
+    /// Decodes UTF-32 octets in the given byte order (or, if it is unknown, in the byte order of the byte order mark,
+    /// big endian by default). A byte order mark at the start is removed.
+    ///
+    inline ustring decode_utf32(
+        const void* data, std::size_t size, byte_order order = byte_order::unknown,
+        codec_error_policy policy = codec_error_policy::strict
+    )
+    { return (decode_all<utf32_decoder>(data, size, order, policy)); }
+
+    ///
+    /// Appends str encoded as UTF-16 in the given byte order (big endian if it is unknown) to out, optionally after a
+    /// byte order mark.
+    ///
+    inline void encode_utf16(
+        ustring_view str, std::vector<std::uint8_t>& out, byte_order order = byte_order::big_endian,
+        bool with_bom = false, codec_error_policy policy = codec_error_policy::strict
+    )
+    {
+        encode_utf(str, out, 2, order, with_bom, policy);
+        return;
+    }
+
+    ///
+    /// Appends str encoded as UTF-32 in the given byte order (big endian if it is unknown) to out, optionally after a
+    /// byte order mark.
+    ///
+    inline void encode_utf32(
+        ustring_view str, std::vector<std::uint8_t>& out, byte_order order = byte_order::big_endian,
+        bool with_bom = false, codec_error_policy policy = codec_error_policy::strict
+    )
+    {
+        encode_utf(str, out, 4, order, with_bom, policy);
+        return;
+    }
+
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_UTF_CODECS_HPP)
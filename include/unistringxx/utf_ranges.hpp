@@ -0,0 +1,317 @@
+#if !defined(UNISTRINGXX_UTF_RANGES_HPP)
+#define UNISTRINGXX_UTF_RANGES_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+#include "codec.hpp"
+#include "common.hpp"
+#include "hash.hpp"
+#include "uchar.hpp"
+#include "ustring_view.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+        // The functions below decode the code point at first, storing U+FFFD for an invalid sequence (which then
+        // spans a single code unit). They return the number of code units read.
+
+        inline std::size_t decode_utf_units(const char* first, const char* last, std::uint32_t& code_point) noexcept
+        {
+            const std::uint8_t* octets = reinterpret_cast<const std::uint8_t*>(first);
+            if (*octets < 0x80) {
+                code_point = *octets;
+                return (1);
+            }
+            const std::size_t size = decode_utf8(octets, reinterpret_cast<const std::uint8_t*>(last), code_point);
+            if (size != 0)
+                return (size);
+            code_point = _s_replacement_character;
+            return (1);
+        }
+
+        inline std::size_t decode_utf_units(const char16_t* first, const char16_t* last, std::uint32_t& code_point)
+            noexcept
+        {
+            const std::uint32_t unit = static_cast<std::uint32_t>(*first);
+            if ((unit < 0xD800) || (unit > 0xDFFF)) {
+                code_point = unit;
+                return (1);
+            }
+            const std::uint32_t next = ((last - first) >= 2) ? static_cast<std::uint32_t>(first[1]) : 0;
+            if ((unit < 0xDC00) && (next >= 0xDC00) && (next <= 0xDFFF)) {
+                code_point = 0x10000 + ((unit - 0xD800) << 10) + (next - 0xDC00);
+                return (2);
+            }
+            code_point = _s_replacement_character;
+            return (1);
+        }
+
+        inline std::size_t decode_utf_units(const char32_t* first, const char32_t* last, std::uint32_t& code_point)
+            noexcept
+        {
+            static_cast<void>(last);
+            const std::uint32_t unit = static_cast<std::uint32_t>(*first);
+            code_point = is_scalar_value(unit) ? unit : _s_replacement_character;
+            return (1);
+        }
+
+        // The functions below get the number of code units of the code point that ends at position (after first).
+        // They resynchronize like the forward decoding: a sequence counts only if it decodes from its first code unit
+        // to position, otherwise the code unit before position is an invalid sequence on its own.
+
+        inline std::size_t get_previous_utf_size(const char* first, const char* position, const char* last) noexcept
+        {
+            const std::size_t max_size = std::min<std::size_t>(position - first, _s_utf8_max_sequence_size);
+            for (std::size_t size = 1; size <= max_size; size++) {
+                const char* start = position - size;
+                // Skip the continuation octets back to the first octet of the sequence.
+                if ((static_cast<std::uint8_t>(*start) & 0xC0) == 0x80)
+                    continue;
+                std::uint32_t code_point = 0;
+                return ((decode_utf_units(start, last, code_point) == size) ? size : 1);
+            }
+            return (1);
+        }
+
+        inline std::size_t get_previous_utf_size(const char16_t* first, const char16_t* position, const char16_t* last)
+            noexcept
+        {
+            static_cast<void>(last);
+            if ((position - first) < 2)
+                return (1);
+            const std::uint32_t unit = static_cast<std::uint32_t>(position[-1]);
+            const std::uint32_t previous = static_cast<std::uint32_t>(position[-2]);
+            const bool is_pair = ((unit >= 0xDC00) && (unit <= 0xDFFF) && (previous >= 0xD800) && (previous < 0xDC00));
+            return (is_pair ? 2 : 1);
+        }
+
+        inline std::size_t get_previous_utf_size(const char32_t* first, const char32_t* position, const char32_t* last)
+            noexcept
+        {
+            static_cast<void>(first);
+            static_cast<void>(position);
+            static_cast<void>(last);
+            return (1);
+        }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// A bidirectional iterator over the code points of a UTF-8 (char), UTF-16 (char16_t) or UTF-32 (char32_t)
+    /// buffer in native byte order, which decodes them as it goes: nothing is allocated or decoded in advance. An
+    /// invalid code unit is read as U+FFFD (like codec_error_policy::replace, one per code unit), and iterating
+    /// backwards gives the same code points as iterating forwards. The code points are returned by value.
+    ///
+    template<typename unitT>
+    class basic_utf_iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef uchar_t value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const uchar_t* pointer;
+        typedef uchar_t reference;
+
+        basic_utf_iterator(void) noexcept :
+            _first{nullptr}, _position{nullptr}, _last{nullptr}
+        { return; }
+
+        ///
+        /// Creates an iterator at position within the buffer [first, last). position must be at the start of a code
+        /// point (e.g. a position given by base()).
+        ///
+        basic_utf_iterator(const unitT* first, const unitT* position, const unitT* last) noexcept :
+            _first{first}, _position{position}, _last{last}
+        { return; }
+
+        reference operator*(void) const noexcept
+        {
+            std::uint32_t code_point = 0;
+            decode_utf_units(_position, _last, code_point);
+            return (uchar_t{static_cast<uchar_t::int_type>(code_point)});
+        }
+
+        basic_utf_iterator& operator++(void) noexcept
+        {
+            std::uint32_t code_point = 0;
+            _position += decode_utf_units(_position, _last, code_point);
+            return (*this);
+        }
+
+        basic_utf_iterator operator++(int) noexcept
+        {
+            basic_utf_iterator result{*this};
+            ++(*this);
+            return (result);
+        }
+
+        basic_utf_iterator& operator--(void) noexcept
+        {
+            _position -= get_previous_utf_size(_first, _position, _last);
+            return (*this);
+        }
+
+        basic_utf_iterator operator--(int) noexcept
+        {
+            basic_utf_iterator result{*this};
+            --(*this);
+            return (result);
+        }
+
+        ///
+        /// Gets the position of the code point in the buffer.
+        ///
+        const unitT* base(void) const noexcept
+        { return (_position); }
+
+        friend bool operator==(const basic_utf_iterator& left, const basic_utf_iterator& right) noexcept
+        { return (left._position == right._position); }
+
+        friend bool operator!=(const basic_utf_iterator& left, const basic_utf_iterator& right) noexcept
+        { return (left._position != right._position); }
+
+    private:
+        const unitT* _first;
+        const unitT* _position;
+        const unitT* _last;
+    }; // class basic_utf_iterator
+
+    ///
+    /// The code points of a UTF-8, UTF-16 or UTF-32 buffer (see basic_utf_iterator), to be passed to the algorithms
+    /// that take ranges of code points (the standard algorithms, hash_code_points(), ustring_hash, ustring_equal_to,
+    /// compare_code_points() and find_code_points()) without decoding the buffer into a generic_ustring. The buffer
+    /// must outlive the range.
+    ///
+    template<typename unitT>
+    class basic_utf_range
+    {
+    public:
+        typedef unitT unit_type;
+        typedef basic_utf_iterator<unitT> iterator;
+        typedef basic_utf_iterator<unitT> const_iterator;
+        typedef std::reverse_iterator<const_iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        basic_utf_range(void) noexcept :
+            _units{nullptr}, _unit_count{0}
+        { return; }
+
+        basic_utf_range(const unitT* units, std::size_t unit_count) noexcept :
+            _units{units}, _unit_count{unit_count}
+        { return; }
+
+        ///
+        /// Creates a range over a null-terminated string (without the terminator).
+        ///
+        basic_utf_range(const unitT* str) noexcept :
+            _units{str}, _unit_count{std::char_traits<unitT>::length(str)}
+        { return; }
+
+        template<typename traitsT, typename allocatorT>
+        basic_utf_range(const std::basic_string<unitT, traitsT, allocatorT>& str) noexcept :
+            _units{str.data()}, _unit_count{str.size()}
+        { return; }
+
+        const_iterator begin(void) const noexcept
+        { return (const_iterator{_units, _units, _units + _unit_count}); }
+
+        const_iterator cbegin(void) const noexcept
+        { return (this->begin()); }
+
+        const_iterator end(void) const noexcept
+        { return (const_iterator{_units, _units + _unit_count, _units + _unit_count}); }
+
+        const_iterator cend(void) const noexcept
+        { return (this->end()); }
+
+        const_reverse_iterator rbegin(void) const noexcept
+        { return (const_reverse_iterator{this->end()}); }
+
+        const_reverse_iterator crbegin(void) const noexcept
+        { return (const_reverse_iterator{this->end()}); }
+
+        const_reverse_iterator rend(void) const noexcept
+        { return (const_reverse_iterator{this->begin()}); }
+
+        const_reverse_iterator crend(void) const noexcept
+        { return (const_reverse_iterator{this->begin()}); }
+
+        bool empty(void) const noexcept
+        { return (_unit_count == 0); }
+
+        const unitT* units(void) const noexcept
+        { return (_units); }
+
+        ///
+        /// Gets the number of code units (the number of code points is std::distance(begin(), end())).
+        ///
+        std::size_t unit_count(void) const noexcept
+        { return (_unit_count); }
+
+    private:
+        const unitT* _units;
+        std::size_t _unit_count;
+    }; // class basic_utf_range
+
+    typedef basic_utf_iterator<char> utf8_iterator;
+    typedef basic_utf_iterator<char16_t> utf16_iterator;
+    typedef basic_utf_iterator<char32_t> utf32_iterator;
+
+    typedef basic_utf_range<char> utf8_range;
+    typedef basic_utf_range<char16_t> utf16_range;
+    typedef basic_utf_range<char32_t> utf32_range;
+
+    ///
+    /// Compares two ranges of code points (e.g. generic_ustring, ustring_view, rope or the UTF ranges) like
+    /// generic_ustring::compare(). Returns a negative value, 0 or a positive value if left is less than, equal to or
+    /// greater than right.
+    ///
+    template<typename leftRangeT, typename rightRangeT>
+    inline int compare_code_points(const leftRangeT& left, const rightRangeT& right)
+    {
+        auto left_itr = left.begin();
+        const auto left_end = left.end();
+        auto right_itr = right.begin();
+        const auto right_end = right.end();
+        for (; (left_itr != left_end) && (right_itr != right_end); ++left_itr, ++right_itr) {
+            const uchar_t left_ch = *left_itr;
+            const uchar_t right_ch = *right_itr;
+            if (left_ch != right_ch)
+                return ((left_ch < right_ch) ? -1 : 1);
+        }
+        if (left_itr != left_end)
+            return (1);
+        return ((right_itr != right_end) ? -1 : 0);
+    }
+
+    ///
+    /// Checks whether two ranges of code points are equal.
+    ///
+    template<typename leftRangeT, typename rightRangeT>
+    inline bool equal_code_points(const leftRangeT& left, const rightRangeT& right)
+    { return (compare_code_points(left, right) == 0); }
+
+    ///
+    /// Finds a text in a range of code points. Returns an iterator to the first match, or range.end() if there is none
+    /// (the position of a match in the buffer of a UTF range is given by its base()).
+    ///
+    template<typename rangeT>
+    inline auto find_code_points(const rangeT& range, ustring_view str) -> decltype(range.begin())
+    { return (std::search(range.begin(), range.end(), str.begin(), str.end())); }
+
+    ///
+    /// Finds a code point in a range of code points. Returns an iterator to the first match, or range.end() if there
+    /// is none.
+    ///
+    template<typename rangeT>
+    inline auto find_code_points(const rangeT& range, uchar_t ch) -> decltype(range.begin())
+    { return (std::find(range.begin(), range.end(), ch)); }
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_UTF_RANGES_HPP)
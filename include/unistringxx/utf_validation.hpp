@@ -0,0 +1,433 @@
+#if !defined(UNISTRINGXX_UTF_VALIDATION_HPP)
+#define UNISTRINGXX_UTF_VALIDATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "common.hpp"
+#include "uchar.hpp"
+
+namespace unistringxx
+{
+    /// @internal
+    namespace // ImplementationDetail
+    {
+#if (UNISTRINGXX_HAS_SSE2)
+        // The number of 16-octet blocks that are counted in 8-bit lanes before they overflow (a multiple of 4, as
+        // they are counted 4 at a time).
+        const std::size_t _s_count_blocks8 = 252;
+        // The number of 8-unit blocks that are counted in 16-bit lanes before they overflow.
+        const std::size_t _s_count_blocks16 = 65535;
+        // The number of groups of 4 code points whose lengths are summed in 32-bit lanes before they are added up.
+        const std::size_t _s_length_groups = 1 << 20;
+
+        // Adds up the (unsigned) 16-bit lanes of counts.
+        inline std::size_t sum_lanes16(__m128i counts) noexcept
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i sums = _mm_add_epi32(_mm_unpacklo_epi16(counts, zero), _mm_unpackhi_epi16(counts, zero));
+            std::uint32_t values[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(values), sums);
+            return (static_cast<std::size_t>(values[0]) + values[1] + values[2] + values[3]);
+        }
+
+        // Adds up the 32-bit lanes of sums.
+        inline std::size_t sum_lanes32(__m128i sums) noexcept
+        {
+            std::uint32_t values[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(values), sums);
+            return (static_cast<std::size_t>(values[0]) + values[1] + values[2] + values[3]);
+        }
+
+        // The number of code points whose storage covers the 16 octets that load_code_points() reads.
+        const std::size_t _s_code_point_load_size = (16 + sizeof (uchar_t) - 1) / sizeof (uchar_t);
+
+        // Loads 4 code points into 32-bit lanes, straight from their storage.
+        inline __m128i load_code_points(const uchar_t* data) noexcept
+        {
+            const __m128i octets = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+#if !(UNISTRINGXX_TEST)
+            // uint24_t: 3 octets each, least significant first, so code point n starts n octets before lane n.
+            static_assert(sizeof (uchar_t) == 3, "Code points are stored in 3 octets.");
+            const __m128i lane0 = _mm_and_si128(octets, _mm_setr_epi32(0xFFFFFF, 0, 0, 0));
+            const __m128i lane1 = _mm_and_si128(_mm_slli_si128(octets, 1), _mm_setr_epi32(0, 0xFFFFFF, 0, 0));
+            const __m128i lane2 = _mm_and_si128(_mm_slli_si128(octets, 2), _mm_setr_epi32(0, 0, 0xFFFFFF, 0));
+            const __m128i lane3 = _mm_and_si128(_mm_slli_si128(octets, 3), _mm_setr_epi32(0, 0, 0, 0xFFFFFF));
+            return (_mm_or_si128(_mm_or_si128(lane0, lane1), _mm_or_si128(lane2, lane3)));
+#else // !(UNISTRINGXX_TEST)
+            static_assert(sizeof (uchar_t) == 4, "Code points are stored in 4 octets.");
+            return (octets);
+#endif // !(UNISTRINGXX_TEST)
+        }
+
+        // Gets the lanes that hold a Unicode scalar value (the comparisons are signed, so the values must not be
+        // negative).
+        inline __m128i get_scalar_values(__m128i code_points) noexcept
+        {
+            const __m128i in_range = _mm_and_si128(
+                _mm_cmpgt_epi32(code_points, _mm_set1_epi32(-1)),
+                _mm_cmplt_epi32(code_points, _mm_set1_epi32(0x110000))
+            );
+            const __m128i surrogates = _mm_and_si128(
+                _mm_cmpgt_epi32(code_points, _mm_set1_epi32(0xD7FF)),
+                _mm_cmplt_epi32(code_points, _mm_set1_epi32(0xE000))
+            );
+            return (_mm_andnot_si128(surrogates, in_range));
+        }
+
+        // Gets the octets shiftT positions before those of block (the first ones being the last ones of previous).
+        template<int shiftT>
+        inline __m128i get_previous_octets(__m128i block, __m128i previous) noexcept
+        { return (_mm_or_si128(_mm_slli_si128(block, shiftT), _mm_srli_si128(previous, 16 - shiftT))); }
+
+        // Gets the octets within [low, high], where 0x80 < low <= high <= 0xFF (the comparisons are signed, so
+        // these octets are negative).
+        inline __m128i get_octets_in_range(__m128i octets, int low, int high) noexcept
+        {
+            return (_mm_and_si128(
+                _mm_cmpgt_epi8(octets, _mm_set1_epi8(static_cast<char>(low - 0x100 - 1))),
+                _mm_cmplt_epi8(octets, _mm_set1_epi8(static_cast<char>(high - 0x100 + 1)))
+            ));
+        }
+
+        // Checks 16 octets of UTF-8, given the 16 octets before them (for the sequences that start there). Returns
+        // a mask of the octets in error, which is empty if the octets are valid so far (a sequence at the end may
+        // still be cut by the next block).
+        inline __m128i check_utf8_block(__m128i block, __m128i previous) noexcept
+        {
+            const __m128i previous1 = get_previous_octets<1>(block, previous);
+            const __m128i previous2 = get_previous_octets<2>(block, previous);
+            const __m128i previous3 = get_previous_octets<3>(block, previous);
+            // The continuation octets (0x80 to 0xBF) must be the ones that the leading octets before them call for.
+            const __m128i continuations = _mm_cmplt_epi8(block, _mm_set1_epi8(static_cast<char>(0xC0 - 0x100)));
+            const __m128i expected = _mm_or_si128(
+                _mm_or_si128(get_octets_in_range(previous1, 0xC0, 0xFF), get_octets_in_range(previous2, 0xE0, 0xFF)),
+                get_octets_in_range(previous3, 0xF0, 0xFF)
+            );
+            __m128i errors = _mm_xor_si128(continuations, expected);
+            // The octets that never appear: 0xC0 and 0xC1 (overlong forms), and 0xF5 to 0xFF.
+            errors = _mm_or_si128(errors, get_octets_in_range(block, 0xC0, 0xC1));
+            errors = _mm_or_si128(errors, get_octets_in_range(block, 0xF5, 0xFF));
+            // The second octet after 0xE0 (overlong forms), 0xED (surrogates), 0xF0 (overlong forms) and 0xF4
+            // (values above U+10FFFF).
+            errors = _mm_or_si128(errors, _mm_and_si128(
+                _mm_cmpeq_epi8(previous1, _mm_set1_epi8(static_cast<char>(0xE0 - 0x100))),
+                _mm_cmplt_epi8(block, _mm_set1_epi8(static_cast<char>(0xA0 - 0x100)))
+            ));
+            errors = _mm_or_si128(errors, _mm_and_si128(
+                _mm_cmpeq_epi8(previous1, _mm_set1_epi8(static_cast<char>(0xED - 0x100))),
+                _mm_cmpgt_epi8(block, _mm_set1_epi8(static_cast<char>(0x9F - 0x100)))
+            ));
+            errors = _mm_or_si128(errors, _mm_and_si128(
+                _mm_cmpeq_epi8(previous1, _mm_set1_epi8(static_cast<char>(0xF0 - 0x100))),
+                _mm_cmplt_epi8(block, _mm_set1_epi8(static_cast<char>(0x90 - 0x100)))
+            ));
+            errors = _mm_or_si128(errors, _mm_and_si128(
+                _mm_cmpeq_epi8(previous1, _mm_set1_epi8(static_cast<char>(0xF4 - 0x100))),
+                _mm_cmpgt_epi8(block, _mm_set1_epi8(static_cast<char>(0x8F - 0x100)))
+            ));
+            return (errors);
+        }
+#endif // (UNISTRINGXX_HAS_SSE2)
+
+        // Skips the ASCII octets of [first, last), 64 then 16 octets at a time with SSE2, otherwise 8 at a time.
+        // Returns the first octet that is not ASCII, or last.
+        inline const std::uint8_t* skip_ascii(const std::uint8_t* first, const std::uint8_t* last) noexcept
+        {
+#if (UNISTRINGXX_HAS_SSE2)
+            for (; (last - first) >= 64; first += 64) {
+                const __m128i block0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                const __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 16));
+                const __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 32));
+                const __m128i block3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 48));
+                const __m128i blocks = _mm_or_si128(_mm_or_si128(block0, block1), _mm_or_si128(block2, block3));
+                if (_mm_movemask_epi8(blocks) != 0)
+                    break;
+            }
+            for (; (last - first) >= 16; first += 16) {
+                const std::uint32_t mask = static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)))
+                );
+                if (mask != 0)
+                    return (first + count_trailing_zeros(mask));
+            }
+#else // (UNISTRINGXX_HAS_SSE2)
+            for (; (last - first) >= 8; first += 8) {
+                std::uint64_t block = 0;
+                std::memcpy(&block, first, sizeof (block));
+                if ((block & 0x8080808080808080ULL) != 0)
+                    break;
+            }
+#endif // (UNISTRINGXX_HAS_SSE2)
+            while ((first != last) && (*first < 0x80))
+                ++first;
+            return (first);
+        }
+
+        // Checks the UTF-8 sequence that starts with the non-ASCII octet at first, without decoding it: the range of
+        // the second octet depends on the first one (RFC 3629), which rules out the overlong forms, the surrogates
+        // and the values above U+10FFFF. Returns the size of the sequence, or 0 if it is invalid or truncated.
+        inline std::size_t check_utf8_sequence(const std::uint8_t* first, const std::uint8_t* last) noexcept
+        {
+            const std::uint8_t lead = *first;
+            const std::size_t size = utf8_sequence_size(lead);
+            if ((size == 0) || (static_cast<std::size_t>(last - first) < size))
+                return (0);
+            std::uint8_t low = 0x80;
+            std::uint8_t high = 0xBF;
+            if (lead == 0xE0)
+                low = 0xA0;
+            else if (lead == 0xED)
+                high = 0x9F;
+            else if (lead == 0xF0)
+                low = 0x90;
+            else if (lead == 0xF4)
+                high = 0x8F;
+            if ((first[1] < low) || (first[1] > high))
+                return (0);
+            for (std::size_t ctr = 2; ctr < size; ctr++) {
+                if ((first[ctr] & 0xC0) != 0x80)
+                    return (0);
+            }
+            return (size);
+        }
+
+        // Checks whether a UTF-16 code unit is a surrogate.
+        inline bool is_utf16_surrogate(char16_t unit) noexcept
+        { return ((unit & 0xF800) == 0xD800); }
+    } // namespace // ImplementationDetail
+    /// @endinternal
+
+    ///
+    /// Validates UTF-8 octets (RFC 3629: no overlong forms, surrogates or values above U+10FFFF), without decoding
+    /// them. With SSE2, the octets are checked 16 at a time and the ASCII runs are skipped 64 octets at a time.
+    /// @returns The offset of the first octet of the first invalid (or truncated) sequence, or size if the octets
+    /// are valid.
+    ///
+    inline std::size_t validate_utf8(const void* data, std::size_t size) noexcept
+    {
+        const std::uint8_t* const start = static_cast<const std::uint8_t*>(data);
+        const std::uint8_t* first = start;
+        const std::uint8_t* last = start + size;
+#if (UNISTRINGXX_HAS_SSE2)
+        first = skip_ascii(first, last);
+        __m128i previous = _mm_setzero_si128();
+        for (; (last - first) >= 16; first += 16) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            // An ASCII block after an ASCII block is valid.
+            if (_mm_movemask_epi8(_mm_or_si128(block, previous)) != 0) {
+                if (_mm_movemask_epi8(check_utf8_block(block, previous)) != 0)
+                    break;
+            }
+            previous = block;
+        }
+        // The rest (the block with an error, or the octets after the last block) is checked one sequence at a time,
+        // from the first octet of the code point that it starts in (the octets before it are valid).
+        for (std::size_t ctr = 0; (ctr < 3) && (first != start) && ((first[-1] & 0xC0) == 0x80); ctr++)
+            --first;
+        if ((first != start) && (first[-1] >= 0xC0))
+            --first;
+#endif // (UNISTRINGXX_HAS_SSE2)
+        while (true) {
+            first = skip_ascii(first, last);
+            if (first == last)
+                break;
+            // Text that is not ASCII seldom goes back to ASCII for long, so the sequences are checked as a run.
+            do {
+                const std::size_t sequence_size = check_utf8_sequence(first, last);
+                if (sequence_size == 0)
+                    return (static_cast<std::size_t>(first - start));
+                first += sequence_size;
+            } while ((first != last) && (*first >= 0x80));
+        }
+        return (size);
+    }
+
+    ///
+    /// Validates UTF-16 code units in native byte order (every surrogate must be part of a surrogate pair). The units
+    /// without surrogates are skipped with SIMD.
+    /// @returns The offset of the first unpaired surrogate, or count if the code units are valid.
+    ///
+    inline std::size_t validate_utf16(const char16_t* data, std::size_t count) noexcept
+    {
+        std::size_t offset = 0;
+        while (offset < count) {
+#if (UNISTRINGXX_HAS_SSE2)
+            if ((count - offset) >= 8) {
+                const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+                const __m128i surrogates = _mm_cmpeq_epi16(
+                    _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xF800))),
+                    _mm_set1_epi16(static_cast<short>(0xD800))
+                );
+                const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(surrogates));
+                if (mask == 0) {
+                    offset += 8;
+                    continue;
+                }
+                offset += count_trailing_zeros(mask) / 2;
+            }
+#endif // (UNISTRINGXX_HAS_SSE2)
+            const char16_t unit = data[offset];
+            if (!is_utf16_surrogate(unit)) {
+                offset++;
+                continue;
+            }
+            const bool is_pair = (
+                (unit < 0xDC00) && ((offset + 1) < count) &&
+                (data[offset + 1] >= 0xDC00) && (data[offset + 1] <= 0xDFFF)
+            );
+            if (!is_pair)
+                return (offset);
+            offset += 2;
+        }
+        return (count);
+    }
+
+    ///
+    /// Counts the code points of UTF-8 octets without decoding them, i.e. the octets that are not continuation
+    /// octets (16 octets at a time with SSE2). The count is exact for valid octets (see validate_utf8()).
+    ///
+    inline std::size_t count_code_points_utf8(const void* data, std::size_t size) noexcept
+    {
+        const std::uint8_t* octets = static_cast<const std::uint8_t*>(data);
+        std::size_t result = 0;
+        std::size_t offset = 0;
+#if (UNISTRINGXX_HAS_SSE2)
+        while ((size - offset) >= 16) {
+            // The octets above 0xBF as signed values are the ASCII and leading octets.
+            const std::size_t block_count = std::min((size - offset) / 16, _s_count_blocks8);
+            const __m128i limit = _mm_set1_epi8(static_cast<char>(0xBF - 0x100));
+            __m128i counts = _mm_setzero_si128();
+            std::size_t ctr = 0;
+            for (; (ctr + 4) <= block_count; ctr += 4, offset += 64) {
+                const __m128i block0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(octets + offset));
+                const __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(octets + offset + 16));
+                const __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(octets + offset + 32));
+                const __m128i block3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(octets + offset + 48));
+                const __m128i counted = _mm_add_epi8(
+                    _mm_add_epi8(_mm_cmpgt_epi8(block0, limit), _mm_cmpgt_epi8(block1, limit)),
+                    _mm_add_epi8(_mm_cmpgt_epi8(block2, limit), _mm_cmpgt_epi8(block3, limit))
+                );
+                counts = _mm_sub_epi8(counts, counted);
+            }
+            for (; ctr < block_count; ctr++, offset += 16) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(octets + offset));
+                counts = _mm_sub_epi8(counts, _mm_cmpgt_epi8(block, limit));
+            }
+            const __m128i sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+            result += static_cast<std::size_t>(_mm_cvtsi128_si32(sums));
+            result += static_cast<std::size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+        }
+#else // (UNISTRINGXX_HAS_SSE2)
+        for (; (size - offset) >= 8; offset += 8) {
+            std::uint64_t block = 0;
+            std::memcpy(&block, octets + offset, sizeof (block));
+            // The continuation octets have bit 7 set and bit 6 clear.
+            const std::uint64_t continuations = (block & ~(block << 1)) & 0x8080808080808080ULL;
+            result += 8 - static_cast<std::size_t>(((continuations >> 7) * 0x0101010101010101ULL) >> 56);
+        }
+#endif // (UNISTRINGXX_HAS_SSE2)
+        for (; offset < size; offset++)
+            result += ((octets[offset] & 0xC0) != 0x80) ? 1 : 0;
+        return (result);
+    }
+
+    ///
+    /// Counts the code points of UTF-16 code units in native byte order without decoding them, i.e. the code units
+    /// that are not low surrogates (8 code units at a time with SSE2). The count is exact for valid code units (see
+    /// validate_utf16()).
+    ///
+    inline std::size_t count_code_points_utf16(const char16_t* data, std::size_t count) noexcept
+    {
+        std::size_t low_surrogates = 0;
+        std::size_t offset = 0;
+#if (UNISTRINGXX_HAS_SSE2)
+        while ((count - offset) >= 8) {
+            const std::size_t block_count = std::min((count - offset) / 8, _s_count_blocks16);
+            __m128i counts = _mm_setzero_si128();
+            for (std::size_t ctr = 0; ctr < block_count; ctr++, offset += 8) {
+                const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+                const __m128i is_low = _mm_cmpeq_epi16(
+                    _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xFC00))),
+                    _mm_set1_epi16(static_cast<short>(0xDC00))
+                );
+                counts = _mm_sub_epi16(counts, is_low);
+            }
+            low_surrogates += sum_lanes16(counts);
+        }
+#endif // (UNISTRINGXX_HAS_SSE2)
+        for (; offset < count; offset++)
+            low_surrogates += ((data[offset] & 0xFC00) == 0xDC00) ? 1 : 0;
+        return (count - low_surrogates);
+    }
+
+    ///
+    /// Gets the number of octets of the UTF-8 encoding of code points (4 code points at a time with SSE2). Like
+    /// generic_ustring::to_u8string(), the invalid code points take no octets.
+    ///
+    inline std::size_t utf8_length_of(const uchar_t* data, std::size_t count) noexcept
+    {
+        std::size_t result = 0;
+        std::size_t offset = 0;
+#if (UNISTRINGXX_HAS_SSE2)
+        while ((count - offset) >= _s_code_point_load_size) {
+            const std::size_t group_count =
+                std::min(((count - offset - _s_code_point_load_size) / 4) + 1, _s_length_groups);
+            __m128i sums = _mm_setzero_si128();
+            for (std::size_t ctr = 0; ctr < group_count; ctr++, offset += 4) {
+                const __m128i code_points = load_code_points(data + offset);
+                // 1 octet, plus 1 above each of U+007F, U+07FF and U+FFFF (the comparisons give -1).
+                __m128i lengths = _mm_sub_epi32(
+                    _mm_set1_epi32(1), _mm_cmpgt_epi32(code_points, _mm_set1_epi32(0x7F))
+                );
+                lengths = _mm_sub_epi32(lengths, _mm_cmpgt_epi32(code_points, _mm_set1_epi32(0x7FF)));
+                lengths = _mm_sub_epi32(lengths, _mm_cmpgt_epi32(code_points, _mm_set1_epi32(0xFFFF)));
+                sums = _mm_add_epi32(sums, _mm_and_si128(lengths, get_scalar_values(code_points)));
+            }
+            result += sum_lanes32(sums);
+        }
+#endif // (UNISTRINGXX_HAS_SSE2)
+        for (; offset < count; offset++) {
+            const std::uint32_t code_point = static_cast<std::uint32_t>(data[offset].code_point());
+            if (is_scalar_value(code_point))
+                result += 1 + (code_point > 0x7F) + (code_point > 0x7FF) + (code_point > 0xFFFF);
+        }
+        return (result);
+    }
+
+    ///
+    /// Gets the number of code units of the UTF-16 encoding of code points (4 code points at a time with SSE2). Like
+    /// generic_ustring::to_u16string(), the invalid code points take no code units.
+    ///
+    inline std::size_t utf16_length_of(const uchar_t* data, std::size_t count) noexcept
+    {
+        std::size_t result = 0;
+        std::size_t offset = 0;
+#if (UNISTRINGXX_HAS_SSE2)
+        while ((count - offset) >= _s_code_point_load_size) {
+            const std::size_t group_count =
+                std::min(((count - offset - _s_code_point_load_size) / 4) + 1, _s_length_groups);
+            __m128i sums = _mm_setzero_si128();
+            for (std::size_t ctr = 0; ctr < group_count; ctr++, offset += 4) {
+                const __m128i code_points = load_code_points(data + offset);
+                // 1 code unit, plus 1 above U+FFFF (a surrogate pair).
+                const __m128i lengths = _mm_sub_epi32(
+                    _mm_set1_epi32(1), _mm_cmpgt_epi32(code_points, _mm_set1_epi32(0xFFFF))
+                );
+                sums = _mm_add_epi32(sums, _mm_and_si128(lengths, get_scalar_values(code_points)));
+            }
+            result += sum_lanes32(sums);
+        }
+#endif // (UNISTRINGXX_HAS_SSE2)
+        for (; offset < count; offset++) {
+            const std::uint32_t code_point = static_cast<std::uint32_t>(data[offset].code_point());
+            if (is_scalar_value(code_point))
+                result += 1 + (code_point > 0xFFFF);
+        }
+        return (result);
+    }
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_UTF_VALIDATION_HPP)
@@ -0,0 +1,118 @@
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/arena.hpp>
+
+TEST(arena_test, allocation)
+{
+    unistringxx::arena memory{64};
+    ASSERT_EQ(0u, memory.block_count());
+
+    void* first = memory.allocate(10, 1);
+    void* second = memory.allocate(8, 8);
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(second) % 8);
+    ASSERT_GE(static_cast<char*>(second), static_cast<char*>(first) + 10);
+    ASSERT_EQ(1u, memory.block_count());
+
+    // Only the most recent allocation is reclaimed.
+    memory.deallocate(second, 8);
+    ASSERT_EQ(second, memory.allocate(8, 8));
+
+    // Allocations larger than the block size get their own (larger) block.
+    void* large = memory.allocate(1000, 16);
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(large) % 16);
+    ASSERT_EQ(2u, memory.block_count());
+
+    // Sizes that would wrap around with the alignment are rejected before any block is allocated.
+    ASSERT_THROW(memory.allocate(SIZE_MAX - 8, 16), std::length_error);
+    ASSERT_EQ(2u, memory.block_count());
+
+    memory.release();
+    ASSERT_EQ(0u, memory.block_count());
+}
+
+TEST(arena_test, initial_buffer)
+{
+    alignas (std::max_align_t) char buffer[256];
+    unistringxx::arena memory{buffer, sizeof (buffer)};
+
+    void* first = memory.allocate(100);
+    ASSERT_EQ(static_cast<void*>(buffer), first);
+    memory.allocate(100);
+    ASSERT_EQ(0u, memory.block_count());
+    memory.allocate(100);
+    ASSERT_EQ(1u, memory.block_count());
+
+    // Releasing rewinds to the buffer.
+    memory.release();
+    ASSERT_EQ(static_cast<void*>(buffer), memory.allocate(100));
+    ASSERT_EQ(0u, memory.block_count());
+}
+
+TEST(arena_test, over_aligned_request_on_small_buffer)
+{
+    // An 8 octet buffer at an odd address: aligning to 64 goes past its end, so the request must not be served from
+    // it.
+    alignas (64) char storage[128];
+    char* buffer = storage + 1;
+    unistringxx::arena memory{buffer, 8, 256};
+
+    char* result = static_cast<char*>(memory.allocate(1, 64));
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(result) % 64);
+    ASSERT_TRUE((result < buffer) || (result >= (buffer + 8)));
+    ASSERT_EQ(1u, memory.block_count());
+}
+
+TEST(arena_test, arena_ustring)
+{
+    using namespace unistringxx::operators;
+
+    alignas (std::max_align_t) char buffer[4096];
+    unistringxx::arena memory{buffer, sizeof (buffer)};
+    const unistringxx::arena_ustring::allocator_type allocator{memory};
+
+    // Request-scoped processing: every string, temporary and copy comes from the buffer.
+    {
+        unistringxx::arena_ustring text = unistringxx::arena_ustring::from_u8string("hello, 世界", allocator);
+        ASSERT_EQ(U"hello, 世界"_us.data(), text);
+        ASSERT_EQ(&memory, text.get_allocator().get_arena());
+
+        unistringxx::arena_ustring copy{text};
+        ASSERT_EQ(&memory, copy.get_allocator().get_arena());
+        copy.append(U" and more"_us.data());
+        copy.insert(0, 2, 'x'_uc);
+        copy.replace(0, 2, U"yy"_us.data(), 2);
+        ASSERT_EQ(U"yyhello, 世界 and more"_us.data(), copy);
+        ASSERT_EQ(9u, copy.find(U"世界"_us.data()));
+        ASSERT_EQ(U"世界"_us.data(), copy.substr(9, 2));
+
+        const std::u16string utf16 = u"text";
+        unistringxx::arena_ustring other = unistringxx::arena_ustring::from_u16string(utf16, allocator);
+        other.assign(utf16.begin(), utf16.end());
+        other.swap(text);
+        ASSERT_EQ(U"text"_us.data(), text);
+
+        std::vector<unistringxx::arena_ustring> texts;
+        for (int ctr = 0; ctr < 8; ctr++)
+            texts.push_back(unistringxx::arena_ustring{U"item"_us.data(), allocator});
+        ASSERT_EQ(U"item"_us.data(), texts.back());
+    }
+    ASSERT_EQ(0u, memory.block_count());
+
+    // Assigning to a string that uses another arena copies the text instead of adopting the arena.
+    unistringxx::arena other_memory;
+    unistringxx::arena_ustring long_lived{unistringxx::arena_ustring::allocator_type{other_memory}};
+    {
+        unistringxx::arena_ustring temporary{U"temporary"_us.data(), allocator};
+        long_lived = std::move(temporary);
+    }
+    ASSERT_EQ(&other_memory, long_lived.get_allocator().get_arena());
+    memory.release();
+    ASSERT_EQ(U"temporary"_us.data(), long_lived);
+}
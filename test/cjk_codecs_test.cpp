@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/cjk_codecs.hpp>
+#include <unistringxx/codec_registry.hpp>
+
+namespace
+{
+    std::vector<std::uint8_t> to_octets(const std::string& str)
+    { return (std::vector<std::uint8_t>(str.begin(), str.end())); }
+
+    // Checks that octets decode to text and that text encodes back to octets.
+    void check_round_trip(const char* name, const std::string& octets, const unistringxx::ustring& text)
+    {
+        const unistringxx::text_codec codec = unistringxx::find_codec(name);
+        ASSERT_TRUE(codec.is_valid()) << name;
+        ASSERT_EQ(text, codec.decode(octets.data(), octets.size())) << name;
+        std::vector<std::uint8_t> encoded;
+        codec.encode(text, encoded);
+        ASSERT_EQ(to_octets(octets), encoded) << name;
+        return;
+    }
+} // namespace
+
+TEST(cjk_codecs_test, find_codec)
+{
+    ASSERT_STREQ("Shift_JIS", unistringxx::find_codec("SJIS").name());
+    ASSERT_STREQ("Shift_JIS", unistringxx::find_codec("windows-31j").name());
+    ASSERT_STREQ("EUC-JP", unistringxx::find_codec("euc-jp").name());
+    ASSERT_STREQ("GBK", unistringxx::find_codec("GB2312").name());
+    ASSERT_STREQ("GB18030", unistringxx::find_codec("gb18030").name());
+    ASSERT_STREQ("Big5", unistringxx::find_codec("Big5-HKSCS").name());
+}
+
+TEST(cjk_codecs_test, round_trips)
+{
+    using namespace unistringxx::operators;
+
+    check_round_trip(
+        "Shift_JIS", "\x93\xFA\x96\x7B\x8C\xEA\x83\x65\x83\x4C\x83\x58\x83\x67 \xB6\xC5 \x87\x40",
+        U"日本語テキスト ｶﾅ ①"_us
+    );
+    check_round_trip(
+        "EUC-JP", "\xC6\xFC\xCB\xDC\xB8\xEC\xA5\xC6\xA5\xAD\xA5\xB9\xA5\xC8 \x8E\xB6", U"日本語テキスト ｶ"_us
+    );
+    check_round_trip("GBK", "\xD6\xD0\xCE\xC4 \x80", U"中文 €"_us);
+    // GB18030 covers every code point, with four-octet sequences for the ones that GBK does not have.
+    check_round_trip("GB18030", "\xD6\xD0\xCE\xC4\xA2\xE3\x94\x39\xFC\x36\x81\x30\x81\x30", U"中文€😀\u0080"_us);
+    check_round_trip("Big5", "\xA4\xA4\xA4\xE5\xA6\x72", U"中文字"_us);
+
+    // JIS X 0212 is decoded but not encoded, and the Big5 pointers of the letters with a combining mark are only
+    // decoded.
+    const std::string jis0212 = "\x8F\xB0\xA1";
+    ASSERT_EQ(U"丂"_us, unistringxx::find_codec("EUC-JP").decode(jis0212.data(), jis0212.size()));
+    ASSERT_FALSE(unistringxx::find_codec("EUC-JP").can_encode(U'丂'_uc));
+    const std::string big5 = "\x88\x62\x88\x64\x88\xA3\x88\xA5";
+    ASSERT_EQ(U"Ê̄Ê̌ê̄ê̌"_us, unistringxx::find_codec("Big5").decode(big5.data(), big5.size()));
+
+    ASSERT_TRUE(unistringxx::find_codec("GB18030").can_encode(U'😀'_uc));
+    ASSERT_FALSE(unistringxx::find_codec("GBK").can_encode(U'😀'_uc));
+    ASSERT_FALSE(unistringxx::find_codec("Shift_JIS").can_encode(U'€'_uc));
+    ASSERT_FALSE(unistringxx::find_codec("Big5").can_encode(U'😀'_uc));
+}
+
+TEST(cjk_codecs_test, streaming)
+{
+    using namespace unistringxx::operators;
+
+    const char* const names[] = {"Shift_JIS", "EUC-JP", "GBK", "GB18030", "Big5"};
+    for (const char* name : names) {
+        const unistringxx::text_codec codec = unistringxx::find_codec(name);
+        unistringxx::ustring expected;
+        for (int ctr = 0; ctr < 40; ctr++)
+            expected.append((ctr % 3) ? U"漢字 and some plain ASCII text, "_us : U"中文"_us);
+        if (codec.can_encode(U'😀'_uc))
+            expected.append(U"😀"_us);
+        std::vector<std::uint8_t> octets;
+        codec.encode(expected, octets);
+        ASSERT_EQ(expected, codec.decode(octets.data(), octets.size())) << name;
+
+        // A sequence split between two chunks is kept in the state of the decoder.
+        for (std::size_t chunk_size = 1; chunk_size <= 17; chunk_size++) {
+            unistringxx::text_decoder decoder{codec};
+            unistringxx::ustring text;
+            for (std::size_t offset = 0; offset < octets.size(); offset += chunk_size)
+                decoder.decode(octets.data() + offset, std::min(chunk_size, octets.size() - offset), text);
+            decoder.finish(text);
+            ASSERT_EQ(expected, text) << name << " " << chunk_size;
+        }
+    }
+}
+
+TEST(cjk_codecs_test, errors)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::codec_error_policy replace = unistringxx::codec_error_policy::replace;
+
+    // An ASCII octet that ends an invalid sequence is decoded again.
+    const std::string shift_jis = "\x81 \xA0" "b";
+    const unistringxx::text_codec sjis = unistringxx::find_codec("Shift_JIS");
+    ASSERT_THROW(sjis.decode(shift_jis.data(), shift_jis.size()), std::range_error);
+    ASSERT_EQ(U"� �b"_us, sjis.decode(shift_jis.data(), shift_jis.size(), replace));
+    ASSERT_EQ(U" b"_us, sjis.decode(shift_jis.data(), shift_jis.size(), unistringxx::codec_error_policy::skip));
+    const std::string euc_jp = "\xA1" "a\xFF";
+    ASSERT_EQ(U"�a�"_us, unistringxx::find_codec("EUC-JP").decode(euc_jp.data(), euc_jp.size(), replace));
+    const std::string big5 = "\x81\x40" "c";
+    ASSERT_EQ(U"�@c"_us, unistringxx::find_codec("Big5").decode(big5.data(), big5.size(), replace));
+
+    // An invalid four-octet sequence gives back its digit, and its third octet starts a new sequence.
+    const unistringxx::text_codec gb18030 = unistringxx::find_codec("GB18030");
+    const std::string four_octets = "\x81\x30x\x81\x30\xD6\xD0";
+    ASSERT_EQ(U"�0x�0中"_us, gb18030.decode(four_octets.data(), four_octets.size(), replace));
+    const std::string third_octet = "\x81\x30\xD6 ";
+    ASSERT_EQ(U"�0� "_us, gb18030.decode(third_octet.data(), third_octet.size(), replace));
+
+    // A sequence left incomplete at the end of the stream is an error.
+    unistringxx::text_decoder decoder{sjis};
+    unistringxx::ustring text;
+    decoder.decode("a\x93", 2, text);
+    ASSERT_EQ(U"a"_us, text);
+    ASSERT_THROW(decoder.finish(text), std::range_error);
+    ASSERT_EQ(U"a"_us, text);
+    // The decoder is then ready for a new stream.
+    decoder.decode("\x93", 1, text);
+    decoder.decode("\xFA", 1, text);
+    decoder.finish(text);
+    ASSERT_EQ(U"a日"_us, text);
+    unistringxx::text_decoder replacing{sjis, replace};
+    text.clear();
+    replacing.decode("a\x93", 2, text);
+    replacing.finish(text);
+    ASSERT_EQ(U"a�"_us, text);
+
+    // Code points that the codec does not have.
+    std::vector<std::uint8_t> encoded;
+    const unistringxx::text_codec gbk = unistringxx::find_codec("GBK");
+    ASSERT_THROW(gbk.encode(U"中😀x"_us, encoded), std::range_error);
+    ASSERT_EQ(std::vector<std::uint8_t>({0xD6, 0xD0}), encoded);
+    encoded.clear();
+    gbk.encode(U"中😀x"_us, encoded, replace);
+    ASSERT_EQ(std::vector<std::uint8_t>({0xD6, 0xD0, '?', 'x'}), encoded);
+    // GB18030 has U+FFFD.
+    encoded.clear();
+    gb18030.encode(U"\uFFFD"_us, encoded);
+    ASSERT_EQ(std::vector<std::uint8_t>({0x84, 0x31, 0xA4, 0x37}), encoded);
+}
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/codec_registry.hpp>
+
+TEST(codec_registry_test, find_codec)
+{
+    const unistringxx::text_codec latin1 = unistringxx::find_codec("ISO-8859-1");
+    ASSERT_TRUE(latin1.is_valid());
+    ASSERT_STREQ("ISO-8859-1", latin1.name());
+    ASSERT_EQ(latin1, unistringxx::find_codec("latin1"));
+    ASSERT_EQ(latin1, unistringxx::find_codec("Latin-1"));
+    ASSERT_EQ(latin1, unistringxx::find_codec("iso_8859_1"));
+    ASSERT_STREQ("windows-1252", unistringxx::find_codec("CP1252").name());
+    ASSERT_STREQ("ISO-8859-10", unistringxx::find_codec("L6").name());
+    ASSERT_STREQ("ISO-8859-16", unistringxx::find_codec("latin10").name());
+    ASSERT_STREQ("US-ASCII", unistringxx::find_codec("ascii").name());
+
+    ASSERT_FALSE(unistringxx::find_codec("").is_valid());
+    ASSERT_FALSE(unistringxx::find_codec("latin").is_valid());
+    ASSERT_FALSE(unistringxx::find_codec("iso-8859-12").is_valid());
+    ASSERT_EQ(nullptr, unistringxx::text_codec{}.name());
+    ASSERT_THROW(unistringxx::text_codec{}.decode("a", 1), std::invalid_argument);
+    ASSERT_THROW(unistringxx::text_decoder{unistringxx::text_codec{}}, std::invalid_argument);
+}
+
+TEST(codec_registry_test, single_byte_codecs)
+{
+    using namespace unistringxx::operators;
+
+    // Every octet of ISO-8859-1 is the code point of the same value.
+    const unistringxx::text_codec latin1 = unistringxx::find_codec("latin1");
+    std::vector<std::uint8_t> octets;
+    for (int ctr = 0; ctr < 256; ctr++)
+        octets.push_back(static_cast<std::uint8_t>(ctr));
+    const unistringxx::ustring text = latin1.decode(octets.data(), octets.size());
+    ASSERT_EQ(256u, text.size());
+    for (std::size_t ctr = 0; ctr < text.size(); ctr++)
+        ASSERT_EQ(static_cast<unistringxx::uchar_t::int_type>(ctr), text[ctr].code_point());
+    std::vector<std::uint8_t> encoded;
+    latin1.encode(text, encoded);
+    ASSERT_EQ(octets, encoded);
+
+    const std::string windows_1252 = "\x80 \x93quoted\x94 na\xEFve \x9F";
+    const unistringxx::text_codec codec = unistringxx::find_codec("windows-1252");
+    ASSERT_EQ(U"€ “quoted” naïve Ÿ"_us, codec.decode(windows_1252.data(), windows_1252.size()));
+    const std::string latin9 = "\xA4\xBD";
+    ASSERT_EQ(U"€œ"_us, unistringxx::find_codec("latin9").decode(latin9.data(), latin9.size()));
+    const std::string greek = "\xC1\xE2\xE3";
+    ASSERT_EQ(U"Αβγ"_us, unistringxx::find_codec("greek").decode(greek.data(), greek.size()));
+
+    encoded.clear();
+    unistringxx::find_codec("cp1251").encode(U"Привет, мир"_us, encoded);
+    ASSERT_EQ(std::vector<std::uint8_t>({0xCF, 0xF0, 0xE8, 0xE2, 0xE5, 0xF2, 0x2C, 0x20, 0xEC, 0xE8, 0xF0}), encoded);
+}
+
+TEST(codec_registry_test, long_texts)
+{
+    using namespace unistringxx::operators;
+
+    // Long ASCII runs take the block path, which must agree with the octet by octet decoding.
+    const unistringxx::text_codec codec = unistringxx::find_codec("windows-1252");
+    unistringxx::ustring expected;
+    for (int ctr = 0; ctr < 200; ctr++)
+        expected.append((ctr % 5) ? U"a plain ASCII sentence, "_us : U"déjà vu – “x” "_us);
+    std::vector<std::uint8_t> octets;
+    codec.encode(expected, octets);
+    ASSERT_EQ(expected.size(), octets.size());
+    ASSERT_EQ(expected, codec.decode(octets.data(), octets.size()));
+
+    // The stream can be given in chunks of any size.
+    for (std::size_t chunk_size = 1; chunk_size <= 33; chunk_size += 4) {
+        unistringxx::text_decoder decoder{codec};
+        unistringxx::ustring text;
+        for (std::size_t offset = 0; offset < octets.size(); offset += chunk_size)
+            decoder.decode(octets.data() + offset, std::min(chunk_size, octets.size() - offset), text);
+        decoder.finish(text);
+        ASSERT_EQ(expected, text);
+    }
+}
+
+TEST(codec_registry_test, errors)
+{
+    using namespace unistringxx::operators;
+
+    // 0x81 is not defined in windows-1252, 0xA5 is not defined in ISO-8859-3, and US-ASCII has no upper half.
+    const unistringxx::text_codec windows_1252 = unistringxx::find_codec("windows-1252");
+    const std::string octets = "a\x81" "b";
+    ASSERT_THROW(windows_1252.decode(octets.data(), octets.size()), std::range_error);
+    ASSERT_EQ(
+        U"a�b"_us, windows_1252.decode(octets.data(), octets.size(), unistringxx::codec_error_policy::replace)
+    );
+    ASSERT_EQ(U"ab"_us, windows_1252.decode(octets.data(), octets.size(), unistringxx::codec_error_policy::skip));
+    ASSERT_THROW(unistringxx::find_codec("latin3").decode("\xA5", 1), std::range_error);
+    ASSERT_THROW(unistringxx::find_codec("ascii").decode("\xE9", 1), std::range_error);
+
+    // The text before the error is kept.
+    unistringxx::text_decoder decoder{windows_1252};
+    unistringxx::ustring text;
+    ASSERT_THROW(decoder.decode(octets.data(), octets.size(), text), std::range_error);
+    ASSERT_EQ(U"a"_us, text);
+
+    const unistringxx::text_codec latin1 = unistringxx::find_codec("latin1");
+    ASSERT_TRUE(latin1.can_encode(U'é'_uc));
+    ASSERT_FALSE(latin1.can_encode(U'€'_uc));
+    ASSERT_TRUE(windows_1252.can_encode(U'€'_uc));
+    std::vector<std::uint8_t> encoded;
+    ASSERT_THROW(latin1.encode(U"é€x"_us, encoded), std::range_error);
+    ASSERT_EQ(std::vector<std::uint8_t>({0xE9}), encoded);
+    encoded.clear();
+    latin1.encode(U"é€x"_us, encoded, unistringxx::codec_error_policy::replace);
+    ASSERT_EQ(std::vector<std::uint8_t>({0xE9, '?', 'x'}), encoded);
+    encoded.clear();
+    latin1.encode(U"é€x"_us, encoded, unistringxx::codec_error_policy::skip);
+    ASSERT_EQ(std::vector<std::uint8_t>({0xE9, 'x'}), encoded);
+}
@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/collation.hpp>
+
+TEST(collation_test, tertiary_order)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::collator coll;
+    ASSERT_EQ(unistringxx::collation_strength::tertiary, coll.strength());
+    ASSERT_EQ(unistringxx::variable_weighting::non_ignorable, coll.weighting());
+
+    // Case and accents only break ties between base letters, unlike the code point order.
+    ASSERT_LT(coll.compare(U"a"_us, U"A"_us), 0);
+    ASSERT_LT(coll.compare(U"A"_us, U"á"_us), 0);
+    ASSERT_LT(coll.compare(U"á"_us, U"b"_us), 0);
+    ASSERT_LT(coll.compare(U"a"_us, U"Z"_us), 0);
+    ASSERT_LT(coll.compare(U"resume"_us, U"résumé"_us), 0);
+    ASSERT_LT(coll.compare(U"résumé"_us, U"resumes"_us), 0);
+    ASSERT_GT(coll.compare(U"b"_us, U"A"_us), 0);
+    ASSERT_EQ(0, coll.compare(U"abc"_us, U"abc"_us));
+    ASSERT_EQ(0, coll.compare(U""_us, U""_us));
+    ASSERT_LT(coll.compare(U""_us, U"a"_us), 0);
+
+    // Scripts follow the DUCET order; unlisted ideographs get implicit weights after the listed scripts.
+    ASSERT_LT(coll.compare(U"z"_us, U"α"_us), 0);
+    ASSERT_LT(coll.compare(U"α"_us, U"я"_us), 0);
+    ASSERT_LT(coll.compare(U"я"_us, U"一"_us), 0);
+    ASSERT_LT(coll.compare(U"一"_us, U"丁"_us), 0);
+    ASSERT_LT(coll.compare(U"丁"_us, U"\U00020000"_us), 0);
+
+    // Hangul syllables are weighted as their jamo.
+    ASSERT_LT(coll.compare(U"가"_us, U"각"_us), 0);
+    ASSERT_LT(coll.compare(U"각"_us, U"나"_us), 0);
+    ASSERT_EQ(0, coll.compare(U"가"_us, U"가"_us));
+
+    // Contractions: the decomposed form of SHORT I, and Thai prevowels that sort after the following consonant.
+    ASSERT_EQ(0, coll.compare(U"Й"_us, U"Й"_us));
+    ASSERT_LT(coll.compare(U"ก"_us, U"เก"_us), 0);
+    ASSERT_LT(coll.compare(U"เก"_us, U"ข"_us), 0);
+
+    ASSERT_TRUE(coll(U"apple"_us, U"Banana"_us));
+    ASSERT_FALSE(coll(U"Banana"_us, U"apple"_us));
+}
+
+TEST(collation_test, strength)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::collator primary{unistringxx::collation_strength::primary};
+    ASSERT_EQ(0, primary.compare(U"a"_us, U"A"_us));
+    ASSERT_EQ(0, primary.compare(U"a"_us, U"á"_us));
+    ASSERT_EQ(0, primary.compare(U"Resume"_us, U"résumé"_us));
+    ASSERT_LT(primary.compare(U"a"_us, U"b"_us), 0);
+
+    const unistringxx::collator secondary{unistringxx::collation_strength::secondary};
+    ASSERT_EQ(0, secondary.compare(U"a"_us, U"A"_us));
+    ASSERT_LT(secondary.compare(U"A"_us, U"á"_us), 0);
+
+    const unistringxx::collator tertiary{unistringxx::collation_strength::tertiary};
+    ASSERT_LT(tertiary.compare(U"a"_us, U"A"_us), 0);
+    ASSERT_EQ(0, tertiary.compare(U"Й"_us, U"Й"_us));
+
+    const unistringxx::collator identical{unistringxx::collation_strength::identical};
+    ASSERT_NE(0, identical.compare(U"Й"_us, U"Й"_us));
+    ASSERT_LT(identical.compare(U"a"_us, U"A"_us), 0);
+}
+
+TEST(collation_test, variable_weighting)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::collator non_ignorable;
+    ASSERT_LT(non_ignorable.compare(U"de luge"_us, U"deluge"_us), 0);
+    ASSERT_LT(non_ignorable.compare(U"de-luge"_us, U"deluge"_us), 0);
+
+    const unistringxx::collator shifted{
+        unistringxx::collation_strength::tertiary, unistringxx::variable_weighting::shifted
+    };
+    ASSERT_EQ(0, shifted.compare(U"de luge"_us, U"deluge"_us));
+    ASSERT_EQ(0, shifted.compare(U"de-luge"_us, U"de luge"_us));
+    ASSERT_LT(shifted.compare(U"de luge"_us, U"de Luge"_us), 0);
+    ASSERT_LT(shifted.compare(U"death"_us, U"de luge"_us), 0);
+
+    const unistringxx::collator quaternary{
+        unistringxx::collation_strength::quaternary, unistringxx::variable_weighting::shifted
+    };
+    ASSERT_NE(0, quaternary.compare(U"de luge"_us, U"deluge"_us));
+    ASSERT_LT(quaternary.compare(U"de luge"_us, U"deluge"_us), 0);
+    ASSERT_EQ(0, quaternary.compare(U"Й"_us, U"Й"_us));
+}
+
+TEST(collation_test, sort_keys)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::collator coll;
+    const std::vector<unistringxx::ustring> texts = {
+        U"b"_us, U"A"_us, U"a"_us, U"á"_us, U"Z"_us, U"z"_us, U"de luge"_us, U"deluge"_us, U"一"_us, U""_us
+    };
+
+    // Keys compare in the same order as the texts.
+    for (const auto& left : texts) {
+        for (const auto& right : texts) {
+            const int key_result = coll.sort_key(left).compare(coll.sort_key(right));
+            const int result = coll.compare(left, right);
+            ASSERT_EQ((result < 0), (key_result < 0));
+            ASSERT_EQ((result == 0), (key_result == 0));
+        }
+    }
+
+    // Keys can be computed into an existing buffer.
+    std::string key = "garbage";
+    coll.sort_key(U"a"_us, key);
+    ASSERT_EQ(coll.sort_key(U"a"_us), key);
+
+    // Primary keys do not contain the lower levels.
+    const unistringxx::collator primary{unistringxx::collation_strength::primary};
+    ASSERT_EQ(primary.sort_key(U"a"_us), primary.sort_key(U"A"_us));
+    ASSERT_LT(primary.sort_key(U"a"_us).size(), coll.sort_key(U"a"_us).size());
+    ASSERT_TRUE(primary.sort_key(U""_us).empty());
+}
+
+TEST(collation_test, compare_matches_sort_keys)
+{
+    using namespace unistringxx::operators;
+
+    // compare walks the collation elements level by level instead of building keys; both must give the same order at
+    // every strength, including for expansions, contractions, Hangul syllables, implicit weights and ignorables.
+    const std::vector<unistringxx::ustring> texts = {
+        U""_us, U"a"_us, U"A"_us, U"á"_us, U"ab"_us, U"a-b"_us, U"a b"_us, U"ab-"_us, U"-ab"_us, U"æ"_us, U"ae"_us,
+        U"Й"_us, U"Й"_us, U"เก"_us, U"ก"_us, U"가"_us, U"각"_us, U"ᄀ"_us, U"一"_us, U"\U00020000"_us,
+        U"a\u0301"_us, U"a\u0000b"_us, U"de luge"_us, U"de Luge"_us, U"deluge"_us, U"death"_us
+    };
+    const unistringxx::collation_strength strengths[] = {
+        unistringxx::collation_strength::primary, unistringxx::collation_strength::secondary,
+        unistringxx::collation_strength::tertiary, unistringxx::collation_strength::quaternary,
+        unistringxx::collation_strength::identical
+    };
+    const unistringxx::variable_weighting weightings[] = {
+        unistringxx::variable_weighting::non_ignorable, unistringxx::variable_weighting::shifted
+    };
+
+    for (const auto strength : strengths) {
+        for (const auto weighting : weightings) {
+            const unistringxx::collator coll{strength, weighting};
+            for (const auto& left : texts) {
+                for (const auto& right : texts) {
+                    const int key_result = coll.sort_key(left).compare(coll.sort_key(right));
+                    const int result = coll.compare(left, right);
+                    ASSERT_EQ((key_result < 0), (result < 0));
+                    ASSERT_EQ((key_result == 0), (result == 0));
+                    ASSERT_EQ(result, -coll.compare(right, left));
+                }
+            }
+        }
+    }
+}
+
+TEST(collation_test, collation_sort)
+{
+    using namespace unistringxx::operators;
+
+    std::vector<unistringxx::ustring> texts = {
+        U"b"_us, U"Z"_us, U"A"_us, U"á"_us, U"z"_us, U"a"_us, U"一"_us, U"α"_us
+    };
+    const std::vector<unistringxx::ustring> expected = {
+        U"a"_us, U"A"_us, U"á"_us, U"b"_us, U"z"_us, U"Z"_us, U"α"_us, U"一"_us
+    };
+
+    unistringxx::collation_sort(texts.begin(), texts.end(), unistringxx::collator{});
+    ASSERT_EQ(expected, texts);
+
+    // Same result as sorting with the collator as the comparator.
+    std::vector<unistringxx::ustring> comparator_sorted = {
+        U"b"_us, U"Z"_us, U"A"_us, U"á"_us, U"z"_us, U"a"_us, U"一"_us, U"α"_us
+    };
+    std::sort(comparator_sorted.begin(), comparator_sorted.end(), unistringxx::collator{});
+    ASSERT_EQ(expected, comparator_sorted);
+
+    // The sort is stable: elements that are equal at the collator's strength keep their relative order.
+    std::vector<unistringxx::ustring> stable = { U"b"_us, U"A"_us, U"á"_us, U"a"_us };
+    unistringxx::collation_sort(
+        stable.begin(), stable.end(), unistringxx::collator{unistringxx::collation_strength::primary}
+    );
+    ASSERT_EQ((std::vector<unistringxx::ustring>{ U"A"_us, U"á"_us, U"a"_us, U"b"_us }), stable);
+}
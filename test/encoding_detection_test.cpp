@@ -0,0 +1,112 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/codec_registry.hpp>
+#include <unistringxx/encoding_detection.hpp>
+#include <unistringxx/utf_codecs.hpp>
+
+namespace
+{
+    std::vector<std::uint8_t> encode_with(const char* name, const unistringxx::ustring& text)
+    {
+        std::vector<std::uint8_t> octets;
+        unistringxx::find_codec(name).encode(text, octets);
+        return (octets);
+    }
+
+    unistringxx::encoding_guesses detect(const std::vector<std::uint8_t>& octets)
+    { return (unistringxx::detect_encoding(octets.data(), octets.size())); }
+} // namespace
+
+TEST(encoding_detection_test, byte_order_marks)
+{
+    ASSERT_TRUE(unistringxx::detect_encoding("", 0).empty());
+
+    const std::string utf8 = "\xEF\xBB\xBFtext";
+    unistringxx::encoding_guesses guesses = unistringxx::detect_encoding(utf8.data(), utf8.size());
+    ASSERT_EQ(1u, guesses.size());
+    ASSERT_STREQ("UTF-8", guesses.best().name);
+    ASSERT_EQ(100u, guesses.best().confidence);
+    ASSERT_EQ(3u, guesses.best().bom_size);
+
+    guesses = unistringxx::detect_encoding("\xFE\xFF\x00t", 4);
+    ASSERT_STREQ("UTF-16BE", guesses.best().name);
+    ASSERT_EQ(unistringxx::byte_order::big_endian, guesses.best().order);
+    ASSERT_EQ(2u, guesses.best().bom_size);
+    ASSERT_STREQ("UTF-16LE", unistringxx::detect_encoding("\xFF\xFEt\x00", 4).best().name);
+    ASSERT_STREQ("UTF-32BE", unistringxx::detect_encoding("\x00\x00\xFE\xFF", 4).best().name);
+
+    // FF FE 00 00 is also UTF-16LE followed by U+0000.
+    guesses = unistringxx::detect_encoding("\xFF\xFE\x00\x00", 4);
+    ASSERT_EQ(2u, guesses.size());
+    ASSERT_STREQ("UTF-32LE", guesses[0].name);
+    ASSERT_EQ(unistringxx::encoding_scheme::utf32, guesses[0].scheme);
+    ASSERT_STREQ("UTF-16LE", guesses[1].name);
+}
+
+TEST(encoding_detection_test, unicode)
+{
+    using namespace unistringxx::operators;
+
+    const std::string ascii = "Plain ASCII text is UTF-8 whatever the legacy encoding was.";
+    unistringxx::encoding_guesses guesses = unistringxx::detect_encoding(ascii.data(), ascii.size());
+    ASSERT_EQ(1u, guesses.size());
+    ASSERT_STREQ("UTF-8", guesses.best().name);
+    ASSERT_EQ(100u, guesses.best().confidence);
+
+    const unistringxx::ustring text = U"Une phrase en français, 日本語のテキスト и немного русского."_us;
+    const std::string utf8 = text.to_u8string();
+    guesses = unistringxx::detect_encoding(utf8.data(), utf8.size());
+    ASSERT_STREQ("UTF-8", guesses.best().name);
+    ASSERT_EQ(unistringxx::encoding_scheme::utf8, guesses.best().scheme);
+    ASSERT_GE(guesses.best().confidence, 90u);
+    ASSERT_EQ(0u, guesses.best().bom_size);
+    for (const unistringxx::encoding_guess& guess : guesses)
+        ASSERT_LE(guess.confidence, guesses.best().confidence);
+
+    // Only the prefix is looked at, and a sequence cut at its end is fine.
+    const std::string cut = utf8 + "\xFF";
+    ASSERT_STREQ("UTF-8", unistringxx::detect_encoding(cut.data(), cut.size(), utf8.size()).best().name);
+    ASSERT_STREQ("UTF-8", unistringxx::detect_encoding(utf8.data(), utf8.size(), utf8.find("本") + 1).best().name);
+    ASSERT_STRNE("UTF-8", unistringxx::detect_encoding(cut.data(), cut.size()).best().name);
+
+    // Without a byte order mark, UTF-16 and UTF-32 are told by their zero octets.
+    const unistringxx::ustring latin = U"Some text in UTF-16 or UTF-32, with a few non-ASCII letters: é, ß, ø."_us;
+    std::vector<std::uint8_t> octets;
+    unistringxx::encode_utf16(latin, octets, unistringxx::byte_order::little_endian, false);
+    ASSERT_STREQ("UTF-16LE", detect(octets).best().name);
+    ASSERT_EQ(unistringxx::byte_order::little_endian, detect(octets).best().order);
+    octets.clear();
+    unistringxx::encode_utf16(latin, octets, unistringxx::byte_order::big_endian, false);
+    ASSERT_STREQ("UTF-16BE", detect(octets).best().name);
+    octets.clear();
+    unistringxx::encode_utf32(latin, octets, unistringxx::byte_order::little_endian, false);
+    ASSERT_STREQ("UTF-32LE", detect(octets).best().name);
+    octets.clear();
+    unistringxx::encode_utf32(latin, octets, unistringxx::byte_order::big_endian, false);
+    ASSERT_STREQ("UTF-32BE", detect(octets).best().name);
+}
+
+TEST(encoding_detection_test, legacy)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::ustring japanese = U"日本語のテキストです。これは文字コードの判定のテストです。"_us;
+    ASSERT_STREQ("Shift_JIS", detect(encode_with("Shift_JIS", japanese)).best().name);
+    ASSERT_STREQ("EUC-JP", detect(encode_with("EUC-JP", japanese)).best().name);
+    const unistringxx::ustring chinese = U"这是一个中文的文本，我们用它来测试编码的检测。"_us;
+    const unistringxx::encoding_guesses guesses = detect(encode_with("GBK", chinese));
+    ASSERT_STREQ("GB18030", guesses.best().name);
+    ASSERT_EQ(unistringxx::encoding_scheme::legacy, guesses.best().scheme);
+    ASSERT_STREQ("Big5", detect(encode_with("Big5", U"這是一個中文的文本，我們用它來測試編碼的檢測。"_us)).best().name);
+
+    ASSERT_STREQ(
+        "windows-1252", detect(encode_with("windows-1252", U"Une phrase naïve en français, déjà vue."_us)).best().name
+    );
+    const unistringxx::ustring russian = U"Съешь же ещё этих мягких французских булок, да выпей чаю."_us;
+    ASSERT_STREQ("windows-1251", detect(encode_with("windows-1251", russian)).best().name);
+}
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/arena.hpp>
+#include <unistringxx/gap_ustring.hpp>
+
+namespace
+{
+    unistringxx::ustring make_text(std::size_t size)
+    {
+        unistringxx::ustring result;
+        for (std::size_t ctr = 0; ctr < size; ctr++)
+            result.push_back(unistringxx::uchar_t{static_cast<int>((ctr % 2) ? ('a' + (ctr % 26)) : (0x3041 + (ctr % 80)))});
+        return (result);
+    }
+}
+
+TEST(gap_ustring_test, construction)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::gap_ustring empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(0u, empty.size());
+    ASSERT_EQ(empty.begin(), empty.end());
+    ASSERT_EQ(U""_us, empty.to_ustring());
+
+    const unistringxx::gap_ustring text{U"hello, 世界"_us};
+    ASSERT_EQ(9u, text.size());
+    ASSERT_EQ(U"hello, 世界"_us, text.to_ustring());
+    ASSERT_TRUE(text == U"hello, 世界"_us);
+    ASSERT_TRUE(text != U"hello"_us);
+    ASSERT_EQ(U'世'_uc, text[7]);
+    ASSERT_EQ('h'_uc, text.at(0));
+    ASSERT_THROW(text.at(9), std::out_of_range);
+    ASSERT_EQ(9, text.end() - text.begin());
+    ASSERT_TRUE(std::equal(text.rbegin(), text.rend(), U"界世 ,olleh"_us.begin()));
+}
+
+TEST(gap_ustring_test, editing)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::gap_ustring text{U"hello world"_us};
+
+    // Typing at a cursor.
+    text.insert(5, U","_us);
+    ASSERT_EQ(6u, text.gap_position());
+    text.insert(6, U" dear"_us);
+    ASSERT_EQ(U"hello, dear world"_us, text.to_ustring());
+    ASSERT_EQ(11u, text.gap_position());
+
+    // Backspace at the cursor, then elsewhere.
+    text.erase(10, 1);
+    ASSERT_EQ(U"hello, dea world"_us, text.to_ustring());
+    ASSERT_EQ(10u, text.gap_position());
+    text.erase(0, 1);
+    ASSERT_EQ(U"ello, dea world"_us, text.to_ustring());
+    ASSERT_EQ(0u, text.gap_position());
+    text.erase(9);
+    ASSERT_EQ(U"ello, dea"_us, text.to_ustring());
+
+    // The iterator overloads.
+    unistringxx::gap_ustring::iterator itr = text.insert(text.begin(), 'h'_uc);
+    ASSERT_EQ(text.begin(), itr);
+    itr = text.insert(text.begin() + 8, 2, 'r'_uc);
+    ASSERT_EQ(U"hello, drrea"_us, text.to_ustring());
+    ASSERT_EQ('r'_uc, *itr);
+    itr = text.erase(itr + 1);
+    itr = text.erase(itr, text.end());
+    ASSERT_EQ(text.end(), itr);
+    const unistringxx::ustring suffix = U"ama, 世界"_us;
+    text.insert(text.end(), suffix.begin(), suffix.end());
+    text.insert(text.begin() + 5, {'!'_uc, '!'_uc});
+    ASSERT_EQ(U"hello!!, drama, 世界"_us, text.to_ustring());
+    text.replace(5, 2, U"?"_us);
+    text.push_back('.'_uc);
+    text.append(U".."_us);
+    text.pop_back();
+    ASSERT_EQ(U"hello?, drama, 世界.."_us, text.to_ustring());
+    ASSERT_THROW(text.insert(text.size() + 1, U"x"_us), std::out_of_range);
+    ASSERT_THROW(text.erase(text.size() + 1), std::out_of_range);
+
+    // Writing through the iterators.
+    *(text.begin()) = 'H'_uc;
+    std::fill(text.begin() + 1, text.begin() + 3, 'E'_uc);
+    ASSERT_EQ(U"HEElo?, drama, 世界.."_us, text.to_ustring());
+
+    text.clear();
+    ASSERT_TRUE(text.empty());
+    text.append(U"again"_us);
+    ASSERT_EQ(U"again"_us, text.to_ustring());
+}
+
+TEST(gap_ustring_test, view_and_search)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::gap_ustring text{U"the quick brown fox"_us};
+    text.insert(4, U"very "_us);
+    ASSERT_EQ(9u, text.gap_position());
+
+    // find() searches across the gap.
+    ASSERT_EQ(4u, text.find(U"very quick"_us));
+    ASSERT_EQ(15u, text.find(U"brown"_us, 10));
+    ASSERT_EQ(unistringxx::gap_ustring::npos, text.find(U"slow"_us));
+    ASSERT_EQ(unistringxx::gap_ustring::npos, text.find(U"fox"_us, 30));
+    ASSERT_EQ(3u, text.find(U""_us, 3));
+
+    // view() closes the gap.
+    const unistringxx::ustring_view view = text.view();
+    ASSERT_EQ(text.size(), text.gap_position());
+    ASSERT_EQ(U"the very quick brown fox"_us, view);
+    ASSERT_EQ(15u, view.find(U"brown"_us));
+
+    unistringxx::gap_ustring other{U"other"_us};
+    other.swap(text);
+    ASSERT_EQ(U"other"_us, text.to_ustring());
+    ASSERT_EQ(U"the very quick brown fox"_us, other.to_ustring());
+}
+
+TEST(gap_ustring_test, swap_unequal_allocators)
+{
+    using namespace unistringxx::operators;
+    typedef unistringxx::generic_gap_ustring<unistringxx::arena_allocator<unistringxx::uchar_t>> arena_gap_ustring;
+
+    // The allocators are not propagated on swap, so each text keeps its arena and gets a copy of the other text.
+    unistringxx::arena first_memory;
+    unistringxx::arena second_memory;
+    arena_gap_ustring first{U"first text"_us, arena_gap_ustring::allocator_type{first_memory}};
+    arena_gap_ustring second{U"second"_us, arena_gap_ustring::allocator_type{second_memory}};
+    first.insert(5, U" edited"_us);
+    second.insert(0, U"the "_us);
+    first.swap(second);
+    ASSERT_EQ(&first_memory, first.get_allocator().get_arena());
+    ASSERT_EQ(&second_memory, second.get_allocator().get_arena());
+    ASSERT_EQ(U"the second"_us.data(), first.to_ustring());
+    ASSERT_EQ(U"first edited text"_us.data(), second.to_ustring());
+    first.insert(first.size(), U"!"_us);
+    ASSERT_EQ(U"the second!"_us.data(), first.to_ustring());
+}
+
+TEST(gap_ustring_test, aliased_and_iterator_inserts)
+{
+    using namespace unistringxx::operators;
+
+    // Views of the text itself are copied before the gap moves or the buffer grows.
+    unistringxx::gap_ustring text{U"abc"_us};
+    text.insert(0, text.view());
+    ASSERT_EQ(U"abcabc"_us, text.to_ustring());
+    for (int ctr = 0; ctr < 6; ctr++)
+        text.insert(text.size() / 2, text.view());
+    ASSERT_EQ(384u, text.size());
+    text.clear();
+    text.append(U"hello world"_us);
+    const unistringxx::ustring_view view = text.view();
+    text.replace(0, 5, view.substr(6, 5));
+    ASSERT_EQ(U"world world"_us, text.to_ustring());
+
+    // Forward iterators are copied straight into the gap, input iterators are read into a temporary first.
+    const std::list<unistringxx::uchar_t> list = {'x'_uc, 'y'_uc};
+    text.insert(text.begin() + 5, list.begin(), list.end());
+    ASSERT_EQ(U"worldxy world"_us, text.to_ustring());
+    std::istringstream stream{"65 66 67"};
+    text.insert(text.end(), std::istream_iterator<int>{stream}, std::istream_iterator<int>{});
+    ASSERT_EQ(U"worldxy worldABC"_us, text.to_ustring());
+}
+
+TEST(gap_ustring_test, random_edits)
+{
+    std::mt19937 random{1234};
+    unistringxx::ustring expected = make_text(30000);
+    unistringxx::gap_ustring text{expected};
+
+    std::size_t cursor = 0;
+    for (std::size_t ctr = 0; ctr < 2000; ctr++) {
+        // Mostly local edits, with an occasional jump.
+        if ((random() % 16) == 0)
+            cursor = random() % (expected.size() + 1);
+        cursor = std::min(cursor, expected.size());
+        const std::size_t action = random() % 4;
+        if (action == 0) {
+            const std::size_t count = std::min<std::size_t>(random() % 8, cursor);
+            expected.erase(cursor - count, count);
+            text.erase(cursor - count, count);
+            cursor -= count;
+        }
+        else if (action == 1) {
+            const std::size_t count = random() % 8;
+            expected.erase(cursor, count);
+            text.erase(cursor, count);
+        }
+        else {
+            const unistringxx::ustring insert = make_text(1 + (random() % ((action == 2) ? 4 : 300)));
+            expected.insert(cursor, insert);
+            text.insert(cursor, insert);
+            cursor += insert.size();
+        }
+        ASSERT_EQ(expected.size(), text.size());
+        if ((ctr % 100) == 0) {
+            ASSERT_EQ(expected, text.to_ustring());
+        }
+    }
+    ASSERT_EQ(expected, text.to_ustring());
+    ASSERT_EQ(unistringxx::ustring_view{expected}, text.view());
+}
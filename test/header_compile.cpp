@@ -1,10 +1,35 @@
 #include <gtest/gtest.h>
 
 // Test compile headers
+#include <unistringxx/arena.hpp>
+#include <unistringxx/cjk_codecs.hpp>
+#include <unistringxx/codec.hpp>
+#include <unistringxx/codec_registry.hpp>
+#include <unistringxx/collation.hpp>
 #include <unistringxx/common.hpp>
 #include <unistringxx/core.hpp>
+#include <unistringxx/encoding_detection.hpp>
+#include <unistringxx/gap_ustring.hpp>
+#include <unistringxx/hash.hpp>
+#include <unistringxx/intern.hpp>
+#include <unistringxx/layout.hpp>
+#include <unistringxx/line_reader.hpp>
+#include <unistringxx/mapped_ustring.hpp>
+#include <unistringxx/numeric.hpp>
+#include <unistringxx/pool_allocator.hpp>
+#include <unistringxx/rope.hpp>
+#include <unistringxx/serialization.hpp>
+#include <unistringxx/shared_ustring.hpp>
+#include <unistringxx/single_byte_codecs.hpp>
+#include <unistringxx/sort.hpp>
 #include <unistringxx/uchar.hpp>
+#include <unistringxx/uproperties.hpp>
 #include <unistringxx/ustring.hpp>
+#include <unistringxx/ustring_io.hpp>
+#include <unistringxx/ustring_view.hpp>
+#include <unistringxx/utf_codecs.hpp>
+#include <unistringxx/utf_ranges.hpp>
+#include <unistringxx/utf_validation.hpp>
 #include <unistringxx/utils.hpp>
 
 TEST(unistringxx_headers, header_compile_test)
@@ -0,0 +1,123 @@
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/intern.hpp>
+#include <unistringxx/ustring.hpp>
+
+TEST(intern_test, intern)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::intern_pool pool;
+    ASSERT_EQ(0u, pool.size());
+    ASSERT_FALSE(pool.find(U"name"_us).is_valid());
+
+    const unistringxx::intern_handle name = pool.intern(U"name"_us);
+    const unistringxx::intern_handle tag = pool.intern(U"タグ"_us);
+    const unistringxx::intern_handle empty = pool.intern(U""_us);
+    ASSERT_TRUE(name.is_valid());
+    ASSERT_EQ(0u, name.value());
+    ASSERT_EQ(1u, tag.value());
+    ASSERT_NE(name, tag);
+    ASSERT_EQ(3u, pool.size());
+
+    // The same text gives the same handle and the same storage.
+    const unistringxx::ustring name_copy = U"name"_us;
+    ASSERT_EQ(name, pool.intern(name_copy));
+    ASSERT_EQ(name, pool.find(name_copy));
+    ASSERT_EQ(3u, pool.size());
+    ASSERT_EQ(U"name"_us, unistringxx::ustring{pool.text(name)});
+    ASSERT_EQ(pool.text(name).data(), pool.text(pool.find(U"name"_us)).data());
+    ASSERT_TRUE(pool.text(empty).empty());
+    ASSERT_TRUE(pool.text(tag).data()[pool.text(tag).size()].is_null());
+
+    // Embedded nulls and prefixes are distinct texts.
+    const unistringxx::ustring with_null{{ 'n', 'a', 'm', 'e', '\0'_uc }};
+    ASSERT_NE(name, pool.intern(with_null));
+    ASSERT_NE(name, pool.intern(U"nam"_us));
+    ASSERT_EQ(with_null, unistringxx::ustring{pool.text(pool.find(with_null))});
+
+    std::unordered_set<unistringxx::intern_handle> handles{name, tag, name};
+    ASSERT_EQ(2u, handles.size());
+    ASSERT_FALSE(unistringxx::intern_handle{}.is_valid());
+}
+
+TEST(intern_test, growth)
+{
+    unistringxx::intern_pool pool;
+    std::vector<unistringxx::ustring> texts;
+    for (int ctr = 0; ctr < 20000; ctr++)
+        texts.push_back(unistringxx::to_ustring(ctr));
+    // A large text is stored on its own.
+    texts.push_back(unistringxx::ustring(10000, unistringxx::uchar_t{U'あ'}));
+
+    std::vector<unistringxx::ustring_view> views;
+    for (const unistringxx::ustring& text : texts) {
+        const unistringxx::intern_handle handle = pool.intern(text);
+        views.push_back(pool.text(handle));
+    }
+    ASSERT_EQ(texts.size(), pool.size());
+    for (std::size_t ctr = 0; ctr < texts.size(); ctr++) {
+        const unistringxx::intern_handle handle = pool.find(texts[ctr]);
+        ASSERT_EQ(ctr, handle.value());
+        // Texts never move.
+        ASSERT_EQ(views[ctr].data(), pool.text(handle).data());
+        ASSERT_EQ(texts[ctr], unistringxx::ustring{views[ctr]});
+    }
+}
+
+TEST(intern_test, bulk_intern)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::intern_pool pool;
+    const unistringxx::intern_handle existing = pool.intern(U"b"_us);
+    const std::vector<unistringxx::ustring> texts = { U"a"_us, U"b"_us, U"c"_us, U"a"_us, U"d"_us };
+    std::vector<unistringxx::intern_handle> handles;
+    pool.intern(texts.begin(), texts.end(), std::back_inserter(handles));
+    ASSERT_EQ(5u, handles.size());
+    ASSERT_EQ(existing, handles[1]);
+    ASSERT_EQ(handles[0], handles[3]);
+    ASSERT_NE(handles[0], handles[2]);
+    ASSERT_EQ(4u, pool.size());
+    for (std::size_t ctr = 0; ctr < texts.size(); ctr++)
+        ASSERT_EQ(texts[ctr], unistringxx::ustring{pool.text(handles[ctr])});
+}
+
+TEST(intern_test, concurrent_intern)
+{
+    unistringxx::intern_pool pool;
+    const int thread_count = 4;
+    const int text_count = 5000;
+    std::vector<std::vector<unistringxx::intern_handle>> results(thread_count);
+    // Multipliers coprime with text_count, so that every thread visits every text.
+    const int steps[thread_count] = { 1, 3, 7, 11 };
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < thread_count; thread++) {
+        threads.push_back(std::thread{[&pool, &results, &steps, thread]() {
+            // Every thread interns the same texts in a different order.
+            std::vector<unistringxx::intern_handle>& handles = results[thread];
+            handles.resize(text_count);
+            for (int ctr = 0; ctr < text_count; ctr++) {
+                const int index = (ctr * steps[thread]) % text_count;
+                handles[index] = pool.intern(unistringxx::to_ustring(index));
+                pool.text(handles[index]);
+            }
+        }});
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(static_cast<std::size_t>(text_count), pool.size());
+    for (int ctr = 0; ctr < text_count; ctr++) {
+        for (int thread = 1; thread < thread_count; thread++)
+            ASSERT_EQ(results[0][ctr], results[thread][ctr]);
+        ASSERT_EQ(unistringxx::to_ustring(ctr), unistringxx::ustring{pool.text(results[0][ctr])});
+    }
+}
@@ -0,0 +1,194 @@
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/layout.hpp>
+
+namespace
+{
+    typedef std::vector<unistringxx::ustring_view::size_type> positions;
+
+    // The breakers keep a view of the text, so they cannot be given a temporary string.
+    static_assert(!std::is_constructible<unistringxx::grapheme_breaker, unistringxx::ustring&&>::value, "");
+    static_assert(!std::is_constructible<unistringxx::line_breaker, unistringxx::ustring&&>::value, "");
+    static_assert(std::is_constructible<unistringxx::grapheme_breaker, const unistringxx::ustring&>::value, "");
+
+    std::vector<unistringxx::ustring> wrap_lines(const unistringxx::ustring& text, std::size_t width)
+    {
+        std::vector<unistringxx::ustring> result;
+        for (const auto& line : unistringxx::wrap(text, width))
+            result.push_back(static_cast<unistringxx::ustring>(line));
+        return (result);
+    }
+} // namespace
+
+TEST(layout_test, line_breaks)
+{
+    using namespace unistringxx::operators;
+
+    ASSERT_TRUE(unistringxx::line_break_positions(unistringxx::ustring{}).empty());
+
+    // Break after spaces, never before them.
+    ASSERT_EQ((positions{ 6, 11 }), unistringxx::line_break_positions(U"Hello world"_us));
+    ASSERT_EQ((positions{ 8, 13 }), unistringxx::line_break_positions(U"Hello   world"_us));
+
+    // No break inside numbers, before closing punctuation or after opening punctuation.
+    ASSERT_EQ((positions{ 5, 12, 15 }), unistringxx::line_break_positions(U"cost $12.50 (x)"_us));
+    ASSERT_EQ((positions{ 4, 8 }), unistringxx::line_break_positions(U"(a, b!) "_us));
+
+    // Hyphens allow a break after them; NBSP glues.
+    ASSERT_EQ((positions{ 5, 9 }), unistringxx::line_break_positions(U"well-done"_us));
+    ASSERT_EQ((positions{ 6 }), unistringxx::line_break_positions(U"100\u00A0km"_us));
+
+    // Ideographs break between each other, but not before small kana (nonstarters) or ideographic full stops.
+    ASSERT_EQ((positions{ 1, 2, 3 }), unistringxx::line_break_positions(U"日本語"_us));
+    ASSERT_EQ((positions{ 2, 4 }), unistringxx::line_break_positions(U"かっか。"_us));
+
+    // Combining marks stay with their base; emoji modifiers with their base; flags are pairs.
+    ASSERT_EQ((positions{ 3 }), unistringxx::line_break_positions(U"ée"_us));
+    ASSERT_EQ((positions{ 2, 4 }), unistringxx::line_break_positions(U"\U0001F44D\U0001F3FD\U0001F44D\U0001F3FB"_us));
+    ASSERT_EQ(
+        (positions{ 2, 4 }),
+        unistringxx::line_break_positions(U"\U0001F1EF\U0001F1F5\U0001F1FA\U0001F1F8"_us)
+    );
+
+    // Zero width joiner sequences are not broken.
+    ASSERT_EQ((positions{ 3 }), unistringxx::line_break_positions(U"\U0001F468‍\U0001F469"_us));
+
+    return;
+}
+
+TEST(layout_test, mandatory_breaks)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::ustring text = U"ab\r\ncd\nef"_us;
+    unistringxx::line_breaker breaker{text};
+    ASSERT_TRUE(breaker.next());
+    ASSERT_EQ(static_cast<unistringxx::line_breaker::size_type>(4), breaker.position());
+    ASSERT_TRUE(breaker.is_mandatory());
+    ASSERT_TRUE(breaker.next());
+    ASSERT_EQ(static_cast<unistringxx::line_breaker::size_type>(7), breaker.position());
+    ASSERT_TRUE(breaker.is_mandatory());
+    ASSERT_TRUE(breaker.next());
+    ASSERT_EQ(text.size(), breaker.position());
+    ASSERT_TRUE(breaker.is_mandatory());
+    ASSERT_FALSE(breaker.next());
+
+    const unistringxx::ustring soft_text = U"a b"_us;
+    unistringxx::line_breaker soft_breaker{soft_text};
+    ASSERT_TRUE(soft_breaker.next());
+    ASSERT_FALSE(soft_breaker.is_mandatory());
+
+    return;
+}
+
+TEST(layout_test, wrap)
+{
+    using namespace unistringxx::operators;
+
+    ASSERT_TRUE(unistringxx::wrap(unistringxx::ustring_view{}, 10).empty());
+
+    std::vector<unistringxx::ustring> expected{ U"The quick"_us, U"brown fox"_us, U"jumps"_us };
+    ASSERT_EQ(expected, wrap_lines(U"The quick brown fox jumps"_us, 10));
+
+    // Views refer to the original storage.
+    const unistringxx::ustring text = U"The quick brown"_us;
+    const auto lines = unistringxx::wrap(text, 10);
+    ASSERT_EQ(static_cast<std::size_t>(2), lines.size());
+    ASSERT_EQ(text.data(), lines[0].data());
+    ASSERT_EQ(text.data() + 10, lines[1].data());
+
+    // Mandatory breaks (including empty lines) are kept; line terminators are stripped.
+    expected = std::vector<unistringxx::ustring>{ U"ab"_us, U""_us, U"cd"_us };
+    ASSERT_EQ(expected, wrap_lines(U"ab\r\n\ncd\n"_us, 10));
+
+    // Wide characters take two columns.
+    expected = std::vector<unistringxx::ustring>{ U"日本"_us, U"語。"_us };
+    ASSERT_EQ(expected, wrap_lines(U"日本語。"_us, 5));
+
+    // Words that do not fit in a line are broken between code points.
+    expected = std::vector<unistringxx::ustring>{ U"abcd"_us, U"efgh"_us, U"ij k"_us };
+    ASSERT_EQ(expected, wrap_lines(U"abcdefghij k"_us, 4));
+
+    // Combining marks do not take up columns.
+    expected = std::vector<unistringxx::ustring>{ U"éé"_us, U"x"_us };
+    ASSERT_EQ(expected, wrap_lines(U"éé x"_us, 2));
+
+    return;
+}
+
+TEST(layout_test, grapheme_clusters)
+{
+    using namespace unistringxx::operators;
+
+    auto boundaries = [] (const unistringxx::ustring& text) -> positions {
+        positions result;
+        unistringxx::grapheme_breaker breaker{text};
+        while (breaker.next())
+            result.push_back(breaker.position());
+        return (result);
+    };
+
+    ASSERT_TRUE(boundaries(unistringxx::ustring{}).empty());
+    ASSERT_EQ((positions{ 1, 2, 3 }), boundaries(U"abc"_us));
+    ASSERT_EQ((positions{ 3, 4 }), boundaries(U"é̂x"_us));
+    ASSERT_EQ((positions{ 2, 3 }), boundaries(U"\r\nx"_us));
+    ASSERT_EQ((positions{ 3 }), boundaries(U"각"_us)); // conjoining Hangul jamo
+    ASSERT_EQ((positions{ 2, 4, 5 }), boundaries(U"\U0001F1EF\U0001F1F5\U0001F1FA\U0001F1F8\U0001F1E6"_us));
+    ASSERT_EQ((positions{ 5 }), boundaries(U"\U0001F468‍\U0001F469‍\U0001F467"_us));
+    ASSERT_EQ((positions{ 2, 3 }), boundaries(U"a‍\U0001F469"_us));
+
+    return;
+}
+
+TEST(layout_test, display_width)
+{
+    using namespace unistringxx::operators;
+
+    ASSERT_EQ(static_cast<std::size_t>(0), unistringxx::display_width(unistringxx::ustring{}));
+    ASSERT_EQ(static_cast<std::size_t>(5), unistringxx::display_width(U"hello"_us));
+    ASSERT_EQ(static_cast<std::size_t>(5), unistringxx::display_width(U"hello"_us, unistringxx::ascii_only));
+    ASSERT_EQ(static_cast<std::size_t>(6), unistringxx::display_width(U"日本語"_us));
+    ASSERT_EQ(static_cast<std::size_t>(4), unistringxx::display_width(U"café"_us));
+    ASSERT_EQ(static_cast<std::size_t>(2), unistringxx::display_width(U"\U0001F468‍\U0001F469‍\U0001F467"_us));
+    ASSERT_EQ(static_cast<std::size_t>(2), unistringxx::display_width(U"❤️"_us));
+    ASSERT_EQ(static_cast<std::size_t>(2), unistringxx::display_width(U"\U0001F1EF\U0001F1F5"_us));
+    ASSERT_EQ(static_cast<std::size_t>(2), unistringxx::display_width(U"±±"_us));
+    ASSERT_EQ(static_cast<std::size_t>(4), unistringxx::display_width(U"±±"_us, 2));
+
+    return;
+}
+
+TEST(layout_test, truncate_to_width)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::ustring ellipsis = U"…"_us;
+
+    ASSERT_EQ(U"hello"_us, unistringxx::truncate_to_width(U"hello"_us, 5, ellipsis));
+    ASSERT_EQ(U"hel…"_us, unistringxx::truncate_to_width(U"hello world"_us, 4, ellipsis));
+    ASSERT_EQ(U"hel…"_us, unistringxx::truncate_to_width(U"hello world"_us, 4, ellipsis, unistringxx::ascii_only));
+    ASSERT_EQ(U"hello"_us, unistringxx::truncate_to_width(U"hello"_us, 8, ellipsis, unistringxx::ascii_only));
+
+    // Wide characters are never split in half, and combining sequences are kept whole.
+    ASSERT_EQ(U"日本…"_us, unistringxx::truncate_to_width(U"日本語です"_us, 6, ellipsis));
+    ASSERT_EQ(U"日…"_us, unistringxx::truncate_to_width(U"日本語です"_us, 4, ellipsis));
+    ASSERT_EQ(U"café…"_us, unistringxx::truncate_to_width(U"cafés and more"_us, 5, ellipsis));
+    ASSERT_EQ(U"caf…"_us, unistringxx::truncate_to_width(U"cafés"_us, 4, ellipsis));
+
+    // The ellipsis is dropped if it does not fit.
+    ASSERT_EQ(U"h"_us, unistringxx::truncate_to_width(U"hello"_us, 1, U"..."_us));
+
+    const unistringxx::ustring text = U"cafés"_us;
+    const unistringxx::ustring_view prefix = unistringxx::truncate_view_to_width(text, 4);
+    ASSERT_EQ(text.data(), prefix.data());
+    ASSERT_EQ(static_cast<unistringxx::ustring_view::size_type>(5), prefix.size());
+    ASSERT_EQ(
+        static_cast<unistringxx::ustring_view::size_type>(3),
+        unistringxx::truncate_view_to_width(text, 3, unistringxx::ascii_only).size()
+    );
+
+    return;
+}
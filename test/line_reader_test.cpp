@@ -0,0 +1,143 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/line_reader.hpp>
+
+namespace
+{
+    // Writes the input to a pipe (from which a line_reader reads) and closes the write end, so the input must fit in
+    // the pipe buffer.
+    class pipe_input
+    {
+    public:
+        explicit pipe_input(const std::string& input) :
+            _descriptors{-1, -1}
+        {
+            if (::pipe(_descriptors) == 0) {
+                const ssize_t written = ::write(_descriptors[1], input.data(), input.size());
+                static_cast<void>(written);
+                ::close(_descriptors[1]);
+            }
+            return;
+        }
+
+        ~pipe_input(void)
+        {
+            ::close(_descriptors[0]);
+            return;
+        }
+
+        int descriptor(void) const
+        { return (_descriptors[0]); }
+
+    private:
+        int _descriptors[2];
+    };
+}
+
+TEST(line_reader_test, octets)
+{
+    pipe_input input{"first\r\nsecond\n\n\r\nlast\r"};
+    unistringxx::line_reader reader{input.descriptor()};
+    ASSERT_TRUE(reader.is_open());
+
+    const char* data = nullptr;
+    std::size_t size = 0;
+    const std::string expected_lines[] = {"first", "second", "", "", "last\r"};
+    const std::uint64_t expected_offsets[] = {0, 7, 14, 15, 17};
+    for (std::size_t ctr = 0; ctr < 5; ctr++) {
+        ASSERT_TRUE(reader.read_line(data, size));
+        ASSERT_EQ(expected_lines[ctr], std::string(data, size));
+        ASSERT_EQ(expected_offsets[ctr], reader.line_offset());
+        ASSERT_EQ(ctr + 1, reader.line_number());
+    }
+    ASSERT_FALSE(reader.read_line(data, size));
+    ASSERT_FALSE(reader.read_line(data, size));
+}
+
+TEST(line_reader_test, decoding)
+{
+    using namespace unistringxx::operators;
+
+    pipe_input input{u8"héllo, 世界\r\n𝄞 and a rather long ASCII line to take the fast path\n\xC3(\n"};
+    unistringxx::line_reader reader{input.descriptor()};
+    unistringxx::ustring line;
+    ASSERT_TRUE(reader.read_line(line));
+    ASSERT_EQ(U"héllo, 世界"_us, line);
+    ASSERT_TRUE(reader.read_line(line));
+    ASSERT_EQ(U"𝄞 and a rather long ASCII line to take the fast path"_us, line);
+    ASSERT_THROW(reader.read_line(line), std::range_error);
+    ASSERT_FALSE(reader.read_line(line));
+}
+
+TEST(line_reader_test, small_buffer)
+{
+    using namespace unistringxx::operators;
+
+    // Lines longer than the buffer grow it, and lines split between two reads keep their offsets.
+    std::string input;
+    std::vector<unistringxx::ustring> expected;
+    std::vector<std::uint64_t> offsets;
+    for (std::size_t ctr = 0; ctr < 200; ctr++) {
+        offsets.push_back(input.size());
+        unistringxx::ustring line;
+        for (std::size_t count = 0; count < (ctr % 37); count++) {
+            input += u8"aé世𝄞";
+            line.append(U"aé世𝄞"_us);
+        }
+        input += ((ctr % 3) == 0) ? "\r\n" : "\n";
+        expected.push_back(line);
+    }
+
+    pipe_input pipe{input};
+    unistringxx::line_reader reader{pipe.descriptor(), 16};
+    unistringxx::ustring line;
+    for (std::size_t ctr = 0; ctr < expected.size(); ctr++) {
+        ASSERT_TRUE(reader.read_line(line));
+        ASSERT_EQ(expected[ctr], line);
+        ASSERT_EQ(offsets[ctr], reader.line_offset());
+    }
+    ASSERT_FALSE(reader.read_line(line));
+}
+
+TEST(line_reader_test, file)
+{
+    using namespace unistringxx::operators;
+
+    ASSERT_THROW(unistringxx::line_reader{"/nonexistent/unistringxx/line_reader_test"}, std::runtime_error);
+
+    char path[] = "/tmp/line_reader_test_XXXXXX";
+    const int descriptor = ::mkstemp(path);
+    ASSERT_GE(descriptor, 0);
+    const std::string content{u8"une ligne\ndeux lignes"};
+    ASSERT_EQ(static_cast<ssize_t>(content.size()), ::write(descriptor, content.data(), content.size()));
+    ::close(descriptor);
+
+    {
+        unistringxx::line_reader reader{static_cast<const char*>(path)};
+        unistringxx::ustring line;
+        ASSERT_TRUE(reader.read_line(line));
+        ASSERT_EQ(U"une ligne"_us, line);
+        ASSERT_TRUE(reader.read_line(line));
+        ASSERT_EQ(U"deux lignes"_us, line);
+        ASSERT_EQ(10u, reader.line_offset());
+        ASSERT_FALSE(reader.read_line(line));
+    }
+
+    // The file is closed when the buffer cannot be allocated.
+    const int free_descriptor = ::dup(0);
+    ::close(free_descriptor);
+    ASSERT_ANY_THROW((unistringxx::line_reader{static_cast<const char*>(path), SIZE_MAX / 2}));
+    const int next_descriptor = ::dup(0);
+    ::close(next_descriptor);
+    ASSERT_EQ(free_descriptor, next_descriptor);
+    std::remove(path);
+}
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/mapped_ustring.hpp>
+
+namespace
+{
+    // A temporary file with the given content, removed at the end of the test.
+    class temporary_file
+    {
+    public:
+        explicit temporary_file(const std::string& content)
+        {
+            char path[] = "/tmp/mapped_ustring_test_XXXXXX";
+            const int descriptor = ::mkstemp(path);
+            if (descriptor >= 0) {
+                const ssize_t written = ::write(descriptor, content.data(), content.size());
+                static_cast<void>(written);
+                ::close(descriptor);
+            }
+            _path = path;
+            return;
+        }
+
+        ~temporary_file(void)
+        {
+            std::remove(_path.c_str());
+            return;
+        }
+
+        const char* path(void) const
+        { return (_path.c_str()); }
+
+    private:
+        std::string _path;
+    };
+
+    std::string encode_packed(const unistringxx::ustring& text, std::size_t width)
+    {
+        std::string result;
+        for (unistringxx::uchar_t ch : text) {
+            for (std::size_t ctr = 0; ctr < width; ctr++)
+                result.push_back(static_cast<char>(static_cast<std::uint32_t>(ch.code_point()) >> (ctr * 8)));
+        }
+        return (result);
+    }
+}
+
+TEST(mapped_ustring_test, utf8)
+{
+    using namespace unistringxx::operators;
+
+    // Several pages, with sequences on the page boundaries.
+    unistringxx::ustring expected;
+    std::string content;
+    for (int ctr = 0; ctr < 40000; ctr++) {
+        expected.append(U"aé世𝄞"_us);
+        content += u8"aé世𝄞";
+    }
+    expected.append(U"needle at the end"_us);
+    content += "needle at the end";
+    temporary_file file{content};
+
+    unistringxx::mapped_ustring text{file.path()};
+    ASSERT_EQ(expected.size(), text.size());
+    ASSERT_EQ(content.size(), text.octet_count());
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), text.begin()));
+    ASSERT_TRUE(std::equal(expected.rbegin(), expected.rend(), text.rbegin()));
+    ASSERT_EQ(U'𝄞'_uc, text[70003]);
+    ASSERT_EQ(U'a'_uc, text.at(4));
+    ASSERT_THROW(text.at(text.size()), std::out_of_range);
+    ASSERT_EQ(U"世𝄞a"_us, text.substr(90002, 3));
+
+    ASSERT_EQ(0u, text.find(U"aé"_us));
+    ASSERT_EQ(2u, text.find(U"世"_us));
+    ASSERT_EQ(99998u, text.find(U"世𝄞aé世"_us, 99997));
+    ASSERT_EQ(160000u, text.find(U"needle"_us));
+    ASSERT_EQ(160007u, text.find(U'a'_uc, 159999));
+    ASSERT_EQ(unistringxx::ustring_view::npos, text.find(U"missing"_us));
+
+    ASSERT_TRUE(text == expected);
+    ASSERT_EQ(0, text.compare(expected));
+    ASSERT_GT(text.compare(U"aé世"_us), 0);
+    ASSERT_LT(text.compare(U"b"_us), 0);
+    ASSERT_EQ(expected, text.to_ustring());
+}
+
+TEST(mapped_ustring_test, packed)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::ustring expected = U"packed 世界 𝄞 text, with a 世 repeated"_us;
+    for (std::size_t width = 3; width <= 4; width++) {
+        temporary_file file{encode_packed(expected, width)};
+        unistringxx::mapped_ustring text{
+            file.path(), (width == 3) ? unistringxx::mapped_encoding::utf24 : unistringxx::mapped_encoding::utf32
+        };
+        ASSERT_EQ(expected.size(), text.size());
+        ASSERT_TRUE(text == expected);
+        ASSERT_EQ(7u, text.find(U"世界"_us));
+        ASSERT_EQ(25u, text.find(U'世'_uc, 8));
+        ASSERT_EQ(unistringxx::ustring_view::npos, text.find(U"界世"_us));
+    }
+
+    // A code unit that is not a scalar value, and a misaligned octet pattern that is not a match.
+    temporary_file invalid{std::string{"\x00\xD8\x00\x41\x00\x00", 6}};
+    unistringxx::mapped_ustring text{invalid.path(), unistringxx::mapped_encoding::utf24};
+    ASSERT_FALSE(text[0].is_valid());
+    ASSERT_EQ(U'A'_uc, text[1]);
+    ASSERT_EQ(unistringxx::ustring_view::npos, text.find(unistringxx::uchar_t{0x4100}));
+}
+
+TEST(mapped_ustring_test, errors)
+{
+    using namespace unistringxx::operators;
+
+    ASSERT_THROW(unistringxx::mapped_ustring{"/nonexistent/unistringxx/mapped_ustring_test"}, std::runtime_error);
+
+    temporary_file invalid{"ab\xC3(cd"};
+    ASSERT_THROW(unistringxx::mapped_ustring{invalid.path()}, std::range_error);
+    temporary_file truncated{"abcde"};
+    ASSERT_THROW(
+        unistringxx::mapped_ustring(truncated.path(), unistringxx::mapped_encoding::utf32), std::range_error
+    );
+
+    temporary_file empty{""};
+    unistringxx::mapped_ustring text{empty.path()};
+    ASSERT_TRUE(text.empty());
+    ASSERT_TRUE(text == U""_us);
+    ASSERT_EQ(0u, text.find(U""_us));
+
+    unistringxx::mapped_ustring moved{std::move(text)};
+    ASSERT_TRUE(moved.empty());
+}
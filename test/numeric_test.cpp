@@ -0,0 +1,191 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/numeric.hpp>
+
+TEST(numeric_test, from_chars_integers)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::ustring text = U"12345 rest"_us;
+    int value = 0;
+    unistringxx::from_chars_result result = unistringxx::from_chars(text.data(), text.data() + text.size(), value);
+    ASSERT_EQ(std::errc(), result.ec);
+    ASSERT_EQ(12345, value);
+    ASSERT_EQ(text.data() + 5, result.ptr);
+
+    result = unistringxx::from_chars(U"-42"_us, value);
+    ASSERT_EQ(std::errc(), result.ec);
+    ASSERT_EQ(-42, value);
+
+    // No sign for unsigned types, no '+', no whitespace, no base prefix.
+    unsigned int unsigned_value = 7;
+    const unistringxx::ustring negative = U"-1"_us;
+    result = unistringxx::from_chars(negative, unsigned_value);
+    ASSERT_EQ(std::errc::invalid_argument, result.ec);
+    ASSERT_EQ(negative.data(), result.ptr);
+    ASSERT_EQ(7u, unsigned_value);
+    ASSERT_EQ(std::errc::invalid_argument, unistringxx::from_chars(U"+1"_us, value).ec);
+    ASSERT_EQ(std::errc::invalid_argument, unistringxx::from_chars(U" 1"_us, value).ec);
+    ASSERT_EQ(std::errc::invalid_argument, unistringxx::from_chars(U""_us, value).ec);
+    ASSERT_EQ(std::errc::invalid_argument, unistringxx::from_chars(U"-"_us, value).ec);
+
+    const unistringxx::ustring hex = U"0x1F"_us;
+    result = unistringxx::from_chars(hex, value, 16);
+    ASSERT_EQ(0, value);
+    ASSERT_EQ(hex.data() + 1, result.ptr);
+
+    // Other bases.
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"ff"_us, value, 16).ec);
+    ASSERT_EQ(255, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"Zz"_us, value, 36).ec);
+    ASSERT_EQ(1295, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"1012"_us, value, 2).ec);
+    ASSERT_EQ(5, value);
+    ASSERT_EQ(std::errc::invalid_argument, unistringxx::from_chars(U"1"_us, value, 1).ec);
+
+    // Limits.
+    std::int8_t small_value = 0;
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"-128"_us, small_value).ec);
+    ASSERT_EQ(-128, small_value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"127"_us, small_value).ec);
+    ASSERT_EQ(127, small_value);
+    const unistringxx::ustring too_large = U"128x"_us;
+    result = unistringxx::from_chars(too_large, small_value);
+    ASSERT_EQ(std::errc::result_out_of_range, result.ec);
+    ASSERT_EQ(too_large.data() + 3, result.ptr);
+    ASSERT_EQ(127, small_value);
+    ASSERT_EQ(std::errc::result_out_of_range, unistringxx::from_chars(U"-129"_us, small_value).ec);
+
+    long long long_value = 0;
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"-9223372036854775808"_us, long_value).ec);
+    ASSERT_EQ(std::numeric_limits<long long>::min(), long_value);
+    unsigned long long unsigned_long_value = 0;
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"18446744073709551615"_us, unsigned_long_value).ec);
+    ASSERT_EQ(std::numeric_limits<unsigned long long>::max(), unsigned_long_value);
+    ASSERT_EQ(
+        std::errc::result_out_of_range, unistringxx::from_chars(U"18446744073709551616"_us, unsigned_long_value).ec
+    );
+}
+
+TEST(numeric_test, from_chars_unicode_digits)
+{
+    using namespace unistringxx::operators;
+
+    // Only ASCII digits by default.
+    int value = 0;
+    ASSERT_EQ(std::errc::invalid_argument, unistringxx::from_chars(U"٤٢"_us, value).ec);
+
+    // Arabic-Indic, Devanagari, fullwidth and mixed digits.
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"٤٢"_us, value, 10, unistringxx::digit_set::unicode).ec);
+    ASSERT_EQ(42, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"-१२३"_us, value, 10, unistringxx::digit_set::unicode).ec);
+    ASSERT_EQ(-123, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"２０２４"_us, value, 10, unistringxx::digit_set::unicode).ec);
+    ASSERT_EQ(2024, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"1٢३"_us, value, 10, unistringxx::digit_set::unicode).ec);
+    ASSERT_EQ(123, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"\U0001D7D9"_us, value, 10, unistringxx::digit_set::unicode).ec);
+    ASSERT_EQ(1, value);
+
+    // Other numbers (e.g. superscripts, Roman numerals) are not decimal digits.
+    ASSERT_EQ(
+        std::errc::invalid_argument, unistringxx::from_chars(U"²"_us, value, 10, unistringxx::digit_set::unicode).ec
+    );
+    ASSERT_EQ(
+        std::errc::invalid_argument, unistringxx::from_chars(U"Ⅻ"_us, value, 10, unistringxx::digit_set::unicode).ec
+    );
+
+    double double_value = 0;
+    ASSERT_EQ(
+        std::errc(),
+        unistringxx::from_chars(
+            U"٣.٥"_us, double_value, unistringxx::chars_format::general, unistringxx::digit_set::unicode
+        ).ec
+    );
+    ASSERT_EQ(3.5, double_value);
+}
+
+TEST(numeric_test, from_chars_floating_point)
+{
+    using namespace unistringxx::operators;
+
+    double value = 0;
+    const unistringxx::ustring text = U"3.25e2x"_us;
+    unistringxx::from_chars_result result = unistringxx::from_chars(text, value);
+    ASSERT_EQ(std::errc(), result.ec);
+    ASSERT_EQ(325.0, value);
+    ASSERT_EQ(text.data() + 6, result.ptr);
+
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"-0.001"_us, value).ec);
+    ASSERT_EQ(-0.001, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U".5"_us, value).ec);
+    ASSERT_EQ(0.5, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"7."_us, value).ec);
+    ASSERT_EQ(7.0, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"-0"_us, value).ec);
+    ASSERT_TRUE(std::signbit(value));
+
+    // Correct rounding beyond the fast path.
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"0.1"_us, value).ec);
+    ASSERT_EQ(0.1, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"1.7976931348623157e308"_us, value).ec);
+    ASSERT_EQ(std::numeric_limits<double>::max(), value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"2.2250738585072014e-308"_us, value).ec);
+    ASSERT_EQ(std::numeric_limits<double>::min(), value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"4.9406564584124654e-324"_us, value).ec);
+    ASSERT_EQ(std::numeric_limits<double>::denorm_min(), value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"3.14159265358979323846264338327950288"_us, value).ec);
+    ASSERT_EQ(3.14159265358979323846264338327950288, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"123456789012345678901234567890"_us, value).ec);
+    ASSERT_EQ(123456789012345678901234567890.0, value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"0.000000000000000000000000000123456789012345678901"_us, value).ec);
+    ASSERT_EQ(0.000000000000000000000000000123456789012345678901, value);
+
+    float float_value = 0;
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"16777217"_us, float_value).ec);
+    ASSERT_EQ(16777216.0f, float_value);
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"0.1"_us, float_value).ec);
+    ASSERT_EQ(0.1f, float_value);
+    long double long_double_value = 0;
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"0.1"_us, long_double_value).ec);
+    ASSERT_EQ(0.1L, long_double_value);
+
+    // Out of range values leave the value untouched.
+    value = 1.0;
+    ASSERT_EQ(std::errc::result_out_of_range, unistringxx::from_chars(U"1e400"_us, value).ec);
+    ASSERT_EQ(std::errc::result_out_of_range, unistringxx::from_chars(U"-1e-400"_us, value).ec);
+    ASSERT_EQ(1.0, value);
+
+    // Infinity and NaN.
+    ASSERT_EQ(std::errc(), unistringxx::from_chars(U"-Infinity"_us, value).ec);
+    ASSERT_EQ(-std::numeric_limits<double>::infinity(), value);
+    const unistringxx::ustring inf_text = U"infinite"_us;
+    result = unistringxx::from_chars(inf_text, value);
+    ASSERT_EQ(inf_text.data() + 3, result.ptr);
+    const unistringxx::ustring nan_text = U"nan(0x1)"_us;
+    result = unistringxx::from_chars(nan_text, value);
+    ASSERT_EQ(std::errc(), result.ec);
+    ASSERT_TRUE(std::isnan(value));
+    ASSERT_EQ(nan_text.data() + nan_text.size(), result.ptr);
+
+    // Formats.
+    const unistringxx::ustring exponent_text = U"1e5"_us;
+    result = unistringxx::from_chars(exponent_text, value, unistringxx::chars_format::fixed);
+    ASSERT_EQ(1.0, value);
+    ASSERT_EQ(exponent_text.data() + 1, result.ptr);
+    ASSERT_EQ(
+        std::errc::invalid_argument, unistringxx::from_chars(U"15"_us, value, unistringxx::chars_format::scientific).ec
+    );
+    const unistringxx::ustring incomplete_exponent = U"2e+"_us;
+    result = unistringxx::from_chars(incomplete_exponent, value);
+    ASSERT_EQ(2.0, value);
+    ASSERT_EQ(incomplete_exponent.data() + 1, result.ptr);
+
+    ASSERT_EQ(std::errc::invalid_argument, unistringxx::from_chars(U"."_us, value).ec);
+    ASSERT_EQ(std::errc::invalid_argument, unistringxx::from_chars(U"e5"_us, value).ec);
+}
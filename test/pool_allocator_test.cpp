@@ -0,0 +1,105 @@
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/pool_allocator.hpp>
+
+TEST(pool_allocator_test, free_lists)
+{
+    unistringxx::buffer_pool::trim();
+    unistringxx::buffer_pool::reset_thread_statistics();
+
+    void* first = unistringxx::buffer_pool::allocate(100);
+    ASSERT_EQ(0u, unistringxx::buffer_pool::thread_statistics().hits);
+    ASSERT_EQ(1u, unistringxx::buffer_pool::thread_statistics().misses);
+    unistringxx::buffer_pool::deallocate(first, 100);
+
+    // The same size class (65 to 128 bytes) reuses the buffer.
+    void* second = unistringxx::buffer_pool::allocate(120);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(1u, unistringxx::buffer_pool::thread_statistics().hits);
+    unistringxx::buffer_pool::deallocate(second, 120);
+
+    // Another size class does not.
+    void* third = unistringxx::buffer_pool::allocate(20);
+    ASSERT_EQ(2u, unistringxx::buffer_pool::thread_statistics().misses);
+    unistringxx::buffer_pool::deallocate(third, 20);
+
+    // Large buffers are not pooled.
+    void* large = unistringxx::buffer_pool::allocate(100000);
+    unistringxx::buffer_pool::deallocate(large, 100000);
+    large = unistringxx::buffer_pool::allocate(100000);
+    ASSERT_EQ(1u, unistringxx::buffer_pool::thread_statistics().hits);
+    ASSERT_EQ(4u, unistringxx::buffer_pool::thread_statistics().misses);
+    unistringxx::buffer_pool::deallocate(large, 100000);
+
+    unistringxx::buffer_pool::trim();
+    void* fourth = unistringxx::buffer_pool::allocate(120);
+    ASSERT_EQ(5u, unistringxx::buffer_pool::thread_statistics().misses);
+    unistringxx::buffer_pool::deallocate(fourth, 120);
+}
+
+TEST(pool_allocator_test, pool_ustring)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::buffer_pool::reset_thread_statistics();
+    const unistringxx::ustring source = U"a short-lived temporary"_us;
+    for (int ctr = 0; ctr < 1000; ctr++) {
+        unistringxx::pool_ustring text{source.data(), source.size()};
+        text.append(U"!"_us.data());
+        ASSERT_EQ(source.size() + 1, text.size());
+    }
+    // Only the first iteration should miss (for each size class used).
+    const unistringxx::buffer_pool::statistics statistics = unistringxx::buffer_pool::thread_statistics();
+    ASSERT_LE(statistics.misses, 2u);
+    ASSERT_GE(statistics.hits, 1998u);
+
+    unistringxx::pool_ustring left{U"left"_us.data()};
+    unistringxx::pool_ustring right{U"right"_us.data()};
+    left.swap(right);
+    ASSERT_EQ(U"right"_us.data(), left);
+    left = std::move(right);
+    ASSERT_EQ(U"left"_us.data(), left);
+}
+
+TEST(pool_allocator_test, threads)
+{
+    using namespace unistringxx::operators;
+
+    // Strings created on one thread and destroyed on another: the buffers join the free lists of the destroying
+    // thread.
+    std::vector<unistringxx::pool_ustring> texts;
+    std::thread producer{
+        [&texts](void) -> void {
+            for (int ctr = 0; ctr < 1000; ctr++)
+                texts.push_back(unistringxx::pool_ustring{U"moved across threads"_us.data()});
+            return;
+        }
+    };
+    producer.join();
+
+    unistringxx::buffer_pool::trim();
+    unistringxx::buffer_pool::reset_thread_statistics();
+    for (const unistringxx::pool_ustring& text : texts)
+        ASSERT_EQ(U"moved across threads"_us.data(), text);
+    texts.clear();
+    texts.shrink_to_fit();
+    const unistringxx::pool_ustring reused{U"moved across threads"_us.data()};
+    ASSERT_EQ(1u, unistringxx::buffer_pool::thread_statistics().hits);
+    ASSERT_EQ(0u, unistringxx::buffer_pool::thread_statistics().misses);
+
+    // Strings freed during thread exit, after the cache of the thread is destroyed (the vector is constructed first,
+    // so it is destroyed last).
+    std::thread late{
+        [](void) -> void {
+            static thread_local std::vector<unistringxx::pool_ustring> late_texts;
+            late_texts.push_back(unistringxx::pool_ustring{U"destroyed at thread exit"_us.data()});
+            return;
+        }
+    };
+    late.join();
+}
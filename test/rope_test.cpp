@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/rope.hpp>
+
+namespace
+{
+    unistringxx::ustring make_text(std::size_t size)
+    {
+        unistringxx::ustring result;
+        for (std::size_t ctr = 0; ctr < size; ctr++)
+            result.push_back(unistringxx::uchar_t{static_cast<int>((ctr % 2) ? ('a' + (ctr % 26)) : (0x3041 + (ctr % 80)))});
+        return (result);
+    }
+}
+
+TEST(rope_test, construction)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::rope empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(0u, empty.size());
+    ASSERT_EQ(empty.begin(), empty.end());
+    ASSERT_EQ(U""_us, empty.to_ustring());
+
+    const unistringxx::rope small{U"hello, 世界"_us};
+    ASSERT_EQ(9u, small.size());
+    ASSERT_EQ(U"hello, 世界"_us, small.to_ustring());
+    ASSERT_TRUE(small == U"hello, 世界"_us);
+    ASSERT_EQ(U'世'_uc, small[7]);
+    ASSERT_EQ('h'_uc, small.at(0));
+    ASSERT_THROW(small.at(9), std::out_of_range);
+
+    const unistringxx::ustring text = make_text(100000);
+    const unistringxx::rope large{text};
+    ASSERT_EQ(text.size(), large.size());
+    ASSERT_TRUE(large == text);
+    ASSERT_LE(large.get_height(), 8u);
+    for (std::size_t ctr = 0; ctr < text.size(); ctr += 997)
+        ASSERT_EQ(text[ctr], large[ctr]);
+
+    // The iterators work with the standard algorithms and the ustring constructors.
+    ASSERT_EQ(text, unistringxx::ustring(large.begin(), large.end()));
+    ASSERT_TRUE(std::equal(text.rbegin(), text.rend(), large.rbegin()));
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(text.size()), large.end() - large.begin());
+    ASSERT_EQ(text[5000], *(large.begin() + 5000));
+    ASSERT_EQ(text[4999], large.begin()[4999]);
+}
+
+TEST(rope_test, editing)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::rope text{U"hello world"_us};
+    text.insert(5, U","_us);
+    ASSERT_TRUE(text == U"hello, world"_us);
+    text.insert(0, U"> "_us);
+    text.insert(text.size(), U"!"_us);
+    ASSERT_TRUE(text == U"> hello, world!"_us);
+    text.erase(0, 2);
+    ASSERT_TRUE(text == U"hello, world!"_us);
+    text.replace(7, 5, U"ロープ"_us);
+    ASSERT_TRUE(text == U"hello, ロープ!"_us);
+    text.erase(5);
+    ASSERT_TRUE(text == U"hello"_us);
+    text.append(U" again"_us);
+    ASSERT_TRUE(text == U"hello again"_us);
+    ASSERT_EQ(6u, text.find(U"again"_us));
+    ASSERT_EQ(unistringxx::ustring_view::npos, text.find(U"none"_us));
+    ASSERT_THROW(text.insert(100, U"x"_us), std::out_of_range);
+    ASSERT_THROW(text.erase(100), std::out_of_range);
+
+    const std::pair<unistringxx::rope, unistringxx::rope> parts = text.split(5);
+    ASSERT_TRUE(parts.first == U"hello"_us);
+    ASSERT_TRUE(parts.second == U" again"_us);
+    ASSERT_TRUE((parts.first + parts.second) == text);
+    ASSERT_TRUE(text.substr(6, 3) == U"aga"_us);
+    text.clear();
+    ASSERT_TRUE(text.empty());
+}
+
+TEST(rope_test, random_edits)
+{
+    // Compare against ustring after many random edits on a large text.
+    unistringxx::ustring expected = make_text(30000);
+    unistringxx::rope actual{expected};
+    std::mt19937 random{7};
+    for (int ctr = 0; ctr < 1000; ctr++) {
+        const std::size_t index = random() % (expected.size() + 1);
+        switch (random() % 4) {
+        case 0: {
+            const unistringxx::ustring piece = make_text(random() % 3000);
+            expected.insert(index, piece);
+            actual.insert(index, piece);
+            break;
+        }
+        case 1: {
+            const std::size_t count = random() % 2000;
+            expected.erase(index, count);
+            actual.erase(index, count);
+            break;
+        }
+        case 2: {
+            const std::size_t count = random() % 100;
+            const unistringxx::ustring piece = make_text(random() % 100);
+            expected.replace(index, std::min(count, expected.size() - index), piece);
+            actual.replace(index, count, piece);
+            break;
+        }
+        default: {
+            // Typing: a single code point.
+            expected.insert(index, 1, unistringxx::uchar_t{'x'});
+            actual.insert(index, unistringxx::ustring(1, unistringxx::uchar_t{'x'}));
+            break;
+        }
+        }
+        ASSERT_EQ(expected.size(), actual.size());
+    }
+    ASSERT_EQ(expected, actual.to_ustring());
+    // The tree stays balanced (AVL height is at most about 1.44 log2 of the chunk count).
+    ASSERT_LE(actual.get_height(), 20u);
+
+    std::size_t chunk_total = 0;
+    actual.for_each_chunk([&chunk_total](unistringxx::ustring_view chunk) { chunk_total += chunk.size(); });
+    ASSERT_EQ(expected.size(), chunk_total);
+}
+
+TEST(rope_test, snapshots)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::rope document{unistringxx::ustring_view{make_text(20000)}};
+    std::vector<unistringxx::rope> history;
+    std::vector<unistringxx::ustring> expected;
+    for (int ctr = 0; ctr < 50; ctr++) {
+        history.push_back(document);
+        expected.push_back(document.to_ustring());
+        document.insert(static_cast<std::size_t>(ctr * 300), U"edit"_us);
+        document.erase(static_cast<std::size_t>(ctr * 7), 3);
+    }
+    // Undo: every snapshot still has its own content.
+    for (std::size_t ctr = 0; ctr < history.size(); ctr++)
+        ASSERT_EQ(expected[ctr], history[ctr].to_ustring());
+    document = history.front();
+    ASSERT_TRUE(document == history.front());
+}
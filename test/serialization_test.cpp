@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/serialization.hpp>
+
+TEST(serialization_test, strings)
+{
+    using namespace unistringxx::operators;
+
+    // Each string takes the narrowest width, and the records are concatenated.
+    const unistringxx::ustring texts[] = {U"latin: é"_us, U"cjk: 世界"_us, U"music: 𝄞"_us, U""_us};
+    const std::size_t widths[] = {1, 2, 3, 1};
+    std::vector<std::uint8_t> buffer;
+    for (const unistringxx::ustring& text : texts) {
+        const std::size_t record_size = unistringxx::serialize(text, buffer);
+        ASSERT_EQ(0u, record_size % 4);
+    }
+    ASSERT_EQ(0u, buffer.size() % 4);
+
+    std::size_t offset = 0;
+    std::size_t offsets[4];
+    for (std::size_t ctr = 0; ctr < 4; ctr++) {
+        offsets[ctr] = offset;
+        const unistringxx::serialized_ustring_view view{buffer.data() + offset, buffer.size() - offset};
+        ASSERT_EQ(widths[ctr], view.width());
+        ASSERT_EQ(texts[ctr].size(), view.size());
+        ASSERT_TRUE(view == texts[ctr]);
+        ASSERT_EQ(texts[ctr], view.to_ustring());
+        ASSERT_TRUE(std::equal(view.rbegin(), view.rend(), texts[ctr].rbegin()));
+        offset += view.record_size();
+    }
+    ASSERT_EQ(buffer.size(), offset);
+
+    // The 3-octet layout is the layout of uchar in memory (except in test builds, where uchar takes 4 octets).
+    const unistringxx::serialized_ustring_view music{buffer.data() + offsets[2], buffer.size() - offsets[2]};
+    ASSERT_EQ(3u, music.width());
+    unistringxx::ustring_view view;
+    ASSERT_EQ(sizeof (unistringxx::uchar_t) == 3, music.get_view(view));
+    ASSERT_FALSE(unistringxx::serialized_ustring_view(buffer.data(), buffer.size()).get_view(view));
+
+    // Invalid code points are kept.
+    const unistringxx::uchar_t invalid[] = {unistringxx::uchar_t{0xD800}, unistringxx::uchar_t{'a'}};
+    buffer.clear();
+    unistringxx::serialize(unistringxx::ustring_view{invalid, 2}, buffer);
+    const unistringxx::serialized_ustring_view invalid_view{buffer.data(), buffer.size()};
+    ASSERT_FALSE(invalid_view[0].is_valid());
+    ASSERT_EQ(U'a'_uc, invalid_view.at(1));
+    ASSERT_THROW(invalid_view.at(2), std::out_of_range);
+}
+
+TEST(serialization_test, native_width)
+{
+    using namespace unistringxx::operators;
+
+    // The native width stores the code points like uchar in memory, so even ASCII and BMP texts load without copying.
+    const unistringxx::ustring texts[] = {U"ascii"_us, U"cjk: 世界"_us, U"music: 𝄞"_us, U""_us};
+    std::vector<std::uint8_t> buffer;
+    for (const unistringxx::ustring& text : texts)
+        unistringxx::serialize(text, buffer, unistringxx::serialized_width::native);
+
+    std::size_t offset = 0;
+    for (const unistringxx::ustring& text : texts) {
+        const unistringxx::serialized_ustring_view serialized{buffer.data() + offset, buffer.size() - offset};
+        ASSERT_EQ(sizeof (unistringxx::uchar_t), serialized.width());
+        ASSERT_TRUE(serialized == text);
+        unistringxx::ustring_view view;
+        ASSERT_TRUE(serialized.get_view(view));
+        ASSERT_EQ(text, view);
+        ASSERT_EQ(buffer.data() + offset + 12, reinterpret_cast<const std::uint8_t*>(view.data()));
+        offset += serialized.record_size();
+    }
+    ASSERT_EQ(buffer.size(), offset);
+
+    // Invalid code points are kept as they are stored.
+    const unistringxx::uchar_t invalid[] = {
+        unistringxx::uchar_t{unistringxx::uchar_t::invalid_value}, unistringxx::uchar_t{'a'}
+    };
+    buffer.clear();
+    unistringxx::serialize(unistringxx::ustring_view{invalid, 2}, buffer, unistringxx::serialized_width::native);
+    const unistringxx::serialized_ustring_view invalid_view{buffer.data(), buffer.size()};
+    unistringxx::ustring_view view;
+    ASSERT_TRUE(invalid_view.get_view(view));
+    ASSERT_EQ(invalid[0], view[0]);
+    ASSERT_EQ(invalid[0], invalid_view[0]);
+
+    const std::vector<unistringxx::ustring> table_texts{U"first"_us, U"世界"_us};
+    buffer.clear();
+    unistringxx::serialize_table(
+        table_texts.begin(), table_texts.end(), buffer, unistringxx::serialized_width::native
+    );
+    const unistringxx::serialized_table_view table{buffer.data(), buffer.size()};
+    ASSERT_EQ(sizeof (unistringxx::uchar_t), table.width());
+    for (std::size_t ctr = 0; ctr < table_texts.size(); ctr++) {
+        ASSERT_TRUE(table[ctr].get_view(view));
+        ASSERT_EQ(table_texts[ctr], view);
+    }
+}
+
+TEST(serialization_test, tables)
+{
+    using namespace unistringxx::operators;
+
+    const std::vector<unistringxx::ustring> texts{U"first"_us, U""_us, U"世界"_us, U"last"_us};
+    std::vector<std::uint8_t> buffer;
+    const std::size_t record_size = unistringxx::serialize_table(texts.begin(), texts.end(), buffer);
+    ASSERT_EQ(buffer.size(), record_size);
+
+    const unistringxx::serialized_table_view table{buffer.data(), buffer.size()};
+    ASSERT_EQ(4u, table.size());
+    ASSERT_EQ(2u, table.width());
+    ASSERT_EQ(record_size, table.record_size());
+    for (std::size_t ctr = 0; ctr < texts.size(); ctr++)
+        ASSERT_TRUE(table[ctr] == texts[ctr]);
+    ASSERT_THROW(table.at(4), std::out_of_range);
+
+    // A string record is not a table record.
+    buffer.clear();
+    unistringxx::serialize(U"text"_us, buffer);
+    ASSERT_THROW(unistringxx::serialized_table_view(buffer.data(), buffer.size()), std::range_error);
+
+    const std::vector<unistringxx::ustring> no_texts;
+    buffer.clear();
+    unistringxx::serialize_table(no_texts.begin(), no_texts.end(), buffer);
+    ASSERT_TRUE(unistringxx::serialized_table_view(buffer.data(), buffer.size()).empty());
+}
+
+TEST(serialization_test, corrupted_input)
+{
+    using namespace unistringxx::operators;
+
+    std::vector<std::uint8_t> string_buffer;
+    unistringxx::serialize(U"a string with 世界 and 𝄞"_us, string_buffer);
+    const std::vector<unistringxx::ustring> texts{U"one"_us, U"two 世"_us, U"three"_us};
+    std::vector<std::uint8_t> table_buffer;
+    unistringxx::serialize_table(texts.begin(), texts.end(), table_buffer);
+
+    // Every truncation is rejected.
+    for (std::size_t size = 0; size < string_buffer.size(); size++)
+        ASSERT_THROW(unistringxx::serialized_ustring_view(string_buffer.data(), size), std::range_error);
+    for (std::size_t size = 0; size < table_buffer.size(); size++)
+        ASSERT_THROW(unistringxx::serialized_table_view(table_buffer.data(), size), std::range_error);
+    ASSERT_THROW(unistringxx::serialized_ustring_view(nullptr, 0), std::range_error);
+
+    // Random corruption either is rejected or loads a view that stays within the buffer (this is best run with the
+    // address sanitizer).
+    std::mt19937 random{42};
+    for (int ctr = 0; ctr < 20000; ctr++) {
+        std::vector<std::uint8_t> buffer = ((ctr % 2) == 0) ? string_buffer : table_buffer;
+        for (int count = 1 + static_cast<int>(random() % 3); count > 0; count--)
+            buffer[random() % buffer.size()] = static_cast<std::uint8_t>(random());
+        const std::size_t size = buffer.size() - (random() % 8);
+        try {
+            if ((ctr % 2) == 0) {
+                const unistringxx::serialized_ustring_view view{buffer.data(), size};
+                ASSERT_LE(view.record_size(), size);
+                ASSERT_LE(12 + (view.size() * view.width()), size);
+                view.to_ustring();
+            }
+            else {
+                const unistringxx::serialized_table_view table{buffer.data(), size};
+                ASSERT_LE(table.record_size(), size);
+                for (std::size_t index = 0; index < table.size(); index++)
+                    table[index].to_ustring();
+            }
+        }
+        catch (const std::range_error&) {
+        }
+    }
+}
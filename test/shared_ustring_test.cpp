@@ -0,0 +1,148 @@
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/shared_ustring.hpp>
+
+TEST(shared_ustring_test, construction)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::shared_ustring empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(0, empty.use_count());
+    ASSERT_EQ(U""_us, empty.mutable_copy());
+
+    const unistringxx::ustring source = U"hello, 世界"_us;
+    const unistringxx::shared_ustring copied{unistringxx::ustring_view{source}};
+    ASSERT_EQ(source.size(), copied.size());
+    ASSERT_NE(source.data(), copied.data());
+    ASSERT_TRUE(copied == source);
+
+    // Taking a ustring keeps its buffer.
+    unistringxx::ustring adopted_source = U"adopted"_us;
+    const unistringxx::uchar_t* adopted_data = adopted_source.data();
+    const unistringxx::shared_ustring adopted{std::move(adopted_source)};
+    ASSERT_EQ(adopted_data, adopted.data());
+    ASSERT_TRUE(adopted == U"adopted"_us);
+    ASSERT_EQ(1, adopted.use_count());
+
+    // Copies share the buffer.
+    unistringxx::shared_ustring copy{adopted};
+    ASSERT_EQ(adopted.data(), copy.data());
+    ASSERT_EQ(2, adopted.use_count());
+    unistringxx::shared_ustring moved{std::move(copy)};
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(2, adopted.use_count());
+    moved = empty;
+    ASSERT_EQ(1, adopted.use_count());
+    moved = adopted;
+    ASSERT_EQ(2, moved.use_count());
+    moved = moved;
+    ASSERT_EQ(2, moved.use_count());
+}
+
+TEST(shared_ustring_test, slices)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::shared_ustring text{U"key=value;other"_us};
+    const unistringxx::shared_ustring value = text.substr(4, 5);
+    ASSERT_TRUE(value == U"value"_us);
+    ASSERT_EQ(text.data() + 4, value.data());
+    ASSERT_EQ(2, text.use_count());
+    ASSERT_TRUE(text.substr(10) == U"other"_us);
+    ASSERT_TRUE(text.substr(text.size()).empty());
+    ASSERT_THROW(text.substr(text.size() + 1), std::out_of_range);
+    ASSERT_TRUE(value.substr(1, 2) == U"al"_us);
+
+    ASSERT_EQ(4u, text.find('v'_uc));
+    ASSERT_EQ(10u, text.find(U"other"_us));
+    ASSERT_EQ(unistringxx::ustring_view::npos, value.find(U"other"_us));
+    ASSERT_EQ(3u, value.rfind('u'_uc));
+    ASSERT_EQ('v'_uc, value.front());
+    ASSERT_EQ('e'_uc, value.back());
+    ASSERT_EQ('a'_uc, value.at(1));
+    ASSERT_THROW(value.at(5), std::out_of_range);
+    ASSERT_EQ(U"value"_us, unistringxx::ustring(value.begin(), value.end()));
+
+    // Compacting copies the slice to its own buffer.
+    unistringxx::shared_ustring compacted{value};
+    compacted.compact();
+    ASSERT_TRUE(compacted == value);
+    ASSERT_NE(value.data(), compacted.data());
+    ASSERT_EQ(1, compacted.use_count());
+}
+
+TEST(shared_ustring_test, mutable_copy)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::shared_ustring text{U"shared text"_us};
+    unistringxx::shared_ustring other{text};
+
+    // Shared buffers are copied.
+    unistringxx::ustring copy = std::move(text).mutable_copy();
+    ASSERT_EQ(U"shared text"_us, copy);
+    ASSERT_NE(other.data(), copy.data());
+    copy.append(U"!"_us);
+    ASSERT_TRUE(other == U"shared text"_us);
+
+    // A unique buffer is taken over.
+    const unistringxx::uchar_t* data = other.data();
+    unistringxx::ustring taken = std::move(other).mutable_copy();
+    ASSERT_EQ(U"shared text"_us, taken);
+    ASSERT_EQ(data, taken.data());
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(0, other.use_count());
+
+    // A unique slice keeps only the sliced part.
+    unistringxx::shared_ustring slice = unistringxx::shared_ustring{U"shared text"_us}.substr(2, 4);
+    ASSERT_EQ(U"ared"_us, std::move(slice).mutable_copy());
+    ASSERT_EQ(U"ared"_us, unistringxx::shared_ustring{U"shared text"_us}.substr(2, 4).mutable_copy());
+}
+
+TEST(shared_ustring_test, comparison)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::shared_ustring text_a{U"apple"_us};
+    const unistringxx::shared_ustring text_b{U"banana"_us};
+    const unistringxx::shared_ustring text_c{U"apple"_us};
+    ASSERT_TRUE(text_a == text_c);
+    ASSERT_TRUE(text_a != text_b);
+    ASSERT_TRUE(text_a < text_b);
+    ASSERT_TRUE(text_b >= text_a);
+    ASSERT_TRUE(text_a == U"apple"_us);
+    ASSERT_TRUE(U"apple"_us == text_a);
+    ASSERT_TRUE(text_a != U"apples"_us);
+    ASSERT_GT(text_b.compare(U"apple"_us), 0);
+
+    std::unordered_set<unistringxx::shared_ustring> texts{text_a, text_b, text_c};
+    ASSERT_EQ(2u, texts.size());
+    ASSERT_EQ(std::hash<unistringxx::ustring>{}(U"apple"_us), std::hash<unistringxx::shared_ustring>{}(text_a));
+}
+
+TEST(shared_ustring_test, threads)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::shared_ustring text{unistringxx::ustring(1000, 'x'_uc)};
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; thread++) {
+        threads.push_back(std::thread{[text]() {
+            for (int ctr = 0; ctr < 10000; ctr++) {
+                unistringxx::shared_ustring copy{text};
+                unistringxx::shared_ustring slice = copy.substr(static_cast<std::size_t>(ctr % 1000));
+                (void) slice;
+            }
+        }});
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    ASSERT_EQ(1, text.use_count());
+}
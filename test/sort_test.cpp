@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/sort.hpp>
+#include <unistringxx/ustring.hpp>
+
+namespace
+{
+    // Texts with long shared prefixes, duplicates and code points from every plane.
+    std::vector<unistringxx::ustring> make_texts(std::size_t count, std::uint32_t seed)
+    {
+        const unistringxx::ustring prefixes[] = {
+            unistringxx::ustring{}, unistringxx::ustring(20, U'あ'), unistringxx::ustring(3, 'a'),
+            unistringxx::ustring(40, U'\U0001F600')
+        };
+        const char32_t alphabet[] = { U'\0', U'a', U'b', U'ÿ', U'Ā', U'あ', U'\U0001F600', U'\U0010FFFD' };
+        std::mt19937 random{seed};
+        std::vector<unistringxx::ustring> result;
+        result.reserve(count);
+        for (std::size_t ctr = 0; ctr < count; ctr++) {
+            unistringxx::ustring text{prefixes[random() % 4]};
+            const std::size_t size = random() % 6;
+            for (std::size_t itr = 0; itr < size; itr++)
+                text.push_back(unistringxx::uchar_t::from_utf32(alphabet[random() % 8]));
+            result.push_back(text);
+        }
+        return (result);
+    }
+
+    struct tagged_text
+    {
+        unistringxx::ustring text;
+        std::size_t tag;
+
+        operator unistringxx::ustring_view(void) const
+        { return (unistringxx::ustring_view{text}); }
+    };
+}
+
+TEST(sort_test, string_sort)
+{
+    using namespace unistringxx::operators;
+
+    std::vector<unistringxx::ustring> texts = {
+        U"b"_us, U"ab"_us, U""_us, U"a"_us, U"Ā"_us, U"ÿ"_us, U"ab"_us, U"\U00010000"_us
+    };
+    unistringxx::string_sort(texts.begin(), texts.end());
+    const std::vector<unistringxx::ustring> expected = {
+        U""_us, U"a"_us, U"ab"_us, U"ab"_us, U"b"_us, U"ÿ"_us, U"Ā"_us, U"\U00010000"_us
+    };
+    ASSERT_EQ(expected, texts);
+
+    // Empty and single element ranges.
+    std::vector<unistringxx::ustring> empty;
+    unistringxx::string_sort(empty.begin(), empty.end());
+    ASSERT_TRUE(empty.empty());
+
+    for (std::size_t count : { 10, 1000, 50000 }) {
+        std::vector<unistringxx::ustring> actual = make_texts(count, static_cast<std::uint32_t>(count));
+        std::vector<unistringxx::ustring> reference{actual};
+        std::sort(reference.begin(), reference.end());
+        unistringxx::string_sort(actual.begin(), actual.end());
+        ASSERT_EQ(reference, actual);
+    }
+}
+
+TEST(sort_test, parallel_string_sort)
+{
+    std::vector<unistringxx::ustring> actual = make_texts(100000, 1);
+    std::vector<unistringxx::ustring> reference{actual};
+    std::sort(reference.begin(), reference.end());
+    unistringxx::string_sort(actual.begin(), actual.end(), 4);
+    ASSERT_EQ(reference, actual);
+
+    actual = make_texts(100000, 2);
+    reference = actual;
+    std::sort(reference.begin(), reference.end());
+    unistringxx::string_sort(actual.begin(), actual.end(), 0);
+    ASSERT_EQ(reference, actual);
+}
+
+TEST(sort_test, stable_string_sort)
+{
+    for (std::size_t thread_count : { 1, 4 }) {
+        const std::vector<unistringxx::ustring> texts = make_texts(60000, 3);
+        std::vector<tagged_text> actual;
+        for (std::size_t ctr = 0; ctr < texts.size(); ctr++)
+            actual.push_back(tagged_text{texts[ctr], ctr});
+        std::vector<tagged_text> reference{actual};
+        std::stable_sort(
+            reference.begin(), reference.end(),
+            [](const tagged_text& left, const tagged_text& right) { return (left.text < right.text); }
+        );
+        unistringxx::stable_string_sort(actual.begin(), actual.end(), thread_count);
+        for (std::size_t ctr = 0; ctr < actual.size(); ctr++) {
+            ASSERT_EQ(reference[ctr].text, actual[ctr].text);
+            ASSERT_EQ(reference[ctr].tag, actual[ctr].tag);
+        }
+    }
+}
+
+TEST(sort_test, out_of_range_code_points)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::uchar_t invalid{unistringxx::uchar_t::invalid_value};
+    std::vector<unistringxx::ustring> texts = { U"a"_us, U"b"_us };
+    texts[0].push_back(invalid);
+    unistringxx::string_sort(texts.begin(), texts.end());
+    ASSERT_EQ(U"b"_us, texts[1]);
+
+    // Out-of-range code points in every position of the keys, including values that share the reserved key value.
+    const unistringxx::uchar_t::int_type values[] = {
+        'a', 'b', 0x10FFFF, 0x110000, 0x1FFFFE, 0x1FFFFF, 0x200000, unistringxx::uchar_t::invalid_value
+    };
+    std::mt19937 random{4};
+    for (std::size_t count : { 10, 1000, 50000 }) {
+        std::vector<unistringxx::ustring> actual;
+        for (std::size_t ctr = 0; ctr < count; ctr++) {
+            unistringxx::ustring text;
+            const std::size_t size = random() % 8;
+            for (std::size_t itr = 0; itr < size; itr++)
+                text.push_back(unistringxx::uchar_t{values[random() % 8]});
+            actual.push_back(text);
+        }
+        std::vector<unistringxx::ustring> reference{actual};
+        std::sort(reference.begin(), reference.end());
+        unistringxx::string_sort(actual.begin(), actual.end());
+        ASSERT_EQ(reference, actual);
+    }
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <unistringxx/uproperties.hpp>
+
+TEST(uproperties_test, general_category)
+{
+    using namespace unistringxx::operators;
+
+    EXPECT_EQ(unistringxx::general_category::uppercase_letter, unistringxx::get_general_category('A'_uc));
+    EXPECT_EQ(unistringxx::general_category::lowercase_letter, unistringxx::get_general_category('z'_uc));
+    EXPECT_EQ(unistringxx::general_category::decimal_number, unistringxx::get_general_category(U'٣'_uc));
+    EXPECT_EQ(unistringxx::general_category::nonspacing_mark, unistringxx::get_general_category(U'́'_uc));
+    EXPECT_EQ(unistringxx::general_category::other_letter, unistringxx::get_general_category(U'あ'_uc));
+    EXPECT_EQ(unistringxx::general_category::control, unistringxx::get_general_category('\n'_uc));
+    EXPECT_EQ(unistringxx::general_category::private_use, unistringxx::get_general_category(U'\U0010FFFD'_uc));
+    EXPECT_EQ(unistringxx::general_category::unassigned, unistringxx::get_general_category(U'\U000E01F0'_uc));
+    EXPECT_EQ(
+        unistringxx::general_category::unassigned,
+        unistringxx::get_general_category(unistringxx::uchar_t{unistringxx::uchar_t::invalid_value})
+    );
+    return;
+}
+
+TEST(uproperties_test, east_asian_width)
+{
+    using namespace unistringxx::operators;
+
+    EXPECT_EQ(unistringxx::east_asian_width::narrow, unistringxx::get_east_asian_width('A'_uc));
+    EXPECT_EQ(unistringxx::east_asian_width::wide, unistringxx::get_east_asian_width(U'あ'_uc));
+    EXPECT_EQ(unistringxx::east_asian_width::fullwidth, unistringxx::get_east_asian_width(U'Ａ'_uc));
+    EXPECT_EQ(unistringxx::east_asian_width::halfwidth, unistringxx::get_east_asian_width(U'ｱ'_uc));
+    EXPECT_EQ(unistringxx::east_asian_width::ambiguous, unistringxx::get_east_asian_width(U'±'_uc));
+    EXPECT_EQ(unistringxx::east_asian_width::neutral, unistringxx::get_east_asian_width(U'א'_uc));
+    // Unassigned code points in the CJK planes default to wide.
+    EXPECT_EQ(unistringxx::east_asian_width::wide, unistringxx::get_east_asian_width(U'\U0002FFF0'_uc));
+    return;
+}
+
+TEST(uproperties_test, line_break)
+{
+    using namespace unistringxx::operators;
+
+    EXPECT_EQ(unistringxx::line_break_class::alphabetic, unistringxx::get_line_break_class('A'_uc));
+    EXPECT_EQ(unistringxx::line_break_class::space, unistringxx::get_line_break_class(' '_uc));
+    EXPECT_EQ(unistringxx::line_break_class::line_feed, unistringxx::get_line_break_class('\n'_uc));
+    EXPECT_EQ(unistringxx::line_break_class::ideographic, unistringxx::get_line_break_class(U'一'_uc));
+    EXPECT_EQ(unistringxx::line_break_class::glue, unistringxx::get_line_break_class(U' '_uc));
+    EXPECT_EQ(unistringxx::line_break_class::regional_indicator, unistringxx::get_line_break_class(U'\U0001F1E6'_uc));
+    EXPECT_TRUE(unistringxx::is_extended_pictographic(U'\U0001F600'_uc));
+    EXPECT_FALSE(unistringxx::is_extended_pictographic('A'_uc));
+    return;
+}
+
+TEST(uproperties_test, grapheme_cluster_break)
+{
+    using namespace unistringxx::operators;
+
+    EXPECT_EQ(unistringxx::grapheme_cluster_break::other, unistringxx::get_grapheme_cluster_break('A'_uc));
+    EXPECT_EQ(unistringxx::grapheme_cluster_break::carriage_return, unistringxx::get_grapheme_cluster_break('\r'_uc));
+    EXPECT_EQ(unistringxx::grapheme_cluster_break::extend, unistringxx::get_grapheme_cluster_break(U'\u0301'_uc));
+    EXPECT_EQ(unistringxx::grapheme_cluster_break::zwj, unistringxx::get_grapheme_cluster_break(U'\u200D'_uc));
+    EXPECT_EQ(unistringxx::grapheme_cluster_break::lv, unistringxx::get_grapheme_cluster_break(U'\uAC00'_uc));
+    EXPECT_EQ(
+        unistringxx::grapheme_cluster_break::extended_pictographic,
+        unistringxx::get_grapheme_cluster_break(U'\U0001F600'_uc)
+    );
+    return;
+}
+
+TEST(uproperties_test, decimal_digit_value)
+{
+    using namespace unistringxx::operators;
+
+    EXPECT_EQ(0, unistringxx::get_decimal_digit_value('0'_uc));
+    EXPECT_EQ(9, unistringxx::get_decimal_digit_value('9'_uc));
+    EXPECT_EQ(4, unistringxx::get_decimal_digit_value(U'٤'_uc));
+    EXPECT_EQ(7, unistringxx::get_decimal_digit_value(U'७'_uc));
+    EXPECT_EQ(2, unistringxx::get_decimal_digit_value(U'２'_uc));
+    EXPECT_EQ(9, unistringxx::get_decimal_digit_value(U'\U0001D7FF'_uc));
+    EXPECT_EQ(-1, unistringxx::get_decimal_digit_value('a'_uc));
+    EXPECT_EQ(-1, unistringxx::get_decimal_digit_value('/'_uc));
+    EXPECT_EQ(-1, unistringxx::get_decimal_digit_value(U'²'_uc));
+    EXPECT_EQ(-1, unistringxx::get_decimal_digit_value(U'٪'_uc));
+    return;
+}
+
+TEST(uproperties_test, column_width)
+{
+    using namespace unistringxx::operators;
+
+    EXPECT_EQ(1, unistringxx::column_width('A'_uc));
+    EXPECT_EQ(0, unistringxx::column_width('\0'_uc));
+    EXPECT_EQ(0, unistringxx::column_width('\t'_uc));
+    EXPECT_EQ(0, unistringxx::column_width(U'́'_uc)); // COMBINING ACUTE ACCENT
+    EXPECT_EQ(0, unistringxx::column_width(U'​'_uc)); // ZERO WIDTH SPACE
+    EXPECT_EQ(0, unistringxx::column_width(U'ᅠ'_uc)); // HANGUL JUNGSEONG FILLER
+    EXPECT_EQ(1, unistringxx::column_width(U'­'_uc)); // SOFT HYPHEN
+    EXPECT_EQ(2, unistringxx::column_width(U'あ'_uc));
+    EXPECT_EQ(2, unistringxx::column_width(U'Ａ'_uc));
+    EXPECT_EQ(2, unistringxx::column_width(U'\U0001F600'_uc));
+    EXPECT_EQ(1, unistringxx::column_width(U'ｱ'_uc));
+    EXPECT_EQ(1, unistringxx::column_width(U'±'_uc));
+    EXPECT_EQ(2, unistringxx::column_width(U'±'_uc, 2));
+    return;
+}
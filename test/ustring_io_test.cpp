@@ -0,0 +1,212 @@
+#include <cstddef>
+#include <iomanip>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/ustring_io.hpp>
+
+namespace
+{
+    // A stream buffer that hands out its input a few octets at a time, so that multi-octet sequences are split
+    // between refills.
+    class trickle_buffer : public std::streambuf
+    {
+    public:
+        trickle_buffer(const std::string& input, std::size_t chunk_size) :
+            _input{input}, _position{0}, _chunk_size{chunk_size}
+        { return; }
+
+    protected:
+        int_type underflow(void) override
+        {
+            if (_position >= _input.size())
+                return (traits_type::eof());
+            const std::size_t size = std::min(_chunk_size, _input.size() - _position);
+            _chunk.assign(_input, _position, size);
+            _position += size;
+            char* data = &_chunk[0];
+            this->setg(data, data, data + size);
+            return (traits_type::to_int_type(*data));
+        }
+
+    private:
+        std::string _input;
+        std::string _chunk;
+        std::size_t _position;
+        std::size_t _chunk_size;
+    };
+
+    // A stream buffer without a get area: every octet is read through underflow and uflow.
+    class unbuffered_buffer : public std::streambuf
+    {
+    public:
+        explicit unbuffered_buffer(const std::string& input) :
+            _input{input}, _position{0}
+        { return; }
+
+    protected:
+        int_type underflow(void) override
+        {
+            if (_position >= _input.size())
+                return (traits_type::eof());
+            return (traits_type::to_int_type(_input[_position]));
+        }
+
+        int_type uflow(void) override
+        {
+            const int_type result = this->underflow();
+            if (!traits_type::eq_int_type(result, traits_type::eof()))
+                _position++;
+            return (result);
+        }
+
+    private:
+        std::string _input;
+        std::size_t _position;
+    };
+}
+
+TEST(ustring_io_test, output)
+{
+    using namespace unistringxx::operators;
+
+    std::ostringstream stream;
+    stream << U"héllo, 世界 𝄞"_us << ' ' << unistringxx::ustring_view{U"view"_us};
+    ASSERT_EQ(std::string{u8"héllo, 世界 𝄞 view"}, stream.str());
+
+    // The width is counted in code points.
+    stream.str("");
+    stream << std::setw(6) << std::setfill('*') << U"世界"_us << '|' << std::left << std::setw(4) << U"é"_us << '|';
+    ASSERT_EQ(std::string{u8"****世界|é***|"}, stream.str());
+
+    // Long texts go through the buffer several times.
+    unistringxx::ustring long_text;
+    std::string expected;
+    for (int ctr = 0; ctr < 1000; ctr++) {
+        long_text.append(U"ab世𝄞"_us);
+        expected += u8"ab世𝄞";
+    }
+    stream.str("");
+    stream << std::setw(0) << long_text;
+    ASSERT_EQ(expected, stream.str());
+}
+
+TEST(ustring_io_test, input)
+{
+    using namespace unistringxx::operators;
+
+    std::istringstream stream{u8"  héllo\t世界　𝄞 end"};
+    unistringxx::ustring word;
+    stream >> word;
+    ASSERT_EQ(U"héllo"_us, word);
+    stream >> word;
+    ASSERT_EQ(U"世界"_us, word);
+    stream >> word;
+    ASSERT_EQ(U"𝄞"_us, word);
+    stream >> std::setw(2) >> word;
+    ASSERT_EQ(U"en"_us, word);
+    stream >> word;
+    ASSERT_EQ(U"d"_us, word);
+    ASSERT_TRUE(stream.eof());
+    ASSERT_FALSE(stream.fail());
+    stream >> word;
+    ASSERT_TRUE(stream.fail());
+
+    // Invalid UTF-8.
+    std::istringstream invalid{"ab\xC3(cd"};
+    invalid >> word;
+    ASSERT_TRUE(invalid.fail());
+}
+
+TEST(ustring_io_test, getline)
+{
+    using namespace unistringxx::operators;
+
+    std::istringstream stream{u8"first line\nsecond 行\n\nlast"};
+    unistringxx::ustring line;
+    ASSERT_TRUE(unistringxx::getline(stream, line));
+    ASSERT_EQ(U"first line"_us, line);
+    ASSERT_TRUE(unistringxx::getline(stream, line));
+    ASSERT_EQ(U"second 行"_us, line);
+    ASSERT_TRUE(unistringxx::getline(stream, line));
+    ASSERT_EQ(U""_us, line);
+    ASSERT_TRUE(unistringxx::getline(stream, line));
+    ASSERT_EQ(U"last"_us, line);
+    ASSERT_TRUE(stream.eof());
+    ASSERT_FALSE(unistringxx::getline(stream, line));
+
+    // A multi-octet delimiter.
+    std::istringstream fields{u8"α→β→γ"};
+    ASSERT_TRUE(unistringxx::getline(fields, line, U'→'_uc));
+    ASSERT_EQ(U"α"_us, line);
+    ASSERT_TRUE(unistringxx::getline(fields, line, U'→'_uc));
+    ASSERT_EQ(U"β"_us, line);
+    ASSERT_TRUE(unistringxx::getline(fields, line, U'→'_uc));
+    ASSERT_EQ(U"γ"_us, line);
+
+    // An invalid sequence stops the line without consuming the octet after it.
+    std::istringstream invalid{"ab\xE4\xB8" "c\n"};
+    ASSERT_FALSE(unistringxx::getline(invalid, line));
+    ASSERT_EQ(U"ab"_us, line);
+    invalid.clear();
+    ASSERT_EQ('c', invalid.get());
+}
+
+TEST(ustring_io_test, split_sequences)
+{
+    using namespace unistringxx::operators;
+
+    // Every chunk size splits some of the sequences between two refills of the stream buffer.
+    unistringxx::ustring expected;
+    std::string input;
+    for (int ctr = 0; ctr < 300; ctr++) {
+        expected.append(U"aé世𝄞"_us);
+        input += u8"aé世𝄞";
+    }
+    input += "\nrest";
+    for (std::size_t chunk_size = 1; chunk_size <= 7; chunk_size++) {
+        trickle_buffer buffer{input, chunk_size};
+        std::istream stream{&buffer};
+        unistringxx::ustring line;
+        ASSERT_TRUE(unistringxx::getline(stream, line));
+        ASSERT_EQ(expected, line);
+        ASSERT_TRUE(unistringxx::getline(stream, line));
+        ASSERT_EQ(U"rest"_us, line);
+    }
+
+    // A multi-octet delimiter split between refills, among sequences that start with the same octet.
+    for (std::size_t chunk_size = 1; chunk_size <= 7; chunk_size++) {
+        trickle_buffer buffer{u8"a—b→c—→—", chunk_size};
+        std::istream stream{&buffer};
+        unistringxx::ustring field;
+        ASSERT_TRUE(unistringxx::getline(stream, field, U'→'_uc));
+        ASSERT_EQ(U"a—b"_us, field);
+        ASSERT_TRUE(unistringxx::getline(stream, field, U'→'_uc));
+        ASSERT_EQ(U"c—"_us, field);
+        ASSERT_TRUE(unistringxx::getline(stream, field, U'→'_uc));
+        ASSERT_EQ(U"—"_us, field);
+        ASSERT_TRUE(stream.eof());
+    }
+}
+
+TEST(ustring_io_test, unbuffered)
+{
+    using namespace unistringxx::operators;
+
+    unbuffered_buffer buffer{u8"ab\ncé𝄞\nd→e"};
+    std::istream stream{&buffer};
+    unistringxx::ustring line;
+    ASSERT_TRUE(unistringxx::getline(stream, line));
+    ASSERT_EQ(U"ab"_us, line);
+    ASSERT_TRUE(unistringxx::getline(stream, line));
+    ASSERT_EQ(U"cé𝄞"_us, line);
+    ASSERT_TRUE(unistringxx::getline(stream, line, U'→'_uc));
+    ASSERT_EQ(U"d"_us, line);
+    ASSERT_TRUE(unistringxx::getline(stream, line));
+    ASSERT_EQ(U"e"_us, line);
+    ASSERT_TRUE(stream.eof());
+    ASSERT_FALSE(unistringxx::getline(stream, line));
+}
@@ -1,6 +1,12 @@
 #include <array>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -136,16 +142,21 @@ TEST(ustring_test, construction)
     return;
 }
 
-TEST(ustring_test, custom_allocator)
+namespace
 {
-    // A simple test when using a custom allocator. The test simply checks whether the count is reset (i.e. allocate and
-    // deallocate functions are called).
-
+    // A simple allocator that counts the number of outstanding allocations.
     typedef std::allocator<unistringxx::uchar_t> my_allocator_base;
     struct my_allocator : public my_allocator_base
     {
-        typedef typename my_allocator_base::size_type size_type;
-        typedef typename my_allocator_base::pointer pointer;
+        typedef my_allocator_base::size_type size_type;
+        typedef my_allocator_base::pointer pointer;
+
+        // Without this, the container rebinds to the base class (std::allocator::rebind) and bypasses this allocator.
+        template<typename U>
+        struct rebind
+        {
+            typedef my_allocator other;
+        };
 
         size_type& alloc_count;
 
@@ -165,6 +176,12 @@ TEST(ustring_test, custom_allocator)
             return;
         }
     };
+} // namespace
+
+TEST(ustring_test, custom_allocator)
+{
+    // A simple test when using a custom allocator. The test simply checks whether the count is reset (i.e. allocate and
+    // deallocate functions are called).
 
     typedef unistringxx::generic_ustring<my_allocator> my_ustring;
     my_ustring::size_type count = 0;
@@ -176,6 +193,249 @@ TEST(ustring_test, custom_allocator)
     return;
 }
 
+namespace
+{
+    // An allocator that is told apart by its id, and that is either propagated (with copies keeping the id) or not
+    // (with copies getting the id 0).
+    template<typename valueT, bool propagateT>
+    struct tagged_allocator
+    {
+        typedef valueT value_type;
+        typedef std::integral_constant<bool, propagateT> propagate_on_container_copy_assignment;
+        typedef std::integral_constant<bool, propagateT> propagate_on_container_move_assignment;
+        typedef std::integral_constant<bool, propagateT> propagate_on_container_swap;
+
+        template<typename U>
+        struct rebind
+        {
+            typedef tagged_allocator<U, propagateT> other;
+        };
+
+        int id;
+
+        tagged_allocator(int arg) : id{arg}
+        { return; }
+
+        template<typename U>
+        tagged_allocator(const tagged_allocator<U, propagateT>& other) : id{other.id}
+        { return; }
+
+        valueT* allocate(std::size_t n)
+        { return (std::allocator<valueT>{}.allocate(n)); }
+
+        void deallocate(valueT* p, std::size_t n)
+        {
+            std::allocator<valueT>{}.deallocate(p, n);
+            return;
+        }
+
+        tagged_allocator select_on_container_copy_construction(void) const
+        { return (tagged_allocator{propagateT ? id : 0}); }
+
+        friend bool operator==(const tagged_allocator& left, const tagged_allocator& right)
+        { return (left.id == right.id); }
+
+        friend bool operator!=(const tagged_allocator& left, const tagged_allocator& right)
+        { return (left.id != right.id); }
+    };
+} // namespace
+
+TEST(ustring_test, propagating_allocators)
+{
+    using namespace unistringxx::operators;
+
+    {
+        typedef unistringxx::generic_ustring<tagged_allocator<unistringxx::uchar_t, true>> propagating_ustring;
+        typedef propagating_ustring::allocator_type allocator_type;
+
+        const propagating_ustring ustr_a{U"abc"_us.data(), allocator_type{1}};
+        propagating_ustring ustr_b{U"defg"_us.data(), allocator_type{2}};
+
+        const propagating_ustring ustr_c{ustr_a};
+        ASSERT_EQ(1, ustr_c.get_allocator().id);
+        ASSERT_EQ(1, ustr_a.substr(1).get_allocator().id);
+
+        propagating_ustring ustr_d{allocator_type{3}};
+        ustr_d = ustr_a;
+        ASSERT_EQ(1, ustr_d.get_allocator().id);
+        ASSERT_EQ(U"abc"_us.data(), ustr_d);
+        ustr_d = std::move(ustr_b);
+        ASSERT_EQ(2, ustr_d.get_allocator().id);
+        ASSERT_EQ(U"defg"_us.data(), ustr_d);
+
+        propagating_ustring ustr_e{U"hij"_us.data(), allocator_type{4}};
+        ustr_d.swap(ustr_e);
+        ASSERT_EQ(4, ustr_d.get_allocator().id);
+        ASSERT_EQ(2, ustr_e.get_allocator().id);
+        ASSERT_EQ(U"hij"_us.data(), ustr_d);
+        ASSERT_EQ(U"defg"_us.data(), ustr_e);
+    }
+
+    {
+        typedef unistringxx::generic_ustring<tagged_allocator<unistringxx::uchar_t, false>> local_ustring;
+        typedef local_ustring::allocator_type allocator_type;
+
+        const local_ustring ustr_a{U"abc"_us.data(), allocator_type{1}};
+        local_ustring ustr_b{U"defg"_us.data(), allocator_type{2}};
+
+        const local_ustring ustr_c{ustr_a};
+        ASSERT_EQ(0, ustr_c.get_allocator().id);
+        ASSERT_EQ(1, ustr_a.substr(1).get_allocator().id);
+
+        local_ustring ustr_d{allocator_type{3}};
+        ustr_d = ustr_a;
+        ASSERT_EQ(3, ustr_d.get_allocator().id);
+        ASSERT_EQ(U"abc"_us.data(), ustr_d);
+        ustr_d = std::move(ustr_b);
+        ASSERT_EQ(3, ustr_d.get_allocator().id);
+        ASSERT_EQ(U"defg"_us.data(), ustr_d);
+
+        // Unequal allocators that do not propagate: the texts are exchanged, the allocators stay.
+        local_ustring ustr_e{U"hij"_us.data(), allocator_type{4}};
+        ustr_d.swap(ustr_e);
+        ASSERT_EQ(3, ustr_d.get_allocator().id);
+        ASSERT_EQ(4, ustr_e.get_allocator().id);
+        ASSERT_EQ(U"hij"_us.data(), ustr_d);
+        ASSERT_EQ(U"defg"_us.data(), ustr_e);
+
+        // The functions that build new strings use the allocator of this object or the one passed to them.
+        const std::u32string text = U"klmno";
+        ustr_d.assign(text.begin(), text.end());
+        ASSERT_EQ(3, ustr_d.get_allocator().id);
+        ASSERT_EQ(U"klmno"_us.data(), ustr_d);
+        ASSERT_EQ(0, ustr_d.compare(1, 2, U"lm"_us.data(), 2));
+        ASSERT_EQ(5, local_ustring::from_u8string("xyz", allocator_type{5}).get_allocator().id);
+        ASSERT_EQ(6, local_ustring::from_u8string("xyz", 1, 1, allocator_type{6}).get_allocator().id);
+        ASSERT_EQ(U"y"_us.data(), local_ustring::from_u8string("xyz", 1, 1, allocator_type{6}));
+        ASSERT_EQ(7, local_ustring::from_u16string(u"xyz", allocator_type{7}).get_allocator().id);
+        ASSERT_EQ(8, local_ustring::from_u32string(U"xyz", allocator_type{8}).get_allocator().id);
+    }
+    return;
+}
+
+namespace
+{
+    // An allocator that counts the number of allocations made.
+    template<typename valueT>
+    struct counting_allocator
+    {
+        typedef valueT value_type;
+
+        template<typename U>
+        struct rebind
+        {
+            typedef counting_allocator<U> other;
+        };
+
+        std::size_t* allocation_count;
+
+        counting_allocator(std::size_t& arg) : allocation_count{&arg}
+        { return; }
+
+        template<typename U>
+        counting_allocator(const counting_allocator<U>& other) : allocation_count{other.allocation_count}
+        { return; }
+
+        valueT* allocate(std::size_t n)
+        {
+            (*allocation_count)++;
+            return (std::allocator<valueT>{}.allocate(n));
+        }
+
+        void deallocate(valueT* p, std::size_t n)
+        {
+            std::allocator<valueT>{}.deallocate(p, n);
+            return;
+        }
+
+        friend bool operator==(const counting_allocator& left, const counting_allocator& right)
+        { return (left.allocation_count == right.allocation_count); }
+
+        friend bool operator!=(const counting_allocator& left, const counting_allocator& right)
+        { return (left.allocation_count != right.allocation_count); }
+    };
+} // namespace
+
+TEST(ustring_test, exact_size_construction)
+{
+    using namespace unistringxx::operators;
+
+    typedef unistringxx::generic_ustring<counting_allocator<unistringxx::uchar_t>> counted_ustring;
+    std::size_t count = 0;
+    const counted_ustring::allocator_type allocator{count};
+    const unistringxx::ustring source = U"Unicode テキスト 𝄞"_us;
+
+    // Each construction allocates once, with room for exactly the text and the null terminator.
+    const std::vector<unistringxx::uchar_t> vector_source{source.begin(), source.end()};
+    const counted_ustring from_vector{vector_source.begin(), vector_source.end(), allocator};
+    ASSERT_EQ(1u, count);
+    ASSERT_EQ(source.size() + 1, from_vector.capacity());
+    ASSERT_EQ(source.data(), from_vector);
+
+    const counted_ustring from_list{{'a'_uc, 'b'_uc, U'𝄞'_uc}, allocator};
+    ASSERT_EQ(2u, count);
+    ASSERT_EQ(4u, from_list.capacity());
+
+    count = 0;
+    const counted_ustring from_utf8 = counted_ustring::from_u8string(source.to_u8string(), allocator);
+    ASSERT_EQ(1u, count);
+    ASSERT_EQ(source.size() + 1, from_utf8.capacity());
+    ASSERT_EQ(source.data(), from_utf8);
+    const counted_ustring from_utf16 = counted_ustring::from_u16string(source.to_u16string(), allocator);
+    ASSERT_EQ(2u, count);
+    ASSERT_EQ(source.size() + 1, from_utf16.capacity());
+    ASSERT_EQ(source.data(), from_utf16);
+    const counted_ustring from_utf32 = counted_ustring::from_u32string(source.to_u32string(), allocator);
+    ASSERT_EQ(3u, count);
+    ASSERT_EQ(source.data(), from_utf32);
+    ASSERT_EQ(U"テキスト"_us.data(), counted_ustring::from_u8string(source.to_u8string(), 8, 12, allocator));
+    ASSERT_EQ(U"𝄞"_us.data(), counted_ustring::from_u16string(source.to_u16string(), 13, 2, allocator));
+    ASSERT_THROW(counted_ustring::from_u8string("abc", 4, 1, allocator), std::out_of_range);
+
+    // Input iterators cannot tell the size up front.
+    count = 0;
+    std::istringstream stream{"abc"};
+    const counted_ustring from_stream{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}, allocator};
+    ASSERT_EQ(U"abc"_us.data(), from_stream);
+
+    // Shrinking and moving do not copy the text, and moving does not allocate.
+    count = 0;
+    counted_ustring text{source.data(), allocator};
+    const unistringxx::uchar_t* buffer = text.data();
+    text.resize(7);
+    ASSERT_EQ(buffer, text.data());
+    ASSERT_EQ(U"Unicode"_us.data(), text);
+    ASSERT_EQ(1u, count);
+    counted_ustring moved{std::move(text)};
+    ASSERT_EQ(buffer, moved.data());
+    ASSERT_TRUE(text.empty());
+    text = std::move(moved);
+    ASSERT_EQ(buffer, text.data());
+    ASSERT_TRUE(moved.empty());
+    ASSERT_EQ(U""_us.data(), moved);
+    counted_ustring moved_with_allocator{std::move(text), allocator};
+    ASSERT_EQ(buffer, moved_with_allocator.data());
+    ASSERT_EQ(1u, count);
+
+    // Moved-from strings are valid empty strings, and get a buffer back when they are modified.
+    ASSERT_EQ(0u, text.size());
+    ASSERT_EQ(text.begin(), text.end());
+    ASSERT_EQ(text.rbegin(), text.rend());
+    ASSERT_TRUE(text.c_str()[0].is_null());
+    ASSERT_TRUE(text[0].is_null());
+    ASSERT_EQ(U""_us.data(), text);
+    ASSERT_EQ(text, moved);
+    text.clear();
+    ASSERT_EQ(1u, count);
+    text.push_back('a'_uc);
+    moved.append_number(42);
+    counted_ustring resized{std::move(text)};
+    text.resize(2, 'b'_uc);
+    ASSERT_EQ(U"a"_us.data(), resized);
+    ASSERT_EQ(U"42"_us.data(), moved);
+    ASSERT_EQ(U"bb"_us.data(), text);
+}
+
 TEST(ustring_test, properties)
 {
     using namespace unistringxx::operators;
@@ -250,6 +510,48 @@ TEST(ustring_test, comparison)
     ASSERT_LT(ustr_a.compare(ustr_e), 0);
     ASSERT_GT(ustr_a.compare(ustr_f), 0);
 
+    // Prefixes and embedded null characters.
+    const unistringxx::ustring::char_type uc_str_c[] = { 'A', u'あ', '\0'_uc };
+    ASSERT_FALSE(uc_str_c == ustr_a);
+    ASSERT_TRUE(uc_str_c < ustr_a);
+    ASSERT_TRUE(ustr_a > uc_str_c);
+    ASSERT_GT(ustr_a.compare(uc_str_c), 0);
+    ASSERT_LT(ustr_c.compare(uc_str_c), 0);
+    ASSERT_EQ(0, ustr_a.compare(uc_str_a));
+    unistringxx::ustring ustr_g{{ 'A', '\0'_uc }};
+    unistringxx::ustring ustr_h{{ 'A', '\0'_uc, '\0'_uc }};
+    ASSERT_TRUE(ustr_g != ustr_h);
+    ASSERT_TRUE(ustr_g < ustr_h);
+    ASSERT_LT(ustr_g.compare(ustr_h), 0);
+    ASSERT_FALSE(uc_str_a == ustr_g);
+
+    // The order is by code point, not by the bytes of the storage (U+0100 is stored as 00 01 00).
+    unistringxx::ustring ustr_i{{ U'Ā' }};
+    unistringxx::ustring ustr_j{{ U'ÿ' }};
+    unistringxx::ustring ustr_k{{ U'\U00010000' }};
+    ASSERT_TRUE(ustr_j < ustr_i);
+    ASSERT_TRUE(ustr_i < ustr_k);
+    ASSERT_GT(ustr_k.compare(ustr_j), 0);
+
+    // Long strings (the comparison works on blocks) with a difference at every position.
+    const unistringxx::ustring long_str(100, U'あ'_uc);
+    for (std::size_t index = 0; index < long_str.size(); index++) {
+        unistringxx::ustring greater{long_str};
+        greater[index] = U'\U00013042'_uc;
+        unistringxx::ustring less{long_str};
+        less[index] = U'⁂'_uc;
+        ASSERT_TRUE(long_str != greater);
+        ASSERT_TRUE(long_str < greater);
+        ASSERT_TRUE(long_str > less);
+        ASSERT_GT(greater.compare(long_str), 0);
+        ASSERT_LT(less.compare(long_str), 0);
+        ASSERT_FALSE(greater.c_str() == long_str);
+        ASSERT_TRUE(less.c_str() < long_str);
+        ASSERT_TRUE(long_str.substr(0, index) < long_str);
+        ASSERT_TRUE(long_str.substr(0, index).c_str() < long_str);
+    }
+    ASSERT_EQ(long_str, unistringxx::ustring(100, U'あ'_uc));
+
     // TOTEST: Other compare versions are just calling compare function from a substring.
 
     return;
@@ -771,6 +1073,60 @@ TEST(ustring_test, conversions)
     return;
 }
 
+TEST(ustring_test, number_formatting)
+{
+    using namespace unistringxx::operators;
+
+    // to_ustring is the same as std::to_string.
+    ASSERT_EQ(U"0"_us, unistringxx::to_ustring(0));
+    ASSERT_EQ(U"-2147483648"_us, unistringxx::to_ustring(std::numeric_limits<int>::min()));
+    ASSERT_EQ(U"18446744073709551615"_us, unistringxx::to_ustring(std::numeric_limits<unsigned long long>::max()));
+    ASSERT_EQ(U"-9223372036854775808"_us, unistringxx::to_ustring(std::numeric_limits<long long>::min()));
+    ASSERT_EQ(unistringxx::ustring::from_u8string(std::to_string(1.5)), unistringxx::to_ustring(1.5));
+    ASSERT_EQ(unistringxx::ustring::from_u8string(std::to_string(-0.25f)), unistringxx::to_ustring(-0.25f));
+    ASSERT_EQ(unistringxx::ustring::from_u8string(std::to_string(1e300)), unistringxx::to_ustring(1e300));
+    ASSERT_EQ(unistringxx::ustring::from_u8string(std::to_string(2.5L)), unistringxx::to_ustring(2.5L));
+
+    unistringxx::ustring ustr_a = U"x="_us;
+    ustr_a.append_number(42).append_number(-7L).append_number(static_cast<unsigned char>(200));
+    ASSERT_EQ(U"x=42-7200"_us, ustr_a);
+    ASSERT_EQ(static_cast<unistringxx::ustring::size_type>(9), ustr_a.size());
+    ASSERT_EQ(unistringxx::uchar_t::null_char(), *ustr_a.cend());
+
+    // Shortest round-trip floating point numbers.
+    const auto format = [](double value) {
+        unistringxx::ustring result;
+        result.append_number(value);
+        return (result);
+    };
+    ASSERT_EQ(U"0.1"_us, format(0.1));
+    ASSERT_EQ(U"0.30000000000000004"_us, format(0.1 + 0.2));
+    ASSERT_EQ(U"-2.5e-07"_us, format(-2.5e-7));
+    ASSERT_EQ(U"1e+100"_us, format(1e100));
+    ASSERT_EQ(U"123000"_us, format(123000.0));
+    ASSERT_EQ(U"-0"_us, format(-0.0));
+    ASSERT_EQ(U"1.7976931348623157e+308"_us, format(std::numeric_limits<double>::max()));
+    ASSERT_EQ(U"5e-324"_us, format(std::numeric_limits<double>::denorm_min()));
+    ASSERT_EQ(U"inf"_us, format(std::numeric_limits<double>::infinity()));
+    ASSERT_EQ(U"-inf"_us, format(-std::numeric_limits<double>::infinity()));
+    ASSERT_EQ(U"nan"_us, format(std::numeric_limits<double>::quiet_NaN()));
+
+    unistringxx::ustring ustr_b;
+    ustr_b.append_number(0.1f).push_back(' ');
+    ustr_b.append_number(std::numeric_limits<float>::max());
+    ASSERT_EQ(U"0.1 3.4028235e+38"_us, ustr_b);
+
+    // Any output iterator.
+    unistringxx::ustring ustr_c = U"v"_us;
+    unistringxx::format_number(std::back_inserter(ustr_c), -12.75);
+    ASSERT_EQ(U"v-12.75"_us, ustr_c);
+    std::vector<unistringxx::uchar_t> vec;
+    unistringxx::format_number(std::back_inserter(vec), 1234567890123ULL);
+    ASSERT_EQ(unistringxx::ustring(vec.begin(), vec.end()), U"1234567890123"_us);
+
+    return;
+}
+
 TEST(ustring_test, literal_operators)
 {
     using namespace unistringxx::operators;
@@ -792,13 +1148,67 @@ TEST(ustring_test, literal_operators)
 
 TEST(ustring_test, hashing)
 {
-    std::string str("ABCDEFGH");
-    unistringxx::ustring ustr_a = unistringxx::ustring::from_u8string(str);
-    std::hash<std::string> str_hash_function;
+    using namespace unistringxx::operators;
+
+    const unistringxx::ustring ustr_a = unistringxx::ustring::from_u8string("ABCDEFGH");
+    const unistringxx::ustring ustr_b{ustr_a};
     std::hash<unistringxx::ustring> ustr_hash_function;
-    const std::size_t
-        result_a = str_hash_function(str),
-        result_b = ustr_hash_function(ustr_a);
-    ASSERT_EQ(result_a, result_b);
+    ASSERT_EQ(ustr_hash_function(ustr_a), ustr_hash_function(ustr_b));
+    ASSERT_NE(ustr_hash_function(ustr_a), ustr_hash_function(U"ABCDEFGI"_us));
+    ASSERT_NE(ustr_hash_function(ustr_a), ustr_hash_function(U"ABCDEFG"_us));
+    ASSERT_NE(ustr_hash_function(unistringxx::ustring{}), ustr_hash_function(U"\0"_us));
+
+    // Every length goes through a different path of the hash function.
+    std::unordered_set<std::size_t> hash_values;
+    unistringxx::ustring ustr_c;
+    for (int ctr = 0; ctr < 200; ctr++) {
+        hash_values.insert(ustr_hash_function(ustr_c));
+        ustr_c.push_back(U'\u3042'_uc);
+    }
+    ASSERT_EQ(static_cast<std::size_t>(200), hash_values.size());
+
+    // Same results for any allocator and for the code points themselves.
+    std::size_t count = 0;
+    const unistringxx::generic_ustring<my_allocator> ustr_d{ustr_a.cbegin(), ustr_a.cend(), my_allocator{count}};
+    ASSERT_EQ(ustr_hash_function(ustr_a), std::hash<unistringxx::generic_ustring<my_allocator>>{}(ustr_d));
+    ASSERT_EQ(
+        ustr_hash_function(ustr_a),
+        static_cast<std::size_t>(unistringxx::hash_code_points(ustr_a.data(), ustr_a.size()))
+    );
+
+    // Seeds select different hash functions.
+    ASSERT_NE(
+        unistringxx::hash_code_points(ustr_a.data(), ustr_a.size(), 1),
+        unistringxx::hash_code_points(ustr_a.data(), ustr_a.size(), 2)
+    );
+
+    // Streaming hasher: the fields of a composite key are kept apart.
+    const std::uint64_t key_a = unistringxx::hasher{}.update(U"ab"_us).update(U"c"_us).digest();
+    const std::uint64_t key_b = unistringxx::hasher{}.update(U"a"_us).update(U"bc"_us).digest();
+    const std::uint64_t key_c = unistringxx::hasher{}.update(U"ab"_us).update(U"c"_us).digest();
+    ASSERT_NE(key_a, key_b);
+    ASSERT_EQ(key_a, key_c);
+    ASSERT_NE(
+        unistringxx::hasher{}.update(ustr_a).update(1).digest(), unistringxx::hasher{}.update(ustr_a).update(2).digest()
+    );
+    ASSERT_EQ(ustr_hash_function(ustr_a), static_cast<std::size_t>(unistringxx::hasher{}.update(ustr_a).digest()));
+
+    // Floating point values that compare equal hash equally, whatever their padding octets hold.
+    ASSERT_EQ(unistringxx::hasher{}.update(0.0).digest(), unistringxx::hasher{}.update(-0.0).digest());
+    ASSERT_EQ(unistringxx::hasher{}.update(0.0f).digest(), unistringxx::hasher{}.update(-0.0f).digest());
+    ASSERT_EQ(unistringxx::hasher{}.update(0.0L).digest(), unistringxx::hasher{}.update(-0.0L).digest());
+    ASSERT_EQ(unistringxx::hasher{}.update(1.5f).digest(), unistringxx::hasher{}.update(1.5).digest());
+    ASSERT_NE(unistringxx::hasher{}.update(1.5).digest(), unistringxx::hasher{}.update(-1.5).digest());
+    long double value_a;
+    long double value_b;
+    std::memset(&value_a, 0xAA, sizeof (value_a));
+    std::memset(&value_b, 0x55, sizeof (value_b));
+    value_a = 1.0L / 3;
+    value_b = 1.0L / 3;
+    ASSERT_EQ(unistringxx::hasher{}.update(value_a).digest(), unistringxx::hasher{}.update(value_b).digest());
+    ASSERT_EQ(
+        unistringxx::hasher{}.update(-0.0L).update(1.5L).digest(), unistringxx::hasher{}.update(0.0L).update(1.5).digest()
+    );
+    ASSERT_NE(unistringxx::hasher{}.update(value_a).digest(), unistringxx::hasher{}.update(1.0 / 3).digest());
     return;
 }
@@ -0,0 +1,114 @@
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/ustring_view.hpp>
+
+TEST(ustring_view_test, construction)
+{
+    using namespace unistringxx::operators;
+
+    unistringxx::ustring_view view_a;
+    ASSERT_TRUE(view_a.empty());
+    ASSERT_EQ(nullptr, view_a.data());
+
+    const unistringxx::ustring ustr_a{{ 'A', u'あ', 'B'_uc, U'\U0010FFFF' }};
+    unistringxx::ustring_view view_b{ustr_a};
+    ASSERT_EQ(ustr_a.size(), view_b.size());
+    ASSERT_EQ(ustr_a.data(), view_b.data());
+
+    const unistringxx::ustring::char_type uc_str_a[] = { 'A', u'あ', '\0'_uc };
+    unistringxx::ustring_view view_c{uc_str_a};
+    ASSERT_EQ(static_cast<unistringxx::ustring_view::size_type>(2), view_c.size());
+
+    unistringxx::ustring ustr_b = static_cast<unistringxx::ustring>(view_b);
+    ASSERT_EQ(ustr_a, ustr_b);
+    ASSERT_NE(ustr_a.data(), ustr_b.data());
+
+    return;
+}
+
+TEST(ustring_view_test, element_access)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::ustring ustr_a{{ 'A', u'あ', 'B'_uc, U'\U0010FFFF' }};
+    unistringxx::ustring_view view_a{ustr_a};
+    ASSERT_EQ('A'_uc, view_a.front());
+    ASSERT_EQ(U'\U0010FFFF'_uc, view_a.back());
+    ASSERT_EQ(u'あ'_uc, view_a[1]);
+    ASSERT_EQ('B'_uc, view_a.at(2));
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+    EXPECT_THROW(view_a.at(4), std::out_of_range);
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+
+    std::size_t iterate_count = 0;
+    for (auto itr = view_a.crbegin(); itr != view_a.crend(); itr++)
+        iterate_count++;
+    ASSERT_EQ(static_cast<std::size_t>(4), iterate_count);
+
+    view_a.remove_prefix(1);
+    view_a.remove_suffix(1);
+    ASSERT_EQ(static_cast<unistringxx::ustring_view::size_type>(2), view_a.size());
+    ASSERT_EQ(u'あ'_uc, view_a.front());
+    ASSERT_EQ('B'_uc, view_a.back());
+
+    return;
+}
+
+TEST(ustring_view_test, operations)
+{
+    using namespace unistringxx::operators;
+
+    const unistringxx::ustring ustr_a{{ '0', '1', '2', '3', '2', '1', '0' }};
+    const unistringxx::ustring ustr_b{{ '2', '1' }};
+    unistringxx::ustring_view view_a{ustr_a};
+
+    ASSERT_EQ(unistringxx::ustring_view(ustr_b), view_a.substr(4, 2));
+    ASSERT_EQ(static_cast<unistringxx::ustring_view::size_type>(3), view_a.substr(4).size());
+#if (UNISTRINGXX_WITH_EXCEPTIONS)
+    EXPECT_THROW(view_a.substr(8), std::out_of_range);
+#endif // (UNISTRINGXX_WITH_EXCEPTIONS)
+
+    ASSERT_EQ(static_cast<unistringxx::ustring_view::size_type>(4), view_a.find(ustr_b));
+    ASSERT_EQ(unistringxx::ustring_view::npos, view_a.find(ustr_b, 5));
+    ASSERT_EQ(static_cast<unistringxx::ustring_view::size_type>(2), view_a.find('2'_uc));
+    ASSERT_EQ(static_cast<unistringxx::ustring_view::size_type>(4), view_a.rfind('2'_uc));
+    ASSERT_EQ(static_cast<unistringxx::ustring_view::size_type>(4), view_a.rfind(ustr_b));
+    ASSERT_EQ(unistringxx::ustring_view::npos, view_a.rfind('9'_uc));
+
+    // Comparisons against views and generic_ustring.
+    ASSERT_TRUE(view_a == ustr_a);
+    ASSERT_TRUE(ustr_a == view_a);
+    ASSERT_TRUE(view_a.substr(0, 3) < view_a);
+    ASSERT_TRUE(ustr_b > view_a);
+    ASSERT_EQ(0, view_a.compare(ustr_a));
+    ASSERT_LT(view_a.substr(0, 2).compare(view_a), 0);
+    ASSERT_GT(unistringxx::ustring_view(ustr_b).compare(view_a), 0);
+
+    return;
+}
+
+TEST(ustring_view_test, hashing)
+{
+    using namespace unistringxx::operators;
+
+    // Views and strings with the same content hash the same, wherever the view points to.
+    const unistringxx::ustring ustr_a = U"xxHello, world"_us;
+    const unistringxx::ustring ustr_b = U"Hello"_us;
+    const unistringxx::ustring_view view_a = unistringxx::ustring_view{ustr_a}.substr(2, 5);
+    ASSERT_EQ(std::hash<unistringxx::ustring>{}(ustr_b), std::hash<unistringxx::ustring_view>{}(view_a));
+    ASSERT_EQ(unistringxx::ustring_hash{}(ustr_b), unistringxx::ustring_hash{}(view_a));
+    ASSERT_EQ(std::hash<unistringxx::ustring>{}(ustr_b), unistringxx::ustring_hash{}(view_a));
+    ASSERT_TRUE(unistringxx::ustring_equal_to{}(ustr_b, view_a));
+    ASSERT_FALSE(unistringxx::ustring_equal_to{}(ustr_a, view_a));
+
+    std::unordered_map<unistringxx::ustring, int, unistringxx::ustring_hash, unistringxx::ustring_equal_to> map;
+    map[ustr_b] = 1;
+    map[U"world"_us] = 2;
+    ASSERT_EQ(1, map.at(static_cast<unistringxx::ustring>(view_a)));
+    ASSERT_EQ(2, map.at(U"world"_us));
+
+    return;
+}
@@ -0,0 +1,200 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/utf_codecs.hpp>
+
+namespace
+{
+    std::vector<std::uint8_t> make_octets(std::initializer_list<int> values)
+    {
+        std::vector<std::uint8_t> result;
+        for (int value : values)
+            result.push_back(static_cast<std::uint8_t>(value));
+        return (result);
+    }
+}
+
+TEST(utf_codecs_test, utf16)
+{
+    using namespace unistringxx::operators;
+
+    std::vector<std::uint8_t> octets;
+    unistringxx::encode_utf16(U"a世𝄞"_us, octets, unistringxx::byte_order::big_endian);
+    ASSERT_EQ(make_octets({0x00, 0x61, 0x4E, 0x16, 0xD8, 0x34, 0xDD, 0x1E}), octets);
+    ASSERT_EQ(
+        U"a世𝄞"_us, unistringxx::decode_utf16(octets.data(), octets.size(), unistringxx::byte_order::big_endian)
+    );
+    // Big endian without a byte order mark.
+    ASSERT_EQ(U"a世𝄞"_us, unistringxx::decode_utf16(octets.data(), octets.size()));
+
+    octets.clear();
+    unistringxx::encode_utf16(U"a世𝄞"_us, octets, unistringxx::byte_order::little_endian, true);
+    ASSERT_EQ(make_octets({0xFF, 0xFE, 0x61, 0x00, 0x16, 0x4E, 0x34, 0xD8, 0x1E, 0xDD}), octets);
+    unistringxx::utf16_decoder decoder;
+    unistringxx::ustring text;
+    decoder.decode(octets.data(), octets.size(), text);
+    decoder.finish(text);
+    ASSERT_EQ(U"a世𝄞"_us, text);
+    ASSERT_EQ(unistringxx::byte_order::unknown, decoder.order());
+    ASSERT_EQ(
+        U"a世𝄞"_us, unistringxx::decode_utf16(octets.data(), octets.size(), unistringxx::byte_order::little_endian)
+    );
+
+    // A byte order mark for the other byte order is a character.
+    ASSERT_EQ(U"\uFFFE\u6100"_us, unistringxx::decode_utf16(octets.data(), 4, unistringxx::byte_order::big_endian));
+}
+
+TEST(utf_codecs_test, utf32)
+{
+    using namespace unistringxx::operators;
+
+    std::vector<std::uint8_t> octets;
+    unistringxx::encode_utf32(U"a𝄞"_us, octets, unistringxx::byte_order::big_endian, true);
+    ASSERT_EQ(make_octets({0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x61, 0x00, 0x01, 0xD1, 0x1E}), octets);
+    ASSERT_EQ(U"a𝄞"_us, unistringxx::decode_utf32(octets.data(), octets.size()));
+
+    octets.clear();
+    unistringxx::encode_utf32(U"a𝄞"_us, octets, unistringxx::byte_order::little_endian);
+    ASSERT_EQ(make_octets({0x61, 0x00, 0x00, 0x00, 0x1E, 0xD1, 0x01, 0x00}), octets);
+    ASSERT_EQ(
+        U"a𝄞"_us, unistringxx::decode_utf32(octets.data(), octets.size(), unistringxx::byte_order::little_endian)
+    );
+}
+
+TEST(utf_codecs_test, long_texts)
+{
+    using namespace unistringxx::operators;
+
+    // Long runs take the SIMD paths, which must agree with the code unit by code unit decoding.
+    unistringxx::ustring expected;
+    for (int ctr = 0; ctr < 500; ctr++)
+        expected.append((ctr % 7) ? U"plain ASCII and 世界 "_us : U"a 𝄞 pair "_us);
+    const unistringxx::byte_order orders[] = {
+        unistringxx::byte_order::big_endian, unistringxx::byte_order::little_endian
+    };
+    for (unistringxx::byte_order order : orders) {
+        for (int with_bom = 0; with_bom < 2; with_bom++) {
+            std::vector<std::uint8_t> utf16;
+            unistringxx::encode_utf16(expected, utf16, order, with_bom != 0);
+            ASSERT_EQ(expected, unistringxx::decode_utf16(utf16.data(), utf16.size(), order));
+            std::vector<std::uint8_t> utf32;
+            unistringxx::encode_utf32(expected, utf32, order, with_bom != 0);
+            ASSERT_EQ(expected, unistringxx::decode_utf32(utf32.data(), utf32.size(), order));
+            if (with_bom != 0) {
+                ASSERT_EQ(expected, unistringxx::decode_utf16(utf16.data(), utf16.size()));
+                ASSERT_EQ(expected, unistringxx::decode_utf32(utf32.data(), utf32.size()));
+            }
+        }
+    }
+}
+
+TEST(utf_codecs_test, streaming)
+{
+    using namespace unistringxx::operators;
+
+    // Every chunk size splits code units, surrogate pairs and the byte order mark.
+    unistringxx::ustring expected;
+    for (int ctr = 0; ctr < 50; ctr++)
+        expected.append(U"a𝄞世é"_us);
+    std::vector<std::uint8_t> utf16;
+    unistringxx::encode_utf16(expected, utf16, unistringxx::byte_order::little_endian, true);
+    std::vector<std::uint8_t> utf32;
+    unistringxx::encode_utf32(expected, utf32, unistringxx::byte_order::little_endian, true);
+    for (std::size_t chunk_size = 1; chunk_size <= 9; chunk_size++) {
+        unistringxx::utf16_decoder decoder16;
+        unistringxx::utf32_decoder decoder32;
+        unistringxx::ustring text16;
+        unistringxx::ustring text32;
+        for (std::size_t offset = 0; offset < utf16.size(); offset += chunk_size)
+            decoder16.decode(utf16.data() + offset, std::min(chunk_size, utf16.size() - offset), text16);
+        for (std::size_t offset = 0; offset < utf32.size(); offset += chunk_size)
+            decoder32.decode(utf32.data() + offset, std::min(chunk_size, utf32.size() - offset), text32);
+        ASSERT_EQ(unistringxx::byte_order::little_endian, decoder16.order());
+        decoder16.finish(text16);
+        decoder32.finish(text32);
+        ASSERT_EQ(expected, text16);
+        ASSERT_EQ(expected, text32);
+    }
+}
+
+TEST(utf_codecs_test, errors)
+{
+    using namespace unistringxx::operators;
+
+    // A lone low surrogate, an unpaired high surrogate followed by 'b', and a truncated code unit.
+    const std::vector<std::uint8_t> utf16 = make_octets({0x00, 0x61, 0xDC, 0x00, 0xD8, 0x00, 0x00, 0x62, 0x00});
+    ASSERT_THROW(unistringxx::decode_utf16(utf16.data(), utf16.size()), std::range_error);
+    ASSERT_EQ(
+        U"a��b�"_us,
+        unistringxx::decode_utf16(
+            utf16.data(), utf16.size(), unistringxx::byte_order::big_endian, unistringxx::codec_error_policy::replace
+        )
+    );
+    ASSERT_EQ(
+        U"ab"_us,
+        unistringxx::decode_utf16(
+            utf16.data(), utf16.size(), unistringxx::byte_order::big_endian, unistringxx::codec_error_policy::skip
+        )
+    );
+
+    // The text before the error is kept.
+    unistringxx::utf16_decoder decoder{unistringxx::byte_order::big_endian};
+    unistringxx::ustring text;
+    ASSERT_THROW(decoder.decode(utf16.data(), utf16.size(), text), std::range_error);
+    ASSERT_EQ(U"a"_us, text);
+
+    const std::vector<std::uint8_t> utf32 = make_octets({0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x00});
+    ASSERT_THROW(unistringxx::decode_utf32(utf32.data(), utf32.size()), std::range_error);
+    ASSERT_EQ(
+        U"��"_us,
+        unistringxx::decode_utf32(
+            utf32.data(), utf32.size(), unistringxx::byte_order::big_endian, unistringxx::codec_error_policy::replace
+        )
+    );
+
+    // Invalid code points while encoding.
+    const unistringxx::uchar_t invalid[] = {unistringxx::uchar_t{'a'}, unistringxx::uchar_t{0xD800}};
+    std::vector<std::uint8_t> octets;
+    ASSERT_THROW(unistringxx::encode_utf16(unistringxx::ustring_view{invalid, 2}, octets), std::range_error);
+    ASSERT_EQ(make_octets({0x00, 0x61}), octets);
+    octets.clear();
+    unistringxx::encode_utf16(
+        unistringxx::ustring_view{invalid, 2}, octets, unistringxx::byte_order::big_endian, false,
+        unistringxx::codec_error_policy::replace
+    );
+    ASSERT_EQ(make_octets({0x00, 0x61, 0xFF, 0xFD}), octets);
+}
+
+TEST(utf_codecs_test, split_chunk_errors)
+{
+    using namespace unistringxx::operators;
+
+    // A lone low surrogate split between two chunks, followed by more text in the second chunk.
+    const std::vector<std::uint8_t> first = make_octets({0x00, 0x61, 0xDC});
+    const std::vector<std::uint8_t> second = make_octets({0x00, 0x00, 0x41, 0x00, 0x42});
+    unistringxx::utf16_decoder strict_decoder{unistringxx::byte_order::big_endian};
+    unistringxx::ustring text;
+    strict_decoder.decode(first.data(), first.size(), text);
+    ASSERT_THROW(strict_decoder.decode(second.data(), second.size(), text), std::range_error);
+    ASSERT_EQ(U"a"_us, text);
+
+    // An unpaired high surrogate and the start of a surrogate pair, completed over the next chunks: only the
+    // incomplete pair stays pending.
+    const std::vector<std::uint8_t> chunks[] = {
+        make_octets({0xD8, 0x00, 0xD8}), make_octets({0x00}), make_octets({0xDC, 0x00, 0x00}), make_octets({0x62})
+    };
+    unistringxx::utf16_decoder replace_decoder{
+        unistringxx::byte_order::big_endian, unistringxx::codec_error_policy::replace
+    };
+    text.clear();
+    for (const std::vector<std::uint8_t>& chunk : chunks)
+        replace_decoder.decode(chunk.data(), chunk.size(), text);
+    replace_decoder.finish(text);
+    ASSERT_EQ(U"�𐀀b"_us, text);
+}
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/hash.hpp>
+#include <unistringxx/rope.hpp>
+#include <unistringxx/ustring.hpp>
+#include <unistringxx/ustring_view.hpp>
+#include <unistringxx/utf_ranges.hpp>
+
+namespace
+{
+    template<typename rangeT>
+    std::vector<std::uint32_t> read_forward(const rangeT& range)
+    {
+        std::vector<std::uint32_t> result;
+        for (unistringxx::uchar_t ch : range)
+            result.push_back(static_cast<std::uint32_t>(ch.code_point()));
+        return (result);
+    }
+
+    template<typename rangeT>
+    std::vector<std::uint32_t> read_backward(const rangeT& range)
+    {
+        std::vector<std::uint32_t> result;
+        for (auto itr = range.rbegin(); itr != range.rend(); ++itr)
+            result.push_back(static_cast<std::uint32_t>((*itr).code_point()));
+        std::reverse(result.begin(), result.end());
+        return (result);
+    }
+} // namespace
+
+TEST(utf_ranges_test, utf8)
+{
+    using namespace unistringxx::operators;
+
+    const std::string text = u8"Aé€😀 text";
+    const unistringxx::utf8_range range{text};
+    ASSERT_EQ(9, std::distance(range.begin(), range.end()));
+    const std::vector<std::uint32_t> expected = {'A', 0xE9, 0x20AC, 0x1F600, ' ', 't', 'e', 'x', 't'};
+    ASSERT_EQ(expected, read_forward(range));
+    ASSERT_EQ(expected, read_backward(range));
+
+    unistringxx::utf8_iterator itr = range.begin();
+    ++itr;
+    ++itr;
+    ASSERT_EQ(text.data() + 3, itr.base());
+    ASSERT_EQ(U'€'_uc, *itr--);
+    ASSERT_EQ(U'é'_uc, *itr);
+    ASSERT_TRUE(unistringxx::utf8_range{}.empty());
+    ASSERT_TRUE(unistringxx::utf8_range{}.begin() == unistringxx::utf8_range{}.end());
+
+    // Each invalid octet is U+FFFD, in both directions: a truncated sequence, a stray continuation octet, an
+    // overlong form, a surrogate and a sequence cut by the end of the buffer.
+    const std::string invalid = "a\xE2\x82" "b\x80\xC0\xAF\xED\xA0\x80\xE2\x82\xAC\xF0\x9F\x98";
+    const std::vector<std::uint32_t> replaced = {
+        'a', 0xFFFD, 0xFFFD, 'b', 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x20AC, 0xFFFD, 0xFFFD, 0xFFFD
+    };
+    ASSERT_EQ(replaced, read_forward(unistringxx::utf8_range{invalid}));
+    ASSERT_EQ(replaced, read_backward(unistringxx::utf8_range{invalid}));
+
+    // Backward iteration resynchronizes on any mix of lead and continuation octets.
+    const unsigned char octets[] = {'a', 0x80, 0xBF, 0xC3, 0xA9, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x80, 0xF4, 0x90};
+    std::uint32_t random = 12345;
+    for (int ctr = 0; ctr < 500; ctr++) {
+        std::string buffer;
+        for (int octet = 0; octet < 24; octet++) {
+            random = (random * 1103515245u) + 12345u;
+            buffer.push_back(static_cast<char>(octets[(random >> 16) % sizeof (octets)]));
+        }
+        const unistringxx::utf8_range buffer_range{buffer};
+        ASSERT_EQ(read_forward(buffer_range), read_backward(buffer_range)) << ctr;
+    }
+}
+
+TEST(utf_ranges_test, utf16_and_utf32)
+{
+    const std::u16string text = u"A€😀z";
+    const unistringxx::utf16_range range{text};
+    const std::vector<std::uint32_t> expected = {'A', 0x20AC, 0x1F600, 'z'};
+    ASSERT_EQ(expected, read_forward(range));
+    ASSERT_EQ(expected, read_backward(range));
+    ASSERT_EQ(4, std::distance(range.begin(), range.end()));
+
+    // Unpaired surrogates.
+    const std::vector<char16_t> invalid = {0xDC00, 'a', 0xD800, 0xD83D, 0xDE00, 0xD800};
+    const unistringxx::utf16_range invalid_range{invalid.data(), invalid.size()};
+    const std::vector<std::uint32_t> replaced = {0xFFFD, 'a', 0xFFFD, 0x1F600, 0xFFFD};
+    ASSERT_EQ(replaced, read_forward(invalid_range));
+    ASSERT_EQ(replaced, read_backward(invalid_range));
+
+    const std::vector<char32_t> utf32 = {'A', 0x1F600, 0xD800, 0x110000, 'z'};
+    const unistringxx::utf32_range utf32_range{utf32.data(), utf32.size()};
+    const std::vector<std::uint32_t> utf32_expected = {'A', 0x1F600, 0xFFFD, 0xFFFD, 'z'};
+    ASSERT_EQ(utf32_expected, read_forward(utf32_range));
+    ASSERT_EQ(utf32_expected, read_backward(utf32_range));
+}
+
+TEST(utf_ranges_test, hashing)
+{
+    // The hash of a range is the hash of its code points, for every length around the block sizes of the hash.
+    std::string text;
+    for (std::size_t size = 0; size < 150; size++) {
+        const unistringxx::ustring str = unistringxx::ustring::from_u8string(text);
+        const unistringxx::utf8_range range{text};
+        ASSERT_EQ(
+            unistringxx::hash_code_points(str.data(), str.size()),
+            unistringxx::hash_code_points(range.begin(), range.end())
+        ) << size;
+        ASSERT_EQ(
+            unistringxx::hash_code_points(str.data(), str.size(), 42),
+            unistringxx::hash_code_points(range.begin(), range.end(), 42)
+        ) << size;
+        text += ((size % 7) == 3) ? u8"é" : ((size % 11) == 5) ? u8"😀" : "x";
+    }
+
+    using namespace unistringxx::operators;
+
+    const unistringxx::ustring str = U"A rope, a string and an encoded buffer: 日本語"_us;
+    const std::string utf8 = str.to_u8string();
+    const std::u16string utf16 = str.to_u16string();
+    ASSERT_EQ(unistringxx::ustring_hash{}(str), unistringxx::ustring_hash{}(unistringxx::utf8_range{utf8}));
+    ASSERT_EQ(unistringxx::ustring_hash{}(str), unistringxx::ustring_hash{}(unistringxx::utf16_range{utf16}));
+    ASSERT_EQ(unistringxx::ustring_hash{}(str), unistringxx::ustring_hash{}(unistringxx::rope{str}));
+    ASSERT_TRUE(unistringxx::ustring_equal_to{}(str, unistringxx::utf8_range{utf8}));
+    ASSERT_TRUE(unistringxx::ustring_equal_to{}(unistringxx::utf16_range{utf16}, str));
+    ASSERT_FALSE(unistringxx::ustring_equal_to{}(str.substr(1), unistringxx::utf8_range{utf8}));
+    ASSERT_FALSE(unistringxx::ustring_equal_to{}(str, unistringxx::utf8_range{utf8.data(), utf8.size() - 3}));
+
+    unistringxx::hasher left;
+    left.update(str);
+    unistringxx::hasher right;
+    right.update(unistringxx::utf8_range{utf8}.begin(), unistringxx::utf8_range{utf8}.end());
+    ASSERT_EQ(left.digest(), right.digest());
+}
+
+TEST(utf_ranges_test, compare_and_find)
+{
+    using namespace unistringxx::operators;
+
+    const std::string utf8 = u8"déjà vu, déjà lu";
+    const unistringxx::utf8_range range{utf8};
+    ASSERT_EQ(0, unistringxx::compare_code_points(range, U"déjà vu, déjà lu"_us));
+    ASSERT_TRUE(unistringxx::equal_code_points(U"déjà vu, déjà lu"_us, range));
+    ASSERT_GT(0, unistringxx::compare_code_points(range, U"déjà vu, déjà lu!"_us));
+    ASSERT_LT(0, unistringxx::compare_code_points(range, U"déjà vu"_us));
+    ASSERT_LT(0, unistringxx::compare_code_points(range, U"déjà vu, déjà la"_us));
+    ASSERT_GT(0, unistringxx::compare_code_points(unistringxx::ustring_view{}, range));
+    ASSERT_EQ(0, unistringxx::compare_code_points(unistringxx::utf16_range{u"déjà vu, déjà lu"}, range));
+
+    unistringxx::utf8_iterator found = unistringxx::find_code_points(range, U"déjà l"_us);
+    ASSERT_TRUE(found != range.end());
+    ASSERT_EQ(utf8.find(u8"déjà l"), static_cast<std::size_t>(found.base() - utf8.data()));
+    ASSERT_EQ(9, std::distance(range.begin(), found));
+    ASSERT_TRUE(unistringxx::find_code_points(range, U"déjà x"_us) == range.end());
+    ASSERT_TRUE(unistringxx::find_code_points(range, U""_us) == range.begin());
+    found = unistringxx::find_code_points(range, U'à'_uc);
+    ASSERT_EQ(utf8.data() + 4, found.base());
+    ASSERT_TRUE(unistringxx::find_code_points(range, U'z'_uc) == range.end());
+
+    // Any range of code points.
+    const unistringxx::rope rope{U"déjà vu"_us};
+    ASSERT_EQ(0, unistringxx::compare_code_points(rope, unistringxx::utf8_range{u8"déjà vu"}));
+    ASSERT_EQ(5, std::distance(rope.begin(), unistringxx::find_code_points(rope, U"vu"_us)));
+}
@@ -0,0 +1,117 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <unistringxx/ustring.hpp>
+#include <unistringxx/ustring_view.hpp>
+#include <unistringxx/utf_validation.hpp>
+
+namespace
+{
+    // Builds a text around the block sizes of the kernels: ASCII runs and multi-octet code points.
+    std::string make_text(std::size_t size)
+    {
+        std::string result;
+        for (std::size_t ctr = 0; ctr < size; ctr++)
+            result += ((ctr % 13) == 5) ? u8"é" : ((ctr % 29) == 7) ? u8"😀" : ((ctr % 31) == 11) ? u8"日" : "x";
+        return (result);
+    }
+} // namespace
+
+TEST(utf_validation_test, validate_utf8)
+{
+    ASSERT_EQ(0u, unistringxx::validate_utf8("", 0));
+    for (std::size_t size = 0; size < 200; size++) {
+        const std::string text = make_text(size);
+        ASSERT_EQ(text.size(), unistringxx::validate_utf8(text.data(), text.size())) << size;
+        // An invalid octet anywhere is found at its offset.
+        std::size_t offset = text.size() / 2;
+        while ((offset > 0) && ((static_cast<unsigned char>(text[offset]) & 0xC0) == 0x80))
+            offset--;
+        std::string invalid = text;
+        invalid.insert(offset, "\xFF");
+        ASSERT_EQ(offset, unistringxx::validate_utf8(invalid.data(), invalid.size())) << size;
+    }
+
+    // Overlong forms, surrogates, values above U+10FFFF, stray continuation octets and truncated sequences.
+    const char* const invalid_sequences[] = {
+        "\xC0\xAF", "\xC1\xBF", "\xE0\x80\xAF", "\xE0\x9F\xBF", "\xF0\x8F\xBF\xBF", "\xED\xA0\x80", "\xED\xBF\xBF",
+        "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\x80", "\xBF", "\xC3", "\xE2\x82", "\xF0\x9F\x98", "\xE2\x28\xA1"
+    };
+    for (const char* sequence : invalid_sequences) {
+        const std::string text = "valid prefix " + std::string(sequence) + " suffix";
+        ASSERT_EQ(13u, unistringxx::validate_utf8(text.data(), text.size())) << text;
+    }
+    const std::string boundaries = u8"\u0080\u07FF\u0800\uD7FF\uE000\uFFFF\U00010000\U0010FFFF";
+    ASSERT_EQ(boundaries.size(), unistringxx::validate_utf8(boundaries.data(), boundaries.size()));
+    // A sequence cut by the end of the buffer.
+    ASSERT_EQ(2u, unistringxx::validate_utf8(boundaries.data(), 3));
+}
+
+TEST(utf_validation_test, validate_utf16)
+{
+    const std::u16string text = u"Some text with é, 日本語 and 😀, long enough for several blocks of code units. 😀";
+    ASSERT_EQ(text.size(), unistringxx::validate_utf16(text.data(), text.size()));
+    ASSERT_EQ(0u, unistringxx::validate_utf16(text.data(), 0));
+    for (std::size_t offset = 0; offset <= text.size(); offset++) {
+        // Within a surrogate pair, a high surrogate leaves the one before it unpaired, and a low surrogate pairs with
+        // it instead of the one after it.
+        const bool is_in_pair = (offset > 0) && (text[offset - 1] >= 0xD800) && (text[offset - 1] <= 0xDBFF);
+        std::u16string lone_high = text;
+        lone_high.insert(offset, 1, u'\xD800');
+        ASSERT_EQ(is_in_pair ? offset - 1 : offset, unistringxx::validate_utf16(lone_high.data(), lone_high.size()))
+            << offset;
+        std::u16string lone_low = text;
+        lone_low.insert(offset, 1, u'\xDC00');
+        ASSERT_EQ(is_in_pair ? offset + 1 : offset, unistringxx::validate_utf16(lone_low.data(), lone_low.size()))
+            << offset;
+    }
+    // A surrogate pair cut by the end of the buffer.
+    ASSERT_EQ(text.size() - 2, unistringxx::validate_utf16(text.data(), text.size() - 1));
+}
+
+TEST(utf_validation_test, count_code_points)
+{
+    for (std::size_t size = 0; size < 600; size += 7) {
+        const std::string text = make_text(size);
+        ASSERT_EQ(size, unistringxx::count_code_points_utf8(text.data(), text.size())) << size;
+        const unistringxx::ustring str = unistringxx::ustring::from_u8string(text);
+        ASSERT_EQ(size, str.size());
+        const std::u16string utf16 = str.to_u16string();
+        ASSERT_EQ(size, unistringxx::count_code_points_utf16(utf16.data(), utf16.size())) << size;
+    }
+
+    // More blocks than the lanes of the counters hold before they are added up.
+    const std::string large = make_text(20000);
+    ASSERT_EQ(20000u, unistringxx::count_code_points_utf8(large.data(), large.size()));
+    const std::u16string large_utf16(70000, u'a');
+    ASSERT_EQ(70000u, unistringxx::count_code_points_utf16(large_utf16.data(), large_utf16.size()));
+
+    // Low surrogates in every other unit, so the 16-bit lanes of the counters go above 32767.
+    std::u16string astral;
+    for (std::size_t ctr = 0; ctr < 300000; ctr++)
+        astral += u"\U0001F600";
+    ASSERT_EQ(300000u, unistringxx::count_code_points_utf16(astral.data(), astral.size()));
+    ASSERT_EQ(300000u, unistringxx::ustring::from_u16string(astral).size());
+}
+
+TEST(utf_validation_test, length_of)
+{
+    using namespace unistringxx::operators;
+
+    for (std::size_t size = 0; size < 200; size += 3) {
+        const std::string text = make_text(size);
+        const unistringxx::ustring str = unistringxx::ustring::from_u8string(text);
+        ASSERT_EQ(text.size(), unistringxx::utf8_length_of(str)) << size;
+        ASSERT_EQ(text, str.to_u8string()) << size;
+        ASSERT_EQ(str.to_u16string().size(), unistringxx::utf16_length_of(str)) << size;
+        ASSERT_EQ(str, unistringxx::ustring::from_u16string(str.to_u16string())) << size;
+    }
+    const unistringxx::ustring str = U"A é € 😀"_us;
+    ASSERT_EQ(13u, unistringxx::utf8_length_of(unistringxx::ustring_view{str}));
+    ASSERT_EQ(8u, unistringxx::utf16_length_of(unistringxx::ustring_view{str}));
+    ASSERT_EQ(u8"é € 😀", str.to_u8string(2));
+    ASSERT_EQ(u"é €", str.to_u16string(2, 3));
+}
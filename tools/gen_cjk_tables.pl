@@ -0,0 +1,160 @@
+#!/usr/bin/env perl
+# Generates include/unistringxx/cjk_tables.hpp from the indexes checked in under data/ (see the comments at the top of
+# each file). The cjk_tables build target runs it, usage:
+#     perl tools/gen_cjk_tables.pl data include/unistringxx/cjk_tables.hpp
+#
+# An index maps pointers (0 to the number of rows times the row size) to code points. It is compressed into segments
+# of consecutive pointers, sorted by their first pointer, each with a 32-bit value:
+#     0: the pointers are not mapped.
+#     bit 31 clear: a linear run, the pointers map to the value plus their offset in the segment.
+#     bit 31 set: literals, bits 30..24 are the plane of the code points and bits 23..0 the offset of the first one in
+#         the literal pool, which holds the low 16 bits of the code points (0 if a pointer is not mapped).
+# For each row, the index of the segment that holds its first pointer limits the search to the segments of the row.
+use strict;
+use warnings;
+
+# Linear runs and unmapped gaps shorter than this are kept with the literals, since a segment costs 6 octets.
+my $minimum_run = 6;
+
+my $data_dir = shift @ARGV or die "usage: $0 data-directory [output]\n";
+my $output = shift @ARGV;
+if (defined $output) {
+    open(STDOUT, '>', $output) or die "Cannot open $output: $!\n";
+}
+
+sub read_index
+{
+    my ($name) = @_;
+    my $path = "$data_dir/index-$name.txt";
+    open(my $fh, '<', $path) or die "Cannot open $path: $!\n";
+    my @entries;
+    while (my $line = <$fh>) {
+        next if ($line =~ /^\s*(#|$)/);
+        die "Invalid line in $path: $line" unless ($line =~ /^(\d+)\s+0x([0-9A-F]+)\s*$/);
+        push @entries, [ $1, hex($2) ];
+    }
+    close($fh);
+    return (@entries);
+}
+
+sub emit_array
+{
+    my ($type, $name, $format, @items) = @_;
+    print "        const $type ${name}[] = {\n";
+    while (@items) {
+        my @line = splice(@items, 0, 12);
+        print "            ", join(", ", map { sprintf($format, $_) } @line), (@items ? "," : ""), "\n";
+    }
+    print "        };\n\n";
+    return;
+}
+
+sub run_length
+{
+    my ($code_points, $pointer) = @_;
+    my $length = 1;
+    my $first = $code_points->[$pointer];
+    while (($pointer + $length) < @$code_points) {
+        my $next = $code_points->[$pointer + $length];
+        last if ($first == 0 ? ($next != 0) : ($next != $first + $length));
+        $length++;
+    }
+    return ($length);
+}
+
+sub emit_index
+{
+    my ($name, $rows, $row_size) = @_;
+    (my $identifier = $name) =~ tr/-/_/;
+    my $pointer_count = $rows * $row_size;
+    my @code_points = (0) x $pointer_count;
+    for my $entry (read_index($name)) {
+        my ($pointer, $code_point) = @$entry;
+        die "Pointer $pointer is out of range in $name\n" if ($pointer >= $pointer_count);
+        die "Pointer $pointer is listed twice in $name\n" if ($code_points[$pointer] != 0);
+        # The literals keep the low 16 bits only, where 0 means that the pointer is not mapped.
+        die sprintf("U+%04X cannot be stored in $name\n", $code_point) if (($code_point & 0xFFFF) == 0);
+        $code_points[$pointer] = $code_point;
+    }
+
+    my (@starts, @values, @literals);
+    my $literal_plane = -1;
+    my $pointer = 0;
+    while ($pointer < $pointer_count) {
+        my $length = run_length(\@code_points, $pointer);
+        my $code_point = $code_points[$pointer];
+        if (($length >= $minimum_run) || ($pointer + $length == $pointer_count && $code_point == 0)) {
+            push @starts, $pointer;
+            push @values, $code_point;
+            $literal_plane = -1;
+            $pointer += $length;
+            next;
+        }
+        my $plane = $code_point >> 16;
+        if (($literal_plane < 0) || (($code_point != 0) && ($plane != $literal_plane))) {
+            push @starts, $pointer;
+            push @values, 0x80000000 | ($plane << 24) | scalar(@literals);
+            $literal_plane = $plane;
+        }
+        push @literals, $code_points[$pointer + $_] & 0xFFFF for (0 .. $length - 1);
+        $pointer += $length;
+    }
+
+    my @row_segments;
+    my $segment = 0;
+    for my $row (0 .. $rows - 1) {
+        $segment++ while ((($segment + 1) < @starts) && ($starts[$segment + 1] <= $row * $row_size));
+        push @row_segments, $segment;
+    }
+
+    my $mapped = grep { $_ != 0 } @code_points;
+    my $size = (@starts * 6) + (@literals * 2) + (@row_segments * 2);
+    print "        // index-$name.txt: $mapped code points, $size octets (", (@starts + 0), " segments)\n";
+    print "        const std::size_t _s_${identifier}_rows = $rows;\n";
+    print "        const std::size_t _s_${identifier}_row_size = $row_size;\n\n";
+    emit_array("std::uint16_t", "_s_${identifier}_segment_starts", "%d", @starts);
+    emit_array("std::uint32_t", "_s_${identifier}_segment_values", "0x%08X", @values);
+    emit_array("std::uint16_t", "_s_${identifier}_literals", "0x%04X", @literals);
+    emit_array("std::uint16_t", "_s_${identifier}_row_segments", "%d", @row_segments);
+    return;
+}
+
+sub emit_ranges
+{
+    my ($name) = @_;
+    (my $identifier = $name) =~ tr/-/_/;
+    my @entries = read_index($name);
+    print "        // index-$name.txt: ", (@entries + 0), " ranges\n";
+    emit_array("std::uint32_t", "_s_${identifier}_pointers", "%d", map { $_->[0] } @entries);
+    emit_array("std::uint16_t", "_s_${identifier}_code_points", "0x%04X", map { $_->[1] } @entries);
+    return;
+}
+
+print <<"HEADER";
+// This file is generated by tools/gen_cjk_tables.pl from the indexes under data/. Do not edit.
+#if !defined(UNISTRINGXX_CJK_TABLES_HPP)
+#define UNISTRINGXX_CJK_TABLES_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace unistringxx
+{
+    /// \@internal
+    namespace // ImplementationDetail
+    {
+HEADER
+
+emit_index("jis0208", 60, 188);
+emit_index("jis0212", 94, 94);
+emit_index("gb18030", 126, 190);
+emit_ranges("gb18030-ranges");
+emit_index("big5", 126, 157);
+
+print <<"FOOTER";
+    } // namespace // ImplementationDetail
+    /// \@endinternal
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_CJK_TABLES_HPP)
+FOOTER
@@ -0,0 +1,156 @@
+#!/usr/bin/env perl
+# Generates include/unistringxx/ducet_tables.hpp from the Default Unicode Collation Element Table (allkeys.txt, see
+# UTS #10) and the Unified_Ideograph property of the Unicode Character Database that ships with perl. Usage:
+#     perl tools/gen_ducet.pl /path/to/allkeys.txt > include/unistringxx/ducet_tables.hpp
+#
+# Collation elements are packed into 32 bits as:
+#     bits 30..15 primary weight, bits 14..6 secondary weight, bits 5..1 tertiary weight, bit 0 variable flag.
+#
+# Single code point mappings are stored as runs sorted by code point. Consecutive code points that map to a single
+# collation element with consecutive primary weights (and equal secondary/tertiary weights) share one run. The run info
+# is packed as:
+#     bits 15..0 offset into the collation element pool, bits 20..16 number of elements, bits 28..21 run length - 1,
+#     bit 29 set if the code point starts a contraction.
+use strict;
+use warnings;
+
+use Unicode::UCD qw(prop_invlist);
+
+my $allkeys = shift @ARGV or die "usage: $0 allkeys.txt\n";
+open(my $fh, '<', $allkeys) or die "Cannot open $allkeys: $!\n";
+
+my $version = 'unknown';
+my (%single, @contractions, @implicit);
+while (my $line = <$fh>) {
+    $version = $1 if ($line =~ /^\@version\s+(\S+)/);
+    if ($line =~ /^\@implicitweights\s+([0-9A-F]+)\.\.([0-9A-F]+);\s*([0-9A-F]+)/) {
+        push @implicit, [ hex($1), hex($2), hex($3) ];
+        next;
+    }
+    $line =~ s/#.*//;
+    next unless ($line =~ /^([0-9A-F ]+);\s*(.*)$/);
+    my ($code_points, $elements) = ($1, $2);
+    my @cps = map { hex } split(' ', $code_points);
+    my @ces;
+    while ($elements =~ /\[([.*])([0-9A-F]{4})\.([0-9A-F]{4})\.([0-9A-F]{4})\]/g) {
+        my ($variable, $p, $s, $t) = ($1 eq '*' ? 1 : 0, hex($2), hex($3), hex($4));
+        die "Weight out of range\n" if ($s > 0x1FF || $t > 0x1F);
+        push @ces, ($p << 15) | ($s << 6) | ($t << 1) | $variable;
+    }
+    if (@cps == 1) {
+        $single{$cps[0]} = \@ces;
+    }
+    else {
+        die "Contractions longer than 3 code points are not supported\n" if (@cps > 3);
+        push @contractions, [ @cps, (0) x (3 - @cps), \@ces ];
+    }
+}
+close($fh);
+
+# The DUCET and the UCD should come from the same Unicode version. When they do not (e.g. perl's UCD is newer than the
+# available allkeys.txt), the mismatch is recorded in the generated header: code points assigned after the DUCET
+# version get implicit weights (unassigned base, or the ideograph bases if the UCD lists them as Unified_Ideograph)
+# instead of their DUCET weights.
+my $ucd_version = Unicode::UCD::UnicodeVersion();
+my $version_note = '';
+if ($version ne $ucd_version) {
+    warn "warning: DUCET version $version does not match UCD version $ucd_version\n";
+    $version_note = <<"NOTE";
+// The versions differ: code points assigned after DUCET $version get implicit weights (UTS #10 section 10.1) rather
+// than their DUCET $ucd_version weights. Regenerate from allkeys.txt $ucd_version to remove the mismatch.
+NOTE
+}
+
+my %starter = map { $_->[0] => 1 } @contractions;
+for my $cp (keys %starter) {
+    die sprintf("Contraction starter %04X has no mapping of its own\n", $cp) unless (exists $single{$cp});
+}
+
+my (@pool, %pool_index);
+sub pool_offset
+{
+    my @ces = @_;
+    my $key = join(',', @ces);
+    unless (exists $pool_index{$key}) {
+        $pool_index{$key} = scalar(@pool);
+        push @pool, @ces;
+    }
+    return ($pool_index{$key});
+}
+
+my (@run_starts, @run_info, @run_last);
+for my $cp (sort { $a <=> $b } keys %single) {
+    my $ces = $single{$cp};
+    if (@run_starts && @$ces == 1 && !$starter{$cp}) {
+        my $start = $run_starts[-1];
+        my $length = $cp - $start + 1;
+        my $first = $single{$start};
+        if ($run_last[-1] == $cp - 1 && @$first == 1 && !$starter{$start} && $length <= 256 &&
+            ($first->[0] & 0x7FFF) == ($ces->[0] & 0x7FFF) && ($ces->[0] >> 15) == ($first->[0] >> 15) + ($length - 1)) {
+            $run_last[-1] = $cp;
+            next;
+        }
+    }
+    push @run_starts, $cp;
+    push @run_last, $cp;
+    push @run_info, pool_offset(@$ces) | (scalar(@$ces) << 16) | (($starter{$cp} ? 1 : 0) << 29);
+}
+for my $i (0 .. $#run_starts) {
+    $run_info[$i] |= ($run_last[$i] - $run_starts[$i]) << 21;
+}
+die "Collation element pool too large\n" if (@pool > 0xFFFF);
+
+@contractions = sort { $a->[0] <=> $b->[0] || $a->[1] <=> $b->[1] || $a->[2] <=> $b->[2] } @contractions;
+my @contraction_info = map { pool_offset(@{ $_->[3] }) | (scalar(@{ $_->[3] }) << 16) } @contractions;
+
+my @ideographs = grep { $_ <= 0x10FFFF } prop_invlist("Unified_Ideograph");
+
+sub emit_array
+{
+    my ($type, $name, $format, @items) = @_;
+    print "        const $type ${name}[] = {\n";
+    while (@items) {
+        my @line = splice(@items, 0, 10);
+        print "            ", join(", ", map { sprintf($format, $_) } @line), (@items ? "," : ""), "\n";
+    }
+    print "        };\n\n";
+    return;
+}
+
+print <<"HEADER";
+// This file is generated by tools/gen_ducet.pl from the Default Unicode Collation Element Table version $version and
+// the Unicode Character Database version $ucd_version. Do not edit.
+${version_note}#if !defined(UNISTRINGXX_DUCET_TABLES_HPP)
+#define UNISTRINGXX_DUCET_TABLES_HPP
+
+#include <cstdint>
+
+namespace unistringxx
+{
+    /// \@internal
+    namespace // ImplementationDetail
+    {
+HEADER
+
+print "        // Collation element pool.\n";
+emit_array("std::uint32_t", "_s_ducet_elements", "0x%08X", @pool);
+print "        // Single code point mappings (runs).\n";
+emit_array("std::uint32_t", "_s_ducet_run_starts", "0x%04X", @run_starts);
+emit_array("std::uint32_t", "_s_ducet_run_info", "0x%08X", @run_info);
+print "        // Contractions, sorted by code points (unused trailing code points are 0).\n";
+emit_array("std::uint32_t", "_s_ducet_contraction_first", "0x%04X", map { $_->[0] } @contractions);
+emit_array("std::uint32_t", "_s_ducet_contraction_second", "0x%04X", map { $_->[1] } @contractions);
+emit_array("std::uint32_t", "_s_ducet_contraction_third", "0x%04X", map { $_->[2] } @contractions);
+emit_array("std::uint32_t", "_s_ducet_contraction_info", "0x%08X", @contraction_info);
+print "        // Ranges with explicit implicit weight bases (first, last, base).\n";
+emit_array("std::uint32_t", "_s_ducet_implicit_ranges", "0x%04X", map { @$_ } @implicit);
+print "        // Unified_Ideograph (inversion list: even indices start a range, odd indices end it)\n";
+emit_array("std::uint32_t", "_s_unified_ideograph_ranges", "0x%04X", @ideographs);
+
+print <<"FOOTER";
+    } // namespace // ImplementationDetail
+    /// \@endinternal
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_DUCET_TABLES_HPP)
+FOOTER
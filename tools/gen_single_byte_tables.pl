@@ -0,0 +1,85 @@
+#!/usr/bin/env perl
+# Generates include/unistringxx/single_byte_tables.hpp from the character sets that ship with perl (Encode). Usage:
+#     perl tools/gen_single_byte_tables.pl > include/unistringxx/single_byte_tables.hpp
+#
+# Every character set below maps 0x00..0x7F to ASCII, so only the upper half is emitted:
+#     _s_<name>_decode: the code point of each octet 0x80..0xFF, or 0 if the octet is not defined.
+#     _s_<name>_encode_code_points, _s_<name>_encode_octets: the reverse mapping, sorted by code point (an octet
+#     reached from several code points keeps the first one).
+use strict;
+use warnings;
+
+use Encode ();
+
+my @charsets = (
+    [ 'us_ascii', 'ascii' ],
+    map({ [ "iso_8859_$_", "iso-8859-$_" ] } (1 .. 11, 13 .. 16)),
+    map({ [ "windows_$_", "cp$_" ] } (1250 .. 1258)),
+);
+
+sub emit_array
+{
+    my ($type, $name, $format, @items) = @_;
+    print "        const $type ${name}[] = {\n";
+    while (@items) {
+        my @line = splice(@items, 0, 12);
+        print "            ", join(", ", map { sprintf($format, $_) } @line), (@items ? "," : ""), "\n";
+    }
+    print "        };\n\n";
+    return;
+}
+
+sub decode_octet
+{
+    my ($encoding, $octet) = @_;
+    my $text = eval { Encode::decode($encoding, chr($octet), Encode::FB_CROAK) };
+    return (0) unless (defined $text);
+    die sprintf("%s maps 0x%02X to several code points\n", $encoding, $octet) unless (length($text) == 1);
+    die sprintf("%s maps 0x%02X outside the BMP\n", $encoding, $octet) if (ord($text) > 0xFFFF);
+    return (ord($text));
+}
+
+print <<"HEADER";
+// This file is generated by tools/gen_single_byte_tables.pl from the character sets of perl Encode version
+// $Encode::VERSION. Do not edit.
+#if !defined(UNISTRINGXX_SINGLE_BYTE_TABLES_HPP)
+#define UNISTRINGXX_SINGLE_BYTE_TABLES_HPP
+
+#include <cstdint>
+
+namespace unistringxx
+{
+    /// \@internal
+    namespace // ImplementationDetail
+    {
+HEADER
+
+for my $charset (@charsets) {
+    my ($name, $encoding) = @$charset;
+    for my $octet (0x00 .. 0x7F) {
+        die sprintf("%s does not map 0x%02X to ASCII\n", $encoding, $octet)
+            if (decode_octet($encoding, $octet) != $octet);
+    }
+    my @decode = map { decode_octet($encoding, $_) } (0x80 .. 0xFF);
+    my %encode;
+    for my $index (0 .. $#decode) {
+        next if (($decode[$index] == 0) || exists $encode{$decode[$index]});
+        $encode{$decode[$index]} = 0x80 + $index;
+    }
+    my @code_points = sort { $a <=> $b } keys %encode;
+
+    print "        // $encoding\n";
+    emit_array("std::uint16_t", "_s_${name}_decode", "0x%04X", @decode);
+    if (@code_points) {
+        emit_array("std::uint16_t", "_s_${name}_encode_code_points", "0x%04X", @code_points);
+        emit_array("std::uint8_t", "_s_${name}_encode_octets", "0x%02X", map { $encode{$_} } @code_points);
+    }
+}
+
+print <<"FOOTER";
+    } // namespace // ImplementationDetail
+    /// \@endinternal
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_SINGLE_BYTE_TABLES_HPP)
+FOOTER
@@ -0,0 +1,120 @@
+#!/usr/bin/env perl
+# Generates include/unistringxx/uproperties_tables.hpp from the Unicode Character Database that ships with perl
+# (Unicode::UCD). Usage:
+#     perl tools/gen_uproperties.pl > include/unistringxx/uproperties_tables.hpp
+#
+# Each enumerated property is emitted as an inversion map: a sorted array of range starts and a parallel array of
+# values. The value orders below must match the enumerations declared in uproperties.hpp.
+use strict;
+use warnings;
+
+use Unicode::UCD qw(prop_invmap prop_invlist);
+
+my @general_category = qw(
+    Cn Lu Ll Lt Lm Lo Mn Mc Me Nd Nl No Pc Pd Ps Pe Pi Pf Po Sm Sc Sk So Zs Zl Zp Cc Cf Cs Co
+);
+
+my @east_asian_width = qw(Neutral A H W F Na);
+
+my @line_break = qw(
+    Unknown BK CR LF NL SP ZW CM ZWJ WJ GL BA BB B2 HY CB CL CP EX IN NS OP QU IS NU PO PR SY AI AL CJ EB EM
+    H2 H3 HL ID JL JV JT RI SA SG
+);
+
+my @grapheme_cluster_break = qw(
+    Other CR LF Control Extend ZWJ Regional_Indicator Prepend SpacingMark L V T LV LVT ExtPict_XX
+);
+
+sub emit_array
+{
+    my ($type, $name, $format, @items) = @_;
+    print "        const $type ${name}[] = {\n";
+    while (@items) {
+        my @line = splice(@items, 0, 12);
+        print "            ", join(", ", map { sprintf($format, $_) } @line), (@items ? "," : ""), "\n";
+    }
+    print "        };\n\n";
+    return;
+}
+
+sub emit_invmap
+{
+    my ($property, $name, @order) = @_;
+    my %index;
+    @index{@order} = (0 .. $#order);
+
+    my ($starts, $values) = prop_invmap($property);
+    my (@out_starts, @out_values);
+    for my $i (0 .. $#$starts) {
+        last if ($starts->[$i] > 0x10FFFF);
+        die "Unknown $property value: $values->[$i]\n" unless (exists $index{$values->[$i]});
+        my $value = $index{$values->[$i]};
+        next if (@out_values && $out_values[-1] == $value);
+        push @out_starts, $starts->[$i];
+        push @out_values, $value;
+    }
+
+    print "        // $property\n";
+    emit_array("std::uint32_t", "_s_${name}_starts", "0x%04X", @out_starts);
+    emit_array("std::uint8_t", "_s_${name}_values", "%d", @out_values);
+    return;
+}
+
+sub emit_invlist
+{
+    my ($property, $name) = @_;
+    my @ranges = grep { $_ <= 0x10FFFF } prop_invlist($property);
+    print "        // $property (inversion list: even indices start a range, odd indices end it)\n";
+    emit_array("std::uint32_t", "_s_${name}_ranges", "0x%04X", @ranges);
+    return;
+}
+
+# Decimal digits (General_Category Nd) are encoded in contiguous runs of ten, from zero to nine. Only the zeros are
+# emitted; the value of a digit is its offset from the closest preceding zero.
+sub emit_decimal_digit_zeros
+{
+    my @ranges = grep { $_ <= 0x10FFFF } prop_invlist("General_Category=Nd");
+    my @zeros;
+    for (my $i = 0; $i < @ranges; $i += 2) {
+        my ($first, $last) = ($ranges[$i], $ranges[$i + 1]);
+        die sprintf("Nd range %04X..%04X is not made of whole digit runs\n", $first, $last - 1)
+            if ((($last - $first) % 10) != 0);
+        for (my $cp = $first; $cp < $last; $cp += 10) {
+            die sprintf("%04X is not a zero\n", $cp) unless (Unicode::UCD::charinfo($cp)->{decimal} eq '0');
+            push @zeros, $cp;
+        }
+    }
+    print "        // General_Category=Nd (zero digits)\n";
+    emit_array("std::uint32_t", "_s_decimal_digit_zeros", "0x%04X", @zeros);
+    return;
+}
+
+print <<"HEADER";
+// This file is generated by tools/gen_uproperties.pl from the Unicode Character Database version
+// @{[ Unicode::UCD::UnicodeVersion() ]}. Do not edit.
+#if !defined(UNISTRINGXX_UPROPERTIES_TABLES_HPP)
+#define UNISTRINGXX_UPROPERTIES_TABLES_HPP
+
+#include <cstdint>
+
+namespace unistringxx
+{
+    /// \@internal
+    namespace // ImplementationDetail
+    {
+HEADER
+
+emit_invmap("General_Category", "general_category", @general_category);
+emit_invmap("East_Asian_Width", "east_asian_width", @east_asian_width);
+emit_invmap("Line_Break", "line_break", @line_break);
+emit_invmap("Grapheme_Cluster_Break", "grapheme_cluster_break", @grapheme_cluster_break);
+emit_invlist("Extended_Pictographic", "extended_pictographic");
+emit_decimal_digit_zeros();
+
+print <<"FOOTER";
+    } // namespace // ImplementationDetail
+    /// \@endinternal
+} // namespace unistringxx
+
+#endif // !defined(UNISTRINGXX_UPROPERTIES_TABLES_HPP)
+FOOTER